@@ -0,0 +1,1001 @@
+$("#root")
+    .addClass("c0")
+    .find(".x1")
+    [2]
+    .css({width: 3, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5)
+    .eq(6).parent()
+    .each((i, el) => el.id + 7)
+    .data[k8]
+    .then(r => r.v9)
+    .html(`<b>${x10}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c12")
+    .find(".x13")
+    [14]
+    .css({width: 15, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v17)
+    .eq(18).parent()
+    .each((i, el) => el.id + 19)
+    .data[k20]
+    .then(r => r.v21)
+    .html(`<b>${x22}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c24")
+    .find(".x25")
+    [26]
+    .css({width: 27, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v29)
+    .eq(30).parent()
+    .each((i, el) => el.id + 31)
+    .data[k32]
+    .then(r => r.v33)
+    .html(`<b>${x34}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c36")
+    .find(".x37")
+    [38]
+    .css({width: 39, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v41)
+    .eq(42).parent()
+    .each((i, el) => el.id + 43)
+    .data[k44]
+    .then(r => r.v45)
+    .html(`<b>${x46}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c48")
+    .find(".x49")
+    [50]
+    .css({width: 51, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v53)
+    .eq(54).parent()
+    .each((i, el) => el.id + 55)
+    .data[k56]
+    .then(r => r.v57)
+    .html(`<b>${x58}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c60")
+    .find(".x61")
+    [62]
+    .css({width: 63, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v65)
+    .eq(66).parent()
+    .each((i, el) => el.id + 67)
+    .data[k68]
+    .then(r => r.v69)
+    .html(`<b>${x70}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c72")
+    .find(".x73")
+    [74]
+    .css({width: 75, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v77)
+    .eq(78).parent()
+    .each((i, el) => el.id + 79)
+    .data[k80]
+    .then(r => r.v81)
+    .html(`<b>${x82}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c84")
+    .find(".x85")
+    [86]
+    .css({width: 87, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v89)
+    .eq(90).parent()
+    .each((i, el) => el.id + 91)
+    .data[k92]
+    .then(r => r.v93)
+    .html(`<b>${x94}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c96")
+    .find(".x97")
+    [98]
+    .css({width: 99, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v101)
+    .eq(102).parent()
+    .each((i, el) => el.id + 103)
+    .data[k104]
+    .then(r => r.v105)
+    .html(`<b>${x106}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c108")
+    .find(".x109")
+    [110]
+    .css({width: 111, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v113)
+    .eq(114).parent()
+    .each((i, el) => el.id + 115)
+    .data[k116]
+    .then(r => r.v117)
+    .html(`<b>${x118}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c120")
+    .find(".x121")
+    [122]
+    .css({width: 123, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v125)
+    .eq(126).parent()
+    .each((i, el) => el.id + 127)
+    .data[k128]
+    .then(r => r.v129)
+    .html(`<b>${x130}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c132")
+    .find(".x133")
+    [134]
+    .css({width: 135, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v137)
+    .eq(138).parent()
+    .each((i, el) => el.id + 139)
+    .data[k140]
+    .then(r => r.v141)
+    .html(`<b>${x142}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c144")
+    .find(".x145")
+    [146]
+    .css({width: 147, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v149)
+    .eq(150).parent()
+    .each((i, el) => el.id + 151)
+    .data[k152]
+    .then(r => r.v153)
+    .html(`<b>${x154}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c156")
+    .find(".x157")
+    [158]
+    .css({width: 159, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v161)
+    .eq(162).parent()
+    .each((i, el) => el.id + 163)
+    .data[k164]
+    .then(r => r.v165)
+    .html(`<b>${x166}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c168")
+    .find(".x169")
+    [170]
+    .css({width: 171, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v173)
+    .eq(174).parent()
+    .each((i, el) => el.id + 175)
+    .data[k176]
+    .then(r => r.v177)
+    .html(`<b>${x178}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c180")
+    .find(".x181")
+    [182]
+    .css({width: 183, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v185)
+    .eq(186).parent()
+    .each((i, el) => el.id + 187)
+    .data[k188]
+    .then(r => r.v189)
+    .html(`<b>${x190}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c192")
+    .find(".x193")
+    [194]
+    .css({width: 195, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v197)
+    .eq(198).parent()
+    .each((i, el) => el.id + 199)
+    .data[k200]
+    .then(r => r.v201)
+    .html(`<b>${x202}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c204")
+    .find(".x205")
+    [206]
+    .css({width: 207, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v209)
+    .eq(210).parent()
+    .each((i, el) => el.id + 211)
+    .data[k212]
+    .then(r => r.v213)
+    .html(`<b>${x214}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c216")
+    .find(".x217")
+    [218]
+    .css({width: 219, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v221)
+    .eq(222).parent()
+    .each((i, el) => el.id + 223)
+    .data[k224]
+    .then(r => r.v225)
+    .html(`<b>${x226}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c228")
+    .find(".x229")
+    [230]
+    .css({width: 231, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v233)
+    .eq(234).parent()
+    .each((i, el) => el.id + 235)
+    .data[k236]
+    .then(r => r.v237)
+    .html(`<b>${x238}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c240")
+    .find(".x241")
+    [242]
+    .css({width: 243, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v245)
+    .eq(246).parent()
+    .each((i, el) => el.id + 247)
+    .data[k248]
+    .then(r => r.v249)
+    .html(`<b>${x250}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c252")
+    .find(".x253")
+    [254]
+    .css({width: 255, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v257)
+    .eq(258).parent()
+    .each((i, el) => el.id + 259)
+    .data[k260]
+    .then(r => r.v261)
+    .html(`<b>${x262}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c264")
+    .find(".x265")
+    [266]
+    .css({width: 267, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v269)
+    .eq(270).parent()
+    .each((i, el) => el.id + 271)
+    .data[k272]
+    .then(r => r.v273)
+    .html(`<b>${x274}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c276")
+    .find(".x277")
+    [278]
+    .css({width: 279, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v281)
+    .eq(282).parent()
+    .each((i, el) => el.id + 283)
+    .data[k284]
+    .then(r => r.v285)
+    .html(`<b>${x286}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c288")
+    .find(".x289")
+    [290]
+    .css({width: 291, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v293)
+    .eq(294).parent()
+    .each((i, el) => el.id + 295)
+    .data[k296]
+    .then(r => r.v297)
+    .html(`<b>${x298}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c300")
+    .find(".x301")
+    [302]
+    .css({width: 303, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v305)
+    .eq(306).parent()
+    .each((i, el) => el.id + 307)
+    .data[k308]
+    .then(r => r.v309)
+    .html(`<b>${x310}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c312")
+    .find(".x313")
+    [314]
+    .css({width: 315, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v317)
+    .eq(318).parent()
+    .each((i, el) => el.id + 319)
+    .data[k320]
+    .then(r => r.v321)
+    .html(`<b>${x322}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c324")
+    .find(".x325")
+    [326]
+    .css({width: 327, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v329)
+    .eq(330).parent()
+    .each((i, el) => el.id + 331)
+    .data[k332]
+    .then(r => r.v333)
+    .html(`<b>${x334}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c336")
+    .find(".x337")
+    [338]
+    .css({width: 339, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v341)
+    .eq(342).parent()
+    .each((i, el) => el.id + 343)
+    .data[k344]
+    .then(r => r.v345)
+    .html(`<b>${x346}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c348")
+    .find(".x349")
+    [350]
+    .css({width: 351, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v353)
+    .eq(354).parent()
+    .each((i, el) => el.id + 355)
+    .data[k356]
+    .then(r => r.v357)
+    .html(`<b>${x358}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c360")
+    .find(".x361")
+    [362]
+    .css({width: 363, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v365)
+    .eq(366).parent()
+    .each((i, el) => el.id + 367)
+    .data[k368]
+    .then(r => r.v369)
+    .html(`<b>${x370}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c372")
+    .find(".x373")
+    [374]
+    .css({width: 375, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v377)
+    .eq(378).parent()
+    .each((i, el) => el.id + 379)
+    .data[k380]
+    .then(r => r.v381)
+    .html(`<b>${x382}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c384")
+    .find(".x385")
+    [386]
+    .css({width: 387, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v389)
+    .eq(390).parent()
+    .each((i, el) => el.id + 391)
+    .data[k392]
+    .then(r => r.v393)
+    .html(`<b>${x394}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c396")
+    .find(".x397")
+    [398]
+    .css({width: 399, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v401)
+    .eq(402).parent()
+    .each((i, el) => el.id + 403)
+    .data[k404]
+    .then(r => r.v405)
+    .html(`<b>${x406}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c408")
+    .find(".x409")
+    [410]
+    .css({width: 411, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v413)
+    .eq(414).parent()
+    .each((i, el) => el.id + 415)
+    .data[k416]
+    .then(r => r.v417)
+    .html(`<b>${x418}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c420")
+    .find(".x421")
+    [422]
+    .css({width: 423, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v425)
+    .eq(426).parent()
+    .each((i, el) => el.id + 427)
+    .data[k428]
+    .then(r => r.v429)
+    .html(`<b>${x430}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c432")
+    .find(".x433")
+    [434]
+    .css({width: 435, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v437)
+    .eq(438).parent()
+    .each((i, el) => el.id + 439)
+    .data[k440]
+    .then(r => r.v441)
+    .html(`<b>${x442}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c444")
+    .find(".x445")
+    [446]
+    .css({width: 447, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v449)
+    .eq(450).parent()
+    .each((i, el) => el.id + 451)
+    .data[k452]
+    .then(r => r.v453)
+    .html(`<b>${x454}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c456")
+    .find(".x457")
+    [458]
+    .css({width: 459, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v461)
+    .eq(462).parent()
+    .each((i, el) => el.id + 463)
+    .data[k464]
+    .then(r => r.v465)
+    .html(`<b>${x466}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c468")
+    .find(".x469")
+    [470]
+    .css({width: 471, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v473)
+    .eq(474).parent()
+    .each((i, el) => el.id + 475)
+    .data[k476]
+    .then(r => r.v477)
+    .html(`<b>${x478}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c480")
+    .find(".x481")
+    [482]
+    .css({width: 483, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v485)
+    .eq(486).parent()
+    .each((i, el) => el.id + 487)
+    .data[k488]
+    .then(r => r.v489)
+    .html(`<b>${x490}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c492")
+    .find(".x493")
+    [494]
+    .css({width: 495, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v497)
+    .eq(498).parent()
+    .each((i, el) => el.id + 499)
+    .data[k500]
+    .then(r => r.v501)
+    .html(`<b>${x502}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c504")
+    .find(".x505")
+    [506]
+    .css({width: 507, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v509)
+    .eq(510).parent()
+    .each((i, el) => el.id + 511)
+    .data[k512]
+    .then(r => r.v513)
+    .html(`<b>${x514}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c516")
+    .find(".x517")
+    [518]
+    .css({width: 519, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v521)
+    .eq(522).parent()
+    .each((i, el) => el.id + 523)
+    .data[k524]
+    .then(r => r.v525)
+    .html(`<b>${x526}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c528")
+    .find(".x529")
+    [530]
+    .css({width: 531, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v533)
+    .eq(534).parent()
+    .each((i, el) => el.id + 535)
+    .data[k536]
+    .then(r => r.v537)
+    .html(`<b>${x538}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c540")
+    .find(".x541")
+    [542]
+    .css({width: 543, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v545)
+    .eq(546).parent()
+    .each((i, el) => el.id + 547)
+    .data[k548]
+    .then(r => r.v549)
+    .html(`<b>${x550}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c552")
+    .find(".x553")
+    [554]
+    .css({width: 555, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v557)
+    .eq(558).parent()
+    .each((i, el) => el.id + 559)
+    .data[k560]
+    .then(r => r.v561)
+    .html(`<b>${x562}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c564")
+    .find(".x565")
+    [566]
+    .css({width: 567, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v569)
+    .eq(570).parent()
+    .each((i, el) => el.id + 571)
+    .data[k572]
+    .then(r => r.v573)
+    .html(`<b>${x574}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c576")
+    .find(".x577")
+    [578]
+    .css({width: 579, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v581)
+    .eq(582).parent()
+    .each((i, el) => el.id + 583)
+    .data[k584]
+    .then(r => r.v585)
+    .html(`<b>${x586}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c588")
+    .find(".x589")
+    [590]
+    .css({width: 591, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v593)
+    .eq(594).parent()
+    .each((i, el) => el.id + 595)
+    .data[k596]
+    .then(r => r.v597)
+    .html(`<b>${x598}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c600")
+    .find(".x601")
+    [602]
+    .css({width: 603, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v605)
+    .eq(606).parent()
+    .each((i, el) => el.id + 607)
+    .data[k608]
+    .then(r => r.v609)
+    .html(`<b>${x610}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c612")
+    .find(".x613")
+    [614]
+    .css({width: 615, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v617)
+    .eq(618).parent()
+    .each((i, el) => el.id + 619)
+    .data[k620]
+    .then(r => r.v621)
+    .html(`<b>${x622}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c624")
+    .find(".x625")
+    [626]
+    .css({width: 627, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v629)
+    .eq(630).parent()
+    .each((i, el) => el.id + 631)
+    .data[k632]
+    .then(r => r.v633)
+    .html(`<b>${x634}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c636")
+    .find(".x637")
+    [638]
+    .css({width: 639, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v641)
+    .eq(642).parent()
+    .each((i, el) => el.id + 643)
+    .data[k644]
+    .then(r => r.v645)
+    .html(`<b>${x646}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c648")
+    .find(".x649")
+    [650]
+    .css({width: 651, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v653)
+    .eq(654).parent()
+    .each((i, el) => el.id + 655)
+    .data[k656]
+    .then(r => r.v657)
+    .html(`<b>${x658}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c660")
+    .find(".x661")
+    [662]
+    .css({width: 663, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v665)
+    .eq(666).parent()
+    .each((i, el) => el.id + 667)
+    .data[k668]
+    .then(r => r.v669)
+    .html(`<b>${x670}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c672")
+    .find(".x673")
+    [674]
+    .css({width: 675, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v677)
+    .eq(678).parent()
+    .each((i, el) => el.id + 679)
+    .data[k680]
+    .then(r => r.v681)
+    .html(`<b>${x682}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c684")
+    .find(".x685")
+    [686]
+    .css({width: 687, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v689)
+    .eq(690).parent()
+    .each((i, el) => el.id + 691)
+    .data[k692]
+    .then(r => r.v693)
+    .html(`<b>${x694}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c696")
+    .find(".x697")
+    [698]
+    .css({width: 699, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v701)
+    .eq(702).parent()
+    .each((i, el) => el.id + 703)
+    .data[k704]
+    .then(r => r.v705)
+    .html(`<b>${x706}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c708")
+    .find(".x709")
+    [710]
+    .css({width: 711, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v713)
+    .eq(714).parent()
+    .each((i, el) => el.id + 715)
+    .data[k716]
+    .then(r => r.v717)
+    .html(`<b>${x718}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c720")
+    .find(".x721")
+    [722]
+    .css({width: 723, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v725)
+    .eq(726).parent()
+    .each((i, el) => el.id + 727)
+    .data[k728]
+    .then(r => r.v729)
+    .html(`<b>${x730}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c732")
+    .find(".x733")
+    [734]
+    .css({width: 735, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v737)
+    .eq(738).parent()
+    .each((i, el) => el.id + 739)
+    .data[k740]
+    .then(r => r.v741)
+    .html(`<b>${x742}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c744")
+    .find(".x745")
+    [746]
+    .css({width: 747, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v749)
+    .eq(750).parent()
+    .each((i, el) => el.id + 751)
+    .data[k752]
+    .then(r => r.v753)
+    .html(`<b>${x754}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c756")
+    .find(".x757")
+    [758]
+    .css({width: 759, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v761)
+    .eq(762).parent()
+    .each((i, el) => el.id + 763)
+    .data[k764]
+    .then(r => r.v765)
+    .html(`<b>${x766}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c768")
+    .find(".x769")
+    [770]
+    .css({width: 771, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v773)
+    .eq(774).parent()
+    .each((i, el) => el.id + 775)
+    .data[k776]
+    .then(r => r.v777)
+    .html(`<b>${x778}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c780")
+    .find(".x781")
+    [782]
+    .css({width: 783, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v785)
+    .eq(786).parent()
+    .each((i, el) => el.id + 787)
+    .data[k788]
+    .then(r => r.v789)
+    .html(`<b>${x790}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c792")
+    .find(".x793")
+    [794]
+    .css({width: 795, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v797)
+    .eq(798).parent()
+    .each((i, el) => el.id + 799)
+    .data[k800]
+    .then(r => r.v801)
+    .html(`<b>${x802}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c804")
+    .find(".x805")
+    [806]
+    .css({width: 807, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v809)
+    .eq(810).parent()
+    .each((i, el) => el.id + 811)
+    .data[k812]
+    .then(r => r.v813)
+    .html(`<b>${x814}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c816")
+    .find(".x817")
+    [818]
+    .css({width: 819, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v821)
+    .eq(822).parent()
+    .each((i, el) => el.id + 823)
+    .data[k824]
+    .then(r => r.v825)
+    .html(`<b>${x826}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c828")
+    .find(".x829")
+    [830]
+    .css({width: 831, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v833)
+    .eq(834).parent()
+    .each((i, el) => el.id + 835)
+    .data[k836]
+    .then(r => r.v837)
+    .html(`<b>${x838}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c840")
+    .find(".x841")
+    [842]
+    .css({width: 843, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v845)
+    .eq(846).parent()
+    .each((i, el) => el.id + 847)
+    .data[k848]
+    .then(r => r.v849)
+    .html(`<b>${x850}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c852")
+    .find(".x853")
+    [854]
+    .css({width: 855, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v857)
+    .eq(858).parent()
+    .each((i, el) => el.id + 859)
+    .data[k860]
+    .then(r => r.v861)
+    .html(`<b>${x862}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c864")
+    .find(".x865")
+    [866]
+    .css({width: 867, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v869)
+    .eq(870).parent()
+    .each((i, el) => el.id + 871)
+    .data[k872]
+    .then(r => r.v873)
+    .html(`<b>${x874}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c876")
+    .find(".x877")
+    [878]
+    .css({width: 879, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v881)
+    .eq(882).parent()
+    .each((i, el) => el.id + 883)
+    .data[k884]
+    .then(r => r.v885)
+    .html(`<b>${x886}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c888")
+    .find(".x889")
+    [890]
+    .css({width: 891, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v893)
+    .eq(894).parent()
+    .each((i, el) => el.id + 895)
+    .data[k896]
+    .then(r => r.v897)
+    .html(`<b>${x898}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c900")
+    .find(".x901")
+    [902]
+    .css({width: 903, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v905)
+    .eq(906).parent()
+    .each((i, el) => el.id + 907)
+    .data[k908]
+    .then(r => r.v909)
+    .html(`<b>${x910}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c912")
+    .find(".x913")
+    [914]
+    .css({width: 915, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v917)
+    .eq(918).parent()
+    .each((i, el) => el.id + 919)
+    .data[k920]
+    .then(r => r.v921)
+    .html(`<b>${x922}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c924")
+    .find(".x925")
+    [926]
+    .css({width: 927, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v929)
+    .eq(930).parent()
+    .each((i, el) => el.id + 931)
+    .data[k932]
+    .then(r => r.v933)
+    .html(`<b>${x934}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c936")
+    .find(".x937")
+    [938]
+    .css({width: 939, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v941)
+    .eq(942).parent()
+    .each((i, el) => el.id + 943)
+    .data[k944]
+    .then(r => r.v945)
+    .html(`<b>${x946}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c948")
+    .find(".x949")
+    [950]
+    .css({width: 951, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v953)
+    .eq(954).parent()
+    .each((i, el) => el.id + 955)
+    .data[k956]
+    .then(r => r.v957)
+    .html(`<b>${x958}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c960")
+    .find(".x961")
+    [962]
+    .css({width: 963, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v965)
+    .eq(966).parent()
+    .each((i, el) => el.id + 967)
+    .data[k968]
+    .then(r => r.v969)
+    .html(`<b>${x970}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c972")
+    .find(".x973")
+    [974]
+    .css({width: 975, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v977)
+    .eq(978).parent()
+    .each((i, el) => el.id + 979)
+    .data[k980]
+    .then(r => r.v981)
+    .html(`<b>${x982}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c984")
+    .find(".x985")
+    [986]
+    .css({width: 987, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v989)
+    .eq(990).parent()
+    .each((i, el) => el.id + 991)
+    .data[k992]
+    .then(r => r.v993)
+    .html(`<b>${x994}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c996")
+    .find(".x997")
+    [998]
+    .css({width: 999, height: 2});
@@ -0,0 +1,10001 @@
+$("#root")
+    .addClass("c0")
+    .find(".x1")
+    [2]
+    .css({width: 3, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5)
+    .eq(6).parent()
+    .each((i, el) => el.id + 7)
+    .data[k8]
+    .then(r => r.v9)
+    .html(`<b>${x10}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c12")
+    .find(".x13")
+    [14]
+    .css({width: 15, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v17)
+    .eq(18).parent()
+    .each((i, el) => el.id + 19)
+    .data[k20]
+    .then(r => r.v21)
+    .html(`<b>${x22}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c24")
+    .find(".x25")
+    [26]
+    .css({width: 27, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v29)
+    .eq(30).parent()
+    .each((i, el) => el.id + 31)
+    .data[k32]
+    .then(r => r.v33)
+    .html(`<b>${x34}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c36")
+    .find(".x37")
+    [38]
+    .css({width: 39, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v41)
+    .eq(42).parent()
+    .each((i, el) => el.id + 43)
+    .data[k44]
+    .then(r => r.v45)
+    .html(`<b>${x46}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c48")
+    .find(".x49")
+    [50]
+    .css({width: 51, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v53)
+    .eq(54).parent()
+    .each((i, el) => el.id + 55)
+    .data[k56]
+    .then(r => r.v57)
+    .html(`<b>${x58}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c60")
+    .find(".x61")
+    [62]
+    .css({width: 63, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v65)
+    .eq(66).parent()
+    .each((i, el) => el.id + 67)
+    .data[k68]
+    .then(r => r.v69)
+    .html(`<b>${x70}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c72")
+    .find(".x73")
+    [74]
+    .css({width: 75, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v77)
+    .eq(78).parent()
+    .each((i, el) => el.id + 79)
+    .data[k80]
+    .then(r => r.v81)
+    .html(`<b>${x82}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c84")
+    .find(".x85")
+    [86]
+    .css({width: 87, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v89)
+    .eq(90).parent()
+    .each((i, el) => el.id + 91)
+    .data[k92]
+    .then(r => r.v93)
+    .html(`<b>${x94}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c96")
+    .find(".x97")
+    [98]
+    .css({width: 99, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v101)
+    .eq(102).parent()
+    .each((i, el) => el.id + 103)
+    .data[k104]
+    .then(r => r.v105)
+    .html(`<b>${x106}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c108")
+    .find(".x109")
+    [110]
+    .css({width: 111, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v113)
+    .eq(114).parent()
+    .each((i, el) => el.id + 115)
+    .data[k116]
+    .then(r => r.v117)
+    .html(`<b>${x118}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c120")
+    .find(".x121")
+    [122]
+    .css({width: 123, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v125)
+    .eq(126).parent()
+    .each((i, el) => el.id + 127)
+    .data[k128]
+    .then(r => r.v129)
+    .html(`<b>${x130}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c132")
+    .find(".x133")
+    [134]
+    .css({width: 135, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v137)
+    .eq(138).parent()
+    .each((i, el) => el.id + 139)
+    .data[k140]
+    .then(r => r.v141)
+    .html(`<b>${x142}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c144")
+    .find(".x145")
+    [146]
+    .css({width: 147, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v149)
+    .eq(150).parent()
+    .each((i, el) => el.id + 151)
+    .data[k152]
+    .then(r => r.v153)
+    .html(`<b>${x154}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c156")
+    .find(".x157")
+    [158]
+    .css({width: 159, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v161)
+    .eq(162).parent()
+    .each((i, el) => el.id + 163)
+    .data[k164]
+    .then(r => r.v165)
+    .html(`<b>${x166}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c168")
+    .find(".x169")
+    [170]
+    .css({width: 171, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v173)
+    .eq(174).parent()
+    .each((i, el) => el.id + 175)
+    .data[k176]
+    .then(r => r.v177)
+    .html(`<b>${x178}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c180")
+    .find(".x181")
+    [182]
+    .css({width: 183, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v185)
+    .eq(186).parent()
+    .each((i, el) => el.id + 187)
+    .data[k188]
+    .then(r => r.v189)
+    .html(`<b>${x190}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c192")
+    .find(".x193")
+    [194]
+    .css({width: 195, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v197)
+    .eq(198).parent()
+    .each((i, el) => el.id + 199)
+    .data[k200]
+    .then(r => r.v201)
+    .html(`<b>${x202}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c204")
+    .find(".x205")
+    [206]
+    .css({width: 207, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v209)
+    .eq(210).parent()
+    .each((i, el) => el.id + 211)
+    .data[k212]
+    .then(r => r.v213)
+    .html(`<b>${x214}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c216")
+    .find(".x217")
+    [218]
+    .css({width: 219, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v221)
+    .eq(222).parent()
+    .each((i, el) => el.id + 223)
+    .data[k224]
+    .then(r => r.v225)
+    .html(`<b>${x226}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c228")
+    .find(".x229")
+    [230]
+    .css({width: 231, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v233)
+    .eq(234).parent()
+    .each((i, el) => el.id + 235)
+    .data[k236]
+    .then(r => r.v237)
+    .html(`<b>${x238}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c240")
+    .find(".x241")
+    [242]
+    .css({width: 243, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v245)
+    .eq(246).parent()
+    .each((i, el) => el.id + 247)
+    .data[k248]
+    .then(r => r.v249)
+    .html(`<b>${x250}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c252")
+    .find(".x253")
+    [254]
+    .css({width: 255, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v257)
+    .eq(258).parent()
+    .each((i, el) => el.id + 259)
+    .data[k260]
+    .then(r => r.v261)
+    .html(`<b>${x262}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c264")
+    .find(".x265")
+    [266]
+    .css({width: 267, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v269)
+    .eq(270).parent()
+    .each((i, el) => el.id + 271)
+    .data[k272]
+    .then(r => r.v273)
+    .html(`<b>${x274}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c276")
+    .find(".x277")
+    [278]
+    .css({width: 279, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v281)
+    .eq(282).parent()
+    .each((i, el) => el.id + 283)
+    .data[k284]
+    .then(r => r.v285)
+    .html(`<b>${x286}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c288")
+    .find(".x289")
+    [290]
+    .css({width: 291, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v293)
+    .eq(294).parent()
+    .each((i, el) => el.id + 295)
+    .data[k296]
+    .then(r => r.v297)
+    .html(`<b>${x298}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c300")
+    .find(".x301")
+    [302]
+    .css({width: 303, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v305)
+    .eq(306).parent()
+    .each((i, el) => el.id + 307)
+    .data[k308]
+    .then(r => r.v309)
+    .html(`<b>${x310}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c312")
+    .find(".x313")
+    [314]
+    .css({width: 315, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v317)
+    .eq(318).parent()
+    .each((i, el) => el.id + 319)
+    .data[k320]
+    .then(r => r.v321)
+    .html(`<b>${x322}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c324")
+    .find(".x325")
+    [326]
+    .css({width: 327, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v329)
+    .eq(330).parent()
+    .each((i, el) => el.id + 331)
+    .data[k332]
+    .then(r => r.v333)
+    .html(`<b>${x334}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c336")
+    .find(".x337")
+    [338]
+    .css({width: 339, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v341)
+    .eq(342).parent()
+    .each((i, el) => el.id + 343)
+    .data[k344]
+    .then(r => r.v345)
+    .html(`<b>${x346}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c348")
+    .find(".x349")
+    [350]
+    .css({width: 351, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v353)
+    .eq(354).parent()
+    .each((i, el) => el.id + 355)
+    .data[k356]
+    .then(r => r.v357)
+    .html(`<b>${x358}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c360")
+    .find(".x361")
+    [362]
+    .css({width: 363, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v365)
+    .eq(366).parent()
+    .each((i, el) => el.id + 367)
+    .data[k368]
+    .then(r => r.v369)
+    .html(`<b>${x370}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c372")
+    .find(".x373")
+    [374]
+    .css({width: 375, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v377)
+    .eq(378).parent()
+    .each((i, el) => el.id + 379)
+    .data[k380]
+    .then(r => r.v381)
+    .html(`<b>${x382}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c384")
+    .find(".x385")
+    [386]
+    .css({width: 387, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v389)
+    .eq(390).parent()
+    .each((i, el) => el.id + 391)
+    .data[k392]
+    .then(r => r.v393)
+    .html(`<b>${x394}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c396")
+    .find(".x397")
+    [398]
+    .css({width: 399, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v401)
+    .eq(402).parent()
+    .each((i, el) => el.id + 403)
+    .data[k404]
+    .then(r => r.v405)
+    .html(`<b>${x406}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c408")
+    .find(".x409")
+    [410]
+    .css({width: 411, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v413)
+    .eq(414).parent()
+    .each((i, el) => el.id + 415)
+    .data[k416]
+    .then(r => r.v417)
+    .html(`<b>${x418}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c420")
+    .find(".x421")
+    [422]
+    .css({width: 423, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v425)
+    .eq(426).parent()
+    .each((i, el) => el.id + 427)
+    .data[k428]
+    .then(r => r.v429)
+    .html(`<b>${x430}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c432")
+    .find(".x433")
+    [434]
+    .css({width: 435, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v437)
+    .eq(438).parent()
+    .each((i, el) => el.id + 439)
+    .data[k440]
+    .then(r => r.v441)
+    .html(`<b>${x442}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c444")
+    .find(".x445")
+    [446]
+    .css({width: 447, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v449)
+    .eq(450).parent()
+    .each((i, el) => el.id + 451)
+    .data[k452]
+    .then(r => r.v453)
+    .html(`<b>${x454}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c456")
+    .find(".x457")
+    [458]
+    .css({width: 459, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v461)
+    .eq(462).parent()
+    .each((i, el) => el.id + 463)
+    .data[k464]
+    .then(r => r.v465)
+    .html(`<b>${x466}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c468")
+    .find(".x469")
+    [470]
+    .css({width: 471, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v473)
+    .eq(474).parent()
+    .each((i, el) => el.id + 475)
+    .data[k476]
+    .then(r => r.v477)
+    .html(`<b>${x478}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c480")
+    .find(".x481")
+    [482]
+    .css({width: 483, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v485)
+    .eq(486).parent()
+    .each((i, el) => el.id + 487)
+    .data[k488]
+    .then(r => r.v489)
+    .html(`<b>${x490}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c492")
+    .find(".x493")
+    [494]
+    .css({width: 495, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v497)
+    .eq(498).parent()
+    .each((i, el) => el.id + 499)
+    .data[k500]
+    .then(r => r.v501)
+    .html(`<b>${x502}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c504")
+    .find(".x505")
+    [506]
+    .css({width: 507, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v509)
+    .eq(510).parent()
+    .each((i, el) => el.id + 511)
+    .data[k512]
+    .then(r => r.v513)
+    .html(`<b>${x514}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c516")
+    .find(".x517")
+    [518]
+    .css({width: 519, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v521)
+    .eq(522).parent()
+    .each((i, el) => el.id + 523)
+    .data[k524]
+    .then(r => r.v525)
+    .html(`<b>${x526}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c528")
+    .find(".x529")
+    [530]
+    .css({width: 531, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v533)
+    .eq(534).parent()
+    .each((i, el) => el.id + 535)
+    .data[k536]
+    .then(r => r.v537)
+    .html(`<b>${x538}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c540")
+    .find(".x541")
+    [542]
+    .css({width: 543, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v545)
+    .eq(546).parent()
+    .each((i, el) => el.id + 547)
+    .data[k548]
+    .then(r => r.v549)
+    .html(`<b>${x550}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c552")
+    .find(".x553")
+    [554]
+    .css({width: 555, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v557)
+    .eq(558).parent()
+    .each((i, el) => el.id + 559)
+    .data[k560]
+    .then(r => r.v561)
+    .html(`<b>${x562}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c564")
+    .find(".x565")
+    [566]
+    .css({width: 567, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v569)
+    .eq(570).parent()
+    .each((i, el) => el.id + 571)
+    .data[k572]
+    .then(r => r.v573)
+    .html(`<b>${x574}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c576")
+    .find(".x577")
+    [578]
+    .css({width: 579, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v581)
+    .eq(582).parent()
+    .each((i, el) => el.id + 583)
+    .data[k584]
+    .then(r => r.v585)
+    .html(`<b>${x586}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c588")
+    .find(".x589")
+    [590]
+    .css({width: 591, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v593)
+    .eq(594).parent()
+    .each((i, el) => el.id + 595)
+    .data[k596]
+    .then(r => r.v597)
+    .html(`<b>${x598}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c600")
+    .find(".x601")
+    [602]
+    .css({width: 603, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v605)
+    .eq(606).parent()
+    .each((i, el) => el.id + 607)
+    .data[k608]
+    .then(r => r.v609)
+    .html(`<b>${x610}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c612")
+    .find(".x613")
+    [614]
+    .css({width: 615, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v617)
+    .eq(618).parent()
+    .each((i, el) => el.id + 619)
+    .data[k620]
+    .then(r => r.v621)
+    .html(`<b>${x622}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c624")
+    .find(".x625")
+    [626]
+    .css({width: 627, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v629)
+    .eq(630).parent()
+    .each((i, el) => el.id + 631)
+    .data[k632]
+    .then(r => r.v633)
+    .html(`<b>${x634}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c636")
+    .find(".x637")
+    [638]
+    .css({width: 639, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v641)
+    .eq(642).parent()
+    .each((i, el) => el.id + 643)
+    .data[k644]
+    .then(r => r.v645)
+    .html(`<b>${x646}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c648")
+    .find(".x649")
+    [650]
+    .css({width: 651, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v653)
+    .eq(654).parent()
+    .each((i, el) => el.id + 655)
+    .data[k656]
+    .then(r => r.v657)
+    .html(`<b>${x658}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c660")
+    .find(".x661")
+    [662]
+    .css({width: 663, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v665)
+    .eq(666).parent()
+    .each((i, el) => el.id + 667)
+    .data[k668]
+    .then(r => r.v669)
+    .html(`<b>${x670}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c672")
+    .find(".x673")
+    [674]
+    .css({width: 675, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v677)
+    .eq(678).parent()
+    .each((i, el) => el.id + 679)
+    .data[k680]
+    .then(r => r.v681)
+    .html(`<b>${x682}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c684")
+    .find(".x685")
+    [686]
+    .css({width: 687, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v689)
+    .eq(690).parent()
+    .each((i, el) => el.id + 691)
+    .data[k692]
+    .then(r => r.v693)
+    .html(`<b>${x694}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c696")
+    .find(".x697")
+    [698]
+    .css({width: 699, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v701)
+    .eq(702).parent()
+    .each((i, el) => el.id + 703)
+    .data[k704]
+    .then(r => r.v705)
+    .html(`<b>${x706}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c708")
+    .find(".x709")
+    [710]
+    .css({width: 711, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v713)
+    .eq(714).parent()
+    .each((i, el) => el.id + 715)
+    .data[k716]
+    .then(r => r.v717)
+    .html(`<b>${x718}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c720")
+    .find(".x721")
+    [722]
+    .css({width: 723, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v725)
+    .eq(726).parent()
+    .each((i, el) => el.id + 727)
+    .data[k728]
+    .then(r => r.v729)
+    .html(`<b>${x730}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c732")
+    .find(".x733")
+    [734]
+    .css({width: 735, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v737)
+    .eq(738).parent()
+    .each((i, el) => el.id + 739)
+    .data[k740]
+    .then(r => r.v741)
+    .html(`<b>${x742}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c744")
+    .find(".x745")
+    [746]
+    .css({width: 747, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v749)
+    .eq(750).parent()
+    .each((i, el) => el.id + 751)
+    .data[k752]
+    .then(r => r.v753)
+    .html(`<b>${x754}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c756")
+    .find(".x757")
+    [758]
+    .css({width: 759, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v761)
+    .eq(762).parent()
+    .each((i, el) => el.id + 763)
+    .data[k764]
+    .then(r => r.v765)
+    .html(`<b>${x766}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c768")
+    .find(".x769")
+    [770]
+    .css({width: 771, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v773)
+    .eq(774).parent()
+    .each((i, el) => el.id + 775)
+    .data[k776]
+    .then(r => r.v777)
+    .html(`<b>${x778}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c780")
+    .find(".x781")
+    [782]
+    .css({width: 783, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v785)
+    .eq(786).parent()
+    .each((i, el) => el.id + 787)
+    .data[k788]
+    .then(r => r.v789)
+    .html(`<b>${x790}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c792")
+    .find(".x793")
+    [794]
+    .css({width: 795, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v797)
+    .eq(798).parent()
+    .each((i, el) => el.id + 799)
+    .data[k800]
+    .then(r => r.v801)
+    .html(`<b>${x802}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c804")
+    .find(".x805")
+    [806]
+    .css({width: 807, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v809)
+    .eq(810).parent()
+    .each((i, el) => el.id + 811)
+    .data[k812]
+    .then(r => r.v813)
+    .html(`<b>${x814}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c816")
+    .find(".x817")
+    [818]
+    .css({width: 819, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v821)
+    .eq(822).parent()
+    .each((i, el) => el.id + 823)
+    .data[k824]
+    .then(r => r.v825)
+    .html(`<b>${x826}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c828")
+    .find(".x829")
+    [830]
+    .css({width: 831, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v833)
+    .eq(834).parent()
+    .each((i, el) => el.id + 835)
+    .data[k836]
+    .then(r => r.v837)
+    .html(`<b>${x838}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c840")
+    .find(".x841")
+    [842]
+    .css({width: 843, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v845)
+    .eq(846).parent()
+    .each((i, el) => el.id + 847)
+    .data[k848]
+    .then(r => r.v849)
+    .html(`<b>${x850}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c852")
+    .find(".x853")
+    [854]
+    .css({width: 855, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v857)
+    .eq(858).parent()
+    .each((i, el) => el.id + 859)
+    .data[k860]
+    .then(r => r.v861)
+    .html(`<b>${x862}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c864")
+    .find(".x865")
+    [866]
+    .css({width: 867, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v869)
+    .eq(870).parent()
+    .each((i, el) => el.id + 871)
+    .data[k872]
+    .then(r => r.v873)
+    .html(`<b>${x874}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c876")
+    .find(".x877")
+    [878]
+    .css({width: 879, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v881)
+    .eq(882).parent()
+    .each((i, el) => el.id + 883)
+    .data[k884]
+    .then(r => r.v885)
+    .html(`<b>${x886}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c888")
+    .find(".x889")
+    [890]
+    .css({width: 891, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v893)
+    .eq(894).parent()
+    .each((i, el) => el.id + 895)
+    .data[k896]
+    .then(r => r.v897)
+    .html(`<b>${x898}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c900")
+    .find(".x901")
+    [902]
+    .css({width: 903, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v905)
+    .eq(906).parent()
+    .each((i, el) => el.id + 907)
+    .data[k908]
+    .then(r => r.v909)
+    .html(`<b>${x910}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c912")
+    .find(".x913")
+    [914]
+    .css({width: 915, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v917)
+    .eq(918).parent()
+    .each((i, el) => el.id + 919)
+    .data[k920]
+    .then(r => r.v921)
+    .html(`<b>${x922}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c924")
+    .find(".x925")
+    [926]
+    .css({width: 927, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v929)
+    .eq(930).parent()
+    .each((i, el) => el.id + 931)
+    .data[k932]
+    .then(r => r.v933)
+    .html(`<b>${x934}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c936")
+    .find(".x937")
+    [938]
+    .css({width: 939, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v941)
+    .eq(942).parent()
+    .each((i, el) => el.id + 943)
+    .data[k944]
+    .then(r => r.v945)
+    .html(`<b>${x946}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c948")
+    .find(".x949")
+    [950]
+    .css({width: 951, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v953)
+    .eq(954).parent()
+    .each((i, el) => el.id + 955)
+    .data[k956]
+    .then(r => r.v957)
+    .html(`<b>${x958}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c960")
+    .find(".x961")
+    [962]
+    .css({width: 963, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v965)
+    .eq(966).parent()
+    .each((i, el) => el.id + 967)
+    .data[k968]
+    .then(r => r.v969)
+    .html(`<b>${x970}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c972")
+    .find(".x973")
+    [974]
+    .css({width: 975, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v977)
+    .eq(978).parent()
+    .each((i, el) => el.id + 979)
+    .data[k980]
+    .then(r => r.v981)
+    .html(`<b>${x982}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c984")
+    .find(".x985")
+    [986]
+    .css({width: 987, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v989)
+    .eq(990).parent()
+    .each((i, el) => el.id + 991)
+    .data[k992]
+    .then(r => r.v993)
+    .html(`<b>${x994}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c996")
+    .find(".x997")
+    [998]
+    .css({width: 999, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1001)
+    .eq(1002).parent()
+    .each((i, el) => el.id + 1003)
+    .data[k1004]
+    .then(r => r.v1005)
+    .html(`<b>${x1006}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1008")
+    .find(".x1009")
+    [1010]
+    .css({width: 1011, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1013)
+    .eq(1014).parent()
+    .each((i, el) => el.id + 1015)
+    .data[k1016]
+    .then(r => r.v1017)
+    .html(`<b>${x1018}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1020")
+    .find(".x1021")
+    [1022]
+    .css({width: 1023, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1025)
+    .eq(1026).parent()
+    .each((i, el) => el.id + 1027)
+    .data[k1028]
+    .then(r => r.v1029)
+    .html(`<b>${x1030}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1032")
+    .find(".x1033")
+    [1034]
+    .css({width: 1035, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1037)
+    .eq(1038).parent()
+    .each((i, el) => el.id + 1039)
+    .data[k1040]
+    .then(r => r.v1041)
+    .html(`<b>${x1042}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1044")
+    .find(".x1045")
+    [1046]
+    .css({width: 1047, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1049)
+    .eq(1050).parent()
+    .each((i, el) => el.id + 1051)
+    .data[k1052]
+    .then(r => r.v1053)
+    .html(`<b>${x1054}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1056")
+    .find(".x1057")
+    [1058]
+    .css({width: 1059, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1061)
+    .eq(1062).parent()
+    .each((i, el) => el.id + 1063)
+    .data[k1064]
+    .then(r => r.v1065)
+    .html(`<b>${x1066}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1068")
+    .find(".x1069")
+    [1070]
+    .css({width: 1071, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1073)
+    .eq(1074).parent()
+    .each((i, el) => el.id + 1075)
+    .data[k1076]
+    .then(r => r.v1077)
+    .html(`<b>${x1078}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1080")
+    .find(".x1081")
+    [1082]
+    .css({width: 1083, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1085)
+    .eq(1086).parent()
+    .each((i, el) => el.id + 1087)
+    .data[k1088]
+    .then(r => r.v1089)
+    .html(`<b>${x1090}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1092")
+    .find(".x1093")
+    [1094]
+    .css({width: 1095, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1097)
+    .eq(1098).parent()
+    .each((i, el) => el.id + 1099)
+    .data[k1100]
+    .then(r => r.v1101)
+    .html(`<b>${x1102}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1104")
+    .find(".x1105")
+    [1106]
+    .css({width: 1107, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1109)
+    .eq(1110).parent()
+    .each((i, el) => el.id + 1111)
+    .data[k1112]
+    .then(r => r.v1113)
+    .html(`<b>${x1114}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1116")
+    .find(".x1117")
+    [1118]
+    .css({width: 1119, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1121)
+    .eq(1122).parent()
+    .each((i, el) => el.id + 1123)
+    .data[k1124]
+    .then(r => r.v1125)
+    .html(`<b>${x1126}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1128")
+    .find(".x1129")
+    [1130]
+    .css({width: 1131, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1133)
+    .eq(1134).parent()
+    .each((i, el) => el.id + 1135)
+    .data[k1136]
+    .then(r => r.v1137)
+    .html(`<b>${x1138}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1140")
+    .find(".x1141")
+    [1142]
+    .css({width: 1143, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1145)
+    .eq(1146).parent()
+    .each((i, el) => el.id + 1147)
+    .data[k1148]
+    .then(r => r.v1149)
+    .html(`<b>${x1150}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1152")
+    .find(".x1153")
+    [1154]
+    .css({width: 1155, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1157)
+    .eq(1158).parent()
+    .each((i, el) => el.id + 1159)
+    .data[k1160]
+    .then(r => r.v1161)
+    .html(`<b>${x1162}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1164")
+    .find(".x1165")
+    [1166]
+    .css({width: 1167, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1169)
+    .eq(1170).parent()
+    .each((i, el) => el.id + 1171)
+    .data[k1172]
+    .then(r => r.v1173)
+    .html(`<b>${x1174}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1176")
+    .find(".x1177")
+    [1178]
+    .css({width: 1179, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1181)
+    .eq(1182).parent()
+    .each((i, el) => el.id + 1183)
+    .data[k1184]
+    .then(r => r.v1185)
+    .html(`<b>${x1186}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1188")
+    .find(".x1189")
+    [1190]
+    .css({width: 1191, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1193)
+    .eq(1194).parent()
+    .each((i, el) => el.id + 1195)
+    .data[k1196]
+    .then(r => r.v1197)
+    .html(`<b>${x1198}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1200")
+    .find(".x1201")
+    [1202]
+    .css({width: 1203, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1205)
+    .eq(1206).parent()
+    .each((i, el) => el.id + 1207)
+    .data[k1208]
+    .then(r => r.v1209)
+    .html(`<b>${x1210}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1212")
+    .find(".x1213")
+    [1214]
+    .css({width: 1215, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1217)
+    .eq(1218).parent()
+    .each((i, el) => el.id + 1219)
+    .data[k1220]
+    .then(r => r.v1221)
+    .html(`<b>${x1222}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1224")
+    .find(".x1225")
+    [1226]
+    .css({width: 1227, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1229)
+    .eq(1230).parent()
+    .each((i, el) => el.id + 1231)
+    .data[k1232]
+    .then(r => r.v1233)
+    .html(`<b>${x1234}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1236")
+    .find(".x1237")
+    [1238]
+    .css({width: 1239, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1241)
+    .eq(1242).parent()
+    .each((i, el) => el.id + 1243)
+    .data[k1244]
+    .then(r => r.v1245)
+    .html(`<b>${x1246}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1248")
+    .find(".x1249")
+    [1250]
+    .css({width: 1251, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1253)
+    .eq(1254).parent()
+    .each((i, el) => el.id + 1255)
+    .data[k1256]
+    .then(r => r.v1257)
+    .html(`<b>${x1258}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1260")
+    .find(".x1261")
+    [1262]
+    .css({width: 1263, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1265)
+    .eq(1266).parent()
+    .each((i, el) => el.id + 1267)
+    .data[k1268]
+    .then(r => r.v1269)
+    .html(`<b>${x1270}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1272")
+    .find(".x1273")
+    [1274]
+    .css({width: 1275, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1277)
+    .eq(1278).parent()
+    .each((i, el) => el.id + 1279)
+    .data[k1280]
+    .then(r => r.v1281)
+    .html(`<b>${x1282}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1284")
+    .find(".x1285")
+    [1286]
+    .css({width: 1287, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1289)
+    .eq(1290).parent()
+    .each((i, el) => el.id + 1291)
+    .data[k1292]
+    .then(r => r.v1293)
+    .html(`<b>${x1294}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1296")
+    .find(".x1297")
+    [1298]
+    .css({width: 1299, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1301)
+    .eq(1302).parent()
+    .each((i, el) => el.id + 1303)
+    .data[k1304]
+    .then(r => r.v1305)
+    .html(`<b>${x1306}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1308")
+    .find(".x1309")
+    [1310]
+    .css({width: 1311, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1313)
+    .eq(1314).parent()
+    .each((i, el) => el.id + 1315)
+    .data[k1316]
+    .then(r => r.v1317)
+    .html(`<b>${x1318}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1320")
+    .find(".x1321")
+    [1322]
+    .css({width: 1323, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1325)
+    .eq(1326).parent()
+    .each((i, el) => el.id + 1327)
+    .data[k1328]
+    .then(r => r.v1329)
+    .html(`<b>${x1330}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1332")
+    .find(".x1333")
+    [1334]
+    .css({width: 1335, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1337)
+    .eq(1338).parent()
+    .each((i, el) => el.id + 1339)
+    .data[k1340]
+    .then(r => r.v1341)
+    .html(`<b>${x1342}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1344")
+    .find(".x1345")
+    [1346]
+    .css({width: 1347, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1349)
+    .eq(1350).parent()
+    .each((i, el) => el.id + 1351)
+    .data[k1352]
+    .then(r => r.v1353)
+    .html(`<b>${x1354}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1356")
+    .find(".x1357")
+    [1358]
+    .css({width: 1359, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1361)
+    .eq(1362).parent()
+    .each((i, el) => el.id + 1363)
+    .data[k1364]
+    .then(r => r.v1365)
+    .html(`<b>${x1366}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1368")
+    .find(".x1369")
+    [1370]
+    .css({width: 1371, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1373)
+    .eq(1374).parent()
+    .each((i, el) => el.id + 1375)
+    .data[k1376]
+    .then(r => r.v1377)
+    .html(`<b>${x1378}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1380")
+    .find(".x1381")
+    [1382]
+    .css({width: 1383, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1385)
+    .eq(1386).parent()
+    .each((i, el) => el.id + 1387)
+    .data[k1388]
+    .then(r => r.v1389)
+    .html(`<b>${x1390}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1392")
+    .find(".x1393")
+    [1394]
+    .css({width: 1395, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1397)
+    .eq(1398).parent()
+    .each((i, el) => el.id + 1399)
+    .data[k1400]
+    .then(r => r.v1401)
+    .html(`<b>${x1402}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1404")
+    .find(".x1405")
+    [1406]
+    .css({width: 1407, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1409)
+    .eq(1410).parent()
+    .each((i, el) => el.id + 1411)
+    .data[k1412]
+    .then(r => r.v1413)
+    .html(`<b>${x1414}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1416")
+    .find(".x1417")
+    [1418]
+    .css({width: 1419, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1421)
+    .eq(1422).parent()
+    .each((i, el) => el.id + 1423)
+    .data[k1424]
+    .then(r => r.v1425)
+    .html(`<b>${x1426}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1428")
+    .find(".x1429")
+    [1430]
+    .css({width: 1431, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1433)
+    .eq(1434).parent()
+    .each((i, el) => el.id + 1435)
+    .data[k1436]
+    .then(r => r.v1437)
+    .html(`<b>${x1438}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1440")
+    .find(".x1441")
+    [1442]
+    .css({width: 1443, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1445)
+    .eq(1446).parent()
+    .each((i, el) => el.id + 1447)
+    .data[k1448]
+    .then(r => r.v1449)
+    .html(`<b>${x1450}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1452")
+    .find(".x1453")
+    [1454]
+    .css({width: 1455, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1457)
+    .eq(1458).parent()
+    .each((i, el) => el.id + 1459)
+    .data[k1460]
+    .then(r => r.v1461)
+    .html(`<b>${x1462}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1464")
+    .find(".x1465")
+    [1466]
+    .css({width: 1467, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1469)
+    .eq(1470).parent()
+    .each((i, el) => el.id + 1471)
+    .data[k1472]
+    .then(r => r.v1473)
+    .html(`<b>${x1474}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1476")
+    .find(".x1477")
+    [1478]
+    .css({width: 1479, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1481)
+    .eq(1482).parent()
+    .each((i, el) => el.id + 1483)
+    .data[k1484]
+    .then(r => r.v1485)
+    .html(`<b>${x1486}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1488")
+    .find(".x1489")
+    [1490]
+    .css({width: 1491, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1493)
+    .eq(1494).parent()
+    .each((i, el) => el.id + 1495)
+    .data[k1496]
+    .then(r => r.v1497)
+    .html(`<b>${x1498}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1500")
+    .find(".x1501")
+    [1502]
+    .css({width: 1503, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1505)
+    .eq(1506).parent()
+    .each((i, el) => el.id + 1507)
+    .data[k1508]
+    .then(r => r.v1509)
+    .html(`<b>${x1510}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1512")
+    .find(".x1513")
+    [1514]
+    .css({width: 1515, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1517)
+    .eq(1518).parent()
+    .each((i, el) => el.id + 1519)
+    .data[k1520]
+    .then(r => r.v1521)
+    .html(`<b>${x1522}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1524")
+    .find(".x1525")
+    [1526]
+    .css({width: 1527, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1529)
+    .eq(1530).parent()
+    .each((i, el) => el.id + 1531)
+    .data[k1532]
+    .then(r => r.v1533)
+    .html(`<b>${x1534}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1536")
+    .find(".x1537")
+    [1538]
+    .css({width: 1539, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1541)
+    .eq(1542).parent()
+    .each((i, el) => el.id + 1543)
+    .data[k1544]
+    .then(r => r.v1545)
+    .html(`<b>${x1546}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1548")
+    .find(".x1549")
+    [1550]
+    .css({width: 1551, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1553)
+    .eq(1554).parent()
+    .each((i, el) => el.id + 1555)
+    .data[k1556]
+    .then(r => r.v1557)
+    .html(`<b>${x1558}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1560")
+    .find(".x1561")
+    [1562]
+    .css({width: 1563, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1565)
+    .eq(1566).parent()
+    .each((i, el) => el.id + 1567)
+    .data[k1568]
+    .then(r => r.v1569)
+    .html(`<b>${x1570}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1572")
+    .find(".x1573")
+    [1574]
+    .css({width: 1575, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1577)
+    .eq(1578).parent()
+    .each((i, el) => el.id + 1579)
+    .data[k1580]
+    .then(r => r.v1581)
+    .html(`<b>${x1582}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1584")
+    .find(".x1585")
+    [1586]
+    .css({width: 1587, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1589)
+    .eq(1590).parent()
+    .each((i, el) => el.id + 1591)
+    .data[k1592]
+    .then(r => r.v1593)
+    .html(`<b>${x1594}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1596")
+    .find(".x1597")
+    [1598]
+    .css({width: 1599, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1601)
+    .eq(1602).parent()
+    .each((i, el) => el.id + 1603)
+    .data[k1604]
+    .then(r => r.v1605)
+    .html(`<b>${x1606}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1608")
+    .find(".x1609")
+    [1610]
+    .css({width: 1611, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1613)
+    .eq(1614).parent()
+    .each((i, el) => el.id + 1615)
+    .data[k1616]
+    .then(r => r.v1617)
+    .html(`<b>${x1618}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1620")
+    .find(".x1621")
+    [1622]
+    .css({width: 1623, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1625)
+    .eq(1626).parent()
+    .each((i, el) => el.id + 1627)
+    .data[k1628]
+    .then(r => r.v1629)
+    .html(`<b>${x1630}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1632")
+    .find(".x1633")
+    [1634]
+    .css({width: 1635, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1637)
+    .eq(1638).parent()
+    .each((i, el) => el.id + 1639)
+    .data[k1640]
+    .then(r => r.v1641)
+    .html(`<b>${x1642}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1644")
+    .find(".x1645")
+    [1646]
+    .css({width: 1647, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1649)
+    .eq(1650).parent()
+    .each((i, el) => el.id + 1651)
+    .data[k1652]
+    .then(r => r.v1653)
+    .html(`<b>${x1654}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1656")
+    .find(".x1657")
+    [1658]
+    .css({width: 1659, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1661)
+    .eq(1662).parent()
+    .each((i, el) => el.id + 1663)
+    .data[k1664]
+    .then(r => r.v1665)
+    .html(`<b>${x1666}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1668")
+    .find(".x1669")
+    [1670]
+    .css({width: 1671, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1673)
+    .eq(1674).parent()
+    .each((i, el) => el.id + 1675)
+    .data[k1676]
+    .then(r => r.v1677)
+    .html(`<b>${x1678}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1680")
+    .find(".x1681")
+    [1682]
+    .css({width: 1683, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1685)
+    .eq(1686).parent()
+    .each((i, el) => el.id + 1687)
+    .data[k1688]
+    .then(r => r.v1689)
+    .html(`<b>${x1690}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1692")
+    .find(".x1693")
+    [1694]
+    .css({width: 1695, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1697)
+    .eq(1698).parent()
+    .each((i, el) => el.id + 1699)
+    .data[k1700]
+    .then(r => r.v1701)
+    .html(`<b>${x1702}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1704")
+    .find(".x1705")
+    [1706]
+    .css({width: 1707, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1709)
+    .eq(1710).parent()
+    .each((i, el) => el.id + 1711)
+    .data[k1712]
+    .then(r => r.v1713)
+    .html(`<b>${x1714}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1716")
+    .find(".x1717")
+    [1718]
+    .css({width: 1719, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1721)
+    .eq(1722).parent()
+    .each((i, el) => el.id + 1723)
+    .data[k1724]
+    .then(r => r.v1725)
+    .html(`<b>${x1726}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1728")
+    .find(".x1729")
+    [1730]
+    .css({width: 1731, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1733)
+    .eq(1734).parent()
+    .each((i, el) => el.id + 1735)
+    .data[k1736]
+    .then(r => r.v1737)
+    .html(`<b>${x1738}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1740")
+    .find(".x1741")
+    [1742]
+    .css({width: 1743, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1745)
+    .eq(1746).parent()
+    .each((i, el) => el.id + 1747)
+    .data[k1748]
+    .then(r => r.v1749)
+    .html(`<b>${x1750}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1752")
+    .find(".x1753")
+    [1754]
+    .css({width: 1755, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1757)
+    .eq(1758).parent()
+    .each((i, el) => el.id + 1759)
+    .data[k1760]
+    .then(r => r.v1761)
+    .html(`<b>${x1762}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1764")
+    .find(".x1765")
+    [1766]
+    .css({width: 1767, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1769)
+    .eq(1770).parent()
+    .each((i, el) => el.id + 1771)
+    .data[k1772]
+    .then(r => r.v1773)
+    .html(`<b>${x1774}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1776")
+    .find(".x1777")
+    [1778]
+    .css({width: 1779, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1781)
+    .eq(1782).parent()
+    .each((i, el) => el.id + 1783)
+    .data[k1784]
+    .then(r => r.v1785)
+    .html(`<b>${x1786}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1788")
+    .find(".x1789")
+    [1790]
+    .css({width: 1791, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1793)
+    .eq(1794).parent()
+    .each((i, el) => el.id + 1795)
+    .data[k1796]
+    .then(r => r.v1797)
+    .html(`<b>${x1798}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1800")
+    .find(".x1801")
+    [1802]
+    .css({width: 1803, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1805)
+    .eq(1806).parent()
+    .each((i, el) => el.id + 1807)
+    .data[k1808]
+    .then(r => r.v1809)
+    .html(`<b>${x1810}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1812")
+    .find(".x1813")
+    [1814]
+    .css({width: 1815, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1817)
+    .eq(1818).parent()
+    .each((i, el) => el.id + 1819)
+    .data[k1820]
+    .then(r => r.v1821)
+    .html(`<b>${x1822}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1824")
+    .find(".x1825")
+    [1826]
+    .css({width: 1827, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1829)
+    .eq(1830).parent()
+    .each((i, el) => el.id + 1831)
+    .data[k1832]
+    .then(r => r.v1833)
+    .html(`<b>${x1834}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1836")
+    .find(".x1837")
+    [1838]
+    .css({width: 1839, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1841)
+    .eq(1842).parent()
+    .each((i, el) => el.id + 1843)
+    .data[k1844]
+    .then(r => r.v1845)
+    .html(`<b>${x1846}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1848")
+    .find(".x1849")
+    [1850]
+    .css({width: 1851, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1853)
+    .eq(1854).parent()
+    .each((i, el) => el.id + 1855)
+    .data[k1856]
+    .then(r => r.v1857)
+    .html(`<b>${x1858}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1860")
+    .find(".x1861")
+    [1862]
+    .css({width: 1863, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1865)
+    .eq(1866).parent()
+    .each((i, el) => el.id + 1867)
+    .data[k1868]
+    .then(r => r.v1869)
+    .html(`<b>${x1870}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1872")
+    .find(".x1873")
+    [1874]
+    .css({width: 1875, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1877)
+    .eq(1878).parent()
+    .each((i, el) => el.id + 1879)
+    .data[k1880]
+    .then(r => r.v1881)
+    .html(`<b>${x1882}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1884")
+    .find(".x1885")
+    [1886]
+    .css({width: 1887, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1889)
+    .eq(1890).parent()
+    .each((i, el) => el.id + 1891)
+    .data[k1892]
+    .then(r => r.v1893)
+    .html(`<b>${x1894}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1896")
+    .find(".x1897")
+    [1898]
+    .css({width: 1899, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1901)
+    .eq(1902).parent()
+    .each((i, el) => el.id + 1903)
+    .data[k1904]
+    .then(r => r.v1905)
+    .html(`<b>${x1906}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1908")
+    .find(".x1909")
+    [1910]
+    .css({width: 1911, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1913)
+    .eq(1914).parent()
+    .each((i, el) => el.id + 1915)
+    .data[k1916]
+    .then(r => r.v1917)
+    .html(`<b>${x1918}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1920")
+    .find(".x1921")
+    [1922]
+    .css({width: 1923, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1925)
+    .eq(1926).parent()
+    .each((i, el) => el.id + 1927)
+    .data[k1928]
+    .then(r => r.v1929)
+    .html(`<b>${x1930}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1932")
+    .find(".x1933")
+    [1934]
+    .css({width: 1935, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1937)
+    .eq(1938).parent()
+    .each((i, el) => el.id + 1939)
+    .data[k1940]
+    .then(r => r.v1941)
+    .html(`<b>${x1942}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1944")
+    .find(".x1945")
+    [1946]
+    .css({width: 1947, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1949)
+    .eq(1950).parent()
+    .each((i, el) => el.id + 1951)
+    .data[k1952]
+    .then(r => r.v1953)
+    .html(`<b>${x1954}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1956")
+    .find(".x1957")
+    [1958]
+    .css({width: 1959, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1961)
+    .eq(1962).parent()
+    .each((i, el) => el.id + 1963)
+    .data[k1964]
+    .then(r => r.v1965)
+    .html(`<b>${x1966}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1968")
+    .find(".x1969")
+    [1970]
+    .css({width: 1971, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1973)
+    .eq(1974).parent()
+    .each((i, el) => el.id + 1975)
+    .data[k1976]
+    .then(r => r.v1977)
+    .html(`<b>${x1978}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1980")
+    .find(".x1981")
+    [1982]
+    .css({width: 1983, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1985)
+    .eq(1986).parent()
+    .each((i, el) => el.id + 1987)
+    .data[k1988]
+    .then(r => r.v1989)
+    .html(`<b>${x1990}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c1992")
+    .find(".x1993")
+    [1994]
+    .css({width: 1995, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v1997)
+    .eq(1998).parent()
+    .each((i, el) => el.id + 1999)
+    .data[k2000]
+    .then(r => r.v2001)
+    .html(`<b>${x2002}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2004")
+    .find(".x2005")
+    [2006]
+    .css({width: 2007, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2009)
+    .eq(2010).parent()
+    .each((i, el) => el.id + 2011)
+    .data[k2012]
+    .then(r => r.v2013)
+    .html(`<b>${x2014}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2016")
+    .find(".x2017")
+    [2018]
+    .css({width: 2019, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2021)
+    .eq(2022).parent()
+    .each((i, el) => el.id + 2023)
+    .data[k2024]
+    .then(r => r.v2025)
+    .html(`<b>${x2026}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2028")
+    .find(".x2029")
+    [2030]
+    .css({width: 2031, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2033)
+    .eq(2034).parent()
+    .each((i, el) => el.id + 2035)
+    .data[k2036]
+    .then(r => r.v2037)
+    .html(`<b>${x2038}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2040")
+    .find(".x2041")
+    [2042]
+    .css({width: 2043, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2045)
+    .eq(2046).parent()
+    .each((i, el) => el.id + 2047)
+    .data[k2048]
+    .then(r => r.v2049)
+    .html(`<b>${x2050}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2052")
+    .find(".x2053")
+    [2054]
+    .css({width: 2055, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2057)
+    .eq(2058).parent()
+    .each((i, el) => el.id + 2059)
+    .data[k2060]
+    .then(r => r.v2061)
+    .html(`<b>${x2062}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2064")
+    .find(".x2065")
+    [2066]
+    .css({width: 2067, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2069)
+    .eq(2070).parent()
+    .each((i, el) => el.id + 2071)
+    .data[k2072]
+    .then(r => r.v2073)
+    .html(`<b>${x2074}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2076")
+    .find(".x2077")
+    [2078]
+    .css({width: 2079, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2081)
+    .eq(2082).parent()
+    .each((i, el) => el.id + 2083)
+    .data[k2084]
+    .then(r => r.v2085)
+    .html(`<b>${x2086}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2088")
+    .find(".x2089")
+    [2090]
+    .css({width: 2091, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2093)
+    .eq(2094).parent()
+    .each((i, el) => el.id + 2095)
+    .data[k2096]
+    .then(r => r.v2097)
+    .html(`<b>${x2098}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2100")
+    .find(".x2101")
+    [2102]
+    .css({width: 2103, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2105)
+    .eq(2106).parent()
+    .each((i, el) => el.id + 2107)
+    .data[k2108]
+    .then(r => r.v2109)
+    .html(`<b>${x2110}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2112")
+    .find(".x2113")
+    [2114]
+    .css({width: 2115, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2117)
+    .eq(2118).parent()
+    .each((i, el) => el.id + 2119)
+    .data[k2120]
+    .then(r => r.v2121)
+    .html(`<b>${x2122}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2124")
+    .find(".x2125")
+    [2126]
+    .css({width: 2127, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2129)
+    .eq(2130).parent()
+    .each((i, el) => el.id + 2131)
+    .data[k2132]
+    .then(r => r.v2133)
+    .html(`<b>${x2134}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2136")
+    .find(".x2137")
+    [2138]
+    .css({width: 2139, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2141)
+    .eq(2142).parent()
+    .each((i, el) => el.id + 2143)
+    .data[k2144]
+    .then(r => r.v2145)
+    .html(`<b>${x2146}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2148")
+    .find(".x2149")
+    [2150]
+    .css({width: 2151, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2153)
+    .eq(2154).parent()
+    .each((i, el) => el.id + 2155)
+    .data[k2156]
+    .then(r => r.v2157)
+    .html(`<b>${x2158}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2160")
+    .find(".x2161")
+    [2162]
+    .css({width: 2163, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2165)
+    .eq(2166).parent()
+    .each((i, el) => el.id + 2167)
+    .data[k2168]
+    .then(r => r.v2169)
+    .html(`<b>${x2170}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2172")
+    .find(".x2173")
+    [2174]
+    .css({width: 2175, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2177)
+    .eq(2178).parent()
+    .each((i, el) => el.id + 2179)
+    .data[k2180]
+    .then(r => r.v2181)
+    .html(`<b>${x2182}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2184")
+    .find(".x2185")
+    [2186]
+    .css({width: 2187, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2189)
+    .eq(2190).parent()
+    .each((i, el) => el.id + 2191)
+    .data[k2192]
+    .then(r => r.v2193)
+    .html(`<b>${x2194}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2196")
+    .find(".x2197")
+    [2198]
+    .css({width: 2199, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2201)
+    .eq(2202).parent()
+    .each((i, el) => el.id + 2203)
+    .data[k2204]
+    .then(r => r.v2205)
+    .html(`<b>${x2206}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2208")
+    .find(".x2209")
+    [2210]
+    .css({width: 2211, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2213)
+    .eq(2214).parent()
+    .each((i, el) => el.id + 2215)
+    .data[k2216]
+    .then(r => r.v2217)
+    .html(`<b>${x2218}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2220")
+    .find(".x2221")
+    [2222]
+    .css({width: 2223, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2225)
+    .eq(2226).parent()
+    .each((i, el) => el.id + 2227)
+    .data[k2228]
+    .then(r => r.v2229)
+    .html(`<b>${x2230}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2232")
+    .find(".x2233")
+    [2234]
+    .css({width: 2235, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2237)
+    .eq(2238).parent()
+    .each((i, el) => el.id + 2239)
+    .data[k2240]
+    .then(r => r.v2241)
+    .html(`<b>${x2242}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2244")
+    .find(".x2245")
+    [2246]
+    .css({width: 2247, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2249)
+    .eq(2250).parent()
+    .each((i, el) => el.id + 2251)
+    .data[k2252]
+    .then(r => r.v2253)
+    .html(`<b>${x2254}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2256")
+    .find(".x2257")
+    [2258]
+    .css({width: 2259, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2261)
+    .eq(2262).parent()
+    .each((i, el) => el.id + 2263)
+    .data[k2264]
+    .then(r => r.v2265)
+    .html(`<b>${x2266}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2268")
+    .find(".x2269")
+    [2270]
+    .css({width: 2271, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2273)
+    .eq(2274).parent()
+    .each((i, el) => el.id + 2275)
+    .data[k2276]
+    .then(r => r.v2277)
+    .html(`<b>${x2278}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2280")
+    .find(".x2281")
+    [2282]
+    .css({width: 2283, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2285)
+    .eq(2286).parent()
+    .each((i, el) => el.id + 2287)
+    .data[k2288]
+    .then(r => r.v2289)
+    .html(`<b>${x2290}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2292")
+    .find(".x2293")
+    [2294]
+    .css({width: 2295, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2297)
+    .eq(2298).parent()
+    .each((i, el) => el.id + 2299)
+    .data[k2300]
+    .then(r => r.v2301)
+    .html(`<b>${x2302}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2304")
+    .find(".x2305")
+    [2306]
+    .css({width: 2307, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2309)
+    .eq(2310).parent()
+    .each((i, el) => el.id + 2311)
+    .data[k2312]
+    .then(r => r.v2313)
+    .html(`<b>${x2314}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2316")
+    .find(".x2317")
+    [2318]
+    .css({width: 2319, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2321)
+    .eq(2322).parent()
+    .each((i, el) => el.id + 2323)
+    .data[k2324]
+    .then(r => r.v2325)
+    .html(`<b>${x2326}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2328")
+    .find(".x2329")
+    [2330]
+    .css({width: 2331, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2333)
+    .eq(2334).parent()
+    .each((i, el) => el.id + 2335)
+    .data[k2336]
+    .then(r => r.v2337)
+    .html(`<b>${x2338}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2340")
+    .find(".x2341")
+    [2342]
+    .css({width: 2343, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2345)
+    .eq(2346).parent()
+    .each((i, el) => el.id + 2347)
+    .data[k2348]
+    .then(r => r.v2349)
+    .html(`<b>${x2350}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2352")
+    .find(".x2353")
+    [2354]
+    .css({width: 2355, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2357)
+    .eq(2358).parent()
+    .each((i, el) => el.id + 2359)
+    .data[k2360]
+    .then(r => r.v2361)
+    .html(`<b>${x2362}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2364")
+    .find(".x2365")
+    [2366]
+    .css({width: 2367, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2369)
+    .eq(2370).parent()
+    .each((i, el) => el.id + 2371)
+    .data[k2372]
+    .then(r => r.v2373)
+    .html(`<b>${x2374}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2376")
+    .find(".x2377")
+    [2378]
+    .css({width: 2379, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2381)
+    .eq(2382).parent()
+    .each((i, el) => el.id + 2383)
+    .data[k2384]
+    .then(r => r.v2385)
+    .html(`<b>${x2386}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2388")
+    .find(".x2389")
+    [2390]
+    .css({width: 2391, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2393)
+    .eq(2394).parent()
+    .each((i, el) => el.id + 2395)
+    .data[k2396]
+    .then(r => r.v2397)
+    .html(`<b>${x2398}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2400")
+    .find(".x2401")
+    [2402]
+    .css({width: 2403, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2405)
+    .eq(2406).parent()
+    .each((i, el) => el.id + 2407)
+    .data[k2408]
+    .then(r => r.v2409)
+    .html(`<b>${x2410}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2412")
+    .find(".x2413")
+    [2414]
+    .css({width: 2415, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2417)
+    .eq(2418).parent()
+    .each((i, el) => el.id + 2419)
+    .data[k2420]
+    .then(r => r.v2421)
+    .html(`<b>${x2422}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2424")
+    .find(".x2425")
+    [2426]
+    .css({width: 2427, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2429)
+    .eq(2430).parent()
+    .each((i, el) => el.id + 2431)
+    .data[k2432]
+    .then(r => r.v2433)
+    .html(`<b>${x2434}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2436")
+    .find(".x2437")
+    [2438]
+    .css({width: 2439, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2441)
+    .eq(2442).parent()
+    .each((i, el) => el.id + 2443)
+    .data[k2444]
+    .then(r => r.v2445)
+    .html(`<b>${x2446}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2448")
+    .find(".x2449")
+    [2450]
+    .css({width: 2451, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2453)
+    .eq(2454).parent()
+    .each((i, el) => el.id + 2455)
+    .data[k2456]
+    .then(r => r.v2457)
+    .html(`<b>${x2458}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2460")
+    .find(".x2461")
+    [2462]
+    .css({width: 2463, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2465)
+    .eq(2466).parent()
+    .each((i, el) => el.id + 2467)
+    .data[k2468]
+    .then(r => r.v2469)
+    .html(`<b>${x2470}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2472")
+    .find(".x2473")
+    [2474]
+    .css({width: 2475, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2477)
+    .eq(2478).parent()
+    .each((i, el) => el.id + 2479)
+    .data[k2480]
+    .then(r => r.v2481)
+    .html(`<b>${x2482}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2484")
+    .find(".x2485")
+    [2486]
+    .css({width: 2487, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2489)
+    .eq(2490).parent()
+    .each((i, el) => el.id + 2491)
+    .data[k2492]
+    .then(r => r.v2493)
+    .html(`<b>${x2494}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2496")
+    .find(".x2497")
+    [2498]
+    .css({width: 2499, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2501)
+    .eq(2502).parent()
+    .each((i, el) => el.id + 2503)
+    .data[k2504]
+    .then(r => r.v2505)
+    .html(`<b>${x2506}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2508")
+    .find(".x2509")
+    [2510]
+    .css({width: 2511, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2513)
+    .eq(2514).parent()
+    .each((i, el) => el.id + 2515)
+    .data[k2516]
+    .then(r => r.v2517)
+    .html(`<b>${x2518}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2520")
+    .find(".x2521")
+    [2522]
+    .css({width: 2523, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2525)
+    .eq(2526).parent()
+    .each((i, el) => el.id + 2527)
+    .data[k2528]
+    .then(r => r.v2529)
+    .html(`<b>${x2530}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2532")
+    .find(".x2533")
+    [2534]
+    .css({width: 2535, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2537)
+    .eq(2538).parent()
+    .each((i, el) => el.id + 2539)
+    .data[k2540]
+    .then(r => r.v2541)
+    .html(`<b>${x2542}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2544")
+    .find(".x2545")
+    [2546]
+    .css({width: 2547, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2549)
+    .eq(2550).parent()
+    .each((i, el) => el.id + 2551)
+    .data[k2552]
+    .then(r => r.v2553)
+    .html(`<b>${x2554}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2556")
+    .find(".x2557")
+    [2558]
+    .css({width: 2559, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2561)
+    .eq(2562).parent()
+    .each((i, el) => el.id + 2563)
+    .data[k2564]
+    .then(r => r.v2565)
+    .html(`<b>${x2566}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2568")
+    .find(".x2569")
+    [2570]
+    .css({width: 2571, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2573)
+    .eq(2574).parent()
+    .each((i, el) => el.id + 2575)
+    .data[k2576]
+    .then(r => r.v2577)
+    .html(`<b>${x2578}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2580")
+    .find(".x2581")
+    [2582]
+    .css({width: 2583, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2585)
+    .eq(2586).parent()
+    .each((i, el) => el.id + 2587)
+    .data[k2588]
+    .then(r => r.v2589)
+    .html(`<b>${x2590}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2592")
+    .find(".x2593")
+    [2594]
+    .css({width: 2595, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2597)
+    .eq(2598).parent()
+    .each((i, el) => el.id + 2599)
+    .data[k2600]
+    .then(r => r.v2601)
+    .html(`<b>${x2602}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2604")
+    .find(".x2605")
+    [2606]
+    .css({width: 2607, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2609)
+    .eq(2610).parent()
+    .each((i, el) => el.id + 2611)
+    .data[k2612]
+    .then(r => r.v2613)
+    .html(`<b>${x2614}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2616")
+    .find(".x2617")
+    [2618]
+    .css({width: 2619, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2621)
+    .eq(2622).parent()
+    .each((i, el) => el.id + 2623)
+    .data[k2624]
+    .then(r => r.v2625)
+    .html(`<b>${x2626}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2628")
+    .find(".x2629")
+    [2630]
+    .css({width: 2631, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2633)
+    .eq(2634).parent()
+    .each((i, el) => el.id + 2635)
+    .data[k2636]
+    .then(r => r.v2637)
+    .html(`<b>${x2638}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2640")
+    .find(".x2641")
+    [2642]
+    .css({width: 2643, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2645)
+    .eq(2646).parent()
+    .each((i, el) => el.id + 2647)
+    .data[k2648]
+    .then(r => r.v2649)
+    .html(`<b>${x2650}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2652")
+    .find(".x2653")
+    [2654]
+    .css({width: 2655, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2657)
+    .eq(2658).parent()
+    .each((i, el) => el.id + 2659)
+    .data[k2660]
+    .then(r => r.v2661)
+    .html(`<b>${x2662}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2664")
+    .find(".x2665")
+    [2666]
+    .css({width: 2667, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2669)
+    .eq(2670).parent()
+    .each((i, el) => el.id + 2671)
+    .data[k2672]
+    .then(r => r.v2673)
+    .html(`<b>${x2674}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2676")
+    .find(".x2677")
+    [2678]
+    .css({width: 2679, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2681)
+    .eq(2682).parent()
+    .each((i, el) => el.id + 2683)
+    .data[k2684]
+    .then(r => r.v2685)
+    .html(`<b>${x2686}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2688")
+    .find(".x2689")
+    [2690]
+    .css({width: 2691, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2693)
+    .eq(2694).parent()
+    .each((i, el) => el.id + 2695)
+    .data[k2696]
+    .then(r => r.v2697)
+    .html(`<b>${x2698}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2700")
+    .find(".x2701")
+    [2702]
+    .css({width: 2703, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2705)
+    .eq(2706).parent()
+    .each((i, el) => el.id + 2707)
+    .data[k2708]
+    .then(r => r.v2709)
+    .html(`<b>${x2710}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2712")
+    .find(".x2713")
+    [2714]
+    .css({width: 2715, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2717)
+    .eq(2718).parent()
+    .each((i, el) => el.id + 2719)
+    .data[k2720]
+    .then(r => r.v2721)
+    .html(`<b>${x2722}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2724")
+    .find(".x2725")
+    [2726]
+    .css({width: 2727, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2729)
+    .eq(2730).parent()
+    .each((i, el) => el.id + 2731)
+    .data[k2732]
+    .then(r => r.v2733)
+    .html(`<b>${x2734}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2736")
+    .find(".x2737")
+    [2738]
+    .css({width: 2739, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2741)
+    .eq(2742).parent()
+    .each((i, el) => el.id + 2743)
+    .data[k2744]
+    .then(r => r.v2745)
+    .html(`<b>${x2746}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2748")
+    .find(".x2749")
+    [2750]
+    .css({width: 2751, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2753)
+    .eq(2754).parent()
+    .each((i, el) => el.id + 2755)
+    .data[k2756]
+    .then(r => r.v2757)
+    .html(`<b>${x2758}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2760")
+    .find(".x2761")
+    [2762]
+    .css({width: 2763, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2765)
+    .eq(2766).parent()
+    .each((i, el) => el.id + 2767)
+    .data[k2768]
+    .then(r => r.v2769)
+    .html(`<b>${x2770}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2772")
+    .find(".x2773")
+    [2774]
+    .css({width: 2775, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2777)
+    .eq(2778).parent()
+    .each((i, el) => el.id + 2779)
+    .data[k2780]
+    .then(r => r.v2781)
+    .html(`<b>${x2782}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2784")
+    .find(".x2785")
+    [2786]
+    .css({width: 2787, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2789)
+    .eq(2790).parent()
+    .each((i, el) => el.id + 2791)
+    .data[k2792]
+    .then(r => r.v2793)
+    .html(`<b>${x2794}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2796")
+    .find(".x2797")
+    [2798]
+    .css({width: 2799, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2801)
+    .eq(2802).parent()
+    .each((i, el) => el.id + 2803)
+    .data[k2804]
+    .then(r => r.v2805)
+    .html(`<b>${x2806}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2808")
+    .find(".x2809")
+    [2810]
+    .css({width: 2811, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2813)
+    .eq(2814).parent()
+    .each((i, el) => el.id + 2815)
+    .data[k2816]
+    .then(r => r.v2817)
+    .html(`<b>${x2818}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2820")
+    .find(".x2821")
+    [2822]
+    .css({width: 2823, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2825)
+    .eq(2826).parent()
+    .each((i, el) => el.id + 2827)
+    .data[k2828]
+    .then(r => r.v2829)
+    .html(`<b>${x2830}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2832")
+    .find(".x2833")
+    [2834]
+    .css({width: 2835, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2837)
+    .eq(2838).parent()
+    .each((i, el) => el.id + 2839)
+    .data[k2840]
+    .then(r => r.v2841)
+    .html(`<b>${x2842}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2844")
+    .find(".x2845")
+    [2846]
+    .css({width: 2847, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2849)
+    .eq(2850).parent()
+    .each((i, el) => el.id + 2851)
+    .data[k2852]
+    .then(r => r.v2853)
+    .html(`<b>${x2854}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2856")
+    .find(".x2857")
+    [2858]
+    .css({width: 2859, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2861)
+    .eq(2862).parent()
+    .each((i, el) => el.id + 2863)
+    .data[k2864]
+    .then(r => r.v2865)
+    .html(`<b>${x2866}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2868")
+    .find(".x2869")
+    [2870]
+    .css({width: 2871, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2873)
+    .eq(2874).parent()
+    .each((i, el) => el.id + 2875)
+    .data[k2876]
+    .then(r => r.v2877)
+    .html(`<b>${x2878}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2880")
+    .find(".x2881")
+    [2882]
+    .css({width: 2883, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2885)
+    .eq(2886).parent()
+    .each((i, el) => el.id + 2887)
+    .data[k2888]
+    .then(r => r.v2889)
+    .html(`<b>${x2890}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2892")
+    .find(".x2893")
+    [2894]
+    .css({width: 2895, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2897)
+    .eq(2898).parent()
+    .each((i, el) => el.id + 2899)
+    .data[k2900]
+    .then(r => r.v2901)
+    .html(`<b>${x2902}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2904")
+    .find(".x2905")
+    [2906]
+    .css({width: 2907, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2909)
+    .eq(2910).parent()
+    .each((i, el) => el.id + 2911)
+    .data[k2912]
+    .then(r => r.v2913)
+    .html(`<b>${x2914}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2916")
+    .find(".x2917")
+    [2918]
+    .css({width: 2919, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2921)
+    .eq(2922).parent()
+    .each((i, el) => el.id + 2923)
+    .data[k2924]
+    .then(r => r.v2925)
+    .html(`<b>${x2926}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2928")
+    .find(".x2929")
+    [2930]
+    .css({width: 2931, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2933)
+    .eq(2934).parent()
+    .each((i, el) => el.id + 2935)
+    .data[k2936]
+    .then(r => r.v2937)
+    .html(`<b>${x2938}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2940")
+    .find(".x2941")
+    [2942]
+    .css({width: 2943, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2945)
+    .eq(2946).parent()
+    .each((i, el) => el.id + 2947)
+    .data[k2948]
+    .then(r => r.v2949)
+    .html(`<b>${x2950}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2952")
+    .find(".x2953")
+    [2954]
+    .css({width: 2955, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2957)
+    .eq(2958).parent()
+    .each((i, el) => el.id + 2959)
+    .data[k2960]
+    .then(r => r.v2961)
+    .html(`<b>${x2962}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2964")
+    .find(".x2965")
+    [2966]
+    .css({width: 2967, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2969)
+    .eq(2970).parent()
+    .each((i, el) => el.id + 2971)
+    .data[k2972]
+    .then(r => r.v2973)
+    .html(`<b>${x2974}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2976")
+    .find(".x2977")
+    [2978]
+    .css({width: 2979, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2981)
+    .eq(2982).parent()
+    .each((i, el) => el.id + 2983)
+    .data[k2984]
+    .then(r => r.v2985)
+    .html(`<b>${x2986}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c2988")
+    .find(".x2989")
+    [2990]
+    .css({width: 2991, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v2993)
+    .eq(2994).parent()
+    .each((i, el) => el.id + 2995)
+    .data[k2996]
+    .then(r => r.v2997)
+    .html(`<b>${x2998}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3000")
+    .find(".x3001")
+    [3002]
+    .css({width: 3003, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3005)
+    .eq(3006).parent()
+    .each((i, el) => el.id + 3007)
+    .data[k3008]
+    .then(r => r.v3009)
+    .html(`<b>${x3010}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3012")
+    .find(".x3013")
+    [3014]
+    .css({width: 3015, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3017)
+    .eq(3018).parent()
+    .each((i, el) => el.id + 3019)
+    .data[k3020]
+    .then(r => r.v3021)
+    .html(`<b>${x3022}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3024")
+    .find(".x3025")
+    [3026]
+    .css({width: 3027, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3029)
+    .eq(3030).parent()
+    .each((i, el) => el.id + 3031)
+    .data[k3032]
+    .then(r => r.v3033)
+    .html(`<b>${x3034}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3036")
+    .find(".x3037")
+    [3038]
+    .css({width: 3039, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3041)
+    .eq(3042).parent()
+    .each((i, el) => el.id + 3043)
+    .data[k3044]
+    .then(r => r.v3045)
+    .html(`<b>${x3046}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3048")
+    .find(".x3049")
+    [3050]
+    .css({width: 3051, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3053)
+    .eq(3054).parent()
+    .each((i, el) => el.id + 3055)
+    .data[k3056]
+    .then(r => r.v3057)
+    .html(`<b>${x3058}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3060")
+    .find(".x3061")
+    [3062]
+    .css({width: 3063, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3065)
+    .eq(3066).parent()
+    .each((i, el) => el.id + 3067)
+    .data[k3068]
+    .then(r => r.v3069)
+    .html(`<b>${x3070}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3072")
+    .find(".x3073")
+    [3074]
+    .css({width: 3075, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3077)
+    .eq(3078).parent()
+    .each((i, el) => el.id + 3079)
+    .data[k3080]
+    .then(r => r.v3081)
+    .html(`<b>${x3082}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3084")
+    .find(".x3085")
+    [3086]
+    .css({width: 3087, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3089)
+    .eq(3090).parent()
+    .each((i, el) => el.id + 3091)
+    .data[k3092]
+    .then(r => r.v3093)
+    .html(`<b>${x3094}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3096")
+    .find(".x3097")
+    [3098]
+    .css({width: 3099, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3101)
+    .eq(3102).parent()
+    .each((i, el) => el.id + 3103)
+    .data[k3104]
+    .then(r => r.v3105)
+    .html(`<b>${x3106}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3108")
+    .find(".x3109")
+    [3110]
+    .css({width: 3111, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3113)
+    .eq(3114).parent()
+    .each((i, el) => el.id + 3115)
+    .data[k3116]
+    .then(r => r.v3117)
+    .html(`<b>${x3118}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3120")
+    .find(".x3121")
+    [3122]
+    .css({width: 3123, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3125)
+    .eq(3126).parent()
+    .each((i, el) => el.id + 3127)
+    .data[k3128]
+    .then(r => r.v3129)
+    .html(`<b>${x3130}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3132")
+    .find(".x3133")
+    [3134]
+    .css({width: 3135, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3137)
+    .eq(3138).parent()
+    .each((i, el) => el.id + 3139)
+    .data[k3140]
+    .then(r => r.v3141)
+    .html(`<b>${x3142}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3144")
+    .find(".x3145")
+    [3146]
+    .css({width: 3147, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3149)
+    .eq(3150).parent()
+    .each((i, el) => el.id + 3151)
+    .data[k3152]
+    .then(r => r.v3153)
+    .html(`<b>${x3154}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3156")
+    .find(".x3157")
+    [3158]
+    .css({width: 3159, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3161)
+    .eq(3162).parent()
+    .each((i, el) => el.id + 3163)
+    .data[k3164]
+    .then(r => r.v3165)
+    .html(`<b>${x3166}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3168")
+    .find(".x3169")
+    [3170]
+    .css({width: 3171, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3173)
+    .eq(3174).parent()
+    .each((i, el) => el.id + 3175)
+    .data[k3176]
+    .then(r => r.v3177)
+    .html(`<b>${x3178}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3180")
+    .find(".x3181")
+    [3182]
+    .css({width: 3183, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3185)
+    .eq(3186).parent()
+    .each((i, el) => el.id + 3187)
+    .data[k3188]
+    .then(r => r.v3189)
+    .html(`<b>${x3190}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3192")
+    .find(".x3193")
+    [3194]
+    .css({width: 3195, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3197)
+    .eq(3198).parent()
+    .each((i, el) => el.id + 3199)
+    .data[k3200]
+    .then(r => r.v3201)
+    .html(`<b>${x3202}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3204")
+    .find(".x3205")
+    [3206]
+    .css({width: 3207, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3209)
+    .eq(3210).parent()
+    .each((i, el) => el.id + 3211)
+    .data[k3212]
+    .then(r => r.v3213)
+    .html(`<b>${x3214}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3216")
+    .find(".x3217")
+    [3218]
+    .css({width: 3219, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3221)
+    .eq(3222).parent()
+    .each((i, el) => el.id + 3223)
+    .data[k3224]
+    .then(r => r.v3225)
+    .html(`<b>${x3226}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3228")
+    .find(".x3229")
+    [3230]
+    .css({width: 3231, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3233)
+    .eq(3234).parent()
+    .each((i, el) => el.id + 3235)
+    .data[k3236]
+    .then(r => r.v3237)
+    .html(`<b>${x3238}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3240")
+    .find(".x3241")
+    [3242]
+    .css({width: 3243, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3245)
+    .eq(3246).parent()
+    .each((i, el) => el.id + 3247)
+    .data[k3248]
+    .then(r => r.v3249)
+    .html(`<b>${x3250}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3252")
+    .find(".x3253")
+    [3254]
+    .css({width: 3255, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3257)
+    .eq(3258).parent()
+    .each((i, el) => el.id + 3259)
+    .data[k3260]
+    .then(r => r.v3261)
+    .html(`<b>${x3262}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3264")
+    .find(".x3265")
+    [3266]
+    .css({width: 3267, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3269)
+    .eq(3270).parent()
+    .each((i, el) => el.id + 3271)
+    .data[k3272]
+    .then(r => r.v3273)
+    .html(`<b>${x3274}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3276")
+    .find(".x3277")
+    [3278]
+    .css({width: 3279, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3281)
+    .eq(3282).parent()
+    .each((i, el) => el.id + 3283)
+    .data[k3284]
+    .then(r => r.v3285)
+    .html(`<b>${x3286}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3288")
+    .find(".x3289")
+    [3290]
+    .css({width: 3291, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3293)
+    .eq(3294).parent()
+    .each((i, el) => el.id + 3295)
+    .data[k3296]
+    .then(r => r.v3297)
+    .html(`<b>${x3298}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3300")
+    .find(".x3301")
+    [3302]
+    .css({width: 3303, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3305)
+    .eq(3306).parent()
+    .each((i, el) => el.id + 3307)
+    .data[k3308]
+    .then(r => r.v3309)
+    .html(`<b>${x3310}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3312")
+    .find(".x3313")
+    [3314]
+    .css({width: 3315, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3317)
+    .eq(3318).parent()
+    .each((i, el) => el.id + 3319)
+    .data[k3320]
+    .then(r => r.v3321)
+    .html(`<b>${x3322}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3324")
+    .find(".x3325")
+    [3326]
+    .css({width: 3327, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3329)
+    .eq(3330).parent()
+    .each((i, el) => el.id + 3331)
+    .data[k3332]
+    .then(r => r.v3333)
+    .html(`<b>${x3334}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3336")
+    .find(".x3337")
+    [3338]
+    .css({width: 3339, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3341)
+    .eq(3342).parent()
+    .each((i, el) => el.id + 3343)
+    .data[k3344]
+    .then(r => r.v3345)
+    .html(`<b>${x3346}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3348")
+    .find(".x3349")
+    [3350]
+    .css({width: 3351, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3353)
+    .eq(3354).parent()
+    .each((i, el) => el.id + 3355)
+    .data[k3356]
+    .then(r => r.v3357)
+    .html(`<b>${x3358}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3360")
+    .find(".x3361")
+    [3362]
+    .css({width: 3363, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3365)
+    .eq(3366).parent()
+    .each((i, el) => el.id + 3367)
+    .data[k3368]
+    .then(r => r.v3369)
+    .html(`<b>${x3370}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3372")
+    .find(".x3373")
+    [3374]
+    .css({width: 3375, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3377)
+    .eq(3378).parent()
+    .each((i, el) => el.id + 3379)
+    .data[k3380]
+    .then(r => r.v3381)
+    .html(`<b>${x3382}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3384")
+    .find(".x3385")
+    [3386]
+    .css({width: 3387, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3389)
+    .eq(3390).parent()
+    .each((i, el) => el.id + 3391)
+    .data[k3392]
+    .then(r => r.v3393)
+    .html(`<b>${x3394}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3396")
+    .find(".x3397")
+    [3398]
+    .css({width: 3399, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3401)
+    .eq(3402).parent()
+    .each((i, el) => el.id + 3403)
+    .data[k3404]
+    .then(r => r.v3405)
+    .html(`<b>${x3406}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3408")
+    .find(".x3409")
+    [3410]
+    .css({width: 3411, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3413)
+    .eq(3414).parent()
+    .each((i, el) => el.id + 3415)
+    .data[k3416]
+    .then(r => r.v3417)
+    .html(`<b>${x3418}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3420")
+    .find(".x3421")
+    [3422]
+    .css({width: 3423, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3425)
+    .eq(3426).parent()
+    .each((i, el) => el.id + 3427)
+    .data[k3428]
+    .then(r => r.v3429)
+    .html(`<b>${x3430}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3432")
+    .find(".x3433")
+    [3434]
+    .css({width: 3435, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3437)
+    .eq(3438).parent()
+    .each((i, el) => el.id + 3439)
+    .data[k3440]
+    .then(r => r.v3441)
+    .html(`<b>${x3442}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3444")
+    .find(".x3445")
+    [3446]
+    .css({width: 3447, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3449)
+    .eq(3450).parent()
+    .each((i, el) => el.id + 3451)
+    .data[k3452]
+    .then(r => r.v3453)
+    .html(`<b>${x3454}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3456")
+    .find(".x3457")
+    [3458]
+    .css({width: 3459, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3461)
+    .eq(3462).parent()
+    .each((i, el) => el.id + 3463)
+    .data[k3464]
+    .then(r => r.v3465)
+    .html(`<b>${x3466}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3468")
+    .find(".x3469")
+    [3470]
+    .css({width: 3471, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3473)
+    .eq(3474).parent()
+    .each((i, el) => el.id + 3475)
+    .data[k3476]
+    .then(r => r.v3477)
+    .html(`<b>${x3478}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3480")
+    .find(".x3481")
+    [3482]
+    .css({width: 3483, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3485)
+    .eq(3486).parent()
+    .each((i, el) => el.id + 3487)
+    .data[k3488]
+    .then(r => r.v3489)
+    .html(`<b>${x3490}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3492")
+    .find(".x3493")
+    [3494]
+    .css({width: 3495, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3497)
+    .eq(3498).parent()
+    .each((i, el) => el.id + 3499)
+    .data[k3500]
+    .then(r => r.v3501)
+    .html(`<b>${x3502}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3504")
+    .find(".x3505")
+    [3506]
+    .css({width: 3507, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3509)
+    .eq(3510).parent()
+    .each((i, el) => el.id + 3511)
+    .data[k3512]
+    .then(r => r.v3513)
+    .html(`<b>${x3514}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3516")
+    .find(".x3517")
+    [3518]
+    .css({width: 3519, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3521)
+    .eq(3522).parent()
+    .each((i, el) => el.id + 3523)
+    .data[k3524]
+    .then(r => r.v3525)
+    .html(`<b>${x3526}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3528")
+    .find(".x3529")
+    [3530]
+    .css({width: 3531, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3533)
+    .eq(3534).parent()
+    .each((i, el) => el.id + 3535)
+    .data[k3536]
+    .then(r => r.v3537)
+    .html(`<b>${x3538}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3540")
+    .find(".x3541")
+    [3542]
+    .css({width: 3543, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3545)
+    .eq(3546).parent()
+    .each((i, el) => el.id + 3547)
+    .data[k3548]
+    .then(r => r.v3549)
+    .html(`<b>${x3550}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3552")
+    .find(".x3553")
+    [3554]
+    .css({width: 3555, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3557)
+    .eq(3558).parent()
+    .each((i, el) => el.id + 3559)
+    .data[k3560]
+    .then(r => r.v3561)
+    .html(`<b>${x3562}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3564")
+    .find(".x3565")
+    [3566]
+    .css({width: 3567, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3569)
+    .eq(3570).parent()
+    .each((i, el) => el.id + 3571)
+    .data[k3572]
+    .then(r => r.v3573)
+    .html(`<b>${x3574}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3576")
+    .find(".x3577")
+    [3578]
+    .css({width: 3579, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3581)
+    .eq(3582).parent()
+    .each((i, el) => el.id + 3583)
+    .data[k3584]
+    .then(r => r.v3585)
+    .html(`<b>${x3586}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3588")
+    .find(".x3589")
+    [3590]
+    .css({width: 3591, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3593)
+    .eq(3594).parent()
+    .each((i, el) => el.id + 3595)
+    .data[k3596]
+    .then(r => r.v3597)
+    .html(`<b>${x3598}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3600")
+    .find(".x3601")
+    [3602]
+    .css({width: 3603, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3605)
+    .eq(3606).parent()
+    .each((i, el) => el.id + 3607)
+    .data[k3608]
+    .then(r => r.v3609)
+    .html(`<b>${x3610}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3612")
+    .find(".x3613")
+    [3614]
+    .css({width: 3615, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3617)
+    .eq(3618).parent()
+    .each((i, el) => el.id + 3619)
+    .data[k3620]
+    .then(r => r.v3621)
+    .html(`<b>${x3622}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3624")
+    .find(".x3625")
+    [3626]
+    .css({width: 3627, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3629)
+    .eq(3630).parent()
+    .each((i, el) => el.id + 3631)
+    .data[k3632]
+    .then(r => r.v3633)
+    .html(`<b>${x3634}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3636")
+    .find(".x3637")
+    [3638]
+    .css({width: 3639, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3641)
+    .eq(3642).parent()
+    .each((i, el) => el.id + 3643)
+    .data[k3644]
+    .then(r => r.v3645)
+    .html(`<b>${x3646}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3648")
+    .find(".x3649")
+    [3650]
+    .css({width: 3651, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3653)
+    .eq(3654).parent()
+    .each((i, el) => el.id + 3655)
+    .data[k3656]
+    .then(r => r.v3657)
+    .html(`<b>${x3658}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3660")
+    .find(".x3661")
+    [3662]
+    .css({width: 3663, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3665)
+    .eq(3666).parent()
+    .each((i, el) => el.id + 3667)
+    .data[k3668]
+    .then(r => r.v3669)
+    .html(`<b>${x3670}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3672")
+    .find(".x3673")
+    [3674]
+    .css({width: 3675, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3677)
+    .eq(3678).parent()
+    .each((i, el) => el.id + 3679)
+    .data[k3680]
+    .then(r => r.v3681)
+    .html(`<b>${x3682}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3684")
+    .find(".x3685")
+    [3686]
+    .css({width: 3687, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3689)
+    .eq(3690).parent()
+    .each((i, el) => el.id + 3691)
+    .data[k3692]
+    .then(r => r.v3693)
+    .html(`<b>${x3694}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3696")
+    .find(".x3697")
+    [3698]
+    .css({width: 3699, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3701)
+    .eq(3702).parent()
+    .each((i, el) => el.id + 3703)
+    .data[k3704]
+    .then(r => r.v3705)
+    .html(`<b>${x3706}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3708")
+    .find(".x3709")
+    [3710]
+    .css({width: 3711, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3713)
+    .eq(3714).parent()
+    .each((i, el) => el.id + 3715)
+    .data[k3716]
+    .then(r => r.v3717)
+    .html(`<b>${x3718}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3720")
+    .find(".x3721")
+    [3722]
+    .css({width: 3723, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3725)
+    .eq(3726).parent()
+    .each((i, el) => el.id + 3727)
+    .data[k3728]
+    .then(r => r.v3729)
+    .html(`<b>${x3730}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3732")
+    .find(".x3733")
+    [3734]
+    .css({width: 3735, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3737)
+    .eq(3738).parent()
+    .each((i, el) => el.id + 3739)
+    .data[k3740]
+    .then(r => r.v3741)
+    .html(`<b>${x3742}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3744")
+    .find(".x3745")
+    [3746]
+    .css({width: 3747, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3749)
+    .eq(3750).parent()
+    .each((i, el) => el.id + 3751)
+    .data[k3752]
+    .then(r => r.v3753)
+    .html(`<b>${x3754}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3756")
+    .find(".x3757")
+    [3758]
+    .css({width: 3759, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3761)
+    .eq(3762).parent()
+    .each((i, el) => el.id + 3763)
+    .data[k3764]
+    .then(r => r.v3765)
+    .html(`<b>${x3766}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3768")
+    .find(".x3769")
+    [3770]
+    .css({width: 3771, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3773)
+    .eq(3774).parent()
+    .each((i, el) => el.id + 3775)
+    .data[k3776]
+    .then(r => r.v3777)
+    .html(`<b>${x3778}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3780")
+    .find(".x3781")
+    [3782]
+    .css({width: 3783, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3785)
+    .eq(3786).parent()
+    .each((i, el) => el.id + 3787)
+    .data[k3788]
+    .then(r => r.v3789)
+    .html(`<b>${x3790}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3792")
+    .find(".x3793")
+    [3794]
+    .css({width: 3795, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3797)
+    .eq(3798).parent()
+    .each((i, el) => el.id + 3799)
+    .data[k3800]
+    .then(r => r.v3801)
+    .html(`<b>${x3802}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3804")
+    .find(".x3805")
+    [3806]
+    .css({width: 3807, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3809)
+    .eq(3810).parent()
+    .each((i, el) => el.id + 3811)
+    .data[k3812]
+    .then(r => r.v3813)
+    .html(`<b>${x3814}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3816")
+    .find(".x3817")
+    [3818]
+    .css({width: 3819, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3821)
+    .eq(3822).parent()
+    .each((i, el) => el.id + 3823)
+    .data[k3824]
+    .then(r => r.v3825)
+    .html(`<b>${x3826}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3828")
+    .find(".x3829")
+    [3830]
+    .css({width: 3831, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3833)
+    .eq(3834).parent()
+    .each((i, el) => el.id + 3835)
+    .data[k3836]
+    .then(r => r.v3837)
+    .html(`<b>${x3838}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3840")
+    .find(".x3841")
+    [3842]
+    .css({width: 3843, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3845)
+    .eq(3846).parent()
+    .each((i, el) => el.id + 3847)
+    .data[k3848]
+    .then(r => r.v3849)
+    .html(`<b>${x3850}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3852")
+    .find(".x3853")
+    [3854]
+    .css({width: 3855, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3857)
+    .eq(3858).parent()
+    .each((i, el) => el.id + 3859)
+    .data[k3860]
+    .then(r => r.v3861)
+    .html(`<b>${x3862}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3864")
+    .find(".x3865")
+    [3866]
+    .css({width: 3867, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3869)
+    .eq(3870).parent()
+    .each((i, el) => el.id + 3871)
+    .data[k3872]
+    .then(r => r.v3873)
+    .html(`<b>${x3874}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3876")
+    .find(".x3877")
+    [3878]
+    .css({width: 3879, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3881)
+    .eq(3882).parent()
+    .each((i, el) => el.id + 3883)
+    .data[k3884]
+    .then(r => r.v3885)
+    .html(`<b>${x3886}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3888")
+    .find(".x3889")
+    [3890]
+    .css({width: 3891, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3893)
+    .eq(3894).parent()
+    .each((i, el) => el.id + 3895)
+    .data[k3896]
+    .then(r => r.v3897)
+    .html(`<b>${x3898}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3900")
+    .find(".x3901")
+    [3902]
+    .css({width: 3903, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3905)
+    .eq(3906).parent()
+    .each((i, el) => el.id + 3907)
+    .data[k3908]
+    .then(r => r.v3909)
+    .html(`<b>${x3910}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3912")
+    .find(".x3913")
+    [3914]
+    .css({width: 3915, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3917)
+    .eq(3918).parent()
+    .each((i, el) => el.id + 3919)
+    .data[k3920]
+    .then(r => r.v3921)
+    .html(`<b>${x3922}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3924")
+    .find(".x3925")
+    [3926]
+    .css({width: 3927, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3929)
+    .eq(3930).parent()
+    .each((i, el) => el.id + 3931)
+    .data[k3932]
+    .then(r => r.v3933)
+    .html(`<b>${x3934}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3936")
+    .find(".x3937")
+    [3938]
+    .css({width: 3939, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3941)
+    .eq(3942).parent()
+    .each((i, el) => el.id + 3943)
+    .data[k3944]
+    .then(r => r.v3945)
+    .html(`<b>${x3946}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3948")
+    .find(".x3949")
+    [3950]
+    .css({width: 3951, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3953)
+    .eq(3954).parent()
+    .each((i, el) => el.id + 3955)
+    .data[k3956]
+    .then(r => r.v3957)
+    .html(`<b>${x3958}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3960")
+    .find(".x3961")
+    [3962]
+    .css({width: 3963, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3965)
+    .eq(3966).parent()
+    .each((i, el) => el.id + 3967)
+    .data[k3968]
+    .then(r => r.v3969)
+    .html(`<b>${x3970}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3972")
+    .find(".x3973")
+    [3974]
+    .css({width: 3975, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3977)
+    .eq(3978).parent()
+    .each((i, el) => el.id + 3979)
+    .data[k3980]
+    .then(r => r.v3981)
+    .html(`<b>${x3982}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3984")
+    .find(".x3985")
+    [3986]
+    .css({width: 3987, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v3989)
+    .eq(3990).parent()
+    .each((i, el) => el.id + 3991)
+    .data[k3992]
+    .then(r => r.v3993)
+    .html(`<b>${x3994}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c3996")
+    .find(".x3997")
+    [3998]
+    .css({width: 3999, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4001)
+    .eq(4002).parent()
+    .each((i, el) => el.id + 4003)
+    .data[k4004]
+    .then(r => r.v4005)
+    .html(`<b>${x4006}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4008")
+    .find(".x4009")
+    [4010]
+    .css({width: 4011, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4013)
+    .eq(4014).parent()
+    .each((i, el) => el.id + 4015)
+    .data[k4016]
+    .then(r => r.v4017)
+    .html(`<b>${x4018}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4020")
+    .find(".x4021")
+    [4022]
+    .css({width: 4023, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4025)
+    .eq(4026).parent()
+    .each((i, el) => el.id + 4027)
+    .data[k4028]
+    .then(r => r.v4029)
+    .html(`<b>${x4030}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4032")
+    .find(".x4033")
+    [4034]
+    .css({width: 4035, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4037)
+    .eq(4038).parent()
+    .each((i, el) => el.id + 4039)
+    .data[k4040]
+    .then(r => r.v4041)
+    .html(`<b>${x4042}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4044")
+    .find(".x4045")
+    [4046]
+    .css({width: 4047, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4049)
+    .eq(4050).parent()
+    .each((i, el) => el.id + 4051)
+    .data[k4052]
+    .then(r => r.v4053)
+    .html(`<b>${x4054}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4056")
+    .find(".x4057")
+    [4058]
+    .css({width: 4059, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4061)
+    .eq(4062).parent()
+    .each((i, el) => el.id + 4063)
+    .data[k4064]
+    .then(r => r.v4065)
+    .html(`<b>${x4066}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4068")
+    .find(".x4069")
+    [4070]
+    .css({width: 4071, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4073)
+    .eq(4074).parent()
+    .each((i, el) => el.id + 4075)
+    .data[k4076]
+    .then(r => r.v4077)
+    .html(`<b>${x4078}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4080")
+    .find(".x4081")
+    [4082]
+    .css({width: 4083, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4085)
+    .eq(4086).parent()
+    .each((i, el) => el.id + 4087)
+    .data[k4088]
+    .then(r => r.v4089)
+    .html(`<b>${x4090}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4092")
+    .find(".x4093")
+    [4094]
+    .css({width: 4095, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4097)
+    .eq(4098).parent()
+    .each((i, el) => el.id + 4099)
+    .data[k4100]
+    .then(r => r.v4101)
+    .html(`<b>${x4102}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4104")
+    .find(".x4105")
+    [4106]
+    .css({width: 4107, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4109)
+    .eq(4110).parent()
+    .each((i, el) => el.id + 4111)
+    .data[k4112]
+    .then(r => r.v4113)
+    .html(`<b>${x4114}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4116")
+    .find(".x4117")
+    [4118]
+    .css({width: 4119, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4121)
+    .eq(4122).parent()
+    .each((i, el) => el.id + 4123)
+    .data[k4124]
+    .then(r => r.v4125)
+    .html(`<b>${x4126}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4128")
+    .find(".x4129")
+    [4130]
+    .css({width: 4131, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4133)
+    .eq(4134).parent()
+    .each((i, el) => el.id + 4135)
+    .data[k4136]
+    .then(r => r.v4137)
+    .html(`<b>${x4138}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4140")
+    .find(".x4141")
+    [4142]
+    .css({width: 4143, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4145)
+    .eq(4146).parent()
+    .each((i, el) => el.id + 4147)
+    .data[k4148]
+    .then(r => r.v4149)
+    .html(`<b>${x4150}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4152")
+    .find(".x4153")
+    [4154]
+    .css({width: 4155, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4157)
+    .eq(4158).parent()
+    .each((i, el) => el.id + 4159)
+    .data[k4160]
+    .then(r => r.v4161)
+    .html(`<b>${x4162}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4164")
+    .find(".x4165")
+    [4166]
+    .css({width: 4167, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4169)
+    .eq(4170).parent()
+    .each((i, el) => el.id + 4171)
+    .data[k4172]
+    .then(r => r.v4173)
+    .html(`<b>${x4174}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4176")
+    .find(".x4177")
+    [4178]
+    .css({width: 4179, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4181)
+    .eq(4182).parent()
+    .each((i, el) => el.id + 4183)
+    .data[k4184]
+    .then(r => r.v4185)
+    .html(`<b>${x4186}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4188")
+    .find(".x4189")
+    [4190]
+    .css({width: 4191, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4193)
+    .eq(4194).parent()
+    .each((i, el) => el.id + 4195)
+    .data[k4196]
+    .then(r => r.v4197)
+    .html(`<b>${x4198}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4200")
+    .find(".x4201")
+    [4202]
+    .css({width: 4203, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4205)
+    .eq(4206).parent()
+    .each((i, el) => el.id + 4207)
+    .data[k4208]
+    .then(r => r.v4209)
+    .html(`<b>${x4210}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4212")
+    .find(".x4213")
+    [4214]
+    .css({width: 4215, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4217)
+    .eq(4218).parent()
+    .each((i, el) => el.id + 4219)
+    .data[k4220]
+    .then(r => r.v4221)
+    .html(`<b>${x4222}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4224")
+    .find(".x4225")
+    [4226]
+    .css({width: 4227, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4229)
+    .eq(4230).parent()
+    .each((i, el) => el.id + 4231)
+    .data[k4232]
+    .then(r => r.v4233)
+    .html(`<b>${x4234}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4236")
+    .find(".x4237")
+    [4238]
+    .css({width: 4239, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4241)
+    .eq(4242).parent()
+    .each((i, el) => el.id + 4243)
+    .data[k4244]
+    .then(r => r.v4245)
+    .html(`<b>${x4246}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4248")
+    .find(".x4249")
+    [4250]
+    .css({width: 4251, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4253)
+    .eq(4254).parent()
+    .each((i, el) => el.id + 4255)
+    .data[k4256]
+    .then(r => r.v4257)
+    .html(`<b>${x4258}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4260")
+    .find(".x4261")
+    [4262]
+    .css({width: 4263, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4265)
+    .eq(4266).parent()
+    .each((i, el) => el.id + 4267)
+    .data[k4268]
+    .then(r => r.v4269)
+    .html(`<b>${x4270}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4272")
+    .find(".x4273")
+    [4274]
+    .css({width: 4275, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4277)
+    .eq(4278).parent()
+    .each((i, el) => el.id + 4279)
+    .data[k4280]
+    .then(r => r.v4281)
+    .html(`<b>${x4282}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4284")
+    .find(".x4285")
+    [4286]
+    .css({width: 4287, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4289)
+    .eq(4290).parent()
+    .each((i, el) => el.id + 4291)
+    .data[k4292]
+    .then(r => r.v4293)
+    .html(`<b>${x4294}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4296")
+    .find(".x4297")
+    [4298]
+    .css({width: 4299, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4301)
+    .eq(4302).parent()
+    .each((i, el) => el.id + 4303)
+    .data[k4304]
+    .then(r => r.v4305)
+    .html(`<b>${x4306}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4308")
+    .find(".x4309")
+    [4310]
+    .css({width: 4311, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4313)
+    .eq(4314).parent()
+    .each((i, el) => el.id + 4315)
+    .data[k4316]
+    .then(r => r.v4317)
+    .html(`<b>${x4318}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4320")
+    .find(".x4321")
+    [4322]
+    .css({width: 4323, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4325)
+    .eq(4326).parent()
+    .each((i, el) => el.id + 4327)
+    .data[k4328]
+    .then(r => r.v4329)
+    .html(`<b>${x4330}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4332")
+    .find(".x4333")
+    [4334]
+    .css({width: 4335, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4337)
+    .eq(4338).parent()
+    .each((i, el) => el.id + 4339)
+    .data[k4340]
+    .then(r => r.v4341)
+    .html(`<b>${x4342}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4344")
+    .find(".x4345")
+    [4346]
+    .css({width: 4347, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4349)
+    .eq(4350).parent()
+    .each((i, el) => el.id + 4351)
+    .data[k4352]
+    .then(r => r.v4353)
+    .html(`<b>${x4354}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4356")
+    .find(".x4357")
+    [4358]
+    .css({width: 4359, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4361)
+    .eq(4362).parent()
+    .each((i, el) => el.id + 4363)
+    .data[k4364]
+    .then(r => r.v4365)
+    .html(`<b>${x4366}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4368")
+    .find(".x4369")
+    [4370]
+    .css({width: 4371, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4373)
+    .eq(4374).parent()
+    .each((i, el) => el.id + 4375)
+    .data[k4376]
+    .then(r => r.v4377)
+    .html(`<b>${x4378}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4380")
+    .find(".x4381")
+    [4382]
+    .css({width: 4383, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4385)
+    .eq(4386).parent()
+    .each((i, el) => el.id + 4387)
+    .data[k4388]
+    .then(r => r.v4389)
+    .html(`<b>${x4390}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4392")
+    .find(".x4393")
+    [4394]
+    .css({width: 4395, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4397)
+    .eq(4398).parent()
+    .each((i, el) => el.id + 4399)
+    .data[k4400]
+    .then(r => r.v4401)
+    .html(`<b>${x4402}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4404")
+    .find(".x4405")
+    [4406]
+    .css({width: 4407, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4409)
+    .eq(4410).parent()
+    .each((i, el) => el.id + 4411)
+    .data[k4412]
+    .then(r => r.v4413)
+    .html(`<b>${x4414}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4416")
+    .find(".x4417")
+    [4418]
+    .css({width: 4419, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4421)
+    .eq(4422).parent()
+    .each((i, el) => el.id + 4423)
+    .data[k4424]
+    .then(r => r.v4425)
+    .html(`<b>${x4426}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4428")
+    .find(".x4429")
+    [4430]
+    .css({width: 4431, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4433)
+    .eq(4434).parent()
+    .each((i, el) => el.id + 4435)
+    .data[k4436]
+    .then(r => r.v4437)
+    .html(`<b>${x4438}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4440")
+    .find(".x4441")
+    [4442]
+    .css({width: 4443, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4445)
+    .eq(4446).parent()
+    .each((i, el) => el.id + 4447)
+    .data[k4448]
+    .then(r => r.v4449)
+    .html(`<b>${x4450}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4452")
+    .find(".x4453")
+    [4454]
+    .css({width: 4455, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4457)
+    .eq(4458).parent()
+    .each((i, el) => el.id + 4459)
+    .data[k4460]
+    .then(r => r.v4461)
+    .html(`<b>${x4462}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4464")
+    .find(".x4465")
+    [4466]
+    .css({width: 4467, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4469)
+    .eq(4470).parent()
+    .each((i, el) => el.id + 4471)
+    .data[k4472]
+    .then(r => r.v4473)
+    .html(`<b>${x4474}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4476")
+    .find(".x4477")
+    [4478]
+    .css({width: 4479, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4481)
+    .eq(4482).parent()
+    .each((i, el) => el.id + 4483)
+    .data[k4484]
+    .then(r => r.v4485)
+    .html(`<b>${x4486}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4488")
+    .find(".x4489")
+    [4490]
+    .css({width: 4491, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4493)
+    .eq(4494).parent()
+    .each((i, el) => el.id + 4495)
+    .data[k4496]
+    .then(r => r.v4497)
+    .html(`<b>${x4498}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4500")
+    .find(".x4501")
+    [4502]
+    .css({width: 4503, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4505)
+    .eq(4506).parent()
+    .each((i, el) => el.id + 4507)
+    .data[k4508]
+    .then(r => r.v4509)
+    .html(`<b>${x4510}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4512")
+    .find(".x4513")
+    [4514]
+    .css({width: 4515, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4517)
+    .eq(4518).parent()
+    .each((i, el) => el.id + 4519)
+    .data[k4520]
+    .then(r => r.v4521)
+    .html(`<b>${x4522}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4524")
+    .find(".x4525")
+    [4526]
+    .css({width: 4527, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4529)
+    .eq(4530).parent()
+    .each((i, el) => el.id + 4531)
+    .data[k4532]
+    .then(r => r.v4533)
+    .html(`<b>${x4534}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4536")
+    .find(".x4537")
+    [4538]
+    .css({width: 4539, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4541)
+    .eq(4542).parent()
+    .each((i, el) => el.id + 4543)
+    .data[k4544]
+    .then(r => r.v4545)
+    .html(`<b>${x4546}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4548")
+    .find(".x4549")
+    [4550]
+    .css({width: 4551, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4553)
+    .eq(4554).parent()
+    .each((i, el) => el.id + 4555)
+    .data[k4556]
+    .then(r => r.v4557)
+    .html(`<b>${x4558}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4560")
+    .find(".x4561")
+    [4562]
+    .css({width: 4563, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4565)
+    .eq(4566).parent()
+    .each((i, el) => el.id + 4567)
+    .data[k4568]
+    .then(r => r.v4569)
+    .html(`<b>${x4570}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4572")
+    .find(".x4573")
+    [4574]
+    .css({width: 4575, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4577)
+    .eq(4578).parent()
+    .each((i, el) => el.id + 4579)
+    .data[k4580]
+    .then(r => r.v4581)
+    .html(`<b>${x4582}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4584")
+    .find(".x4585")
+    [4586]
+    .css({width: 4587, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4589)
+    .eq(4590).parent()
+    .each((i, el) => el.id + 4591)
+    .data[k4592]
+    .then(r => r.v4593)
+    .html(`<b>${x4594}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4596")
+    .find(".x4597")
+    [4598]
+    .css({width: 4599, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4601)
+    .eq(4602).parent()
+    .each((i, el) => el.id + 4603)
+    .data[k4604]
+    .then(r => r.v4605)
+    .html(`<b>${x4606}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4608")
+    .find(".x4609")
+    [4610]
+    .css({width: 4611, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4613)
+    .eq(4614).parent()
+    .each((i, el) => el.id + 4615)
+    .data[k4616]
+    .then(r => r.v4617)
+    .html(`<b>${x4618}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4620")
+    .find(".x4621")
+    [4622]
+    .css({width: 4623, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4625)
+    .eq(4626).parent()
+    .each((i, el) => el.id + 4627)
+    .data[k4628]
+    .then(r => r.v4629)
+    .html(`<b>${x4630}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4632")
+    .find(".x4633")
+    [4634]
+    .css({width: 4635, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4637)
+    .eq(4638).parent()
+    .each((i, el) => el.id + 4639)
+    .data[k4640]
+    .then(r => r.v4641)
+    .html(`<b>${x4642}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4644")
+    .find(".x4645")
+    [4646]
+    .css({width: 4647, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4649)
+    .eq(4650).parent()
+    .each((i, el) => el.id + 4651)
+    .data[k4652]
+    .then(r => r.v4653)
+    .html(`<b>${x4654}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4656")
+    .find(".x4657")
+    [4658]
+    .css({width: 4659, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4661)
+    .eq(4662).parent()
+    .each((i, el) => el.id + 4663)
+    .data[k4664]
+    .then(r => r.v4665)
+    .html(`<b>${x4666}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4668")
+    .find(".x4669")
+    [4670]
+    .css({width: 4671, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4673)
+    .eq(4674).parent()
+    .each((i, el) => el.id + 4675)
+    .data[k4676]
+    .then(r => r.v4677)
+    .html(`<b>${x4678}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4680")
+    .find(".x4681")
+    [4682]
+    .css({width: 4683, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4685)
+    .eq(4686).parent()
+    .each((i, el) => el.id + 4687)
+    .data[k4688]
+    .then(r => r.v4689)
+    .html(`<b>${x4690}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4692")
+    .find(".x4693")
+    [4694]
+    .css({width: 4695, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4697)
+    .eq(4698).parent()
+    .each((i, el) => el.id + 4699)
+    .data[k4700]
+    .then(r => r.v4701)
+    .html(`<b>${x4702}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4704")
+    .find(".x4705")
+    [4706]
+    .css({width: 4707, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4709)
+    .eq(4710).parent()
+    .each((i, el) => el.id + 4711)
+    .data[k4712]
+    .then(r => r.v4713)
+    .html(`<b>${x4714}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4716")
+    .find(".x4717")
+    [4718]
+    .css({width: 4719, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4721)
+    .eq(4722).parent()
+    .each((i, el) => el.id + 4723)
+    .data[k4724]
+    .then(r => r.v4725)
+    .html(`<b>${x4726}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4728")
+    .find(".x4729")
+    [4730]
+    .css({width: 4731, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4733)
+    .eq(4734).parent()
+    .each((i, el) => el.id + 4735)
+    .data[k4736]
+    .then(r => r.v4737)
+    .html(`<b>${x4738}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4740")
+    .find(".x4741")
+    [4742]
+    .css({width: 4743, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4745)
+    .eq(4746).parent()
+    .each((i, el) => el.id + 4747)
+    .data[k4748]
+    .then(r => r.v4749)
+    .html(`<b>${x4750}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4752")
+    .find(".x4753")
+    [4754]
+    .css({width: 4755, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4757)
+    .eq(4758).parent()
+    .each((i, el) => el.id + 4759)
+    .data[k4760]
+    .then(r => r.v4761)
+    .html(`<b>${x4762}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4764")
+    .find(".x4765")
+    [4766]
+    .css({width: 4767, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4769)
+    .eq(4770).parent()
+    .each((i, el) => el.id + 4771)
+    .data[k4772]
+    .then(r => r.v4773)
+    .html(`<b>${x4774}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4776")
+    .find(".x4777")
+    [4778]
+    .css({width: 4779, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4781)
+    .eq(4782).parent()
+    .each((i, el) => el.id + 4783)
+    .data[k4784]
+    .then(r => r.v4785)
+    .html(`<b>${x4786}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4788")
+    .find(".x4789")
+    [4790]
+    .css({width: 4791, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4793)
+    .eq(4794).parent()
+    .each((i, el) => el.id + 4795)
+    .data[k4796]
+    .then(r => r.v4797)
+    .html(`<b>${x4798}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4800")
+    .find(".x4801")
+    [4802]
+    .css({width: 4803, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4805)
+    .eq(4806).parent()
+    .each((i, el) => el.id + 4807)
+    .data[k4808]
+    .then(r => r.v4809)
+    .html(`<b>${x4810}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4812")
+    .find(".x4813")
+    [4814]
+    .css({width: 4815, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4817)
+    .eq(4818).parent()
+    .each((i, el) => el.id + 4819)
+    .data[k4820]
+    .then(r => r.v4821)
+    .html(`<b>${x4822}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4824")
+    .find(".x4825")
+    [4826]
+    .css({width: 4827, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4829)
+    .eq(4830).parent()
+    .each((i, el) => el.id + 4831)
+    .data[k4832]
+    .then(r => r.v4833)
+    .html(`<b>${x4834}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4836")
+    .find(".x4837")
+    [4838]
+    .css({width: 4839, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4841)
+    .eq(4842).parent()
+    .each((i, el) => el.id + 4843)
+    .data[k4844]
+    .then(r => r.v4845)
+    .html(`<b>${x4846}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4848")
+    .find(".x4849")
+    [4850]
+    .css({width: 4851, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4853)
+    .eq(4854).parent()
+    .each((i, el) => el.id + 4855)
+    .data[k4856]
+    .then(r => r.v4857)
+    .html(`<b>${x4858}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4860")
+    .find(".x4861")
+    [4862]
+    .css({width: 4863, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4865)
+    .eq(4866).parent()
+    .each((i, el) => el.id + 4867)
+    .data[k4868]
+    .then(r => r.v4869)
+    .html(`<b>${x4870}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4872")
+    .find(".x4873")
+    [4874]
+    .css({width: 4875, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4877)
+    .eq(4878).parent()
+    .each((i, el) => el.id + 4879)
+    .data[k4880]
+    .then(r => r.v4881)
+    .html(`<b>${x4882}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4884")
+    .find(".x4885")
+    [4886]
+    .css({width: 4887, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4889)
+    .eq(4890).parent()
+    .each((i, el) => el.id + 4891)
+    .data[k4892]
+    .then(r => r.v4893)
+    .html(`<b>${x4894}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4896")
+    .find(".x4897")
+    [4898]
+    .css({width: 4899, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4901)
+    .eq(4902).parent()
+    .each((i, el) => el.id + 4903)
+    .data[k4904]
+    .then(r => r.v4905)
+    .html(`<b>${x4906}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4908")
+    .find(".x4909")
+    [4910]
+    .css({width: 4911, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4913)
+    .eq(4914).parent()
+    .each((i, el) => el.id + 4915)
+    .data[k4916]
+    .then(r => r.v4917)
+    .html(`<b>${x4918}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4920")
+    .find(".x4921")
+    [4922]
+    .css({width: 4923, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4925)
+    .eq(4926).parent()
+    .each((i, el) => el.id + 4927)
+    .data[k4928]
+    .then(r => r.v4929)
+    .html(`<b>${x4930}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4932")
+    .find(".x4933")
+    [4934]
+    .css({width: 4935, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4937)
+    .eq(4938).parent()
+    .each((i, el) => el.id + 4939)
+    .data[k4940]
+    .then(r => r.v4941)
+    .html(`<b>${x4942}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4944")
+    .find(".x4945")
+    [4946]
+    .css({width: 4947, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4949)
+    .eq(4950).parent()
+    .each((i, el) => el.id + 4951)
+    .data[k4952]
+    .then(r => r.v4953)
+    .html(`<b>${x4954}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4956")
+    .find(".x4957")
+    [4958]
+    .css({width: 4959, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4961)
+    .eq(4962).parent()
+    .each((i, el) => el.id + 4963)
+    .data[k4964]
+    .then(r => r.v4965)
+    .html(`<b>${x4966}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4968")
+    .find(".x4969")
+    [4970]
+    .css({width: 4971, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4973)
+    .eq(4974).parent()
+    .each((i, el) => el.id + 4975)
+    .data[k4976]
+    .then(r => r.v4977)
+    .html(`<b>${x4978}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4980")
+    .find(".x4981")
+    [4982]
+    .css({width: 4983, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4985)
+    .eq(4986).parent()
+    .each((i, el) => el.id + 4987)
+    .data[k4988]
+    .then(r => r.v4989)
+    .html(`<b>${x4990}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c4992")
+    .find(".x4993")
+    [4994]
+    .css({width: 4995, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v4997)
+    .eq(4998).parent()
+    .each((i, el) => el.id + 4999)
+    .data[k5000]
+    .then(r => r.v5001)
+    .html(`<b>${x5002}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5004")
+    .find(".x5005")
+    [5006]
+    .css({width: 5007, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5009)
+    .eq(5010).parent()
+    .each((i, el) => el.id + 5011)
+    .data[k5012]
+    .then(r => r.v5013)
+    .html(`<b>${x5014}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5016")
+    .find(".x5017")
+    [5018]
+    .css({width: 5019, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5021)
+    .eq(5022).parent()
+    .each((i, el) => el.id + 5023)
+    .data[k5024]
+    .then(r => r.v5025)
+    .html(`<b>${x5026}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5028")
+    .find(".x5029")
+    [5030]
+    .css({width: 5031, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5033)
+    .eq(5034).parent()
+    .each((i, el) => el.id + 5035)
+    .data[k5036]
+    .then(r => r.v5037)
+    .html(`<b>${x5038}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5040")
+    .find(".x5041")
+    [5042]
+    .css({width: 5043, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5045)
+    .eq(5046).parent()
+    .each((i, el) => el.id + 5047)
+    .data[k5048]
+    .then(r => r.v5049)
+    .html(`<b>${x5050}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5052")
+    .find(".x5053")
+    [5054]
+    .css({width: 5055, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5057)
+    .eq(5058).parent()
+    .each((i, el) => el.id + 5059)
+    .data[k5060]
+    .then(r => r.v5061)
+    .html(`<b>${x5062}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5064")
+    .find(".x5065")
+    [5066]
+    .css({width: 5067, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5069)
+    .eq(5070).parent()
+    .each((i, el) => el.id + 5071)
+    .data[k5072]
+    .then(r => r.v5073)
+    .html(`<b>${x5074}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5076")
+    .find(".x5077")
+    [5078]
+    .css({width: 5079, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5081)
+    .eq(5082).parent()
+    .each((i, el) => el.id + 5083)
+    .data[k5084]
+    .then(r => r.v5085)
+    .html(`<b>${x5086}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5088")
+    .find(".x5089")
+    [5090]
+    .css({width: 5091, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5093)
+    .eq(5094).parent()
+    .each((i, el) => el.id + 5095)
+    .data[k5096]
+    .then(r => r.v5097)
+    .html(`<b>${x5098}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5100")
+    .find(".x5101")
+    [5102]
+    .css({width: 5103, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5105)
+    .eq(5106).parent()
+    .each((i, el) => el.id + 5107)
+    .data[k5108]
+    .then(r => r.v5109)
+    .html(`<b>${x5110}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5112")
+    .find(".x5113")
+    [5114]
+    .css({width: 5115, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5117)
+    .eq(5118).parent()
+    .each((i, el) => el.id + 5119)
+    .data[k5120]
+    .then(r => r.v5121)
+    .html(`<b>${x5122}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5124")
+    .find(".x5125")
+    [5126]
+    .css({width: 5127, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5129)
+    .eq(5130).parent()
+    .each((i, el) => el.id + 5131)
+    .data[k5132]
+    .then(r => r.v5133)
+    .html(`<b>${x5134}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5136")
+    .find(".x5137")
+    [5138]
+    .css({width: 5139, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5141)
+    .eq(5142).parent()
+    .each((i, el) => el.id + 5143)
+    .data[k5144]
+    .then(r => r.v5145)
+    .html(`<b>${x5146}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5148")
+    .find(".x5149")
+    [5150]
+    .css({width: 5151, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5153)
+    .eq(5154).parent()
+    .each((i, el) => el.id + 5155)
+    .data[k5156]
+    .then(r => r.v5157)
+    .html(`<b>${x5158}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5160")
+    .find(".x5161")
+    [5162]
+    .css({width: 5163, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5165)
+    .eq(5166).parent()
+    .each((i, el) => el.id + 5167)
+    .data[k5168]
+    .then(r => r.v5169)
+    .html(`<b>${x5170}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5172")
+    .find(".x5173")
+    [5174]
+    .css({width: 5175, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5177)
+    .eq(5178).parent()
+    .each((i, el) => el.id + 5179)
+    .data[k5180]
+    .then(r => r.v5181)
+    .html(`<b>${x5182}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5184")
+    .find(".x5185")
+    [5186]
+    .css({width: 5187, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5189)
+    .eq(5190).parent()
+    .each((i, el) => el.id + 5191)
+    .data[k5192]
+    .then(r => r.v5193)
+    .html(`<b>${x5194}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5196")
+    .find(".x5197")
+    [5198]
+    .css({width: 5199, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5201)
+    .eq(5202).parent()
+    .each((i, el) => el.id + 5203)
+    .data[k5204]
+    .then(r => r.v5205)
+    .html(`<b>${x5206}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5208")
+    .find(".x5209")
+    [5210]
+    .css({width: 5211, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5213)
+    .eq(5214).parent()
+    .each((i, el) => el.id + 5215)
+    .data[k5216]
+    .then(r => r.v5217)
+    .html(`<b>${x5218}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5220")
+    .find(".x5221")
+    [5222]
+    .css({width: 5223, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5225)
+    .eq(5226).parent()
+    .each((i, el) => el.id + 5227)
+    .data[k5228]
+    .then(r => r.v5229)
+    .html(`<b>${x5230}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5232")
+    .find(".x5233")
+    [5234]
+    .css({width: 5235, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5237)
+    .eq(5238).parent()
+    .each((i, el) => el.id + 5239)
+    .data[k5240]
+    .then(r => r.v5241)
+    .html(`<b>${x5242}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5244")
+    .find(".x5245")
+    [5246]
+    .css({width: 5247, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5249)
+    .eq(5250).parent()
+    .each((i, el) => el.id + 5251)
+    .data[k5252]
+    .then(r => r.v5253)
+    .html(`<b>${x5254}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5256")
+    .find(".x5257")
+    [5258]
+    .css({width: 5259, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5261)
+    .eq(5262).parent()
+    .each((i, el) => el.id + 5263)
+    .data[k5264]
+    .then(r => r.v5265)
+    .html(`<b>${x5266}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5268")
+    .find(".x5269")
+    [5270]
+    .css({width: 5271, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5273)
+    .eq(5274).parent()
+    .each((i, el) => el.id + 5275)
+    .data[k5276]
+    .then(r => r.v5277)
+    .html(`<b>${x5278}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5280")
+    .find(".x5281")
+    [5282]
+    .css({width: 5283, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5285)
+    .eq(5286).parent()
+    .each((i, el) => el.id + 5287)
+    .data[k5288]
+    .then(r => r.v5289)
+    .html(`<b>${x5290}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5292")
+    .find(".x5293")
+    [5294]
+    .css({width: 5295, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5297)
+    .eq(5298).parent()
+    .each((i, el) => el.id + 5299)
+    .data[k5300]
+    .then(r => r.v5301)
+    .html(`<b>${x5302}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5304")
+    .find(".x5305")
+    [5306]
+    .css({width: 5307, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5309)
+    .eq(5310).parent()
+    .each((i, el) => el.id + 5311)
+    .data[k5312]
+    .then(r => r.v5313)
+    .html(`<b>${x5314}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5316")
+    .find(".x5317")
+    [5318]
+    .css({width: 5319, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5321)
+    .eq(5322).parent()
+    .each((i, el) => el.id + 5323)
+    .data[k5324]
+    .then(r => r.v5325)
+    .html(`<b>${x5326}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5328")
+    .find(".x5329")
+    [5330]
+    .css({width: 5331, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5333)
+    .eq(5334).parent()
+    .each((i, el) => el.id + 5335)
+    .data[k5336]
+    .then(r => r.v5337)
+    .html(`<b>${x5338}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5340")
+    .find(".x5341")
+    [5342]
+    .css({width: 5343, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5345)
+    .eq(5346).parent()
+    .each((i, el) => el.id + 5347)
+    .data[k5348]
+    .then(r => r.v5349)
+    .html(`<b>${x5350}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5352")
+    .find(".x5353")
+    [5354]
+    .css({width: 5355, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5357)
+    .eq(5358).parent()
+    .each((i, el) => el.id + 5359)
+    .data[k5360]
+    .then(r => r.v5361)
+    .html(`<b>${x5362}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5364")
+    .find(".x5365")
+    [5366]
+    .css({width: 5367, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5369)
+    .eq(5370).parent()
+    .each((i, el) => el.id + 5371)
+    .data[k5372]
+    .then(r => r.v5373)
+    .html(`<b>${x5374}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5376")
+    .find(".x5377")
+    [5378]
+    .css({width: 5379, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5381)
+    .eq(5382).parent()
+    .each((i, el) => el.id + 5383)
+    .data[k5384]
+    .then(r => r.v5385)
+    .html(`<b>${x5386}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5388")
+    .find(".x5389")
+    [5390]
+    .css({width: 5391, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5393)
+    .eq(5394).parent()
+    .each((i, el) => el.id + 5395)
+    .data[k5396]
+    .then(r => r.v5397)
+    .html(`<b>${x5398}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5400")
+    .find(".x5401")
+    [5402]
+    .css({width: 5403, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5405)
+    .eq(5406).parent()
+    .each((i, el) => el.id + 5407)
+    .data[k5408]
+    .then(r => r.v5409)
+    .html(`<b>${x5410}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5412")
+    .find(".x5413")
+    [5414]
+    .css({width: 5415, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5417)
+    .eq(5418).parent()
+    .each((i, el) => el.id + 5419)
+    .data[k5420]
+    .then(r => r.v5421)
+    .html(`<b>${x5422}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5424")
+    .find(".x5425")
+    [5426]
+    .css({width: 5427, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5429)
+    .eq(5430).parent()
+    .each((i, el) => el.id + 5431)
+    .data[k5432]
+    .then(r => r.v5433)
+    .html(`<b>${x5434}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5436")
+    .find(".x5437")
+    [5438]
+    .css({width: 5439, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5441)
+    .eq(5442).parent()
+    .each((i, el) => el.id + 5443)
+    .data[k5444]
+    .then(r => r.v5445)
+    .html(`<b>${x5446}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5448")
+    .find(".x5449")
+    [5450]
+    .css({width: 5451, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5453)
+    .eq(5454).parent()
+    .each((i, el) => el.id + 5455)
+    .data[k5456]
+    .then(r => r.v5457)
+    .html(`<b>${x5458}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5460")
+    .find(".x5461")
+    [5462]
+    .css({width: 5463, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5465)
+    .eq(5466).parent()
+    .each((i, el) => el.id + 5467)
+    .data[k5468]
+    .then(r => r.v5469)
+    .html(`<b>${x5470}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5472")
+    .find(".x5473")
+    [5474]
+    .css({width: 5475, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5477)
+    .eq(5478).parent()
+    .each((i, el) => el.id + 5479)
+    .data[k5480]
+    .then(r => r.v5481)
+    .html(`<b>${x5482}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5484")
+    .find(".x5485")
+    [5486]
+    .css({width: 5487, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5489)
+    .eq(5490).parent()
+    .each((i, el) => el.id + 5491)
+    .data[k5492]
+    .then(r => r.v5493)
+    .html(`<b>${x5494}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5496")
+    .find(".x5497")
+    [5498]
+    .css({width: 5499, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5501)
+    .eq(5502).parent()
+    .each((i, el) => el.id + 5503)
+    .data[k5504]
+    .then(r => r.v5505)
+    .html(`<b>${x5506}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5508")
+    .find(".x5509")
+    [5510]
+    .css({width: 5511, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5513)
+    .eq(5514).parent()
+    .each((i, el) => el.id + 5515)
+    .data[k5516]
+    .then(r => r.v5517)
+    .html(`<b>${x5518}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5520")
+    .find(".x5521")
+    [5522]
+    .css({width: 5523, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5525)
+    .eq(5526).parent()
+    .each((i, el) => el.id + 5527)
+    .data[k5528]
+    .then(r => r.v5529)
+    .html(`<b>${x5530}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5532")
+    .find(".x5533")
+    [5534]
+    .css({width: 5535, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5537)
+    .eq(5538).parent()
+    .each((i, el) => el.id + 5539)
+    .data[k5540]
+    .then(r => r.v5541)
+    .html(`<b>${x5542}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5544")
+    .find(".x5545")
+    [5546]
+    .css({width: 5547, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5549)
+    .eq(5550).parent()
+    .each((i, el) => el.id + 5551)
+    .data[k5552]
+    .then(r => r.v5553)
+    .html(`<b>${x5554}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5556")
+    .find(".x5557")
+    [5558]
+    .css({width: 5559, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5561)
+    .eq(5562).parent()
+    .each((i, el) => el.id + 5563)
+    .data[k5564]
+    .then(r => r.v5565)
+    .html(`<b>${x5566}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5568")
+    .find(".x5569")
+    [5570]
+    .css({width: 5571, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5573)
+    .eq(5574).parent()
+    .each((i, el) => el.id + 5575)
+    .data[k5576]
+    .then(r => r.v5577)
+    .html(`<b>${x5578}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5580")
+    .find(".x5581")
+    [5582]
+    .css({width: 5583, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5585)
+    .eq(5586).parent()
+    .each((i, el) => el.id + 5587)
+    .data[k5588]
+    .then(r => r.v5589)
+    .html(`<b>${x5590}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5592")
+    .find(".x5593")
+    [5594]
+    .css({width: 5595, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5597)
+    .eq(5598).parent()
+    .each((i, el) => el.id + 5599)
+    .data[k5600]
+    .then(r => r.v5601)
+    .html(`<b>${x5602}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5604")
+    .find(".x5605")
+    [5606]
+    .css({width: 5607, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5609)
+    .eq(5610).parent()
+    .each((i, el) => el.id + 5611)
+    .data[k5612]
+    .then(r => r.v5613)
+    .html(`<b>${x5614}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5616")
+    .find(".x5617")
+    [5618]
+    .css({width: 5619, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5621)
+    .eq(5622).parent()
+    .each((i, el) => el.id + 5623)
+    .data[k5624]
+    .then(r => r.v5625)
+    .html(`<b>${x5626}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5628")
+    .find(".x5629")
+    [5630]
+    .css({width: 5631, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5633)
+    .eq(5634).parent()
+    .each((i, el) => el.id + 5635)
+    .data[k5636]
+    .then(r => r.v5637)
+    .html(`<b>${x5638}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5640")
+    .find(".x5641")
+    [5642]
+    .css({width: 5643, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5645)
+    .eq(5646).parent()
+    .each((i, el) => el.id + 5647)
+    .data[k5648]
+    .then(r => r.v5649)
+    .html(`<b>${x5650}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5652")
+    .find(".x5653")
+    [5654]
+    .css({width: 5655, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5657)
+    .eq(5658).parent()
+    .each((i, el) => el.id + 5659)
+    .data[k5660]
+    .then(r => r.v5661)
+    .html(`<b>${x5662}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5664")
+    .find(".x5665")
+    [5666]
+    .css({width: 5667, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5669)
+    .eq(5670).parent()
+    .each((i, el) => el.id + 5671)
+    .data[k5672]
+    .then(r => r.v5673)
+    .html(`<b>${x5674}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5676")
+    .find(".x5677")
+    [5678]
+    .css({width: 5679, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5681)
+    .eq(5682).parent()
+    .each((i, el) => el.id + 5683)
+    .data[k5684]
+    .then(r => r.v5685)
+    .html(`<b>${x5686}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5688")
+    .find(".x5689")
+    [5690]
+    .css({width: 5691, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5693)
+    .eq(5694).parent()
+    .each((i, el) => el.id + 5695)
+    .data[k5696]
+    .then(r => r.v5697)
+    .html(`<b>${x5698}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5700")
+    .find(".x5701")
+    [5702]
+    .css({width: 5703, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5705)
+    .eq(5706).parent()
+    .each((i, el) => el.id + 5707)
+    .data[k5708]
+    .then(r => r.v5709)
+    .html(`<b>${x5710}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5712")
+    .find(".x5713")
+    [5714]
+    .css({width: 5715, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5717)
+    .eq(5718).parent()
+    .each((i, el) => el.id + 5719)
+    .data[k5720]
+    .then(r => r.v5721)
+    .html(`<b>${x5722}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5724")
+    .find(".x5725")
+    [5726]
+    .css({width: 5727, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5729)
+    .eq(5730).parent()
+    .each((i, el) => el.id + 5731)
+    .data[k5732]
+    .then(r => r.v5733)
+    .html(`<b>${x5734}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5736")
+    .find(".x5737")
+    [5738]
+    .css({width: 5739, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5741)
+    .eq(5742).parent()
+    .each((i, el) => el.id + 5743)
+    .data[k5744]
+    .then(r => r.v5745)
+    .html(`<b>${x5746}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5748")
+    .find(".x5749")
+    [5750]
+    .css({width: 5751, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5753)
+    .eq(5754).parent()
+    .each((i, el) => el.id + 5755)
+    .data[k5756]
+    .then(r => r.v5757)
+    .html(`<b>${x5758}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5760")
+    .find(".x5761")
+    [5762]
+    .css({width: 5763, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5765)
+    .eq(5766).parent()
+    .each((i, el) => el.id + 5767)
+    .data[k5768]
+    .then(r => r.v5769)
+    .html(`<b>${x5770}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5772")
+    .find(".x5773")
+    [5774]
+    .css({width: 5775, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5777)
+    .eq(5778).parent()
+    .each((i, el) => el.id + 5779)
+    .data[k5780]
+    .then(r => r.v5781)
+    .html(`<b>${x5782}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5784")
+    .find(".x5785")
+    [5786]
+    .css({width: 5787, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5789)
+    .eq(5790).parent()
+    .each((i, el) => el.id + 5791)
+    .data[k5792]
+    .then(r => r.v5793)
+    .html(`<b>${x5794}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5796")
+    .find(".x5797")
+    [5798]
+    .css({width: 5799, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5801)
+    .eq(5802).parent()
+    .each((i, el) => el.id + 5803)
+    .data[k5804]
+    .then(r => r.v5805)
+    .html(`<b>${x5806}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5808")
+    .find(".x5809")
+    [5810]
+    .css({width: 5811, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5813)
+    .eq(5814).parent()
+    .each((i, el) => el.id + 5815)
+    .data[k5816]
+    .then(r => r.v5817)
+    .html(`<b>${x5818}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5820")
+    .find(".x5821")
+    [5822]
+    .css({width: 5823, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5825)
+    .eq(5826).parent()
+    .each((i, el) => el.id + 5827)
+    .data[k5828]
+    .then(r => r.v5829)
+    .html(`<b>${x5830}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5832")
+    .find(".x5833")
+    [5834]
+    .css({width: 5835, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5837)
+    .eq(5838).parent()
+    .each((i, el) => el.id + 5839)
+    .data[k5840]
+    .then(r => r.v5841)
+    .html(`<b>${x5842}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5844")
+    .find(".x5845")
+    [5846]
+    .css({width: 5847, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5849)
+    .eq(5850).parent()
+    .each((i, el) => el.id + 5851)
+    .data[k5852]
+    .then(r => r.v5853)
+    .html(`<b>${x5854}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5856")
+    .find(".x5857")
+    [5858]
+    .css({width: 5859, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5861)
+    .eq(5862).parent()
+    .each((i, el) => el.id + 5863)
+    .data[k5864]
+    .then(r => r.v5865)
+    .html(`<b>${x5866}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5868")
+    .find(".x5869")
+    [5870]
+    .css({width: 5871, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5873)
+    .eq(5874).parent()
+    .each((i, el) => el.id + 5875)
+    .data[k5876]
+    .then(r => r.v5877)
+    .html(`<b>${x5878}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5880")
+    .find(".x5881")
+    [5882]
+    .css({width: 5883, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5885)
+    .eq(5886).parent()
+    .each((i, el) => el.id + 5887)
+    .data[k5888]
+    .then(r => r.v5889)
+    .html(`<b>${x5890}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5892")
+    .find(".x5893")
+    [5894]
+    .css({width: 5895, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5897)
+    .eq(5898).parent()
+    .each((i, el) => el.id + 5899)
+    .data[k5900]
+    .then(r => r.v5901)
+    .html(`<b>${x5902}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5904")
+    .find(".x5905")
+    [5906]
+    .css({width: 5907, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5909)
+    .eq(5910).parent()
+    .each((i, el) => el.id + 5911)
+    .data[k5912]
+    .then(r => r.v5913)
+    .html(`<b>${x5914}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5916")
+    .find(".x5917")
+    [5918]
+    .css({width: 5919, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5921)
+    .eq(5922).parent()
+    .each((i, el) => el.id + 5923)
+    .data[k5924]
+    .then(r => r.v5925)
+    .html(`<b>${x5926}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5928")
+    .find(".x5929")
+    [5930]
+    .css({width: 5931, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5933)
+    .eq(5934).parent()
+    .each((i, el) => el.id + 5935)
+    .data[k5936]
+    .then(r => r.v5937)
+    .html(`<b>${x5938}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5940")
+    .find(".x5941")
+    [5942]
+    .css({width: 5943, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5945)
+    .eq(5946).parent()
+    .each((i, el) => el.id + 5947)
+    .data[k5948]
+    .then(r => r.v5949)
+    .html(`<b>${x5950}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5952")
+    .find(".x5953")
+    [5954]
+    .css({width: 5955, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5957)
+    .eq(5958).parent()
+    .each((i, el) => el.id + 5959)
+    .data[k5960]
+    .then(r => r.v5961)
+    .html(`<b>${x5962}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5964")
+    .find(".x5965")
+    [5966]
+    .css({width: 5967, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5969)
+    .eq(5970).parent()
+    .each((i, el) => el.id + 5971)
+    .data[k5972]
+    .then(r => r.v5973)
+    .html(`<b>${x5974}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5976")
+    .find(".x5977")
+    [5978]
+    .css({width: 5979, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5981)
+    .eq(5982).parent()
+    .each((i, el) => el.id + 5983)
+    .data[k5984]
+    .then(r => r.v5985)
+    .html(`<b>${x5986}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c5988")
+    .find(".x5989")
+    [5990]
+    .css({width: 5991, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5993)
+    .eq(5994).parent()
+    .each((i, el) => el.id + 5995)
+    .data[k5996]
+    .then(r => r.v5997)
+    .html(`<b>${x5998}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6000")
+    .find(".x6001")
+    [6002]
+    .css({width: 6003, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6005)
+    .eq(6006).parent()
+    .each((i, el) => el.id + 6007)
+    .data[k6008]
+    .then(r => r.v6009)
+    .html(`<b>${x6010}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6012")
+    .find(".x6013")
+    [6014]
+    .css({width: 6015, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6017)
+    .eq(6018).parent()
+    .each((i, el) => el.id + 6019)
+    .data[k6020]
+    .then(r => r.v6021)
+    .html(`<b>${x6022}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6024")
+    .find(".x6025")
+    [6026]
+    .css({width: 6027, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6029)
+    .eq(6030).parent()
+    .each((i, el) => el.id + 6031)
+    .data[k6032]
+    .then(r => r.v6033)
+    .html(`<b>${x6034}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6036")
+    .find(".x6037")
+    [6038]
+    .css({width: 6039, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6041)
+    .eq(6042).parent()
+    .each((i, el) => el.id + 6043)
+    .data[k6044]
+    .then(r => r.v6045)
+    .html(`<b>${x6046}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6048")
+    .find(".x6049")
+    [6050]
+    .css({width: 6051, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6053)
+    .eq(6054).parent()
+    .each((i, el) => el.id + 6055)
+    .data[k6056]
+    .then(r => r.v6057)
+    .html(`<b>${x6058}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6060")
+    .find(".x6061")
+    [6062]
+    .css({width: 6063, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6065)
+    .eq(6066).parent()
+    .each((i, el) => el.id + 6067)
+    .data[k6068]
+    .then(r => r.v6069)
+    .html(`<b>${x6070}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6072")
+    .find(".x6073")
+    [6074]
+    .css({width: 6075, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6077)
+    .eq(6078).parent()
+    .each((i, el) => el.id + 6079)
+    .data[k6080]
+    .then(r => r.v6081)
+    .html(`<b>${x6082}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6084")
+    .find(".x6085")
+    [6086]
+    .css({width: 6087, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6089)
+    .eq(6090).parent()
+    .each((i, el) => el.id + 6091)
+    .data[k6092]
+    .then(r => r.v6093)
+    .html(`<b>${x6094}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6096")
+    .find(".x6097")
+    [6098]
+    .css({width: 6099, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6101)
+    .eq(6102).parent()
+    .each((i, el) => el.id + 6103)
+    .data[k6104]
+    .then(r => r.v6105)
+    .html(`<b>${x6106}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6108")
+    .find(".x6109")
+    [6110]
+    .css({width: 6111, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6113)
+    .eq(6114).parent()
+    .each((i, el) => el.id + 6115)
+    .data[k6116]
+    .then(r => r.v6117)
+    .html(`<b>${x6118}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6120")
+    .find(".x6121")
+    [6122]
+    .css({width: 6123, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6125)
+    .eq(6126).parent()
+    .each((i, el) => el.id + 6127)
+    .data[k6128]
+    .then(r => r.v6129)
+    .html(`<b>${x6130}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6132")
+    .find(".x6133")
+    [6134]
+    .css({width: 6135, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6137)
+    .eq(6138).parent()
+    .each((i, el) => el.id + 6139)
+    .data[k6140]
+    .then(r => r.v6141)
+    .html(`<b>${x6142}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6144")
+    .find(".x6145")
+    [6146]
+    .css({width: 6147, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6149)
+    .eq(6150).parent()
+    .each((i, el) => el.id + 6151)
+    .data[k6152]
+    .then(r => r.v6153)
+    .html(`<b>${x6154}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6156")
+    .find(".x6157")
+    [6158]
+    .css({width: 6159, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6161)
+    .eq(6162).parent()
+    .each((i, el) => el.id + 6163)
+    .data[k6164]
+    .then(r => r.v6165)
+    .html(`<b>${x6166}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6168")
+    .find(".x6169")
+    [6170]
+    .css({width: 6171, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6173)
+    .eq(6174).parent()
+    .each((i, el) => el.id + 6175)
+    .data[k6176]
+    .then(r => r.v6177)
+    .html(`<b>${x6178}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6180")
+    .find(".x6181")
+    [6182]
+    .css({width: 6183, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6185)
+    .eq(6186).parent()
+    .each((i, el) => el.id + 6187)
+    .data[k6188]
+    .then(r => r.v6189)
+    .html(`<b>${x6190}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6192")
+    .find(".x6193")
+    [6194]
+    .css({width: 6195, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6197)
+    .eq(6198).parent()
+    .each((i, el) => el.id + 6199)
+    .data[k6200]
+    .then(r => r.v6201)
+    .html(`<b>${x6202}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6204")
+    .find(".x6205")
+    [6206]
+    .css({width: 6207, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6209)
+    .eq(6210).parent()
+    .each((i, el) => el.id + 6211)
+    .data[k6212]
+    .then(r => r.v6213)
+    .html(`<b>${x6214}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6216")
+    .find(".x6217")
+    [6218]
+    .css({width: 6219, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6221)
+    .eq(6222).parent()
+    .each((i, el) => el.id + 6223)
+    .data[k6224]
+    .then(r => r.v6225)
+    .html(`<b>${x6226}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6228")
+    .find(".x6229")
+    [6230]
+    .css({width: 6231, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6233)
+    .eq(6234).parent()
+    .each((i, el) => el.id + 6235)
+    .data[k6236]
+    .then(r => r.v6237)
+    .html(`<b>${x6238}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6240")
+    .find(".x6241")
+    [6242]
+    .css({width: 6243, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6245)
+    .eq(6246).parent()
+    .each((i, el) => el.id + 6247)
+    .data[k6248]
+    .then(r => r.v6249)
+    .html(`<b>${x6250}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6252")
+    .find(".x6253")
+    [6254]
+    .css({width: 6255, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6257)
+    .eq(6258).parent()
+    .each((i, el) => el.id + 6259)
+    .data[k6260]
+    .then(r => r.v6261)
+    .html(`<b>${x6262}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6264")
+    .find(".x6265")
+    [6266]
+    .css({width: 6267, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6269)
+    .eq(6270).parent()
+    .each((i, el) => el.id + 6271)
+    .data[k6272]
+    .then(r => r.v6273)
+    .html(`<b>${x6274}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6276")
+    .find(".x6277")
+    [6278]
+    .css({width: 6279, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6281)
+    .eq(6282).parent()
+    .each((i, el) => el.id + 6283)
+    .data[k6284]
+    .then(r => r.v6285)
+    .html(`<b>${x6286}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6288")
+    .find(".x6289")
+    [6290]
+    .css({width: 6291, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6293)
+    .eq(6294).parent()
+    .each((i, el) => el.id + 6295)
+    .data[k6296]
+    .then(r => r.v6297)
+    .html(`<b>${x6298}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6300")
+    .find(".x6301")
+    [6302]
+    .css({width: 6303, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6305)
+    .eq(6306).parent()
+    .each((i, el) => el.id + 6307)
+    .data[k6308]
+    .then(r => r.v6309)
+    .html(`<b>${x6310}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6312")
+    .find(".x6313")
+    [6314]
+    .css({width: 6315, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6317)
+    .eq(6318).parent()
+    .each((i, el) => el.id + 6319)
+    .data[k6320]
+    .then(r => r.v6321)
+    .html(`<b>${x6322}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6324")
+    .find(".x6325")
+    [6326]
+    .css({width: 6327, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6329)
+    .eq(6330).parent()
+    .each((i, el) => el.id + 6331)
+    .data[k6332]
+    .then(r => r.v6333)
+    .html(`<b>${x6334}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6336")
+    .find(".x6337")
+    [6338]
+    .css({width: 6339, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6341)
+    .eq(6342).parent()
+    .each((i, el) => el.id + 6343)
+    .data[k6344]
+    .then(r => r.v6345)
+    .html(`<b>${x6346}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6348")
+    .find(".x6349")
+    [6350]
+    .css({width: 6351, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6353)
+    .eq(6354).parent()
+    .each((i, el) => el.id + 6355)
+    .data[k6356]
+    .then(r => r.v6357)
+    .html(`<b>${x6358}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6360")
+    .find(".x6361")
+    [6362]
+    .css({width: 6363, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6365)
+    .eq(6366).parent()
+    .each((i, el) => el.id + 6367)
+    .data[k6368]
+    .then(r => r.v6369)
+    .html(`<b>${x6370}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6372")
+    .find(".x6373")
+    [6374]
+    .css({width: 6375, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6377)
+    .eq(6378).parent()
+    .each((i, el) => el.id + 6379)
+    .data[k6380]
+    .then(r => r.v6381)
+    .html(`<b>${x6382}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6384")
+    .find(".x6385")
+    [6386]
+    .css({width: 6387, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6389)
+    .eq(6390).parent()
+    .each((i, el) => el.id + 6391)
+    .data[k6392]
+    .then(r => r.v6393)
+    .html(`<b>${x6394}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6396")
+    .find(".x6397")
+    [6398]
+    .css({width: 6399, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6401)
+    .eq(6402).parent()
+    .each((i, el) => el.id + 6403)
+    .data[k6404]
+    .then(r => r.v6405)
+    .html(`<b>${x6406}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6408")
+    .find(".x6409")
+    [6410]
+    .css({width: 6411, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6413)
+    .eq(6414).parent()
+    .each((i, el) => el.id + 6415)
+    .data[k6416]
+    .then(r => r.v6417)
+    .html(`<b>${x6418}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6420")
+    .find(".x6421")
+    [6422]
+    .css({width: 6423, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6425)
+    .eq(6426).parent()
+    .each((i, el) => el.id + 6427)
+    .data[k6428]
+    .then(r => r.v6429)
+    .html(`<b>${x6430}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6432")
+    .find(".x6433")
+    [6434]
+    .css({width: 6435, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6437)
+    .eq(6438).parent()
+    .each((i, el) => el.id + 6439)
+    .data[k6440]
+    .then(r => r.v6441)
+    .html(`<b>${x6442}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6444")
+    .find(".x6445")
+    [6446]
+    .css({width: 6447, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6449)
+    .eq(6450).parent()
+    .each((i, el) => el.id + 6451)
+    .data[k6452]
+    .then(r => r.v6453)
+    .html(`<b>${x6454}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6456")
+    .find(".x6457")
+    [6458]
+    .css({width: 6459, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6461)
+    .eq(6462).parent()
+    .each((i, el) => el.id + 6463)
+    .data[k6464]
+    .then(r => r.v6465)
+    .html(`<b>${x6466}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6468")
+    .find(".x6469")
+    [6470]
+    .css({width: 6471, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6473)
+    .eq(6474).parent()
+    .each((i, el) => el.id + 6475)
+    .data[k6476]
+    .then(r => r.v6477)
+    .html(`<b>${x6478}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6480")
+    .find(".x6481")
+    [6482]
+    .css({width: 6483, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6485)
+    .eq(6486).parent()
+    .each((i, el) => el.id + 6487)
+    .data[k6488]
+    .then(r => r.v6489)
+    .html(`<b>${x6490}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6492")
+    .find(".x6493")
+    [6494]
+    .css({width: 6495, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6497)
+    .eq(6498).parent()
+    .each((i, el) => el.id + 6499)
+    .data[k6500]
+    .then(r => r.v6501)
+    .html(`<b>${x6502}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6504")
+    .find(".x6505")
+    [6506]
+    .css({width: 6507, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6509)
+    .eq(6510).parent()
+    .each((i, el) => el.id + 6511)
+    .data[k6512]
+    .then(r => r.v6513)
+    .html(`<b>${x6514}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6516")
+    .find(".x6517")
+    [6518]
+    .css({width: 6519, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6521)
+    .eq(6522).parent()
+    .each((i, el) => el.id + 6523)
+    .data[k6524]
+    .then(r => r.v6525)
+    .html(`<b>${x6526}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6528")
+    .find(".x6529")
+    [6530]
+    .css({width: 6531, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6533)
+    .eq(6534).parent()
+    .each((i, el) => el.id + 6535)
+    .data[k6536]
+    .then(r => r.v6537)
+    .html(`<b>${x6538}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6540")
+    .find(".x6541")
+    [6542]
+    .css({width: 6543, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6545)
+    .eq(6546).parent()
+    .each((i, el) => el.id + 6547)
+    .data[k6548]
+    .then(r => r.v6549)
+    .html(`<b>${x6550}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6552")
+    .find(".x6553")
+    [6554]
+    .css({width: 6555, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6557)
+    .eq(6558).parent()
+    .each((i, el) => el.id + 6559)
+    .data[k6560]
+    .then(r => r.v6561)
+    .html(`<b>${x6562}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6564")
+    .find(".x6565")
+    [6566]
+    .css({width: 6567, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6569)
+    .eq(6570).parent()
+    .each((i, el) => el.id + 6571)
+    .data[k6572]
+    .then(r => r.v6573)
+    .html(`<b>${x6574}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6576")
+    .find(".x6577")
+    [6578]
+    .css({width: 6579, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6581)
+    .eq(6582).parent()
+    .each((i, el) => el.id + 6583)
+    .data[k6584]
+    .then(r => r.v6585)
+    .html(`<b>${x6586}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6588")
+    .find(".x6589")
+    [6590]
+    .css({width: 6591, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6593)
+    .eq(6594).parent()
+    .each((i, el) => el.id + 6595)
+    .data[k6596]
+    .then(r => r.v6597)
+    .html(`<b>${x6598}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6600")
+    .find(".x6601")
+    [6602]
+    .css({width: 6603, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6605)
+    .eq(6606).parent()
+    .each((i, el) => el.id + 6607)
+    .data[k6608]
+    .then(r => r.v6609)
+    .html(`<b>${x6610}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6612")
+    .find(".x6613")
+    [6614]
+    .css({width: 6615, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6617)
+    .eq(6618).parent()
+    .each((i, el) => el.id + 6619)
+    .data[k6620]
+    .then(r => r.v6621)
+    .html(`<b>${x6622}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6624")
+    .find(".x6625")
+    [6626]
+    .css({width: 6627, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6629)
+    .eq(6630).parent()
+    .each((i, el) => el.id + 6631)
+    .data[k6632]
+    .then(r => r.v6633)
+    .html(`<b>${x6634}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6636")
+    .find(".x6637")
+    [6638]
+    .css({width: 6639, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6641)
+    .eq(6642).parent()
+    .each((i, el) => el.id + 6643)
+    .data[k6644]
+    .then(r => r.v6645)
+    .html(`<b>${x6646}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6648")
+    .find(".x6649")
+    [6650]
+    .css({width: 6651, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6653)
+    .eq(6654).parent()
+    .each((i, el) => el.id + 6655)
+    .data[k6656]
+    .then(r => r.v6657)
+    .html(`<b>${x6658}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6660")
+    .find(".x6661")
+    [6662]
+    .css({width: 6663, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6665)
+    .eq(6666).parent()
+    .each((i, el) => el.id + 6667)
+    .data[k6668]
+    .then(r => r.v6669)
+    .html(`<b>${x6670}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6672")
+    .find(".x6673")
+    [6674]
+    .css({width: 6675, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6677)
+    .eq(6678).parent()
+    .each((i, el) => el.id + 6679)
+    .data[k6680]
+    .then(r => r.v6681)
+    .html(`<b>${x6682}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6684")
+    .find(".x6685")
+    [6686]
+    .css({width: 6687, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6689)
+    .eq(6690).parent()
+    .each((i, el) => el.id + 6691)
+    .data[k6692]
+    .then(r => r.v6693)
+    .html(`<b>${x6694}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6696")
+    .find(".x6697")
+    [6698]
+    .css({width: 6699, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6701)
+    .eq(6702).parent()
+    .each((i, el) => el.id + 6703)
+    .data[k6704]
+    .then(r => r.v6705)
+    .html(`<b>${x6706}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6708")
+    .find(".x6709")
+    [6710]
+    .css({width: 6711, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6713)
+    .eq(6714).parent()
+    .each((i, el) => el.id + 6715)
+    .data[k6716]
+    .then(r => r.v6717)
+    .html(`<b>${x6718}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6720")
+    .find(".x6721")
+    [6722]
+    .css({width: 6723, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6725)
+    .eq(6726).parent()
+    .each((i, el) => el.id + 6727)
+    .data[k6728]
+    .then(r => r.v6729)
+    .html(`<b>${x6730}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6732")
+    .find(".x6733")
+    [6734]
+    .css({width: 6735, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6737)
+    .eq(6738).parent()
+    .each((i, el) => el.id + 6739)
+    .data[k6740]
+    .then(r => r.v6741)
+    .html(`<b>${x6742}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6744")
+    .find(".x6745")
+    [6746]
+    .css({width: 6747, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6749)
+    .eq(6750).parent()
+    .each((i, el) => el.id + 6751)
+    .data[k6752]
+    .then(r => r.v6753)
+    .html(`<b>${x6754}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6756")
+    .find(".x6757")
+    [6758]
+    .css({width: 6759, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6761)
+    .eq(6762).parent()
+    .each((i, el) => el.id + 6763)
+    .data[k6764]
+    .then(r => r.v6765)
+    .html(`<b>${x6766}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6768")
+    .find(".x6769")
+    [6770]
+    .css({width: 6771, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6773)
+    .eq(6774).parent()
+    .each((i, el) => el.id + 6775)
+    .data[k6776]
+    .then(r => r.v6777)
+    .html(`<b>${x6778}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6780")
+    .find(".x6781")
+    [6782]
+    .css({width: 6783, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6785)
+    .eq(6786).parent()
+    .each((i, el) => el.id + 6787)
+    .data[k6788]
+    .then(r => r.v6789)
+    .html(`<b>${x6790}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6792")
+    .find(".x6793")
+    [6794]
+    .css({width: 6795, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6797)
+    .eq(6798).parent()
+    .each((i, el) => el.id + 6799)
+    .data[k6800]
+    .then(r => r.v6801)
+    .html(`<b>${x6802}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6804")
+    .find(".x6805")
+    [6806]
+    .css({width: 6807, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6809)
+    .eq(6810).parent()
+    .each((i, el) => el.id + 6811)
+    .data[k6812]
+    .then(r => r.v6813)
+    .html(`<b>${x6814}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6816")
+    .find(".x6817")
+    [6818]
+    .css({width: 6819, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6821)
+    .eq(6822).parent()
+    .each((i, el) => el.id + 6823)
+    .data[k6824]
+    .then(r => r.v6825)
+    .html(`<b>${x6826}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6828")
+    .find(".x6829")
+    [6830]
+    .css({width: 6831, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6833)
+    .eq(6834).parent()
+    .each((i, el) => el.id + 6835)
+    .data[k6836]
+    .then(r => r.v6837)
+    .html(`<b>${x6838}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6840")
+    .find(".x6841")
+    [6842]
+    .css({width: 6843, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6845)
+    .eq(6846).parent()
+    .each((i, el) => el.id + 6847)
+    .data[k6848]
+    .then(r => r.v6849)
+    .html(`<b>${x6850}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6852")
+    .find(".x6853")
+    [6854]
+    .css({width: 6855, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6857)
+    .eq(6858).parent()
+    .each((i, el) => el.id + 6859)
+    .data[k6860]
+    .then(r => r.v6861)
+    .html(`<b>${x6862}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6864")
+    .find(".x6865")
+    [6866]
+    .css({width: 6867, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6869)
+    .eq(6870).parent()
+    .each((i, el) => el.id + 6871)
+    .data[k6872]
+    .then(r => r.v6873)
+    .html(`<b>${x6874}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6876")
+    .find(".x6877")
+    [6878]
+    .css({width: 6879, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6881)
+    .eq(6882).parent()
+    .each((i, el) => el.id + 6883)
+    .data[k6884]
+    .then(r => r.v6885)
+    .html(`<b>${x6886}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6888")
+    .find(".x6889")
+    [6890]
+    .css({width: 6891, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6893)
+    .eq(6894).parent()
+    .each((i, el) => el.id + 6895)
+    .data[k6896]
+    .then(r => r.v6897)
+    .html(`<b>${x6898}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6900")
+    .find(".x6901")
+    [6902]
+    .css({width: 6903, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6905)
+    .eq(6906).parent()
+    .each((i, el) => el.id + 6907)
+    .data[k6908]
+    .then(r => r.v6909)
+    .html(`<b>${x6910}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6912")
+    .find(".x6913")
+    [6914]
+    .css({width: 6915, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6917)
+    .eq(6918).parent()
+    .each((i, el) => el.id + 6919)
+    .data[k6920]
+    .then(r => r.v6921)
+    .html(`<b>${x6922}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6924")
+    .find(".x6925")
+    [6926]
+    .css({width: 6927, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6929)
+    .eq(6930).parent()
+    .each((i, el) => el.id + 6931)
+    .data[k6932]
+    .then(r => r.v6933)
+    .html(`<b>${x6934}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6936")
+    .find(".x6937")
+    [6938]
+    .css({width: 6939, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6941)
+    .eq(6942).parent()
+    .each((i, el) => el.id + 6943)
+    .data[k6944]
+    .then(r => r.v6945)
+    .html(`<b>${x6946}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6948")
+    .find(".x6949")
+    [6950]
+    .css({width: 6951, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6953)
+    .eq(6954).parent()
+    .each((i, el) => el.id + 6955)
+    .data[k6956]
+    .then(r => r.v6957)
+    .html(`<b>${x6958}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6960")
+    .find(".x6961")
+    [6962]
+    .css({width: 6963, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6965)
+    .eq(6966).parent()
+    .each((i, el) => el.id + 6967)
+    .data[k6968]
+    .then(r => r.v6969)
+    .html(`<b>${x6970}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6972")
+    .find(".x6973")
+    [6974]
+    .css({width: 6975, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6977)
+    .eq(6978).parent()
+    .each((i, el) => el.id + 6979)
+    .data[k6980]
+    .then(r => r.v6981)
+    .html(`<b>${x6982}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6984")
+    .find(".x6985")
+    [6986]
+    .css({width: 6987, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v6989)
+    .eq(6990).parent()
+    .each((i, el) => el.id + 6991)
+    .data[k6992]
+    .then(r => r.v6993)
+    .html(`<b>${x6994}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c6996")
+    .find(".x6997")
+    [6998]
+    .css({width: 6999, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7001)
+    .eq(7002).parent()
+    .each((i, el) => el.id + 7003)
+    .data[k7004]
+    .then(r => r.v7005)
+    .html(`<b>${x7006}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7008")
+    .find(".x7009")
+    [7010]
+    .css({width: 7011, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7013)
+    .eq(7014).parent()
+    .each((i, el) => el.id + 7015)
+    .data[k7016]
+    .then(r => r.v7017)
+    .html(`<b>${x7018}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7020")
+    .find(".x7021")
+    [7022]
+    .css({width: 7023, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7025)
+    .eq(7026).parent()
+    .each((i, el) => el.id + 7027)
+    .data[k7028]
+    .then(r => r.v7029)
+    .html(`<b>${x7030}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7032")
+    .find(".x7033")
+    [7034]
+    .css({width: 7035, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7037)
+    .eq(7038).parent()
+    .each((i, el) => el.id + 7039)
+    .data[k7040]
+    .then(r => r.v7041)
+    .html(`<b>${x7042}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7044")
+    .find(".x7045")
+    [7046]
+    .css({width: 7047, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7049)
+    .eq(7050).parent()
+    .each((i, el) => el.id + 7051)
+    .data[k7052]
+    .then(r => r.v7053)
+    .html(`<b>${x7054}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7056")
+    .find(".x7057")
+    [7058]
+    .css({width: 7059, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7061)
+    .eq(7062).parent()
+    .each((i, el) => el.id + 7063)
+    .data[k7064]
+    .then(r => r.v7065)
+    .html(`<b>${x7066}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7068")
+    .find(".x7069")
+    [7070]
+    .css({width: 7071, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7073)
+    .eq(7074).parent()
+    .each((i, el) => el.id + 7075)
+    .data[k7076]
+    .then(r => r.v7077)
+    .html(`<b>${x7078}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7080")
+    .find(".x7081")
+    [7082]
+    .css({width: 7083, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7085)
+    .eq(7086).parent()
+    .each((i, el) => el.id + 7087)
+    .data[k7088]
+    .then(r => r.v7089)
+    .html(`<b>${x7090}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7092")
+    .find(".x7093")
+    [7094]
+    .css({width: 7095, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7097)
+    .eq(7098).parent()
+    .each((i, el) => el.id + 7099)
+    .data[k7100]
+    .then(r => r.v7101)
+    .html(`<b>${x7102}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7104")
+    .find(".x7105")
+    [7106]
+    .css({width: 7107, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7109)
+    .eq(7110).parent()
+    .each((i, el) => el.id + 7111)
+    .data[k7112]
+    .then(r => r.v7113)
+    .html(`<b>${x7114}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7116")
+    .find(".x7117")
+    [7118]
+    .css({width: 7119, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7121)
+    .eq(7122).parent()
+    .each((i, el) => el.id + 7123)
+    .data[k7124]
+    .then(r => r.v7125)
+    .html(`<b>${x7126}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7128")
+    .find(".x7129")
+    [7130]
+    .css({width: 7131, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7133)
+    .eq(7134).parent()
+    .each((i, el) => el.id + 7135)
+    .data[k7136]
+    .then(r => r.v7137)
+    .html(`<b>${x7138}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7140")
+    .find(".x7141")
+    [7142]
+    .css({width: 7143, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7145)
+    .eq(7146).parent()
+    .each((i, el) => el.id + 7147)
+    .data[k7148]
+    .then(r => r.v7149)
+    .html(`<b>${x7150}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7152")
+    .find(".x7153")
+    [7154]
+    .css({width: 7155, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7157)
+    .eq(7158).parent()
+    .each((i, el) => el.id + 7159)
+    .data[k7160]
+    .then(r => r.v7161)
+    .html(`<b>${x7162}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7164")
+    .find(".x7165")
+    [7166]
+    .css({width: 7167, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7169)
+    .eq(7170).parent()
+    .each((i, el) => el.id + 7171)
+    .data[k7172]
+    .then(r => r.v7173)
+    .html(`<b>${x7174}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7176")
+    .find(".x7177")
+    [7178]
+    .css({width: 7179, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7181)
+    .eq(7182).parent()
+    .each((i, el) => el.id + 7183)
+    .data[k7184]
+    .then(r => r.v7185)
+    .html(`<b>${x7186}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7188")
+    .find(".x7189")
+    [7190]
+    .css({width: 7191, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7193)
+    .eq(7194).parent()
+    .each((i, el) => el.id + 7195)
+    .data[k7196]
+    .then(r => r.v7197)
+    .html(`<b>${x7198}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7200")
+    .find(".x7201")
+    [7202]
+    .css({width: 7203, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7205)
+    .eq(7206).parent()
+    .each((i, el) => el.id + 7207)
+    .data[k7208]
+    .then(r => r.v7209)
+    .html(`<b>${x7210}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7212")
+    .find(".x7213")
+    [7214]
+    .css({width: 7215, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7217)
+    .eq(7218).parent()
+    .each((i, el) => el.id + 7219)
+    .data[k7220]
+    .then(r => r.v7221)
+    .html(`<b>${x7222}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7224")
+    .find(".x7225")
+    [7226]
+    .css({width: 7227, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7229)
+    .eq(7230).parent()
+    .each((i, el) => el.id + 7231)
+    .data[k7232]
+    .then(r => r.v7233)
+    .html(`<b>${x7234}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7236")
+    .find(".x7237")
+    [7238]
+    .css({width: 7239, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7241)
+    .eq(7242).parent()
+    .each((i, el) => el.id + 7243)
+    .data[k7244]
+    .then(r => r.v7245)
+    .html(`<b>${x7246}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7248")
+    .find(".x7249")
+    [7250]
+    .css({width: 7251, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7253)
+    .eq(7254).parent()
+    .each((i, el) => el.id + 7255)
+    .data[k7256]
+    .then(r => r.v7257)
+    .html(`<b>${x7258}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7260")
+    .find(".x7261")
+    [7262]
+    .css({width: 7263, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7265)
+    .eq(7266).parent()
+    .each((i, el) => el.id + 7267)
+    .data[k7268]
+    .then(r => r.v7269)
+    .html(`<b>${x7270}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7272")
+    .find(".x7273")
+    [7274]
+    .css({width: 7275, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7277)
+    .eq(7278).parent()
+    .each((i, el) => el.id + 7279)
+    .data[k7280]
+    .then(r => r.v7281)
+    .html(`<b>${x7282}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7284")
+    .find(".x7285")
+    [7286]
+    .css({width: 7287, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7289)
+    .eq(7290).parent()
+    .each((i, el) => el.id + 7291)
+    .data[k7292]
+    .then(r => r.v7293)
+    .html(`<b>${x7294}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7296")
+    .find(".x7297")
+    [7298]
+    .css({width: 7299, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7301)
+    .eq(7302).parent()
+    .each((i, el) => el.id + 7303)
+    .data[k7304]
+    .then(r => r.v7305)
+    .html(`<b>${x7306}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7308")
+    .find(".x7309")
+    [7310]
+    .css({width: 7311, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7313)
+    .eq(7314).parent()
+    .each((i, el) => el.id + 7315)
+    .data[k7316]
+    .then(r => r.v7317)
+    .html(`<b>${x7318}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7320")
+    .find(".x7321")
+    [7322]
+    .css({width: 7323, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7325)
+    .eq(7326).parent()
+    .each((i, el) => el.id + 7327)
+    .data[k7328]
+    .then(r => r.v7329)
+    .html(`<b>${x7330}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7332")
+    .find(".x7333")
+    [7334]
+    .css({width: 7335, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7337)
+    .eq(7338).parent()
+    .each((i, el) => el.id + 7339)
+    .data[k7340]
+    .then(r => r.v7341)
+    .html(`<b>${x7342}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7344")
+    .find(".x7345")
+    [7346]
+    .css({width: 7347, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7349)
+    .eq(7350).parent()
+    .each((i, el) => el.id + 7351)
+    .data[k7352]
+    .then(r => r.v7353)
+    .html(`<b>${x7354}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7356")
+    .find(".x7357")
+    [7358]
+    .css({width: 7359, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7361)
+    .eq(7362).parent()
+    .each((i, el) => el.id + 7363)
+    .data[k7364]
+    .then(r => r.v7365)
+    .html(`<b>${x7366}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7368")
+    .find(".x7369")
+    [7370]
+    .css({width: 7371, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7373)
+    .eq(7374).parent()
+    .each((i, el) => el.id + 7375)
+    .data[k7376]
+    .then(r => r.v7377)
+    .html(`<b>${x7378}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7380")
+    .find(".x7381")
+    [7382]
+    .css({width: 7383, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7385)
+    .eq(7386).parent()
+    .each((i, el) => el.id + 7387)
+    .data[k7388]
+    .then(r => r.v7389)
+    .html(`<b>${x7390}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7392")
+    .find(".x7393")
+    [7394]
+    .css({width: 7395, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7397)
+    .eq(7398).parent()
+    .each((i, el) => el.id + 7399)
+    .data[k7400]
+    .then(r => r.v7401)
+    .html(`<b>${x7402}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7404")
+    .find(".x7405")
+    [7406]
+    .css({width: 7407, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7409)
+    .eq(7410).parent()
+    .each((i, el) => el.id + 7411)
+    .data[k7412]
+    .then(r => r.v7413)
+    .html(`<b>${x7414}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7416")
+    .find(".x7417")
+    [7418]
+    .css({width: 7419, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7421)
+    .eq(7422).parent()
+    .each((i, el) => el.id + 7423)
+    .data[k7424]
+    .then(r => r.v7425)
+    .html(`<b>${x7426}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7428")
+    .find(".x7429")
+    [7430]
+    .css({width: 7431, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7433)
+    .eq(7434).parent()
+    .each((i, el) => el.id + 7435)
+    .data[k7436]
+    .then(r => r.v7437)
+    .html(`<b>${x7438}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7440")
+    .find(".x7441")
+    [7442]
+    .css({width: 7443, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7445)
+    .eq(7446).parent()
+    .each((i, el) => el.id + 7447)
+    .data[k7448]
+    .then(r => r.v7449)
+    .html(`<b>${x7450}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7452")
+    .find(".x7453")
+    [7454]
+    .css({width: 7455, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7457)
+    .eq(7458).parent()
+    .each((i, el) => el.id + 7459)
+    .data[k7460]
+    .then(r => r.v7461)
+    .html(`<b>${x7462}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7464")
+    .find(".x7465")
+    [7466]
+    .css({width: 7467, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7469)
+    .eq(7470).parent()
+    .each((i, el) => el.id + 7471)
+    .data[k7472]
+    .then(r => r.v7473)
+    .html(`<b>${x7474}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7476")
+    .find(".x7477")
+    [7478]
+    .css({width: 7479, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7481)
+    .eq(7482).parent()
+    .each((i, el) => el.id + 7483)
+    .data[k7484]
+    .then(r => r.v7485)
+    .html(`<b>${x7486}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7488")
+    .find(".x7489")
+    [7490]
+    .css({width: 7491, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7493)
+    .eq(7494).parent()
+    .each((i, el) => el.id + 7495)
+    .data[k7496]
+    .then(r => r.v7497)
+    .html(`<b>${x7498}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7500")
+    .find(".x7501")
+    [7502]
+    .css({width: 7503, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7505)
+    .eq(7506).parent()
+    .each((i, el) => el.id + 7507)
+    .data[k7508]
+    .then(r => r.v7509)
+    .html(`<b>${x7510}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7512")
+    .find(".x7513")
+    [7514]
+    .css({width: 7515, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7517)
+    .eq(7518).parent()
+    .each((i, el) => el.id + 7519)
+    .data[k7520]
+    .then(r => r.v7521)
+    .html(`<b>${x7522}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7524")
+    .find(".x7525")
+    [7526]
+    .css({width: 7527, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7529)
+    .eq(7530).parent()
+    .each((i, el) => el.id + 7531)
+    .data[k7532]
+    .then(r => r.v7533)
+    .html(`<b>${x7534}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7536")
+    .find(".x7537")
+    [7538]
+    .css({width: 7539, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7541)
+    .eq(7542).parent()
+    .each((i, el) => el.id + 7543)
+    .data[k7544]
+    .then(r => r.v7545)
+    .html(`<b>${x7546}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7548")
+    .find(".x7549")
+    [7550]
+    .css({width: 7551, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7553)
+    .eq(7554).parent()
+    .each((i, el) => el.id + 7555)
+    .data[k7556]
+    .then(r => r.v7557)
+    .html(`<b>${x7558}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7560")
+    .find(".x7561")
+    [7562]
+    .css({width: 7563, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7565)
+    .eq(7566).parent()
+    .each((i, el) => el.id + 7567)
+    .data[k7568]
+    .then(r => r.v7569)
+    .html(`<b>${x7570}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7572")
+    .find(".x7573")
+    [7574]
+    .css({width: 7575, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7577)
+    .eq(7578).parent()
+    .each((i, el) => el.id + 7579)
+    .data[k7580]
+    .then(r => r.v7581)
+    .html(`<b>${x7582}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7584")
+    .find(".x7585")
+    [7586]
+    .css({width: 7587, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7589)
+    .eq(7590).parent()
+    .each((i, el) => el.id + 7591)
+    .data[k7592]
+    .then(r => r.v7593)
+    .html(`<b>${x7594}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7596")
+    .find(".x7597")
+    [7598]
+    .css({width: 7599, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7601)
+    .eq(7602).parent()
+    .each((i, el) => el.id + 7603)
+    .data[k7604]
+    .then(r => r.v7605)
+    .html(`<b>${x7606}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7608")
+    .find(".x7609")
+    [7610]
+    .css({width: 7611, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7613)
+    .eq(7614).parent()
+    .each((i, el) => el.id + 7615)
+    .data[k7616]
+    .then(r => r.v7617)
+    .html(`<b>${x7618}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7620")
+    .find(".x7621")
+    [7622]
+    .css({width: 7623, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7625)
+    .eq(7626).parent()
+    .each((i, el) => el.id + 7627)
+    .data[k7628]
+    .then(r => r.v7629)
+    .html(`<b>${x7630}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7632")
+    .find(".x7633")
+    [7634]
+    .css({width: 7635, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7637)
+    .eq(7638).parent()
+    .each((i, el) => el.id + 7639)
+    .data[k7640]
+    .then(r => r.v7641)
+    .html(`<b>${x7642}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7644")
+    .find(".x7645")
+    [7646]
+    .css({width: 7647, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7649)
+    .eq(7650).parent()
+    .each((i, el) => el.id + 7651)
+    .data[k7652]
+    .then(r => r.v7653)
+    .html(`<b>${x7654}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7656")
+    .find(".x7657")
+    [7658]
+    .css({width: 7659, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7661)
+    .eq(7662).parent()
+    .each((i, el) => el.id + 7663)
+    .data[k7664]
+    .then(r => r.v7665)
+    .html(`<b>${x7666}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7668")
+    .find(".x7669")
+    [7670]
+    .css({width: 7671, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7673)
+    .eq(7674).parent()
+    .each((i, el) => el.id + 7675)
+    .data[k7676]
+    .then(r => r.v7677)
+    .html(`<b>${x7678}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7680")
+    .find(".x7681")
+    [7682]
+    .css({width: 7683, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7685)
+    .eq(7686).parent()
+    .each((i, el) => el.id + 7687)
+    .data[k7688]
+    .then(r => r.v7689)
+    .html(`<b>${x7690}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7692")
+    .find(".x7693")
+    [7694]
+    .css({width: 7695, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7697)
+    .eq(7698).parent()
+    .each((i, el) => el.id + 7699)
+    .data[k7700]
+    .then(r => r.v7701)
+    .html(`<b>${x7702}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7704")
+    .find(".x7705")
+    [7706]
+    .css({width: 7707, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7709)
+    .eq(7710).parent()
+    .each((i, el) => el.id + 7711)
+    .data[k7712]
+    .then(r => r.v7713)
+    .html(`<b>${x7714}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7716")
+    .find(".x7717")
+    [7718]
+    .css({width: 7719, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7721)
+    .eq(7722).parent()
+    .each((i, el) => el.id + 7723)
+    .data[k7724]
+    .then(r => r.v7725)
+    .html(`<b>${x7726}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7728")
+    .find(".x7729")
+    [7730]
+    .css({width: 7731, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7733)
+    .eq(7734).parent()
+    .each((i, el) => el.id + 7735)
+    .data[k7736]
+    .then(r => r.v7737)
+    .html(`<b>${x7738}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7740")
+    .find(".x7741")
+    [7742]
+    .css({width: 7743, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7745)
+    .eq(7746).parent()
+    .each((i, el) => el.id + 7747)
+    .data[k7748]
+    .then(r => r.v7749)
+    .html(`<b>${x7750}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7752")
+    .find(".x7753")
+    [7754]
+    .css({width: 7755, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7757)
+    .eq(7758).parent()
+    .each((i, el) => el.id + 7759)
+    .data[k7760]
+    .then(r => r.v7761)
+    .html(`<b>${x7762}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7764")
+    .find(".x7765")
+    [7766]
+    .css({width: 7767, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7769)
+    .eq(7770).parent()
+    .each((i, el) => el.id + 7771)
+    .data[k7772]
+    .then(r => r.v7773)
+    .html(`<b>${x7774}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7776")
+    .find(".x7777")
+    [7778]
+    .css({width: 7779, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7781)
+    .eq(7782).parent()
+    .each((i, el) => el.id + 7783)
+    .data[k7784]
+    .then(r => r.v7785)
+    .html(`<b>${x7786}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7788")
+    .find(".x7789")
+    [7790]
+    .css({width: 7791, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7793)
+    .eq(7794).parent()
+    .each((i, el) => el.id + 7795)
+    .data[k7796]
+    .then(r => r.v7797)
+    .html(`<b>${x7798}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7800")
+    .find(".x7801")
+    [7802]
+    .css({width: 7803, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7805)
+    .eq(7806).parent()
+    .each((i, el) => el.id + 7807)
+    .data[k7808]
+    .then(r => r.v7809)
+    .html(`<b>${x7810}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7812")
+    .find(".x7813")
+    [7814]
+    .css({width: 7815, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7817)
+    .eq(7818).parent()
+    .each((i, el) => el.id + 7819)
+    .data[k7820]
+    .then(r => r.v7821)
+    .html(`<b>${x7822}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7824")
+    .find(".x7825")
+    [7826]
+    .css({width: 7827, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7829)
+    .eq(7830).parent()
+    .each((i, el) => el.id + 7831)
+    .data[k7832]
+    .then(r => r.v7833)
+    .html(`<b>${x7834}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7836")
+    .find(".x7837")
+    [7838]
+    .css({width: 7839, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7841)
+    .eq(7842).parent()
+    .each((i, el) => el.id + 7843)
+    .data[k7844]
+    .then(r => r.v7845)
+    .html(`<b>${x7846}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7848")
+    .find(".x7849")
+    [7850]
+    .css({width: 7851, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7853)
+    .eq(7854).parent()
+    .each((i, el) => el.id + 7855)
+    .data[k7856]
+    .then(r => r.v7857)
+    .html(`<b>${x7858}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7860")
+    .find(".x7861")
+    [7862]
+    .css({width: 7863, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7865)
+    .eq(7866).parent()
+    .each((i, el) => el.id + 7867)
+    .data[k7868]
+    .then(r => r.v7869)
+    .html(`<b>${x7870}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7872")
+    .find(".x7873")
+    [7874]
+    .css({width: 7875, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7877)
+    .eq(7878).parent()
+    .each((i, el) => el.id + 7879)
+    .data[k7880]
+    .then(r => r.v7881)
+    .html(`<b>${x7882}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7884")
+    .find(".x7885")
+    [7886]
+    .css({width: 7887, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7889)
+    .eq(7890).parent()
+    .each((i, el) => el.id + 7891)
+    .data[k7892]
+    .then(r => r.v7893)
+    .html(`<b>${x7894}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7896")
+    .find(".x7897")
+    [7898]
+    .css({width: 7899, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7901)
+    .eq(7902).parent()
+    .each((i, el) => el.id + 7903)
+    .data[k7904]
+    .then(r => r.v7905)
+    .html(`<b>${x7906}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7908")
+    .find(".x7909")
+    [7910]
+    .css({width: 7911, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7913)
+    .eq(7914).parent()
+    .each((i, el) => el.id + 7915)
+    .data[k7916]
+    .then(r => r.v7917)
+    .html(`<b>${x7918}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7920")
+    .find(".x7921")
+    [7922]
+    .css({width: 7923, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7925)
+    .eq(7926).parent()
+    .each((i, el) => el.id + 7927)
+    .data[k7928]
+    .then(r => r.v7929)
+    .html(`<b>${x7930}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7932")
+    .find(".x7933")
+    [7934]
+    .css({width: 7935, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7937)
+    .eq(7938).parent()
+    .each((i, el) => el.id + 7939)
+    .data[k7940]
+    .then(r => r.v7941)
+    .html(`<b>${x7942}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7944")
+    .find(".x7945")
+    [7946]
+    .css({width: 7947, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7949)
+    .eq(7950).parent()
+    .each((i, el) => el.id + 7951)
+    .data[k7952]
+    .then(r => r.v7953)
+    .html(`<b>${x7954}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7956")
+    .find(".x7957")
+    [7958]
+    .css({width: 7959, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7961)
+    .eq(7962).parent()
+    .each((i, el) => el.id + 7963)
+    .data[k7964]
+    .then(r => r.v7965)
+    .html(`<b>${x7966}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7968")
+    .find(".x7969")
+    [7970]
+    .css({width: 7971, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7973)
+    .eq(7974).parent()
+    .each((i, el) => el.id + 7975)
+    .data[k7976]
+    .then(r => r.v7977)
+    .html(`<b>${x7978}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7980")
+    .find(".x7981")
+    [7982]
+    .css({width: 7983, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7985)
+    .eq(7986).parent()
+    .each((i, el) => el.id + 7987)
+    .data[k7988]
+    .then(r => r.v7989)
+    .html(`<b>${x7990}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c7992")
+    .find(".x7993")
+    [7994]
+    .css({width: 7995, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v7997)
+    .eq(7998).parent()
+    .each((i, el) => el.id + 7999)
+    .data[k8000]
+    .then(r => r.v8001)
+    .html(`<b>${x8002}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8004")
+    .find(".x8005")
+    [8006]
+    .css({width: 8007, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8009)
+    .eq(8010).parent()
+    .each((i, el) => el.id + 8011)
+    .data[k8012]
+    .then(r => r.v8013)
+    .html(`<b>${x8014}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8016")
+    .find(".x8017")
+    [8018]
+    .css({width: 8019, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8021)
+    .eq(8022).parent()
+    .each((i, el) => el.id + 8023)
+    .data[k8024]
+    .then(r => r.v8025)
+    .html(`<b>${x8026}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8028")
+    .find(".x8029")
+    [8030]
+    .css({width: 8031, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8033)
+    .eq(8034).parent()
+    .each((i, el) => el.id + 8035)
+    .data[k8036]
+    .then(r => r.v8037)
+    .html(`<b>${x8038}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8040")
+    .find(".x8041")
+    [8042]
+    .css({width: 8043, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8045)
+    .eq(8046).parent()
+    .each((i, el) => el.id + 8047)
+    .data[k8048]
+    .then(r => r.v8049)
+    .html(`<b>${x8050}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8052")
+    .find(".x8053")
+    [8054]
+    .css({width: 8055, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8057)
+    .eq(8058).parent()
+    .each((i, el) => el.id + 8059)
+    .data[k8060]
+    .then(r => r.v8061)
+    .html(`<b>${x8062}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8064")
+    .find(".x8065")
+    [8066]
+    .css({width: 8067, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8069)
+    .eq(8070).parent()
+    .each((i, el) => el.id + 8071)
+    .data[k8072]
+    .then(r => r.v8073)
+    .html(`<b>${x8074}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8076")
+    .find(".x8077")
+    [8078]
+    .css({width: 8079, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8081)
+    .eq(8082).parent()
+    .each((i, el) => el.id + 8083)
+    .data[k8084]
+    .then(r => r.v8085)
+    .html(`<b>${x8086}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8088")
+    .find(".x8089")
+    [8090]
+    .css({width: 8091, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8093)
+    .eq(8094).parent()
+    .each((i, el) => el.id + 8095)
+    .data[k8096]
+    .then(r => r.v8097)
+    .html(`<b>${x8098}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8100")
+    .find(".x8101")
+    [8102]
+    .css({width: 8103, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8105)
+    .eq(8106).parent()
+    .each((i, el) => el.id + 8107)
+    .data[k8108]
+    .then(r => r.v8109)
+    .html(`<b>${x8110}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8112")
+    .find(".x8113")
+    [8114]
+    .css({width: 8115, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8117)
+    .eq(8118).parent()
+    .each((i, el) => el.id + 8119)
+    .data[k8120]
+    .then(r => r.v8121)
+    .html(`<b>${x8122}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8124")
+    .find(".x8125")
+    [8126]
+    .css({width: 8127, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8129)
+    .eq(8130).parent()
+    .each((i, el) => el.id + 8131)
+    .data[k8132]
+    .then(r => r.v8133)
+    .html(`<b>${x8134}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8136")
+    .find(".x8137")
+    [8138]
+    .css({width: 8139, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8141)
+    .eq(8142).parent()
+    .each((i, el) => el.id + 8143)
+    .data[k8144]
+    .then(r => r.v8145)
+    .html(`<b>${x8146}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8148")
+    .find(".x8149")
+    [8150]
+    .css({width: 8151, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8153)
+    .eq(8154).parent()
+    .each((i, el) => el.id + 8155)
+    .data[k8156]
+    .then(r => r.v8157)
+    .html(`<b>${x8158}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8160")
+    .find(".x8161")
+    [8162]
+    .css({width: 8163, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8165)
+    .eq(8166).parent()
+    .each((i, el) => el.id + 8167)
+    .data[k8168]
+    .then(r => r.v8169)
+    .html(`<b>${x8170}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8172")
+    .find(".x8173")
+    [8174]
+    .css({width: 8175, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8177)
+    .eq(8178).parent()
+    .each((i, el) => el.id + 8179)
+    .data[k8180]
+    .then(r => r.v8181)
+    .html(`<b>${x8182}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8184")
+    .find(".x8185")
+    [8186]
+    .css({width: 8187, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8189)
+    .eq(8190).parent()
+    .each((i, el) => el.id + 8191)
+    .data[k8192]
+    .then(r => r.v8193)
+    .html(`<b>${x8194}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8196")
+    .find(".x8197")
+    [8198]
+    .css({width: 8199, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8201)
+    .eq(8202).parent()
+    .each((i, el) => el.id + 8203)
+    .data[k8204]
+    .then(r => r.v8205)
+    .html(`<b>${x8206}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8208")
+    .find(".x8209")
+    [8210]
+    .css({width: 8211, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8213)
+    .eq(8214).parent()
+    .each((i, el) => el.id + 8215)
+    .data[k8216]
+    .then(r => r.v8217)
+    .html(`<b>${x8218}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8220")
+    .find(".x8221")
+    [8222]
+    .css({width: 8223, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8225)
+    .eq(8226).parent()
+    .each((i, el) => el.id + 8227)
+    .data[k8228]
+    .then(r => r.v8229)
+    .html(`<b>${x8230}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8232")
+    .find(".x8233")
+    [8234]
+    .css({width: 8235, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8237)
+    .eq(8238).parent()
+    .each((i, el) => el.id + 8239)
+    .data[k8240]
+    .then(r => r.v8241)
+    .html(`<b>${x8242}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8244")
+    .find(".x8245")
+    [8246]
+    .css({width: 8247, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8249)
+    .eq(8250).parent()
+    .each((i, el) => el.id + 8251)
+    .data[k8252]
+    .then(r => r.v8253)
+    .html(`<b>${x8254}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8256")
+    .find(".x8257")
+    [8258]
+    .css({width: 8259, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8261)
+    .eq(8262).parent()
+    .each((i, el) => el.id + 8263)
+    .data[k8264]
+    .then(r => r.v8265)
+    .html(`<b>${x8266}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8268")
+    .find(".x8269")
+    [8270]
+    .css({width: 8271, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8273)
+    .eq(8274).parent()
+    .each((i, el) => el.id + 8275)
+    .data[k8276]
+    .then(r => r.v8277)
+    .html(`<b>${x8278}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8280")
+    .find(".x8281")
+    [8282]
+    .css({width: 8283, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8285)
+    .eq(8286).parent()
+    .each((i, el) => el.id + 8287)
+    .data[k8288]
+    .then(r => r.v8289)
+    .html(`<b>${x8290}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8292")
+    .find(".x8293")
+    [8294]
+    .css({width: 8295, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8297)
+    .eq(8298).parent()
+    .each((i, el) => el.id + 8299)
+    .data[k8300]
+    .then(r => r.v8301)
+    .html(`<b>${x8302}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8304")
+    .find(".x8305")
+    [8306]
+    .css({width: 8307, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8309)
+    .eq(8310).parent()
+    .each((i, el) => el.id + 8311)
+    .data[k8312]
+    .then(r => r.v8313)
+    .html(`<b>${x8314}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8316")
+    .find(".x8317")
+    [8318]
+    .css({width: 8319, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8321)
+    .eq(8322).parent()
+    .each((i, el) => el.id + 8323)
+    .data[k8324]
+    .then(r => r.v8325)
+    .html(`<b>${x8326}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8328")
+    .find(".x8329")
+    [8330]
+    .css({width: 8331, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8333)
+    .eq(8334).parent()
+    .each((i, el) => el.id + 8335)
+    .data[k8336]
+    .then(r => r.v8337)
+    .html(`<b>${x8338}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8340")
+    .find(".x8341")
+    [8342]
+    .css({width: 8343, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8345)
+    .eq(8346).parent()
+    .each((i, el) => el.id + 8347)
+    .data[k8348]
+    .then(r => r.v8349)
+    .html(`<b>${x8350}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8352")
+    .find(".x8353")
+    [8354]
+    .css({width: 8355, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8357)
+    .eq(8358).parent()
+    .each((i, el) => el.id + 8359)
+    .data[k8360]
+    .then(r => r.v8361)
+    .html(`<b>${x8362}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8364")
+    .find(".x8365")
+    [8366]
+    .css({width: 8367, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8369)
+    .eq(8370).parent()
+    .each((i, el) => el.id + 8371)
+    .data[k8372]
+    .then(r => r.v8373)
+    .html(`<b>${x8374}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8376")
+    .find(".x8377")
+    [8378]
+    .css({width: 8379, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8381)
+    .eq(8382).parent()
+    .each((i, el) => el.id + 8383)
+    .data[k8384]
+    .then(r => r.v8385)
+    .html(`<b>${x8386}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8388")
+    .find(".x8389")
+    [8390]
+    .css({width: 8391, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8393)
+    .eq(8394).parent()
+    .each((i, el) => el.id + 8395)
+    .data[k8396]
+    .then(r => r.v8397)
+    .html(`<b>${x8398}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8400")
+    .find(".x8401")
+    [8402]
+    .css({width: 8403, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8405)
+    .eq(8406).parent()
+    .each((i, el) => el.id + 8407)
+    .data[k8408]
+    .then(r => r.v8409)
+    .html(`<b>${x8410}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8412")
+    .find(".x8413")
+    [8414]
+    .css({width: 8415, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8417)
+    .eq(8418).parent()
+    .each((i, el) => el.id + 8419)
+    .data[k8420]
+    .then(r => r.v8421)
+    .html(`<b>${x8422}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8424")
+    .find(".x8425")
+    [8426]
+    .css({width: 8427, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8429)
+    .eq(8430).parent()
+    .each((i, el) => el.id + 8431)
+    .data[k8432]
+    .then(r => r.v8433)
+    .html(`<b>${x8434}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8436")
+    .find(".x8437")
+    [8438]
+    .css({width: 8439, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8441)
+    .eq(8442).parent()
+    .each((i, el) => el.id + 8443)
+    .data[k8444]
+    .then(r => r.v8445)
+    .html(`<b>${x8446}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8448")
+    .find(".x8449")
+    [8450]
+    .css({width: 8451, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8453)
+    .eq(8454).parent()
+    .each((i, el) => el.id + 8455)
+    .data[k8456]
+    .then(r => r.v8457)
+    .html(`<b>${x8458}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8460")
+    .find(".x8461")
+    [8462]
+    .css({width: 8463, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8465)
+    .eq(8466).parent()
+    .each((i, el) => el.id + 8467)
+    .data[k8468]
+    .then(r => r.v8469)
+    .html(`<b>${x8470}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8472")
+    .find(".x8473")
+    [8474]
+    .css({width: 8475, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8477)
+    .eq(8478).parent()
+    .each((i, el) => el.id + 8479)
+    .data[k8480]
+    .then(r => r.v8481)
+    .html(`<b>${x8482}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8484")
+    .find(".x8485")
+    [8486]
+    .css({width: 8487, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8489)
+    .eq(8490).parent()
+    .each((i, el) => el.id + 8491)
+    .data[k8492]
+    .then(r => r.v8493)
+    .html(`<b>${x8494}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8496")
+    .find(".x8497")
+    [8498]
+    .css({width: 8499, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8501)
+    .eq(8502).parent()
+    .each((i, el) => el.id + 8503)
+    .data[k8504]
+    .then(r => r.v8505)
+    .html(`<b>${x8506}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8508")
+    .find(".x8509")
+    [8510]
+    .css({width: 8511, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8513)
+    .eq(8514).parent()
+    .each((i, el) => el.id + 8515)
+    .data[k8516]
+    .then(r => r.v8517)
+    .html(`<b>${x8518}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8520")
+    .find(".x8521")
+    [8522]
+    .css({width: 8523, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8525)
+    .eq(8526).parent()
+    .each((i, el) => el.id + 8527)
+    .data[k8528]
+    .then(r => r.v8529)
+    .html(`<b>${x8530}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8532")
+    .find(".x8533")
+    [8534]
+    .css({width: 8535, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8537)
+    .eq(8538).parent()
+    .each((i, el) => el.id + 8539)
+    .data[k8540]
+    .then(r => r.v8541)
+    .html(`<b>${x8542}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8544")
+    .find(".x8545")
+    [8546]
+    .css({width: 8547, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8549)
+    .eq(8550).parent()
+    .each((i, el) => el.id + 8551)
+    .data[k8552]
+    .then(r => r.v8553)
+    .html(`<b>${x8554}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8556")
+    .find(".x8557")
+    [8558]
+    .css({width: 8559, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8561)
+    .eq(8562).parent()
+    .each((i, el) => el.id + 8563)
+    .data[k8564]
+    .then(r => r.v8565)
+    .html(`<b>${x8566}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8568")
+    .find(".x8569")
+    [8570]
+    .css({width: 8571, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8573)
+    .eq(8574).parent()
+    .each((i, el) => el.id + 8575)
+    .data[k8576]
+    .then(r => r.v8577)
+    .html(`<b>${x8578}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8580")
+    .find(".x8581")
+    [8582]
+    .css({width: 8583, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8585)
+    .eq(8586).parent()
+    .each((i, el) => el.id + 8587)
+    .data[k8588]
+    .then(r => r.v8589)
+    .html(`<b>${x8590}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8592")
+    .find(".x8593")
+    [8594]
+    .css({width: 8595, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8597)
+    .eq(8598).parent()
+    .each((i, el) => el.id + 8599)
+    .data[k8600]
+    .then(r => r.v8601)
+    .html(`<b>${x8602}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8604")
+    .find(".x8605")
+    [8606]
+    .css({width: 8607, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8609)
+    .eq(8610).parent()
+    .each((i, el) => el.id + 8611)
+    .data[k8612]
+    .then(r => r.v8613)
+    .html(`<b>${x8614}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8616")
+    .find(".x8617")
+    [8618]
+    .css({width: 8619, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8621)
+    .eq(8622).parent()
+    .each((i, el) => el.id + 8623)
+    .data[k8624]
+    .then(r => r.v8625)
+    .html(`<b>${x8626}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8628")
+    .find(".x8629")
+    [8630]
+    .css({width: 8631, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8633)
+    .eq(8634).parent()
+    .each((i, el) => el.id + 8635)
+    .data[k8636]
+    .then(r => r.v8637)
+    .html(`<b>${x8638}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8640")
+    .find(".x8641")
+    [8642]
+    .css({width: 8643, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8645)
+    .eq(8646).parent()
+    .each((i, el) => el.id + 8647)
+    .data[k8648]
+    .then(r => r.v8649)
+    .html(`<b>${x8650}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8652")
+    .find(".x8653")
+    [8654]
+    .css({width: 8655, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8657)
+    .eq(8658).parent()
+    .each((i, el) => el.id + 8659)
+    .data[k8660]
+    .then(r => r.v8661)
+    .html(`<b>${x8662}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8664")
+    .find(".x8665")
+    [8666]
+    .css({width: 8667, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8669)
+    .eq(8670).parent()
+    .each((i, el) => el.id + 8671)
+    .data[k8672]
+    .then(r => r.v8673)
+    .html(`<b>${x8674}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8676")
+    .find(".x8677")
+    [8678]
+    .css({width: 8679, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8681)
+    .eq(8682).parent()
+    .each((i, el) => el.id + 8683)
+    .data[k8684]
+    .then(r => r.v8685)
+    .html(`<b>${x8686}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8688")
+    .find(".x8689")
+    [8690]
+    .css({width: 8691, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8693)
+    .eq(8694).parent()
+    .each((i, el) => el.id + 8695)
+    .data[k8696]
+    .then(r => r.v8697)
+    .html(`<b>${x8698}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8700")
+    .find(".x8701")
+    [8702]
+    .css({width: 8703, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8705)
+    .eq(8706).parent()
+    .each((i, el) => el.id + 8707)
+    .data[k8708]
+    .then(r => r.v8709)
+    .html(`<b>${x8710}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8712")
+    .find(".x8713")
+    [8714]
+    .css({width: 8715, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8717)
+    .eq(8718).parent()
+    .each((i, el) => el.id + 8719)
+    .data[k8720]
+    .then(r => r.v8721)
+    .html(`<b>${x8722}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8724")
+    .find(".x8725")
+    [8726]
+    .css({width: 8727, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8729)
+    .eq(8730).parent()
+    .each((i, el) => el.id + 8731)
+    .data[k8732]
+    .then(r => r.v8733)
+    .html(`<b>${x8734}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8736")
+    .find(".x8737")
+    [8738]
+    .css({width: 8739, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8741)
+    .eq(8742).parent()
+    .each((i, el) => el.id + 8743)
+    .data[k8744]
+    .then(r => r.v8745)
+    .html(`<b>${x8746}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8748")
+    .find(".x8749")
+    [8750]
+    .css({width: 8751, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8753)
+    .eq(8754).parent()
+    .each((i, el) => el.id + 8755)
+    .data[k8756]
+    .then(r => r.v8757)
+    .html(`<b>${x8758}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8760")
+    .find(".x8761")
+    [8762]
+    .css({width: 8763, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8765)
+    .eq(8766).parent()
+    .each((i, el) => el.id + 8767)
+    .data[k8768]
+    .then(r => r.v8769)
+    .html(`<b>${x8770}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8772")
+    .find(".x8773")
+    [8774]
+    .css({width: 8775, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8777)
+    .eq(8778).parent()
+    .each((i, el) => el.id + 8779)
+    .data[k8780]
+    .then(r => r.v8781)
+    .html(`<b>${x8782}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8784")
+    .find(".x8785")
+    [8786]
+    .css({width: 8787, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8789)
+    .eq(8790).parent()
+    .each((i, el) => el.id + 8791)
+    .data[k8792]
+    .then(r => r.v8793)
+    .html(`<b>${x8794}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8796")
+    .find(".x8797")
+    [8798]
+    .css({width: 8799, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8801)
+    .eq(8802).parent()
+    .each((i, el) => el.id + 8803)
+    .data[k8804]
+    .then(r => r.v8805)
+    .html(`<b>${x8806}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8808")
+    .find(".x8809")
+    [8810]
+    .css({width: 8811, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8813)
+    .eq(8814).parent()
+    .each((i, el) => el.id + 8815)
+    .data[k8816]
+    .then(r => r.v8817)
+    .html(`<b>${x8818}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8820")
+    .find(".x8821")
+    [8822]
+    .css({width: 8823, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8825)
+    .eq(8826).parent()
+    .each((i, el) => el.id + 8827)
+    .data[k8828]
+    .then(r => r.v8829)
+    .html(`<b>${x8830}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8832")
+    .find(".x8833")
+    [8834]
+    .css({width: 8835, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8837)
+    .eq(8838).parent()
+    .each((i, el) => el.id + 8839)
+    .data[k8840]
+    .then(r => r.v8841)
+    .html(`<b>${x8842}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8844")
+    .find(".x8845")
+    [8846]
+    .css({width: 8847, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8849)
+    .eq(8850).parent()
+    .each((i, el) => el.id + 8851)
+    .data[k8852]
+    .then(r => r.v8853)
+    .html(`<b>${x8854}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8856")
+    .find(".x8857")
+    [8858]
+    .css({width: 8859, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8861)
+    .eq(8862).parent()
+    .each((i, el) => el.id + 8863)
+    .data[k8864]
+    .then(r => r.v8865)
+    .html(`<b>${x8866}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8868")
+    .find(".x8869")
+    [8870]
+    .css({width: 8871, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8873)
+    .eq(8874).parent()
+    .each((i, el) => el.id + 8875)
+    .data[k8876]
+    .then(r => r.v8877)
+    .html(`<b>${x8878}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8880")
+    .find(".x8881")
+    [8882]
+    .css({width: 8883, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8885)
+    .eq(8886).parent()
+    .each((i, el) => el.id + 8887)
+    .data[k8888]
+    .then(r => r.v8889)
+    .html(`<b>${x8890}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8892")
+    .find(".x8893")
+    [8894]
+    .css({width: 8895, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8897)
+    .eq(8898).parent()
+    .each((i, el) => el.id + 8899)
+    .data[k8900]
+    .then(r => r.v8901)
+    .html(`<b>${x8902}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8904")
+    .find(".x8905")
+    [8906]
+    .css({width: 8907, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8909)
+    .eq(8910).parent()
+    .each((i, el) => el.id + 8911)
+    .data[k8912]
+    .then(r => r.v8913)
+    .html(`<b>${x8914}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8916")
+    .find(".x8917")
+    [8918]
+    .css({width: 8919, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8921)
+    .eq(8922).parent()
+    .each((i, el) => el.id + 8923)
+    .data[k8924]
+    .then(r => r.v8925)
+    .html(`<b>${x8926}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8928")
+    .find(".x8929")
+    [8930]
+    .css({width: 8931, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8933)
+    .eq(8934).parent()
+    .each((i, el) => el.id + 8935)
+    .data[k8936]
+    .then(r => r.v8937)
+    .html(`<b>${x8938}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8940")
+    .find(".x8941")
+    [8942]
+    .css({width: 8943, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8945)
+    .eq(8946).parent()
+    .each((i, el) => el.id + 8947)
+    .data[k8948]
+    .then(r => r.v8949)
+    .html(`<b>${x8950}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8952")
+    .find(".x8953")
+    [8954]
+    .css({width: 8955, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8957)
+    .eq(8958).parent()
+    .each((i, el) => el.id + 8959)
+    .data[k8960]
+    .then(r => r.v8961)
+    .html(`<b>${x8962}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8964")
+    .find(".x8965")
+    [8966]
+    .css({width: 8967, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8969)
+    .eq(8970).parent()
+    .each((i, el) => el.id + 8971)
+    .data[k8972]
+    .then(r => r.v8973)
+    .html(`<b>${x8974}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8976")
+    .find(".x8977")
+    [8978]
+    .css({width: 8979, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8981)
+    .eq(8982).parent()
+    .each((i, el) => el.id + 8983)
+    .data[k8984]
+    .then(r => r.v8985)
+    .html(`<b>${x8986}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c8988")
+    .find(".x8989")
+    [8990]
+    .css({width: 8991, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v8993)
+    .eq(8994).parent()
+    .each((i, el) => el.id + 8995)
+    .data[k8996]
+    .then(r => r.v8997)
+    .html(`<b>${x8998}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9000")
+    .find(".x9001")
+    [9002]
+    .css({width: 9003, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9005)
+    .eq(9006).parent()
+    .each((i, el) => el.id + 9007)
+    .data[k9008]
+    .then(r => r.v9009)
+    .html(`<b>${x9010}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9012")
+    .find(".x9013")
+    [9014]
+    .css({width: 9015, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9017)
+    .eq(9018).parent()
+    .each((i, el) => el.id + 9019)
+    .data[k9020]
+    .then(r => r.v9021)
+    .html(`<b>${x9022}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9024")
+    .find(".x9025")
+    [9026]
+    .css({width: 9027, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9029)
+    .eq(9030).parent()
+    .each((i, el) => el.id + 9031)
+    .data[k9032]
+    .then(r => r.v9033)
+    .html(`<b>${x9034}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9036")
+    .find(".x9037")
+    [9038]
+    .css({width: 9039, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9041)
+    .eq(9042).parent()
+    .each((i, el) => el.id + 9043)
+    .data[k9044]
+    .then(r => r.v9045)
+    .html(`<b>${x9046}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9048")
+    .find(".x9049")
+    [9050]
+    .css({width: 9051, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9053)
+    .eq(9054).parent()
+    .each((i, el) => el.id + 9055)
+    .data[k9056]
+    .then(r => r.v9057)
+    .html(`<b>${x9058}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9060")
+    .find(".x9061")
+    [9062]
+    .css({width: 9063, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9065)
+    .eq(9066).parent()
+    .each((i, el) => el.id + 9067)
+    .data[k9068]
+    .then(r => r.v9069)
+    .html(`<b>${x9070}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9072")
+    .find(".x9073")
+    [9074]
+    .css({width: 9075, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9077)
+    .eq(9078).parent()
+    .each((i, el) => el.id + 9079)
+    .data[k9080]
+    .then(r => r.v9081)
+    .html(`<b>${x9082}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9084")
+    .find(".x9085")
+    [9086]
+    .css({width: 9087, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9089)
+    .eq(9090).parent()
+    .each((i, el) => el.id + 9091)
+    .data[k9092]
+    .then(r => r.v9093)
+    .html(`<b>${x9094}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9096")
+    .find(".x9097")
+    [9098]
+    .css({width: 9099, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9101)
+    .eq(9102).parent()
+    .each((i, el) => el.id + 9103)
+    .data[k9104]
+    .then(r => r.v9105)
+    .html(`<b>${x9106}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9108")
+    .find(".x9109")
+    [9110]
+    .css({width: 9111, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9113)
+    .eq(9114).parent()
+    .each((i, el) => el.id + 9115)
+    .data[k9116]
+    .then(r => r.v9117)
+    .html(`<b>${x9118}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9120")
+    .find(".x9121")
+    [9122]
+    .css({width: 9123, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9125)
+    .eq(9126).parent()
+    .each((i, el) => el.id + 9127)
+    .data[k9128]
+    .then(r => r.v9129)
+    .html(`<b>${x9130}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9132")
+    .find(".x9133")
+    [9134]
+    .css({width: 9135, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9137)
+    .eq(9138).parent()
+    .each((i, el) => el.id + 9139)
+    .data[k9140]
+    .then(r => r.v9141)
+    .html(`<b>${x9142}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9144")
+    .find(".x9145")
+    [9146]
+    .css({width: 9147, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9149)
+    .eq(9150).parent()
+    .each((i, el) => el.id + 9151)
+    .data[k9152]
+    .then(r => r.v9153)
+    .html(`<b>${x9154}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9156")
+    .find(".x9157")
+    [9158]
+    .css({width: 9159, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9161)
+    .eq(9162).parent()
+    .each((i, el) => el.id + 9163)
+    .data[k9164]
+    .then(r => r.v9165)
+    .html(`<b>${x9166}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9168")
+    .find(".x9169")
+    [9170]
+    .css({width: 9171, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9173)
+    .eq(9174).parent()
+    .each((i, el) => el.id + 9175)
+    .data[k9176]
+    .then(r => r.v9177)
+    .html(`<b>${x9178}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9180")
+    .find(".x9181")
+    [9182]
+    .css({width: 9183, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9185)
+    .eq(9186).parent()
+    .each((i, el) => el.id + 9187)
+    .data[k9188]
+    .then(r => r.v9189)
+    .html(`<b>${x9190}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9192")
+    .find(".x9193")
+    [9194]
+    .css({width: 9195, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9197)
+    .eq(9198).parent()
+    .each((i, el) => el.id + 9199)
+    .data[k9200]
+    .then(r => r.v9201)
+    .html(`<b>${x9202}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9204")
+    .find(".x9205")
+    [9206]
+    .css({width: 9207, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9209)
+    .eq(9210).parent()
+    .each((i, el) => el.id + 9211)
+    .data[k9212]
+    .then(r => r.v9213)
+    .html(`<b>${x9214}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9216")
+    .find(".x9217")
+    [9218]
+    .css({width: 9219, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9221)
+    .eq(9222).parent()
+    .each((i, el) => el.id + 9223)
+    .data[k9224]
+    .then(r => r.v9225)
+    .html(`<b>${x9226}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9228")
+    .find(".x9229")
+    [9230]
+    .css({width: 9231, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9233)
+    .eq(9234).parent()
+    .each((i, el) => el.id + 9235)
+    .data[k9236]
+    .then(r => r.v9237)
+    .html(`<b>${x9238}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9240")
+    .find(".x9241")
+    [9242]
+    .css({width: 9243, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9245)
+    .eq(9246).parent()
+    .each((i, el) => el.id + 9247)
+    .data[k9248]
+    .then(r => r.v9249)
+    .html(`<b>${x9250}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9252")
+    .find(".x9253")
+    [9254]
+    .css({width: 9255, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9257)
+    .eq(9258).parent()
+    .each((i, el) => el.id + 9259)
+    .data[k9260]
+    .then(r => r.v9261)
+    .html(`<b>${x9262}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9264")
+    .find(".x9265")
+    [9266]
+    .css({width: 9267, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9269)
+    .eq(9270).parent()
+    .each((i, el) => el.id + 9271)
+    .data[k9272]
+    .then(r => r.v9273)
+    .html(`<b>${x9274}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9276")
+    .find(".x9277")
+    [9278]
+    .css({width: 9279, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9281)
+    .eq(9282).parent()
+    .each((i, el) => el.id + 9283)
+    .data[k9284]
+    .then(r => r.v9285)
+    .html(`<b>${x9286}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9288")
+    .find(".x9289")
+    [9290]
+    .css({width: 9291, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9293)
+    .eq(9294).parent()
+    .each((i, el) => el.id + 9295)
+    .data[k9296]
+    .then(r => r.v9297)
+    .html(`<b>${x9298}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9300")
+    .find(".x9301")
+    [9302]
+    .css({width: 9303, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9305)
+    .eq(9306).parent()
+    .each((i, el) => el.id + 9307)
+    .data[k9308]
+    .then(r => r.v9309)
+    .html(`<b>${x9310}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9312")
+    .find(".x9313")
+    [9314]
+    .css({width: 9315, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9317)
+    .eq(9318).parent()
+    .each((i, el) => el.id + 9319)
+    .data[k9320]
+    .then(r => r.v9321)
+    .html(`<b>${x9322}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9324")
+    .find(".x9325")
+    [9326]
+    .css({width: 9327, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9329)
+    .eq(9330).parent()
+    .each((i, el) => el.id + 9331)
+    .data[k9332]
+    .then(r => r.v9333)
+    .html(`<b>${x9334}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9336")
+    .find(".x9337")
+    [9338]
+    .css({width: 9339, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9341)
+    .eq(9342).parent()
+    .each((i, el) => el.id + 9343)
+    .data[k9344]
+    .then(r => r.v9345)
+    .html(`<b>${x9346}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9348")
+    .find(".x9349")
+    [9350]
+    .css({width: 9351, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9353)
+    .eq(9354).parent()
+    .each((i, el) => el.id + 9355)
+    .data[k9356]
+    .then(r => r.v9357)
+    .html(`<b>${x9358}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9360")
+    .find(".x9361")
+    [9362]
+    .css({width: 9363, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9365)
+    .eq(9366).parent()
+    .each((i, el) => el.id + 9367)
+    .data[k9368]
+    .then(r => r.v9369)
+    .html(`<b>${x9370}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9372")
+    .find(".x9373")
+    [9374]
+    .css({width: 9375, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9377)
+    .eq(9378).parent()
+    .each((i, el) => el.id + 9379)
+    .data[k9380]
+    .then(r => r.v9381)
+    .html(`<b>${x9382}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9384")
+    .find(".x9385")
+    [9386]
+    .css({width: 9387, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9389)
+    .eq(9390).parent()
+    .each((i, el) => el.id + 9391)
+    .data[k9392]
+    .then(r => r.v9393)
+    .html(`<b>${x9394}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9396")
+    .find(".x9397")
+    [9398]
+    .css({width: 9399, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9401)
+    .eq(9402).parent()
+    .each((i, el) => el.id + 9403)
+    .data[k9404]
+    .then(r => r.v9405)
+    .html(`<b>${x9406}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9408")
+    .find(".x9409")
+    [9410]
+    .css({width: 9411, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9413)
+    .eq(9414).parent()
+    .each((i, el) => el.id + 9415)
+    .data[k9416]
+    .then(r => r.v9417)
+    .html(`<b>${x9418}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9420")
+    .find(".x9421")
+    [9422]
+    .css({width: 9423, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9425)
+    .eq(9426).parent()
+    .each((i, el) => el.id + 9427)
+    .data[k9428]
+    .then(r => r.v9429)
+    .html(`<b>${x9430}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9432")
+    .find(".x9433")
+    [9434]
+    .css({width: 9435, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9437)
+    .eq(9438).parent()
+    .each((i, el) => el.id + 9439)
+    .data[k9440]
+    .then(r => r.v9441)
+    .html(`<b>${x9442}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9444")
+    .find(".x9445")
+    [9446]
+    .css({width: 9447, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9449)
+    .eq(9450).parent()
+    .each((i, el) => el.id + 9451)
+    .data[k9452]
+    .then(r => r.v9453)
+    .html(`<b>${x9454}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9456")
+    .find(".x9457")
+    [9458]
+    .css({width: 9459, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9461)
+    .eq(9462).parent()
+    .each((i, el) => el.id + 9463)
+    .data[k9464]
+    .then(r => r.v9465)
+    .html(`<b>${x9466}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9468")
+    .find(".x9469")
+    [9470]
+    .css({width: 9471, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9473)
+    .eq(9474).parent()
+    .each((i, el) => el.id + 9475)
+    .data[k9476]
+    .then(r => r.v9477)
+    .html(`<b>${x9478}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9480")
+    .find(".x9481")
+    [9482]
+    .css({width: 9483, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9485)
+    .eq(9486).parent()
+    .each((i, el) => el.id + 9487)
+    .data[k9488]
+    .then(r => r.v9489)
+    .html(`<b>${x9490}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9492")
+    .find(".x9493")
+    [9494]
+    .css({width: 9495, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9497)
+    .eq(9498).parent()
+    .each((i, el) => el.id + 9499)
+    .data[k9500]
+    .then(r => r.v9501)
+    .html(`<b>${x9502}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9504")
+    .find(".x9505")
+    [9506]
+    .css({width: 9507, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9509)
+    .eq(9510).parent()
+    .each((i, el) => el.id + 9511)
+    .data[k9512]
+    .then(r => r.v9513)
+    .html(`<b>${x9514}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9516")
+    .find(".x9517")
+    [9518]
+    .css({width: 9519, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9521)
+    .eq(9522).parent()
+    .each((i, el) => el.id + 9523)
+    .data[k9524]
+    .then(r => r.v9525)
+    .html(`<b>${x9526}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9528")
+    .find(".x9529")
+    [9530]
+    .css({width: 9531, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9533)
+    .eq(9534).parent()
+    .each((i, el) => el.id + 9535)
+    .data[k9536]
+    .then(r => r.v9537)
+    .html(`<b>${x9538}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9540")
+    .find(".x9541")
+    [9542]
+    .css({width: 9543, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9545)
+    .eq(9546).parent()
+    .each((i, el) => el.id + 9547)
+    .data[k9548]
+    .then(r => r.v9549)
+    .html(`<b>${x9550}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9552")
+    .find(".x9553")
+    [9554]
+    .css({width: 9555, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9557)
+    .eq(9558).parent()
+    .each((i, el) => el.id + 9559)
+    .data[k9560]
+    .then(r => r.v9561)
+    .html(`<b>${x9562}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9564")
+    .find(".x9565")
+    [9566]
+    .css({width: 9567, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9569)
+    .eq(9570).parent()
+    .each((i, el) => el.id + 9571)
+    .data[k9572]
+    .then(r => r.v9573)
+    .html(`<b>${x9574}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9576")
+    .find(".x9577")
+    [9578]
+    .css({width: 9579, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9581)
+    .eq(9582).parent()
+    .each((i, el) => el.id + 9583)
+    .data[k9584]
+    .then(r => r.v9585)
+    .html(`<b>${x9586}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9588")
+    .find(".x9589")
+    [9590]
+    .css({width: 9591, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9593)
+    .eq(9594).parent()
+    .each((i, el) => el.id + 9595)
+    .data[k9596]
+    .then(r => r.v9597)
+    .html(`<b>${x9598}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9600")
+    .find(".x9601")
+    [9602]
+    .css({width: 9603, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9605)
+    .eq(9606).parent()
+    .each((i, el) => el.id + 9607)
+    .data[k9608]
+    .then(r => r.v9609)
+    .html(`<b>${x9610}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9612")
+    .find(".x9613")
+    [9614]
+    .css({width: 9615, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9617)
+    .eq(9618).parent()
+    .each((i, el) => el.id + 9619)
+    .data[k9620]
+    .then(r => r.v9621)
+    .html(`<b>${x9622}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9624")
+    .find(".x9625")
+    [9626]
+    .css({width: 9627, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9629)
+    .eq(9630).parent()
+    .each((i, el) => el.id + 9631)
+    .data[k9632]
+    .then(r => r.v9633)
+    .html(`<b>${x9634}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9636")
+    .find(".x9637")
+    [9638]
+    .css({width: 9639, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9641)
+    .eq(9642).parent()
+    .each((i, el) => el.id + 9643)
+    .data[k9644]
+    .then(r => r.v9645)
+    .html(`<b>${x9646}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9648")
+    .find(".x9649")
+    [9650]
+    .css({width: 9651, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9653)
+    .eq(9654).parent()
+    .each((i, el) => el.id + 9655)
+    .data[k9656]
+    .then(r => r.v9657)
+    .html(`<b>${x9658}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9660")
+    .find(".x9661")
+    [9662]
+    .css({width: 9663, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9665)
+    .eq(9666).parent()
+    .each((i, el) => el.id + 9667)
+    .data[k9668]
+    .then(r => r.v9669)
+    .html(`<b>${x9670}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9672")
+    .find(".x9673")
+    [9674]
+    .css({width: 9675, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9677)
+    .eq(9678).parent()
+    .each((i, el) => el.id + 9679)
+    .data[k9680]
+    .then(r => r.v9681)
+    .html(`<b>${x9682}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9684")
+    .find(".x9685")
+    [9686]
+    .css({width: 9687, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9689)
+    .eq(9690).parent()
+    .each((i, el) => el.id + 9691)
+    .data[k9692]
+    .then(r => r.v9693)
+    .html(`<b>${x9694}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9696")
+    .find(".x9697")
+    [9698]
+    .css({width: 9699, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9701)
+    .eq(9702).parent()
+    .each((i, el) => el.id + 9703)
+    .data[k9704]
+    .then(r => r.v9705)
+    .html(`<b>${x9706}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9708")
+    .find(".x9709")
+    [9710]
+    .css({width: 9711, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9713)
+    .eq(9714).parent()
+    .each((i, el) => el.id + 9715)
+    .data[k9716]
+    .then(r => r.v9717)
+    .html(`<b>${x9718}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9720")
+    .find(".x9721")
+    [9722]
+    .css({width: 9723, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9725)
+    .eq(9726).parent()
+    .each((i, el) => el.id + 9727)
+    .data[k9728]
+    .then(r => r.v9729)
+    .html(`<b>${x9730}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9732")
+    .find(".x9733")
+    [9734]
+    .css({width: 9735, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9737)
+    .eq(9738).parent()
+    .each((i, el) => el.id + 9739)
+    .data[k9740]
+    .then(r => r.v9741)
+    .html(`<b>${x9742}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9744")
+    .find(".x9745")
+    [9746]
+    .css({width: 9747, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9749)
+    .eq(9750).parent()
+    .each((i, el) => el.id + 9751)
+    .data[k9752]
+    .then(r => r.v9753)
+    .html(`<b>${x9754}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9756")
+    .find(".x9757")
+    [9758]
+    .css({width: 9759, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9761)
+    .eq(9762).parent()
+    .each((i, el) => el.id + 9763)
+    .data[k9764]
+    .then(r => r.v9765)
+    .html(`<b>${x9766}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9768")
+    .find(".x9769")
+    [9770]
+    .css({width: 9771, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9773)
+    .eq(9774).parent()
+    .each((i, el) => el.id + 9775)
+    .data[k9776]
+    .then(r => r.v9777)
+    .html(`<b>${x9778}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9780")
+    .find(".x9781")
+    [9782]
+    .css({width: 9783, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9785)
+    .eq(9786).parent()
+    .each((i, el) => el.id + 9787)
+    .data[k9788]
+    .then(r => r.v9789)
+    .html(`<b>${x9790}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9792")
+    .find(".x9793")
+    [9794]
+    .css({width: 9795, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9797)
+    .eq(9798).parent()
+    .each((i, el) => el.id + 9799)
+    .data[k9800]
+    .then(r => r.v9801)
+    .html(`<b>${x9802}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9804")
+    .find(".x9805")
+    [9806]
+    .css({width: 9807, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9809)
+    .eq(9810).parent()
+    .each((i, el) => el.id + 9811)
+    .data[k9812]
+    .then(r => r.v9813)
+    .html(`<b>${x9814}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9816")
+    .find(".x9817")
+    [9818]
+    .css({width: 9819, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9821)
+    .eq(9822).parent()
+    .each((i, el) => el.id + 9823)
+    .data[k9824]
+    .then(r => r.v9825)
+    .html(`<b>${x9826}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9828")
+    .find(".x9829")
+    [9830]
+    .css({width: 9831, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9833)
+    .eq(9834).parent()
+    .each((i, el) => el.id + 9835)
+    .data[k9836]
+    .then(r => r.v9837)
+    .html(`<b>${x9838}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9840")
+    .find(".x9841")
+    [9842]
+    .css({width: 9843, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9845)
+    .eq(9846).parent()
+    .each((i, el) => el.id + 9847)
+    .data[k9848]
+    .then(r => r.v9849)
+    .html(`<b>${x9850}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9852")
+    .find(".x9853")
+    [9854]
+    .css({width: 9855, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9857)
+    .eq(9858).parent()
+    .each((i, el) => el.id + 9859)
+    .data[k9860]
+    .then(r => r.v9861)
+    .html(`<b>${x9862}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9864")
+    .find(".x9865")
+    [9866]
+    .css({width: 9867, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9869)
+    .eq(9870).parent()
+    .each((i, el) => el.id + 9871)
+    .data[k9872]
+    .then(r => r.v9873)
+    .html(`<b>${x9874}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9876")
+    .find(".x9877")
+    [9878]
+    .css({width: 9879, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9881)
+    .eq(9882).parent()
+    .each((i, el) => el.id + 9883)
+    .data[k9884]
+    .then(r => r.v9885)
+    .html(`<b>${x9886}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9888")
+    .find(".x9889")
+    [9890]
+    .css({width: 9891, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9893)
+    .eq(9894).parent()
+    .each((i, el) => el.id + 9895)
+    .data[k9896]
+    .then(r => r.v9897)
+    .html(`<b>${x9898}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9900")
+    .find(".x9901")
+    [9902]
+    .css({width: 9903, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9905)
+    .eq(9906).parent()
+    .each((i, el) => el.id + 9907)
+    .data[k9908]
+    .then(r => r.v9909)
+    .html(`<b>${x9910}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9912")
+    .find(".x9913")
+    [9914]
+    .css({width: 9915, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9917)
+    .eq(9918).parent()
+    .each((i, el) => el.id + 9919)
+    .data[k9920]
+    .then(r => r.v9921)
+    .html(`<b>${x9922}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9924")
+    .find(".x9925")
+    [9926]
+    .css({width: 9927, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9929)
+    .eq(9930).parent()
+    .each((i, el) => el.id + 9931)
+    .data[k9932]
+    .then(r => r.v9933)
+    .html(`<b>${x9934}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9936")
+    .find(".x9937")
+    [9938]
+    .css({width: 9939, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9941)
+    .eq(9942).parent()
+    .each((i, el) => el.id + 9943)
+    .data[k9944]
+    .then(r => r.v9945)
+    .html(`<b>${x9946}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9948")
+    .find(".x9949")
+    [9950]
+    .css({width: 9951, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9953)
+    .eq(9954).parent()
+    .each((i, el) => el.id + 9955)
+    .data[k9956]
+    .then(r => r.v9957)
+    .html(`<b>${x9958}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9960")
+    .find(".x9961")
+    [9962]
+    .css({width: 9963, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9965)
+    .eq(9966).parent()
+    .each((i, el) => el.id + 9967)
+    .data[k9968]
+    .then(r => r.v9969)
+    .html(`<b>${x9970}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9972")
+    .find(".x9973")
+    [9974]
+    .css({width: 9975, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9977)
+    .eq(9978).parent()
+    .each((i, el) => el.id + 9979)
+    .data[k9980]
+    .then(r => r.v9981)
+    .html(`<b>${x9982}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9984")
+    .find(".x9985")
+    [9986]
+    .css({width: 9987, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v9989)
+    .eq(9990).parent()
+    .each((i, el) => el.id + 9991)
+    .data[k9992]
+    .then(r => r.v9993)
+    .html(`<b>${x9994}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c9996")
+    .find(".x9997")
+    [9998]
+    .css({width: 9999, height: 2});
@@ -0,0 +1,301 @@
+$("#root")
+    .addClass("c0")
+    .find(".x1")
+    [2]
+    .css({width: 3, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v5)
+    .eq(6).parent()
+    .each((i, el) => el.id + 7)
+    .data[k8]
+    .then(r => r.v9)
+    .html(`<b>${x10}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c12")
+    .find(".x13")
+    [14]
+    .css({width: 15, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v17)
+    .eq(18).parent()
+    .each((i, el) => el.id + 19)
+    .data[k20]
+    .then(r => r.v21)
+    .html(`<b>${x22}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c24")
+    .find(".x25")
+    [26]
+    .css({width: 27, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v29)
+    .eq(30).parent()
+    .each((i, el) => el.id + 31)
+    .data[k32]
+    .then(r => r.v33)
+    .html(`<b>${x34}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c36")
+    .find(".x37")
+    [38]
+    .css({width: 39, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v41)
+    .eq(42).parent()
+    .each((i, el) => el.id + 43)
+    .data[k44]
+    .then(r => r.v45)
+    .html(`<b>${x46}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c48")
+    .find(".x49")
+    [50]
+    .css({width: 51, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v53)
+    .eq(54).parent()
+    .each((i, el) => el.id + 55)
+    .data[k56]
+    .then(r => r.v57)
+    .html(`<b>${x58}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c60")
+    .find(".x61")
+    [62]
+    .css({width: 63, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v65)
+    .eq(66).parent()
+    .each((i, el) => el.id + 67)
+    .data[k68]
+    .then(r => r.v69)
+    .html(`<b>${x70}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c72")
+    .find(".x73")
+    [74]
+    .css({width: 75, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v77)
+    .eq(78).parent()
+    .each((i, el) => el.id + 79)
+    .data[k80]
+    .then(r => r.v81)
+    .html(`<b>${x82}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c84")
+    .find(".x85")
+    [86]
+    .css({width: 87, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v89)
+    .eq(90).parent()
+    .each((i, el) => el.id + 91)
+    .data[k92]
+    .then(r => r.v93)
+    .html(`<b>${x94}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c96")
+    .find(".x97")
+    [98]
+    .css({width: 99, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v101)
+    .eq(102).parent()
+    .each((i, el) => el.id + 103)
+    .data[k104]
+    .then(r => r.v105)
+    .html(`<b>${x106}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c108")
+    .find(".x109")
+    [110]
+    .css({width: 111, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v113)
+    .eq(114).parent()
+    .each((i, el) => el.id + 115)
+    .data[k116]
+    .then(r => r.v117)
+    .html(`<b>${x118}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c120")
+    .find(".x121")
+    [122]
+    .css({width: 123, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v125)
+    .eq(126).parent()
+    .each((i, el) => el.id + 127)
+    .data[k128]
+    .then(r => r.v129)
+    .html(`<b>${x130}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c132")
+    .find(".x133")
+    [134]
+    .css({width: 135, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v137)
+    .eq(138).parent()
+    .each((i, el) => el.id + 139)
+    .data[k140]
+    .then(r => r.v141)
+    .html(`<b>${x142}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c144")
+    .find(".x145")
+    [146]
+    .css({width: 147, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v149)
+    .eq(150).parent()
+    .each((i, el) => el.id + 151)
+    .data[k152]
+    .then(r => r.v153)
+    .html(`<b>${x154}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c156")
+    .find(".x157")
+    [158]
+    .css({width: 159, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v161)
+    .eq(162).parent()
+    .each((i, el) => el.id + 163)
+    .data[k164]
+    .then(r => r.v165)
+    .html(`<b>${x166}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c168")
+    .find(".x169")
+    [170]
+    .css({width: 171, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v173)
+    .eq(174).parent()
+    .each((i, el) => el.id + 175)
+    .data[k176]
+    .then(r => r.v177)
+    .html(`<b>${x178}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c180")
+    .find(".x181")
+    [182]
+    .css({width: 183, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v185)
+    .eq(186).parent()
+    .each((i, el) => el.id + 187)
+    .data[k188]
+    .then(r => r.v189)
+    .html(`<b>${x190}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c192")
+    .find(".x193")
+    [194]
+    .css({width: 195, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v197)
+    .eq(198).parent()
+    .each((i, el) => el.id + 199)
+    .data[k200]
+    .then(r => r.v201)
+    .html(`<b>${x202}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c204")
+    .find(".x205")
+    [206]
+    .css({width: 207, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v209)
+    .eq(210).parent()
+    .each((i, el) => el.id + 211)
+    .data[k212]
+    .then(r => r.v213)
+    .html(`<b>${x214}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c216")
+    .find(".x217")
+    [218]
+    .css({width: 219, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v221)
+    .eq(222).parent()
+    .each((i, el) => el.id + 223)
+    .data[k224]
+    .then(r => r.v225)
+    .html(`<b>${x226}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c228")
+    .find(".x229")
+    [230]
+    .css({width: 231, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v233)
+    .eq(234).parent()
+    .each((i, el) => el.id + 235)
+    .data[k236]
+    .then(r => r.v237)
+    .html(`<b>${x238}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c240")
+    .find(".x241")
+    [242]
+    .css({width: 243, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v245)
+    .eq(246).parent()
+    .each((i, el) => el.id + 247)
+    .data[k248]
+    .then(r => r.v249)
+    .html(`<b>${x250}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c252")
+    .find(".x253")
+    [254]
+    .css({width: 255, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v257)
+    .eq(258).parent()
+    .each((i, el) => el.id + 259)
+    .data[k260]
+    .then(r => r.v261)
+    .html(`<b>${x262}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c264")
+    .find(".x265")
+    [266]
+    .css({width: 267, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v269)
+    .eq(270).parent()
+    .each((i, el) => el.id + 271)
+    .data[k272]
+    .then(r => r.v273)
+    .html(`<b>${x274}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c276")
+    .find(".x277")
+    [278]
+    .css({width: 279, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v281)
+    .eq(282).parent()
+    .each((i, el) => el.id + 283)
+    .data[k284]
+    .then(r => r.v285)
+    .html(`<b>${x286}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c })
+    .addClass("c288")
+    .find(".x289")
+    [290]
+    .css({width: 291, height: 2})
+    .on("click", function (e) { return e.target; })
+    .attr("k", v293)
+    .eq(294).parent()
+    .each((i, el) => el.id + 295)
+    .data[k296]
+    .then(r => r.v297)
+    .html(`<b>${x298}</b>`)
+    .filter({ get a() { return 1; }, b() {}, c });
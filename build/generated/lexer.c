@@ -0,0 +1,1060 @@
+
+#include <regex.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+typedef struct { char kind; const char *pat; int compiled; regex_t re; } fake_rule;
+static int fake_cond_ok(const char *list, const char *cond) {
+    if (!list || !cond) return 1;
+    size_t n = strlen(cond);
+    const char *p = list;
+    while (*p) {
+        const char *e = strchr(p, ',');
+        size_t len = e ? (size_t)(e - p) : strlen(p);
+        if ((len == 1 && *p == '*') || (len == n && strncmp(p, cond, n) == 0)) return 1;
+        if (!e) break;
+        p = e + 1;
+    }
+    return 0;
+}
+static int fake_match(fake_rule *rules, int count, const char *cur, const char *lim, const char **rc, const char *cond, size_t *out_len) {
+    static __thread const char *s_base = NULL, *s_end = NULL;
+    if (lim) {
+        s_base = cur;
+        s_end = lim;
+    } else if (!s_end || cur < s_base || cur > s_end || *s_end != '\0') {
+        s_base = cur;
+        s_end = cur + strlen(cur);
+    }
+    int best = -1; size_t best_len = 0; int deflt = -1;
+    for (int i = 0; i < count; ++i) {
+        if (rc && !fake_cond_ok(rc[i], cond)) continue;
+        fake_rule *r = &rules[i];
+        if (r->kind == 'D') { if (deflt < 0) deflt = i; continue; }
+        if (r->kind == 'N') {
+            if (*cur == '\0' && best_len < 1) { best = i; best_len = 1; }
+            continue;
+        }
+        if (!r->pat) continue;
+        if (!__atomic_load_n(&r->compiled, __ATOMIC_ACQUIRE)) {
+            static pthread_mutex_t fk_mu = PTHREAD_MUTEX_INITIALIZER;
+            pthread_mutex_lock(&fk_mu);
+            if (!r->compiled) {
+                int rc2 = regcomp(&r->re, r->pat, REG_EXTENDED);
+                if (rc2) { fprintf(stderr, "fakere2c: bad regex %s\n", r->pat); abort(); }
+                __atomic_store_n(&r->compiled, 1, __ATOMIC_RELEASE);
+            }
+            pthread_mutex_unlock(&fk_mu);
+        }
+        regmatch_t m[1];
+        m[0].rm_so = 0; m[0].rm_eo = s_end - cur;
+        if (m[0].rm_eo > 0 && regexec(&r->re, cur, 1, m, REG_STARTEND) == 0 && m[0].rm_so == 0) {
+            size_t len = (size_t)m[0].rm_eo;
+            if (len > best_len) { best = i; best_len = len; }
+        }
+    }
+    if (best < 0) { best = deflt; best_len = 1; }
+    *out_len = best_len;
+    return best;
+}
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "token.h"
+#include "scan.h"
+#include "unicode_id.h"
+
+#define YYMAXFILL 8
+
+enum YYCONDTYPE {
+    yycregex,
+    yycdiv,
+};
+
+
+// 流式窗口默认大小
+#define LEXER_STREAM_WINDOW (64 * 1024)
+
+static void lexer_reset_state(Lexer *lexer) {
+    scan_init();
+    lexer->marker = lexer->cursor;
+    lexer->token = lexer->cursor;
+    memset(&lexer->lines, 0, sizeof(lexer->lines));
+    lexer->has_newline = false;
+    lexer->prev_tok_state = PREV_TOK_CAN_REGEX;
+    lexer->in_template_expression = false;
+    lexer->template_expr_depth = 0;
+    lexer->template_nesting_depth = 0;
+    lexer->quiet = false;
+}
+
+// 初始化词法分析器（整块内存输入，以 NUL 结尾）
+void lexer_init(Lexer *lexer, const char *input) {
+    lexer->input = input;
+    lexer->cursor = input;
+    lexer->limit = input + strlen(input);
+    lexer->base_offset = 0;
+    lexer->stream = NULL;
+    lexer_reset_state(lexer);
+}
+
+// 从整块输入（长度 length，以 NUL 结尾）的 offset 处开始切分，状态与文件开头相同；
+// 已知长度时不必再 strlen（并行切分的各段使用）
+void lexer_init_at(Lexer *lexer, const char *input, size_t length, size_t offset) {
+    lexer->input = input;
+    lexer->cursor = input + offset;
+    lexer->limit = input + length;
+    lexer->base_offset = 0;
+    lexer->stream = NULL;
+    lexer_reset_state(lexer);
+}
+
+static size_t read_file(void *source, char *buffer, size_t size) {
+    return fread(buffer, 1, size, (FILE *)source);
+}
+
+// 初始化流式词法分析器：窗口按需通过 YYFILL 补充
+bool lexer_init_stream(Lexer *lexer, LexerStream *stream, FILE *file, size_t window_size, bool append_newline) {
+    return lexer_init_stream_reader(lexer, stream, read_file, file, window_size, append_newline);
+}
+
+bool lexer_init_stream_reader(Lexer *lexer, LexerStream *stream, LexerReadFn read, void *source,
+                              size_t window_size, bool append_newline) {
+    if (window_size < YYMAXFILL * 2) {
+        window_size = LEXER_STREAM_WINDOW;
+    }
+    stream->read = read;
+    stream->source = source;
+    stream->capacity = window_size;
+    stream->buffer = (char *)malloc(window_size + YYMAXFILL + 2);
+    stream->eof = false;
+    stream->append_newline = append_newline;
+    stream->pinned = false;
+    stream->pin_offset = 0;
+    if (!stream->buffer) {
+        return false;
+    }
+    stream->buffer[0] = '\0';
+
+    lexer->input = stream->buffer;
+    lexer->cursor = stream->buffer;
+    lexer->limit = stream->buffer;
+    lexer->base_offset = 0;
+    lexer->stream = stream;
+    lexer_reset_state(lexer);
+    return true;
+}
+
+void lexer_stream_free(LexerStream *stream) {
+    free(stream->buffer);
+    stream->buffer = NULL;
+}
+
+static void line_index_push(LineIndex *lines, size_t start) {
+    if (lines->count == lines->capacity) {
+        size_t capacity = lines->capacity ? lines->capacity * 2 : 256;
+        size_t *grown = (size_t *)realloc(lines->starts, capacity * sizeof(size_t));
+        if (!grown) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        lines->starts = grown;
+        lines->capacity = capacity;
+    }
+    lines->starts[lines->count++] = start;
+}
+
+// 把行索引扩展到覆盖 [0, upto)：只扫描尚未扫描且仍在缓冲区内的部分
+static void line_index_extend(Lexer *lexer, size_t upto) {
+    LineIndex *lines = &lexer->lines;
+    if (lines->count == 0) {
+        lines->first_line = 1;
+        lines->scanned = 0;
+        line_index_push(lines, 0);
+    }
+
+    size_t available = lexer->base_offset + (size_t)(lexer->limit - lexer->input);
+    if (upto > available) {
+        upto = available;
+    }
+    while (lines->scanned < upto) {
+        const char *p = lexer->input + (lines->scanned - lexer->base_offset);
+        const char *end = lexer->input + (upto - lexer->base_offset);
+        const char *newline = scan_next_newline(p, end);
+        if (newline == end) {
+            lines->scanned = upto;
+            break;
+        }
+        lines->scanned = lexer->base_offset + (size_t)(newline - lexer->input) + 1;
+        line_index_push(lines, lines->scanned);
+    }
+}
+
+// 流式窗口滑动前调用：先记下即将丢弃部分的换行，再只保留 offset 所在行及之后的行
+static void line_index_discard(Lexer *lexer, size_t offset) {
+    LineIndex *lines = &lexer->lines;
+    line_index_extend(lexer, offset);
+    size_t keep = lines->count - 1;
+    while (keep > 0 && lines->starts[keep] > offset) {
+        keep--;
+    }
+    if (keep > 0) {
+        memmove(lines->starts, lines->starts + keep, (lines->count - keep) * sizeof(size_t));
+        lines->count -= keep;
+        lines->first_line += (int)keep;
+    }
+}
+
+// 按字节偏移计算行列号（均从 1 开始，列按字节计）
+void lexer_position(Lexer *lexer, size_t offset, int *line, int *column) {
+    LineIndex *lines = &lexer->lines;
+    line_index_extend(lexer, offset);
+
+    // 二分查找最后一个不大于 offset 的行起点；顺序查询时通常直接命中最后一行
+    size_t lo = 0;
+    size_t hi = lines->count - 1;
+    if (lines->starts[hi] <= offset) {
+        lo = hi;
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo + 1) / 2;
+        if (lines->starts[mid] <= offset) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    size_t start = lines->starts[lo];
+    *line = lines->first_line + (int)lo;
+    *column = offset >= start ? (int)(offset - start) + 1 : 1;
+}
+
+void lexer_dispose(Lexer *lexer) {
+    free(lexer->lines.starts);
+    memset(&lexer->lines, 0, sizeof(lexer->lines));
+}
+
+// YYFILL：丢弃 token 起点（或前瞻固定点）之前的数据，再从输入源读入，保证 cursor 之后至少有 need 字节。
+// 到达输入末尾时补 YYMAXFILL 个 NUL 作为哨兵，之后不再读取。
+static void lexer_fill(Lexer *lexer, size_t need) {
+    LexerStream *stream = lexer->stream;
+    if (!stream || stream->eof) {
+        return;
+    }
+
+    char *buffer = stream->buffer;
+    const char *keep = lexer->token;
+    if (stream->pinned) {
+        const char *pin = buffer + (stream->pin_offset - lexer->base_offset);
+        if (pin < keep) {
+            keep = pin;
+        }
+    }
+
+    size_t shift = (size_t)(keep - buffer);
+    size_t used = (size_t)(lexer->limit - keep);
+    if (shift > 0) {
+        line_index_discard(lexer, lexer->base_offset + shift);
+        memmove(buffer, keep, used);
+        lexer->base_offset += shift;
+    }
+    size_t cursor_pos = (size_t)(lexer->cursor - keep);
+    size_t marker_pos = (size_t)(lexer->marker - keep);
+    size_t token_pos = (size_t)(lexer->token - keep);
+
+    // 单个 token（或前瞻区间）比窗口还长时才扩容
+    if (cursor_pos + need > stream->capacity) {
+        size_t capacity = stream->capacity * 2;
+        while (cursor_pos + need > capacity) {
+            capacity *= 2;
+        }
+        char *grown = (char *)realloc(buffer, capacity + YYMAXFILL + 2);
+        if (!grown) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        buffer = grown;
+        stream->buffer = grown;
+        stream->capacity = capacity;
+    }
+
+    while (used < stream->capacity) {
+        size_t n = stream->read(stream->source, buffer + used, stream->capacity - used);
+        used += n;
+        if (n == 0) {
+            if (stream->append_newline) {
+                buffer[used++] = '\n';
+            }
+            memset(buffer + used, 0, YYMAXFILL + 1);
+            used += YYMAXFILL;
+            stream->eof = true;
+            break;
+        }
+        if (used >= cursor_pos + need) {
+            break;
+        }
+    }
+    buffer[used] = '\0';
+
+    lexer->input = buffer;
+    lexer->cursor = buffer + cursor_pos;
+    lexer->marker = buffer + marker_pos;
+    lexer->token = buffer + token_pos;
+    lexer->limit = buffer + used;
+}
+
+// 手写扫描循环使用：保证 cursor 之后至少有 n 字节可读
+static inline void lexer_ensure(Lexer *lexer, size_t n) {
+    if (lexer->stream && (size_t)(lexer->limit - lexer->cursor) < n) {
+        lexer_fill(lexer, n);
+    }
+}
+
+// 扫描内核停在窗口末尾且流式输入尚未结束时返回 true，调用方补充数据后继续扫描
+static inline bool lexer_at_window_end(const Lexer *lexer) {
+    return lexer->cursor == lexer->limit && lexer->stream && !lexer->stream->eof;
+}
+
+// 保存检查点并固定窗口，前瞻期间的 YYFILL 不会丢弃检查点之后的数据
+void lexer_save(Lexer *lexer, LexerCheckpoint *checkpoint) {
+    checkpoint->state = *lexer;
+    checkpoint->cursor_offset = lexer->base_offset + (size_t)(lexer->cursor - lexer->input);
+    if (lexer->stream) {
+        lexer->stream->pinned = true;
+        lexer->stream->pin_offset = checkpoint->cursor_offset;
+    }
+}
+
+// 恢复检查点：窗口可能已滑动或扩容，游标按绝对偏移重新定位；行索引只增不减，保留当前的
+void lexer_restore(Lexer *lexer, const LexerCheckpoint *checkpoint) {
+    const char *input = lexer->input;
+    const char *limit = lexer->limit;
+    size_t base_offset = lexer->base_offset;
+    LineIndex lines = lexer->lines;
+
+    *lexer = checkpoint->state;
+    lexer->input = input;
+    lexer->limit = limit;
+    lexer->base_offset = base_offset;
+    lexer->lines = lines;
+    lexer->cursor = input + (checkpoint->cursor_offset - base_offset);
+    lexer->marker = lexer->cursor;
+    lexer->token = lexer->cursor;
+    if (lexer->stream) {
+        lexer->stream->pinned = false;
+    }
+}
+
+// 创建 token：只记录 token 在输入缓冲区中的 (offset, length) 视图，不复制文本
+static Token make_token(Lexer *lexer, TokenType type, const char *start, const char *end) {
+    Token token;
+    token.type = type;
+    token.offset = lexer->base_offset + (size_t)(start - lexer->input);
+    token.length = (end > start) ? (size_t)(end - start) : 0;
+    return token;
+}
+
+static bool token_buffer_reserve(TokenBuffer *buffer, size_t needed) {
+    if (needed <= buffer->capacity) {
+        return true;
+    }
+    size_t capacity = buffer->capacity ? buffer->capacity * 2 : 1024;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+    uint16_t *types = (uint16_t *)realloc(buffer->types, capacity * sizeof(uint16_t));
+    if (types) buffer->types = types;
+    uint8_t *flags = (uint8_t *)realloc(buffer->flags, capacity);
+    if (flags) buffer->flags = flags;
+    uint32_t *offsets = (uint32_t *)realloc(buffer->offsets, capacity * sizeof(uint32_t));
+    if (offsets) buffer->offsets = offsets;
+    uint32_t *lengths = (uint32_t *)realloc(buffer->lengths, capacity * sizeof(uint32_t));
+    if (lengths) buffer->lengths = lengths;
+    if (!types || !flags || !offsets || !lengths) {
+        return false;
+    }
+    buffer->capacity = capacity;
+    return true;
+}
+
+bool token_buffer_push(TokenBuffer *buffer, const Token *token, bool newline_before) {
+    if (!token_buffer_reserve(buffer, buffer->count + 1)) {
+        return false;
+    }
+    size_t i = buffer->count++;
+    buffer->types[i] = (uint16_t)token->type;
+    buffer->flags[i] = newline_before ? TOKBUF_NEWLINE_BEFORE : 0;
+    buffer->offsets[i] = (uint32_t)token->offset;
+    buffer->lengths[i] = (uint32_t)token->length;
+    return true;
+}
+
+// 一次性把整块输入切分到 buffer，直到 EOF 或错误 token（两者都会写入）。
+// 只支持整块内存输入，偏移须在 32 位范围内；失败时返回 false，调用方退回逐个取 token。
+bool token_buffer_fill(TokenBuffer *buffer, Lexer *lexer) {
+    memset(buffer, 0, sizeof(*buffer));
+    if (lexer->stream || (size_t)(lexer->limit - lexer->input) >= UINT32_MAX) {
+        return false;
+    }
+
+    Token token;
+    do {
+        token = lexer_next_token(lexer);
+        if (!token_buffer_push(buffer, &token, lexer->has_newline)) {
+            token_buffer_free(buffer);
+            return false;
+        }
+    } while (token.type != TOK_EOF && token.type != TOK_ERROR);
+    return true;
+}
+
+void token_buffer_free(TokenBuffer *buffer) {
+    free(buffer->types);
+    free(buffer->flags);
+    free(buffer->offsets);
+    free(buffer->lengths);
+    memset(buffer, 0, sizeof(*buffer));
+}
+
+// 越界时返回最后一个 token（EOF 或错误），与逐个取 token 时反复返回 EOF 一致
+Token token_buffer_get(const TokenBuffer *buffer, size_t index) {
+    if (index >= buffer->count) {
+        index = buffer->count - 1;
+    }
+    Token token;
+    token.type = (TokenType)buffer->types[index];
+    token.offset = buffer->offsets[index];
+    token.length = buffer->lengths[index];
+    return token;
+}
+
+// 返回 token 文本的起始位置（指向输入缓冲区，不以 NUL 结尾，长度为 token->length）
+// 流式模式下只保证最近一次 lexer_next_token 返回的 token 仍在窗口内
+const char *token_text(const Lexer *lexer, const Token *token) {
+    return lexer->input + (token->offset - lexer->base_offset);
+}
+
+// 仅在语法层需要独立的 char* 时才分配并复制 token 文本，调用方负责 free
+char *token_dup_value(const Lexer *lexer, const Token *token) {
+    char *value = (char *)malloc(token->length + 1);
+    if (!value) {
+        return NULL;
+    }
+    memcpy(value, token_text(lexer, token), token->length);
+    value[token->length] = '\0';
+    return value;
+}
+
+// 解码 p 处的一个 UTF-8 码点，返回字节数；格式错误（截断、过长编码、代理区）返回 0
+static int utf8_decode(const unsigned char *p, const unsigned char *end, uint32_t *cp) {
+    unsigned char c = p[0];
+    int n;
+    uint32_t min;
+    if (c >= 0xC2 && c <= 0xDF) {
+        n = 2; min = 0x80; *cp = c & 0x1F;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+        n = 3; min = 0x800; *cp = c & 0x0F;
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        n = 4; min = 0x10000; *cp = c & 0x07;
+    } else {
+        return 0;
+    }
+    if (end - p < n) {
+        return 0;
+    }
+    for (int i = 1; i < n; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            return 0;
+        }
+        *cp = (*cp << 6) | (p[i] & 0x3F);
+    }
+    if (*cp < min || *cp > 0x10FFFF || (*cp >= 0xD800 && *cp <= 0xDFFF)) {
+        return 0;
+    }
+    return n;
+}
+
+// 校验 [start, end) 中的标识符（ASCII 部分与 \uXXXX 已由规则保证），
+// 返回合法前缀的末尾；首个码点就不能开始标识符时返回 start
+static const char *scan_unicode_identifier(const char *start, const char *end) {
+    const unsigned char *p = (const unsigned char *)start;
+    const unsigned char *stop = (const unsigned char *)end;
+    while (p < stop) {
+        if (*p < 0x80) {
+            p += (*p == '\\') ? 6 : 1;
+            continue;
+        }
+        uint32_t cp;
+        int n = utf8_decode(p, stop, &cp);
+        bool ok;
+        if (p == (const unsigned char *)start) {
+            ok = n > 0 && unicode_is_id_start(cp);
+        } else {
+            // ZWNJ / ZWJ 允许出现在标识符中间
+            ok = n > 0 && (unicode_is_id_continue(cp) || cp == 0x200C || cp == 0x200D);
+        }
+        if (!ok) {
+            break;
+        }
+        p += n;
+    }
+    return (const char *)p;
+}
+
+// 扫描条件由上一个 token 决定：regex 条件下 '/' 可以开始正则字面量，div 条件下只能是除号，
+// 不再先试探整段正则再回退
+static enum YYCONDTYPE lexer_condition(const Lexer *lexer) {
+    return lexer->prev_tok_state == PREV_TOK_CAN_REGEX ? yycregex : yycdiv;
+}
+
+static Token lex_template_segment(Lexer *lexer, bool is_start) {
+    lexer->token = lexer->cursor; // 片段内容起点，流式补充时保留
+
+    while (1) {
+        lexer->cursor = scan_template_body(lexer->cursor, lexer->limit);
+        lexer_ensure(lexer, 2);
+        char c = *lexer->cursor;
+        if (c == '\0') {
+            int line, column;
+            lexer_position(lexer, lexer->base_offset + (size_t)(lexer->token - lexer->input), &line, &column);
+            if (!lexer->quiet) {
+                fprintf(stderr, "Unterminated template literal at line %d, column %d\n", line, column);
+            }
+            return make_token(lexer, TOK_ERROR, lexer->token, lexer->token);
+        }
+
+        if (c == '`') {
+            TokenType ttype = is_start ? TOK_TEMPLATE_NO_SUB : TOK_TEMPLATE_TAIL;
+            Token token = make_token(lexer, ttype, lexer->token, lexer->cursor);
+            lexer->cursor++;
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return token;
+        }
+
+        if (c == '$' && lexer->cursor[1] == '{') {
+            TokenType ttype = is_start ? TOK_TEMPLATE_HEAD : TOK_TEMPLATE_MIDDLE;
+            Token token = make_token(lexer, ttype, lexer->token, lexer->cursor);
+            lexer->cursor += 2;
+            lexer->in_template_expression = true;
+            lexer->template_expr_depth = 0;
+            lexer->template_nesting_depth++;
+            lexer->prev_tok_state = PREV_TOK_CAN_REGEX;
+            return token;
+        }
+
+        if (c == '\\') {
+            lexer->cursor++;
+            lexer_ensure(lexer, 1);
+            if (*lexer->cursor) {
+                lexer->cursor++;
+            }
+            continue;
+        }
+
+        lexer->cursor++;
+    }
+}
+
+// 获取下一个 token
+Token lexer_next_token(Lexer *lexer) {
+    const char *token_start;
+    
+    // 重置换行标记
+    lexer->has_newline = false;
+    
+    while (1) {
+        token_start = lexer->cursor;
+        lexer->token = token_start;
+        
+        {
+    static fake_rule fk_rules_1[] = {
+        { 'R', "^([\011\015 ])", 0, {0} },
+        { 'R', "^(\012)", 0, {0} },
+        { 'R', "^(\\.\\.\\.)", 0, {0} },
+        { 'R', "^(//)", 0, {0} },
+        { 'R', "^(/\\*)", 0, {0} },
+        { 'R', "^(var)", 0, {0} },
+        { 'R', "^(let)", 0, {0} },
+        { 'R', "^(const)", 0, {0} },
+        { 'R', "^(function)", 0, {0} },
+        { 'R', "^(if)", 0, {0} },
+        { 'R', "^(else)", 0, {0} },
+        { 'R', "^(for)", 0, {0} },
+        { 'R', "^(while)", 0, {0} },
+        { 'R', "^(do)", 0, {0} },
+        { 'R', "^(return)", 0, {0} },
+        { 'R', "^(break)", 0, {0} },
+        { 'R', "^(continue)", 0, {0} },
+        { 'R', "^(switch)", 0, {0} },
+        { 'R', "^(case)", 0, {0} },
+        { 'R', "^(default)", 0, {0} },
+        { 'R', "^(try)", 0, {0} },
+        { 'R', "^(catch)", 0, {0} },
+        { 'R', "^(finally)", 0, {0} },
+        { 'R', "^(throw)", 0, {0} },
+        { 'R', "^(new)", 0, {0} },
+        { 'R', "^(this)", 0, {0} },
+        { 'R', "^(typeof)", 0, {0} },
+        { 'R', "^(delete)", 0, {0} },
+        { 'R', "^(in)", 0, {0} },
+        { 'R', "^(instanceof)", 0, {0} },
+        { 'R', "^(void)", 0, {0} },
+        { 'R', "^(with)", 0, {0} },
+        { 'R', "^(debugger)", 0, {0} },
+        { 'R', "^(class)", 0, {0} },
+        { 'R', "^(extends)", 0, {0} },
+        { 'R', "^(super)", 0, {0} },
+        { 'R', "^(import)", 0, {0} },
+        { 'R', "^(export)", 0, {0} },
+        { 'R', "^(yield)", 0, {0} },
+        { 'R', "^(async)", 0, {0} },
+        { 'R', "^(await)", 0, {0} },
+        { 'R', "^(true)", 0, {0} },
+        { 'R', "^(false)", 0, {0} },
+        { 'R', "^(null)", 0, {0} },
+        { 'R', "^(undefined)", 0, {0} },
+        { 'R', "^(((0[Xx]([0-9A-Fa-f])(((_)?([0-9A-Fa-f])))*(n)?|0[Oo][0-7](((_)?[0-7]))*(n)?)|0[Bb][01](((_)?[01]))*(n)?))", 0, {0} },
+        { 'R', "^(0([0-7])+)", 0, {0} },
+        { 'R', "^(0([0-7])*[89]([0-9])*)", 0, {0} },
+        { 'R', "^(((((0|[1-9](((_)?([0-9](((_)?[0-9]))*)))?))\\.(([0-9](((_)?[0-9]))*))?|\\.([0-9](((_)?[0-9]))*)))(([Ee]([+-])?([0-9](((_)?[0-9]))*)))?)", 0, {0} },
+        { 'R', "^(((0|[1-9](((_)?([0-9](((_)?[0-9]))*)))?))[Ee]([+-])?([0-9](((_)?[0-9]))*))", 0, {0} },
+        { 'R', "^(((0|[1-9](((_)?([0-9](((_)?[0-9]))*)))?))(n)?)", 0, {0} },
+        { 'R', "^(\")", 0, {0} },
+        { 'R', "^(')", 0, {0} },
+        { 'R', "^(`)", 0, {0} },
+        { 'R', "^(/((([]\001-\011\013\014\016-)+,.0-Z_-\377^-]|\\\\[]\001-\011\013\014\016-,.-\\_-\377^-])|\\[((([\001-\011\013\014\016-,.-[_-\377^-]|\\\\[]\001-\011\013\014\016-,.-\\_-\377^-])))*\\]))(((([]\001-\011\013\014\016-,.0-Z_-\377^-]|\\\\[]\001-\011\013\014\016-,.-\\_-\377^-])|\\[((([\001-\011\013\014\016-,.-[_-\377^-]|\\\\[]\001-\011\013\014\016-,.-\\_-\377^-])))*\\])))*/([gimsuy])*)", 0, {0} },
+        { 'R', "^(/=)", 0, {0} },
+        { 'R', "^(/)", 0, {0} },
+        { 'R', "^((([$A-Z_a-z]|(\\\\u([0-9A-Fa-f]){4,4})))((([$0-9A-Z_a-z]|(\\\\u([0-9A-Fa-f]){4,4}))))*)", 0, {0} },
+        { 'R', "^((((([$A-Z_a-z]|(\\\\u([0-9A-Fa-f]){4,4})))|(((((((((\302[\200-\237\241-\277]|[\303-\337]([\200-\277]))|\340[\240-\277]([\200-\277]))|\341(([\200-\231\233-\277]([\200-\277])|\232[\201-\277])))|\342(((\200[\213-\247\252-\256\260-\277]|\201[\200-\236\240-\277])|[\202-\277]([\200-\277]))))|\343((\200[\201-\277]|[\201-\277]([\200-\277]))))|[\344-\356]([\200-\277])([\200-\277]))|\357(([\200-\272\274-\277]([\200-\277])|\273[\200-\276])))|[\360-\364]([\200-\277])([\200-\277])([\200-\277])))))((((([$0-9A-Z_a-z]|(\\\\u([0-9A-Fa-f]){4,4})))|(((((((((\302[\200-\237\241-\277]|[\303-\337]([\200-\277]))|\340[\240-\277]([\200-\277]))|\341(([\200-\231\233-\277]([\200-\277])|\232[\201-\277])))|\342(((\200[\213-\247\252-\256\260-\277]|\201[\200-\236\240-\277])|[\202-\277]([\200-\277]))))|\343((\200[\201-\277]|[\201-\277]([\200-\277]))))|[\344-\356]([\200-\277])([\200-\277]))|\357(([\200-\272\274-\277]([\200-\277])|\273[\200-\276])))|[\360-\364]([\200-\277])([\200-\277])([\200-\277]))))))*)", 0, {0} },
+        { 'R', "^((((((\302\240|\341\232\200)|\342\200[\200-\212\257])|\342\201\237)|\343\200\200)|\357\273\277))", 0, {0} },
+        { 'R', "^(\342\200[\250\251])", 0, {0} },
+        { 'R', "^(((>>>=|===)|!==))", 0, {0} },
+        { 'R', "^(=>)", 0, {0} },
+        { 'R', "^((((((((((((((((((((\\+\\+|--)|<<)|>>)|>>>)|<=)|>=)|==)|!=)|&&)|\\|\\|)|\\+=)|-=)|\\*=)|%=)|&=)|\\|=)|\\^=)|<<=)|>>=))", 0, {0} },
+        { 'R', "^(\\+)", 0, {0} },
+        { 'R', "^(-)", 0, {0} },
+        { 'R', "^(\\*)", 0, {0} },
+        { 'R', "^(%)", 0, {0} },
+        { 'R', "^(=)", 0, {0} },
+        { 'R', "^(<)", 0, {0} },
+        { 'R', "^(>)", 0, {0} },
+        { 'R', "^(!)", 0, {0} },
+        { 'R', "^(&)", 0, {0} },
+        { 'R', "^(\\|)", 0, {0} },
+        { 'R', "^(\\^)", 0, {0} },
+        { 'R', "^(~)", 0, {0} },
+        { 'R', "^(\\?)", 0, {0} },
+        { 'R', "^(:)", 0, {0} },
+        { 'R', "^(\\()", 0, {0} },
+        { 'R', "^(\\))", 0, {0} },
+        { 'R', "^(\\{)", 0, {0} },
+        { 'R', "^(\\})", 0, {0} },
+        { 'R', "^(\\[)", 0, {0} },
+        { 'R', "^(\\])", 0, {0} },
+        { 'R', "^(;)", 0, {0} },
+        { 'R', "^(,)", 0, {0} },
+        { 'R', "^(\\.)", 0, {0} },
+        { 'N', NULL, 0, {0} },
+        { 'D', NULL, 0, {0} },
+    };
+    if ((size_t)(lexer->limit - lexer->cursor) < 4096) { { lexer_fill(lexer, 4096); token_start = lexer->token; } }
+    int fk_cond = lexer_condition(lexer);
+    static const char *fk_rc_1[] = {
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "regex",
+        "div,regex",
+        "div,regex",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+        "*",
+    };
+    static const char *fk_cn_1[] = { "regex", "div" };
+    size_t fk_len; int fk_r = fake_match(fk_rules_1, 89, lexer->cursor, lexer->limit, fk_rc_1, fk_cn_1[fk_cond], &fk_len);
+    while (lexer->cursor + fk_len >= lexer->limit) { size_t fk_have = (size_t)(lexer->limit - lexer->cursor); { lexer_fill(lexer, fk_have + 4096); token_start = lexer->token; } if ((size_t)(lexer->limit - lexer->cursor) <= fk_have) break; fk_r = fake_match(fk_rules_1, 89, lexer->cursor, lexer->limit, fk_rc_1, fk_cn_1[fk_cond], &fk_len); }
+    lexer->cursor += fk_len;
+    if (fk_r == 0) { {
+            for (;;) {
+                lexer->cursor = scan_skip_blank(lexer->cursor, lexer->limit);
+                if (!lexer_at_window_end(lexer)) break;
+                lexer_fill(lexer, 1);
+            }
+            continue;
+        } }
+    else if (fk_r == 1) { {
+            lexer->has_newline = true;
+            continue;
+        } }
+    else if (fk_r == 2) { {
+            lexer->prev_tok_state = PREV_TOK_CAN_REGEX;
+            return make_token(lexer, TOK_ELLIPSIS, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 3) { {
+            for (;;) {
+                lexer->cursor = scan_line_body(lexer->cursor, lexer->limit);
+                if (!lexer_at_window_end(lexer)) break;
+                lexer_fill(lexer, 1);
+            }
+            continue;
+        } }
+    else if (fk_r == 4) { {
+            for (;;) {
+                lexer->cursor = scan_comment_body(lexer->cursor, lexer->limit);
+                lexer_ensure(lexer, 2);
+                char c = *lexer->cursor;
+                if (c == '*' && lexer->cursor[1] == '/') {
+                    lexer->cursor += 2;
+                    break;
+                }
+                if (c == '\0') {
+                    // 未闭合的注释：按单个 '/' 处理
+                    lexer->cursor = lexer->token + 1;
+                    lexer->prev_tok_state = PREV_TOK_CAN_REGEX;
+                    return make_token(lexer, TOK_SLASH, lexer->token, lexer->cursor);
+                }
+                if (c == '*') {
+                    lexer->cursor++;
+                }
+            }
+            // 含换行的块注释对 ASI 等同于换行
+            if (scan_next_newline(lexer->token, lexer->cursor) != lexer->cursor) {
+                lexer->has_newline = true;
+            }
+            continue;
+        } }
+    else if (fk_r == 5) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_VAR, token_start, lexer->cursor); } }
+    else if (fk_r == 6) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_LET, token_start, lexer->cursor); } }
+    else if (fk_r == 7) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_CONST, token_start, lexer->cursor); } }
+    else if (fk_r == 8) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_FUNCTION, token_start, lexer->cursor); } }
+    else if (fk_r == 9) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_IF, token_start, lexer->cursor); } }
+    else if (fk_r == 10) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_ELSE, token_start, lexer->cursor); } }
+    else if (fk_r == 11) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_FOR, token_start, lexer->cursor); } }
+    else if (fk_r == 12) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_WHILE, token_start, lexer->cursor); } }
+    else if (fk_r == 13) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_DO, token_start, lexer->cursor); } }
+    else if (fk_r == 14) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_RETURN, token_start, lexer->cursor); } }
+    else if (fk_r == 15) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_BREAK, token_start, lexer->cursor); } }
+    else if (fk_r == 16) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_CONTINUE, token_start, lexer->cursor); } }
+    else if (fk_r == 17) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_SWITCH, token_start, lexer->cursor); } }
+    else if (fk_r == 18) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_CASE, token_start, lexer->cursor); } }
+    else if (fk_r == 19) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_DEFAULT, token_start, lexer->cursor); } }
+    else if (fk_r == 20) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_TRY, token_start, lexer->cursor); } }
+    else if (fk_r == 21) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_CATCH, token_start, lexer->cursor); } }
+    else if (fk_r == 22) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_FINALLY, token_start, lexer->cursor); } }
+    else if (fk_r == 23) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_THROW, token_start, lexer->cursor); } }
+    else if (fk_r == 24) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_NEW, token_start, lexer->cursor); } }
+    else if (fk_r == 25) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_THIS, token_start, lexer->cursor); } }
+    else if (fk_r == 26) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_TYPEOF, token_start, lexer->cursor); } }
+    else if (fk_r == 27) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_DELETE, token_start, lexer->cursor); } }
+    else if (fk_r == 28) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_IN, token_start, lexer->cursor); } }
+    else if (fk_r == 29) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_INSTANCEOF, token_start, lexer->cursor); } }
+    else if (fk_r == 30) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_VOID, token_start, lexer->cursor); } }
+    else if (fk_r == 31) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_WITH, token_start, lexer->cursor); } }
+    else if (fk_r == 32) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_DEBUGGER, token_start, lexer->cursor); } }
+    else if (fk_r == 33) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_CLASS, token_start, lexer->cursor); } }
+    else if (fk_r == 34) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_EXTENDS, token_start, lexer->cursor); } }
+    else if (fk_r == 35) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_SUPER, token_start, lexer->cursor); } }
+    else if (fk_r == 36) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_IMPORT, token_start, lexer->cursor); } }
+    else if (fk_r == 37) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_EXPORT, token_start, lexer->cursor); } }
+    else if (fk_r == 38) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_YIELD, token_start, lexer->cursor); } }
+    else if (fk_r == 39) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_ASYNC, token_start, lexer->cursor); } }
+    else if (fk_r == 40) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_AWAIT, token_start, lexer->cursor); } }
+    else if (fk_r == 41) { { lexer->prev_tok_state = PREV_TOK_NO_REGEX; return make_token(lexer, TOK_TRUE, token_start, lexer->cursor); } }
+    else if (fk_r == 42) { { lexer->prev_tok_state = PREV_TOK_NO_REGEX; return make_token(lexer, TOK_FALSE, token_start, lexer->cursor); } }
+    else if (fk_r == 43) { { lexer->prev_tok_state = PREV_TOK_NO_REGEX; return make_token(lexer, TOK_NULL, token_start, lexer->cursor); } }
+    else if (fk_r == 44) { { lexer->prev_tok_state = PREV_TOK_NO_REGEX; return make_token(lexer, TOK_UNDEFINED, token_start, lexer->cursor); } }
+    else if (fk_r == 45) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_NUMBER, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 46) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_NUMBER, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 47) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_NUMBER, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 48) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_NUMBER, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 49) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_NUMBER, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 50) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_NUMBER, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 51) { {
+            for (;;) {
+                lexer->cursor = scan_string_body(lexer->cursor, lexer->limit, '"');
+                lexer_ensure(lexer, 2);
+                if (*lexer->cursor == '\0' || *lexer->cursor == '"') {
+                    break;
+                }
+                // 反斜杠连同被转义的字符一起跳过
+                if (*lexer->cursor == '\\' && lexer->cursor[1]) {
+                    lexer->cursor++;
+                }
+                lexer->cursor++;
+            }
+            if (*lexer->cursor == '"') {
+                lexer->cursor++;
+            }
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_STRING, lexer->token, lexer->cursor);
+        } }
+    else if (fk_r == 52) { {
+            for (;;) {
+                lexer->cursor = scan_string_body(lexer->cursor, lexer->limit, '\'');
+                lexer_ensure(lexer, 2);
+                if (*lexer->cursor == '\0' || *lexer->cursor == '\'') {
+                    break;
+                }
+                // 反斜杠连同被转义的字符一起跳过
+                if (*lexer->cursor == '\\' && lexer->cursor[1]) {
+                    lexer->cursor++;
+                }
+                lexer->cursor++;
+            }
+            if (*lexer->cursor == '\'') {
+                lexer->cursor++;
+            }
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_STRING, lexer->token, lexer->cursor);
+        } }
+    else if (fk_r == 53) { {
+            Token tpl = lex_template_segment(lexer, true);
+            if (tpl.type == TOK_ERROR) {
+                return tpl;
+            }
+            return tpl;
+        } }
+    else if (fk_r == 54) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_REGEX, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 55) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_SLASH_ASSIGN, token_start, lexer->cursor); } }
+    else if (fk_r == 56) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_SLASH, token_start, lexer->cursor); } }
+    else if (fk_r == 57) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_IDENTIFIER, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 58) { {
+            const char *end = scan_unicode_identifier(token_start, lexer->cursor);
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            if (end == token_start) {
+                // 首字符不能开始标识符：与其他非法字符一样逐字节报错
+                lexer->cursor = token_start + 1;
+                return make_token(lexer, TOK_ERROR, token_start, lexer->cursor);
+            }
+            lexer->cursor = end;
+            return make_token(lexer, TOK_IDENTIFIER, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 59) { {
+            continue;
+        } }
+    else if (fk_r == 60) { {
+            lexer->has_newline = true;
+            continue;
+        } }
+    else if (fk_r == 61) { {
+            lexer->prev_tok_state = PREV_TOK_CAN_REGEX;
+            if (strncmp(token_start, ">>>=", 4) == 0) return make_token(lexer, TOK_URSHIFT_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, "===", 3) == 0) return make_token(lexer, TOK_EQ_STRICT, token_start, lexer->cursor);
+            if (strncmp(token_start, "!==", 3) == 0) return make_token(lexer, TOK_NE_STRICT, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 62) { {
+                lexer->prev_tok_state = PREV_TOK_CAN_REGEX;
+                return make_token(lexer, TOK_ARROW, token_start, lexer->cursor);
+            } }
+    else if (fk_r == 63) { {
+            lexer->prev_tok_state = PREV_TOK_CAN_REGEX;
+            
+            if (strncmp(token_start, "++", 2) == 0) return make_token(lexer, TOK_PLUS_PLUS, token_start, lexer->cursor);
+            if (strncmp(token_start, "--", 2) == 0) return make_token(lexer, TOK_MINUS_MINUS, token_start, lexer->cursor);
+            if (strncmp(token_start, "<<", 2) == 0) return make_token(lexer, TOK_LSHIFT, token_start, lexer->cursor);
+            if (strncmp(token_start, ">>", 2) == 0) return make_token(lexer, TOK_RSHIFT, token_start, lexer->cursor);
+            if (strncmp(token_start, ">>>", 3) == 0) return make_token(lexer, TOK_URSHIFT, token_start, lexer->cursor);
+            if (strncmp(token_start, "<=", 2) == 0) return make_token(lexer, TOK_LE, token_start, lexer->cursor);
+            if (strncmp(token_start, ">=", 2) == 0) return make_token(lexer, TOK_GE, token_start, lexer->cursor);
+            if (strncmp(token_start, "==", 2) == 0) return make_token(lexer, TOK_EQ, token_start, lexer->cursor);
+            if (strncmp(token_start, "!=", 2) == 0) return make_token(lexer, TOK_NE, token_start, lexer->cursor);
+            if (strncmp(token_start, "&&", 2) == 0) return make_token(lexer, TOK_AND, token_start, lexer->cursor);
+            if (strncmp(token_start, "||", 2) == 0) return make_token(lexer, TOK_OR, token_start, lexer->cursor);
+            if (strncmp(token_start, "+=", 2) == 0) return make_token(lexer, TOK_PLUS_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, "-=", 2) == 0) return make_token(lexer, TOK_MINUS_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, "*=", 2) == 0) return make_token(lexer, TOK_STAR_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, "%=", 2) == 0) return make_token(lexer, TOK_PERCENT_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, "&=", 2) == 0) return make_token(lexer, TOK_AND_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, "|=", 2) == 0) return make_token(lexer, TOK_OR_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, "^=", 2) == 0) return make_token(lexer, TOK_XOR_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, "<<=", 3) == 0) return make_token(lexer, TOK_LSHIFT_ASSIGN, token_start, lexer->cursor);
+            if (strncmp(token_start, ">>=", 3) == 0) return make_token(lexer, TOK_RSHIFT_ASSIGN, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 64) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_PLUS, token_start, lexer->cursor); } }
+    else if (fk_r == 65) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_MINUS, token_start, lexer->cursor); } }
+    else if (fk_r == 66) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_STAR, token_start, lexer->cursor); } }
+    else if (fk_r == 67) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_PERCENT, token_start, lexer->cursor); } }
+    else if (fk_r == 68) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_ASSIGN, token_start, lexer->cursor); } }
+    else if (fk_r == 69) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_LT, token_start, lexer->cursor); } }
+    else if (fk_r == 70) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_GT, token_start, lexer->cursor); } }
+    else if (fk_r == 71) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_NOT, token_start, lexer->cursor); } }
+    else if (fk_r == 72) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_BIT_AND, token_start, lexer->cursor); } }
+    else if (fk_r == 73) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_BIT_OR, token_start, lexer->cursor); } }
+    else if (fk_r == 74) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_BIT_XOR, token_start, lexer->cursor); } }
+    else if (fk_r == 75) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_BIT_NOT, token_start, lexer->cursor); } }
+    else if (fk_r == 76) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_QUESTION, token_start, lexer->cursor); } }
+    else if (fk_r == 77) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_COLON, token_start, lexer->cursor); } }
+    else if (fk_r == 78) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_LPAREN, token_start, lexer->cursor); } }
+    else if (fk_r == 79) { { lexer->prev_tok_state = PREV_TOK_NO_REGEX; return make_token(lexer, TOK_RPAREN, token_start, lexer->cursor); } }
+    else if (fk_r == 80) { {
+            if (lexer->in_template_expression) {
+                lexer->template_expr_depth++;
+            }
+            lexer->prev_tok_state = PREV_TOK_CAN_REGEX;
+            return make_token(lexer, TOK_LBRACE, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 81) { {
+            if (lexer->in_template_expression) {
+                if (lexer->template_expr_depth > 0) {
+                    lexer->template_expr_depth--;
+                    lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+                    return make_token(lexer, TOK_RBRACE, token_start, lexer->cursor);
+                }
+                if (lexer->template_nesting_depth > 0) {
+                    lexer->template_nesting_depth--;
+                }
+                lexer->in_template_expression = (lexer->template_nesting_depth > 0);
+                Token tpl = lex_template_segment(lexer, false);
+                if (tpl.type == TOK_ERROR) {
+                    return tpl;
+                }
+                if (lexer->template_nesting_depth > 0) {
+                    lexer->in_template_expression = true;
+                }
+                return tpl;
+            }
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_RBRACE, token_start, lexer->cursor);
+        } }
+    else if (fk_r == 82) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_LBRACKET, token_start, lexer->cursor); } }
+    else if (fk_r == 83) { { lexer->prev_tok_state = PREV_TOK_NO_REGEX; return make_token(lexer, TOK_RBRACKET, token_start, lexer->cursor); } }
+    else if (fk_r == 84) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_SEMICOLON, token_start, lexer->cursor); } }
+    else if (fk_r == 85) { { lexer->prev_tok_state = PREV_TOK_CAN_REGEX; return make_token(lexer, TOK_COMMA, token_start, lexer->cursor); } }
+    else if (fk_r == 86) { { lexer->prev_tok_state = PREV_TOK_NO_REGEX; return make_token(lexer, TOK_DOT, token_start, lexer->cursor); } }
+    else if (fk_r == 87) { { return make_token(lexer, TOK_EOF, token_start, token_start); } }
+    else if (fk_r == 88) { {
+            lexer->prev_tok_state = PREV_TOK_NO_REGEX;
+            return make_token(lexer, TOK_ERROR, token_start, lexer->cursor);
+        } }
+    else { fprintf(stderr, "fakere2c: no rule matched\n"); abort(); }
+}
+    }
+}
+
+// Token 类型转字符串
+const char *token_type_to_string(TokenType type) {
+    switch (type) {
+#define TOKEN(name, bison, type, display, attrs) case TOK_##name: return display;
+#define FIXED_TOKEN(name, code, display, attrs) case TOK_##name: return display;
+#define LEX_TOKEN(name, display, attrs) case TOK_##name: return display;
+#include "tokens.def"
+        default: return "UNKNOWN";
+    }
+}
+
+// 按 token 编码索引的属性表（TOKATTR_*）
+const uint8_t token_attr_table[TOKEN_CODE_LIMIT] = {
+#define TOKEN(name, bison, type, display, attrs) [TOK_##name] = (attrs),
+#define FIXED_TOKEN(name, code, display, attrs) [TOK_##name] = (attrs),
+#define LEX_TOKEN(name, display, attrs) [TOK_##name] = (attrs),
+#include "tokens.def"
+};
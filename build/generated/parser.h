@@ -0,0 +1,186 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Skeleton interface for Bison GLR parsers in C
+
+   Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+#ifndef YY_YY_BUILD_GENERATED_PARSER_H_INCLUDED
+# define YY_YY_BUILD_GENERATED_PARSER_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 598 "build/generated/parser.y"
+
+    #include "ast.h"
+    #include "postfix_suffix.h"
+    #include "binary_chain.h"
+    #ifndef JS_PARSER_DEFINED
+    #define JS_PARSER_DEFINED
+    typedef struct JSParser JSParser;
+    #endif
+    #ifndef JS_METHOD_INFO_DEFINED
+    #define JS_METHOD_INFO_DEFINED
+    typedef struct MethodInfo MethodInfo;
+    #endif
+
+#line 58 "build/generated/parser.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 334,                 /* "invalid token"  */
+    VAR = 258,                     /* VAR  */
+    LET = 259,                     /* LET  */
+    CONST = 260,                   /* CONST  */
+    FUNCTION = 261,                /* FUNCTION  */
+    FUNCTION_DECL = 262,           /* FUNCTION_DECL  */
+    IF = 263,                      /* IF  */
+    ELSE = 264,                    /* ELSE  */
+    FOR = 265,                     /* FOR  */
+    RETURN = 266,                  /* RETURN  */
+    ASYNC = 267,                   /* ASYNC  */
+    AWAIT = 268,                   /* AWAIT  */
+    IMPORT = 269,                  /* IMPORT  */
+    EXPORT = 270,                  /* EXPORT  */
+    WHILE = 271,                   /* WHILE  */
+    DO = 272,                      /* DO  */
+    BREAK = 273,                   /* BREAK  */
+    CONTINUE = 274,                /* CONTINUE  */
+    SWITCH = 275,                  /* SWITCH  */
+    CASE = 276,                    /* CASE  */
+    DEFAULT = 277,                 /* DEFAULT  */
+    TRY = 278,                     /* TRY  */
+    CATCH = 279,                   /* CATCH  */
+    FINALLY = 280,                 /* FINALLY  */
+    THROW = 281,                   /* THROW  */
+    NEW = 282,                     /* NEW  */
+    THIS = 283,                    /* THIS  */
+    TYPEOF = 284,                  /* TYPEOF  */
+    DELETE = 285,                  /* DELETE  */
+    IN = 286,                      /* IN  */
+    INSTANCEOF = 287,              /* INSTANCEOF  */
+    VOID = 288,                    /* VOID  */
+    WITH = 289,                    /* WITH  */
+    DEBUGGER = 290,                /* DEBUGGER  */
+    CLASS = 291,                   /* CLASS  */
+    EXTENDS = 292,                 /* EXTENDS  */
+    SUPER = 293,                   /* SUPER  */
+    YIELD = 294,                   /* YIELD  */
+    TRUE = 295,                    /* TRUE  */
+    FALSE = 296,                   /* FALSE  */
+    NULL_T = 297,                  /* NULL_T  */
+    UNDEFINED = 298,               /* UNDEFINED  */
+    IDENTIFIER = 299,              /* IDENTIFIER  */
+    NUMBER = 300,                  /* NUMBER  */
+    STRING = 301,                  /* STRING  */
+    REGEX = 302,                   /* REGEX  */
+    TEMPLATE_NO_SUB = 303,         /* TEMPLATE_NO_SUB  */
+    TEMPLATE_HEAD = 304,           /* TEMPLATE_HEAD  */
+    TEMPLATE_MIDDLE = 305,         /* TEMPLATE_MIDDLE  */
+    TEMPLATE_TAIL = 306,           /* TEMPLATE_TAIL  */
+    PLUS_PLUS = 307,               /* PLUS_PLUS  */
+    MINUS_MINUS = 308,             /* MINUS_MINUS  */
+    EQ = 309,                      /* EQ  */
+    NE = 310,                      /* NE  */
+    EQ_STRICT = 311,               /* EQ_STRICT  */
+    NE_STRICT = 312,               /* NE_STRICT  */
+    LE = 313,                      /* LE  */
+    GE = 314,                      /* GE  */
+    AND = 315,                     /* AND  */
+    OR = 316,                      /* OR  */
+    LSHIFT = 317,                  /* LSHIFT  */
+    RSHIFT = 318,                  /* RSHIFT  */
+    URSHIFT = 319,                 /* URSHIFT  */
+    PLUS_ASSIGN = 320,             /* PLUS_ASSIGN  */
+    MINUS_ASSIGN = 321,            /* MINUS_ASSIGN  */
+    STAR_ASSIGN = 322,             /* STAR_ASSIGN  */
+    SLASH_ASSIGN = 323,            /* SLASH_ASSIGN  */
+    PERCENT_ASSIGN = 324,          /* PERCENT_ASSIGN  */
+    AND_ASSIGN = 325,              /* AND_ASSIGN  */
+    OR_ASSIGN = 326,               /* OR_ASSIGN  */
+    XOR_ASSIGN = 327,              /* XOR_ASSIGN  */
+    LSHIFT_ASSIGN = 328,           /* LSHIFT_ASSIGN  */
+    RSHIFT_ASSIGN = 329,           /* RSHIFT_ASSIGN  */
+    URSHIFT_ASSIGN = 330,          /* URSHIFT_ASSIGN  */
+    ARROW = 331,                   /* ARROW  */
+    ELLIPSIS = 332,                /* ELLIPSIS  */
+    ARROW_HEAD = 333,              /* ARROW_HEAD  */
+    UMINUS = 335,                  /* UMINUS  */
+    IF_NO_ELSE = 336               /* IF_NO_ELSE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 612 "build/generated/parser.y"
+
+    ASTNode *node;
+    ASTList *list;
+    char *str;          // 自有字符串（字符串/数字字面量等），丢弃时 free
+    const char *atom;   // 名字（标识符、属性名），驻留表持有
+    int boolean;
+    PostfixSuffix *suffix;
+    BinaryChain *chain;
+    const BinaryOperator *binop;
+    MethodInfo *method;
+    size_t count;       // 只验证语法时参数表只记个数
+
+#line 168 "build/generated/parser.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+int yyparse (JSParser *ctx);
+/* "%code provides" blocks.  */
+#line 593 "build/generated/parser.y"
+
+    int yylex(YYSTYPE *lvalp, JSParser *ctx);
+    void yyerror(JSParser *ctx, const char *s);
+
+#line 185 "build/generated/parser.h"
+
+#endif /* !YY_YY_BUILD_GENERATED_PARSER_H_INCLUDED  */
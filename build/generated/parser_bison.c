@@ -0,0 +1,8842 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Skeleton implementation for Bison GLR parsers in C
+
+   Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C GLR parser skeleton written by Paul Hilfinger.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "glr.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+
+
+
+
+
+/* First part of user prologue.  */
+#line 14 "build/generated/parser.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "ast.h"
+#include "parser_context.h"
+#include "postfix_suffix.h"
+#include "binary_chain.h"
+
+// 序言先于 %code provides 输出，这里需要单独声明
+void yyerror(JSParser *ctx, const char *s);
+
+#ifndef JS_PARSER_FAST
+// --glr-stats / --glr-trace 的钩子（GLR_STATS_HOOK）由 gen_tokens --glr-hooks 插入生成的 parser.c；
+// glr.c 的跟踪文本经过 YYFPRINTF，只在 JS_PARSER_TRACE 时输出
+#include "glr_stats.h"
+#define YYFPRINTF glr_trace_fprintf
+#endif
+
+#ifndef YYMAXDEPTH
+#define YYMAXDEPTH 10000000 /* Allow deep GLR stacks for 10^5-level nesting; member/call chains are left-recursive and stay shallow */
+#endif
+
+#ifndef YYINITDEPTH
+#ifdef JS_PARSER_FAST
+#define YYINITDEPTH 256     /* 推送式解析器的初始栈嵌在 pstate 里，不够时按倍数扩容 */
+#else
+// GLR 栈的初始容量按本次 yyparse 要解析的 token 数估计（parser_fast_path.c 设置），不够时 glr.c 倍增；
+// 骨架只在 yyparse 里用到 YYINITDEPTH，ctx 在作用域内
+#define YYINITDEPTH (ctx->glr_initial_depth)
+#endif
+#endif
+
+// 语句分段解析时顶层语句的归约需要知道：动作是否立即执行（GLR 分裂期间动作延后，yynormal 为假），
+// 以及当前是否已读入前瞻 token（两个解析器的“无前瞻”常量名字不同）
+#if defined(JS_PARSER_FAST) && defined(JS_PARSER_VALIDATE)
+#define PARSER_NO_LOOKAHEAD JSFASTVALIDATE_EMPTY
+#define PARSER_ACTION_IMMEDIATE 1
+#elif defined(JS_PARSER_FAST)
+#define PARSER_NO_LOOKAHEAD JSFAST_EMPTY
+#define PARSER_ACTION_IMMEDIATE 1
+#elif defined(JS_PARSER_VALIDATE)
+#define PARSER_NO_LOOKAHEAD JSVALIDATE_EMPTY
+#define PARSER_ACTION_IMMEDIATE yynormal
+#else
+#define PARSER_NO_LOOKAHEAD YYEMPTY
+#define PARSER_ACTION_IMMEDIATE yynormal
+#endif
+
+// 分段解析：每归约出一条顶层语句就结束本段，已读入的前瞻 token 留给下一段
+#define END_STATEMENT_SEGMENT(items)                                        \
+    do {                                                                    \
+        if (ctx->statement_mode && PARSER_ACTION_IMMEDIATE) {               \
+            ctx->statement_items = (items);                                 \
+            ctx->statement_lookahead = (yychar != PARSER_NO_LOOKAHEAD);     \
+            yyclearin;                                                      \
+            YYACCEPT;                                                       \
+        }                                                                   \
+    } while (0)
+
+#ifdef JS_PARSER_FAST
+// 快速路径放弃一条语句时，栈上已建好的部分 AST 由 %destructor 释放
+static void discard_suffix_chain(PostfixSuffix *chain) {
+    if (chain) {
+        PostfixSuffix *tail = chain;
+        chain = tail->next;
+        tail->next = NULL;
+    }
+    while (chain) {
+        PostfixSuffix *next = chain->next;
+        switch (chain->kind) {
+            case POSTFIX_SUFFIX_COMPUTED:
+                ast_free(chain->data.computed_expr);
+                break;
+            case POSTFIX_SUFFIX_CALL:
+                ast_list_free(chain->data.arguments);
+                break;
+            case POSTFIX_SUFFIX_TEMPLATE:
+                ast_free(chain->data.template_literal);
+                break;
+            case POSTFIX_SUFFIX_PROP:
+                break;
+        }
+        free(chain);
+        chain = next;
+    }
+}
+
+static void discard_binary_chain(BinaryChain *chain) {
+    for (size_t i = 0; i < chain->count; i++) {
+        ast_free(chain->items[i].operand);
+    }
+    free(chain);
+}
+#endif
+
+// 方法定义在类元素/对象属性的修饰符都检查完之后才构造节点，此前名字、修饰符、参数与函数体都放在这里
+#ifndef JS_METHOD_INFO_DEFINED
+#define JS_METHOD_INFO_DEFINED
+typedef struct MethodInfo MethodInfo;
+#endif
+struct MethodInfo {
+    const char *name;
+    ASTNode *computed_key;
+    bool computed;
+    bool is_generator;
+    bool is_async;
+    bool is_static;
+    ASTMethodKind kind;
+    ASTList *params;
+    ASTNode *body;
+    size_t param_count;         // 只验证语法时没有参数表，只有个数
+};
+
+static ASTNode *wrap_destructuring_target(ASTNode *target) {
+    if (!target) {
+        return NULL;
+    }
+    if (target->type == AST_OBJECT_BINDING || target->type == AST_ARRAY_BINDING) {
+        return ast_make_binding_pattern(target, NULL);
+    }
+    return target;
+}
+
+static ASTNode *make_binding_with_initializer(ASTNode *target, ASTNode *initializer);
+static ASTNode *convert_assignment_target(ASTNode *expr, bool allow_object_literal);
+static ASTNode *convert_array_literal_to_binding(ASTNode *expr, bool allow_object_literal);
+static ASTNode *convert_object_literal_to_binding(ASTNode *expr);
+
+static ASTNode *make_binding_with_initializer(ASTNode *target, ASTNode *initializer) {
+    if (!target) {
+        return NULL;
+    }
+    if (target->type == AST_BINDING_PATTERN) {
+        if (initializer && !target->data.binding_pattern.initializer) {
+            target->data.binding_pattern.initializer = initializer;
+        }
+        return target;
+    }
+    return ast_make_binding_pattern(target, initializer);
+}
+
+static ASTNode *convert_assignment_target(ASTNode *expr, bool allow_object_literal) {
+    if (!expr) {
+        return NULL;
+    }
+    switch (expr->type) {
+        case AST_IDENTIFIER:
+            return expr;
+        case AST_ARRAY_LITERAL:
+            return convert_array_literal_to_binding(expr, allow_object_literal);
+        case AST_OBJECT_LITERAL:
+            return allow_object_literal ? convert_object_literal_to_binding(expr) : NULL;
+        case AST_ASSIGN_EXPR:
+            if (expr->data.assign.op && strcmp(expr->data.assign.op, "=") == 0) {
+                ASTNode *lhs = convert_assignment_target(expr->data.assign.left, allow_object_literal);
+                if (!lhs) {
+                    return NULL;
+                }
+                return make_binding_with_initializer(lhs, expr->data.assign.right);
+            }
+            return NULL;
+        default:
+            return NULL;
+    }
+}
+
+static ASTNode *convert_array_literal_to_binding(ASTNode *expr, bool allow_object_literal) {
+    if (!expr || expr->type != AST_ARRAY_LITERAL) {
+        return NULL;
+    }
+    ASTList *converted = NULL;
+    ASTList *elem = expr->data.array_literal.elements;
+    while (elem) {
+        ASTNode *item = elem->node;
+        if (!item) {
+            elem = elem->next;
+            continue;
+        }
+        ASTNode *converted_item = NULL;
+        if (item->type == AST_ARRAY_HOLE) {
+            converted_item = ast_make_array_hole();
+        } else if (item->type == AST_SPREAD_ELEMENT) {
+            ASTNode *rest_target = convert_assignment_target(item->data.spread_element.argument, allow_object_literal);
+            if (!rest_target) {
+                return NULL;
+            }
+            converted_item = ast_make_rest_element(rest_target);
+        } else {
+            ASTNode *init = NULL;
+            ASTNode *value = item;
+            if (item->type == AST_ASSIGN_EXPR && item->data.assign.op &&
+                strcmp(item->data.assign.op, "=") == 0) {
+                value = item->data.assign.left;
+                init = item->data.assign.right;
+            }
+            ASTNode *target = convert_assignment_target(value, allow_object_literal);
+            if (!target) {
+                return NULL;
+            }
+            converted_item = make_binding_with_initializer(target, init);
+        }
+        converted = ast_list_append(converted, converted_item);
+        elem = elem->next;
+    }
+    return ast_make_array_binding(converted);
+}
+
+static ASTNode *convert_object_literal_to_binding(ASTNode *expr) {
+    if (!expr || expr->type != AST_OBJECT_LITERAL) {
+        return NULL;
+    }
+    ASTList *converted = NULL;
+    for (ASTList *prop = expr->data.object_literal.properties; prop; prop = prop->next) {
+        ASTNode *item = prop->node;
+        if (!item) {
+            continue;
+        }
+        if (item->type == AST_SPREAD_ELEMENT) {
+            ASTNode *rest_target = convert_assignment_target(item->data.spread_element.argument, true);
+            if (!rest_target) {
+                return NULL;
+            }
+            converted = ast_list_append(converted, ast_make_rest_element(rest_target));
+            continue;
+        }
+        if (item->type != AST_PROPERTY) {
+            return NULL;
+        }
+        bool is_identifier_key = item->data.property.key.is_identifier;
+        const char *key = item->data.property.key.name;
+        ASTNode *value = item->data.property.value;
+        ASTNode *init = NULL;
+        ASTNode *binding_target = NULL;
+        if (value && value->type == AST_ASSIGN_EXPR && value->data.assign.op &&
+            strcmp(value->data.assign.op, "=") == 0) {
+            binding_target = convert_assignment_target(value->data.assign.left, true);
+            init = value->data.assign.right;
+        } else {
+            binding_target = convert_assignment_target(value, true);
+        }
+        if (!binding_target) {
+            return NULL;
+        }
+        ASTNode *binding_value = make_binding_with_initializer(binding_target, init);
+        bool shorthand = false;
+        if (is_identifier_key && value && value->type == AST_IDENTIFIER && item->data.property.key.name) {
+            shorthand = item->data.property.key.name == value->data.identifier.name;
+        }
+        converted = ast_list_append(converted,
+                                    ast_make_binding_property(key, is_identifier_key, binding_value, shorthand));
+    }
+    return ast_make_object_binding(converted);
+}
+
+static PostfixSuffix *alloc_suffix(PostfixSuffixKind kind) {
+    PostfixSuffix *suffix = (PostfixSuffix *)calloc(1, sizeof(PostfixSuffix));
+    if (!suffix) {
+        fprintf(stderr, "Out of memory while building postfix suffix chain\n");
+        exit(EXIT_FAILURE);
+    }
+    suffix->kind = kind;
+    suffix->next = suffix;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_prop(const char *name) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_PROP);
+    suffix->data.property_name = name;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_computed(ASTNode *expr) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_COMPUTED);
+    suffix->data.computed_expr = expr;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_call(ASTList *args) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_CALL);
+    suffix->data.arguments = args;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_template(ASTNode *literal) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_TEMPLATE);
+    suffix->data.template_literal = literal;
+    return suffix;
+}
+
+// 后缀链按环形链表保存、以最后一项代表整条链，追加是 O(1)：
+// 十万级的 a.b(c).d[e]... 链不会因为每次找尾而变成平方时间
+static PostfixSuffix *append_suffix(PostfixSuffix *tail, PostfixSuffix *item) {
+    if (!item) {
+        return tail;
+    }
+    if (tail) {
+        item->next = tail->next;
+        tail->next = item;
+    }
+    return item;
+}
+
+static ASTNode *apply_suffix_chain(ASTNode *base, PostfixSuffix *chain) {
+    PostfixSuffix *current = NULL;
+    if (chain) {
+        current = chain->next;
+        chain->next = NULL;
+    }
+    while (current) {
+        PostfixSuffix *next = current->next;
+        switch (current->kind) {
+            case POSTFIX_SUFFIX_PROP:
+                base = ast_make_member(base, ast_make_identifier(current->data.property_name), false);
+                break;
+            case POSTFIX_SUFFIX_COMPUTED:
+                base = ast_make_member(base, current->data.computed_expr, true);
+                break;
+            case POSTFIX_SUFFIX_CALL:
+                base = ast_make_call(base, current->data.arguments);
+                break;
+            case POSTFIX_SUFFIX_TEMPLATE:
+                base = ast_make_tagged_template(base, current->data.template_literal);
+                break;
+        }
+        free(current);
+        current = next;
+    }
+    return base;
+}
+
+// 二元运算符优先级（与原先逐级展开的文法一致：** 与 * / % 同级且左结合）
+enum
+{
+    BINOP_OR, BINOP_AND, BINOP_BIT_OR, BINOP_BIT_XOR, BINOP_BIT_AND,
+    BINOP_EQ, BINOP_NE, BINOP_EQ_STRICT, BINOP_NE_STRICT,
+    BINOP_LT, BINOP_GT, BINOP_LE, BINOP_GE, BINOP_INSTANCEOF, BINOP_IN,
+    BINOP_LSHIFT, BINOP_RSHIFT, BINOP_URSHIFT,
+    BINOP_ADD, BINOP_SUB, BINOP_MUL, BINOP_EXP, BINOP_DIV, BINOP_MOD
+};
+
+static const BinaryOperator binary_operators[] = {
+    [BINOP_OR] = {"||", 1},
+    [BINOP_AND] = {"&&", 2},
+    [BINOP_BIT_OR] = {"|", 3},
+    [BINOP_BIT_XOR] = {"^", 4},
+    [BINOP_BIT_AND] = {"&", 5},
+    [BINOP_EQ] = {"==", 6},
+    [BINOP_NE] = {"!=", 6},
+    [BINOP_EQ_STRICT] = {"===", 6},
+    [BINOP_NE_STRICT] = {"!==", 6},
+    [BINOP_LT] = {"<", 7},
+    [BINOP_GT] = {">", 7},
+    [BINOP_LE] = {"<=", 7},
+    [BINOP_GE] = {">=", 7},
+    [BINOP_INSTANCEOF] = {"instanceof", 7},
+    [BINOP_IN] = {"in", 7},
+    [BINOP_LSHIFT] = {"<<", 8},
+    [BINOP_RSHIFT] = {">>", 8},
+    [BINOP_URSHIFT] = {">>>", 8},
+    [BINOP_ADD] = {"+", 9},
+    [BINOP_SUB] = {"-", 9},
+    [BINOP_MUL] = {"*", 10},
+    [BINOP_EXP] = {"**", 10},
+    [BINOP_DIV] = {"/", 10},
+    [BINOP_MOD] = {"%", 10},
+};
+
+static BinaryChain *binary_chain_append(BinaryChain *chain, const BinaryOperator *op, ASTNode *operand) {
+    size_t count = chain ? chain->count : 0;
+    if (!chain || count == chain->capacity) {
+        size_t capacity = chain ? chain->capacity * 2 : 4;
+        BinaryChain *grown = (BinaryChain *)realloc(chain, sizeof(BinaryChain) + capacity * sizeof(BinaryChainItem));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while building binary expression\n");
+            exit(EXIT_FAILURE);
+        }
+        grown->count = count;
+        grown->capacity = capacity;
+        chain = grown;
+    }
+    chain->items[count].op = op;
+    chain->items[count].operand = operand;
+    chain->count = count + 1;
+    return chain;
+}
+
+// 优先级爬升：从 *next 开始吸收优先级不低于 min_precedence 的运算符，
+// 右操作数后面跟着更紧的运算符时先递归把它们结合进右操作数（递归深度不超过优先级层数）
+static ASTNode *climb_binary_chain(const BinaryChain *chain, size_t *next, ASTNode *left, int min_precedence) {
+    while (*next < chain->count && chain->items[*next].op->precedence >= min_precedence) {
+        const BinaryOperator *op = chain->items[*next].op;
+        ASTNode *right = chain->items[(*next)++].operand;
+        while (*next < chain->count && chain->items[*next].op->precedence > op->precedence) {
+            right = climb_binary_chain(chain, next, right, op->precedence + 1);
+        }
+        left = ast_make_binary(op->op, left, right);
+    }
+    return left;
+}
+
+static ASTNode *fold_binary_chain(BinaryChain *chain) {
+    size_t next = 1;
+    ASTNode *result = climb_binary_chain(chain, &next, chain->items[0].operand, 0);
+    free(chain);
+    return result;
+}
+
+// 方法名与修饰符放在堆上，语义值只是一个指针（YYSTYPE 保持指针大小）；build_method_node 接管并释放
+static MethodInfo *method_info_alloc(const char *name, ASTNode *computed_key, bool computed) {
+    MethodInfo *info = (MethodInfo *)malloc(sizeof(MethodInfo));
+    if (!info) {
+        fprintf(stderr, "Out of memory while constructing method\n");
+        exit(EXIT_FAILURE);
+    }
+    info->name = name;
+    info->computed_key = computed_key;
+    info->computed = computed;
+    info->is_generator = false;
+    info->is_async = false;
+    info->is_static = false;
+    info->kind = AST_METHOD_KIND_NORMAL;
+    info->params = NULL;
+    info->body = NULL;
+    info->param_count = 0;
+    return info;
+}
+
+static void method_info_free(MethodInfo *info) {
+    if (info) {
+        ast_free(info->computed_key);
+        ast_list_free(info->params);
+        ast_free(info->body);
+        free(info);
+    }
+}
+
+static MethodInfo *method_info_set_function(MethodInfo *info, ASTList *params, ASTNode *body) {
+    info->params = params;
+    info->body = body;
+    info->param_count = 0;
+    for (ASTList *param = params; param; param = param->next) {
+        info->param_count++;
+    }
+    return info;
+}
+
+#ifdef JS_PARSER_VALIDATE
+// 只验证语法：修饰符与参数个数检查完就丢掉，不构造节点
+static ASTList *make_single_param_list(ASTNode *param) {
+    (void)param;
+    return NULL;
+}
+
+static ASTNode *build_method_node(MethodInfo *info) {
+    method_info_free(info);
+    return NULL;
+}
+#else
+static ASTList *make_single_param_list(ASTNode *param) {
+    ASTList *list = NULL;
+    return ast_list_append(list, param);
+}
+
+static ASTNode *build_method_node(MethodInfo *info) {
+    ASTNode *func = ast_make_function_expr(info->name, info->params, info->body);
+    if (info->is_generator && func) {
+        func->data.function_expr.is_generator = true;
+    }
+    if (info->is_async && func) {
+        func->data.function_expr.is_async = true;
+    }
+    ASTNode *method = ast_make_method_def(info->name,
+                                          info->computed_key,
+                                          info->computed,
+                                          info->is_static,
+                                          info->is_generator,
+                                          info->is_async,
+                                          info->kind,
+                                          func);
+    free(info);
+    return method;
+}
+#endif
+
+// 字符串属性键去掉引号；键是 atom，不能原地修改，去引号后的文本另行驻留
+static const char *unquote_property_key(JSParser *ctx, const char *key) {
+    size_t len = key ? strlen(key) : 0;
+    if (len >= 2 && (key[0] == '\'' || key[0] == '"')) {
+        return atom_intern(ctx->atoms, key + 1, len - 2);
+    }
+    return key;
+}
+
+// 名字都是 atom，与预置 atom 比较指针即可
+static bool identifier_is(const char *name, const char *atom) {
+    return name && name == atom;
+}
+
+static MethodInfo *mark_method_static(JSParser *ctx, MethodInfo *method) {
+    if (method->kind == AST_METHOD_KIND_CONSTRUCTOR) {
+        yyerror(ctx, "Class constructor cannot be static");
+        method_info_free(method);
+        return NULL;
+    }
+    method->is_static = true;
+    return method;
+}
+
+static MethodInfo *maybe_tag_constructor(JSParser *ctx, MethodInfo *method) {
+    if (!method->computed &&
+        method->name &&
+        identifier_is(method->name, ATOM(ctx->atoms, CONSTRUCTOR)) &&
+        !method->is_static) {
+        method->kind = AST_METHOD_KIND_CONSTRUCTOR;
+    }
+    return method;
+}
+
+static MethodInfo *apply_accessor_keyword(JSParser *ctx, MethodInfo *method, const char *keyword) {
+    ASTMethodKind kind;
+    if (identifier_is(keyword, ATOM(ctx->atoms, GET))) {
+        kind = AST_METHOD_KIND_GET;
+    } else if (identifier_is(keyword, ATOM(ctx->atoms, SET))) {
+        kind = AST_METHOD_KIND_SET;
+    } else {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(method);
+        return NULL;
+    }
+    if (kind == AST_METHOD_KIND_GET && method->param_count != 0) {
+        yyerror(ctx, "Getter must not have parameters");
+        method_info_free(method);
+        return NULL;
+    }
+    if (kind == AST_METHOD_KIND_SET && method->param_count != 1) {
+        yyerror(ctx, "Setter must have exactly one parameter");
+        method_info_free(method);
+        return NULL;
+    }
+    method->kind = kind;
+    return method;
+}
+
+static MethodInfo *handle_single_prefix(JSParser *ctx, const char *prefix, MethodInfo *method) {
+    MethodInfo *result = maybe_tag_constructor(ctx, method);
+    if (identifier_is(prefix, ATOM(ctx->atoms, STATIC))) {
+        result = mark_method_static(ctx, result);
+    } else if (identifier_is(prefix, ATOM(ctx->atoms, GET)) || identifier_is(prefix, ATOM(ctx->atoms, SET))) {
+        result = apply_accessor_keyword(ctx, result, prefix);
+    } else {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        result = NULL;
+    }
+    return result;
+}
+
+static MethodInfo *handle_double_prefix(JSParser *ctx, const char *first, const char *second, MethodInfo *method) {
+    MethodInfo *result = maybe_tag_constructor(ctx, method);
+    if (!identifier_is(first, ATOM(ctx->atoms, STATIC))) {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        return NULL;
+    }
+    result = mark_method_static(ctx, result);
+    if (!result) {
+        return NULL;
+    }
+    if (!(identifier_is(second, ATOM(ctx->atoms, GET)) || identifier_is(second, ATOM(ctx->atoms, SET)))) {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        return NULL;
+    }
+    return apply_accessor_keyword(ctx, result, second);
+}
+
+#line 637 "build/generated/parser_bison.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parser.h"
+
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_VAR = 3,                        /* VAR  */
+  YYSYMBOL_LET = 4,                        /* LET  */
+  YYSYMBOL_CONST = 5,                      /* CONST  */
+  YYSYMBOL_FUNCTION = 6,                   /* FUNCTION  */
+  YYSYMBOL_FUNCTION_DECL = 7,              /* FUNCTION_DECL  */
+  YYSYMBOL_IF = 8,                         /* IF  */
+  YYSYMBOL_ELSE = 9,                       /* ELSE  */
+  YYSYMBOL_FOR = 10,                       /* FOR  */
+  YYSYMBOL_RETURN = 11,                    /* RETURN  */
+  YYSYMBOL_ASYNC = 12,                     /* ASYNC  */
+  YYSYMBOL_AWAIT = 13,                     /* AWAIT  */
+  YYSYMBOL_IMPORT = 14,                    /* IMPORT  */
+  YYSYMBOL_EXPORT = 15,                    /* EXPORT  */
+  YYSYMBOL_WHILE = 16,                     /* WHILE  */
+  YYSYMBOL_DO = 17,                        /* DO  */
+  YYSYMBOL_BREAK = 18,                     /* BREAK  */
+  YYSYMBOL_CONTINUE = 19,                  /* CONTINUE  */
+  YYSYMBOL_SWITCH = 20,                    /* SWITCH  */
+  YYSYMBOL_CASE = 21,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 22,                   /* DEFAULT  */
+  YYSYMBOL_TRY = 23,                       /* TRY  */
+  YYSYMBOL_CATCH = 24,                     /* CATCH  */
+  YYSYMBOL_FINALLY = 25,                   /* FINALLY  */
+  YYSYMBOL_THROW = 26,                     /* THROW  */
+  YYSYMBOL_NEW = 27,                       /* NEW  */
+  YYSYMBOL_THIS = 28,                      /* THIS  */
+  YYSYMBOL_TYPEOF = 29,                    /* TYPEOF  */
+  YYSYMBOL_DELETE = 30,                    /* DELETE  */
+  YYSYMBOL_IN = 31,                        /* IN  */
+  YYSYMBOL_INSTANCEOF = 32,                /* INSTANCEOF  */
+  YYSYMBOL_VOID = 33,                      /* VOID  */
+  YYSYMBOL_WITH = 34,                      /* WITH  */
+  YYSYMBOL_DEBUGGER = 35,                  /* DEBUGGER  */
+  YYSYMBOL_CLASS = 36,                     /* CLASS  */
+  YYSYMBOL_EXTENDS = 37,                   /* EXTENDS  */
+  YYSYMBOL_SUPER = 38,                     /* SUPER  */
+  YYSYMBOL_YIELD = 39,                     /* YIELD  */
+  YYSYMBOL_TRUE = 40,                      /* TRUE  */
+  YYSYMBOL_FALSE = 41,                     /* FALSE  */
+  YYSYMBOL_NULL_T = 42,                    /* NULL_T  */
+  YYSYMBOL_UNDEFINED = 43,                 /* UNDEFINED  */
+  YYSYMBOL_IDENTIFIER = 44,                /* IDENTIFIER  */
+  YYSYMBOL_NUMBER = 45,                    /* NUMBER  */
+  YYSYMBOL_STRING = 46,                    /* STRING  */
+  YYSYMBOL_REGEX = 47,                     /* REGEX  */
+  YYSYMBOL_TEMPLATE_NO_SUB = 48,           /* TEMPLATE_NO_SUB  */
+  YYSYMBOL_TEMPLATE_HEAD = 49,             /* TEMPLATE_HEAD  */
+  YYSYMBOL_TEMPLATE_MIDDLE = 50,           /* TEMPLATE_MIDDLE  */
+  YYSYMBOL_TEMPLATE_TAIL = 51,             /* TEMPLATE_TAIL  */
+  YYSYMBOL_PLUS_PLUS = 52,                 /* PLUS_PLUS  */
+  YYSYMBOL_MINUS_MINUS = 53,               /* MINUS_MINUS  */
+  YYSYMBOL_EQ = 54,                        /* EQ  */
+  YYSYMBOL_NE = 55,                        /* NE  */
+  YYSYMBOL_EQ_STRICT = 56,                 /* EQ_STRICT  */
+  YYSYMBOL_NE_STRICT = 57,                 /* NE_STRICT  */
+  YYSYMBOL_LE = 58,                        /* LE  */
+  YYSYMBOL_GE = 59,                        /* GE  */
+  YYSYMBOL_AND = 60,                       /* AND  */
+  YYSYMBOL_OR = 61,                        /* OR  */
+  YYSYMBOL_LSHIFT = 62,                    /* LSHIFT  */
+  YYSYMBOL_RSHIFT = 63,                    /* RSHIFT  */
+  YYSYMBOL_URSHIFT = 64,                   /* URSHIFT  */
+  YYSYMBOL_PLUS_ASSIGN = 65,               /* PLUS_ASSIGN  */
+  YYSYMBOL_MINUS_ASSIGN = 66,              /* MINUS_ASSIGN  */
+  YYSYMBOL_STAR_ASSIGN = 67,               /* STAR_ASSIGN  */
+  YYSYMBOL_SLASH_ASSIGN = 68,              /* SLASH_ASSIGN  */
+  YYSYMBOL_PERCENT_ASSIGN = 69,            /* PERCENT_ASSIGN  */
+  YYSYMBOL_AND_ASSIGN = 70,                /* AND_ASSIGN  */
+  YYSYMBOL_OR_ASSIGN = 71,                 /* OR_ASSIGN  */
+  YYSYMBOL_XOR_ASSIGN = 72,                /* XOR_ASSIGN  */
+  YYSYMBOL_LSHIFT_ASSIGN = 73,             /* LSHIFT_ASSIGN  */
+  YYSYMBOL_RSHIFT_ASSIGN = 74,             /* RSHIFT_ASSIGN  */
+  YYSYMBOL_URSHIFT_ASSIGN = 75,            /* URSHIFT_ASSIGN  */
+  YYSYMBOL_ARROW = 76,                     /* ARROW  */
+  YYSYMBOL_ELLIPSIS = 77,                  /* ELLIPSIS  */
+  YYSYMBOL_ARROW_HEAD = 78,                /* ARROW_HEAD  */
+  YYSYMBOL_79_ = 79,                       /* '='  */
+  YYSYMBOL_80_ = 80,                       /* '?'  */
+  YYSYMBOL_81_ = 81,                       /* ':'  */
+  YYSYMBOL_82_ = 82,                       /* '|'  */
+  YYSYMBOL_83_ = 83,                       /* '^'  */
+  YYSYMBOL_84_ = 84,                       /* '&'  */
+  YYSYMBOL_85_ = 85,                       /* '<'  */
+  YYSYMBOL_86_ = 86,                       /* '>'  */
+  YYSYMBOL_87_ = 87,                       /* '+'  */
+  YYSYMBOL_88_ = 88,                       /* '-'  */
+  YYSYMBOL_89_ = 89,                       /* '*'  */
+  YYSYMBOL_90_ = 90,                       /* '/'  */
+  YYSYMBOL_91_ = 91,                       /* '%'  */
+  YYSYMBOL_UMINUS = 92,                    /* UMINUS  */
+  YYSYMBOL_93_ = 93,                       /* '!'  */
+  YYSYMBOL_94_ = 94,                       /* '~'  */
+  YYSYMBOL_IF_NO_ELSE = 95,                /* IF_NO_ELSE  */
+  YYSYMBOL_96_ = 96,                       /* ';'  */
+  YYSYMBOL_97_ = 97,                       /* ','  */
+  YYSYMBOL_98_ = 98,                       /* '{'  */
+  YYSYMBOL_99_ = 99,                       /* '}'  */
+  YYSYMBOL_100_ = 100,                     /* '('  */
+  YYSYMBOL_101_ = 101,                     /* ')'  */
+  YYSYMBOL_102_ = 102,                     /* '.'  */
+  YYSYMBOL_103_ = 103,                     /* '['  */
+  YYSYMBOL_104_ = 104,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 105,                 /* $accept  */
+  YYSYMBOL_program = 106,                  /* program  */
+  YYSYMBOL_module_item_list = 107,         /* module_item_list  */
+  YYSYMBOL_module_item = 108,              /* module_item  */
+  YYSYMBOL_stmt_list = 109,                /* stmt_list  */
+  YYSYMBOL_stmt = 110,                     /* stmt  */
+  YYSYMBOL_import_stmt = 111,              /* import_stmt  */
+  YYSYMBOL_import_clause = 112,            /* import_clause  */
+  YYSYMBOL_named_imports = 113,            /* named_imports  */
+  YYSYMBOL_import_specifier_list = 114,    /* import_specifier_list  */
+  YYSYMBOL_import_specifier = 115,         /* import_specifier  */
+  YYSYMBOL_import_default_binding = 116,   /* import_default_binding  */
+  YYSYMBOL_namespace_import = 117,         /* namespace_import  */
+  YYSYMBOL_module_specifier = 118,         /* module_specifier  */
+  YYSYMBOL_export_stmt = 119,              /* export_stmt  */
+  YYSYMBOL_export_clause = 120,            /* export_clause  */
+  YYSYMBOL_export_specifier_list = 121,    /* export_specifier_list  */
+  YYSYMBOL_export_specifier = 122,         /* export_specifier  */
+  YYSYMBOL_from_keyword = 123,             /* from_keyword  */
+  YYSYMBOL_as_keyword = 124,               /* as_keyword  */
+  YYSYMBOL_block = 125,                    /* block  */
+  YYSYMBOL_var_stmt = 126,                 /* var_stmt  */
+  YYSYMBOL_var_stmt_no_in = 127,           /* var_stmt_no_in  */
+  YYSYMBOL_var_decl_list = 128,            /* var_decl_list  */
+  YYSYMBOL_var_decl_list_no_in = 129,      /* var_decl_list_no_in  */
+  YYSYMBOL_var_decl = 130,                 /* var_decl  */
+  YYSYMBOL_var_decl_no_in = 131,           /* var_decl_no_in  */
+  YYSYMBOL_return_stmt = 132,              /* return_stmt  */
+  YYSYMBOL_if_stmt = 133,                  /* if_stmt  */
+  YYSYMBOL_for_stmt = 134,                 /* for_stmt  */
+  YYSYMBOL_while_stmt = 135,               /* while_stmt  */
+  YYSYMBOL_do_stmt = 136,                  /* do_stmt  */
+  YYSYMBOL_for_init = 137,                 /* for_init  */
+  YYSYMBOL_for_in_left = 138,              /* for_in_left  */
+  YYSYMBOL_for_of_keyword = 139,           /* for_of_keyword  */
+  YYSYMBOL_opt_expr = 140,                 /* opt_expr  */
+  YYSYMBOL_switch_stmt = 141,              /* switch_stmt  */
+  YYSYMBOL_switch_case_list = 142,         /* switch_case_list  */
+  YYSYMBOL_switch_case = 143,              /* switch_case  */
+  YYSYMBOL_case_stmt_seq = 144,            /* case_stmt_seq  */
+  YYSYMBOL_generator_marker_opt = 145,     /* generator_marker_opt  */
+  YYSYMBOL_async_modifier_opt = 146,       /* async_modifier_opt  */
+  YYSYMBOL_func_decl = 147,                /* func_decl  */
+  YYSYMBOL_opt_param_list = 148,           /* opt_param_list  */
+  YYSYMBOL_param_list = 149,               /* param_list  */
+  YYSYMBOL_param_list_items = 150,         /* param_list_items  */
+  YYSYMBOL_rest_param = 151,               /* rest_param  */
+  YYSYMBOL_catch_clause = 152,             /* catch_clause  */
+  YYSYMBOL_catch_parameter = 153,          /* catch_parameter  */
+  YYSYMBOL_finally_clause = 154,           /* finally_clause  */
+  YYSYMBOL_finally_clause_opt = 155,       /* finally_clause_opt  */
+  YYSYMBOL_try_stmt = 156,                 /* try_stmt  */
+  YYSYMBOL_with_stmt = 157,                /* with_stmt  */
+  YYSYMBOL_labeled_stmt = 158,             /* labeled_stmt  */
+  YYSYMBOL_break_stmt = 159,               /* break_stmt  */
+  YYSYMBOL_continue_stmt = 160,            /* continue_stmt  */
+  YYSYMBOL_throw_stmt = 161,               /* throw_stmt  */
+  YYSYMBOL_expr = 162,                     /* expr  */
+  YYSYMBOL_expr_no_obj = 163,              /* expr_no_obj  */
+  YYSYMBOL_expr_no_in_no_obj = 164,        /* expr_no_in_no_obj  */
+  YYSYMBOL_assignment_expr = 165,          /* assignment_expr  */
+  YYSYMBOL_assignment_expr_no_in = 166,    /* assignment_expr_no_in  */
+  YYSYMBOL_assignment_expr_no_obj = 167,   /* assignment_expr_no_obj  */
+  YYSYMBOL_assignment_expr_no_in_no_obj = 168, /* assignment_expr_no_in_no_obj  */
+  YYSYMBOL_conditional_expr = 169,         /* conditional_expr  */
+  YYSYMBOL_conditional_expr_no_in = 170,   /* conditional_expr_no_in  */
+  YYSYMBOL_conditional_expr_no_obj = 171,  /* conditional_expr_no_obj  */
+  YYSYMBOL_conditional_expr_no_in_no_obj = 172, /* conditional_expr_no_in_no_obj  */
+  YYSYMBOL_binary_expr = 173,              /* binary_expr  */
+  YYSYMBOL_binary_expr_no_in = 174,        /* binary_expr_no_in  */
+  YYSYMBOL_binary_expr_no_obj = 175,       /* binary_expr_no_obj  */
+  YYSYMBOL_binary_expr_no_in_no_obj = 176, /* binary_expr_no_in_no_obj  */
+  YYSYMBOL_binary_chain = 177,             /* binary_chain  */
+  YYSYMBOL_binary_chain_no_in = 178,       /* binary_chain_no_in  */
+  YYSYMBOL_binary_chain_no_obj = 179,      /* binary_chain_no_obj  */
+  YYSYMBOL_binary_chain_no_in_no_obj = 180, /* binary_chain_no_in_no_obj  */
+  YYSYMBOL_binary_operator = 181,          /* binary_operator  */
+  YYSYMBOL_binary_operator_no_in = 182,    /* binary_operator_no_in  */
+  YYSYMBOL_unary_expr = 183,               /* unary_expr  */
+  YYSYMBOL_unary_expr_no_obj = 184,        /* unary_expr_no_obj  */
+  YYSYMBOL_postfix_expr = 185,             /* postfix_expr  */
+  YYSYMBOL_postfix_expr_no_obj = 186,      /* postfix_expr_no_obj  */
+  YYSYMBOL_left_hand_side_expr = 187,      /* left_hand_side_expr  */
+  YYSYMBOL_left_hand_side_expr_no_obj = 188, /* left_hand_side_expr_no_obj  */
+  YYSYMBOL_member_expr = 189,              /* member_expr  */
+  YYSYMBOL_member_expr_no_obj = 190,       /* member_expr_no_obj  */
+  YYSYMBOL_new_expr = 191,                 /* new_expr  */
+  YYSYMBOL_new_expr_no_obj = 192,          /* new_expr_no_obj  */
+  YYSYMBOL_call_expr = 193,                /* call_expr  */
+  YYSYMBOL_call_expr_no_obj = 194,         /* call_expr_no_obj  */
+  YYSYMBOL_member_suffix_seq = 195,        /* member_suffix_seq  */
+  YYSYMBOL_member_noncall_suffix = 196,    /* member_noncall_suffix  */
+  YYSYMBOL_call_suffix_seq = 197,          /* call_suffix_seq  */
+  YYSYMBOL_call_any_suffix = 198,          /* call_any_suffix  */
+  YYSYMBOL_call_suffix_initial = 199,      /* call_suffix_initial  */
+  YYSYMBOL_opt_arg_list = 200,             /* opt_arg_list  */
+  YYSYMBOL_arg_list = 201,                 /* arg_list  */
+  YYSYMBOL_arg_item = 202,                 /* arg_item  */
+  YYSYMBOL_primary_expr = 203,             /* primary_expr  */
+  YYSYMBOL_primary_expr_no_obj = 204,      /* primary_expr_no_obj  */
+  YYSYMBOL_function_expr = 205,            /* function_expr  */
+  YYSYMBOL_class_decl = 206,               /* class_decl  */
+  YYSYMBOL_class_expr = 207,               /* class_expr  */
+  YYSYMBOL_class_heritage_opt = 208,       /* class_heritage_opt  */
+  YYSYMBOL_class_body = 209,               /* class_body  */
+  YYSYMBOL_class_element_list_opt = 210,   /* class_element_list_opt  */
+  YYSYMBOL_class_element_list = 211,       /* class_element_list  */
+  YYSYMBOL_class_element = 212,            /* class_element  */
+  YYSYMBOL_method_definition = 213,        /* method_definition  */
+  YYSYMBOL_method_head = 214,              /* method_head  */
+  YYSYMBOL_getter_definition = 215,        /* getter_definition  */
+  YYSYMBOL_setter_definition = 216,        /* setter_definition  */
+  YYSYMBOL_method_name = 217,              /* method_name  */
+  YYSYMBOL_arrow_function = 218,           /* arrow_function  */
+  YYSYMBOL_arrow_body = 219,               /* arrow_body  */
+  YYSYMBOL_yield_expr = 220,               /* yield_expr  */
+  YYSYMBOL_array_literal = 221,            /* array_literal  */
+  YYSYMBOL_elision = 222,                  /* elision  */
+  YYSYMBOL_elision_opt = 223,              /* elision_opt  */
+  YYSYMBOL_element_list = 224,             /* element_list  */
+  YYSYMBOL_el_item = 225,                  /* el_item  */
+  YYSYMBOL_spread_element = 226,           /* spread_element  */
+  YYSYMBOL_opt_trailing_comma = 227,       /* opt_trailing_comma  */
+  YYSYMBOL_object_literal = 228,           /* object_literal  */
+  YYSYMBOL_template_literal = 229,         /* template_literal  */
+  YYSYMBOL_template_part_list = 230,       /* template_part_list  */
+  YYSYMBOL_prop_list = 231,                /* prop_list  */
+  YYSYMBOL_prop = 232,                     /* prop  */
+  YYSYMBOL_computed_property = 233,        /* computed_property  */
+  YYSYMBOL_property_name = 234,            /* property_name  */
+  YYSYMBOL_property_name_keyword = 235,    /* property_name_keyword  */
+  YYSYMBOL_binding_initializer_opt = 236,  /* binding_initializer_opt  */
+  YYSYMBOL_binding_initializer_opt_no_in = 237, /* binding_initializer_opt_no_in  */
+  YYSYMBOL_binding_element = 238,          /* binding_element  */
+  YYSYMBOL_object_binding = 239,           /* object_binding  */
+  YYSYMBOL_binding_property_sequence = 240, /* binding_property_sequence  */
+  YYSYMBOL_binding_property_list = 241,    /* binding_property_list  */
+  YYSYMBOL_binding_property = 242,         /* binding_property  */
+  YYSYMBOL_binding_rest_property = 243,    /* binding_rest_property  */
+  YYSYMBOL_array_binding = 244,            /* array_binding  */
+  YYSYMBOL_binding_element_list = 245,     /* binding_element_list  */
+  YYSYMBOL_binding_elision_opt = 246,      /* binding_elision_opt  */
+  YYSYMBOL_binding_elision = 247,          /* binding_elision  */
+  YYSYMBOL_binding_rest_element = 248,     /* binding_rest_element  */
+  YYSYMBOL_assignment_pattern = 249,       /* assignment_pattern  */
+  YYSYMBOL_object_assignment_pattern = 250, /* object_assignment_pattern  */
+  YYSYMBOL_assignment_property_sequence = 251, /* assignment_property_sequence  */
+  YYSYMBOL_assignment_property_list = 252, /* assignment_property_list  */
+  YYSYMBOL_assignment_property = 253,      /* assignment_property  */
+  YYSYMBOL_assignment_rest_element = 254,  /* assignment_rest_element  */
+  YYSYMBOL_array_assignment_pattern = 255, /* array_assignment_pattern  */
+  YYSYMBOL_assignment_element_list = 256,  /* assignment_element_list  */
+  YYSYMBOL_assignment_element = 257,       /* assignment_element  */
+  YYSYMBOL_assignment_target = 258,        /* assignment_target  */
+  YYSYMBOL_for_binding = 259,              /* for_binding  */
+  YYSYMBOL_for_binding_declarator = 260    /* for_binding_declarator  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Default (constant) value used for initialization for null
+   right-hand sides.  Unlike the standard yacc.c template, here we set
+   the default value of $$ to a zeroed-out value.  Since the default
+   value is undefined, this behavior is technically correct.  */
+static YYSTYPE yyval_default;
+
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YYFREE
+# define YYFREE free
+#endif
+#ifndef YYMALLOC
+# define YYMALLOC malloc
+#endif
+#ifndef YYREALLOC
+# define YYREALLOC realloc
+#endif
+
+#ifdef __cplusplus
+  typedef bool yybool;
+# define yytrue true
+# define yyfalse false
+#else
+  /* When we move to stdbool, get rid of the various casts to yybool.  */
+  typedef signed char yybool;
+# define yytrue 1
+# define yyfalse 0
+#endif
+
+#ifndef YYSETJMP
+# include <setjmp.h>
+# define YYJMP_BUF jmp_buf
+# define YYSETJMP(Env) setjmp (Env)
+/* Pacify Clang and ICC.  */
+# define YYLONGJMP(Env, Val)                    \
+ do {                                           \
+   longjmp (Env, Val);                          \
+   YY_ASSERT (0);                               \
+ } while (yyfalse)
+#endif
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* The _Noreturn keyword of C11.  */
+#ifndef _Noreturn
+# if (defined __cplusplus \
+      && ((201103 <= __cplusplus && !(__GNUC__ == 4 && __GNUC_MINOR__ == 7)) \
+          || (defined _MSC_VER && 1900 <= _MSC_VER)))
+#  define _Noreturn [[noreturn]]
+# elif ((!defined __cplusplus || defined __clang__) \
+        && (201112 <= (defined __STDC_VERSION__ ? __STDC_VERSION__ : 0) \
+            || (!defined __STRICT_ANSI__ \
+                && (4 < __GNUC__ + (7 <= __GNUC_MINOR__) \
+                    || (defined __apple_build_version__ \
+                        ? 6000000 <= __apple_build_version__ \
+                        : 3 < __clang_major__ + (5 <= __clang_minor__))))))
+   /* _Noreturn works as-is.  */
+# elif (2 < __GNUC__ + (8 <= __GNUC_MINOR__) || defined __clang__ \
+        || 0x5110 <= __SUNPRO_C)
+#  define _Noreturn __attribute__ ((__noreturn__))
+# elif 1200 <= (defined _MSC_VER ? _MSC_VER : 0)
+#  define _Noreturn __declspec (noreturn)
+# else
+#  define _Noreturn
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   3666
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  105
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  156
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  529
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  895
+/* YYMAXRHS -- Maximum number of symbols on right-hand side of rule.  */
+#define YYMAXRHS 9
+/* YYMAXLEFT -- Maximum number of symbols to the left of a handle
+   accessed by $0, $-1, etc., in any rule.  */
+#define YYMAXLEFT 0
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   336
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    93,     2,     2,     2,    91,    84,     2,
+     100,   101,    89,    87,    97,    88,   102,    90,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    81,    96,
+      85,    79,    86,    80,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   103,     2,   104,    83,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    98,    82,    99,    94,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,     2,    92,    95
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   756,   756,   772,   773,   781,   783,   785,   791,   792,
+     797,   799,   801,   803,   805,   807,   809,   811,   813,   815,
+     817,   819,   821,   823,   825,   827,   829,   831,   836,   838,
+     843,   845,   847,   849,   851,   856,   858,   863,   865,   870,
+     872,   874,   879,   884,   889,   894,   896,   898,   900,   902,
+     904,   906,   908,   910,   912,   917,   919,   924,   926,   931,
+     933,   935,   937,   939,   941,   946,   957,   968,   973,   975,
+     977,   982,   984,   986,   991,   993,   998,  1000,  1005,  1007,
+    1009,  1014,  1016,  1018,  1023,  1025,  1030,  1032,  1037,  1039,
+    1041,  1043,  1048,  1053,  1059,  1060,  1062,  1067,  1069,  1071,
+    1076,  1088,  1089,  1094,  1100,  1101,  1106,  1108,  1114,  1115,
+    1120,  1123,  1127,  1130,  1134,  1144,  1159,  1160,  1165,  1167,
+    1169,  1174,  1176,  1181,  1186,  1191,  1193,  1195,  1200,  1206,
+    1207,  1212,  1214,  1219,  1224,  1229,  1231,  1236,  1238,  1243,
+    1252,  1254,  1259,  1261,  1266,  1268,  1273,  1281,  1283,  1285,
+    1287,  1289,  1291,  1293,  1295,  1297,  1299,  1301,  1303,  1305,
+    1307,  1312,  1320,  1322,  1324,  1326,  1328,  1330,  1332,  1334,
+    1336,  1338,  1340,  1342,  1344,  1346,  1351,  1359,  1361,  1363,
+    1365,  1367,  1369,  1371,  1373,  1375,  1377,  1379,  1381,  1383,
+    1385,  1390,  1398,  1400,  1402,  1404,  1406,  1408,  1410,  1412,
+    1414,  1416,  1418,  1420,  1422,  1424,  1429,  1431,  1436,  1438,
+    1443,  1445,  1450,  1452,  1460,  1462,  1467,  1469,  1474,  1476,
+    1481,  1483,  1488,  1490,  1495,  1497,  1502,  1504,  1509,  1511,
+    1516,  1518,  1520,  1522,  1524,  1526,  1528,  1530,  1532,  1534,
+    1536,  1538,  1540,  1542,  1544,  1546,  1548,  1550,  1552,  1554,
+    1556,  1558,  1560,  1562,  1567,  1569,  1571,  1573,  1575,  1577,
+    1579,  1581,  1583,  1585,  1587,  1589,  1591,  1593,  1595,  1597,
+    1599,  1601,  1603,  1605,  1607,  1609,  1611,  1617,  1619,  1621,
+    1623,  1625,  1627,  1629,  1631,  1633,  1635,  1637,  1642,  1644,
+    1646,  1648,  1650,  1652,  1654,  1656,  1658,  1660,  1662,  1667,
+    1669,  1671,  1676,  1678,  1680,  1685,  1687,  1692,  1694,  1699,
+    1701,  1706,  1708,  1713,  1715,  1720,  1722,  1727,  1732,  1738,
+    1739,  1744,  1746,  1748,  1753,  1755,  1760,  1762,  1767,  1773,
+    1774,  1779,  1781,  1786,  1788,  1794,  1796,  1798,  1800,  1802,
+    1804,  1806,  1808,  1810,  1812,  1814,  1816,  1818,  1820,  1822,
+    1824,  1829,  1831,  1833,  1835,  1837,  1839,  1841,  1843,  1845,
+    1847,  1849,  1851,  1853,  1855,  1860,  1870,  1883,  1888,  1890,
+    1895,  1898,  1902,  1908,  1909,  1914,  1916,  1922,  1924,  1932,
+    1940,  1947,  1952,  1954,  1959,  1964,  1973,  1986,  1999,  2001,
+    2007,  2013,  2018,  2025,  2034,  2040,  2045,  2047,  2049,  2054,
+    2056,  2058,  2060,  2065,  2067,  2073,  2074,  2079,  2081,  2086,
+    2091,  2093,  2098,  2103,  2104,  2108,  2110,  2115,  2121,  2132,
+    2140,  2153,  2155,  2160,  2162,  2167,  2169,  2171,  2173,  2175,
+    2180,  2186,  2187,  2191,  2192,  2193,  2194,  2195,  2196,  2197,
+    2198,  2199,  2200,  2201,  2202,  2203,  2204,  2205,  2206,  2207,
+    2208,  2209,  2210,  2211,  2212,  2213,  2214,  2215,  2216,  2217,
+    2218,  2219,  2220,  2221,  2222,  2223,  2224,  2225,  2226,  2227,
+    2228,  2229,  2234,  2235,  2241,  2242,  2247,  2249,  2251,  2256,
+    2258,  2263,  2265,  2267,  2272,  2274,  2279,  2281,  2283,  2292,
+    2297,  2299,  2301,  2303,  2308,  2310,  2316,  2317,  2322,  2324,
+    2329,  2334,  2336,  2341,  2343,  2348,  2350,  2352,  2357,  2359,
+    2364,  2366,  2368,  2377,  2382,  2384,  2386,  2388,  2393,  2395,
+    2400,  2405,  2407,  2409,  2414,  2416,  2418,  2423,  2425,  2427
+};
+#endif
+
+#define YYPACT_NINF (-619)
+#define YYTABLE_NINF (-528)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -619,    96,  1289,  -619,    38,    38,    38,     2,    52,  2767,
+      60,  3368,   127,    59,    43,  1819,    72,    85,    78,    51,
+    3146,  2172,  -619,  3368,  3368,  3368,    90,    91,  -619,  2689,
+    -619,  -619,  -619,  -619,   170,  -619,  -619,  -619,  -619,  3146,
+    3368,  3368,   129,  3368,  3368,  3368,  3368,  -619,  -619,  3146,
+      49,  -619,  -619,  -619,  -619,  -619,   135,   141,  -619,  -619,
+    -619,  -619,  -619,   108,  -619,  -619,  -619,  -619,   149,   175,
+     193,   199,  -619,  -619,   227,   970,   970,   688,  -619,   209,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,   214,
+    2868,   215,   224,  -619,   244,   246,   224,   224,  3146,   232,
+    2543,  3368,  2172,  -619,  3368,  3368,  3368,   152,  -619,  -619,
+    -619,  -619,  -619,   257,  -619,  -619,  -619,  3368,  3368,  3368,
+    3368,  3368,  3368,  1920,  3146,   328,   238,  -619,  -619,   259,
+     970,   970,  1178,  -619,   209,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,   264,   242,  -619,  -619,  -619,
+     245,  -619,  -619,   299,    48,   301,  -619,   250,  -619,   253,
+    3223,   316,    56,    28,   265,   356,  -619,  -619,  3146,   348,
+    -619,  -619,  3146,   278,   238,   267,  -619,  -619,  -619,  -619,
+    3146,   331,  3146,  -619,  3291,  1819,   254,  -619,  -619,  -619,
+      36,  -619,  -619,  -619,  -619,  1683,   -18,  -619,  -619,   116,
+    3069,   122,  -619,  -619,   282,   282,  -619,  -619,  -619,  -619,
+    3146,  3146,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,   283,  -619,  -619,  3368,  3368,  -619,  -619,  3146,
+    3146,  3146,  3146,  3146,  3146,  3146,  3146,  3146,  3146,  3146,
+    3146,  2992,   150,  -619,   160,  3146,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,   206,  -619,  -619,   332,  -619,   294,
+     279,   280,  -619,  -619,   215,    24,  -619,    38,  3146,  3146,
+     163,   310,    47,    47,    47,   257,  2952,  1434,  -619,   285,
+      55,   286,  -619,  -619,   304,  1486,  1486,  1202,    81,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,   287,  -619,  -619,  -619,
+    -619,  3146,   331,   281,  -619,  -619,  -619,  -619,  -619,  -619,
+    2311,  2122,  3146,  2499,  -619,  3146,  -619,   288,  -619,  -619,
+    -619,  -619,   292,  -619,  -619,   309,  -619,   171,  3146,  3146,
+    3368,  3368,  -619,  -619,  3146,  3146,  3146,  3146,  3146,  3146,
+    3146,  3146,  3146,  3146,  3146,  3146,   150,   160,  3291,    36,
+    -619,   341,   299,   299,  -619,   296,  -619,  -619,   349,   114,
+    -619,  -619,   298,  -619,   352,   349,   353,   299,   299,  -619,
+     302,  -619,  -619,   349,  -619,   172,   300,   173,   303,    51,
+     373,  -619,  2992,   179,   281,  -619,  -619,  -619,  -619,  -619,
+    3146,  -619,   214,   357,   305,  -619,   307,  -619,  -619,   214,
+     214,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+     126,  -619,  -619,    32,    33,  -619,   324,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,   306,   312,  -619,  -619,  3620,  3146,  -619,
+    -619,  -619,  -619,  -619,  -619,    53,  -619,  -619,    53,  -619,
+    3496,  -619,  -619,  -619,  -619,   315,   317,  -619,  -619,  -619,
+    1819,    63,    63,    63,  -619,   367,  -619,    44,   318,  -619,
+     337,   339,  -619,   318,  -619,   318,  -619,   213,  2172,  -619,
+     338,   321,   325,  -619,  -619,  2611,   670,  2767,  3146,  -619,
+    3146,  3146,  3146,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,   335,  -619,  -619,  3368,  3368,  3146,  3146,  3146,
+    3146,  3146,  3146,  3146,  3146,  3146,  3146,  3146,  3146,  2992,
+    -619,   281,  1133,  -619,  -619,  2499,  3146,  -619,  -619,   327,
+    -619,  -619,   329,    36,  2223,   322,  3146,  -619,  -619,   347,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,   333,  -619,   385,   388,    62,
+     336,   340,  -619,  -619,  -619,   343,   301,    65,   118,   147,
+     355,   359,  1819,  3146,   358,    74,  -619,  -619,  -619,   360,
+    1819,  -619,  -619,  -619,  -619,   361,    36,  -619,  -619,  -619,
+     130,  3069,   362,    36,   364,    36,  3146,  -619,  3069,  -619,
+     136,  -619,  -619,  -619,  -619,   144,   354,  -619,   363,   451,
+    -619,  -619,  -619,  3146,  3146,  -619,    76,  3146,  3146,  2398,
+    -619,   245,  2398,  -619,  3558,  -619,  2021,  -619,   245,  -619,
+     317,  -619,   371,  -619,   214,   374,   238,   180,   182,  -619,
+    -619,   389,  1486,  1486,  1915,  -619,  -619,   390,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,   375,  -619,  2361,  -619,   376,  1133,  -619,
+    -619,  -619,   370,    67,   398,   379,  -619,  -619,  -619,  3146,
+     406,  -619,  -619,  -619,  -619,  -619,  -619,   349,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,   185,  -619,  -619,   383,
+    -619,  -619,  -619,  -619,  3291,  -619,  -619,  -619,    36,   384,
+      36,   386,  -619,  -619,  -619,    36,  -619,  -619,  1819,   187,
+    -619,   407,  -619,   337,   339,  -619,  -619,  -619,  -619,  -619,
+    -619,  1390,  3146,     6,   408,   387,   144,   392,  -619,  2767,
+    1819,  1819,  3146,  3368,  3368,  3146,  3146,  3146,  3146,  3146,
+    3146,  3146,  3146,  3146,  3146,  3146,  3146,  3146,  -619,  2449,
+    -619,  -619,  -619,  -619,    51,   391,  3146,    51,  -619,  3291,
+     397,   401,    45,    51,   160,  -619,   399,    51,   400,    51,
+    -619,   317,  -619,  1819,   378,  -619,  3395,  -619,   403,  -619,
+    -619,   418,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,   160,  -619,  -619,
+      51,  -619,  -619,  -619,  -619,  -619,  3146,   421,  -619,  -619,
+    -619,    51,  -619,    51,  -619,   404,  -619,   317,  -619,  1819,
+    3146,  -619,    -8,  -619,  -619,  -619,  -619,   405,  -619,  -619,
+    -619,  1581,  -619,  1581,  -619
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       3,     0,   113,     1,     0,     0,     0,     0,     0,    84,
+     112,   113,     0,   113,     0,   113,   135,   137,     0,     0,
+     113,   113,   352,   113,   113,   113,     0,     0,   363,   396,
+     356,   357,   358,   359,   351,   353,   354,   355,   417,   113,
+     113,   113,     0,   113,   113,   113,   113,    10,     8,   113,
+     405,     4,     5,     6,     7,    13,     0,     0,    14,    15,
+      16,    17,    18,     0,    21,    19,    20,    27,     0,     0,
+       0,     0,   142,   189,   210,   219,   218,   288,   302,   315,
+     308,   307,   319,   364,    22,   188,   190,   361,   362,   472,
+       0,   496,    68,    74,     0,     0,    69,    70,   113,     0,
+      94,   113,   113,   336,   113,   113,   113,   371,   349,   340,
+     341,   342,   343,   335,   337,   338,   339,   113,   113,   113,
+     113,   113,   113,     0,   113,     0,    85,   140,   159,   206,
+     215,   214,   277,   299,   313,   306,   305,   319,   350,   348,
+     158,   160,   345,   346,   347,     0,     0,   112,   335,   296,
+     277,    42,    44,     0,     0,     0,    32,    30,    31,     0,
+     113,     0,     0,     0,     0,     0,    50,    51,   113,     0,
+     136,   138,   113,     0,   139,   313,   316,   293,   294,   295,
+     113,   371,   113,   397,   113,   113,     0,   418,   297,   298,
+     116,   289,   290,   291,   292,   113,     0,   403,   399,   406,
+     113,     0,    11,    23,   111,   111,    24,    25,    26,    12,
+     113,   113,   253,   243,   235,   236,   237,   238,   241,   242,
+     231,   230,   244,   245,   246,   232,   233,   234,   239,   240,
+     247,   248,   249,   251,   252,   113,   113,   303,   304,   113,
+     113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
+     113,   113,   318,   325,   311,   113,    78,   442,   443,   444,
+     441,   436,   437,   438,   445,   470,   471,   439,   440,   446,
+     447,   448,   449,   435,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   467,   468,   469,
+     463,   464,   465,   466,   472,   434,   433,     0,   479,     0,
+       0,   413,   484,   483,   498,     0,   497,     0,   113,   113,
+       0,   113,     0,     0,     0,   351,     0,   405,    95,     0,
+       0,    96,   144,   204,   212,   221,   220,   288,   302,   203,
+     205,    98,   501,   502,    97,   285,   313,   314,   282,   283,
+     284,   113,   371,     0,   286,   287,   278,   279,   280,   281,
+     470,   424,   113,     0,   415,   113,   425,     0,   426,   427,
+     382,   429,   413,   421,   428,   388,   432,     0,   113,   113,
+     113,   113,   300,   301,   113,   113,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,   113,   317,   309,   113,   116,
+      66,     0,     0,    39,    35,   413,    37,    65,     0,     0,
+      29,    52,     0,    53,    65,     0,     0,    64,    59,    55,
+     413,    57,    46,     0,    49,     0,     0,     0,     0,     0,
+     129,   132,   113,     0,     0,   398,   395,   394,   390,   134,
+     113,   419,   472,     0,     0,   117,   118,   120,   121,   472,
+     472,   123,    67,     9,   360,   404,   400,   410,   407,   411,
+     405,   401,   110,     0,     0,   143,     0,   250,   227,   226,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   176,   333,     0,   330,   331,   334,     0,   113,   327,
+     324,   326,   323,   320,   473,     0,   488,   489,     0,   480,
+     414,   481,   499,   490,   494,   413,   413,    75,    79,    80,
+     113,     0,     0,     0,   351,     0,    99,   474,    71,    76,
+     528,   529,   524,    72,   525,    73,   526,   472,   113,   503,
+       0,     0,   413,   508,   507,   403,   113,   101,   113,   100,
+     113,   113,   113,   267,   259,   260,   261,   262,   265,   266,
+     255,   254,   268,   269,   270,   256,   257,   258,   263,   264,
+     271,   272,   273,   275,   276,   113,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
+     370,     0,   373,   369,   431,     0,   113,   383,   388,     0,
+     412,   384,     0,   116,   414,     0,   113,   344,   141,     0,
+     223,   222,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   146,   392,     0,    43,     0,     0,   414,
+       0,     0,    34,    33,    54,     0,     0,     0,     0,   414,
+       0,     0,   113,   113,     0,     0,   128,   130,   131,     0,
+     113,   367,   420,   476,   500,     0,     0,   477,   478,   402,
+     406,   113,     0,   116,     0,   116,   113,   328,   113,   321,
+       0,   486,   487,   485,   482,   496,     0,   414,     0,    86,
+     527,   528,   529,   113,   113,    81,     0,   113,   113,   113,
+     512,   513,   113,   504,   414,   505,     0,   514,   521,   522,
+     413,   523,   413,   518,   472,     0,   102,     0,     0,   145,
+     174,   208,   217,   216,   277,   173,   175,     0,   274,   229,
+     228,   192,   193,   194,   195,   196,   197,   198,   199,   200,
+     201,   202,   191,     0,   368,   431,   380,     0,   374,   376,
+     377,   385,     0,     0,   389,     0,   422,   416,   423,   113,
+       0,    41,    40,    38,    36,    28,    47,     0,    63,    62,
+      61,    60,    58,    56,    45,    92,     0,   104,   125,     0,
+     126,   127,   319,   133,   113,   119,   122,   408,   116,     0,
+     116,     0,   211,   332,   322,     0,   491,   493,   113,     0,
+     475,   474,    77,     0,     0,    82,    83,   510,   511,   509,
+     506,   424,   113,   415,   432,     0,   496,     0,   520,   101,
+     113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,   113,   113,   113,   319,   431,
+     378,   372,   375,   389,     0,     0,   113,     0,   207,   113,
+       0,     0,     0,     0,   312,   391,     0,     0,     0,     0,
+     495,   413,    87,   113,   277,   517,   113,   515,     0,    89,
+      90,     0,   225,   224,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   161,   213,   310,   379,   386,
+       0,   430,   381,   393,    48,    93,   113,     0,   103,   105,
+     124,     0,   366,     0,   115,     0,    91,   413,   519,   113,
+     113,   387,     0,   108,   365,   114,   492,     0,    88,   209,
+     108,   107,   516,   106,   109
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -619,  -619,  -619,  -619,  -619,    22,  -619,  -619,    89,  -619,
+     -99,  -619,   112,  -371,  -619,  -619,  -619,  -107,  -133,  -149,
+      71,   500,  -619,   314,    14,   207,  -151,  -619,  -619,  -619,
+    -619,  -619,  -619,   210,    12,  -265,  -619,  -619,  -619,  -364,
+     323,    16,    35,  -378,  -619,  -619,  -109,  -619,  -619,   110,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,    -5,  -619,  -619,
+     710,   413,  -146,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,    50,  -301,  1085,   431,
+     998,   432,  -619,   -64,    29,  -619,    40,  -619,  -619,  -619,
+    -136,  -194,   402,  -619,  -192,  -369,  -619,  -115,  -619,  -619,
+     106,    42,  -619,  -132,  -367,  -619,  -619,  -184,  -531,  -619,
+    -619,  -619,  -318,    -2,  -381,    37,   115,    88,    92,  -619,
+    -102,  -106,  -336,  -619,    54,   113,  -619,   -44,  -619,  -103,
+     -88,   -70,  -619,  -300,     4,  -619,  -619,    57,    58,    17,
+    -619,  -314,  -264,  -299,  -619,   -57,  -619,  -619,  -130,  -510,
+     -55,  -619,  -618,  -619,  -619,  -267
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     2,    51,   195,   894,    53,   155,   156,   395,
+     396,   157,   158,   159,    54,   163,   410,   411,   398,   391,
+      55,    56,   318,    92,   508,    93,   509,    57,    58,    59,
+      60,    61,   319,   320,   530,   685,    62,   822,   869,   891,
+     453,   125,    64,   434,   435,   436,   437,   420,   749,   421,
+     628,    65,    66,    67,    68,    69,    70,   686,    71,   321,
+     127,   689,    72,   322,   128,   690,    73,   323,   129,   691,
+      74,   324,   130,   692,    75,   325,   235,   555,   131,    76,
+     132,    77,   133,    78,   134,    79,   135,    80,   136,    81,
+     254,   483,   252,   480,   253,   473,   474,   475,   137,    82,
+     138,    84,   139,   343,   573,   717,   718,   719,   356,   357,
+     358,   359,   360,   140,   428,   141,   142,   199,   200,   201,
+     448,   476,   491,   143,   144,   187,   362,   363,   364,   578,
+     366,   670,   665,   438,   439,   300,   301,   302,   303,   440,
+     495,   305,   306,   441,   331,   679,   521,   522,   523,   524,
+     681,   682,   683,   684,   334,   512
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      85,   387,   299,   526,   126,   494,   496,   604,    94,    94,
+      94,   605,   406,    85,   402,   174,   680,   361,    63,   256,
+     365,    95,    95,    95,    52,   556,   585,   611,   405,   165,
+     413,    63,   577,   579,   615,   581,   328,   169,   427,    86,
+     492,   720,   621,   332,   196,   333,   514,   516,   166,   424,
+     175,   777,    86,   629,   778,   167,    88,   631,   479,   610,
+     481,   176,     4,     5,     6,    99,   866,   867,   432,    88,
+     392,   147,   397,   890,   620,  -527,   642,   644,   407,   368,
+     432,   160,    89,   444,   392,  -415,   528,   738,  -527,   368,
+     173,   507,   393,   310,   449,    27,     3,   432,   329,   529,
+     408,   433,    98,  -415,   145,  -415,   393,   660,    83,   739,
+    -415,   432,   -99,   433,   204,   205,   170,    87,   748,   367,
+     771,    83,    90,   664,   412,   -99,   236,    91,   493,   171,
+      87,   336,   643,   645,    90,   181,    90,   330,   146,    91,
+     740,    91,   337,   168,   868,    90,   197,   394,   161,    48,
+      91,    90,   100,   198,    88,   409,    91,   162,    85,   656,
+     658,    90,   741,   415,   780,    90,    91,   417,   814,   407,
+      91,   151,    90,   152,    90,   423,    63,    91,   172,    91,
+     370,   371,    85,    85,   810,   651,   675,   720,   652,   341,
+     180,   408,   479,    85,   481,   401,   342,    86,    38,    39,
+     713,    63,   403,   153,   714,   725,    83,   429,    38,    39,
+     571,    63,   154,   445,    88,    87,   153,   443,   878,   450,
+     446,    86,    86,   197,   486,   154,   451,   445,   520,   190,
+     639,   202,    86,   368,  -409,   514,   516,   203,    88,    88,
+     764,   304,   427,   607,   608,   206,   184,   506,  -414,    88,
+     251,   185,   477,   478,   332,   426,   333,   721,   617,   618,
+     368,   492,   477,   478,   500,   759,    83,   761,   368,   368,
+     368,   207,   587,   622,   624,    87,   368,   368,   858,   368,
+     630,   790,   368,   791,   368,   255,   821,   485,   833,   208,
+      83,    83,   255,   255,   669,   209,   210,   372,   373,    87,
+      87,    83,   418,   419,   430,   431,   482,   211,   482,   251,
+      87,    94,   304,   501,   502,   503,   510,   510,   510,    96,
+      97,   307,   147,   308,    95,   309,   877,   513,   515,   511,
+     511,   511,   311,   184,   204,   368,   756,    21,    22,   369,
+     388,   765,   389,   390,   785,   397,   787,   399,    28,   400,
+      30,    31,    32,    33,   504,    35,    36,    37,    38,    39,
+     404,   414,   633,   205,   416,    88,   820,   422,   341,   637,
+     638,   452,   457,   825,   649,   488,   487,   490,   489,   572,
+     826,   527,   828,   531,   532,   606,    85,   569,   583,   584,
+     586,   793,   794,   609,   614,   152,   -66,   616,   419,   619,
+     623,   634,   299,   625,   636,   646,   635,   647,   316,   648,
+      49,   529,   655,   317,   657,   666,   667,    83,   668,   672,
+     673,   727,   674,   815,   698,    86,    87,   723,   729,   731,
+     372,   373,   732,   724,   730,   734,   735,   754,   863,   736,
+     482,   482,    88,   374,   375,   376,   377,   378,   379,   380,
+     381,   382,   383,   384,   743,   744,   747,   385,   766,   426,
+     768,   752,   758,   579,   760,   830,   831,   767,   786,   792,
+     789,   807,   836,   650,   813,   811,   808,  -277,   361,   816,
+     817,   365,   819,   737,   823,   827,   664,   829,   612,   672,
+     626,   835,   860,   864,    83,   875,   837,   865,    85,   880,
+     871,   873,   883,    87,   879,   661,   661,   661,   886,   892,
+     733,   613,   742,   164,   497,   772,    63,   663,   662,   662,
+     662,   505,   659,   687,   838,   688,   893,   755,   454,   695,
+     627,   326,   327,   763,   812,   449,   386,    86,   640,   757,
+     726,   887,   641,   632,   779,     0,     0,   653,   654,     0,
+       0,     0,     0,     0,    88,   695,   695,   695,   695,   695,
+     695,   695,   695,   695,   695,   695,   695,     0,   696,     0,
+     361,     0,     0,   365,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   520,     0,   784,     0,
+       0,     0,     0,     0,   696,   696,   696,   696,   696,   696,
+     696,   696,   696,   696,   696,   696,    83,     0,   427,     0,
+       0,     0,     0,     0,   788,    87,   824,     0,   746,     0,
+      85,     0,     0,     0,     0,     0,     0,     0,    85,   750,
+       0,     0,     0,     0,     0,     0,     0,     0,    63,     0,
+       0,     0,   751,     0,   745,     0,    63,     0,     0,     0,
+       0,     0,   753,     0,     0,     0,     0,     0,   769,    86,
+       0,     0,   695,     0,     0,   695,   695,    86,     0,     0,
+     773,     0,   857,   427,     0,     0,    88,     0,     0,     0,
+       0,     0,   147,   774,    88,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   102,   103,     0,
+       0,   696,     0,     0,   696,   696,   107,     0,   108,     0,
+     109,   110,   111,   112,   148,   114,   115,   116,    38,    39,
+       0,     0,     0,     0,     0,     0,     0,     0,    83,     0,
+       0,     0,     0,     0,     0,     0,    83,    87,     0,   183,
+     237,   238,     0,     0,     0,    87,     0,   518,     0,   186,
+       0,     0,    85,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,     0,     0,    85,   250,   676,     0,
+     124,     0,     0,   317,   677,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    63,     0,     0,     0,    85,    85,
+     832,    86,     0,   695,   695,   695,   695,   695,   695,   695,
+     695,   695,   695,   695,   695,    86,    63,    63,    88,     0,
+       0,     0,   839,   840,     0,     0,     0,    85,     0,     0,
+       0,     0,    88,     0,     0,   426,     0,    86,    86,     0,
+       0,    85,   696,   696,   696,   696,   696,   696,   696,   696,
+     696,   696,   696,   696,    88,    88,     0,     0,     0,    63,
+       0,     0,     0,     0,     0,   876,    86,     0,     0,     0,
+      83,   882,     0,     0,     0,     0,     0,     0,     0,    87,
+      86,     0,     0,    88,    83,     0,     0,    85,   482,     0,
+       0,     0,     0,    87,     0,   859,     0,    88,   862,    85,
+     426,    85,   425,     0,   870,    63,    83,    83,   872,     0,
+     874,   888,     0,     0,     0,    87,    87,    63,     0,    63,
+     447,   482,     0,     0,     0,     0,    86,     0,     0,     0,
+     455,   456,     0,     0,     0,    83,     0,     0,    86,     0,
+      86,   881,     0,    88,    87,     0,     0,     0,     0,    83,
+       0,     0,   884,     0,   885,    88,     0,    88,    87,   460,
+     461,   462,   463,   464,   465,   466,   467,   468,   469,   470,
+     471,   472,     0,     0,     0,   484,     0,     0,     0,     0,
+     701,   702,   703,   704,   705,   706,   707,   708,   709,   710,
+     711,   712,     0,     0,     0,    83,     0,     0,     0,     0,
+       0,     0,     0,     0,    87,     0,     0,    83,     0,    83,
+       0,   212,   213,     0,     0,     0,    87,     0,    87,   150,
+       0,     0,     0,     0,     0,     0,     0,     0,   498,   499,
+       0,   150,   150,   150,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,   224,     0,     0,     0,   150,   150,
+       0,   150,   150,   150,   150,     0,     0,     0,     0,     0,
+       0,   570,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   580,     0,     0,   582,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   770,   588,   589,
+     775,   776,     0,     0,   592,   593,   594,   595,   596,   597,
+     598,   599,   600,   601,   602,   603,   149,     0,     0,   150,
+       0,     0,   150,   150,   150,     0,     0,     0,   177,   178,
+     179,     0,     0,     0,     0,   150,   150,   150,   150,   150,
+     150,     0,     0,     0,     0,   188,   189,     0,   191,   192,
+     193,   194,   472,     0,     0,     0,   257,   258,   259,   260,
+     186,   261,   262,   263,   264,   350,   266,     0,     0,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,     0,   290,   291,   292,   293,   715,   295,   296,
+       0,     0,     0,     0,     0,     0,   335,     0,     0,   338,
+     339,   340,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   344,   345,   346,   347,   348,   349,   844,   845,
+     846,   847,   848,   849,   850,   851,   852,   853,   854,   855,
+       0,     0,   353,     0,     0,     0,     0,     0,     0,   716,
+     372,   373,     0,   150,   150,     0,   576,     0,     0,     0,
+       0,     0,   697,   374,   375,   376,   377,   378,   379,   380,
+     381,   382,   383,   384,   237,   238,     0,   385,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   557,   558,   559,
+     560,   561,   562,   563,   564,   565,   566,   567,     0,   472,
+       0,   568,     0,     0,     0,     0,   722,     0,     0,    -2,
+       0,     0,     4,     5,     6,     0,   728,     7,     0,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+       0,     0,    19,     0,     0,    20,    21,    22,    23,    24,
+     458,   459,    25,    26,     0,    27,     0,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,     0,
+       0,    40,    41,     0,     0,     0,     0,     0,     0,     0,
+       0,   447,     0,     0,     0,     0,   762,     0,   472,     0,
+       0,     0,     0,     0,     0,     0,     0,    42,   150,   150,
+       0,     0,     0,     0,     0,     0,    43,    44,     0,     0,
+       0,     0,    45,    46,     0,    47,     0,    48,     0,    49,
+       0,     0,    50,   257,   258,   259,   260,     0,   261,   262,
+     263,   264,   265,   266,     0,     0,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,     0,
+     290,   291,   292,   293,   574,   295,   296,     0,     0,   818,
+    -405,     0,     0,     0,     0,     0,  -405,     0,     0,     0,
+       0,     0,     0,     0,     0,   590,   591,     0,     0,     0,
+       0,  -405,  -405,     0,     0,     0,     0,     0,     0,   255,
+    -405,   669,  -405,     0,  -405,  -405,  -405,  -405,  -405,  -405,
+    -405,  -405,  -405,  -405,     0,     0,     0,  -424,     0,  -424,
+    -431,     0,   580,   576,     0,     0,     0,     0,     0,     0,
+       0,     0,   841,     0,     0,     0,     0,     0,     0,     0,
+       0,  -405,     0,     0,     0,     0,   671,   856,   533,     0,
+       0,     0,     0,     0,   678,     0,   861,     0,     0,   694,
+       0,   525,  -405,     0,  -405,     0,     0,  -405,   198,     0,
+     534,   535,   536,   537,   538,   539,   540,   541,   542,   543,
+     544,     0,     0,   150,   150,   694,   694,   694,   694,   694,
+     694,   694,   694,   694,   694,   694,   694,     0,   545,   546,
+     547,   548,   549,   550,   551,   552,   553,   554,     0,     0,
+       0,     0,     0,     0,     4,     5,     6,  -113,  -113,     7,
+     889,     8,     9,    10,    11,     0,     0,    14,    15,    16,
+      17,    18,     0,     0,    19,     0,     0,    20,    21,    22,
+      23,    24,     0,     0,    25,    26,   693,    27,     0,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,     0,     0,    40,    41,     0,     0,     0,     0,     0,
+     699,   700,   693,   693,   693,   693,   693,   693,   693,   693,
+     693,   693,   693,   693,     0,     0,     0,     0,     0,    42,
+       0,     0,   694,     0,     0,   694,   694,   678,    43,    44,
+     678,     0,     0,     0,    45,    46,     0,    47,     0,    48,
+       0,    49,     0,     0,    50,     0,     4,     5,     6,     0,
+       0,     7,     0,     8,     9,    10,    11,     0,     0,    14,
+      15,    16,    17,    18,     0,     0,    19,     0,     0,    20,
+      21,    22,    23,    24,     0,     0,    25,    26,     0,    27,
+       0,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,     0,     0,    40,    41,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   693,
+       0,     0,   693,   693,     0,     0,     0,     0,     0,     0,
+       0,    42,     0,     0,     0,     0,     0,     0,     0,     0,
+      43,    44,     0,     0,     0,     0,    45,    46,     0,    47,
+     834,    48,   442,    49,     0,     0,    50,     0,     0,     0,
+       0,   150,   150,   694,   694,   694,   694,   694,   694,   694,
+     694,   694,   694,   694,   694,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     4,     5,     6,     0,     0,     7,     0,     8,
+       9,    10,    11,     0,   678,    14,    15,    16,    17,    18,
+       0,     0,    19,     0,     0,    20,    21,    22,    23,    24,
+       0,     0,    25,    26,     0,    27,     0,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,     0,
+       0,    40,    41,     0,     0,     0,     0,     0,   842,   843,
+     693,   693,   693,   693,   693,   693,   693,   693,   693,   693,
+     693,   693,     0,     0,     0,     0,     0,    42,     0,     0,
+       0,     0,     0,     0,     0,     0,    43,    44,     0,     0,
+       0,     0,    45,    46,     0,    47,     0,    48,     0,    49,
+       0,     0,    50,   257,   258,   259,   260,     0,   261,   262,
+     263,   264,   350,   266,     0,     0,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,     0,
+     290,   291,   292,   293,   351,   295,   296,   372,   373,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     795,   796,   797,   798,   799,   800,   801,   802,   803,   804,
+     805,     0,     0,     0,   806,     0,     0,   352,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   353,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   354,
+       0,     0,     0,   355,   257,   258,   259,   260,     0,   261,
+     262,   263,   264,   350,   266,     0,     0,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+       0,   290,   291,   292,   293,   781,   295,   296,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   782,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     353,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     783,     0,     0,     0,   355,   257,   258,   259,   260,     0,
+     261,   262,   263,   264,   265,   266,     0,     0,   267,   268,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,     0,   290,   291,   292,   293,   574,   295,   296,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   147,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   102,
+     103,     0,     0,  -431,     0,     0,     0,     0,   107,     0,
+     108,     0,   109,   110,   111,   112,   148,   114,   115,   116,
+      38,    39,  -431,     0,     0,   576,   257,   258,   259,   260,
+       0,   261,   262,   263,   264,   350,   266,     0,     0,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,     0,   290,   291,   292,   293,   351,   295,   296,
+     123,     0,   124,     0,     0,    50,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     352,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   353,     0,   257,   258,   259,   260,     0,   261,
+     262,   263,   264,   265,   266,     0,   355,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+       0,   290,   291,   292,   293,   574,   295,   296,     0,     0,
+       0,     0,     0,     0,   257,   258,   259,   260,     0,   261,
+     262,   263,   264,   350,   266,     0,     0,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+     575,   290,   291,   292,   293,   809,   295,   296,     0,     0,
+     147,     0,     0,     0,   576,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   102,   103,     0,     0,     0,
+       0,     0,     0,     0,   107,     0,   108,     0,   109,   110,
+     111,   112,   148,   114,   115,   116,    38,    39,     0,     0,
+     353,     0,   257,   258,   259,   260,     0,   261,   262,   263,
+     264,   350,   266,     0,   576,   267,   268,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   289,     0,   290,
+     291,   292,   293,   574,   295,   296,   676,     0,   124,     0,
+       0,   317,   257,   258,   259,   260,     0,   261,   262,   263,
+     264,   265,   266,     0,     0,   267,   268,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   289,   353,   290,
+     291,   292,   293,   574,   295,   296,   312,   313,   314,  -113,
+       0,     0,   576,     0,     0,    10,    11,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      21,    22,    23,    24,     0,     0,    25,     0,     0,     0,
+       0,    28,    29,    30,    31,    32,    33,   315,    35,    36,
+      37,    38,    39,     0,     0,    40,    41,     0,     0,     0,
+       0,     0,   576,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  -403,     0,     0,
+       0,    42,     0,  -403,     0,     0,     0,     0,     0,     0,
+      43,    44,     0,     0,     0,     0,    45,    46,  -403,  -403,
+       0,   316,     0,    49,     0,     0,   317,  -403,     0,  -403,
+       0,  -403,  -403,  -403,  -403,  -403,  -403,  -403,  -403,  -403,
+    -403,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  -403,     0,
+       0,     0,     0,     0,     0,  -113,     0,     0,     0,     0,
+       0,    10,   101,     0,     0,     0,     0,     0,   304,  -403,
+       0,  -403,     0,     0,  -403,  -403,   102,   103,   104,   105,
+       0,     0,   106,     0,     0,   107,     0,   108,    29,   109,
+     110,   111,   112,   113,   114,   115,   116,    38,    39,     0,
+       0,   117,   118,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    42,     0,     0,
+       0,     0,     0,  -113,     0,     0,   119,   120,   182,    10,
+     101,     0,   121,   122,     0,     0,     0,   123,     0,   124,
+       0,     0,    50,     0,   102,   103,   104,   105,     0,     0,
+     106,     0,     0,   107,     0,   108,    29,   109,   110,   111,
+     112,   113,   114,   115,   116,    38,    39,     0,     0,   117,
+     118,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,   119,   120,     0,     0,     0,     0,
+     121,   122,     0,     0,     0,   123,     0,   124,     0,     0,
+      50,   257,   258,   259,   260,     0,   261,   262,   263,   264,
+     265,   266,     0,     0,   267,   268,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,     0,   290,   291,
+     292,   293,   294,   295,   296,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   297,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   257,   258,   259,   260,     0,
+     261,   262,   263,   264,   265,   266,     0,   298,   267,   268,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,     0,   290,   291,   292,   293,   517,   295,   296,     0,
+       0,     0,     0,     0,    10,   101,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   102,
+     103,   104,   105,     0,     0,   106,     0,     0,   107,   518,
+     108,    29,   109,   110,   111,   112,   113,   114,   115,   116,
+      38,    39,     0,     0,   117,   118,     0,     0,     0,     0,
+       0,   519,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   352,
+      42,     0,     0,     0,     0,     0,     0,     0,     0,   119,
+     120,    10,   101,     0,     0,   121,   122,     0,     0,     0,
+     123,     0,   124,  -329,     0,    50,   102,   103,   104,   105,
+       0,     0,   106,     0,     0,   107,     0,   108,    29,   109,
+     110,   111,   112,   113,   114,   115,   116,    38,    39,     0,
+       0,   117,   118,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   352,    42,     0,     0,
+       0,     0,     0,     0,     0,     0,   119,   120,    10,   101,
+       0,     0,   121,   122,     0,     0,     0,   123,     0,   124,
+       0,     0,    50,   102,   103,   104,   105,     0,     0,   106,
+       0,     0,   107,     0,   108,    29,   109,   110,   111,   112,
+     113,   114,   115,   116,    38,    39,     0,     0,   117,   118,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,   119,   120,    10,    11,     0,     0,   121,
+     122,     0,     0,     0,   123,     0,   124,     0,     0,    50,
+      21,    22,    23,    24,     0,     0,    25,     0,     0,    27,
+       0,    28,    29,    30,    31,    32,    33,   315,    35,    36,
+      37,    38,    39,     0,     0,    40,    41,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    42,     0,    10,    11,     0,     0,     0,     0,     0,
+      43,    44,     0,     0,     0,     0,    45,    46,    21,    22,
+      23,    24,     0,    49,    25,     0,    50,     0,     0,    28,
+      29,    30,    31,    32,    33,   315,    35,    36,    37,    38,
+      39,     0,     0,    40,    41,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    42,
+       0,     0,     0,     0,     0,     0,     0,     0,    43,    44,
+     147,   101,     0,     0,    45,    46,     0,     0,     0,    48,
+       0,    49,     0,     0,    50,   102,   103,   104,   105,     0,
+       0,   106,     0,     0,   107,     0,   108,   147,   109,   110,
+     111,   112,   148,   114,   115,   116,    38,    39,     0,     0,
+     117,   118,   102,   103,     0,     0,     0,     0,     0,     0,
+       0,   107,     0,   108,     0,   109,   110,   111,   112,   148,
+     114,   115,   116,    38,    39,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   119,   120,     0,     0,     0,
+       0,   121,   122,     0,     0,     0,   123,     0,   124,     0,
+       0,    50,   518,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   676,     0,   124,     0,     0,   317,   257,
+     258,   259,   260,     0,   261,   262,   263,   264,   265,   266,
+       0,     0,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,     0,   290,   291,   292,   293,
+     294,   295,   296,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   257,   258,   259,   260,     0,   261,   262,   263,   264,
+     265,   266,     0,   297,   267,   268,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,     0,   290,   291,
+     292,   293,   517,   295,   296,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   257,   258,   259,   260,     0,   261,   262,
+     263,   264,   265,   266,     0,   518,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,     0,
+     290,   291,   292,   293,   574,   295,   296
+};
+
+static const yytype_int16 yycheck[] =
+{
+       2,   137,    90,   317,     9,   305,   305,   388,     4,     5,
+       6,   389,   161,    15,   160,    20,   526,   123,     2,    89,
+     123,     4,     5,     6,     2,   326,   362,   398,   161,    13,
+     163,    15,   350,   351,   405,   353,   100,    15,   184,     2,
+     304,   572,   413,   100,    49,   100,   313,   314,    13,   181,
+      21,   669,    15,   422,   672,    13,     2,   424,   252,   395,
+     252,    21,     3,     4,     5,    13,    21,    22,    44,    15,
+      22,    12,    44,    81,   410,    31,    44,    44,    22,    97,
+      44,    22,    44,   101,    22,    79,    31,    22,    44,    97,
+      19,    44,    44,    98,   200,    36,     0,    44,   100,    44,
+      44,    77,   100,    97,    44,    99,    44,    44,     2,    44,
+     104,    44,    31,    77,     6,     7,    44,     2,    44,   124,
+      44,    15,    98,    79,    96,    44,    76,   103,   104,    44,
+      15,   102,   100,   100,    98,    44,    98,   100,    78,   103,
+      22,   103,   102,   100,    99,    98,    97,    99,    89,    98,
+     103,    98,   100,   104,   100,    99,   103,    98,   160,   495,
+     496,    98,    44,   168,   674,    98,   103,   172,   101,    22,
+     103,    44,    98,    46,    98,   180,   160,   103,   100,   103,
+     130,   131,   184,   185,   715,   485,   522,   718,   488,    37,
+     100,    44,   386,   195,   386,   160,    44,   160,    48,    49,
+     569,   185,   160,    89,   571,   583,   100,   185,    48,    49,
+     342,   195,    98,    97,   160,   100,    89,   195,   836,    97,
+     104,   184,   185,    97,   294,    98,   104,    97,   316,   100,
+     104,    96,   195,    97,   104,   502,   503,    96,   184,   185,
+     104,    97,   388,   392,   393,    96,    76,   311,   104,   195,
+     100,    81,   102,   103,   311,   184,   311,   575,   407,   408,
+      97,   525,   102,   103,   101,   643,   160,   645,    97,    97,
+      97,    96,   101,   101,   101,   160,    97,    97,   809,    97,
+     101,   101,    97,   101,    97,    79,   101,    81,   101,    96,
+     184,   185,    79,    79,    81,    96,    97,    52,    53,   184,
+     185,   195,    24,    25,    50,    51,   252,    80,   254,   100,
+     195,   307,    97,     3,     4,     5,   312,   313,   314,     5,
+       6,    97,    12,    79,   307,    79,   836,   313,   314,   312,
+     313,   314,   100,    76,     6,    97,   636,    27,    28,    80,
+      76,   655,   100,    44,   680,    44,   682,    97,    38,    96,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      44,    96,   432,     7,    16,   311,   737,   100,    37,   439,
+     440,    89,    89,   754,   477,    81,    44,    97,    99,    98,
+     758,    96,   760,    97,    80,    44,   388,   100,   100,    97,
+      81,   692,   693,    97,    96,    46,    44,    44,    25,    97,
+     100,    44,   490,   100,    97,    81,   101,   101,    98,    97,
+     100,    44,    97,   103,    97,    97,    79,   311,    79,    81,
+      99,    99,    97,   723,    89,   388,   311,   100,    81,    44,
+      52,    53,    44,   104,   101,    99,    96,    76,   819,    96,
+     386,   387,   388,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    99,    96,    98,    79,   104,   388,
+       9,   101,   100,   781,   100,   765,   765,   104,    97,    80,
+      96,    81,   786,   478,   104,    99,   101,    99,   584,    81,
+     101,   584,    76,   616,   101,   101,    79,   101,   399,    81,
+     419,   104,   101,    96,   388,   831,   104,    96,   500,    81,
+     101,   101,    81,   388,   101,   501,   502,   503,   104,   104,
+     609,   399,   619,    13,   307,   666,   500,   505,   501,   502,
+     503,   311,   500,   528,   789,   530,   890,   636,   205,   531,
+     420,   100,   100,   648,   718,   641,   134,   500,   450,   641,
+     584,   877,   450,   430,   674,    -1,    -1,   490,   490,    -1,
+      -1,    -1,    -1,    -1,   500,   557,   558,   559,   560,   561,
+     562,   563,   564,   565,   566,   567,   568,    -1,   531,    -1,
+     676,    -1,    -1,   676,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   674,    -1,   676,    -1,
+      -1,    -1,    -1,    -1,   557,   558,   559,   560,   561,   562,
+     563,   564,   565,   566,   567,   568,   500,    -1,   754,    -1,
+      -1,    -1,    -1,    -1,   684,   500,   752,    -1,   623,    -1,
+     622,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   630,   625,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   622,    -1,
+      -1,    -1,   625,    -1,   622,    -1,   630,    -1,    -1,    -1,
+      -1,    -1,   630,    -1,    -1,    -1,    -1,    -1,   663,   622,
+      -1,    -1,   664,    -1,    -1,   667,   668,   630,    -1,    -1,
+     666,    -1,   808,   819,    -1,    -1,   622,    -1,    -1,    -1,
+      -1,    -1,    12,   666,   630,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    27,    28,    -1,
+      -1,   664,    -1,    -1,   667,   668,    36,    -1,    38,    -1,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   622,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   630,   622,    -1,    29,
+      52,    53,    -1,    -1,    -1,   630,    -1,    77,    -1,    39,
+      -1,    -1,   754,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    -1,    -1,   768,    79,    98,    -1,
+     100,    -1,    -1,   103,   104,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   768,    -1,    -1,    -1,   790,   791,
+     768,   754,    -1,   795,   796,   797,   798,   799,   800,   801,
+     802,   803,   804,   805,   806,   768,   790,   791,   754,    -1,
+      -1,    -1,   790,   791,    -1,    -1,    -1,   819,    -1,    -1,
+      -1,    -1,   768,    -1,    -1,   754,    -1,   790,   791,    -1,
+      -1,   833,   795,   796,   797,   798,   799,   800,   801,   802,
+     803,   804,   805,   806,   790,   791,    -1,    -1,    -1,   833,
+      -1,    -1,    -1,    -1,    -1,   833,   819,    -1,    -1,    -1,
+     754,   866,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   754,
+     833,    -1,    -1,   819,   768,    -1,    -1,   879,   824,    -1,
+      -1,    -1,    -1,   768,    -1,   814,    -1,   833,   817,   891,
+     819,   893,   182,    -1,   823,   879,   790,   791,   827,    -1,
+     829,   879,    -1,    -1,    -1,   790,   791,   891,    -1,   893,
+     200,   857,    -1,    -1,    -1,    -1,   879,    -1,    -1,    -1,
+     210,   211,    -1,    -1,    -1,   819,    -1,    -1,   891,    -1,
+     893,   860,    -1,   879,   819,    -1,    -1,    -1,    -1,   833,
+      -1,    -1,   871,    -1,   873,   891,    -1,   893,   833,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,    -1,    -1,    -1,   255,    -1,    -1,    -1,    -1,
+     557,   558,   559,   560,   561,   562,   563,   564,   565,   566,
+     567,   568,    -1,    -1,    -1,   879,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   879,    -1,    -1,   891,    -1,   893,
+      -1,    31,    32,    -1,    -1,    -1,   891,    -1,   893,    11,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   308,   309,
+      -1,    23,    24,    25,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    40,    41,
+      -1,    43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,   341,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,   352,    -1,    -1,   355,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   664,   368,   369,
+     667,   668,    -1,    -1,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   383,   384,   385,    11,    -1,    -1,   101,
+      -1,    -1,   104,   105,   106,    -1,    -1,    -1,    23,    24,
+      25,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,    -1,    -1,    -1,    -1,    40,    41,    -1,    43,    44,
+      45,    46,   422,    -1,    -1,    -1,     3,     4,     5,     6,
+     430,     8,     9,    10,    11,    12,    13,    -1,    -1,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    -1,    40,    41,    42,    43,    44,    45,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,   101,    -1,    -1,   104,
+     105,   106,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   795,   796,
+     797,   798,   799,   800,   801,   802,   803,   804,   805,   806,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      52,    53,    -1,   235,   236,    -1,   103,    -1,    -1,    -1,
+      -1,    -1,   532,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    52,    53,    -1,    79,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    -1,   569,
+      -1,    79,    -1,    -1,    -1,    -1,   576,    -1,    -1,     0,
+      -1,    -1,     3,     4,     5,    -1,   586,     8,    -1,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      -1,    -1,    23,    -1,    -1,    26,    27,    28,    29,    30,
+     235,   236,    33,    34,    -1,    36,    -1,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    -1,
+      -1,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   641,    -1,    -1,    -1,    -1,   646,    -1,   648,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,   370,   371,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    88,    -1,    -1,
+      -1,    -1,    93,    94,    -1,    96,    -1,    98,    -1,   100,
+      -1,    -1,   103,     3,     4,     5,     6,    -1,     8,     9,
+      10,    11,    12,    13,    -1,    -1,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    -1,
+      40,    41,    42,    43,    44,    45,    46,    -1,    -1,   729,
+       6,    -1,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   370,   371,    -1,    -1,    -1,
+      -1,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,    79,
+      36,    81,    38,    -1,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    -1,    -1,    -1,    97,    -1,    99,
+     100,    -1,   782,   103,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   792,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    77,    -1,    -1,    -1,    -1,   518,   807,    32,    -1,
+      -1,    -1,    -1,    -1,   526,    -1,   816,    -1,    -1,   531,
+      -1,    97,    98,    -1,   100,    -1,    -1,   103,   104,    -1,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,   555,   556,   557,   558,   559,   560,   561,
+     562,   563,   564,   565,   566,   567,   568,    -1,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,     8,
+     880,    10,    11,    12,    13,    -1,    -1,    16,    17,    18,
+      19,    20,    -1,    -1,    23,    -1,    -1,    26,    27,    28,
+      29,    30,    -1,    -1,    33,    34,   531,    36,    -1,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,
+     555,   556,   557,   558,   559,   560,   561,   562,   563,   564,
+     565,   566,   567,   568,    -1,    -1,    -1,    -1,    -1,    78,
+      -1,    -1,   664,    -1,    -1,   667,   668,   669,    87,    88,
+     672,    -1,    -1,    -1,    93,    94,    -1,    96,    -1,    98,
+      -1,   100,    -1,    -1,   103,    -1,     3,     4,     5,    -1,
+      -1,     8,    -1,    10,    11,    12,    13,    -1,    -1,    16,
+      17,    18,    19,    20,    -1,    -1,    23,    -1,    -1,    26,
+      27,    28,    29,    30,    -1,    -1,    33,    34,    -1,    36,
+      -1,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   664,
+      -1,    -1,   667,   668,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    88,    -1,    -1,    -1,    -1,    93,    94,    -1,    96,
+     782,    98,    99,   100,    -1,    -1,   103,    -1,    -1,    -1,
+      -1,   793,   794,   795,   796,   797,   798,   799,   800,   801,
+     802,   803,   804,   805,   806,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,    -1,    -1,     8,    -1,    10,
+      11,    12,    13,    -1,   836,    16,    17,    18,    19,    20,
+      -1,    -1,    23,    -1,    -1,    26,    27,    28,    29,    30,
+      -1,    -1,    33,    34,    -1,    36,    -1,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    -1,
+      -1,    52,    53,    -1,    -1,    -1,    -1,    -1,   793,   794,
+     795,   796,   797,   798,   799,   800,   801,   802,   803,   804,
+     805,   806,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    88,    -1,    -1,
+      -1,    -1,    93,    94,    -1,    96,    -1,    98,    -1,   100,
+      -1,    -1,   103,     3,     4,     5,     6,    -1,     8,     9,
+      10,    11,    12,    13,    -1,    -1,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    -1,
+      40,    41,    42,    43,    44,    45,    46,    52,    53,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    -1,    -1,    -1,    79,    -1,    -1,    77,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    99,
+      -1,    -1,    -1,   103,     3,     4,     5,     6,    -1,     8,
+       9,    10,    11,    12,    13,    -1,    -1,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      -1,    40,    41,    42,    43,    44,    45,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      99,    -1,    -1,    -1,   103,     3,     4,     5,     6,    -1,
+       8,     9,    10,    11,    12,    13,    -1,    -1,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    -1,    40,    41,    42,    43,    44,    45,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    27,
+      28,    -1,    -1,    81,    -1,    -1,    -1,    -1,    36,    -1,
+      38,    -1,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,   100,    -1,    -1,   103,     3,     4,     5,     6,
+      -1,     8,     9,    10,    11,    12,    13,    -1,    -1,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    -1,    40,    41,    42,    43,    44,    45,    46,
+      98,    -1,   100,    -1,    -1,   103,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    89,    -1,     3,     4,     5,     6,    -1,     8,
+       9,    10,    11,    12,    13,    -1,   103,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      -1,    40,    41,    42,    43,    44,    45,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,     8,
+       9,    10,    11,    12,    13,    -1,    -1,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      89,    40,    41,    42,    43,    44,    45,    46,    -1,    -1,
+      12,    -1,    -1,    -1,   103,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    27,    28,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    36,    -1,    38,    -1,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    -1,    -1,
+      89,    -1,     3,     4,     5,     6,    -1,     8,     9,    10,
+      11,    12,    13,    -1,   103,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    -1,    40,
+      41,    42,    43,    44,    45,    46,    98,    -1,   100,    -1,
+      -1,   103,     3,     4,     5,     6,    -1,     8,     9,    10,
+      11,    12,    13,    -1,    -1,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    89,    40,
+      41,    42,    43,    44,    45,    46,     3,     4,     5,     6,
+      -1,    -1,   103,    -1,    -1,    12,    13,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      27,    28,    29,    30,    -1,    -1,    33,    -1,    -1,    -1,
+      -1,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,
+      -1,    -1,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     6,    -1,    -1,
+      -1,    78,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    88,    -1,    -1,    -1,    -1,    93,    94,    27,    28,
+      -1,    98,    -1,   100,    -1,    -1,   103,    36,    -1,    38,
+      -1,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,
+      -1,    -1,    -1,    -1,    -1,     6,    -1,    -1,    -1,    -1,
+      -1,    12,    13,    -1,    -1,    -1,    -1,    -1,    97,    98,
+      -1,   100,    -1,    -1,   103,   104,    27,    28,    29,    30,
+      -1,    -1,    33,    -1,    -1,    36,    -1,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    -1,
+      -1,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      -1,    -1,    -1,     6,    -1,    -1,    87,    88,    89,    12,
+      13,    -1,    93,    94,    -1,    -1,    -1,    98,    -1,   100,
+      -1,    -1,   103,    -1,    27,    28,    29,    30,    -1,    -1,
+      33,    -1,    -1,    36,    -1,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    -1,    -1,    52,
+      53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    88,    -1,    -1,    -1,    -1,
+      93,    94,    -1,    -1,    -1,    98,    -1,   100,    -1,    -1,
+     103,     3,     4,     5,     6,    -1,     8,     9,    10,    11,
+      12,    13,    -1,    -1,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    -1,    40,    41,
+      42,    43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,
+       8,     9,    10,    11,    12,    13,    -1,    99,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    -1,    40,    41,    42,    43,    44,    45,    46,    -1,
+      -1,    -1,    -1,    -1,    12,    13,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    27,
+      28,    29,    30,    -1,    -1,    33,    -1,    -1,    36,    77,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,
+      -1,    99,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,
+      78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,
+      88,    12,    13,    -1,    -1,    93,    94,    -1,    -1,    -1,
+      98,    -1,   100,   101,    -1,   103,    27,    28,    29,    30,
+      -1,    -1,    33,    -1,    -1,    36,    -1,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    -1,
+      -1,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    77,    78,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    87,    88,    12,    13,
+      -1,    -1,    93,    94,    -1,    -1,    -1,    98,    -1,   100,
+      -1,    -1,   103,    27,    28,    29,    30,    -1,    -1,    33,
+      -1,    -1,    36,    -1,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    -1,    -1,    52,    53,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    88,    12,    13,    -1,    -1,    93,
+      94,    -1,    -1,    -1,    98,    -1,   100,    -1,    -1,   103,
+      27,    28,    29,    30,    -1,    -1,    33,    -1,    -1,    36,
+      -1,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    -1,    12,    13,    -1,    -1,    -1,    -1,    -1,
+      87,    88,    -1,    -1,    -1,    -1,    93,    94,    27,    28,
+      29,    30,    -1,   100,    33,    -1,   103,    -1,    -1,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,    88,
+      12,    13,    -1,    -1,    93,    94,    -1,    -1,    -1,    98,
+      -1,   100,    -1,    -1,   103,    27,    28,    29,    30,    -1,
+      -1,    33,    -1,    -1,    36,    -1,    38,    12,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    -1,    -1,
+      52,    53,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    36,    -1,    38,    -1,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    87,    88,    -1,    -1,    -1,
+      -1,    93,    94,    -1,    -1,    -1,    98,    -1,   100,    -1,
+      -1,   103,    77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    98,    -1,   100,    -1,    -1,   103,     3,
+       4,     5,     6,    -1,     8,     9,    10,    11,    12,    13,
+      -1,    -1,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    -1,    40,    41,    42,    43,
+      44,    45,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,     6,    -1,     8,     9,    10,    11,
+      12,    13,    -1,    77,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    -1,    40,    41,
+      42,    43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,    -1,     8,     9,
+      10,    11,    12,    13,    -1,    77,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    -1,
+      40,    41,    42,    43,    44,    45,    46
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,   106,   107,     0,     3,     4,     5,     8,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    23,
+      26,    27,    28,    29,    30,    33,    34,    36,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      52,    53,    78,    87,    88,    93,    94,    96,    98,   100,
+     103,   108,   110,   111,   119,   125,   126,   132,   133,   134,
+     135,   136,   141,   146,   147,   156,   157,   158,   159,   160,
+     161,   163,   167,   171,   175,   179,   184,   186,   188,   190,
+     192,   194,   204,   205,   206,   218,   220,   221,   229,    44,
+      98,   103,   128,   130,   239,   244,   128,   128,   100,    13,
+     100,    13,    27,    28,    29,    30,    33,    36,    38,    40,
+      41,    42,    43,    44,    45,    46,    47,    52,    53,    87,
+      88,    93,    94,    98,   100,   146,   162,   165,   169,   173,
+     177,   183,   185,   187,   189,   191,   193,   203,   205,   207,
+     218,   220,   221,   228,   229,    44,    78,    12,    44,   183,
+     185,    44,    46,    89,    98,   112,   113,   116,   117,   118,
+      22,    89,    98,   120,   126,   146,   147,   206,   100,   110,
+      44,    44,   100,   125,   162,   189,   191,   183,   183,   183,
+     100,    44,    89,   165,    76,    81,   165,   230,   183,   183,
+     100,   183,   183,   183,   183,   109,   162,    97,   104,   222,
+     223,   224,    96,    96,     6,     7,    96,    96,    96,    96,
+      97,    80,    31,    32,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,   181,   181,    52,    53,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      79,   100,   197,   199,   195,    79,   236,     3,     4,     5,
+       6,     8,     9,    10,    11,    12,    13,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      40,    41,    42,    43,    44,    45,    46,    77,    99,   235,
+     240,   241,   242,   243,    97,   246,   247,    97,    79,    79,
+     162,   100,     3,     4,     5,    44,    98,   103,   127,   137,
+     138,   164,   168,   172,   176,   180,   184,   186,   188,   218,
+     220,   249,   250,   255,   259,   183,   189,   191,   183,   183,
+     183,    37,    44,   208,   183,   183,   183,   183,   183,   183,
+      12,    44,    77,    89,    99,   103,   213,   214,   215,   216,
+     217,   226,   231,   232,   233,   234,   235,   162,    97,    80,
+     181,   181,    52,    53,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    79,   197,   195,    76,   100,
+      44,   124,    22,    44,    99,   114,   115,    44,   123,    97,
+      96,   147,   167,   206,    44,   123,   124,    22,    44,    99,
+     121,   122,    96,   123,    96,   162,    16,   162,    24,    25,
+     152,   154,   100,   162,   208,   165,   125,   167,   219,   110,
+      50,    51,    44,    77,   148,   149,   150,   151,   238,   239,
+     244,   248,    99,   110,   101,    97,   104,   165,   225,   226,
+      97,   104,    89,   145,   145,   165,   165,    89,   183,   183,
+     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   165,   165,   200,   201,   202,   226,   102,   103,   196,
+     198,   199,   229,   196,   165,    81,   236,    44,    81,    99,
+      97,   227,   247,   104,   238,   245,   248,   130,   165,   165,
+     101,     3,     4,     5,    44,   138,   188,    44,   129,   131,
+     239,   244,   260,   129,   260,   129,   260,    44,    77,    99,
+     235,   251,   252,   253,   254,    97,   246,    96,    31,    44,
+     139,    97,    80,    32,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,   182,   182,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    79,   100,
+     165,   208,    98,   209,    44,    89,   103,   217,   234,   217,
+     165,   217,   165,   100,    97,   227,    81,   101,   165,   165,
+     183,   183,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   165,   165,   165,   219,   148,    44,   124,   124,    97,
+     227,   118,   113,   117,    96,   118,    44,   124,   124,    97,
+     227,   118,   101,   100,   101,   100,   125,   154,   155,   200,
+     101,   209,   230,   236,    44,   101,    97,   236,   236,   104,
+     222,   223,    44,   100,    44,   100,    81,   101,    97,   234,
+     162,   238,   238,   242,   243,    97,   227,    97,   227,   110,
+      44,   239,   244,   139,    79,   237,    97,    79,    79,    81,
+     236,   185,    81,    99,    97,   227,    98,   104,   185,   250,
+     254,   255,   256,   257,   258,   140,   162,   162,   162,   166,
+     170,   174,   178,   183,   185,   218,   220,   165,    89,   183,
+     183,   166,   166,   166,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   200,   209,    44,    96,   210,   211,   212,
+     213,   217,   165,   100,   104,   148,   232,    99,   165,    81,
+     101,    44,    44,   115,    99,    96,    96,   123,    22,    44,
+      22,    44,   122,    99,    96,   110,   162,    98,    44,   153,
+     239,   244,   101,   110,    76,   151,   238,   225,   100,   148,
+     100,   148,   165,   202,   104,   246,   104,   104,     9,   162,
+     166,    44,   131,   239,   244,   166,   166,   257,   257,   253,
+     254,    44,    77,    99,   235,   227,    97,   227,   236,    96,
+     101,   101,    80,   182,   182,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    79,    81,   101,    44,
+     213,    99,   212,   104,   101,   238,    81,   101,   165,    76,
+     118,   101,   142,   101,   195,   219,   148,   101,   148,   101,
+     238,   248,   110,   101,   185,   104,   246,   104,   140,   110,
+     110,   165,   183,   183,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   166,   166,   166,   165,   195,   213,   125,
+     101,   165,   125,   219,    96,    96,    21,    22,    99,   143,
+     125,   101,   125,   101,   125,   227,   110,   254,   257,   101,
+      81,   125,   162,    81,   125,   125,   104,   227,   110,   165,
+      81,   144,   104,   144,   110
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   105,   106,   107,   107,   108,   108,   108,   109,   109,
+     110,   110,   110,   110,   110,   110,   110,   110,   110,   110,
+     110,   110,   110,   110,   110,   110,   110,   110,   111,   111,
+     112,   112,   112,   112,   112,   113,   113,   114,   114,   115,
+     115,   115,   116,   117,   118,   119,   119,   119,   119,   119,
+     119,   119,   119,   119,   119,   120,   120,   121,   121,   122,
+     122,   122,   122,   122,   122,   123,   124,   125,   126,   126,
+     126,   127,   127,   127,   128,   128,   129,   129,   130,   130,
+     130,   131,   131,   131,   132,   132,   133,   133,   134,   134,
+     134,   134,   135,   136,   137,   137,   137,   138,   138,   138,
+     139,   140,   140,   141,   142,   142,   143,   143,   144,   144,
+     145,   145,   146,   146,   147,   147,   148,   148,   149,   149,
+     149,   150,   150,   151,   152,   153,   153,   153,   154,   155,
+     155,   156,   156,   157,   158,   159,   159,   160,   160,   161,
+     162,   162,   163,   163,   164,   164,   165,   165,   165,   165,
+     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   166,   166,   166,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   166,   166,   166,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   168,   168,   168,   168,   168,   168,   168,   168,   168,
+     168,   168,   168,   168,   168,   168,   169,   169,   170,   170,
+     171,   171,   172,   172,   173,   173,   174,   174,   175,   175,
+     176,   176,   177,   177,   178,   178,   179,   179,   180,   180,
+     181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
+     181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
+     181,   181,   181,   181,   182,   182,   182,   182,   182,   182,
+     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
+     182,   182,   182,   182,   182,   182,   182,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   184,   184,
+     184,   184,   184,   184,   184,   184,   184,   184,   184,   185,
+     185,   185,   186,   186,   186,   187,   187,   188,   188,   189,
+     189,   190,   190,   191,   191,   192,   192,   193,   194,   195,
+     195,   196,   196,   196,   197,   197,   198,   198,   199,   200,
+     200,   201,   201,   202,   202,   203,   203,   203,   203,   203,
+     203,   203,   203,   203,   203,   203,   203,   203,   203,   203,
+     203,   204,   204,   204,   204,   204,   204,   204,   204,   204,
+     204,   204,   204,   204,   204,   205,   205,   206,   207,   207,
+     208,   208,   209,   210,   210,   211,   211,   212,   212,   212,
+     212,   213,   214,   214,   214,   214,   215,   216,   217,   217,
+     218,   218,   218,   218,   219,   219,   220,   220,   220,   221,
+     221,   221,   221,   222,   222,   223,   223,   224,   224,   224,
+     225,   225,   226,   227,   227,   228,   228,   229,   229,   230,
+     230,   231,   231,   232,   232,   232,   232,   232,   232,   232,
+     233,   234,   234,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   236,   236,   237,   237,   238,   238,   238,   239,
+     239,   240,   240,   240,   241,   241,   242,   242,   242,   243,
+     244,   244,   244,   244,   245,   245,   246,   246,   247,   247,
+     248,   249,   249,   250,   250,   251,   251,   251,   252,   252,
+     253,   253,   253,   254,   255,   255,   255,   255,   256,   256,
+     257,   258,   258,   258,   259,   259,   259,   260,   260,   260
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     2,     1,     1,     1,     0,     2,
+       1,     2,     2,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     2,     2,     2,     1,     5,     3,
+       1,     1,     1,     3,     3,     2,     4,     1,     3,     1,
+       3,     3,     1,     3,     1,     5,     3,     5,     7,     3,
+       2,     2,     3,     3,     4,     2,     4,     1,     3,     1,
+       3,     3,     3,     3,     1,     1,     1,     3,     2,     2,
+       2,     2,     2,     2,     1,     3,     1,     3,     2,     3,
+       3,     2,     3,     3,     1,     2,     5,     7,     9,     7,
+       7,     8,     5,     7,     0,     1,     1,     1,     1,     1,
+       1,     0,     1,     7,     0,     2,     4,     3,     0,     2,
+       1,     0,     1,     0,     8,     7,     0,     1,     1,     3,
+       1,     1,     3,     1,     5,     1,     1,     1,     2,     0,
+       1,     4,     3,     5,     3,     1,     2,     1,     2,     2,
+       1,     3,     1,     3,     1,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     1,     1,
+       1,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     1,     1,     1,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     1,     1,
+       1,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     1,     1,     1,     1,     5,     1,     5,
+       1,     5,     1,     5,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     3,     3,     3,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     1,     1,     1,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     1,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     1,
+       2,     2,     1,     2,     2,     1,     1,     1,     1,     2,
+       6,     2,     6,     1,     2,     1,     2,     2,     2,     0,
+       2,     2,     3,     1,     2,     1,     1,     1,     3,     0,
+       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     1,     1,     1,     1,     8,     7,     4,     4,     3,
+       2,     0,     3,     0,     1,     2,     1,     1,     2,     3,
+       1,     5,     1,     2,     2,     3,     5,     6,     1,     3,
+       3,     6,     4,     7,     1,     1,     1,     2,     3,     2,
+       3,     3,     4,     1,     2,     0,     1,     2,     4,     3,
+       1,     1,     2,     0,     1,     2,     4,     1,     2,     2,
+       3,     1,     3,     3,     1,     1,     1,     1,     1,     1,
+       5,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     2,     0,     2,     2,     2,     2,     2,
+       3,     2,     3,     1,     1,     3,     3,     3,     2,     2,
+       3,     5,     8,     5,     1,     4,     0,     1,     1,     2,
+       2,     1,     1,     2,     3,     2,     3,     1,     1,     3,
+       3,     3,     2,     2,     3,     5,     8,     5,     1,     4,
+       2,     1,     1,     1,     2,     2,     2,     1,     1,     1
+};
+
+
+/* YYDPREC[RULE-NUM] -- Dynamic precedence of rule #RULE-NUM (0 if none).  */
+static const yytype_int8 yydprec[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       2,     2,     2,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     1,     2,     2,     0,     0,     0,     0,     0,     0
+};
+
+/* YYMERGER[RULE-NUM] -- Index of merging function for rule #RULE-NUM.  */
+static const yytype_int8 yymerger[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYIMMEDIATE[RULE-NUM] -- True iff rule #RULE-NUM is not to be deferred, as
+   in the case of predicates.  */
+static const yybool yyimmediate[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYCONFLP[YYPACT[STATE-NUM]] -- Pointer into YYCONFL of start of
+   list of conflicting reductions corresponding to action entry for
+   state STATE-NUM in yytable.  0 means no conflicts.  The list in
+   yyconfl is terminated by a rule number of 0.  */
+static const yytype_int8 yyconflp[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    97,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,     0,   101,     0,     0,     0,     0,
+     103,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    89,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   107,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   105,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       3,     0,     0,     0,     0,     0,     5,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     7,     9,     0,     0,     0,     0,     0,     0,     0,
+      11,    91,    13,     0,    15,    17,    19,    21,    23,    25,
+      27,    29,    31,    33,     0,     0,     0,    93,     0,    95,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    35,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    37,     0,    39,     0,     0,    41,    43,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    45,     0,     0,
+       0,     0,     0,    47,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    49,    51,
+       0,     0,     0,     0,     0,     0,     0,    53,     0,    55,
+       0,    57,    59,    61,    63,    65,    67,    69,    71,    73,
+      75,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    77,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    79,    81,
+       0,    83,     0,     0,    85,    87,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     1,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYCONFL[I] -- lists of conflicting rule numbers, each terminated by
+   0, pointed into by YYCONFLP.  */
+static const short yyconfl[] =
+{
+       0,   396,     0,   496,     0,   496,     0,   496,     0,   496,
+       0,   496,     0,   496,     0,   496,     0,   496,     0,   496,
+       0,   496,     0,   496,     0,   496,     0,   496,     0,   496,
+       0,   496,     0,   496,     0,   496,     0,   496,     0,   496,
+       0,   496,     0,   496,     0,   498,     0,   498,     0,   498,
+       0,   498,     0,   498,     0,   498,     0,   498,     0,   498,
+       0,   498,     0,   498,     0,   498,     0,   498,     0,   498,
+       0,   498,     0,   498,     0,   498,     0,   498,     0,   403,
+       0,   498,     0,   498,     0,   498,     0,   498,     0,   409,
+       0,   431,     0,   472,     0,   472,     0,   503,     0,   503,
+       0,   503,     0,   503,     0,   432,     0,   513,     0
+};
+
+
+
+
+#undef yynerrs
+#define yynerrs (yystackp->yyerrcnt)
+#undef yychar
+#define yychar (yystackp->yyrawchar)
+#undef yylval
+#define yylval (yystackp->yyval)
+#undef yylloc
+#define yylloc (yystackp->yyloc)
+
+
+enum { YYENOMEM = -2 };
+
+typedef enum { yyok, yyaccept, yyabort, yyerr, yynomem } YYRESULTTAG;
+
+#define YYCHK(YYE)                              \
+  do {                                          \
+    YYRESULTTAG yychk_flag = YYE;               \
+    if (yychk_flag != yyok)                     \
+      return yychk_flag;                        \
+  } while (0)
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   SIZE_MAX < YYMAXDEPTH * sizeof (GLRStackItem)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+/* Minimum number of free items on the stack allowed after an
+   allocation.  This is to allow allocation and initialization
+   to be completed by functions that call yyexpandGLRStack before the
+   stack is expanded, thus insuring that all necessary pointers get
+   properly redirected to new data.  */
+#define YYHEADROOM 2
+
+#ifndef YYSTACKEXPANDABLE
+#  define YYSTACKEXPANDABLE 1
+#endif
+
+#if YYSTACKEXPANDABLE
+# define YY_RESERVE_GLRSTACK(Yystack)                   \
+  do {                                                  \
+    if (Yystack->yyspaceLeft < YYHEADROOM)              \
+      yyexpandGLRStack (Yystack);                       \
+  } while (0)
+#else
+# define YY_RESERVE_GLRSTACK(Yystack)                   \
+  do {                                                  \
+    if (Yystack->yyspaceLeft < YYHEADROOM)              \
+      yyMemoryExhausted (Yystack);                      \
+  } while (0)
+#endif
+
+/** State numbers. */
+typedef int yy_state_t;
+
+/** Rule numbers. */
+typedef int yyRuleNum;
+
+/** Item references. */
+typedef short yyItemNum;
+
+typedef struct yyGLRState yyGLRState;
+typedef struct yyGLRStateSet yyGLRStateSet;
+typedef struct yySemanticOption yySemanticOption;
+typedef union yyGLRStackItem yyGLRStackItem;
+typedef struct yyGLRStack yyGLRStack;
+
+struct yyGLRState
+{
+  /** Type tag: always true.  */
+  yybool yyisState;
+  /** Type tag for yysemantics.  If true, yyval applies, otherwise
+   *  yyfirstVal applies.  */
+  yybool yyresolved;
+  /** Number of corresponding LALR(1) machine state.  */
+  yy_state_t yylrState;
+  /** Preceding state in this stack */
+  yyGLRState* yypred;
+  /** Source position of the last token produced by my symbol */
+  YYPTRDIFF_T yyposn;
+  union {
+    /** First in a chain of alternative reductions producing the
+     *  nonterminal corresponding to this state, threaded through
+     *  yynext.  */
+    yySemanticOption* yyfirstVal;
+    /** Semantic value for this state.  */
+    YYSTYPE yyval;
+  } yysemantics;
+};
+
+struct yyGLRStateSet
+{
+  yyGLRState** yystates;
+  /** During nondeterministic operation, yylookaheadNeeds tracks which
+   *  stacks have actually needed the current lookahead.  During deterministic
+   *  operation, yylookaheadNeeds[0] is not maintained since it would merely
+   *  duplicate yychar != YYEMPTY.  */
+  yybool* yylookaheadNeeds;
+  YYPTRDIFF_T yysize;
+  YYPTRDIFF_T yycapacity;
+};
+
+struct yySemanticOption
+{
+  /** Type tag: always false.  */
+  yybool yyisState;
+  /** Rule number for this reduction */
+  yyRuleNum yyrule;
+  /** The last RHS state in the list of states to be reduced.  */
+  yyGLRState* yystate;
+  /** The lookahead for this reduction.  */
+  int yyrawchar;
+  YYSTYPE yyval;
+  /** Next sibling in chain of options.  To facilitate merging,
+   *  options are chained in decreasing order by address.  */
+  yySemanticOption* yynext;
+};
+
+/** Type of the items in the GLR stack.  The yyisState field
+ *  indicates which item of the union is valid.  */
+union yyGLRStackItem {
+  yyGLRState yystate;
+  yySemanticOption yyoption;
+};
+
+struct yyGLRStack {
+  int yyerrState;
+
+
+  int yyerrcnt;
+  int yyrawchar;
+  YYSTYPE yyval;
+
+  YYJMP_BUF yyexception_buffer;
+  yyGLRStackItem* yyitems;
+  yyGLRStackItem* yynextFree;
+  YYPTRDIFF_T yyspaceLeft;
+  yyGLRState* yysplitPoint;
+  yyGLRState* yylastDeleted;
+  yyGLRStateSet yytops;
+};
+
+#if YYSTACKEXPANDABLE
+static void yyexpandGLRStack (yyGLRStack* yystackp);
+#endif
+
+_Noreturn static void
+yyFail (yyGLRStack* yystackp, JSParser *ctx, const char* yymsg)
+{
+  if (yymsg != YY_NULLPTR)
+    yyerror (ctx, yymsg);
+  YYLONGJMP (yystackp->yyexception_buffer, 1);
+}
+
+_Noreturn static void
+yyMemoryExhausted (yyGLRStack* yystackp)
+{
+  YYLONGJMP (yystackp->yyexception_buffer, 2);
+}
+
+/** Accessing symbol of state YYSTATE.  */
+static inline yysymbol_kind_t
+yy_accessing_symbol (yy_state_t yystate)
+{
+  return YY_CAST (yysymbol_kind_t, yystos[yystate]);
+}
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "VAR", "LET", "CONST",
+  "FUNCTION", "FUNCTION_DECL", "IF", "ELSE", "FOR", "RETURN", "ASYNC",
+  "AWAIT", "IMPORT", "EXPORT", "WHILE", "DO", "BREAK", "CONTINUE",
+  "SWITCH", "CASE", "DEFAULT", "TRY", "CATCH", "FINALLY", "THROW", "NEW",
+  "THIS", "TYPEOF", "DELETE", "IN", "INSTANCEOF", "VOID", "WITH",
+  "DEBUGGER", "CLASS", "EXTENDS", "SUPER", "YIELD", "TRUE", "FALSE",
+  "NULL_T", "UNDEFINED", "IDENTIFIER", "NUMBER", "STRING", "REGEX",
+  "TEMPLATE_NO_SUB", "TEMPLATE_HEAD", "TEMPLATE_MIDDLE", "TEMPLATE_TAIL",
+  "PLUS_PLUS", "MINUS_MINUS", "EQ", "NE", "EQ_STRICT", "NE_STRICT", "LE",
+  "GE", "AND", "OR", "LSHIFT", "RSHIFT", "URSHIFT", "PLUS_ASSIGN",
+  "MINUS_ASSIGN", "STAR_ASSIGN", "SLASH_ASSIGN", "PERCENT_ASSIGN",
+  "AND_ASSIGN", "OR_ASSIGN", "XOR_ASSIGN", "LSHIFT_ASSIGN",
+  "RSHIFT_ASSIGN", "URSHIFT_ASSIGN", "ARROW", "ELLIPSIS", "ARROW_HEAD",
+  "'='", "'?'", "':'", "'|'", "'^'", "'&'", "'<'", "'>'", "'+'", "'-'",
+  "'*'", "'/'", "'%'", "UMINUS", "'!'", "'~'", "IF_NO_ELSE", "';'", "','",
+  "'{'", "'}'", "'('", "')'", "'.'", "'['", "']'", "$accept", "program",
+  "module_item_list", "module_item", "stmt_list", "stmt", "import_stmt",
+  "import_clause", "named_imports", "import_specifier_list",
+  "import_specifier", "import_default_binding", "namespace_import",
+  "module_specifier", "export_stmt", "export_clause",
+  "export_specifier_list", "export_specifier", "from_keyword",
+  "as_keyword", "block", "var_stmt", "var_stmt_no_in", "var_decl_list",
+  "var_decl_list_no_in", "var_decl", "var_decl_no_in", "return_stmt",
+  "if_stmt", "for_stmt", "while_stmt", "do_stmt", "for_init",
+  "for_in_left", "for_of_keyword", "opt_expr", "switch_stmt",
+  "switch_case_list", "switch_case", "case_stmt_seq",
+  "generator_marker_opt", "async_modifier_opt", "func_decl",
+  "opt_param_list", "param_list", "param_list_items", "rest_param",
+  "catch_clause", "catch_parameter", "finally_clause",
+  "finally_clause_opt", "try_stmt", "with_stmt", "labeled_stmt",
+  "break_stmt", "continue_stmt", "throw_stmt", "expr", "expr_no_obj",
+  "expr_no_in_no_obj", "assignment_expr", "assignment_expr_no_in",
+  "assignment_expr_no_obj", "assignment_expr_no_in_no_obj",
+  "conditional_expr", "conditional_expr_no_in", "conditional_expr_no_obj",
+  "conditional_expr_no_in_no_obj", "binary_expr", "binary_expr_no_in",
+  "binary_expr_no_obj", "binary_expr_no_in_no_obj", "binary_chain",
+  "binary_chain_no_in", "binary_chain_no_obj", "binary_chain_no_in_no_obj",
+  "binary_operator", "binary_operator_no_in", "unary_expr",
+  "unary_expr_no_obj", "postfix_expr", "postfix_expr_no_obj",
+  "left_hand_side_expr", "left_hand_side_expr_no_obj", "member_expr",
+  "member_expr_no_obj", "new_expr", "new_expr_no_obj", "call_expr",
+  "call_expr_no_obj", "member_suffix_seq", "member_noncall_suffix",
+  "call_suffix_seq", "call_any_suffix", "call_suffix_initial",
+  "opt_arg_list", "arg_list", "arg_item", "primary_expr",
+  "primary_expr_no_obj", "function_expr", "class_decl", "class_expr",
+  "class_heritage_opt", "class_body", "class_element_list_opt",
+  "class_element_list", "class_element", "method_definition",
+  "method_head", "getter_definition", "setter_definition", "method_name",
+  "arrow_function", "arrow_body", "yield_expr", "array_literal", "elision",
+  "elision_opt", "element_list", "el_item", "spread_element",
+  "opt_trailing_comma", "object_literal", "template_literal",
+  "template_part_list", "prop_list", "prop", "computed_property",
+  "property_name", "property_name_keyword", "binding_initializer_opt",
+  "binding_initializer_opt_no_in", "binding_element", "object_binding",
+  "binding_property_sequence", "binding_property_list", "binding_property",
+  "binding_rest_property", "array_binding", "binding_element_list",
+  "binding_elision_opt", "binding_elision", "binding_rest_element",
+  "assignment_pattern", "object_assignment_pattern",
+  "assignment_property_sequence", "assignment_property_list",
+  "assignment_property", "assignment_rest_element",
+  "array_assignment_pattern", "assignment_element_list",
+  "assignment_element", "assignment_target", "for_binding",
+  "for_binding_declarator", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+/** Left-hand-side symbol for rule #YYRULE.  */
+static inline yysymbol_kind_t
+yylhsNonterm (yyRuleNum yyrule)
+{
+  return YY_CAST (yysymbol_kind_t, yyr1[yyrule]);
+}
+
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  define YYFPRINTF fprintf
+# endif
+
+# define YY_FPRINTF                             \
+  YY_IGNORE_USELESS_CAST_BEGIN YY_FPRINTF_
+
+# define YY_FPRINTF_(Args)                      \
+  do {                                          \
+    YYFPRINTF Args;                             \
+    YY_IGNORE_USELESS_CAST_END                  \
+  } while (0)
+
+# define YY_DPRINTF                             \
+  YY_IGNORE_USELESS_CAST_BEGIN YY_DPRINTF_
+
+# define YY_DPRINTF_(Args)                      \
+  do {                                          \
+    if (yydebug)                                \
+      YYFPRINTF Args;                           \
+    YY_IGNORE_USELESS_CAST_END                  \
+  } while (0)
+
+
+
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, JSParser *ctx)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (ctx);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, JSParser *ctx)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep, ctx);
+  YYFPRINTF (yyo, ")");
+}
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                  \
+  do {                                                                  \
+    if (yydebug)                                                        \
+      {                                                                 \
+        YY_FPRINTF ((stderr, "%s ", Title));                            \
+        yy_symbol_print (stderr, Kind, Value, ctx);        \
+        YY_FPRINTF ((stderr, "\n"));                                    \
+      }                                                                 \
+  } while (0)
+
+static inline void
+yy_reduce_print (yybool yynormal, yyGLRStackItem* yyvsp, YYPTRDIFF_T yyk,
+                 yyRuleNum yyrule, JSParser *ctx);
+
+# define YY_REDUCE_PRINT(Args)          \
+  do {                                  \
+    if (yydebug)                        \
+      yy_reduce_print Args;             \
+  } while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+
+static void yypstack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+  YY_ATTRIBUTE_UNUSED;
+static void yypdumpstack (yyGLRStack* yystackp)
+  YY_ATTRIBUTE_UNUSED;
+
+#else /* !YYDEBUG */
+
+# define YY_DPRINTF(Args) do {} while (yyfalse)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_REDUCE_PRINT(Args)
+
+#endif /* !YYDEBUG */
+
+#ifndef yystrlen
+# define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+/** Fill in YYVSP[YYLOW1 .. YYLOW0-1] from the chain of states starting
+ *  at YYVSP[YYLOW0].yystate.yypred.  Leaves YYVSP[YYLOW1].yystate.yypred
+ *  containing the pointer to the next state in the chain.  */
+static void yyfillin (yyGLRStackItem *, int, int) YY_ATTRIBUTE_UNUSED;
+static void
+yyfillin (yyGLRStackItem *yyvsp, int yylow0, int yylow1)
+{
+  int i;
+  yyGLRState *s = yyvsp[yylow0].yystate.yypred;
+  for (i = yylow0-1; i >= yylow1; i -= 1)
+    {
+#if YYDEBUG
+      yyvsp[i].yystate.yylrState = s->yylrState;
+#endif
+      yyvsp[i].yystate.yyresolved = s->yyresolved;
+      if (s->yyresolved)
+        yyvsp[i].yystate.yysemantics.yyval = s->yysemantics.yyval;
+      else
+        /* The effect of using yyval or yyloc (in an immediate rule) is
+         * undefined.  */
+        yyvsp[i].yystate.yysemantics.yyfirstVal = YY_NULLPTR;
+      s = yyvsp[i].yystate.yypred = s->yypred;
+    }
+}
+
+
+/** If yychar is empty, fetch the next token.  */
+static inline yysymbol_kind_t
+yygetToken (int *yycharp, yyGLRStack* yystackp, JSParser *ctx)
+{
+  yysymbol_kind_t yytoken;
+  YY_USE (ctx);
+  if (*yycharp == YYEMPTY)
+    {
+      YY_DPRINTF ((stderr, "Reading a token\n"));
+      *yycharp = yylex (&yylval, ctx);
+    }
+  if (*yycharp <= YYEOF)
+    {
+      *yycharp = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YY_DPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (*yycharp);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+  return yytoken;
+}
+
+/* Do nothing if YYNORMAL or if *YYLOW <= YYLOW1.  Otherwise, fill in
+ * YYVSP[YYLOW1 .. *YYLOW-1] as in yyfillin and set *YYLOW = YYLOW1.
+ * For convenience, always return YYLOW1.  */
+static inline int yyfill (yyGLRStackItem *, int *, int, yybool)
+     YY_ATTRIBUTE_UNUSED;
+static inline int
+yyfill (yyGLRStackItem *yyvsp, int *yylow, int yylow1, yybool yynormal)
+{
+  if (!yynormal && yylow1 < *yylow)
+    {
+      yyfillin (yyvsp, *yylow, yylow1);
+      *yylow = yylow1;
+    }
+  return yylow1;
+}
+
+/** Perform user action for rule number YYN, with RHS length YYRHSLEN,
+ *  and top stack item YYVSP.  YYLVALP points to place to put semantic
+ *  value ($$), and yylocp points to place for location information
+ *  (@$).  Returns yyok for normal return, yyaccept for YYACCEPT,
+ *  yyerr for YYERROR, yyabort for YYABORT, yynomem for YYNOMEM.  */
+static YYRESULTTAG
+yyuserAction (yyRuleNum yyrule, int yyrhslen, yyGLRStackItem* yyvsp,
+              yyGLRStack* yystackp, YYPTRDIFF_T yyk,
+              YYSTYPE* yyvalp, JSParser *ctx)
+{
+  const yybool yynormal YY_ATTRIBUTE_UNUSED = yystackp->yysplitPoint == YY_NULLPTR;
+  int yylow = 1;
+  YY_USE (yyvalp);
+  YY_USE (ctx);
+  YY_USE (yyk);
+  YY_USE (yyrhslen);
+# undef yyerrok
+# define yyerrok (yystackp->yyerrState = 0)
+# undef YYACCEPT
+# define YYACCEPT return yyaccept
+# undef YYABORT
+# define YYABORT return yyabort
+# undef YYNOMEM
+# define YYNOMEM return yynomem
+# undef YYERROR
+# define YYERROR return yyerrok, yyerr
+# undef YYRECOVERING
+# define YYRECOVERING() (yystackp->yyerrState != 0)
+# undef yyclearin
+# define yyclearin (yychar = YYEMPTY)
+# undef YYFILL
+# define YYFILL(N) yyfill (yyvsp, &yylow, (N), yynormal)
+# undef YYBACKUP
+# define YYBACKUP(Token, Value)                                              \
+  return yyerror (ctx, YY_("syntax error: cannot back up")),     \
+         yyerrok, yyerr
+
+  if (yyrhslen == 0)
+    *yyvalp = yyval_default;
+  else
+    *yyvalp = yyvsp[YYFILL (1-yyrhslen)].yystate.yysemantics.yyval;
+  /* If yyk == -1, we are running a deferred action on a temporary
+     stack.  In that case, YY_REDUCE_PRINT must not play with YYFILL,
+     so pretend the stack is "normal". */
+  YY_REDUCE_PRINT ((yynormal || yyk == -1, yyvsp, yyk, yyrule, ctx));
+  switch (yyrule)
+    {
+  case 2: /* program: module_item_list  */
+#line 757 "build/generated/parser.y"
+      {
+          if (ctx->statement_mode) {
+              // 分段解析到了输入末尾：交给驱动拼接
+              ctx->statement_items = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list);
+              ctx->statement_lookahead = false;
+              ((*yyvalp).node) = NULL;
+          } else {
+              ((*yyvalp).node) = ast_make_program((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list));
+              ctx->ast_root = ((*yyvalp).node);
+          }
+      }
+#line 3649 "build/generated/parser_bison.c"
+    break;
+
+  case 3: /* module_item_list: %empty  */
+#line 772 "build/generated/parser.y"
+      { ((*yyvalp).list) = NULL; }
+#line 3655 "build/generated/parser_bison.c"
+    break;
+
+  case 4: /* module_item_list: module_item_list module_item  */
+#line 774 "build/generated/parser.y"
+      {
+          ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+          END_STATEMENT_SEGMENT(((*yyvalp).list));
+      }
+#line 3664 "build/generated/parser_bison.c"
+    break;
+
+  case 5: /* module_item: stmt  */
+#line 782 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3670 "build/generated/parser_bison.c"
+    break;
+
+  case 6: /* module_item: import_stmt  */
+#line 784 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3676 "build/generated/parser_bison.c"
+    break;
+
+  case 7: /* module_item: export_stmt  */
+#line 786 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3682 "build/generated/parser_bison.c"
+    break;
+
+  case 8: /* stmt_list: %empty  */
+#line 791 "build/generated/parser.y"
+      { ((*yyvalp).list) = NULL; }
+#line 3688 "build/generated/parser_bison.c"
+    break;
+
+  case 9: /* stmt_list: stmt_list stmt  */
+#line 793 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 3694 "build/generated/parser_bison.c"
+    break;
+
+  case 10: /* stmt: ';'  */
+#line 798 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_empty_statement(); }
+#line 3700 "build/generated/parser_bison.c"
+    break;
+
+  case 11: /* stmt: var_stmt ';'  */
+#line 800 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node); }
+#line 3706 "build/generated/parser_bison.c"
+    break;
+
+  case 12: /* stmt: expr_no_obj ';'  */
+#line 802 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_expression_stmt((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node)); }
+#line 3712 "build/generated/parser_bison.c"
+    break;
+
+  case 13: /* stmt: block  */
+#line 804 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3718 "build/generated/parser_bison.c"
+    break;
+
+  case 14: /* stmt: if_stmt  */
+#line 806 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3724 "build/generated/parser_bison.c"
+    break;
+
+  case 15: /* stmt: for_stmt  */
+#line 808 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3730 "build/generated/parser_bison.c"
+    break;
+
+  case 16: /* stmt: while_stmt  */
+#line 810 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3736 "build/generated/parser_bison.c"
+    break;
+
+  case 17: /* stmt: do_stmt  */
+#line 812 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3742 "build/generated/parser_bison.c"
+    break;
+
+  case 18: /* stmt: switch_stmt  */
+#line 814 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3748 "build/generated/parser_bison.c"
+    break;
+
+  case 19: /* stmt: try_stmt  */
+#line 816 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3754 "build/generated/parser_bison.c"
+    break;
+
+  case 20: /* stmt: with_stmt  */
+#line 818 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3760 "build/generated/parser_bison.c"
+    break;
+
+  case 21: /* stmt: func_decl  */
+#line 820 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3766 "build/generated/parser_bison.c"
+    break;
+
+  case 22: /* stmt: class_decl  */
+#line 822 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3772 "build/generated/parser_bison.c"
+    break;
+
+  case 23: /* stmt: return_stmt ';'  */
+#line 824 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node); }
+#line 3778 "build/generated/parser_bison.c"
+    break;
+
+  case 24: /* stmt: break_stmt ';'  */
+#line 826 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node); }
+#line 3784 "build/generated/parser_bison.c"
+    break;
+
+  case 25: /* stmt: continue_stmt ';'  */
+#line 828 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node); }
+#line 3790 "build/generated/parser_bison.c"
+    break;
+
+  case 26: /* stmt: throw_stmt ';'  */
+#line 830 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node); }
+#line 3796 "build/generated/parser_bison.c"
+    break;
+
+  case 27: /* stmt: labeled_stmt  */
+#line 832 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 3802 "build/generated/parser_bison.c"
+    break;
+
+  case 28: /* import_stmt: IMPORT import_clause from_keyword module_specifier ';'  */
+#line 837 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_import_decl((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node)); }
+#line 3808 "build/generated/parser_bison.c"
+    break;
+
+  case 29: /* import_stmt: IMPORT module_specifier ';'  */
+#line 839 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_import_decl(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node)); }
+#line 3814 "build/generated/parser_bison.c"
+    break;
+
+  case 30: /* import_clause: import_default_binding  */
+#line 844 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 3820 "build/generated/parser_bison.c"
+    break;
+
+  case 31: /* import_clause: namespace_import  */
+#line 846 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 3826 "build/generated/parser_bison.c"
+    break;
+
+  case 32: /* import_clause: named_imports  */
+#line 848 "build/generated/parser.y"
+      { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 3832 "build/generated/parser_bison.c"
+    break;
+
+  case 33: /* import_clause: import_default_binding ',' namespace_import  */
+#line 850 "build/generated/parser.y"
+      { ASTList *list = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node)); ((*yyvalp).list) = ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 3838 "build/generated/parser_bison.c"
+    break;
+
+  case 34: /* import_clause: import_default_binding ',' named_imports  */
+#line 852 "build/generated/parser.y"
+      { ASTList *list = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node)); ((*yyvalp).list) = ast_list_concat(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 3844 "build/generated/parser_bison.c"
+    break;
+
+  case 35: /* named_imports: '{' '}'  */
+#line 857 "build/generated/parser.y"
+            { ((*yyvalp).list) = NULL; }
+#line 3850 "build/generated/parser_bison.c"
+    break;
+
+  case 36: /* named_imports: '{' import_specifier_list opt_trailing_comma '}'  */
+#line 859 "build/generated/parser.y"
+            { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list); }
+#line 3856 "build/generated/parser_bison.c"
+    break;
+
+  case 37: /* import_specifier_list: import_specifier  */
+#line 864 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 3862 "build/generated/parser_bison.c"
+    break;
+
+  case 38: /* import_specifier_list: import_specifier_list ',' import_specifier  */
+#line 866 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 3868 "build/generated/parser_bison.c"
+    break;
+
+  case 39: /* import_specifier: IDENTIFIER  */
+#line 871 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_import_specifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), false, false); }
+#line 3874 "build/generated/parser_bison.c"
+    break;
+
+  case 40: /* import_specifier: IDENTIFIER as_keyword IDENTIFIER  */
+#line 873 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_import_specifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), false, false); }
+#line 3880 "build/generated/parser_bison.c"
+    break;
+
+  case 41: /* import_specifier: DEFAULT as_keyword IDENTIFIER  */
+#line 875 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_import_specifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), ATOM(ctx->atoms, DEFAULT), false, false); }
+#line 3886 "build/generated/parser_bison.c"
+    break;
+
+  case 42: /* import_default_binding: IDENTIFIER  */
+#line 880 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_import_specifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), ATOM(ctx->atoms, DEFAULT), false, true); }
+#line 3892 "build/generated/parser_bison.c"
+    break;
+
+  case 43: /* namespace_import: '*' as_keyword IDENTIFIER  */
+#line 885 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_import_specifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), NULL, true, false); }
+#line 3898 "build/generated/parser_bison.c"
+    break;
+
+  case 44: /* module_specifier: STRING  */
+#line 890 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str)); }
+#line 3904 "build/generated/parser_bison.c"
+    break;
+
+  case 45: /* export_stmt: EXPORT export_clause from_keyword module_specifier ';'  */
+#line 895 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(false, false, NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node)); }
+#line 3910 "build/generated/parser_bison.c"
+    break;
+
+  case 46: /* export_stmt: EXPORT export_clause ';'  */
+#line 897 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(false, false, NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), NULL); }
+#line 3916 "build/generated/parser_bison.c"
+    break;
+
+  case 47: /* export_stmt: EXPORT '*' from_keyword module_specifier ';'  */
+#line 899 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(false, true, NULL, NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node)); }
+#line 3922 "build/generated/parser_bison.c"
+    break;
+
+  case 48: /* export_stmt: EXPORT '*' as_keyword IDENTIFIER from_keyword module_specifier ';'  */
+#line 901 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(false, true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.atom), NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node)); }
+#line 3928 "build/generated/parser_bison.c"
+    break;
+
+  case 49: /* export_stmt: EXPORT var_stmt ';'  */
+#line 903 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(false, false, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), NULL, NULL); }
+#line 3934 "build/generated/parser_bison.c"
+    break;
+
+  case 50: /* export_stmt: EXPORT func_decl  */
+#line 905 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(false, false, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL, NULL); }
+#line 3940 "build/generated/parser_bison.c"
+    break;
+
+  case 51: /* export_stmt: EXPORT class_decl  */
+#line 907 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(false, false, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL, NULL); }
+#line 3946 "build/generated/parser_bison.c"
+    break;
+
+  case 52: /* export_stmt: EXPORT DEFAULT func_decl  */
+#line 909 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(true, false, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL, NULL); }
+#line 3952 "build/generated/parser_bison.c"
+    break;
+
+  case 53: /* export_stmt: EXPORT DEFAULT class_decl  */
+#line 911 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(true, false, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL, NULL); }
+#line 3958 "build/generated/parser_bison.c"
+    break;
+
+  case 54: /* export_stmt: EXPORT DEFAULT assignment_expr_no_obj ';'  */
+#line 913 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_decl(true, false, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), NULL, NULL); }
+#line 3964 "build/generated/parser_bison.c"
+    break;
+
+  case 55: /* export_clause: '{' '}'  */
+#line 918 "build/generated/parser.y"
+            { ((*yyvalp).list) = NULL; }
+#line 3970 "build/generated/parser_bison.c"
+    break;
+
+  case 56: /* export_clause: '{' export_specifier_list opt_trailing_comma '}'  */
+#line 920 "build/generated/parser.y"
+            { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list); }
+#line 3976 "build/generated/parser_bison.c"
+    break;
+
+  case 57: /* export_specifier_list: export_specifier  */
+#line 925 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 3982 "build/generated/parser_bison.c"
+    break;
+
+  case 58: /* export_specifier_list: export_specifier_list ',' export_specifier  */
+#line 927 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 3988 "build/generated/parser_bison.c"
+    break;
+
+  case 59: /* export_specifier: IDENTIFIER  */
+#line 932 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_specifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), NULL, false); }
+#line 3994 "build/generated/parser_bison.c"
+    break;
+
+  case 60: /* export_specifier: IDENTIFIER as_keyword IDENTIFIER  */
+#line 934 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_specifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), false); }
+#line 4000 "build/generated/parser_bison.c"
+    break;
+
+  case 61: /* export_specifier: IDENTIFIER as_keyword DEFAULT  */
+#line 936 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_specifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), ATOM(ctx->atoms, DEFAULT), false); }
+#line 4006 "build/generated/parser_bison.c"
+    break;
+
+  case 62: /* export_specifier: DEFAULT as_keyword IDENTIFIER  */
+#line 938 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), false); }
+#line 4012 "build/generated/parser_bison.c"
+    break;
+
+  case 63: /* export_specifier: DEFAULT as_keyword DEFAULT  */
+#line 940 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), ATOM(ctx->atoms, DEFAULT), false); }
+#line 4018 "build/generated/parser_bison.c"
+    break;
+
+  case 64: /* export_specifier: DEFAULT  */
+#line 942 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), NULL, false); }
+#line 4024 "build/generated/parser_bison.c"
+    break;
+
+  case 65: /* from_keyword: IDENTIFIER  */
+#line 947 "build/generated/parser.y"
+      {
+          if (!identifier_is((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), ATOM(ctx->atoms, FROM))) {
+              yyerror(ctx, "Expected 'from' in module statement");
+              YYERROR;
+          }
+          ((*yyvalp).atom) = NULL;
+      }
+#line 4036 "build/generated/parser_bison.c"
+    break;
+
+  case 66: /* as_keyword: IDENTIFIER  */
+#line 958 "build/generated/parser.y"
+      {
+          if (!identifier_is((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), ATOM(ctx->atoms, AS))) {
+              yyerror(ctx, "Expected 'as' in module statement");
+              YYERROR;
+          }
+          ((*yyvalp).atom) = NULL;
+      }
+#line 4048 "build/generated/parser_bison.c"
+    break;
+
+  case 67: /* block: '{' stmt_list '}'  */
+#line 969 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_block((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 4054 "build/generated/parser_bison.c"
+    break;
+
+  case 68: /* var_stmt: VAR var_decl_list  */
+#line 974 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_VAR, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 4060 "build/generated/parser_bison.c"
+    break;
+
+  case 69: /* var_stmt: LET var_decl_list  */
+#line 976 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_LET, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 4066 "build/generated/parser_bison.c"
+    break;
+
+  case 70: /* var_stmt: CONST var_decl_list  */
+#line 978 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_CONST, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 4072 "build/generated/parser_bison.c"
+    break;
+
+  case 71: /* var_stmt_no_in: VAR var_decl_list_no_in  */
+#line 983 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_VAR, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 4078 "build/generated/parser_bison.c"
+    break;
+
+  case 72: /* var_stmt_no_in: LET var_decl_list_no_in  */
+#line 985 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_LET, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 4084 "build/generated/parser_bison.c"
+    break;
+
+  case 73: /* var_stmt_no_in: CONST var_decl_list_no_in  */
+#line 987 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_CONST, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 4090 "build/generated/parser_bison.c"
+    break;
+
+  case 74: /* var_decl_list: var_decl  */
+#line 992 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4096 "build/generated/parser_bison.c"
+    break;
+
+  case 75: /* var_decl_list: var_decl_list ',' var_decl  */
+#line 994 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4102 "build/generated/parser_bison.c"
+    break;
+
+  case 76: /* var_decl_list_no_in: var_decl_no_in  */
+#line 999 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4108 "build/generated/parser_bison.c"
+    break;
+
+  case 77: /* var_decl_list_no_in: var_decl_list_no_in ',' var_decl_no_in  */
+#line 1001 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4114 "build/generated/parser_bison.c"
+    break;
+
+  case 78: /* var_decl: IDENTIFIER binding_initializer_opt  */
+#line 1006 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.atom)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node))); }
+#line 4120 "build/generated/parser_bison.c"
+    break;
+
+  case 79: /* var_decl: object_binding '=' assignment_expr  */
+#line 1008 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node))); }
+#line 4126 "build/generated/parser_bison.c"
+    break;
+
+  case 80: /* var_decl: array_binding '=' assignment_expr  */
+#line 1010 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node))); }
+#line 4132 "build/generated/parser_bison.c"
+    break;
+
+  case 81: /* var_decl_no_in: IDENTIFIER binding_initializer_opt_no_in  */
+#line 1015 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.atom)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node))); }
+#line 4138 "build/generated/parser_bison.c"
+    break;
+
+  case 82: /* var_decl_no_in: object_binding '=' assignment_expr_no_in  */
+#line 1017 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node))); }
+#line 4144 "build/generated/parser_bison.c"
+    break;
+
+  case 83: /* var_decl_no_in: array_binding '=' assignment_expr_no_in  */
+#line 1019 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node))); }
+#line 4150 "build/generated/parser_bison.c"
+    break;
+
+  case 84: /* return_stmt: RETURN  */
+#line 1024 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_return(NULL); }
+#line 4156 "build/generated/parser_bison.c"
+    break;
+
+  case 85: /* return_stmt: RETURN expr  */
+#line 1026 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_return((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4162 "build/generated/parser_bison.c"
+    break;
+
+  case 86: /* if_stmt: IF '(' expr ')' stmt  */
+#line 1031 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_if((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL); }
+#line 4168 "build/generated/parser_bison.c"
+    break;
+
+  case 87: /* if_stmt: IF '(' expr ')' stmt ELSE stmt  */
+#line 1033 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_if((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4174 "build/generated/parser_bison.c"
+    break;
+
+  case 88: /* for_stmt: FOR '(' for_init ';' opt_expr ';' opt_expr ')' stmt  */
+#line 1038 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_for((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4180 "build/generated/parser_bison.c"
+    break;
+
+  case 89: /* for_stmt: FOR '(' for_in_left IN expr ')' stmt  */
+#line 1040 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_for_in((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4186 "build/generated/parser_bison.c"
+    break;
+
+  case 90: /* for_stmt: FOR '(' for_in_left for_of_keyword expr ')' stmt  */
+#line 1042 "build/generated/parser.y"
+    { ((*yyvalp).node) = ast_make_for_of((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false); }
+#line 4192 "build/generated/parser_bison.c"
+    break;
+
+  case 91: /* for_stmt: FOR AWAIT '(' for_in_left for_of_keyword expr ')' stmt  */
+#line 1044 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_for_of((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), true); }
+#line 4198 "build/generated/parser_bison.c"
+    break;
+
+  case 92: /* while_stmt: WHILE '(' expr ')' stmt  */
+#line 1049 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_while((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4204 "build/generated/parser_bison.c"
+    break;
+
+  case 93: /* do_stmt: DO stmt WHILE '(' expr ')' ';'  */
+#line 1054 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_do_while((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node)); }
+#line 4210 "build/generated/parser_bison.c"
+    break;
+
+  case 94: /* for_init: %empty  */
+#line 1059 "build/generated/parser.y"
+      { ((*yyvalp).node) = NULL; }
+#line 4216 "build/generated/parser_bison.c"
+    break;
+
+  case 95: /* for_init: var_stmt_no_in  */
+#line 1061 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4222 "build/generated/parser_bison.c"
+    break;
+
+  case 96: /* for_init: expr_no_in_no_obj  */
+#line 1063 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4228 "build/generated/parser_bison.c"
+    break;
+
+  case 97: /* for_in_left: for_binding  */
+#line 1068 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4234 "build/generated/parser_bison.c"
+    break;
+
+  case 98: /* for_in_left: assignment_pattern  */
+#line 1070 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4240 "build/generated/parser_bison.c"
+    break;
+
+  case 99: /* for_in_left: left_hand_side_expr_no_obj  */
+#line 1072 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4246 "build/generated/parser_bison.c"
+    break;
+
+  case 100: /* for_of_keyword: IDENTIFIER  */
+#line 1077 "build/generated/parser.y"
+      {
+          if (!identifier_is((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), ATOM(ctx->atoms, OF))) {
+              yyerror(ctx, "Expected 'of' in for-of statement");
+              YYERROR;
+          }
+          ((*yyvalp).atom) = NULL;
+      }
+#line 4258 "build/generated/parser_bison.c"
+    break;
+
+  case 101: /* opt_expr: %empty  */
+#line 1088 "build/generated/parser.y"
+      { ((*yyvalp).node) = NULL; }
+#line 4264 "build/generated/parser_bison.c"
+    break;
+
+  case 102: /* opt_expr: expr  */
+#line 1090 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4270 "build/generated/parser_bison.c"
+    break;
+
+  case 103: /* switch_stmt: SWITCH '(' expr ')' '{' switch_case_list '}'  */
+#line 1095 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_switch((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 4276 "build/generated/parser_bison.c"
+    break;
+
+  case 104: /* switch_case_list: %empty  */
+#line 1100 "build/generated/parser.y"
+            { ((*yyvalp).list) = NULL; }
+#line 4282 "build/generated/parser_bison.c"
+    break;
+
+  case 105: /* switch_case_list: switch_case_list switch_case  */
+#line 1102 "build/generated/parser.y"
+            { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4288 "build/generated/parser_bison.c"
+    break;
+
+  case 106: /* switch_case: CASE expr ':' case_stmt_seq  */
+#line 1107 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_switch_case((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 4294 "build/generated/parser_bison.c"
+    break;
+
+  case 107: /* switch_case: DEFAULT ':' case_stmt_seq  */
+#line 1109 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_switch_default((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 4300 "build/generated/parser_bison.c"
+    break;
+
+  case 108: /* case_stmt_seq: %empty  */
+#line 1114 "build/generated/parser.y"
+            { ((*yyvalp).list) = NULL; }
+#line 4306 "build/generated/parser_bison.c"
+    break;
+
+  case 109: /* case_stmt_seq: case_stmt_seq stmt  */
+#line 1116 "build/generated/parser.y"
+            { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4312 "build/generated/parser_bison.c"
+    break;
+
+  case 110: /* generator_marker_opt: '*'  */
+#line 1121 "build/generated/parser.y"
+      { ((*yyvalp).boolean) = 1; }
+#line 4318 "build/generated/parser_bison.c"
+    break;
+
+  case 111: /* generator_marker_opt: %empty  */
+#line 1123 "build/generated/parser.y"
+      { ((*yyvalp).boolean) = 0; }
+#line 4324 "build/generated/parser_bison.c"
+    break;
+
+  case 112: /* async_modifier_opt: ASYNC  */
+#line 1128 "build/generated/parser.y"
+      { ((*yyvalp).boolean) = 1; }
+#line 4330 "build/generated/parser_bison.c"
+    break;
+
+  case 113: /* async_modifier_opt: %empty  */
+#line 1130 "build/generated/parser.y"
+      { ((*yyvalp).boolean) = 0; }
+#line 4336 "build/generated/parser_bison.c"
+    break;
+
+  case 114: /* func_decl: async_modifier_opt FUNCTION_DECL generator_marker_opt IDENTIFIER '(' opt_param_list ')' block  */
+#line 1135 "build/generated/parser.y"
+      {
+          ((*yyvalp).node) = ast_make_function_decl((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+          if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.boolean) && ((*yyvalp).node)) {
+              ((*yyvalp).node)->data.function_decl.is_generator = true;
+          }
+          if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.boolean) && ((*yyvalp).node)) {
+              ((*yyvalp).node)->data.function_decl.is_async = true;
+          }
+      }
+#line 4350 "build/generated/parser_bison.c"
+    break;
+
+  case 115: /* func_decl: async_modifier_opt FUNCTION_DECL generator_marker_opt '(' opt_param_list ')' block  */
+#line 1145 "build/generated/parser.y"
+      {
+          ((*yyvalp).node) = ast_make_function_decl(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+          if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.boolean) && ((*yyvalp).node)) {
+              ((*yyvalp).node)->data.function_decl.is_generator = true;
+          }
+          if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.boolean) && ((*yyvalp).node)) {
+              ((*yyvalp).node)->data.function_decl.is_async = true;
+          }
+      }
+#line 4364 "build/generated/parser_bison.c"
+    break;
+
+  case 116: /* opt_param_list: %empty  */
+#line 1159 "build/generated/parser.y"
+      { ((*yyvalp).list) = NULL; }
+#line 4370 "build/generated/parser_bison.c"
+    break;
+
+  case 117: /* opt_param_list: param_list  */
+#line 1161 "build/generated/parser.y"
+      { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 4376 "build/generated/parser_bison.c"
+    break;
+
+  case 118: /* param_list: param_list_items  */
+#line 1166 "build/generated/parser.y"
+      { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 4382 "build/generated/parser_bison.c"
+    break;
+
+  case 119: /* param_list: param_list_items ',' rest_param  */
+#line 1168 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4388 "build/generated/parser_bison.c"
+    break;
+
+  case 120: /* param_list: rest_param  */
+#line 1170 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4394 "build/generated/parser_bison.c"
+    break;
+
+  case 121: /* param_list_items: binding_element  */
+#line 1175 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4400 "build/generated/parser_bison.c"
+    break;
+
+  case 122: /* param_list_items: param_list_items ',' binding_element  */
+#line 1177 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4406 "build/generated/parser_bison.c"
+    break;
+
+  case 123: /* rest_param: binding_rest_element  */
+#line 1182 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4412 "build/generated/parser_bison.c"
+    break;
+
+  case 124: /* catch_clause: CATCH '(' catch_parameter ')' block  */
+#line 1187 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_catch((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4418 "build/generated/parser_bison.c"
+    break;
+
+  case 125: /* catch_parameter: IDENTIFIER  */
+#line 1192 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_binding_pattern(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)), NULL); }
+#line 4424 "build/generated/parser_bison.c"
+    break;
+
+  case 126: /* catch_parameter: object_binding  */
+#line 1194 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL); }
+#line 4430 "build/generated/parser_bison.c"
+    break;
+
+  case 127: /* catch_parameter: array_binding  */
+#line 1196 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL); }
+#line 4436 "build/generated/parser_bison.c"
+    break;
+
+  case 128: /* finally_clause: FINALLY block  */
+#line 1201 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4442 "build/generated/parser_bison.c"
+    break;
+
+  case 129: /* finally_clause_opt: %empty  */
+#line 1206 "build/generated/parser.y"
+            { ((*yyvalp).node) = NULL; }
+#line 4448 "build/generated/parser_bison.c"
+    break;
+
+  case 130: /* finally_clause_opt: finally_clause  */
+#line 1208 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4454 "build/generated/parser_bison.c"
+    break;
+
+  case 131: /* try_stmt: TRY block catch_clause finally_clause_opt  */
+#line 1213 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_try((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4460 "build/generated/parser_bison.c"
+    break;
+
+  case 132: /* try_stmt: TRY block finally_clause  */
+#line 1215 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_try((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4466 "build/generated/parser_bison.c"
+    break;
+
+  case 133: /* with_stmt: WITH '(' expr ')' stmt  */
+#line 1220 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_with((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4472 "build/generated/parser_bison.c"
+    break;
+
+  case 134: /* labeled_stmt: IDENTIFIER ':' stmt  */
+#line 1225 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_labeled((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4478 "build/generated/parser_bison.c"
+    break;
+
+  case 135: /* break_stmt: BREAK  */
+#line 1230 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_break(NULL); }
+#line 4484 "build/generated/parser_bison.c"
+    break;
+
+  case 136: /* break_stmt: BREAK IDENTIFIER  */
+#line 1232 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_break((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)); }
+#line 4490 "build/generated/parser_bison.c"
+    break;
+
+  case 137: /* continue_stmt: CONTINUE  */
+#line 1237 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_continue(NULL); }
+#line 4496 "build/generated/parser_bison.c"
+    break;
+
+  case 138: /* continue_stmt: CONTINUE IDENTIFIER  */
+#line 1239 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_continue((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)); }
+#line 4502 "build/generated/parser_bison.c"
+    break;
+
+  case 139: /* throw_stmt: THROW expr  */
+#line 1244 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_throw((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4508 "build/generated/parser_bison.c"
+    break;
+
+  case 140: /* expr: assignment_expr  */
+#line 1253 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4514 "build/generated/parser_bison.c"
+    break;
+
+  case 141: /* expr: expr ',' assignment_expr  */
+#line 1255 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_sequence((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4520 "build/generated/parser_bison.c"
+    break;
+
+  case 142: /* expr_no_obj: assignment_expr_no_obj  */
+#line 1260 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4526 "build/generated/parser_bison.c"
+    break;
+
+  case 143: /* expr_no_obj: expr_no_obj ',' assignment_expr  */
+#line 1262 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_sequence((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4532 "build/generated/parser_bison.c"
+    break;
+
+  case 144: /* expr_no_in_no_obj: assignment_expr_no_in_no_obj  */
+#line 1267 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4538 "build/generated/parser_bison.c"
+    break;
+
+  case 145: /* expr_no_in_no_obj: expr_no_in_no_obj ',' assignment_expr_no_in  */
+#line 1269 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_sequence((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4544 "build/generated/parser_bison.c"
+    break;
+
+  case 146: /* assignment_expr: postfix_expr '=' assignment_expr  */
+#line 1274 "build/generated/parser.y"
+            {
+	        ASTNode *lhs = convert_assignment_target((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), true);
+	        if (!lhs) {
+	            lhs = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node);
+	        }
+	        ((*yyvalp).node) = ast_make_assignment("=", wrap_destructuring_target(lhs), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+	    }
+#line 4556 "build/generated/parser_bison.c"
+    break;
+
+  case 147: /* assignment_expr: postfix_expr PLUS_ASSIGN assignment_expr  */
+#line 1282 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("+=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4562 "build/generated/parser_bison.c"
+    break;
+
+  case 148: /* assignment_expr: postfix_expr MINUS_ASSIGN assignment_expr  */
+#line 1284 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("-=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4568 "build/generated/parser_bison.c"
+    break;
+
+  case 149: /* assignment_expr: postfix_expr STAR_ASSIGN assignment_expr  */
+#line 1286 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("*=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4574 "build/generated/parser_bison.c"
+    break;
+
+  case 150: /* assignment_expr: postfix_expr SLASH_ASSIGN assignment_expr  */
+#line 1288 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("/=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4580 "build/generated/parser_bison.c"
+    break;
+
+  case 151: /* assignment_expr: postfix_expr PERCENT_ASSIGN assignment_expr  */
+#line 1290 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("%=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4586 "build/generated/parser_bison.c"
+    break;
+
+  case 152: /* assignment_expr: postfix_expr AND_ASSIGN assignment_expr  */
+#line 1292 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("&=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4592 "build/generated/parser_bison.c"
+    break;
+
+  case 153: /* assignment_expr: postfix_expr OR_ASSIGN assignment_expr  */
+#line 1294 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("|=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4598 "build/generated/parser_bison.c"
+    break;
+
+  case 154: /* assignment_expr: postfix_expr XOR_ASSIGN assignment_expr  */
+#line 1296 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("^=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4604 "build/generated/parser_bison.c"
+    break;
+
+  case 155: /* assignment_expr: postfix_expr LSHIFT_ASSIGN assignment_expr  */
+#line 1298 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("<<=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4610 "build/generated/parser_bison.c"
+    break;
+
+  case 156: /* assignment_expr: postfix_expr RSHIFT_ASSIGN assignment_expr  */
+#line 1300 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment(">>=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4616 "build/generated/parser_bison.c"
+    break;
+
+  case 157: /* assignment_expr: postfix_expr URSHIFT_ASSIGN assignment_expr  */
+#line 1302 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment(">>>=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4622 "build/generated/parser_bison.c"
+    break;
+
+  case 158: /* assignment_expr: arrow_function  */
+#line 1304 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4628 "build/generated/parser_bison.c"
+    break;
+
+  case 159: /* assignment_expr: conditional_expr  */
+#line 1306 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4634 "build/generated/parser_bison.c"
+    break;
+
+  case 160: /* assignment_expr: yield_expr  */
+#line 1308 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4640 "build/generated/parser_bison.c"
+    break;
+
+  case 161: /* assignment_expr_no_in: postfix_expr '=' assignment_expr_no_in  */
+#line 1313 "build/generated/parser.y"
+            {
+	        ASTNode *lhs = convert_assignment_target((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), true);
+	        if (!lhs) {
+	            lhs = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node);
+	        }
+	        ((*yyvalp).node) = ast_make_assignment("=", wrap_destructuring_target(lhs), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+	    }
+#line 4652 "build/generated/parser_bison.c"
+    break;
+
+  case 162: /* assignment_expr_no_in: postfix_expr PLUS_ASSIGN assignment_expr_no_in  */
+#line 1321 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("+=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4658 "build/generated/parser_bison.c"
+    break;
+
+  case 163: /* assignment_expr_no_in: postfix_expr MINUS_ASSIGN assignment_expr_no_in  */
+#line 1323 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("-=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4664 "build/generated/parser_bison.c"
+    break;
+
+  case 164: /* assignment_expr_no_in: postfix_expr STAR_ASSIGN assignment_expr_no_in  */
+#line 1325 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("*=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4670 "build/generated/parser_bison.c"
+    break;
+
+  case 165: /* assignment_expr_no_in: postfix_expr SLASH_ASSIGN assignment_expr_no_in  */
+#line 1327 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("/=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4676 "build/generated/parser_bison.c"
+    break;
+
+  case 166: /* assignment_expr_no_in: postfix_expr PERCENT_ASSIGN assignment_expr_no_in  */
+#line 1329 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("%=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4682 "build/generated/parser_bison.c"
+    break;
+
+  case 167: /* assignment_expr_no_in: postfix_expr AND_ASSIGN assignment_expr_no_in  */
+#line 1331 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("&=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4688 "build/generated/parser_bison.c"
+    break;
+
+  case 168: /* assignment_expr_no_in: postfix_expr OR_ASSIGN assignment_expr_no_in  */
+#line 1333 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("|=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4694 "build/generated/parser_bison.c"
+    break;
+
+  case 169: /* assignment_expr_no_in: postfix_expr XOR_ASSIGN assignment_expr_no_in  */
+#line 1335 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("^=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4700 "build/generated/parser_bison.c"
+    break;
+
+  case 170: /* assignment_expr_no_in: postfix_expr LSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1337 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("<<=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4706 "build/generated/parser_bison.c"
+    break;
+
+  case 171: /* assignment_expr_no_in: postfix_expr RSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1339 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment(">>=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4712 "build/generated/parser_bison.c"
+    break;
+
+  case 172: /* assignment_expr_no_in: postfix_expr URSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1341 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment(">>>=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4718 "build/generated/parser_bison.c"
+    break;
+
+  case 173: /* assignment_expr_no_in: arrow_function  */
+#line 1343 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4724 "build/generated/parser_bison.c"
+    break;
+
+  case 174: /* assignment_expr_no_in: conditional_expr_no_in  */
+#line 1345 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4730 "build/generated/parser_bison.c"
+    break;
+
+  case 175: /* assignment_expr_no_in: yield_expr  */
+#line 1347 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4736 "build/generated/parser_bison.c"
+    break;
+
+  case 176: /* assignment_expr_no_obj: postfix_expr_no_obj '=' assignment_expr  */
+#line 1352 "build/generated/parser.y"
+            {
+	        ASTNode *lhs = convert_assignment_target((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), true);
+	        if (!lhs) {
+	            lhs = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node);
+	        }
+	        ((*yyvalp).node) = ast_make_assignment("=", wrap_destructuring_target(lhs), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+	    }
+#line 4748 "build/generated/parser_bison.c"
+    break;
+
+  case 177: /* assignment_expr_no_obj: postfix_expr_no_obj PLUS_ASSIGN assignment_expr  */
+#line 1360 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("+=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4754 "build/generated/parser_bison.c"
+    break;
+
+  case 178: /* assignment_expr_no_obj: postfix_expr_no_obj MINUS_ASSIGN assignment_expr  */
+#line 1362 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("-=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4760 "build/generated/parser_bison.c"
+    break;
+
+  case 179: /* assignment_expr_no_obj: postfix_expr_no_obj STAR_ASSIGN assignment_expr  */
+#line 1364 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("*=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4766 "build/generated/parser_bison.c"
+    break;
+
+  case 180: /* assignment_expr_no_obj: postfix_expr_no_obj SLASH_ASSIGN assignment_expr  */
+#line 1366 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("/=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4772 "build/generated/parser_bison.c"
+    break;
+
+  case 181: /* assignment_expr_no_obj: postfix_expr_no_obj PERCENT_ASSIGN assignment_expr  */
+#line 1368 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("%=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4778 "build/generated/parser_bison.c"
+    break;
+
+  case 182: /* assignment_expr_no_obj: postfix_expr_no_obj AND_ASSIGN assignment_expr  */
+#line 1370 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("&=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4784 "build/generated/parser_bison.c"
+    break;
+
+  case 183: /* assignment_expr_no_obj: postfix_expr_no_obj OR_ASSIGN assignment_expr  */
+#line 1372 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("|=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4790 "build/generated/parser_bison.c"
+    break;
+
+  case 184: /* assignment_expr_no_obj: postfix_expr_no_obj XOR_ASSIGN assignment_expr  */
+#line 1374 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("^=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4796 "build/generated/parser_bison.c"
+    break;
+
+  case 185: /* assignment_expr_no_obj: postfix_expr_no_obj LSHIFT_ASSIGN assignment_expr  */
+#line 1376 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("<<=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4802 "build/generated/parser_bison.c"
+    break;
+
+  case 186: /* assignment_expr_no_obj: postfix_expr_no_obj RSHIFT_ASSIGN assignment_expr  */
+#line 1378 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment(">>=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4808 "build/generated/parser_bison.c"
+    break;
+
+  case 187: /* assignment_expr_no_obj: postfix_expr_no_obj URSHIFT_ASSIGN assignment_expr  */
+#line 1380 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment(">>>=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4814 "build/generated/parser_bison.c"
+    break;
+
+  case 188: /* assignment_expr_no_obj: arrow_function  */
+#line 1382 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4820 "build/generated/parser_bison.c"
+    break;
+
+  case 189: /* assignment_expr_no_obj: conditional_expr_no_obj  */
+#line 1384 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4826 "build/generated/parser_bison.c"
+    break;
+
+  case 190: /* assignment_expr_no_obj: yield_expr  */
+#line 1386 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4832 "build/generated/parser_bison.c"
+    break;
+
+  case 191: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj '=' assignment_expr_no_in  */
+#line 1391 "build/generated/parser.y"
+            {
+	        ASTNode *lhs = convert_assignment_target((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), true);
+	        if (!lhs) {
+	            lhs = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node);
+	        }
+	        ((*yyvalp).node) = ast_make_assignment("=", wrap_destructuring_target(lhs), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+	    }
+#line 4844 "build/generated/parser_bison.c"
+    break;
+
+  case 192: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj PLUS_ASSIGN assignment_expr_no_in  */
+#line 1399 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("+=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4850 "build/generated/parser_bison.c"
+    break;
+
+  case 193: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj MINUS_ASSIGN assignment_expr_no_in  */
+#line 1401 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("-=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4856 "build/generated/parser_bison.c"
+    break;
+
+  case 194: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj STAR_ASSIGN assignment_expr_no_in  */
+#line 1403 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("*=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4862 "build/generated/parser_bison.c"
+    break;
+
+  case 195: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj SLASH_ASSIGN assignment_expr_no_in  */
+#line 1405 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("/=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4868 "build/generated/parser_bison.c"
+    break;
+
+  case 196: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj PERCENT_ASSIGN assignment_expr_no_in  */
+#line 1407 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("%=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4874 "build/generated/parser_bison.c"
+    break;
+
+  case 197: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj AND_ASSIGN assignment_expr_no_in  */
+#line 1409 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("&=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4880 "build/generated/parser_bison.c"
+    break;
+
+  case 198: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj OR_ASSIGN assignment_expr_no_in  */
+#line 1411 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("|=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4886 "build/generated/parser_bison.c"
+    break;
+
+  case 199: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj XOR_ASSIGN assignment_expr_no_in  */
+#line 1413 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("^=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4892 "build/generated/parser_bison.c"
+    break;
+
+  case 200: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj LSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1415 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment("<<=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4898 "build/generated/parser_bison.c"
+    break;
+
+  case 201: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj RSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1417 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment(">>=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4904 "build/generated/parser_bison.c"
+    break;
+
+  case 202: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj URSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1419 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_assignment(">>>=", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4910 "build/generated/parser_bison.c"
+    break;
+
+  case 203: /* assignment_expr_no_in_no_obj: arrow_function  */
+#line 1421 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4916 "build/generated/parser_bison.c"
+    break;
+
+  case 204: /* assignment_expr_no_in_no_obj: conditional_expr_no_in_no_obj  */
+#line 1423 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4922 "build/generated/parser_bison.c"
+    break;
+
+  case 205: /* assignment_expr_no_in_no_obj: yield_expr  */
+#line 1425 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4928 "build/generated/parser_bison.c"
+    break;
+
+  case 206: /* conditional_expr: binary_expr  */
+#line 1430 "build/generated/parser.y"
+        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4934 "build/generated/parser_bison.c"
+    break;
+
+  case 207: /* conditional_expr: binary_expr '?' assignment_expr ':' assignment_expr  */
+#line 1432 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_conditional((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4940 "build/generated/parser_bison.c"
+    break;
+
+  case 208: /* conditional_expr_no_in: binary_expr_no_in  */
+#line 1437 "build/generated/parser.y"
+        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4946 "build/generated/parser_bison.c"
+    break;
+
+  case 209: /* conditional_expr_no_in: binary_expr_no_in '?' assignment_expr ':' assignment_expr  */
+#line 1439 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_conditional((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4952 "build/generated/parser_bison.c"
+    break;
+
+  case 210: /* conditional_expr_no_obj: binary_expr_no_obj  */
+#line 1444 "build/generated/parser.y"
+        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4958 "build/generated/parser_bison.c"
+    break;
+
+  case 211: /* conditional_expr_no_obj: binary_expr_no_obj '?' assignment_expr ':' assignment_expr  */
+#line 1446 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_conditional((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4964 "build/generated/parser_bison.c"
+    break;
+
+  case 212: /* conditional_expr_no_in_no_obj: binary_expr_no_in_no_obj  */
+#line 1451 "build/generated/parser.y"
+        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4970 "build/generated/parser_bison.c"
+    break;
+
+  case 213: /* conditional_expr_no_in_no_obj: binary_expr_no_in_no_obj '?' assignment_expr ':' assignment_expr  */
+#line 1453 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_conditional((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 4976 "build/generated/parser_bison.c"
+    break;
+
+  case 214: /* binary_expr: unary_expr  */
+#line 1461 "build/generated/parser.y"
+        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4982 "build/generated/parser_bison.c"
+    break;
+
+  case 215: /* binary_expr: binary_chain  */
+#line 1463 "build/generated/parser.y"
+        { ((*yyvalp).node) = fold_binary_chain((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.chain)); }
+#line 4988 "build/generated/parser_bison.c"
+    break;
+
+  case 216: /* binary_expr_no_in: unary_expr  */
+#line 1468 "build/generated/parser.y"
+        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 4994 "build/generated/parser_bison.c"
+    break;
+
+  case 217: /* binary_expr_no_in: binary_chain_no_in  */
+#line 1470 "build/generated/parser.y"
+        { ((*yyvalp).node) = fold_binary_chain((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.chain)); }
+#line 5000 "build/generated/parser_bison.c"
+    break;
+
+  case 218: /* binary_expr_no_obj: unary_expr_no_obj  */
+#line 1475 "build/generated/parser.y"
+        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5006 "build/generated/parser_bison.c"
+    break;
+
+  case 219: /* binary_expr_no_obj: binary_chain_no_obj  */
+#line 1477 "build/generated/parser.y"
+        { ((*yyvalp).node) = fold_binary_chain((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.chain)); }
+#line 5012 "build/generated/parser_bison.c"
+    break;
+
+  case 220: /* binary_expr_no_in_no_obj: unary_expr_no_obj  */
+#line 1482 "build/generated/parser.y"
+        { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5018 "build/generated/parser_bison.c"
+    break;
+
+  case 221: /* binary_expr_no_in_no_obj: binary_chain_no_in_no_obj  */
+#line 1484 "build/generated/parser.y"
+        { ((*yyvalp).node) = fold_binary_chain((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.chain)); }
+#line 5024 "build/generated/parser_bison.c"
+    break;
+
+  case 222: /* binary_chain: unary_expr binary_operator unary_expr  */
+#line 1489 "build/generated/parser.y"
+        { ((*yyvalp).chain) = binary_chain_append(binary_chain_append(NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.binop), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5030 "build/generated/parser_bison.c"
+    break;
+
+  case 223: /* binary_chain: binary_chain binary_operator unary_expr  */
+#line 1491 "build/generated/parser.y"
+        { ((*yyvalp).chain) = binary_chain_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.chain), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.binop), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5036 "build/generated/parser_bison.c"
+    break;
+
+  case 224: /* binary_chain_no_in: unary_expr binary_operator_no_in unary_expr  */
+#line 1496 "build/generated/parser.y"
+        { ((*yyvalp).chain) = binary_chain_append(binary_chain_append(NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.binop), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5042 "build/generated/parser_bison.c"
+    break;
+
+  case 225: /* binary_chain_no_in: binary_chain_no_in binary_operator_no_in unary_expr  */
+#line 1498 "build/generated/parser.y"
+        { ((*yyvalp).chain) = binary_chain_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.chain), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.binop), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5048 "build/generated/parser_bison.c"
+    break;
+
+  case 226: /* binary_chain_no_obj: unary_expr_no_obj binary_operator unary_expr  */
+#line 1503 "build/generated/parser.y"
+        { ((*yyvalp).chain) = binary_chain_append(binary_chain_append(NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.binop), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5054 "build/generated/parser_bison.c"
+    break;
+
+  case 227: /* binary_chain_no_obj: binary_chain_no_obj binary_operator unary_expr  */
+#line 1505 "build/generated/parser.y"
+        { ((*yyvalp).chain) = binary_chain_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.chain), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.binop), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5060 "build/generated/parser_bison.c"
+    break;
+
+  case 228: /* binary_chain_no_in_no_obj: unary_expr_no_obj binary_operator_no_in unary_expr  */
+#line 1510 "build/generated/parser.y"
+        { ((*yyvalp).chain) = binary_chain_append(binary_chain_append(NULL, NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.binop), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5066 "build/generated/parser_bison.c"
+    break;
+
+  case 229: /* binary_chain_no_in_no_obj: binary_chain_no_in_no_obj binary_operator_no_in unary_expr  */
+#line 1512 "build/generated/parser.y"
+        { ((*yyvalp).chain) = binary_chain_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.chain), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.binop), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5072 "build/generated/parser_bison.c"
+    break;
+
+  case 230: /* binary_operator: OR  */
+#line 1517 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_OR]; }
+#line 5078 "build/generated/parser_bison.c"
+    break;
+
+  case 231: /* binary_operator: AND  */
+#line 1519 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_AND]; }
+#line 5084 "build/generated/parser_bison.c"
+    break;
+
+  case 232: /* binary_operator: '|'  */
+#line 1521 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_BIT_OR]; }
+#line 5090 "build/generated/parser_bison.c"
+    break;
+
+  case 233: /* binary_operator: '^'  */
+#line 1523 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_BIT_XOR]; }
+#line 5096 "build/generated/parser_bison.c"
+    break;
+
+  case 234: /* binary_operator: '&'  */
+#line 1525 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_BIT_AND]; }
+#line 5102 "build/generated/parser_bison.c"
+    break;
+
+  case 235: /* binary_operator: EQ  */
+#line 1527 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_EQ]; }
+#line 5108 "build/generated/parser_bison.c"
+    break;
+
+  case 236: /* binary_operator: NE  */
+#line 1529 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_NE]; }
+#line 5114 "build/generated/parser_bison.c"
+    break;
+
+  case 237: /* binary_operator: EQ_STRICT  */
+#line 1531 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_EQ_STRICT]; }
+#line 5120 "build/generated/parser_bison.c"
+    break;
+
+  case 238: /* binary_operator: NE_STRICT  */
+#line 1533 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_NE_STRICT]; }
+#line 5126 "build/generated/parser_bison.c"
+    break;
+
+  case 239: /* binary_operator: '<'  */
+#line 1535 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_LT]; }
+#line 5132 "build/generated/parser_bison.c"
+    break;
+
+  case 240: /* binary_operator: '>'  */
+#line 1537 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_GT]; }
+#line 5138 "build/generated/parser_bison.c"
+    break;
+
+  case 241: /* binary_operator: LE  */
+#line 1539 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_LE]; }
+#line 5144 "build/generated/parser_bison.c"
+    break;
+
+  case 242: /* binary_operator: GE  */
+#line 1541 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_GE]; }
+#line 5150 "build/generated/parser_bison.c"
+    break;
+
+  case 243: /* binary_operator: INSTANCEOF  */
+#line 1543 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_INSTANCEOF]; }
+#line 5156 "build/generated/parser_bison.c"
+    break;
+
+  case 244: /* binary_operator: LSHIFT  */
+#line 1545 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_LSHIFT]; }
+#line 5162 "build/generated/parser_bison.c"
+    break;
+
+  case 245: /* binary_operator: RSHIFT  */
+#line 1547 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_RSHIFT]; }
+#line 5168 "build/generated/parser_bison.c"
+    break;
+
+  case 246: /* binary_operator: URSHIFT  */
+#line 1549 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_URSHIFT]; }
+#line 5174 "build/generated/parser_bison.c"
+    break;
+
+  case 247: /* binary_operator: '+'  */
+#line 1551 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_ADD]; }
+#line 5180 "build/generated/parser_bison.c"
+    break;
+
+  case 248: /* binary_operator: '-'  */
+#line 1553 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_SUB]; }
+#line 5186 "build/generated/parser_bison.c"
+    break;
+
+  case 249: /* binary_operator: '*'  */
+#line 1555 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_MUL]; }
+#line 5192 "build/generated/parser_bison.c"
+    break;
+
+  case 250: /* binary_operator: '*' '*'  */
+#line 1557 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_EXP]; }
+#line 5198 "build/generated/parser_bison.c"
+    break;
+
+  case 251: /* binary_operator: '/'  */
+#line 1559 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_DIV]; }
+#line 5204 "build/generated/parser_bison.c"
+    break;
+
+  case 252: /* binary_operator: '%'  */
+#line 1561 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_MOD]; }
+#line 5210 "build/generated/parser_bison.c"
+    break;
+
+  case 253: /* binary_operator: IN  */
+#line 1563 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_IN]; }
+#line 5216 "build/generated/parser_bison.c"
+    break;
+
+  case 254: /* binary_operator_no_in: OR  */
+#line 1568 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_OR]; }
+#line 5222 "build/generated/parser_bison.c"
+    break;
+
+  case 255: /* binary_operator_no_in: AND  */
+#line 1570 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_AND]; }
+#line 5228 "build/generated/parser_bison.c"
+    break;
+
+  case 256: /* binary_operator_no_in: '|'  */
+#line 1572 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_BIT_OR]; }
+#line 5234 "build/generated/parser_bison.c"
+    break;
+
+  case 257: /* binary_operator_no_in: '^'  */
+#line 1574 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_BIT_XOR]; }
+#line 5240 "build/generated/parser_bison.c"
+    break;
+
+  case 258: /* binary_operator_no_in: '&'  */
+#line 1576 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_BIT_AND]; }
+#line 5246 "build/generated/parser_bison.c"
+    break;
+
+  case 259: /* binary_operator_no_in: EQ  */
+#line 1578 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_EQ]; }
+#line 5252 "build/generated/parser_bison.c"
+    break;
+
+  case 260: /* binary_operator_no_in: NE  */
+#line 1580 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_NE]; }
+#line 5258 "build/generated/parser_bison.c"
+    break;
+
+  case 261: /* binary_operator_no_in: EQ_STRICT  */
+#line 1582 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_EQ_STRICT]; }
+#line 5264 "build/generated/parser_bison.c"
+    break;
+
+  case 262: /* binary_operator_no_in: NE_STRICT  */
+#line 1584 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_NE_STRICT]; }
+#line 5270 "build/generated/parser_bison.c"
+    break;
+
+  case 263: /* binary_operator_no_in: '<'  */
+#line 1586 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_LT]; }
+#line 5276 "build/generated/parser_bison.c"
+    break;
+
+  case 264: /* binary_operator_no_in: '>'  */
+#line 1588 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_GT]; }
+#line 5282 "build/generated/parser_bison.c"
+    break;
+
+  case 265: /* binary_operator_no_in: LE  */
+#line 1590 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_LE]; }
+#line 5288 "build/generated/parser_bison.c"
+    break;
+
+  case 266: /* binary_operator_no_in: GE  */
+#line 1592 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_GE]; }
+#line 5294 "build/generated/parser_bison.c"
+    break;
+
+  case 267: /* binary_operator_no_in: INSTANCEOF  */
+#line 1594 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_INSTANCEOF]; }
+#line 5300 "build/generated/parser_bison.c"
+    break;
+
+  case 268: /* binary_operator_no_in: LSHIFT  */
+#line 1596 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_LSHIFT]; }
+#line 5306 "build/generated/parser_bison.c"
+    break;
+
+  case 269: /* binary_operator_no_in: RSHIFT  */
+#line 1598 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_RSHIFT]; }
+#line 5312 "build/generated/parser_bison.c"
+    break;
+
+  case 270: /* binary_operator_no_in: URSHIFT  */
+#line 1600 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_URSHIFT]; }
+#line 5318 "build/generated/parser_bison.c"
+    break;
+
+  case 271: /* binary_operator_no_in: '+'  */
+#line 1602 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_ADD]; }
+#line 5324 "build/generated/parser_bison.c"
+    break;
+
+  case 272: /* binary_operator_no_in: '-'  */
+#line 1604 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_SUB]; }
+#line 5330 "build/generated/parser_bison.c"
+    break;
+
+  case 273: /* binary_operator_no_in: '*'  */
+#line 1606 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_MUL]; }
+#line 5336 "build/generated/parser_bison.c"
+    break;
+
+  case 274: /* binary_operator_no_in: '*' '*'  */
+#line 1608 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_EXP]; }
+#line 5342 "build/generated/parser_bison.c"
+    break;
+
+  case 275: /* binary_operator_no_in: '/'  */
+#line 1610 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_DIV]; }
+#line 5348 "build/generated/parser_bison.c"
+    break;
+
+  case 276: /* binary_operator_no_in: '%'  */
+#line 1612 "build/generated/parser.y"
+        { ((*yyvalp).binop) = &binary_operators[BINOP_MOD]; }
+#line 5354 "build/generated/parser_bison.c"
+    break;
+
+  case 277: /* unary_expr: postfix_expr  */
+#line 1618 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5360 "build/generated/parser_bison.c"
+    break;
+
+  case 278: /* unary_expr: '+' unary_expr  */
+#line 1620 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("+", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5366 "build/generated/parser_bison.c"
+    break;
+
+  case 279: /* unary_expr: '-' unary_expr  */
+#line 1622 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("-", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5372 "build/generated/parser_bison.c"
+    break;
+
+  case 280: /* unary_expr: '!' unary_expr  */
+#line 1624 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("!", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5378 "build/generated/parser_bison.c"
+    break;
+
+  case 281: /* unary_expr: '~' unary_expr  */
+#line 1626 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("~", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5384 "build/generated/parser_bison.c"
+    break;
+
+  case 282: /* unary_expr: TYPEOF unary_expr  */
+#line 1628 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("typeof", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5390 "build/generated/parser_bison.c"
+    break;
+
+  case 283: /* unary_expr: DELETE unary_expr  */
+#line 1630 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("delete", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5396 "build/generated/parser_bison.c"
+    break;
+
+  case 284: /* unary_expr: VOID unary_expr  */
+#line 1632 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("void", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5402 "build/generated/parser_bison.c"
+    break;
+
+  case 285: /* unary_expr: AWAIT unary_expr  */
+#line 1634 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_await((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5408 "build/generated/parser_bison.c"
+    break;
+
+  case 286: /* unary_expr: PLUS_PLUS unary_expr  */
+#line 1636 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_update("++", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), true); }
+#line 5414 "build/generated/parser_bison.c"
+    break;
+
+  case 287: /* unary_expr: MINUS_MINUS unary_expr  */
+#line 1638 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_update("--", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), true); }
+#line 5420 "build/generated/parser_bison.c"
+    break;
+
+  case 288: /* unary_expr_no_obj: postfix_expr_no_obj  */
+#line 1643 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5426 "build/generated/parser_bison.c"
+    break;
+
+  case 289: /* unary_expr_no_obj: '+' unary_expr  */
+#line 1645 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("+", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5432 "build/generated/parser_bison.c"
+    break;
+
+  case 290: /* unary_expr_no_obj: '-' unary_expr  */
+#line 1647 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("-", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5438 "build/generated/parser_bison.c"
+    break;
+
+  case 291: /* unary_expr_no_obj: '!' unary_expr  */
+#line 1649 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("!", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5444 "build/generated/parser_bison.c"
+    break;
+
+  case 292: /* unary_expr_no_obj: '~' unary_expr  */
+#line 1651 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("~", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5450 "build/generated/parser_bison.c"
+    break;
+
+  case 293: /* unary_expr_no_obj: TYPEOF unary_expr  */
+#line 1653 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("typeof", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5456 "build/generated/parser_bison.c"
+    break;
+
+  case 294: /* unary_expr_no_obj: DELETE unary_expr  */
+#line 1655 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("delete", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5462 "build/generated/parser_bison.c"
+    break;
+
+  case 295: /* unary_expr_no_obj: VOID unary_expr  */
+#line 1657 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_unary("void", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5468 "build/generated/parser_bison.c"
+    break;
+
+  case 296: /* unary_expr_no_obj: AWAIT unary_expr  */
+#line 1659 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_await((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5474 "build/generated/parser_bison.c"
+    break;
+
+  case 297: /* unary_expr_no_obj: PLUS_PLUS unary_expr  */
+#line 1661 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_update("++", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), true); }
+#line 5480 "build/generated/parser_bison.c"
+    break;
+
+  case 298: /* unary_expr_no_obj: MINUS_MINUS unary_expr  */
+#line 1663 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_update("--", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), true); }
+#line 5486 "build/generated/parser_bison.c"
+    break;
+
+  case 299: /* postfix_expr: left_hand_side_expr  */
+#line 1668 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5492 "build/generated/parser_bison.c"
+    break;
+
+  case 300: /* postfix_expr: postfix_expr PLUS_PLUS  */
+#line 1670 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_update("++", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), false); }
+#line 5498 "build/generated/parser_bison.c"
+    break;
+
+  case 301: /* postfix_expr: postfix_expr MINUS_MINUS  */
+#line 1672 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_update("--", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), false); }
+#line 5504 "build/generated/parser_bison.c"
+    break;
+
+  case 302: /* postfix_expr_no_obj: left_hand_side_expr_no_obj  */
+#line 1677 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5510 "build/generated/parser_bison.c"
+    break;
+
+  case 303: /* postfix_expr_no_obj: postfix_expr_no_obj PLUS_PLUS  */
+#line 1679 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_update("++", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), false); }
+#line 5516 "build/generated/parser_bison.c"
+    break;
+
+  case 304: /* postfix_expr_no_obj: postfix_expr_no_obj MINUS_MINUS  */
+#line 1681 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_update("--", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), false); }
+#line 5522 "build/generated/parser_bison.c"
+    break;
+
+  case 305: /* left_hand_side_expr: call_expr  */
+#line 1686 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5528 "build/generated/parser_bison.c"
+    break;
+
+  case 306: /* left_hand_side_expr: new_expr  */
+#line 1688 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5534 "build/generated/parser_bison.c"
+    break;
+
+  case 307: /* left_hand_side_expr_no_obj: call_expr_no_obj  */
+#line 1693 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5540 "build/generated/parser_bison.c"
+    break;
+
+  case 308: /* left_hand_side_expr_no_obj: new_expr_no_obj  */
+#line 1695 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5546 "build/generated/parser_bison.c"
+    break;
+
+  case 309: /* member_expr: primary_expr member_suffix_seq  */
+#line 1700 "build/generated/parser.y"
+      { ((*yyvalp).node) = apply_suffix_chain((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix)); }
+#line 5552 "build/generated/parser_bison.c"
+    break;
+
+  case 310: /* member_expr: NEW member_expr '(' opt_arg_list ')' member_suffix_seq  */
+#line 1702 "build/generated/parser.y"
+      { ((*yyvalp).node) = apply_suffix_chain(ast_make_new_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix)); }
+#line 5558 "build/generated/parser_bison.c"
+    break;
+
+  case 311: /* member_expr_no_obj: primary_expr_no_obj member_suffix_seq  */
+#line 1707 "build/generated/parser.y"
+      { ((*yyvalp).node) = apply_suffix_chain((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix)); }
+#line 5564 "build/generated/parser_bison.c"
+    break;
+
+  case 312: /* member_expr_no_obj: NEW member_expr '(' opt_arg_list ')' member_suffix_seq  */
+#line 1709 "build/generated/parser.y"
+      { ((*yyvalp).node) = apply_suffix_chain(ast_make_new_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix)); }
+#line 5570 "build/generated/parser_bison.c"
+    break;
+
+  case 313: /* new_expr: member_expr  */
+#line 1714 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5576 "build/generated/parser_bison.c"
+    break;
+
+  case 314: /* new_expr: NEW new_expr  */
+#line 1716 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_new_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL); }
+#line 5582 "build/generated/parser_bison.c"
+    break;
+
+  case 315: /* new_expr_no_obj: member_expr_no_obj  */
+#line 1721 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5588 "build/generated/parser_bison.c"
+    break;
+
+  case 316: /* new_expr_no_obj: NEW new_expr  */
+#line 1723 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_new_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL); }
+#line 5594 "build/generated/parser_bison.c"
+    break;
+
+  case 317: /* call_expr: member_expr call_suffix_seq  */
+#line 1728 "build/generated/parser.y"
+      { ((*yyvalp).node) = apply_suffix_chain((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix)); }
+#line 5600 "build/generated/parser_bison.c"
+    break;
+
+  case 318: /* call_expr_no_obj: member_expr_no_obj call_suffix_seq  */
+#line 1733 "build/generated/parser.y"
+      { ((*yyvalp).node) = apply_suffix_chain((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix)); }
+#line 5606 "build/generated/parser_bison.c"
+    break;
+
+  case 319: /* member_suffix_seq: %empty  */
+#line 1738 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = NULL; }
+#line 5612 "build/generated/parser_bison.c"
+    break;
+
+  case 320: /* member_suffix_seq: member_suffix_seq member_noncall_suffix  */
+#line 1740 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = append_suffix((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.suffix), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix)); }
+#line 5618 "build/generated/parser_bison.c"
+    break;
+
+  case 321: /* member_noncall_suffix: '.' property_name  */
+#line 1745 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = make_suffix_prop((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)); }
+#line 5624 "build/generated/parser_bison.c"
+    break;
+
+  case 322: /* member_noncall_suffix: '[' expr ']'  */
+#line 1747 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = make_suffix_computed((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node)); }
+#line 5630 "build/generated/parser_bison.c"
+    break;
+
+  case 323: /* member_noncall_suffix: template_literal  */
+#line 1749 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = make_suffix_template((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5636 "build/generated/parser_bison.c"
+    break;
+
+  case 324: /* call_suffix_seq: call_suffix_seq call_any_suffix  */
+#line 1754 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = append_suffix((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.suffix), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix)); }
+#line 5642 "build/generated/parser_bison.c"
+    break;
+
+  case 325: /* call_suffix_seq: call_suffix_initial  */
+#line 1756 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix); }
+#line 5648 "build/generated/parser_bison.c"
+    break;
+
+  case 326: /* call_any_suffix: call_suffix_initial  */
+#line 1761 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix); }
+#line 5654 "build/generated/parser_bison.c"
+    break;
+
+  case 327: /* call_any_suffix: member_noncall_suffix  */
+#line 1763 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.suffix); }
+#line 5660 "build/generated/parser_bison.c"
+    break;
+
+  case 328: /* call_suffix_initial: '(' opt_arg_list ')'  */
+#line 1768 "build/generated/parser.y"
+            { ((*yyvalp).suffix) = make_suffix_call((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 5666 "build/generated/parser_bison.c"
+    break;
+
+  case 329: /* opt_arg_list: %empty  */
+#line 1773 "build/generated/parser.y"
+      { ((*yyvalp).list) = NULL; }
+#line 5672 "build/generated/parser_bison.c"
+    break;
+
+  case 330: /* opt_arg_list: arg_list  */
+#line 1775 "build/generated/parser.y"
+      { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 5678 "build/generated/parser_bison.c"
+    break;
+
+  case 331: /* arg_list: arg_item  */
+#line 1780 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5684 "build/generated/parser_bison.c"
+    break;
+
+  case 332: /* arg_list: arg_list ',' arg_item  */
+#line 1782 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 5690 "build/generated/parser_bison.c"
+    break;
+
+  case 333: /* arg_item: assignment_expr  */
+#line 1787 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5696 "build/generated/parser_bison.c"
+    break;
+
+  case 334: /* arg_item: spread_element  */
+#line 1789 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5702 "build/generated/parser_bison.c"
+    break;
+
+  case 335: /* primary_expr: IDENTIFIER  */
+#line 1795 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)); }
+#line 5708 "build/generated/parser_bison.c"
+    break;
+
+  case 336: /* primary_expr: THIS  */
+#line 1797 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_this_expr(); }
+#line 5714 "build/generated/parser_bison.c"
+    break;
+
+  case 337: /* primary_expr: NUMBER  */
+#line 1799 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_number_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)); }
+#line 5720 "build/generated/parser_bison.c"
+    break;
+
+  case 338: /* primary_expr: STRING  */
+#line 1801 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str)); }
+#line 5726 "build/generated/parser_bison.c"
+    break;
+
+  case 339: /* primary_expr: REGEX  */
+#line 1803 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_regex_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str)); }
+#line 5732 "build/generated/parser_bison.c"
+    break;
+
+  case 340: /* primary_expr: TRUE  */
+#line 1805 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_boolean_literal(true); }
+#line 5738 "build/generated/parser_bison.c"
+    break;
+
+  case 341: /* primary_expr: FALSE  */
+#line 1807 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_boolean_literal(false); }
+#line 5744 "build/generated/parser_bison.c"
+    break;
+
+  case 342: /* primary_expr: NULL_T  */
+#line 1809 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_null_literal(); }
+#line 5750 "build/generated/parser_bison.c"
+    break;
+
+  case 343: /* primary_expr: UNDEFINED  */
+#line 1811 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_undefined_literal(); }
+#line 5756 "build/generated/parser_bison.c"
+    break;
+
+  case 344: /* primary_expr: '(' expr ')'  */
+#line 1813 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node); }
+#line 5762 "build/generated/parser_bison.c"
+    break;
+
+  case 345: /* primary_expr: array_literal  */
+#line 1815 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5768 "build/generated/parser_bison.c"
+    break;
+
+  case 346: /* primary_expr: object_literal  */
+#line 1817 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5774 "build/generated/parser_bison.c"
+    break;
+
+  case 347: /* primary_expr: template_literal  */
+#line 1819 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5780 "build/generated/parser_bison.c"
+    break;
+
+  case 348: /* primary_expr: class_expr  */
+#line 1821 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5786 "build/generated/parser_bison.c"
+    break;
+
+  case 349: /* primary_expr: SUPER  */
+#line 1823 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_super_expr(); }
+#line 5792 "build/generated/parser_bison.c"
+    break;
+
+  case 350: /* primary_expr: function_expr  */
+#line 1825 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5798 "build/generated/parser_bison.c"
+    break;
+
+  case 351: /* primary_expr_no_obj: IDENTIFIER  */
+#line 1830 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)); }
+#line 5804 "build/generated/parser_bison.c"
+    break;
+
+  case 352: /* primary_expr_no_obj: THIS  */
+#line 1832 "build/generated/parser.y"
+        { ((*yyvalp).node) = ast_make_this_expr(); }
+#line 5810 "build/generated/parser_bison.c"
+    break;
+
+  case 353: /* primary_expr_no_obj: NUMBER  */
+#line 1834 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_number_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)); }
+#line 5816 "build/generated/parser_bison.c"
+    break;
+
+  case 354: /* primary_expr_no_obj: STRING  */
+#line 1836 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_string_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str)); }
+#line 5822 "build/generated/parser_bison.c"
+    break;
+
+  case 355: /* primary_expr_no_obj: REGEX  */
+#line 1838 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_regex_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str)); }
+#line 5828 "build/generated/parser_bison.c"
+    break;
+
+  case 356: /* primary_expr_no_obj: TRUE  */
+#line 1840 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_boolean_literal(true); }
+#line 5834 "build/generated/parser_bison.c"
+    break;
+
+  case 357: /* primary_expr_no_obj: FALSE  */
+#line 1842 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_boolean_literal(false); }
+#line 5840 "build/generated/parser_bison.c"
+    break;
+
+  case 358: /* primary_expr_no_obj: NULL_T  */
+#line 1844 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_null_literal(); }
+#line 5846 "build/generated/parser_bison.c"
+    break;
+
+  case 359: /* primary_expr_no_obj: UNDEFINED  */
+#line 1846 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_undefined_literal(); }
+#line 5852 "build/generated/parser_bison.c"
+    break;
+
+  case 360: /* primary_expr_no_obj: '(' expr ')'  */
+#line 1848 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node); }
+#line 5858 "build/generated/parser_bison.c"
+    break;
+
+  case 361: /* primary_expr_no_obj: array_literal  */
+#line 1850 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5864 "build/generated/parser_bison.c"
+    break;
+
+  case 362: /* primary_expr_no_obj: template_literal  */
+#line 1852 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5870 "build/generated/parser_bison.c"
+    break;
+
+  case 363: /* primary_expr_no_obj: SUPER  */
+#line 1854 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_super_expr(); }
+#line 5876 "build/generated/parser_bison.c"
+    break;
+
+  case 364: /* primary_expr_no_obj: function_expr  */
+#line 1856 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5882 "build/generated/parser_bison.c"
+    break;
+
+  case 365: /* function_expr: async_modifier_opt FUNCTION generator_marker_opt IDENTIFIER '(' opt_param_list ')' block  */
+#line 1861 "build/generated/parser.y"
+      {
+          ((*yyvalp).node) = ast_make_function_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+          if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.boolean) && ((*yyvalp).node)) {
+              ((*yyvalp).node)->data.function_expr.is_generator = true;
+          }
+          if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-7)].yystate.yysemantics.yyval.boolean) && ((*yyvalp).node)) {
+              ((*yyvalp).node)->data.function_expr.is_async = true;
+          }
+      }
+#line 5896 "build/generated/parser_bison.c"
+    break;
+
+  case 366: /* function_expr: async_modifier_opt FUNCTION generator_marker_opt '(' opt_param_list ')' block  */
+#line 1871 "build/generated/parser.y"
+      {
+          ((*yyvalp).node) = ast_make_function_expr(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+          if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.boolean) && ((*yyvalp).node)) {
+              ((*yyvalp).node)->data.function_expr.is_generator = true;
+          }
+          if ((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.boolean) && ((*yyvalp).node)) {
+              ((*yyvalp).node)->data.function_expr.is_async = true;
+          }
+      }
+#line 5910 "build/generated/parser_bison.c"
+    break;
+
+  case 367: /* class_decl: CLASS IDENTIFIER class_heritage_opt class_body  */
+#line 1884 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_class_decl((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 5916 "build/generated/parser_bison.c"
+    break;
+
+  case 368: /* class_expr: CLASS IDENTIFIER class_heritage_opt class_body  */
+#line 1889 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_class_expr((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 5922 "build/generated/parser_bison.c"
+    break;
+
+  case 369: /* class_expr: CLASS class_heritage_opt class_body  */
+#line 1891 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_class_expr(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 5928 "build/generated/parser_bison.c"
+    break;
+
+  case 370: /* class_heritage_opt: EXTENDS assignment_expr  */
+#line 1896 "build/generated/parser.y"
+            { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 5934 "build/generated/parser_bison.c"
+    break;
+
+  case 371: /* class_heritage_opt: %empty  */
+#line 1898 "build/generated/parser.y"
+            { ((*yyvalp).node) = NULL; }
+#line 5940 "build/generated/parser_bison.c"
+    break;
+
+  case 372: /* class_body: '{' class_element_list_opt '}'  */
+#line 1903 "build/generated/parser.y"
+            { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list); }
+#line 5946 "build/generated/parser_bison.c"
+    break;
+
+  case 373: /* class_element_list_opt: %empty  */
+#line 1908 "build/generated/parser.y"
+            { ((*yyvalp).list) = NULL; }
+#line 5952 "build/generated/parser_bison.c"
+    break;
+
+  case 374: /* class_element_list_opt: class_element_list  */
+#line 1910 "build/generated/parser.y"
+            { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 5958 "build/generated/parser_bison.c"
+    break;
+
+  case 375: /* class_element_list: class_element_list class_element  */
+#line 1915 "build/generated/parser.y"
+            { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node) ? ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)) : (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list); }
+#line 5964 "build/generated/parser_bison.c"
+    break;
+
+  case 376: /* class_element_list: class_element  */
+#line 1917 "build/generated/parser.y"
+            { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node) ? ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)) : NULL; }
+#line 5970 "build/generated/parser_bison.c"
+    break;
+
+  case 377: /* class_element: method_definition  */
+#line 1923 "build/generated/parser.y"
+        { ((*yyvalp).node) = build_method_node(maybe_tag_constructor(ctx, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.method))); }
+#line 5976 "build/generated/parser_bison.c"
+    break;
+
+  case 378: /* class_element: IDENTIFIER method_definition  */
+#line 1925 "build/generated/parser.y"
+        {
+            MethodInfo *method = handle_single_prefix(ctx, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.method));
+            if (!method) {
+                YYERROR;
+            }
+            ((*yyvalp).node) = build_method_node(method);
+        }
+#line 5988 "build/generated/parser_bison.c"
+    break;
+
+  case 379: /* class_element: IDENTIFIER IDENTIFIER method_definition  */
+#line 1933 "build/generated/parser.y"
+        {
+            MethodInfo *method = handle_double_prefix(ctx, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.atom), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.method));
+            if (!method) {
+                YYERROR;
+            }
+            ((*yyvalp).node) = build_method_node(method);
+        }
+#line 6000 "build/generated/parser_bison.c"
+    break;
+
+  case 380: /* class_element: ';'  */
+#line 1941 "build/generated/parser.y"
+        { ((*yyvalp).node) = NULL; }
+#line 6006 "build/generated/parser_bison.c"
+    break;
+
+  case 381: /* method_definition: method_head '(' opt_param_list ')' block  */
+#line 1948 "build/generated/parser.y"
+            { ((*yyvalp).method) = method_info_set_function((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.method), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6012 "build/generated/parser_bison.c"
+    break;
+
+  case 382: /* method_head: method_name  */
+#line 1953 "build/generated/parser.y"
+            { ((*yyvalp).method) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.method); }
+#line 6018 "build/generated/parser_bison.c"
+    break;
+
+  case 383: /* method_head: ASYNC method_name  */
+#line 1955 "build/generated/parser.y"
+            {
+                ((*yyvalp).method) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.method);
+                ((*yyvalp).method)->is_async = true;
+            }
+#line 6027 "build/generated/parser_bison.c"
+    break;
+
+  case 384: /* method_head: '*' method_name  */
+#line 1960 "build/generated/parser.y"
+            {
+                ((*yyvalp).method) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.method);
+                ((*yyvalp).method)->is_generator = true;
+            }
+#line 6036 "build/generated/parser_bison.c"
+    break;
+
+  case 385: /* method_head: ASYNC '*' method_name  */
+#line 1965 "build/generated/parser.y"
+            {
+                ((*yyvalp).method) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.method);
+                ((*yyvalp).method)->is_async = true;
+                ((*yyvalp).method)->is_generator = true;
+            }
+#line 6046 "build/generated/parser_bison.c"
+    break;
+
+  case 386: /* getter_definition: IDENTIFIER method_name '(' ')' block  */
+#line 1974 "build/generated/parser.y"
+            {
+                if (!identifier_is((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.atom), ATOM(ctx->atoms, GET))) {
+                    yyerror(ctx, "Unexpected identifier before getter definition");
+                    method_info_free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.method));
+                    YYERROR;
+                }
+                (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.method)->kind = AST_METHOD_KIND_GET;
+                ((*yyvalp).node) = build_method_node(method_info_set_function((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.method), NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)));
+            }
+#line 6060 "build/generated/parser_bison.c"
+    break;
+
+  case 387: /* setter_definition: IDENTIFIER method_name '(' binding_element ')' block  */
+#line 1987 "build/generated/parser.y"
+            {
+                if (!identifier_is((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.atom), ATOM(ctx->atoms, SET))) {
+                    yyerror(ctx, "Unexpected identifier before setter definition");
+                    method_info_free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.method));
+                    YYERROR;
+                }
+                (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.method)->kind = AST_METHOD_KIND_SET;
+                ((*yyvalp).node) = build_method_node(method_info_set_function((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yyval.method), make_single_param_list((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)));
+            }
+#line 6074 "build/generated/parser_bison.c"
+    break;
+
+  case 388: /* method_name: property_name  */
+#line 2000 "build/generated/parser.y"
+            { ((*yyvalp).method) = method_info_alloc((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom), NULL, false); }
+#line 6080 "build/generated/parser_bison.c"
+    break;
+
+  case 389: /* method_name: '[' assignment_expr ']'  */
+#line 2002 "build/generated/parser.y"
+            { ((*yyvalp).method) = method_info_alloc(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), true); }
+#line 6086 "build/generated/parser_bison.c"
+    break;
+
+  case 390: /* arrow_function: IDENTIFIER ARROW arrow_body  */
+#line 2008 "build/generated/parser.y"
+      {
+          ASTNode *binding = ast_make_binding_pattern(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom)), NULL);
+          ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+          ((*yyvalp).node)->data.arrow_function.params = ast_list_append(NULL, binding);
+      }
+#line 6096 "build/generated/parser_bison.c"
+    break;
+
+  case 391: /* arrow_function: ARROW_HEAD '(' opt_param_list ')' ARROW arrow_body  */
+#line 2014 "build/generated/parser.y"
+      {
+          ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+          ((*yyvalp).node)->data.arrow_function.params = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list);
+      }
+#line 6105 "build/generated/parser_bison.c"
+    break;
+
+  case 392: /* arrow_function: ASYNC IDENTIFIER ARROW arrow_body  */
+#line 2019 "build/generated/parser.y"
+      {
+          ASTNode *binding = ast_make_binding_pattern(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom)), NULL);
+          ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+          ((*yyvalp).node)->data.arrow_function.params = ast_list_append(NULL, binding);
+          ((*yyvalp).node)->data.arrow_function.is_async = true;
+      }
+#line 6116 "build/generated/parser_bison.c"
+    break;
+
+  case 393: /* arrow_function: ASYNC ARROW_HEAD '(' opt_param_list ')' ARROW arrow_body  */
+#line 2026 "build/generated/parser.y"
+      {
+          ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+          ((*yyvalp).node)->data.arrow_function.params = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list);
+          ((*yyvalp).node)->data.arrow_function.is_async = true;
+      }
+#line 6126 "build/generated/parser_bison.c"
+    break;
+
+  case 394: /* arrow_body: assignment_expr_no_obj  */
+#line 2035 "build/generated/parser.y"
+      {
+          ASTList *stmts = NULL;
+          stmts = ast_list_append(stmts, ast_make_return((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)));
+          ((*yyvalp).node) = ast_make_arrow_function(NULL, ast_make_block(stmts), true);
+      }
+#line 6136 "build/generated/parser_bison.c"
+    break;
+
+  case 395: /* arrow_body: block  */
+#line 2041 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_arrow_function(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false); }
+#line 6142 "build/generated/parser_bison.c"
+    break;
+
+  case 396: /* yield_expr: YIELD  */
+#line 2046 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_yield(NULL, false); }
+#line 6148 "build/generated/parser_bison.c"
+    break;
+
+  case 397: /* yield_expr: YIELD assignment_expr  */
+#line 2048 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_yield((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false); }
+#line 6154 "build/generated/parser_bison.c"
+    break;
+
+  case 398: /* yield_expr: YIELD '*' assignment_expr  */
+#line 2050 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_yield((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), true); }
+#line 6160 "build/generated/parser_bison.c"
+    break;
+
+  case 399: /* array_literal: '[' ']'  */
+#line 2055 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_array_literal(NULL); }
+#line 6166 "build/generated/parser_bison.c"
+    break;
+
+  case 400: /* array_literal: '[' elision ']'  */
+#line 2057 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_array_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 6172 "build/generated/parser_bison.c"
+    break;
+
+  case 401: /* array_literal: '[' element_list ']'  */
+#line 2059 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_array_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 6178 "build/generated/parser_bison.c"
+    break;
+
+  case 402: /* array_literal: '[' element_list ',' ']'  */
+#line 2061 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_array_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list)); }
+#line 6184 "build/generated/parser_bison.c"
+    break;
+
+  case 403: /* elision: ','  */
+#line 2066 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, ast_make_array_hole()); }
+#line 6190 "build/generated/parser_bison.c"
+    break;
+
+  case 404: /* elision: elision ','  */
+#line 2068 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), ast_make_array_hole()); }
+#line 6196 "build/generated/parser_bison.c"
+    break;
+
+  case 405: /* elision_opt: %empty  */
+#line 2073 "build/generated/parser.y"
+      { ((*yyvalp).list) = NULL; }
+#line 6202 "build/generated/parser_bison.c"
+    break;
+
+  case 406: /* elision_opt: elision  */
+#line 2075 "build/generated/parser.y"
+      { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 6208 "build/generated/parser_bison.c"
+    break;
+
+  case 407: /* element_list: elision_opt el_item  */
+#line 2080 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list), ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node))); }
+#line 6214 "build/generated/parser_bison.c"
+    break;
+
+  case 408: /* element_list: element_list ',' elision_opt el_item  */
+#line 2082 "build/generated/parser.y"
+      {
+          ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list));
+          ((*yyvalp).list) = ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+      }
+#line 6223 "build/generated/parser_bison.c"
+    break;
+
+  case 409: /* element_list: element_list ',' elision  */
+#line 2087 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 6229 "build/generated/parser_bison.c"
+    break;
+
+  case 410: /* el_item: assignment_expr  */
+#line 2092 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6235 "build/generated/parser_bison.c"
+    break;
+
+  case 411: /* el_item: spread_element  */
+#line 2094 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6241 "build/generated/parser_bison.c"
+    break;
+
+  case 412: /* spread_element: ELLIPSIS assignment_expr  */
+#line 2099 "build/generated/parser.y"
+            { ((*yyvalp).node) = ast_make_spread_element((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6247 "build/generated/parser_bison.c"
+    break;
+
+  case 415: /* object_literal: '{' '}'  */
+#line 2109 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_object_literal(NULL); }
+#line 6253 "build/generated/parser_bison.c"
+    break;
+
+  case 416: /* object_literal: '{' prop_list opt_trailing_comma '}'  */
+#line 2111 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_object_literal((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list)); }
+#line 6259 "build/generated/parser_bison.c"
+    break;
+
+  case 417: /* template_literal: TEMPLATE_NO_SUB  */
+#line 2116 "build/generated/parser.y"
+      {
+          ASTList *quasis = NULL;
+          quasis = ast_list_append(quasis, ast_make_template_element((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str), true));
+          ((*yyvalp).node) = ast_make_template_literal(quasis, NULL);
+      }
+#line 6269 "build/generated/parser_bison.c"
+    break;
+
+  case 418: /* template_literal: TEMPLATE_HEAD template_part_list  */
+#line 2122 "build/generated/parser.y"
+      {
+          ASTList *quasis = NULL;
+          quasis = ast_list_append(quasis, ast_make_template_element((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.str), false));
+          ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+          ((*yyvalp).node)->data.template_literal.quasis = ast_list_concat(quasis, ((*yyvalp).node)->data.template_literal.quasis);
+      }
+#line 6280 "build/generated/parser_bison.c"
+    break;
+
+  case 419: /* template_part_list: assignment_expr TEMPLATE_TAIL  */
+#line 2133 "build/generated/parser.y"
+      {
+          ASTList *exprs = NULL;
+          ASTList *quasis = NULL;
+          exprs = ast_list_append(exprs, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node));
+          quasis = ast_list_append(quasis, ast_make_template_element((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str), true));
+          ((*yyvalp).node) = ast_make_template_literal(quasis, exprs);
+      }
+#line 6292 "build/generated/parser_bison.c"
+    break;
+
+  case 420: /* template_part_list: assignment_expr TEMPLATE_MIDDLE template_part_list  */
+#line 2141 "build/generated/parser.y"
+      {
+          ASTList *exprs = NULL;
+          ASTList *quasis = NULL;
+          exprs = ast_list_append(exprs, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node));
+          quasis = ast_list_append(quasis, ast_make_template_element((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.str), false));
+          ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node);
+          ((*yyvalp).node)->data.template_literal.expressions = ast_list_concat(exprs, ((*yyvalp).node)->data.template_literal.expressions);
+          ((*yyvalp).node)->data.template_literal.quasis = ast_list_concat(quasis, ((*yyvalp).node)->data.template_literal.quasis);
+      }
+#line 6306 "build/generated/parser_bison.c"
+    break;
+
+  case 421: /* prop_list: prop  */
+#line 2154 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6312 "build/generated/parser_bison.c"
+    break;
+
+  case 422: /* prop_list: prop_list ',' prop  */
+#line 2156 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6318 "build/generated/parser_bison.c"
+    break;
+
+  case 423: /* prop: property_name ':' assignment_expr  */
+#line 2161 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6324 "build/generated/parser_bison.c"
+    break;
+
+  case 424: /* prop: IDENTIFIER  */
+#line 2163 "build/generated/parser.y"
+      {
+          ASTNode *id = ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom));
+          ((*yyvalp).node) = ast_make_property(id->data.identifier.name, true, id);
+      }
+#line 6333 "build/generated/parser_bison.c"
+    break;
+
+  case 425: /* prop: method_definition  */
+#line 2168 "build/generated/parser.y"
+      { ((*yyvalp).node) = build_method_node((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.method)); }
+#line 6339 "build/generated/parser_bison.c"
+    break;
+
+  case 426: /* prop: getter_definition  */
+#line 2170 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6345 "build/generated/parser_bison.c"
+    break;
+
+  case 427: /* prop: setter_definition  */
+#line 2172 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6351 "build/generated/parser_bison.c"
+    break;
+
+  case 428: /* prop: computed_property  */
+#line 2174 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6357 "build/generated/parser_bison.c"
+    break;
+
+  case 429: /* prop: spread_element  */
+#line 2176 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6363 "build/generated/parser_bison.c"
+    break;
+
+  case 430: /* computed_property: '[' assignment_expr ']' ':' assignment_expr  */
+#line 2181 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_computed_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6369 "build/generated/parser_bison.c"
+    break;
+
+  case 431: /* property_name: IDENTIFIER  */
+#line 2186 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom); }
+#line 6375 "build/generated/parser_bison.c"
+    break;
+
+  case 432: /* property_name: property_name_keyword  */
+#line 2187 "build/generated/parser.y"
+                            { ((*yyvalp).atom) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom); }
+#line 6381 "build/generated/parser_bison.c"
+    break;
+
+  case 433: /* property_name_keyword: STRING  */
+#line 2191 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str)); free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.str)); }
+#line 6387 "build/generated/parser_bison.c"
+    break;
+
+  case 434: /* property_name_keyword: NUMBER  */
+#line 2192 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom); }
+#line 6393 "build/generated/parser_bison.c"
+    break;
+
+  case 435: /* property_name_keyword: DEFAULT  */
+#line 2193 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = ATOM(ctx->atoms, DEFAULT); }
+#line 6399 "build/generated/parser_bison.c"
+    break;
+
+  case 436: /* property_name_keyword: IF  */
+#line 2194 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "if"); }
+#line 6405 "build/generated/parser_bison.c"
+    break;
+
+  case 437: /* property_name_keyword: ELSE  */
+#line 2195 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "else"); }
+#line 6411 "build/generated/parser_bison.c"
+    break;
+
+  case 438: /* property_name_keyword: FOR  */
+#line 2196 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "for"); }
+#line 6417 "build/generated/parser_bison.c"
+    break;
+
+  case 439: /* property_name_keyword: WHILE  */
+#line 2197 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "while"); }
+#line 6423 "build/generated/parser_bison.c"
+    break;
+
+  case 440: /* property_name_keyword: DO  */
+#line 2198 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "do"); }
+#line 6429 "build/generated/parser_bison.c"
+    break;
+
+  case 441: /* property_name_keyword: FUNCTION  */
+#line 2199 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "function"); }
+#line 6435 "build/generated/parser_bison.c"
+    break;
+
+  case 442: /* property_name_keyword: VAR  */
+#line 2200 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "var"); }
+#line 6441 "build/generated/parser_bison.c"
+    break;
+
+  case 443: /* property_name_keyword: LET  */
+#line 2201 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "let"); }
+#line 6447 "build/generated/parser_bison.c"
+    break;
+
+  case 444: /* property_name_keyword: CONST  */
+#line 2202 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "const"); }
+#line 6453 "build/generated/parser_bison.c"
+    break;
+
+  case 445: /* property_name_keyword: RETURN  */
+#line 2203 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "return"); }
+#line 6459 "build/generated/parser_bison.c"
+    break;
+
+  case 446: /* property_name_keyword: BREAK  */
+#line 2204 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "break"); }
+#line 6465 "build/generated/parser_bison.c"
+    break;
+
+  case 447: /* property_name_keyword: CONTINUE  */
+#line 2205 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "continue"); }
+#line 6471 "build/generated/parser_bison.c"
+    break;
+
+  case 448: /* property_name_keyword: SWITCH  */
+#line 2206 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "switch"); }
+#line 6477 "build/generated/parser_bison.c"
+    break;
+
+  case 449: /* property_name_keyword: CASE  */
+#line 2207 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "case"); }
+#line 6483 "build/generated/parser_bison.c"
+    break;
+
+  case 450: /* property_name_keyword: TRY  */
+#line 2208 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "try"); }
+#line 6489 "build/generated/parser_bison.c"
+    break;
+
+  case 451: /* property_name_keyword: CATCH  */
+#line 2209 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "catch"); }
+#line 6495 "build/generated/parser_bison.c"
+    break;
+
+  case 452: /* property_name_keyword: FINALLY  */
+#line 2210 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "finally"); }
+#line 6501 "build/generated/parser_bison.c"
+    break;
+
+  case 453: /* property_name_keyword: THROW  */
+#line 2211 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "throw"); }
+#line 6507 "build/generated/parser_bison.c"
+    break;
+
+  case 454: /* property_name_keyword: NEW  */
+#line 2212 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "new"); }
+#line 6513 "build/generated/parser_bison.c"
+    break;
+
+  case 455: /* property_name_keyword: THIS  */
+#line 2213 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "this"); }
+#line 6519 "build/generated/parser_bison.c"
+    break;
+
+  case 456: /* property_name_keyword: TYPEOF  */
+#line 2214 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "typeof"); }
+#line 6525 "build/generated/parser_bison.c"
+    break;
+
+  case 457: /* property_name_keyword: DELETE  */
+#line 2215 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "delete"); }
+#line 6531 "build/generated/parser_bison.c"
+    break;
+
+  case 458: /* property_name_keyword: IN  */
+#line 2216 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "in"); }
+#line 6537 "build/generated/parser_bison.c"
+    break;
+
+  case 459: /* property_name_keyword: INSTANCEOF  */
+#line 2217 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "instanceof"); }
+#line 6543 "build/generated/parser_bison.c"
+    break;
+
+  case 460: /* property_name_keyword: VOID  */
+#line 2218 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "void"); }
+#line 6549 "build/generated/parser_bison.c"
+    break;
+
+  case 461: /* property_name_keyword: WITH  */
+#line 2219 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "with"); }
+#line 6555 "build/generated/parser_bison.c"
+    break;
+
+  case 462: /* property_name_keyword: DEBUGGER  */
+#line 2220 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "debugger"); }
+#line 6561 "build/generated/parser_bison.c"
+    break;
+
+  case 463: /* property_name_keyword: TRUE  */
+#line 2221 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "true"); }
+#line 6567 "build/generated/parser_bison.c"
+    break;
+
+  case 464: /* property_name_keyword: FALSE  */
+#line 2222 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "false"); }
+#line 6573 "build/generated/parser_bison.c"
+    break;
+
+  case 465: /* property_name_keyword: NULL_T  */
+#line 2223 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "null"); }
+#line 6579 "build/generated/parser_bison.c"
+    break;
+
+  case 466: /* property_name_keyword: UNDEFINED  */
+#line 2224 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "undefined"); }
+#line 6585 "build/generated/parser_bison.c"
+    break;
+
+  case 467: /* property_name_keyword: CLASS  */
+#line 2225 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "class"); }
+#line 6591 "build/generated/parser_bison.c"
+    break;
+
+  case 468: /* property_name_keyword: EXTENDS  */
+#line 2226 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "extends"); }
+#line 6597 "build/generated/parser_bison.c"
+    break;
+
+  case 469: /* property_name_keyword: SUPER  */
+#line 2227 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "super"); }
+#line 6603 "build/generated/parser_bison.c"
+    break;
+
+  case 470: /* property_name_keyword: ASYNC  */
+#line 2228 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "async"); }
+#line 6609 "build/generated/parser_bison.c"
+    break;
+
+  case 471: /* property_name_keyword: AWAIT  */
+#line 2229 "build/generated/parser.y"
+                 { ((*yyvalp).atom) = atom_intern_cstr(ctx->atoms, "await"); }
+#line 6615 "build/generated/parser_bison.c"
+    break;
+
+  case 472: /* binding_initializer_opt: %empty  */
+#line 2234 "build/generated/parser.y"
+      { ((*yyvalp).node) = NULL; }
+#line 6621 "build/generated/parser_bison.c"
+    break;
+
+  case 473: /* binding_initializer_opt: '=' assignment_expr  */
+#line 2236 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6627 "build/generated/parser_bison.c"
+    break;
+
+  case 474: /* binding_initializer_opt_no_in: %empty  */
+#line 2241 "build/generated/parser.y"
+      { ((*yyvalp).node) = NULL; }
+#line 6633 "build/generated/parser_bison.c"
+    break;
+
+  case 475: /* binding_initializer_opt_no_in: '=' assignment_expr_no_in  */
+#line 2243 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6639 "build/generated/parser_bison.c"
+    break;
+
+  case 476: /* binding_element: IDENTIFIER binding_initializer_opt  */
+#line 2248 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_pattern(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.atom)), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6645 "build/generated/parser_bison.c"
+    break;
+
+  case 477: /* binding_element: object_binding binding_initializer_opt  */
+#line 2250 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6651 "build/generated/parser_bison.c"
+    break;
+
+  case 478: /* binding_element: array_binding binding_initializer_opt  */
+#line 2252 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6657 "build/generated/parser_bison.c"
+    break;
+
+  case 479: /* object_binding: '{' '}'  */
+#line 2257 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_object_binding(NULL); }
+#line 6663 "build/generated/parser_bison.c"
+    break;
+
+  case 480: /* object_binding: '{' binding_property_sequence '}'  */
+#line 2259 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_object_binding((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 6669 "build/generated/parser_bison.c"
+    break;
+
+  case 481: /* binding_property_sequence: binding_property_list opt_trailing_comma  */
+#line 2264 "build/generated/parser.y"
+      { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list); }
+#line 6675 "build/generated/parser_bison.c"
+    break;
+
+  case 482: /* binding_property_sequence: binding_property_list ',' binding_rest_property  */
+#line 2266 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6681 "build/generated/parser_bison.c"
+    break;
+
+  case 483: /* binding_property_sequence: binding_rest_property  */
+#line 2268 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6687 "build/generated/parser_bison.c"
+    break;
+
+  case 484: /* binding_property_list: binding_property  */
+#line 2273 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6693 "build/generated/parser_bison.c"
+    break;
+
+  case 485: /* binding_property_list: binding_property_list ',' binding_property  */
+#line 2275 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6699 "build/generated/parser_bison.c"
+    break;
+
+  case 486: /* binding_property: IDENTIFIER ':' binding_element  */
+#line 2280 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false); }
+#line 6705 "build/generated/parser_bison.c"
+    break;
+
+  case 487: /* binding_property: property_name_keyword ':' binding_element  */
+#line 2282 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_property(unquote_property_key(ctx, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom)), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false); }
+#line 6711 "build/generated/parser_bison.c"
+    break;
+
+  case 488: /* binding_property: IDENTIFIER binding_initializer_opt  */
+#line 2284 "build/generated/parser.y"
+      {
+          ASTNode *id = ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.atom));
+          ASTNode *pattern = ast_make_binding_pattern(id, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+          ((*yyvalp).node) = ast_make_binding_property(id->data.identifier.name, true, pattern, true);
+      }
+#line 6721 "build/generated/parser_bison.c"
+    break;
+
+  case 489: /* binding_rest_property: ELLIPSIS IDENTIFIER  */
+#line 2293 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_rest_element(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom))); }
+#line 6727 "build/generated/parser_bison.c"
+    break;
+
+  case 490: /* array_binding: '[' binding_elision_opt ']'  */
+#line 2298 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_array_binding((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 6733 "build/generated/parser_bison.c"
+    break;
+
+  case 491: /* array_binding: '[' binding_elision_opt binding_element_list opt_trailing_comma ']'  */
+#line 2300 "build/generated/parser.y"
+      { ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list)); ((*yyvalp).node) = ast_make_array_binding(list); }
+#line 6739 "build/generated/parser_bison.c"
+    break;
+
+  case 492: /* array_binding: '[' binding_elision_opt binding_element_list ',' binding_elision_opt binding_rest_element opt_trailing_comma ']'  */
+#line 2302 "build/generated/parser.y"
+      { ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.list)); list = ast_list_concat(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list)); ((*yyvalp).node) = ast_make_array_binding(ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node))); }
+#line 6745 "build/generated/parser_bison.c"
+    break;
+
+  case 493: /* array_binding: '[' binding_elision_opt binding_rest_element opt_trailing_comma ']'  */
+#line 2304 "build/generated/parser.y"
+      { ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node))); ((*yyvalp).node) = ast_make_array_binding(list); }
+#line 6751 "build/generated/parser_bison.c"
+    break;
+
+  case 494: /* binding_element_list: binding_element  */
+#line 2309 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6757 "build/generated/parser_bison.c"
+    break;
+
+  case 495: /* binding_element_list: binding_element_list ',' binding_elision_opt binding_element  */
+#line 2311 "build/generated/parser.y"
+      { ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); ((*yyvalp).list) = ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6763 "build/generated/parser_bison.c"
+    break;
+
+  case 496: /* binding_elision_opt: %empty  */
+#line 2316 "build/generated/parser.y"
+      { ((*yyvalp).list) = NULL; }
+#line 6769 "build/generated/parser_bison.c"
+    break;
+
+  case 497: /* binding_elision_opt: binding_elision  */
+#line 2318 "build/generated/parser.y"
+      { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list); }
+#line 6775 "build/generated/parser_bison.c"
+    break;
+
+  case 498: /* binding_elision: ','  */
+#line 2323 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, ast_make_array_hole()); }
+#line 6781 "build/generated/parser_bison.c"
+    break;
+
+  case 499: /* binding_elision: ',' binding_elision  */
+#line 2325 "build/generated/parser.y"
+      { ASTList *list = ast_list_append(NULL, ast_make_array_hole()); ((*yyvalp).list) = ast_list_concat(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.list)); }
+#line 6787 "build/generated/parser_bison.c"
+    break;
+
+  case 500: /* binding_rest_element: ELLIPSIS IDENTIFIER  */
+#line 2330 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_rest_element(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom))); }
+#line 6793 "build/generated/parser_bison.c"
+    break;
+
+  case 501: /* assignment_pattern: object_assignment_pattern  */
+#line 2335 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL); }
+#line 6799 "build/generated/parser_bison.c"
+    break;
+
+  case 502: /* assignment_pattern: array_assignment_pattern  */
+#line 2337 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL); }
+#line 6805 "build/generated/parser_bison.c"
+    break;
+
+  case 503: /* object_assignment_pattern: '{' '}'  */
+#line 2342 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_object_binding(NULL); }
+#line 6811 "build/generated/parser_bison.c"
+    break;
+
+  case 504: /* object_assignment_pattern: '{' assignment_property_sequence '}'  */
+#line 2344 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_object_binding((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 6817 "build/generated/parser_bison.c"
+    break;
+
+  case 505: /* assignment_property_sequence: assignment_property_list opt_trailing_comma  */
+#line 2349 "build/generated/parser.y"
+      { ((*yyvalp).list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list); }
+#line 6823 "build/generated/parser_bison.c"
+    break;
+
+  case 506: /* assignment_property_sequence: assignment_property_list ',' assignment_rest_element  */
+#line 2351 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6829 "build/generated/parser_bison.c"
+    break;
+
+  case 507: /* assignment_property_sequence: assignment_rest_element  */
+#line 2353 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6835 "build/generated/parser_bison.c"
+    break;
+
+  case 508: /* assignment_property_list: assignment_property  */
+#line 2358 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6841 "build/generated/parser_bison.c"
+    break;
+
+  case 509: /* assignment_property_list: assignment_property_list ',' assignment_property  */
+#line 2360 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6847 "build/generated/parser_bison.c"
+    break;
+
+  case 510: /* assignment_property: IDENTIFIER ':' assignment_element  */
+#line 2365 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom), true, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false); }
+#line 6853 "build/generated/parser_bison.c"
+    break;
+
+  case 511: /* assignment_property: property_name_keyword ':' assignment_element  */
+#line 2367 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_property(unquote_property_key(ctx, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.atom)), false, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), false); }
+#line 6859 "build/generated/parser_bison.c"
+    break;
+
+  case 512: /* assignment_property: IDENTIFIER binding_initializer_opt  */
+#line 2369 "build/generated/parser.y"
+      {
+          ASTNode *id = ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.atom));
+          ASTNode *pattern = ast_make_binding_pattern(id, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node));
+          ((*yyvalp).node) = ast_make_binding_property(id->data.identifier.name, true, pattern, true);
+      }
+#line 6869 "build/generated/parser_bison.c"
+    break;
+
+  case 513: /* assignment_rest_element: ELLIPSIS postfix_expr  */
+#line 2378 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_rest_element((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6875 "build/generated/parser_bison.c"
+    break;
+
+  case 514: /* array_assignment_pattern: '[' binding_elision_opt ']'  */
+#line 2383 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_array_binding((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); }
+#line 6881 "build/generated/parser_bison.c"
+    break;
+
+  case 515: /* array_assignment_pattern: '[' binding_elision_opt assignment_element_list opt_trailing_comma ']'  */
+#line 2385 "build/generated/parser.y"
+      { ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.list)); ((*yyvalp).node) = ast_make_array_binding(list); }
+#line 6887 "build/generated/parser_bison.c"
+    break;
+
+  case 516: /* array_assignment_pattern: '[' binding_elision_opt assignment_element_list ',' binding_elision_opt assignment_rest_element opt_trailing_comma ']'  */
+#line 2387 "build/generated/parser.y"
+      { ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yyval.list)); list = ast_list_concat(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list)); ((*yyvalp).node) = ast_make_array_binding(ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node))); }
+#line 6893 "build/generated/parser_bison.c"
+    break;
+
+  case 517: /* array_assignment_pattern: '[' binding_elision_opt assignment_rest_element opt_trailing_comma ']'  */
+#line 2389 "build/generated/parser.y"
+      { ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yyval.node))); ((*yyvalp).node) = ast_make_array_binding(list); }
+#line 6899 "build/generated/parser_bison.c"
+    break;
+
+  case 518: /* assignment_element_list: assignment_element  */
+#line 2394 "build/generated/parser.y"
+      { ((*yyvalp).list) = ast_list_append(NULL, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6905 "build/generated/parser_bison.c"
+    break;
+
+  case 519: /* assignment_element_list: assignment_element_list ',' binding_elision_opt assignment_element  */
+#line 2396 "build/generated/parser.y"
+      { ASTList *list = ast_list_concat((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yyval.list), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.list)); ((*yyvalp).list) = ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6911 "build/generated/parser_bison.c"
+    break;
+
+  case 520: /* assignment_element: assignment_target binding_initializer_opt  */
+#line 2401 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yyval.node), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); }
+#line 6917 "build/generated/parser_bison.c"
+    break;
+
+  case 521: /* assignment_target: postfix_expr  */
+#line 2406 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6923 "build/generated/parser_bison.c"
+    break;
+
+  case 522: /* assignment_target: object_assignment_pattern  */
+#line 2408 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6929 "build/generated/parser_bison.c"
+    break;
+
+  case 523: /* assignment_target: array_assignment_pattern  */
+#line 2410 "build/generated/parser.y"
+      { ((*yyvalp).node) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node); }
+#line 6935 "build/generated/parser_bison.c"
+    break;
+
+  case 524: /* for_binding: VAR for_binding_declarator  */
+#line 2415 "build/generated/parser.y"
+      { ASTList *list = NULL; list = ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_VAR, list); }
+#line 6941 "build/generated/parser_bison.c"
+    break;
+
+  case 525: /* for_binding: LET for_binding_declarator  */
+#line 2417 "build/generated/parser.y"
+      { ASTList *list = NULL; list = ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_LET, list); }
+#line 6947 "build/generated/parser_bison.c"
+    break;
+
+  case 526: /* for_binding: CONST for_binding_declarator  */
+#line 2419 "build/generated/parser.y"
+      { ASTList *list = NULL; list = ast_list_append(list, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node)); ((*yyvalp).node) = ast_make_var_stmt(AST_VAR_KIND_CONST, list); }
+#line 6953 "build/generated/parser_bison.c"
+    break;
+
+  case 527: /* for_binding_declarator: IDENTIFIER  */
+#line 2424 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.atom)), NULL)); }
+#line 6959 "build/generated/parser_bison.c"
+    break;
+
+  case 528: /* for_binding_declarator: object_binding  */
+#line 2426 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL)); }
+#line 6965 "build/generated/parser_bison.c"
+    break;
+
+  case 529: /* for_binding_declarator: array_binding  */
+#line 2428 "build/generated/parser.y"
+      { ((*yyvalp).node) = ast_make_var_decl(ast_make_binding_pattern((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yyval.node), NULL)); }
+#line 6971 "build/generated/parser_bison.c"
+    break;
+
+
+#line 6975 "build/generated/parser_bison.c"
+
+      default: break;
+    }
+  YY_SYMBOL_PRINT ("-> $$ =", yylhsNonterm (yyrule), yyvalp, yylocp);
+
+  return yyok;
+# undef yyerrok
+# undef YYABORT
+# undef YYACCEPT
+# undef YYNOMEM
+# undef YYERROR
+# undef YYBACKUP
+# undef yyclearin
+# undef YYRECOVERING
+}
+
+
+static void
+yyuserMerge (int yyn, YYSTYPE* yy0, YYSTYPE* yy1)
+{
+  YY_USE (yy0);
+  YY_USE (yy1);
+
+  switch (yyn)
+    {
+
+      default: break;
+    }
+}
+
+                              /* Bison grammar-table manipulation.  */
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, JSParser *ctx)
+{
+  YY_USE (yyvaluep);
+  YY_USE (ctx);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  switch (yykind)
+    {
+    case YYSYMBOL_STRING: /* STRING  */
+#line 750 "build/generated/parser.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 7028 "build/generated/parser_bison.c"
+        break;
+
+    case YYSYMBOL_REGEX: /* REGEX  */
+#line 750 "build/generated/parser.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 7034 "build/generated/parser_bison.c"
+        break;
+
+    case YYSYMBOL_TEMPLATE_NO_SUB: /* TEMPLATE_NO_SUB  */
+#line 750 "build/generated/parser.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 7040 "build/generated/parser_bison.c"
+        break;
+
+    case YYSYMBOL_TEMPLATE_HEAD: /* TEMPLATE_HEAD  */
+#line 750 "build/generated/parser.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 7046 "build/generated/parser_bison.c"
+        break;
+
+    case YYSYMBOL_TEMPLATE_MIDDLE: /* TEMPLATE_MIDDLE  */
+#line 750 "build/generated/parser.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 7052 "build/generated/parser_bison.c"
+        break;
+
+    case YYSYMBOL_TEMPLATE_TAIL: /* TEMPLATE_TAIL  */
+#line 750 "build/generated/parser.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 7058 "build/generated/parser_bison.c"
+        break;
+
+    case YYSYMBOL_method_definition: /* method_definition  */
+#line 751 "build/generated/parser.y"
+            { method_info_free(((*yyvaluep).method)); }
+#line 7064 "build/generated/parser_bison.c"
+        break;
+
+    case YYSYMBOL_method_head: /* method_head  */
+#line 751 "build/generated/parser.y"
+            { method_info_free(((*yyvaluep).method)); }
+#line 7070 "build/generated/parser_bison.c"
+        break;
+
+    case YYSYMBOL_method_name: /* method_name  */
+#line 751 "build/generated/parser.y"
+            { method_info_free(((*yyvaluep).method)); }
+#line 7076 "build/generated/parser_bison.c"
+        break;
+
+      default:
+        break;
+    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+/** Number of symbols composing the right hand side of rule #RULE.  */
+static inline int
+yyrhsLength (yyRuleNum yyrule)
+{
+  return yyr2[yyrule];
+}
+
+static void
+yydestroyGLRState (char const *yymsg, yyGLRState *yys, JSParser *ctx)
+{
+  if (yys->yyresolved)
+    yydestruct (yymsg, yy_accessing_symbol (yys->yylrState),
+                &yys->yysemantics.yyval, ctx);
+  else
+    {
+#if YYDEBUG
+      if (yydebug)
+        {
+          if (yys->yysemantics.yyfirstVal)
+            YY_FPRINTF ((stderr, "%s unresolved", yymsg));
+          else
+            YY_FPRINTF ((stderr, "%s incomplete", yymsg));
+          YY_SYMBOL_PRINT ("", yy_accessing_symbol (yys->yylrState), YY_NULLPTR, &yys->yyloc);
+        }
+#endif
+
+      if (yys->yysemantics.yyfirstVal)
+        {
+          yySemanticOption *yyoption = yys->yysemantics.yyfirstVal;
+          yyGLRState *yyrh;
+          int yyn;
+          for (yyrh = yyoption->yystate, yyn = yyrhsLength (yyoption->yyrule);
+               yyn > 0;
+               yyrh = yyrh->yypred, yyn -= 1)
+            yydestroyGLRState (yymsg, yyrh, ctx);
+        }
+    }
+}
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+/** True iff LR state YYSTATE has only a default reduction (regardless
+ *  of token).  */
+static inline yybool
+yyisDefaultedState (yy_state_t yystate)
+{
+  return yypact_value_is_default (yypact[yystate]);
+}
+
+/** The default reduction for YYSTATE, assuming it has one.  */
+static inline yyRuleNum
+yydefaultAction (yy_state_t yystate)
+{
+  return yydefact[yystate];
+}
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/** The action to take in YYSTATE on seeing YYTOKEN.
+ *  Result R means
+ *    R < 0:  Reduce on rule -R.
+ *    R = 0:  Error.
+ *    R > 0:  Shift to state R.
+ *  Set *YYCONFLICTS to a pointer into yyconfl to a 0-terminated list
+ *  of conflicting reductions.
+ */
+static inline int
+yygetLRActions (yy_state_t yystate, yysymbol_kind_t yytoken, const short** yyconflicts)
+{
+  int yyindex = yypact[yystate] + yytoken;
+  if (yytoken == YYSYMBOL_YYerror)
+    {
+      // This is the error token.
+      *yyconflicts = yyconfl;
+      return 0;
+    }
+  else if (yyisDefaultedState (yystate)
+           || yyindex < 0 || YYLAST < yyindex || yycheck[yyindex] != yytoken)
+    {
+      *yyconflicts = yyconfl;
+      return -yydefact[yystate];
+    }
+  else if (! yytable_value_is_error (yytable[yyindex]))
+    {
+      *yyconflicts = yyconfl + yyconflp[yyindex];
+      return yytable[yyindex];
+    }
+  else
+    {
+      *yyconflicts = yyconfl + yyconflp[yyindex];
+      return 0;
+    }
+}
+
+/** Compute post-reduction state.
+ * \param yystate   the current state
+ * \param yysym     the nonterminal to push on the stack
+ */
+static inline yy_state_t
+yyLRgotoState (yy_state_t yystate, yysymbol_kind_t yysym)
+{
+  int yyr = yypgoto[yysym - YYNTOKENS] + yystate;
+  if (0 <= yyr && yyr <= YYLAST && yycheck[yyr] == yystate)
+    return yytable[yyr];
+  else
+    return yydefgoto[yysym - YYNTOKENS];
+}
+
+static inline yybool
+yyisShiftAction (int yyaction)
+{
+  return 0 < yyaction;
+}
+
+static inline yybool
+yyisErrorAction (int yyaction)
+{
+  return yyaction == 0;
+}
+
+                                /* GLRStates */
+
+/** Return a fresh GLRStackItem in YYSTACKP.  The item is an LR state
+ *  if YYISSTATE, and otherwise a semantic option.  Callers should call
+ *  YY_RESERVE_GLRSTACK afterwards to make sure there is sufficient
+ *  headroom.  */
+
+static inline yyGLRStackItem*
+yynewGLRStackItem (yyGLRStack* yystackp, yybool yyisState)
+{
+  yyGLRStackItem* yynewItem = yystackp->yynextFree;
+  yystackp->yyspaceLeft -= 1;
+  yystackp->yynextFree += 1;
+  yynewItem->yystate.yyisState = yyisState;
+  return yynewItem;
+}
+
+/** Add a new semantic action that will execute the action for rule
+ *  YYRULE on the semantic values in YYRHS to the list of
+ *  alternative actions for YYSTATE.  Assumes that YYRHS comes from
+ *  stack #YYK of *YYSTACKP. */
+static void
+yyaddDeferredAction (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyGLRState* yystate,
+                     yyGLRState* yyrhs, yyRuleNum yyrule)
+{
+  yySemanticOption* yynewOption =
+    &yynewGLRStackItem (yystackp, yyfalse)->yyoption;
+  YY_ASSERT (!yynewOption->yyisState);
+  yynewOption->yystate = yyrhs;
+  yynewOption->yyrule = yyrule;
+  if (yystackp->yytops.yylookaheadNeeds[yyk])
+    {
+      yynewOption->yyrawchar = yychar;
+      yynewOption->yyval = yylval;
+    }
+  else
+    yynewOption->yyrawchar = YYEMPTY;
+  yynewOption->yynext = yystate->yysemantics.yyfirstVal;
+  yystate->yysemantics.yyfirstVal = yynewOption;
+
+  YY_RESERVE_GLRSTACK (yystackp);
+}
+
+                                /* GLRStacks */
+
+/** Initialize YYSET to a singleton set containing an empty stack.  */
+static yybool
+yyinitStateSet (yyGLRStateSet* yyset)
+{
+  yyset->yysize = 1;
+  yyset->yycapacity = 16;
+  yyset->yystates
+    = YY_CAST (yyGLRState**,
+               YYMALLOC (YY_CAST (YYSIZE_T, yyset->yycapacity)
+                         * sizeof yyset->yystates[0]));
+  if (! yyset->yystates)
+    return yyfalse;
+  yyset->yystates[0] = YY_NULLPTR;
+  yyset->yylookaheadNeeds
+    = YY_CAST (yybool*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yyset->yycapacity)
+                         * sizeof yyset->yylookaheadNeeds[0]));
+  if (! yyset->yylookaheadNeeds)
+    {
+      YYFREE (yyset->yystates);
+      return yyfalse;
+    }
+  memset (yyset->yylookaheadNeeds,
+          0,
+          YY_CAST (YYSIZE_T, yyset->yycapacity) * sizeof yyset->yylookaheadNeeds[0]);
+  return yytrue;
+}
+
+static void yyfreeStateSet (yyGLRStateSet* yyset)
+{
+  YYFREE (yyset->yystates);
+  YYFREE (yyset->yylookaheadNeeds);
+}
+
+/** Initialize *YYSTACKP to a single empty stack, with total maximum
+ *  capacity for all stacks of YYSIZE.  */
+static yybool
+yyinitGLRStack (yyGLRStack* yystackp, YYPTRDIFF_T yysize)
+{
+  yystackp->yyerrState = 0;
+  yynerrs = 0;
+  yystackp->yyspaceLeft = yysize;
+  yystackp->yyitems
+    = YY_CAST (yyGLRStackItem*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yysize)
+                         * sizeof yystackp->yynextFree[0]));
+  if (!yystackp->yyitems)
+    return yyfalse;
+  yystackp->yynextFree = yystackp->yyitems;
+  yystackp->yysplitPoint = YY_NULLPTR;
+  yystackp->yylastDeleted = YY_NULLPTR;
+  return yyinitStateSet (&yystackp->yytops);
+}
+
+
+#if YYSTACKEXPANDABLE
+# define YYRELOC(YYFROMITEMS, YYTOITEMS, YYX, YYTYPE)                   \
+  &((YYTOITEMS)                                                         \
+    - ((YYFROMITEMS) - YY_REINTERPRET_CAST (yyGLRStackItem*, (YYX))))->YYTYPE
+
+/** If *YYSTACKP is expandable, extend it.  WARNING: Pointers into the
+    stack from outside should be considered invalid after this call.
+    We always expand when there are 1 or fewer items left AFTER an
+    allocation, so that we can avoid having external pointers exist
+    across an allocation.  */
+static void
+yyexpandGLRStack (yyGLRStack* yystackp)
+{
+  yyGLRStackItem* yynewItems;
+  yyGLRStackItem* yyp0, *yyp1;
+  YYPTRDIFF_T yynewSize;
+  YYPTRDIFF_T yyn;
+  YYPTRDIFF_T yysize = yystackp->yynextFree - yystackp->yyitems;
+  if (YYMAXDEPTH - YYHEADROOM < yysize)
+    yyMemoryExhausted (yystackp);
+  yynewSize = 2*yysize;
+  if (YYMAXDEPTH < yynewSize)
+    yynewSize = YYMAXDEPTH;
+  yynewItems
+    = YY_CAST (yyGLRStackItem*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yynewSize)
+                         * sizeof yynewItems[0]));
+  if (! yynewItems)
+    yyMemoryExhausted (yystackp);
+  for (yyp0 = yystackp->yyitems, yyp1 = yynewItems, yyn = yysize;
+       0 < yyn;
+       yyn -= 1, yyp0 += 1, yyp1 += 1)
+    {
+      *yyp1 = *yyp0;
+      if (*YY_REINTERPRET_CAST (yybool *, yyp0))
+        {
+          yyGLRState* yys0 = &yyp0->yystate;
+          yyGLRState* yys1 = &yyp1->yystate;
+          if (yys0->yypred != YY_NULLPTR)
+            yys1->yypred =
+              YYRELOC (yyp0, yyp1, yys0->yypred, yystate);
+          if (! yys0->yyresolved && yys0->yysemantics.yyfirstVal != YY_NULLPTR)
+            yys1->yysemantics.yyfirstVal =
+              YYRELOC (yyp0, yyp1, yys0->yysemantics.yyfirstVal, yyoption);
+        }
+      else
+        {
+          yySemanticOption* yyv0 = &yyp0->yyoption;
+          yySemanticOption* yyv1 = &yyp1->yyoption;
+          if (yyv0->yystate != YY_NULLPTR)
+            yyv1->yystate = YYRELOC (yyp0, yyp1, yyv0->yystate, yystate);
+          if (yyv0->yynext != YY_NULLPTR)
+            yyv1->yynext = YYRELOC (yyp0, yyp1, yyv0->yynext, yyoption);
+        }
+    }
+  if (yystackp->yysplitPoint != YY_NULLPTR)
+    yystackp->yysplitPoint = YYRELOC (yystackp->yyitems, yynewItems,
+                                      yystackp->yysplitPoint, yystate);
+
+  for (yyn = 0; yyn < yystackp->yytops.yysize; yyn += 1)
+    if (yystackp->yytops.yystates[yyn] != YY_NULLPTR)
+      yystackp->yytops.yystates[yyn] =
+        YYRELOC (yystackp->yyitems, yynewItems,
+                 yystackp->yytops.yystates[yyn], yystate);
+  YYFREE (yystackp->yyitems);
+  yystackp->yyitems = yynewItems;
+  yystackp->yynextFree = yynewItems + yysize;
+  yystackp->yyspaceLeft = yynewSize - yysize;
+}
+#endif
+
+static void
+yyfreeGLRStack (yyGLRStack* yystackp)
+{
+  YYFREE (yystackp->yyitems);
+  yyfreeStateSet (&yystackp->yytops);
+}
+
+/** Assuming that YYS is a GLRState somewhere on *YYSTACKP, update the
+ *  splitpoint of *YYSTACKP, if needed, so that it is at least as deep as
+ *  YYS.  */
+static inline void
+yyupdateSplit (yyGLRStack* yystackp, yyGLRState* yys)
+{
+  if (yystackp->yysplitPoint != YY_NULLPTR && yystackp->yysplitPoint > yys)
+    yystackp->yysplitPoint = yys;
+}
+
+/** Invalidate stack #YYK in *YYSTACKP.  */
+static inline void
+yymarkStackDeleted (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  if (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+    yystackp->yylastDeleted = yystackp->yytops.yystates[yyk];
+  yystackp->yytops.yystates[yyk] = YY_NULLPTR;
+}
+
+/** Undelete the last stack in *YYSTACKP that was marked as deleted.  Can
+    only be done once after a deletion, and only when all other stacks have
+    been deleted.  */
+static void
+yyundeleteLastStack (yyGLRStack* yystackp)
+{
+  if (yystackp->yylastDeleted == YY_NULLPTR || yystackp->yytops.yysize != 0)
+    return;
+  yystackp->yytops.yystates[0] = yystackp->yylastDeleted;
+  yystackp->yytops.yysize = 1;
+  YY_DPRINTF ((stderr, "Restoring last deleted stack as stack #0.\n"));
+  yystackp->yylastDeleted = YY_NULLPTR;
+}
+
+static inline void
+yyremoveDeletes (yyGLRStack* yystackp)
+{
+  YYPTRDIFF_T yyi, yyj;
+  yyi = yyj = 0;
+  while (yyj < yystackp->yytops.yysize)
+    {
+      if (yystackp->yytops.yystates[yyi] == YY_NULLPTR)
+        {
+          if (yyi == yyj)
+            YY_DPRINTF ((stderr, "Removing dead stacks.\n"));
+          yystackp->yytops.yysize -= 1;
+        }
+      else
+        {
+          yystackp->yytops.yystates[yyj] = yystackp->yytops.yystates[yyi];
+          /* In the current implementation, it's unnecessary to copy
+             yystackp->yytops.yylookaheadNeeds[yyi] since, after
+             yyremoveDeletes returns, the parser immediately either enters
+             deterministic operation or shifts a token.  However, it doesn't
+             hurt, and the code might evolve to need it.  */
+          yystackp->yytops.yylookaheadNeeds[yyj] =
+            yystackp->yytops.yylookaheadNeeds[yyi];
+          if (yyj != yyi)
+            YY_DPRINTF ((stderr, "Rename stack %ld -> %ld.\n",
+                        YY_CAST (long, yyi), YY_CAST (long, yyj)));
+          yyj += 1;
+        }
+      yyi += 1;
+    }
+}
+
+/** Shift to a new state on stack #YYK of *YYSTACKP, corresponding to LR
+ * state YYLRSTATE, at input position YYPOSN, with (resolved) semantic
+ * value *YYVALP and source location *YYLOCP.  */
+static inline void
+yyglrShift (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yy_state_t yylrState,
+            YYPTRDIFF_T yyposn,
+            YYSTYPE* yyvalp)
+{
+  yyGLRState* yynewState = &yynewGLRStackItem (yystackp, yytrue)->yystate;
+
+  yynewState->yylrState = yylrState;
+  yynewState->yyposn = yyposn;
+  yynewState->yyresolved = yytrue;
+  yynewState->yypred = yystackp->yytops.yystates[yyk];
+  yynewState->yysemantics.yyval = *yyvalp;
+  yystackp->yytops.yystates[yyk] = yynewState;
+
+  YY_RESERVE_GLRSTACK (yystackp);
+}
+
+/** Shift stack #YYK of *YYSTACKP, to a new state corresponding to LR
+ *  state YYLRSTATE, at input position YYPOSN, with the (unresolved)
+ *  semantic value of YYRHS under the action for YYRULE.  */
+static inline void
+yyglrShiftDefer (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yy_state_t yylrState,
+                 YYPTRDIFF_T yyposn, yyGLRState* yyrhs, yyRuleNum yyrule)
+{
+  yyGLRState* yynewState = &yynewGLRStackItem (yystackp, yytrue)->yystate;
+  YY_ASSERT (yynewState->yyisState);
+
+  yynewState->yylrState = yylrState;
+  yynewState->yyposn = yyposn;
+  yynewState->yyresolved = yyfalse;
+  yynewState->yypred = yystackp->yytops.yystates[yyk];
+  yynewState->yysemantics.yyfirstVal = YY_NULLPTR;
+  yystackp->yytops.yystates[yyk] = yynewState;
+
+  /* Invokes YY_RESERVE_GLRSTACK.  */
+  yyaddDeferredAction (yystackp, yyk, yynewState, yyrhs, yyrule);
+}
+
+#if YYDEBUG
+
+/*----------------------------------------------------------------------.
+| Report that stack #YYK of *YYSTACKP is going to be reduced by YYRULE. |
+`----------------------------------------------------------------------*/
+
+static inline void
+yy_reduce_print (yybool yynormal, yyGLRStackItem* yyvsp, YYPTRDIFF_T yyk,
+                 yyRuleNum yyrule, JSParser *ctx)
+{
+  int yynrhs = yyrhsLength (yyrule);
+  int yyi;
+  YY_FPRINTF ((stderr, "Reducing stack %ld by rule %d (line %d):\n",
+               YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule]));
+  if (! yynormal)
+    yyfillin (yyvsp, 1, -yynrhs);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YY_FPRINTF ((stderr, "   $%d = ", yyi + 1));
+      yy_symbol_print (stderr,
+                       yy_accessing_symbol (yyvsp[yyi - yynrhs + 1].yystate.yylrState),
+                       &yyvsp[yyi - yynrhs + 1].yystate.yysemantics.yyval                       , ctx);
+      if (!yyvsp[yyi - yynrhs + 1].yystate.yyresolved)
+        YY_FPRINTF ((stderr, " (unresolved)"));
+      YY_FPRINTF ((stderr, "\n"));
+    }
+}
+#endif
+
+/** Pop the symbols consumed by reduction #YYRULE from the top of stack
+ *  #YYK of *YYSTACKP, and perform the appropriate semantic action on their
+ *  semantic values.  Assumes that all ambiguities in semantic values
+ *  have been previously resolved.  Set *YYVALP to the resulting value,
+ *  and *YYLOCP to the computed location (if any).  Return value is as
+ *  for userAction.  */
+static inline YYRESULTTAG
+yydoAction (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyRuleNum yyrule,
+            YYSTYPE* yyvalp, JSParser *ctx)
+{
+  int yynrhs = yyrhsLength (yyrule);
+
+  if (yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      /* Standard special case: single stack.  */
+      yyGLRStackItem* yyrhs
+        = YY_REINTERPRET_CAST (yyGLRStackItem*, yystackp->yytops.yystates[yyk]);
+      YY_ASSERT (yyk == 0);
+      yystackp->yynextFree -= yynrhs;
+      yystackp->yyspaceLeft += yynrhs;
+      yystackp->yytops.yystates[0] = & yystackp->yynextFree[-1].yystate;
+      return yyuserAction (yyrule, yynrhs, yyrhs, yystackp, yyk,
+                           yyvalp, ctx);
+    }
+  else
+    {
+      yyGLRStackItem yyrhsVals[YYMAXRHS + YYMAXLEFT + 1];
+      yyGLRState* yys = yyrhsVals[YYMAXRHS + YYMAXLEFT].yystate.yypred
+        = yystackp->yytops.yystates[yyk];
+      int yyi;
+      for (yyi = 0; yyi < yynrhs; yyi += 1)
+        {
+          yys = yys->yypred;
+          YY_ASSERT (yys);
+        }
+      yyupdateSplit (yystackp, yys);
+      yystackp->yytops.yystates[yyk] = yys;
+      return yyuserAction (yyrule, yynrhs, yyrhsVals + YYMAXRHS + YYMAXLEFT - 1,
+                           yystackp, yyk, yyvalp, ctx);
+    }
+}
+
+/** Pop items off stack #YYK of *YYSTACKP according to grammar rule YYRULE,
+ *  and push back on the resulting nonterminal symbol.  Perform the
+ *  semantic action associated with YYRULE and store its value with the
+ *  newly pushed state, if YYFORCEEVAL or if *YYSTACKP is currently
+ *  unambiguous.  Otherwise, store the deferred semantic action with
+ *  the new state.  If the new state would have an identical input
+ *  position, LR state, and predecessor to an existing state on the stack,
+ *  it is identified with that existing state, eliminating stack #YYK from
+ *  *YYSTACKP.  In this case, the semantic value is
+ *  added to the options for the existing state's semantic value.
+ */
+static inline YYRESULTTAG
+yyglrReduce (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyRuleNum yyrule,
+             yybool yyforceEval, JSParser *ctx)
+{
+  YYPTRDIFF_T yyposn = yystackp->yytops.yystates[yyk]->yyposn;
+
+  if (yyforceEval || yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      YYSTYPE yyval;
+
+      YYRESULTTAG yyflag = yydoAction (yystackp, yyk, yyrule, &yyval, ctx);
+      if (yyflag == yyerr && yystackp->yysplitPoint != YY_NULLPTR)
+        YY_DPRINTF ((stderr,
+                     "Parse on stack %ld rejected by rule %d (line %d).\n",
+                     YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule]));
+      if (yyflag != yyok)
+        return yyflag;
+      yyglrShift (yystackp, yyk,
+                  yyLRgotoState (yystackp->yytops.yystates[yyk]->yylrState,
+                                 yylhsNonterm (yyrule)),
+                  yyposn, &yyval);
+    }
+  else
+    {
+      YYPTRDIFF_T yyi;
+      int yyn;
+      yyGLRState* yys, *yys0 = yystackp->yytops.yystates[yyk];
+      yy_state_t yynewLRState;
+
+      for (yys = yystackp->yytops.yystates[yyk], yyn = yyrhsLength (yyrule);
+           0 < yyn; yyn -= 1)
+        {
+          yys = yys->yypred;
+          YY_ASSERT (yys);
+        }
+      yyupdateSplit (yystackp, yys);
+      yynewLRState = yyLRgotoState (yys->yylrState, yylhsNonterm (yyrule));
+      YY_DPRINTF ((stderr,
+                   "Reduced stack %ld by rule %d (line %d); action deferred.  "
+                   "Now in state %d.\n",
+                   YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule],
+                   yynewLRState));
+      for (yyi = 0; yyi < yystackp->yytops.yysize; yyi += 1)
+        if (yyi != yyk && yystackp->yytops.yystates[yyi] != YY_NULLPTR)
+          {
+            yyGLRState *yysplit = yystackp->yysplitPoint;
+            yyGLRState *yyp = yystackp->yytops.yystates[yyi];
+            while (yyp != yys && yyp != yysplit && yyp->yyposn >= yyposn)
+              {
+                if (yyp->yylrState == yynewLRState && yyp->yypred == yys)
+                  {
+                    yyaddDeferredAction (yystackp, yyk, yyp, yys0, yyrule);
+                    yymarkStackDeleted (yystackp, yyk);
+                    YY_DPRINTF ((stderr, "Merging stack %ld into stack %ld.\n",
+                                 YY_CAST (long, yyk), YY_CAST (long, yyi)));
+                    return yyok;
+                  }
+                yyp = yyp->yypred;
+              }
+          }
+      yystackp->yytops.yystates[yyk] = yys;
+      yyglrShiftDefer (yystackp, yyk, yynewLRState, yyposn, yys0, yyrule);
+    }
+  return yyok;
+}
+
+static YYPTRDIFF_T
+yysplitStack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  if (yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      YY_ASSERT (yyk == 0);
+      yystackp->yysplitPoint = yystackp->yytops.yystates[yyk];
+    }
+  if (yystackp->yytops.yycapacity <= yystackp->yytops.yysize)
+    {
+      YYPTRDIFF_T state_size = YYSIZEOF (yystackp->yytops.yystates[0]);
+      YYPTRDIFF_T half_max_capacity = YYSIZE_MAXIMUM / 2 / state_size;
+      if (half_max_capacity < yystackp->yytops.yycapacity)
+        yyMemoryExhausted (yystackp);
+      yystackp->yytops.yycapacity *= 2;
+
+      {
+        yyGLRState** yynewStates
+          = YY_CAST (yyGLRState**,
+                     YYREALLOC (yystackp->yytops.yystates,
+                                (YY_CAST (YYSIZE_T, yystackp->yytops.yycapacity)
+                                 * sizeof yynewStates[0])));
+        if (yynewStates == YY_NULLPTR)
+          yyMemoryExhausted (yystackp);
+        yystackp->yytops.yystates = yynewStates;
+      }
+
+      {
+        yybool* yynewLookaheadNeeds
+          = YY_CAST (yybool*,
+                     YYREALLOC (yystackp->yytops.yylookaheadNeeds,
+                                (YY_CAST (YYSIZE_T, yystackp->yytops.yycapacity)
+                                 * sizeof yynewLookaheadNeeds[0])));
+        if (yynewLookaheadNeeds == YY_NULLPTR)
+          yyMemoryExhausted (yystackp);
+        yystackp->yytops.yylookaheadNeeds = yynewLookaheadNeeds;
+      }
+    }
+  yystackp->yytops.yystates[yystackp->yytops.yysize]
+    = yystackp->yytops.yystates[yyk];
+  yystackp->yytops.yylookaheadNeeds[yystackp->yytops.yysize]
+    = yystackp->yytops.yylookaheadNeeds[yyk];
+  yystackp->yytops.yysize += 1;
+  return yystackp->yytops.yysize - 1;
+}
+
+/** True iff YYY0 and YYY1 represent identical options at the top level.
+ *  That is, they represent the same rule applied to RHS symbols
+ *  that produce the same terminal symbols.  */
+static yybool
+yyidenticalOptions (yySemanticOption* yyy0, yySemanticOption* yyy1)
+{
+  if (yyy0->yyrule == yyy1->yyrule)
+    {
+      yyGLRState *yys0, *yys1;
+      int yyn;
+      for (yys0 = yyy0->yystate, yys1 = yyy1->yystate,
+           yyn = yyrhsLength (yyy0->yyrule);
+           yyn > 0;
+           yys0 = yys0->yypred, yys1 = yys1->yypred, yyn -= 1)
+        if (yys0->yyposn != yys1->yyposn)
+          return yyfalse;
+      return yytrue;
+    }
+  else
+    return yyfalse;
+}
+
+/** Assuming identicalOptions (YYY0,YYY1), destructively merge the
+ *  alternative semantic values for the RHS-symbols of YYY1 and YYY0.  */
+static void
+yymergeOptionSets (yySemanticOption* yyy0, yySemanticOption* yyy1)
+{
+  yyGLRState *yys0, *yys1;
+  int yyn;
+  for (yys0 = yyy0->yystate, yys1 = yyy1->yystate,
+       yyn = yyrhsLength (yyy0->yyrule);
+       0 < yyn;
+       yys0 = yys0->yypred, yys1 = yys1->yypred, yyn -= 1)
+    {
+      if (yys0 == yys1)
+        break;
+      else if (yys0->yyresolved)
+        {
+          yys1->yyresolved = yytrue;
+          yys1->yysemantics.yyval = yys0->yysemantics.yyval;
+        }
+      else if (yys1->yyresolved)
+        {
+          yys0->yyresolved = yytrue;
+          yys0->yysemantics.yyval = yys1->yysemantics.yyval;
+        }
+      else
+        {
+          yySemanticOption** yyz0p = &yys0->yysemantics.yyfirstVal;
+          yySemanticOption* yyz1 = yys1->yysemantics.yyfirstVal;
+          while (yytrue)
+            {
+              if (yyz1 == *yyz0p || yyz1 == YY_NULLPTR)
+                break;
+              else if (*yyz0p == YY_NULLPTR)
+                {
+                  *yyz0p = yyz1;
+                  break;
+                }
+              else if (*yyz0p < yyz1)
+                {
+                  yySemanticOption* yyz = *yyz0p;
+                  *yyz0p = yyz1;
+                  yyz1 = yyz1->yynext;
+                  (*yyz0p)->yynext = yyz;
+                }
+              yyz0p = &(*yyz0p)->yynext;
+            }
+          yys1->yysemantics.yyfirstVal = yys0->yysemantics.yyfirstVal;
+        }
+    }
+}
+
+/** Y0 and Y1 represent two possible actions to take in a given
+ *  parsing state; return 0 if no combination is possible,
+ *  1 if user-mergeable, 2 if Y0 is preferred, 3 if Y1 is preferred.  */
+static int
+yypreference (yySemanticOption* y0, yySemanticOption* y1)
+{
+  yyRuleNum r0 = y0->yyrule, r1 = y1->yyrule;
+  int p0 = yydprec[r0], p1 = yydprec[r1];
+
+  if (p0 == p1)
+    {
+      if (yymerger[r0] == 0 || yymerger[r0] != yymerger[r1])
+        return 0;
+      else
+        return 1;
+    }
+  if (p0 == 0 || p1 == 0)
+    return 0;
+  if (p0 < p1)
+    return 3;
+  if (p1 < p0)
+    return 2;
+  return 0;
+}
+
+static YYRESULTTAG
+yyresolveValue (yyGLRState* yys, yyGLRStack* yystackp, JSParser *ctx);
+
+
+/** Resolve the previous YYN states starting at and including state YYS
+ *  on *YYSTACKP. If result != yyok, some states may have been left
+ *  unresolved possibly with empty semantic option chains.  Regardless
+ *  of whether result = yyok, each state has been left with consistent
+ *  data so that yydestroyGLRState can be invoked if necessary.  */
+static YYRESULTTAG
+yyresolveStates (yyGLRState* yys, int yyn,
+                 yyGLRStack* yystackp, JSParser *ctx)
+{
+  if (0 < yyn)
+    {
+      YY_ASSERT (yys->yypred);
+      YYCHK (yyresolveStates (yys->yypred, yyn-1, yystackp, ctx));
+      if (! yys->yyresolved)
+        YYCHK (yyresolveValue (yys, yystackp, ctx));
+    }
+  return yyok;
+}
+
+/** Resolve the states for the RHS of YYOPT on *YYSTACKP, perform its
+ *  user action, and return the semantic value and location in *YYVALP
+ *  and *YYLOCP.  Regardless of whether result = yyok, all RHS states
+ *  have been destroyed (assuming the user action destroys all RHS
+ *  semantic values if invoked).  */
+static YYRESULTTAG
+yyresolveAction (yySemanticOption* yyopt, yyGLRStack* yystackp,
+                 YYSTYPE* yyvalp, JSParser *ctx)
+{
+  yyGLRStackItem yyrhsVals[YYMAXRHS + YYMAXLEFT + 1];
+  int yynrhs = yyrhsLength (yyopt->yyrule);
+  YYRESULTTAG yyflag =
+    yyresolveStates (yyopt->yystate, yynrhs, yystackp, ctx);
+  if (yyflag != yyok)
+    {
+      yyGLRState *yys;
+      for (yys = yyopt->yystate; yynrhs > 0; yys = yys->yypred, yynrhs -= 1)
+        yydestroyGLRState ("Cleanup: popping", yys, ctx);
+      return yyflag;
+    }
+
+  yyrhsVals[YYMAXRHS + YYMAXLEFT].yystate.yypred = yyopt->yystate;
+  {
+    int yychar_current = yychar;
+    YYSTYPE yylval_current = yylval;
+    yychar = yyopt->yyrawchar;
+    yylval = yyopt->yyval;
+    yyflag = yyuserAction (yyopt->yyrule, yynrhs,
+                           yyrhsVals + YYMAXRHS + YYMAXLEFT - 1,
+                           yystackp, -1, yyvalp, ctx);
+    yychar = yychar_current;
+    yylval = yylval_current;
+  }
+  return yyflag;
+}
+
+#if YYDEBUG
+static void
+yyreportTree (yySemanticOption* yyx, int yyindent)
+{
+  int yynrhs = yyrhsLength (yyx->yyrule);
+  int yyi;
+  yyGLRState* yys;
+  yyGLRState* yystates[1 + YYMAXRHS];
+  yyGLRState yyleftmost_state;
+
+  for (yyi = yynrhs, yys = yyx->yystate; 0 < yyi; yyi -= 1, yys = yys->yypred)
+    yystates[yyi] = yys;
+  if (yys == YY_NULLPTR)
+    {
+      yyleftmost_state.yyposn = 0;
+      yystates[0] = &yyleftmost_state;
+    }
+  else
+    yystates[0] = yys;
+
+  if (yyx->yystate->yyposn < yys->yyposn + 1)
+    YY_FPRINTF ((stderr, "%*s%s -> <Rule %d, empty>\n",
+                 yyindent, "", yysymbol_name (yylhsNonterm (yyx->yyrule)),
+                 yyx->yyrule - 1));
+  else
+    YY_FPRINTF ((stderr, "%*s%s -> <Rule %d, tokens %ld .. %ld>\n",
+                 yyindent, "", yysymbol_name (yylhsNonterm (yyx->yyrule)),
+                 yyx->yyrule - 1, YY_CAST (long, yys->yyposn + 1),
+                 YY_CAST (long, yyx->yystate->yyposn)));
+  for (yyi = 1; yyi <= yynrhs; yyi += 1)
+    {
+      if (yystates[yyi]->yyresolved)
+        {
+          if (yystates[yyi-1]->yyposn+1 > yystates[yyi]->yyposn)
+            YY_FPRINTF ((stderr, "%*s%s <empty>\n", yyindent+2, "",
+                         yysymbol_name (yy_accessing_symbol (yystates[yyi]->yylrState))));
+          else
+            YY_FPRINTF ((stderr, "%*s%s <tokens %ld .. %ld>\n", yyindent+2, "",
+                         yysymbol_name (yy_accessing_symbol (yystates[yyi]->yylrState)),
+                         YY_CAST (long, yystates[yyi-1]->yyposn + 1),
+                         YY_CAST (long, yystates[yyi]->yyposn)));
+        }
+      else
+        yyreportTree (yystates[yyi]->yysemantics.yyfirstVal, yyindent+2);
+    }
+}
+#endif
+
+static YYRESULTTAG
+yyreportAmbiguity (yySemanticOption* yyx0,
+                   yySemanticOption* yyx1, JSParser *ctx)
+{
+  YY_USE (yyx0);
+  YY_USE (yyx1);
+
+#if YYDEBUG
+  YY_FPRINTF ((stderr, "Ambiguity detected.\n"));
+  YY_FPRINTF ((stderr, "Option 1,\n"));
+  yyreportTree (yyx0, 2);
+  YY_FPRINTF ((stderr, "\nOption 2,\n"));
+  yyreportTree (yyx1, 2);
+  YY_FPRINTF ((stderr, "\n"));
+#endif
+
+  yyerror (ctx, YY_("syntax is ambiguous"));
+  return yyabort;
+}
+
+/** Resolve the ambiguity represented in state YYS in *YYSTACKP,
+ *  perform the indicated actions, and set the semantic value of YYS.
+ *  If result != yyok, the chain of semantic options in YYS has been
+ *  cleared instead or it has been left unmodified except that
+ *  redundant options may have been removed.  Regardless of whether
+ *  result = yyok, YYS has been left with consistent data so that
+ *  yydestroyGLRState can be invoked if necessary.  */
+static YYRESULTTAG
+yyresolveValue (yyGLRState* yys, yyGLRStack* yystackp, JSParser *ctx)
+{
+  yySemanticOption* yyoptionList = yys->yysemantics.yyfirstVal;
+  yySemanticOption* yybest = yyoptionList;
+  yySemanticOption** yypp;
+  yybool yymerge = yyfalse;
+  YYSTYPE yyval;
+  YYRESULTTAG yyflag;
+
+  for (yypp = &yyoptionList->yynext; *yypp != YY_NULLPTR; )
+    {
+      yySemanticOption* yyp = *yypp;
+
+      if (yyidenticalOptions (yybest, yyp))
+        {
+          yymergeOptionSets (yybest, yyp);
+          *yypp = yyp->yynext;
+        }
+      else
+        {
+          switch (yypreference (yybest, yyp))
+            {
+            case 0:
+              return yyreportAmbiguity (yybest, yyp, ctx);
+              break;
+            case 1:
+              yymerge = yytrue;
+              break;
+            case 2:
+              break;
+            case 3:
+              yybest = yyp;
+              yymerge = yyfalse;
+              break;
+            default:
+              /* This cannot happen so it is not worth a YY_ASSERT (yyfalse),
+                 but some compilers complain if the default case is
+                 omitted.  */
+              break;
+            }
+          yypp = &yyp->yynext;
+        }
+    }
+
+  if (yymerge)
+    {
+      yySemanticOption* yyp;
+      int yyprec = yydprec[yybest->yyrule];
+      yyflag = yyresolveAction (yybest, yystackp, &yyval, ctx);
+      if (yyflag == yyok)
+        for (yyp = yybest->yynext; yyp != YY_NULLPTR; yyp = yyp->yynext)
+          {
+            if (yyprec == yydprec[yyp->yyrule])
+              {
+                YYSTYPE yyval_other;
+                yyflag = yyresolveAction (yyp, yystackp, &yyval_other, ctx);
+                if (yyflag != yyok)
+                  {
+                    yydestruct ("Cleanup: discarding incompletely merged value for",
+                                yy_accessing_symbol (yys->yylrState),
+                                &yyval, ctx);
+                    break;
+                  }
+                yyuserMerge (yymerger[yyp->yyrule], &yyval, &yyval_other);
+              }
+          }
+    }
+  else
+    yyflag = yyresolveAction (yybest, yystackp, &yyval, ctx);
+
+  if (yyflag == yyok)
+    {
+      yys->yyresolved = yytrue;
+      yys->yysemantics.yyval = yyval;
+    }
+  else
+    yys->yysemantics.yyfirstVal = YY_NULLPTR;
+  return yyflag;
+}
+
+static YYRESULTTAG
+yyresolveStack (yyGLRStack* yystackp, JSParser *ctx)
+{
+  if (yystackp->yysplitPoint != YY_NULLPTR)
+    {
+      yyGLRState* yys;
+      int yyn;
+
+      for (yyn = 0, yys = yystackp->yytops.yystates[0];
+           yys != yystackp->yysplitPoint;
+           yys = yys->yypred, yyn += 1)
+        continue;
+      YYCHK (yyresolveStates (yystackp->yytops.yystates[0], yyn, yystackp
+                             , ctx));
+    }
+  return yyok;
+}
+
+/** Called when returning to deterministic operation to clean up the extra
+ * stacks. */
+static void
+yycompressStack (yyGLRStack* yystackp)
+{
+  /* yyr is the state after the split point.  */
+  yyGLRState *yyr;
+
+  if (yystackp->yytops.yysize != 1 || yystackp->yysplitPoint == YY_NULLPTR)
+    return;
+
+  {
+    yyGLRState *yyp, *yyq;
+    for (yyp = yystackp->yytops.yystates[0], yyq = yyp->yypred, yyr = YY_NULLPTR;
+         yyp != yystackp->yysplitPoint;
+         yyr = yyp, yyp = yyq, yyq = yyp->yypred)
+      yyp->yypred = yyr;
+  }
+
+  yystackp->yyspaceLeft += yystackp->yynextFree - yystackp->yyitems;
+  yystackp->yynextFree = YY_REINTERPRET_CAST (yyGLRStackItem*, yystackp->yysplitPoint) + 1;
+  yystackp->yyspaceLeft -= yystackp->yynextFree - yystackp->yyitems;
+  yystackp->yysplitPoint = YY_NULLPTR;
+  yystackp->yylastDeleted = YY_NULLPTR;
+
+  while (yyr != YY_NULLPTR)
+    {
+      yystackp->yynextFree->yystate = *yyr;
+      yyr = yyr->yypred;
+      yystackp->yynextFree->yystate.yypred = &yystackp->yynextFree[-1].yystate;
+      yystackp->yytops.yystates[0] = &yystackp->yynextFree->yystate;
+      yystackp->yynextFree += 1;
+      yystackp->yyspaceLeft -= 1;
+    }
+}
+
+static YYRESULTTAG
+yyprocessOneStack (yyGLRStack* yystackp, YYPTRDIFF_T yyk,
+                   YYPTRDIFF_T yyposn, JSParser *ctx)
+{
+  while (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+    {
+      yy_state_t yystate = yystackp->yytops.yystates[yyk]->yylrState;
+      YY_DPRINTF ((stderr, "Stack %ld Entering state %d\n",
+                   YY_CAST (long, yyk), yystate));
+
+      YY_ASSERT (yystate != YYFINAL);
+
+      if (yyisDefaultedState (yystate))
+        {
+          YYRESULTTAG yyflag;
+          yyRuleNum yyrule = yydefaultAction (yystate);
+          if (yyrule == 0)
+            {
+              YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              return yyok;
+            }
+          yyflag = yyglrReduce (yystackp, yyk, yyrule, yyimmediate[yyrule], ctx);
+          if (yyflag == yyerr)
+            {
+              YY_DPRINTF ((stderr,
+                           "Stack %ld dies "
+                           "(predicate failure or explicit user error).\n",
+                           YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              return yyok;
+            }
+          if (yyflag != yyok)
+            return yyflag;
+        }
+      else
+        {
+          yysymbol_kind_t yytoken = yygetToken (&yychar, yystackp, ctx);
+          const short* yyconflicts;
+          const int yyaction = yygetLRActions (yystate, yytoken, &yyconflicts);
+          yystackp->yytops.yylookaheadNeeds[yyk] = yytrue;
+
+          for (/* nothing */; *yyconflicts; yyconflicts += 1)
+            {
+              YYRESULTTAG yyflag;
+              YYPTRDIFF_T yynewStack = yysplitStack (yystackp, yyk);
+              YY_DPRINTF ((stderr, "Splitting off stack %ld from %ld.\n",
+                           YY_CAST (long, yynewStack), YY_CAST (long, yyk)));
+              yyflag = yyglrReduce (yystackp, yynewStack,
+                                    *yyconflicts,
+                                    yyimmediate[*yyconflicts], ctx);
+              if (yyflag == yyok)
+                YYCHK (yyprocessOneStack (yystackp, yynewStack,
+                                          yyposn, ctx));
+              else if (yyflag == yyerr)
+                {
+                  YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yynewStack)));
+                  yymarkStackDeleted (yystackp, yynewStack);
+                }
+              else
+                return yyflag;
+            }
+
+          if (yyisShiftAction (yyaction))
+            break;
+          else if (yyisErrorAction (yyaction))
+            {
+              YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              break;
+            }
+          else
+            {
+              YYRESULTTAG yyflag = yyglrReduce (yystackp, yyk, -yyaction,
+                                                yyimmediate[-yyaction], ctx);
+              if (yyflag == yyerr)
+                {
+                  YY_DPRINTF ((stderr,
+                               "Stack %ld dies "
+                               "(predicate failure or explicit user error).\n",
+                               YY_CAST (long, yyk)));
+                  yymarkStackDeleted (yystackp, yyk);
+                  break;
+                }
+              else if (yyflag != yyok)
+                return yyflag;
+            }
+        }
+    }
+  return yyok;
+}
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYSTACKP, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  */
+static int
+yypcontext_expected_tokens (const yyGLRStack* yystackp,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[yystackp->yytops.yystates[0]->yylrState];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+static int
+yy_syntax_error_arguments (const yyGLRStack* yystackp,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  yysymbol_kind_t yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yystackp,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+
+
+static void
+yyreportSyntaxError (yyGLRStack* yystackp, JSParser *ctx)
+{
+  if (yystackp->yyerrState != 0)
+    return;
+  {
+  yybool yysize_overflow = yyfalse;
+  char* yymsg = YY_NULLPTR;
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount
+    = yy_syntax_error_arguments (yystackp, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    yyMemoryExhausted (yystackp);
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                   \
+      case N:                           \
+        yyformat = S;                   \
+      break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysz
+          = yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (YYSIZE_MAXIMUM - yysize < yysz)
+          yysize_overflow = yytrue;
+        else
+          yysize += yysz;
+      }
+  }
+
+  if (!yysize_overflow)
+    yymsg = YY_CAST (char *, YYMALLOC (YY_CAST (YYSIZE_T, yysize)));
+
+  if (yymsg)
+    {
+      char *yyp = yymsg;
+      int yyi = 0;
+      while ((*yyp = *yyformat))
+        {
+          if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+            {
+              yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+              yyformat += 2;
+            }
+          else
+            {
+              ++yyp;
+              ++yyformat;
+            }
+        }
+      yyerror (ctx, yymsg);
+      YYFREE (yymsg);
+    }
+  else
+    {
+      yyerror (ctx, YY_("syntax error"));
+      yyMemoryExhausted (yystackp);
+    }
+  }
+  yynerrs += 1;
+}
+
+/* Recover from a syntax error on *YYSTACKP, assuming that *YYSTACKP->YYTOKENP,
+   yylval, and yylloc are the syntactic category, semantic value, and location
+   of the lookahead.  */
+static void
+yyrecoverSyntaxError (yyGLRStack* yystackp, JSParser *ctx)
+{
+  if (yystackp->yyerrState == 3)
+    /* We just shifted the error token and (perhaps) took some
+       reductions.  Skip tokens until we can proceed.  */
+    while (yytrue)
+      {
+        yysymbol_kind_t yytoken;
+        int yyj;
+        if (yychar == YYEOF)
+          yyFail (yystackp, ctx, YY_NULLPTR);
+        if (yychar != YYEMPTY)
+          {
+            yytoken = YYTRANSLATE (yychar);
+            yydestruct ("Error: discarding",
+                        yytoken, &yylval, ctx);
+            yychar = YYEMPTY;
+          }
+        yytoken = yygetToken (&yychar, yystackp, ctx);
+        yyj = yypact[yystackp->yytops.yystates[0]->yylrState];
+        if (yypact_value_is_default (yyj))
+          return;
+        yyj += yytoken;
+        if (yyj < 0 || YYLAST < yyj || yycheck[yyj] != yytoken)
+          {
+            if (yydefact[yystackp->yytops.yystates[0]->yylrState] != 0)
+              return;
+          }
+        else if (! yytable_value_is_error (yytable[yyj]))
+          return;
+      }
+
+  /* Reduce to one stack.  */
+  {
+    YYPTRDIFF_T yyk;
+    for (yyk = 0; yyk < yystackp->yytops.yysize; yyk += 1)
+      if (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+        break;
+    if (yyk >= yystackp->yytops.yysize)
+      yyFail (yystackp, ctx, YY_NULLPTR);
+    for (yyk += 1; yyk < yystackp->yytops.yysize; yyk += 1)
+      yymarkStackDeleted (yystackp, yyk);
+    yyremoveDeletes (yystackp);
+    yycompressStack (yystackp);
+  }
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  yystackp->yyerrState = 3;
+  while (yystackp->yytops.yystates[0] != YY_NULLPTR)
+    {
+      yyGLRState *yys = yystackp->yytops.yystates[0];
+      int yyj = yypact[yys->yylrState];
+      if (! yypact_value_is_default (yyj))
+        {
+          yyj += YYSYMBOL_YYerror;
+          if (0 <= yyj && yyj <= YYLAST && yycheck[yyj] == YYSYMBOL_YYerror
+              && yyisShiftAction (yytable[yyj]))
+            {
+              /* Shift the error token.  */
+              int yyaction = yytable[yyj];
+              YY_SYMBOL_PRINT ("Shifting", yy_accessing_symbol (yyaction),
+                               &yylval, &yyerrloc);
+              yyglrShift (yystackp, 0, yyaction,
+                          yys->yyposn, &yylval);
+              yys = yystackp->yytops.yystates[0];
+              break;
+            }
+        }
+      if (yys->yypred != YY_NULLPTR)
+        yydestroyGLRState ("Error: popping", yys, ctx);
+      yystackp->yytops.yystates[0] = yys->yypred;
+      yystackp->yynextFree -= 1;
+      yystackp->yyspaceLeft += 1;
+    }
+  if (yystackp->yytops.yystates[0] == YY_NULLPTR)
+    yyFail (yystackp, ctx, YY_NULLPTR);
+}
+
+#define YYCHK1(YYE)                             \
+  do {                                          \
+    switch (YYE) {                              \
+    case yyok:     break;                       \
+    case yyabort:  goto yyabortlab;             \
+    case yyaccept: goto yyacceptlab;            \
+    case yyerr:    goto yyuser_error;           \
+    case yynomem:  goto yyexhaustedlab;         \
+    default:       goto yybuglab;               \
+    }                                           \
+  } while (0)
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (JSParser *ctx)
+{
+  int yyresult;
+  yyGLRStack yystack;
+  yyGLRStack* const yystackp = &yystack;
+  YYPTRDIFF_T yyposn;
+
+  YY_DPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY;
+  yylval = yyval_default;
+
+  if (! yyinitGLRStack (yystackp, YYINITDEPTH))
+    goto yyexhaustedlab;
+  switch (YYSETJMP (yystack.yyexception_buffer))
+    {
+    case 0: break;
+    case 1: goto yyabortlab;
+    case 2: goto yyexhaustedlab;
+    default: goto yybuglab;
+    }
+  yyglrShift (&yystack, 0, 0, 0, &yylval);
+  yyposn = 0;
+
+  while (yytrue)
+    {
+      /* For efficiency, we have two loops, the first of which is
+         specialized to deterministic operation (single stack, no
+         potential ambiguity).  */
+      /* Standard mode. */
+      while (yytrue)
+        {
+          yy_state_t yystate = yystack.yytops.yystates[0]->yylrState;
+          YY_DPRINTF ((stderr, "Entering state %d\n", yystate));
+          if (yystate == YYFINAL)
+            goto yyacceptlab;
+          if (yyisDefaultedState (yystate))
+            {
+              yyRuleNum yyrule = yydefaultAction (yystate);
+              if (yyrule == 0)
+                {
+                  yyreportSyntaxError (&yystack, ctx);
+                  goto yyuser_error;
+                }
+              YYCHK1 (yyglrReduce (&yystack, 0, yyrule, yytrue, ctx));
+            }
+          else
+            {
+              yysymbol_kind_t yytoken = yygetToken (&yychar, yystackp, ctx);
+              const short* yyconflicts;
+              int yyaction = yygetLRActions (yystate, yytoken, &yyconflicts);
+              if (*yyconflicts)
+                /* Enter nondeterministic mode.  */
+                break;
+              if (yyisShiftAction (yyaction))
+                {
+                  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+                  yychar = YYEMPTY;
+                  yyposn += 1;
+                  yyglrShift (&yystack, 0, yyaction, yyposn, &yylval);
+                  if (0 < yystack.yyerrState)
+                    yystack.yyerrState -= 1;
+                }
+              else if (yyisErrorAction (yyaction))
+                {
+                  /* Issue an error message unless the scanner already
+                     did. */
+                  if (yychar != YYerror)
+                    yyreportSyntaxError (&yystack, ctx);
+                  goto yyuser_error;
+                }
+              else
+                YYCHK1 (yyglrReduce (&yystack, 0, -yyaction, yytrue, ctx));
+            }
+        }
+
+      /* Nondeterministic mode. */
+      while (yytrue)
+        {
+          yysymbol_kind_t yytoken_to_shift;
+          YYPTRDIFF_T yys;
+
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            yystackp->yytops.yylookaheadNeeds[yys] = yychar != YYEMPTY;
+
+          /* yyprocessOneStack returns one of three things:
+
+              - An error flag.  If the caller is yyprocessOneStack, it
+                immediately returns as well.  When the caller is finally
+                yyparse, it jumps to an error label via YYCHK1.
+
+              - yyok, but yyprocessOneStack has invoked yymarkStackDeleted
+                (&yystack, yys), which sets the top state of yys to NULL.  Thus,
+                yyparse's following invocation of yyremoveDeletes will remove
+                the stack.
+
+              - yyok, when ready to shift a token.
+
+             Except in the first case, yyparse will invoke yyremoveDeletes and
+             then shift the next token onto all remaining stacks.  This
+             synchronization of the shift (that is, after all preceding
+             reductions on all stacks) helps prevent double destructor calls
+             on yylval in the event of memory exhaustion.  */
+
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            YYCHK1 (yyprocessOneStack (&yystack, yys, yyposn, ctx));
+          yyremoveDeletes (&yystack);
+          if (yystack.yytops.yysize == 0)
+            {
+              yyundeleteLastStack (&yystack);
+              if (yystack.yytops.yysize == 0)
+                yyFail (&yystack, ctx, YY_("syntax error"));
+              YYCHK1 (yyresolveStack (&yystack, ctx));
+              YY_DPRINTF ((stderr, "Returning to deterministic operation.\n"));
+              yyreportSyntaxError (&yystack, ctx);
+              goto yyuser_error;
+            }
+
+          /* If any yyglrShift call fails, it will fail after shifting.  Thus,
+             a copy of yylval will already be on stack 0 in the event of a
+             failure in the following loop.  Thus, yychar is set to YYEMPTY
+             before the loop to make sure the user destructor for yylval isn't
+             called twice.  */
+          yytoken_to_shift = YYTRANSLATE (yychar);
+          yychar = YYEMPTY;
+          yyposn += 1;
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            {
+              yy_state_t yystate = yystack.yytops.yystates[yys]->yylrState;
+              const short* yyconflicts;
+              int yyaction = yygetLRActions (yystate, yytoken_to_shift,
+                              &yyconflicts);
+              /* Note that yyconflicts were handled by yyprocessOneStack.  */
+              YY_DPRINTF ((stderr, "On stack %ld, ", YY_CAST (long, yys)));
+              YY_SYMBOL_PRINT ("shifting", yytoken_to_shift, &yylval, &yylloc);
+              yyglrShift (&yystack, yys, yyaction, yyposn,
+                          &yylval);
+              YY_DPRINTF ((stderr, "Stack %ld now in state %d\n",
+                           YY_CAST (long, yys),
+                           yystack.yytops.yystates[yys]->yylrState));
+            }
+
+          if (yystack.yytops.yysize == 1)
+            {
+              YYCHK1 (yyresolveStack (&yystack, ctx));
+              YY_DPRINTF ((stderr, "Returning to deterministic operation.\n"));
+              yycompressStack (&yystack);
+              break;
+            }
+        }
+      continue;
+    yyuser_error:
+      yyrecoverSyntaxError (&yystack, ctx);
+      yyposn = yystack.yytops.yystates[0]->yyposn;
+    }
+
+ yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+ yybuglab:
+  YY_ASSERT (yyfalse);
+  goto yyabortlab;
+
+ yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+ yyexhaustedlab:
+  yyerror (ctx, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+ yyreturnlab:
+  if (yychar != YYEMPTY)
+    yydestruct ("Cleanup: discarding lookahead",
+                YYTRANSLATE (yychar), &yylval, ctx);
+
+  /* If the stack is well-formed, pop the stack until it is empty,
+     destroying its entries as we go.  But free the stack regardless
+     of whether it is well-formed.  */
+  if (yystack.yyitems)
+    {
+      yyGLRState** yystates = yystack.yytops.yystates;
+      if (yystates)
+        {
+          YYPTRDIFF_T yysize = yystack.yytops.yysize;
+          YYPTRDIFF_T yyk;
+          for (yyk = 0; yyk < yysize; yyk += 1)
+            if (yystates[yyk])
+              {
+                while (yystates[yyk])
+                  {
+                    yyGLRState *yys = yystates[yyk];
+                    if (yys->yypred != YY_NULLPTR)
+                      yydestroyGLRState ("Cleanup: popping", yys, ctx);
+                    yystates[yyk] = yys->yypred;
+                    yystack.yynextFree -= 1;
+                    yystack.yyspaceLeft += 1;
+                  }
+                break;
+              }
+        }
+      yyfreeGLRStack (&yystack);
+    }
+
+  return yyresult;
+}
+
+/* DEBUGGING ONLY */
+#if YYDEBUG
+/* Print *YYS and its predecessors. */
+static void
+yy_yypstack (yyGLRState* yys)
+{
+  if (yys->yypred)
+    {
+      yy_yypstack (yys->yypred);
+      YY_FPRINTF ((stderr, " -> "));
+    }
+  YY_FPRINTF ((stderr, "%d@%ld", yys->yylrState, YY_CAST (long, yys->yyposn)));
+}
+
+/* Print YYS (possibly NULL) and its predecessors. */
+static void
+yypstates (yyGLRState* yys)
+{
+  if (yys == YY_NULLPTR)
+    YY_FPRINTF ((stderr, "<null>"));
+  else
+    yy_yypstack (yys);
+  YY_FPRINTF ((stderr, "\n"));
+}
+
+/* Print the stack #YYK.  */
+static void
+yypstack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  yypstates (yystackp->yytops.yystates[yyk]);
+}
+
+/* Print all the stacks.  */
+static void
+yypdumpstack (yyGLRStack* yystackp)
+{
+#define YYINDEX(YYX)                                                    \
+  YY_CAST (long,                                                        \
+           ((YYX)                                                       \
+            ? YY_REINTERPRET_CAST (yyGLRStackItem*, (YYX)) - yystackp->yyitems \
+            : -1))
+
+  yyGLRStackItem* yyp;
+  for (yyp = yystackp->yyitems; yyp < yystackp->yynextFree; yyp += 1)
+    {
+      YY_FPRINTF ((stderr, "%3ld. ",
+                   YY_CAST (long, yyp - yystackp->yyitems)));
+      if (*YY_REINTERPRET_CAST (yybool *, yyp))
+        {
+          YY_ASSERT (yyp->yystate.yyisState);
+          YY_ASSERT (yyp->yyoption.yyisState);
+          YY_FPRINTF ((stderr, "Res: %d, LR State: %d, posn: %ld, pred: %ld",
+                       yyp->yystate.yyresolved, yyp->yystate.yylrState,
+                       YY_CAST (long, yyp->yystate.yyposn),
+                       YYINDEX (yyp->yystate.yypred)));
+          if (! yyp->yystate.yyresolved)
+            YY_FPRINTF ((stderr, ", firstVal: %ld",
+                         YYINDEX (yyp->yystate.yysemantics.yyfirstVal)));
+        }
+      else
+        {
+          YY_ASSERT (!yyp->yystate.yyisState);
+          YY_ASSERT (!yyp->yyoption.yyisState);
+          YY_FPRINTF ((stderr, "Option. rule: %d, state: %ld, next: %ld",
+                       yyp->yyoption.yyrule - 1,
+                       YYINDEX (yyp->yyoption.yystate),
+                       YYINDEX (yyp->yyoption.yynext)));
+        }
+      YY_FPRINTF ((stderr, "\n"));
+    }
+
+  YY_FPRINTF ((stderr, "Tops:"));
+  {
+    YYPTRDIFF_T yyi;
+    for (yyi = 0; yyi < yystackp->yytops.yysize; yyi += 1)
+      YY_FPRINTF ((stderr, "%ld: %ld; ", YY_CAST (long, yyi),
+                   YYINDEX (yystackp->yytops.yystates[yyi])));
+    YY_FPRINTF ((stderr, "\n"));
+  }
+#undef YYINDEX
+}
+#endif
+
+#undef yylval
+#undef yychar
+#undef yynerrs
+
+
+
+
+#line 2431 "build/generated/parser.y"
+
+
+#ifdef JS_PARSER_FAST
+
+// 快速路径的错误不报告：该语句会交给 GLR 重新解析，由它给出诊断
+void yyerror(JSParser *ctx, const char *s) {
+    (void)s;
+    ctx->statement_failed = true;
+}
+
+// 两个解析器由同一份文法生成，LALR 状态编号一致；语义值联合体的声明也相同
+bool fast_parser_compatible(size_t value_size) {
+    return value_size == sizeof(YYSTYPE) && parser_lr_state_count() == YYNSTATES;
+}
+
+FastParser *fast_parser_new(void) {
+    return yypstate_new();
+}
+
+void fast_parser_free(FastParser *parser) {
+    yypstate_delete(parser);
+}
+
+FastPushStatus fast_parser_push(FastParser *parser, int token, const void *value, JSParser *ctx) {
+    int status = yypush_parse(parser, token, (const YYSTYPE *)value, ctx);
+    if (status == YYPUSH_MORE) {
+        return FAST_PUSH_MORE;
+    }
+    return status == 0 ? FAST_PUSH_ACCEPTED : FAST_PUSH_FAILED;
+}
+
+// 在不改动解析器的前提下模拟读入 token 之后的归约序列（类似 LAC，只查表不执行动作），
+// 途经的每个状态都到 GLR 的表里检查这一格是否有冲突：没有冲突的路径上确定性解析与 GLR 完全一致
+bool fast_parser_lookahead_ok(const FastParser *parser, int token) {
+    yysymbol_kind_t symbol = token <= 0 ? YYSYMBOL_YYEOF : YYTRANSLATE(token);
+    const yy_state_t *base = parser->yyssp;  // 原栈中尚未被模拟弹出的栈顶
+    yy_state_t pushed[64];                   // 模拟中压入的状态
+    int pushed_count = 0;
+    int state = *base;
+    for (;;) {
+        if (parser_lr_conflict(state, symbol)) {
+            return false;
+        }
+        int rule;
+        int index = yypact[state] + symbol;
+        if (yypact_value_is_default(yypact[state]) || index < 0 || YYLAST < index || yycheck[index] != symbol) {
+            rule = yydefact[state];
+            if (rule == 0) {
+                return true;    // 语法错误，由 push 报告
+            }
+        } else if (yytable[index] > 0 || yytable_value_is_error(yytable[index])) {
+            return true;        // 移进（或错误）：归约序列到此结束
+        } else {
+            rule = -yytable[index];
+        }
+        int length = yyr2[rule];
+        if (length <= pushed_count) {
+            pushed_count -= length;
+        } else {
+            base -= length - pushed_count;
+            pushed_count = 0;
+        }
+        int top = pushed_count > 0 ? pushed[pushed_count - 1] : *base;
+        int lhs = yyr1[rule] - YYNTOKENS;
+        int goto_index = yypgoto[lhs] + top;
+        state = (0 <= goto_index && goto_index <= YYLAST && yycheck[goto_index] == top)
+                    ? yytable[goto_index] : yydefgoto[lhs];
+        if (pushed_count == (int)(sizeof(pushed) / sizeof(pushed[0]))) {
+            return false;
+        }
+        pushed[pushed_count++] = (yy_state_t)state;
+    }
+}
+
+// 放弃解析到一半的语句：按 %destructor 释放栈上的值，解析器回到初始状态
+void fast_parser_reset(FastParser *parser, JSParser *ctx) {
+    if (parser->yynew != 0) {
+        return;
+    }
+    while (parser->yyssp != parser->yyss) {
+        yydestruct("Fast path: discarding", YY_ACCESSING_SYMBOL(*parser->yyssp), parser->yyvsp, ctx);
+        parser->yyssp--;
+        parser->yyvsp--;
+    }
+    parser->yynew = 2;
+}
+
+#else
+
+void yyerror(JSParser *ctx, const char *s) {
+    ctx->error_count++;
+    if (ctx->print_errors) {
+        fprintf(stderr, "Syntax error #%d: %s\n", ctx->error_count, s);
+    }
+    diag_record_error(&ctx->diag, s);
+}
+
+// 只验证语法的解析器表与主解析器相同，表查询只由主解析器提供一份
+#ifndef JS_PARSER_VALIDATE
+int parser_lr_state_count(void) {
+    return YYNSTATES;
+}
+
+// 状态 state 遇到 symbol 时表里是否有多个动作（GLR 会在这里分裂）
+bool parser_lr_conflict(int state, int symbol) {
+    const short *conflicts;
+    yygetLRActions((yy_state_t)state, (yysymbol_kind_t)symbol, &conflicts);
+    return *conflicts != 0;
+}
+
+// 规则 rule（bison -v 的编号，即跟踪输出里的编号）的左部名字；parse.error verbose 时 yytname 总是存在
+const char *parser_rule_lhs(int rule) {
+    return yytname[yyr1[rule + 1]];
+}
+
+// 规则在生成的 parser.y 中的行号；yyrline 只在带跟踪代码的构建里有
+int parser_rule_line(int rule) {
+#if YYDEBUG
+    return yyrline[rule + 1];
+#else
+    (void)rule;
+    return 0;
+#endif
+}
+#endif
+
+#endif
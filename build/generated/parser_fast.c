@@ -0,0 +1,8889 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 1
+
+/* Pull parsers.  */
+#define YYPULL 0
+
+/* Substitute the type names.  */
+#define YYSTYPE         JSFAST_STYPE
+/* Substitute the variable and function names.  */
+#define yypush_parse    jsfast_push_parse
+#define yypstate_new    jsfast_pstate_new
+#define yypstate_clear  jsfast_pstate_clear
+#define yypstate_delete jsfast_pstate_delete
+#define yypstate        jsfast_pstate
+#define yylex           jsfast_lex
+#define yyerror         jsfast_error
+#define yydebug         jsfast_debug
+#define yynerrs         jsfast_nerrs
+
+/* First part of user prologue.  */
+#line 14 "build/generated/parser_fast.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "ast.h"
+#include "parser_context.h"
+#include "postfix_suffix.h"
+#include "binary_chain.h"
+
+// 序言先于 %code provides 输出，这里需要单独声明
+void yyerror(JSParser *ctx, const char *s);
+
+#ifndef JS_PARSER_FAST
+// --glr-stats / --glr-trace 的钩子（GLR_STATS_HOOK）由 gen_tokens --glr-hooks 插入生成的 parser.c；
+// glr.c 的跟踪文本经过 YYFPRINTF，只在 JS_PARSER_TRACE 时输出
+#include "glr_stats.h"
+#define YYFPRINTF glr_trace_fprintf
+#endif
+
+#ifndef YYMAXDEPTH
+#define YYMAXDEPTH 10000000 /* Allow deep GLR stacks for 10^5-level nesting; member/call chains are left-recursive and stay shallow */
+#endif
+
+#ifndef YYINITDEPTH
+#ifdef JS_PARSER_FAST
+#define YYINITDEPTH 256     /* 推送式解析器的初始栈嵌在 pstate 里，不够时按倍数扩容 */
+#else
+// GLR 栈的初始容量按本次 yyparse 要解析的 token 数估计（parser_fast_path.c 设置），不够时 glr.c 倍增；
+// 骨架只在 yyparse 里用到 YYINITDEPTH，ctx 在作用域内
+#define YYINITDEPTH (ctx->glr_initial_depth)
+#endif
+#endif
+
+// 语句分段解析时顶层语句的归约需要知道：动作是否立即执行（GLR 分裂期间动作延后，yynormal 为假），
+// 以及当前是否已读入前瞻 token（两个解析器的“无前瞻”常量名字不同）
+#if defined(JS_PARSER_FAST) && defined(JS_PARSER_VALIDATE)
+#define PARSER_NO_LOOKAHEAD JSFASTVALIDATE_EMPTY
+#define PARSER_ACTION_IMMEDIATE 1
+#elif defined(JS_PARSER_FAST)
+#define PARSER_NO_LOOKAHEAD JSFAST_EMPTY
+#define PARSER_ACTION_IMMEDIATE 1
+#elif defined(JS_PARSER_VALIDATE)
+#define PARSER_NO_LOOKAHEAD JSVALIDATE_EMPTY
+#define PARSER_ACTION_IMMEDIATE yynormal
+#else
+#define PARSER_NO_LOOKAHEAD YYEMPTY
+#define PARSER_ACTION_IMMEDIATE yynormal
+#endif
+
+// 分段解析：每归约出一条顶层语句就结束本段，已读入的前瞻 token 留给下一段
+#define END_STATEMENT_SEGMENT(items)                                        \
+    do {                                                                    \
+        if (ctx->statement_mode && PARSER_ACTION_IMMEDIATE) {               \
+            ctx->statement_items = (items);                                 \
+            ctx->statement_lookahead = (yychar != PARSER_NO_LOOKAHEAD);     \
+            yyclearin;                                                      \
+            YYACCEPT;                                                       \
+        }                                                                   \
+    } while (0)
+
+#ifdef JS_PARSER_FAST
+// 快速路径放弃一条语句时，栈上已建好的部分 AST 由 %destructor 释放
+static void discard_suffix_chain(PostfixSuffix *chain) {
+    if (chain) {
+        PostfixSuffix *tail = chain;
+        chain = tail->next;
+        tail->next = NULL;
+    }
+    while (chain) {
+        PostfixSuffix *next = chain->next;
+        switch (chain->kind) {
+            case POSTFIX_SUFFIX_COMPUTED:
+                ast_free(chain->data.computed_expr);
+                break;
+            case POSTFIX_SUFFIX_CALL:
+                ast_list_free(chain->data.arguments);
+                break;
+            case POSTFIX_SUFFIX_TEMPLATE:
+                ast_free(chain->data.template_literal);
+                break;
+            case POSTFIX_SUFFIX_PROP:
+                break;
+        }
+        free(chain);
+        chain = next;
+    }
+}
+
+static void discard_binary_chain(BinaryChain *chain) {
+    for (size_t i = 0; i < chain->count; i++) {
+        ast_free(chain->items[i].operand);
+    }
+    free(chain);
+}
+#endif
+
+// 方法定义在类元素/对象属性的修饰符都检查完之后才构造节点，此前名字、修饰符、参数与函数体都放在这里
+#ifndef JS_METHOD_INFO_DEFINED
+#define JS_METHOD_INFO_DEFINED
+typedef struct MethodInfo MethodInfo;
+#endif
+struct MethodInfo {
+    const char *name;
+    ASTNode *computed_key;
+    bool computed;
+    bool is_generator;
+    bool is_async;
+    bool is_static;
+    ASTMethodKind kind;
+    ASTList *params;
+    ASTNode *body;
+    size_t param_count;         // 只验证语法时没有参数表，只有个数
+};
+
+static ASTNode *wrap_destructuring_target(ASTNode *target) {
+    if (!target) {
+        return NULL;
+    }
+    if (target->type == AST_OBJECT_BINDING || target->type == AST_ARRAY_BINDING) {
+        return ast_make_binding_pattern(target, NULL);
+    }
+    return target;
+}
+
+static ASTNode *make_binding_with_initializer(ASTNode *target, ASTNode *initializer);
+static ASTNode *convert_assignment_target(ASTNode *expr, bool allow_object_literal);
+static ASTNode *convert_array_literal_to_binding(ASTNode *expr, bool allow_object_literal);
+static ASTNode *convert_object_literal_to_binding(ASTNode *expr);
+
+static ASTNode *make_binding_with_initializer(ASTNode *target, ASTNode *initializer) {
+    if (!target) {
+        return NULL;
+    }
+    if (target->type == AST_BINDING_PATTERN) {
+        if (initializer && !target->data.binding_pattern.initializer) {
+            target->data.binding_pattern.initializer = initializer;
+        }
+        return target;
+    }
+    return ast_make_binding_pattern(target, initializer);
+}
+
+static ASTNode *convert_assignment_target(ASTNode *expr, bool allow_object_literal) {
+    if (!expr) {
+        return NULL;
+    }
+    switch (expr->type) {
+        case AST_IDENTIFIER:
+            return expr;
+        case AST_ARRAY_LITERAL:
+            return convert_array_literal_to_binding(expr, allow_object_literal);
+        case AST_OBJECT_LITERAL:
+            return allow_object_literal ? convert_object_literal_to_binding(expr) : NULL;
+        case AST_ASSIGN_EXPR:
+            if (expr->data.assign.op && strcmp(expr->data.assign.op, "=") == 0) {
+                ASTNode *lhs = convert_assignment_target(expr->data.assign.left, allow_object_literal);
+                if (!lhs) {
+                    return NULL;
+                }
+                return make_binding_with_initializer(lhs, expr->data.assign.right);
+            }
+            return NULL;
+        default:
+            return NULL;
+    }
+}
+
+static ASTNode *convert_array_literal_to_binding(ASTNode *expr, bool allow_object_literal) {
+    if (!expr || expr->type != AST_ARRAY_LITERAL) {
+        return NULL;
+    }
+    ASTList *converted = NULL;
+    ASTList *elem = expr->data.array_literal.elements;
+    while (elem) {
+        ASTNode *item = elem->node;
+        if (!item) {
+            elem = elem->next;
+            continue;
+        }
+        ASTNode *converted_item = NULL;
+        if (item->type == AST_ARRAY_HOLE) {
+            converted_item = ast_make_array_hole();
+        } else if (item->type == AST_SPREAD_ELEMENT) {
+            ASTNode *rest_target = convert_assignment_target(item->data.spread_element.argument, allow_object_literal);
+            if (!rest_target) {
+                return NULL;
+            }
+            converted_item = ast_make_rest_element(rest_target);
+        } else {
+            ASTNode *init = NULL;
+            ASTNode *value = item;
+            if (item->type == AST_ASSIGN_EXPR && item->data.assign.op &&
+                strcmp(item->data.assign.op, "=") == 0) {
+                value = item->data.assign.left;
+                init = item->data.assign.right;
+            }
+            ASTNode *target = convert_assignment_target(value, allow_object_literal);
+            if (!target) {
+                return NULL;
+            }
+            converted_item = make_binding_with_initializer(target, init);
+        }
+        converted = ast_list_append(converted, converted_item);
+        elem = elem->next;
+    }
+    return ast_make_array_binding(converted);
+}
+
+static ASTNode *convert_object_literal_to_binding(ASTNode *expr) {
+    if (!expr || expr->type != AST_OBJECT_LITERAL) {
+        return NULL;
+    }
+    ASTList *converted = NULL;
+    for (ASTList *prop = expr->data.object_literal.properties; prop; prop = prop->next) {
+        ASTNode *item = prop->node;
+        if (!item) {
+            continue;
+        }
+        if (item->type == AST_SPREAD_ELEMENT) {
+            ASTNode *rest_target = convert_assignment_target(item->data.spread_element.argument, true);
+            if (!rest_target) {
+                return NULL;
+            }
+            converted = ast_list_append(converted, ast_make_rest_element(rest_target));
+            continue;
+        }
+        if (item->type != AST_PROPERTY) {
+            return NULL;
+        }
+        bool is_identifier_key = item->data.property.key.is_identifier;
+        const char *key = item->data.property.key.name;
+        ASTNode *value = item->data.property.value;
+        ASTNode *init = NULL;
+        ASTNode *binding_target = NULL;
+        if (value && value->type == AST_ASSIGN_EXPR && value->data.assign.op &&
+            strcmp(value->data.assign.op, "=") == 0) {
+            binding_target = convert_assignment_target(value->data.assign.left, true);
+            init = value->data.assign.right;
+        } else {
+            binding_target = convert_assignment_target(value, true);
+        }
+        if (!binding_target) {
+            return NULL;
+        }
+        ASTNode *binding_value = make_binding_with_initializer(binding_target, init);
+        bool shorthand = false;
+        if (is_identifier_key && value && value->type == AST_IDENTIFIER && item->data.property.key.name) {
+            shorthand = item->data.property.key.name == value->data.identifier.name;
+        }
+        converted = ast_list_append(converted,
+                                    ast_make_binding_property(key, is_identifier_key, binding_value, shorthand));
+    }
+    return ast_make_object_binding(converted);
+}
+
+static PostfixSuffix *alloc_suffix(PostfixSuffixKind kind) {
+    PostfixSuffix *suffix = (PostfixSuffix *)calloc(1, sizeof(PostfixSuffix));
+    if (!suffix) {
+        fprintf(stderr, "Out of memory while building postfix suffix chain\n");
+        exit(EXIT_FAILURE);
+    }
+    suffix->kind = kind;
+    suffix->next = suffix;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_prop(const char *name) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_PROP);
+    suffix->data.property_name = name;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_computed(ASTNode *expr) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_COMPUTED);
+    suffix->data.computed_expr = expr;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_call(ASTList *args) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_CALL);
+    suffix->data.arguments = args;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_template(ASTNode *literal) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_TEMPLATE);
+    suffix->data.template_literal = literal;
+    return suffix;
+}
+
+// 后缀链按环形链表保存、以最后一项代表整条链，追加是 O(1)：
+// 十万级的 a.b(c).d[e]... 链不会因为每次找尾而变成平方时间
+static PostfixSuffix *append_suffix(PostfixSuffix *tail, PostfixSuffix *item) {
+    if (!item) {
+        return tail;
+    }
+    if (tail) {
+        item->next = tail->next;
+        tail->next = item;
+    }
+    return item;
+}
+
+static ASTNode *apply_suffix_chain(ASTNode *base, PostfixSuffix *chain) {
+    PostfixSuffix *current = NULL;
+    if (chain) {
+        current = chain->next;
+        chain->next = NULL;
+    }
+    while (current) {
+        PostfixSuffix *next = current->next;
+        switch (current->kind) {
+            case POSTFIX_SUFFIX_PROP:
+                base = ast_make_member(base, ast_make_identifier(current->data.property_name), false);
+                break;
+            case POSTFIX_SUFFIX_COMPUTED:
+                base = ast_make_member(base, current->data.computed_expr, true);
+                break;
+            case POSTFIX_SUFFIX_CALL:
+                base = ast_make_call(base, current->data.arguments);
+                break;
+            case POSTFIX_SUFFIX_TEMPLATE:
+                base = ast_make_tagged_template(base, current->data.template_literal);
+                break;
+        }
+        free(current);
+        current = next;
+    }
+    return base;
+}
+
+// 二元运算符优先级（与原先逐级展开的文法一致：** 与 * / % 同级且左结合）
+enum
+{
+    BINOP_OR, BINOP_AND, BINOP_BIT_OR, BINOP_BIT_XOR, BINOP_BIT_AND,
+    BINOP_EQ, BINOP_NE, BINOP_EQ_STRICT, BINOP_NE_STRICT,
+    BINOP_LT, BINOP_GT, BINOP_LE, BINOP_GE, BINOP_INSTANCEOF, BINOP_IN,
+    BINOP_LSHIFT, BINOP_RSHIFT, BINOP_URSHIFT,
+    BINOP_ADD, BINOP_SUB, BINOP_MUL, BINOP_EXP, BINOP_DIV, BINOP_MOD
+};
+
+static const BinaryOperator binary_operators[] = {
+    [BINOP_OR] = {"||", 1},
+    [BINOP_AND] = {"&&", 2},
+    [BINOP_BIT_OR] = {"|", 3},
+    [BINOP_BIT_XOR] = {"^", 4},
+    [BINOP_BIT_AND] = {"&", 5},
+    [BINOP_EQ] = {"==", 6},
+    [BINOP_NE] = {"!=", 6},
+    [BINOP_EQ_STRICT] = {"===", 6},
+    [BINOP_NE_STRICT] = {"!==", 6},
+    [BINOP_LT] = {"<", 7},
+    [BINOP_GT] = {">", 7},
+    [BINOP_LE] = {"<=", 7},
+    [BINOP_GE] = {">=", 7},
+    [BINOP_INSTANCEOF] = {"instanceof", 7},
+    [BINOP_IN] = {"in", 7},
+    [BINOP_LSHIFT] = {"<<", 8},
+    [BINOP_RSHIFT] = {">>", 8},
+    [BINOP_URSHIFT] = {">>>", 8},
+    [BINOP_ADD] = {"+", 9},
+    [BINOP_SUB] = {"-", 9},
+    [BINOP_MUL] = {"*", 10},
+    [BINOP_EXP] = {"**", 10},
+    [BINOP_DIV] = {"/", 10},
+    [BINOP_MOD] = {"%", 10},
+};
+
+static BinaryChain *binary_chain_append(BinaryChain *chain, const BinaryOperator *op, ASTNode *operand) {
+    size_t count = chain ? chain->count : 0;
+    if (!chain || count == chain->capacity) {
+        size_t capacity = chain ? chain->capacity * 2 : 4;
+        BinaryChain *grown = (BinaryChain *)realloc(chain, sizeof(BinaryChain) + capacity * sizeof(BinaryChainItem));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while building binary expression\n");
+            exit(EXIT_FAILURE);
+        }
+        grown->count = count;
+        grown->capacity = capacity;
+        chain = grown;
+    }
+    chain->items[count].op = op;
+    chain->items[count].operand = operand;
+    chain->count = count + 1;
+    return chain;
+}
+
+// 优先级爬升：从 *next 开始吸收优先级不低于 min_precedence 的运算符，
+// 右操作数后面跟着更紧的运算符时先递归把它们结合进右操作数（递归深度不超过优先级层数）
+static ASTNode *climb_binary_chain(const BinaryChain *chain, size_t *next, ASTNode *left, int min_precedence) {
+    while (*next < chain->count && chain->items[*next].op->precedence >= min_precedence) {
+        const BinaryOperator *op = chain->items[*next].op;
+        ASTNode *right = chain->items[(*next)++].operand;
+        while (*next < chain->count && chain->items[*next].op->precedence > op->precedence) {
+            right = climb_binary_chain(chain, next, right, op->precedence + 1);
+        }
+        left = ast_make_binary(op->op, left, right);
+    }
+    return left;
+}
+
+static ASTNode *fold_binary_chain(BinaryChain *chain) {
+    size_t next = 1;
+    ASTNode *result = climb_binary_chain(chain, &next, chain->items[0].operand, 0);
+    free(chain);
+    return result;
+}
+
+// 方法名与修饰符放在堆上，语义值只是一个指针（YYSTYPE 保持指针大小）；build_method_node 接管并释放
+static MethodInfo *method_info_alloc(const char *name, ASTNode *computed_key, bool computed) {
+    MethodInfo *info = (MethodInfo *)malloc(sizeof(MethodInfo));
+    if (!info) {
+        fprintf(stderr, "Out of memory while constructing method\n");
+        exit(EXIT_FAILURE);
+    }
+    info->name = name;
+    info->computed_key = computed_key;
+    info->computed = computed;
+    info->is_generator = false;
+    info->is_async = false;
+    info->is_static = false;
+    info->kind = AST_METHOD_KIND_NORMAL;
+    info->params = NULL;
+    info->body = NULL;
+    info->param_count = 0;
+    return info;
+}
+
+static void method_info_free(MethodInfo *info) {
+    if (info) {
+        ast_free(info->computed_key);
+        ast_list_free(info->params);
+        ast_free(info->body);
+        free(info);
+    }
+}
+
+static MethodInfo *method_info_set_function(MethodInfo *info, ASTList *params, ASTNode *body) {
+    info->params = params;
+    info->body = body;
+    info->param_count = 0;
+    for (ASTList *param = params; param; param = param->next) {
+        info->param_count++;
+    }
+    return info;
+}
+
+#ifdef JS_PARSER_VALIDATE
+// 只验证语法：修饰符与参数个数检查完就丢掉，不构造节点
+static ASTList *make_single_param_list(ASTNode *param) {
+    (void)param;
+    return NULL;
+}
+
+static ASTNode *build_method_node(MethodInfo *info) {
+    method_info_free(info);
+    return NULL;
+}
+#else
+static ASTList *make_single_param_list(ASTNode *param) {
+    ASTList *list = NULL;
+    return ast_list_append(list, param);
+}
+
+static ASTNode *build_method_node(MethodInfo *info) {
+    ASTNode *func = ast_make_function_expr(info->name, info->params, info->body);
+    if (info->is_generator && func) {
+        func->data.function_expr.is_generator = true;
+    }
+    if (info->is_async && func) {
+        func->data.function_expr.is_async = true;
+    }
+    ASTNode *method = ast_make_method_def(info->name,
+                                          info->computed_key,
+                                          info->computed,
+                                          info->is_static,
+                                          info->is_generator,
+                                          info->is_async,
+                                          info->kind,
+                                          func);
+    free(info);
+    return method;
+}
+#endif
+
+// 字符串属性键去掉引号；键是 atom，不能原地修改，去引号后的文本另行驻留
+static const char *unquote_property_key(JSParser *ctx, const char *key) {
+    size_t len = key ? strlen(key) : 0;
+    if (len >= 2 && (key[0] == '\'' || key[0] == '"')) {
+        return atom_intern(ctx->atoms, key + 1, len - 2);
+    }
+    return key;
+}
+
+// 名字都是 atom，与预置 atom 比较指针即可
+static bool identifier_is(const char *name, const char *atom) {
+    return name && name == atom;
+}
+
+static MethodInfo *mark_method_static(JSParser *ctx, MethodInfo *method) {
+    if (method->kind == AST_METHOD_KIND_CONSTRUCTOR) {
+        yyerror(ctx, "Class constructor cannot be static");
+        method_info_free(method);
+        return NULL;
+    }
+    method->is_static = true;
+    return method;
+}
+
+static MethodInfo *maybe_tag_constructor(JSParser *ctx, MethodInfo *method) {
+    if (!method->computed &&
+        method->name &&
+        identifier_is(method->name, ATOM(ctx->atoms, CONSTRUCTOR)) &&
+        !method->is_static) {
+        method->kind = AST_METHOD_KIND_CONSTRUCTOR;
+    }
+    return method;
+}
+
+static MethodInfo *apply_accessor_keyword(JSParser *ctx, MethodInfo *method, const char *keyword) {
+    ASTMethodKind kind;
+    if (identifier_is(keyword, ATOM(ctx->atoms, GET))) {
+        kind = AST_METHOD_KIND_GET;
+    } else if (identifier_is(keyword, ATOM(ctx->atoms, SET))) {
+        kind = AST_METHOD_KIND_SET;
+    } else {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(method);
+        return NULL;
+    }
+    if (kind == AST_METHOD_KIND_GET && method->param_count != 0) {
+        yyerror(ctx, "Getter must not have parameters");
+        method_info_free(method);
+        return NULL;
+    }
+    if (kind == AST_METHOD_KIND_SET && method->param_count != 1) {
+        yyerror(ctx, "Setter must have exactly one parameter");
+        method_info_free(method);
+        return NULL;
+    }
+    method->kind = kind;
+    return method;
+}
+
+static MethodInfo *handle_single_prefix(JSParser *ctx, const char *prefix, MethodInfo *method) {
+    MethodInfo *result = maybe_tag_constructor(ctx, method);
+    if (identifier_is(prefix, ATOM(ctx->atoms, STATIC))) {
+        result = mark_method_static(ctx, result);
+    } else if (identifier_is(prefix, ATOM(ctx->atoms, GET)) || identifier_is(prefix, ATOM(ctx->atoms, SET))) {
+        result = apply_accessor_keyword(ctx, result, prefix);
+    } else {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        result = NULL;
+    }
+    return result;
+}
+
+static MethodInfo *handle_double_prefix(JSParser *ctx, const char *first, const char *second, MethodInfo *method) {
+    MethodInfo *result = maybe_tag_constructor(ctx, method);
+    if (!identifier_is(first, ATOM(ctx->atoms, STATIC))) {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        return NULL;
+    }
+    result = mark_method_static(ctx, result);
+    if (!result) {
+        return NULL;
+    }
+    if (!(identifier_is(second, ATOM(ctx->atoms, GET)) || identifier_is(second, ATOM(ctx->atoms, SET)))) {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        return NULL;
+    }
+    return apply_accessor_keyword(ctx, result, second);
+}
+
+#line 660 "build/generated/parser_fast.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+
+/* Debug traces.  */
+#ifndef JSFAST_DEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define JSFAST_DEBUG 1
+#  else
+#   define JSFAST_DEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define JSFAST_DEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined JSFAST_DEBUG */
+#if JSFAST_DEBUG
+extern int jsfast_debug;
+#endif
+/* "%code requires" blocks.  */
+#line 598 "build/generated/parser_fast.y"
+
+    #include "ast.h"
+    #include "postfix_suffix.h"
+    #include "binary_chain.h"
+    #ifndef JS_PARSER_DEFINED
+    #define JS_PARSER_DEFINED
+    typedef struct JSParser JSParser;
+    #endif
+    #ifndef JS_METHOD_INFO_DEFINED
+    #define JS_METHOD_INFO_DEFINED
+    typedef struct MethodInfo MethodInfo;
+    #endif
+
+#line 714 "build/generated/parser_fast.c"
+
+/* Token kinds.  */
+#ifndef JSFAST_TOKENTYPE
+# define JSFAST_TOKENTYPE
+  enum jsfast_tokentype
+  {
+    JSFAST_EMPTY = -2,
+    JSFAST_EOF = 0,                /* "end of file"  */
+    JSFAST_error = 256,            /* error  */
+    JSFAST_UNDEF = 334,            /* "invalid token"  */
+    VAR = 258,                     /* VAR  */
+    LET = 259,                     /* LET  */
+    CONST = 260,                   /* CONST  */
+    FUNCTION = 261,                /* FUNCTION  */
+    FUNCTION_DECL = 262,           /* FUNCTION_DECL  */
+    IF = 263,                      /* IF  */
+    ELSE = 264,                    /* ELSE  */
+    FOR = 265,                     /* FOR  */
+    RETURN = 266,                  /* RETURN  */
+    ASYNC = 267,                   /* ASYNC  */
+    AWAIT = 268,                   /* AWAIT  */
+    IMPORT = 269,                  /* IMPORT  */
+    EXPORT = 270,                  /* EXPORT  */
+    WHILE = 271,                   /* WHILE  */
+    DO = 272,                      /* DO  */
+    BREAK = 273,                   /* BREAK  */
+    CONTINUE = 274,                /* CONTINUE  */
+    SWITCH = 275,                  /* SWITCH  */
+    CASE = 276,                    /* CASE  */
+    DEFAULT = 277,                 /* DEFAULT  */
+    TRY = 278,                     /* TRY  */
+    CATCH = 279,                   /* CATCH  */
+    FINALLY = 280,                 /* FINALLY  */
+    THROW = 281,                   /* THROW  */
+    NEW = 282,                     /* NEW  */
+    THIS = 283,                    /* THIS  */
+    TYPEOF = 284,                  /* TYPEOF  */
+    DELETE = 285,                  /* DELETE  */
+    IN = 286,                      /* IN  */
+    INSTANCEOF = 287,              /* INSTANCEOF  */
+    VOID = 288,                    /* VOID  */
+    WITH = 289,                    /* WITH  */
+    DEBUGGER = 290,                /* DEBUGGER  */
+    CLASS = 291,                   /* CLASS  */
+    EXTENDS = 292,                 /* EXTENDS  */
+    SUPER = 293,                   /* SUPER  */
+    YIELD = 294,                   /* YIELD  */
+    TRUE = 295,                    /* TRUE  */
+    FALSE = 296,                   /* FALSE  */
+    NULL_T = 297,                  /* NULL_T  */
+    UNDEFINED = 298,               /* UNDEFINED  */
+    IDENTIFIER = 299,              /* IDENTIFIER  */
+    NUMBER = 300,                  /* NUMBER  */
+    STRING = 301,                  /* STRING  */
+    REGEX = 302,                   /* REGEX  */
+    TEMPLATE_NO_SUB = 303,         /* TEMPLATE_NO_SUB  */
+    TEMPLATE_HEAD = 304,           /* TEMPLATE_HEAD  */
+    TEMPLATE_MIDDLE = 305,         /* TEMPLATE_MIDDLE  */
+    TEMPLATE_TAIL = 306,           /* TEMPLATE_TAIL  */
+    PLUS_PLUS = 307,               /* PLUS_PLUS  */
+    MINUS_MINUS = 308,             /* MINUS_MINUS  */
+    EQ = 309,                      /* EQ  */
+    NE = 310,                      /* NE  */
+    EQ_STRICT = 311,               /* EQ_STRICT  */
+    NE_STRICT = 312,               /* NE_STRICT  */
+    LE = 313,                      /* LE  */
+    GE = 314,                      /* GE  */
+    AND = 315,                     /* AND  */
+    OR = 316,                      /* OR  */
+    LSHIFT = 317,                  /* LSHIFT  */
+    RSHIFT = 318,                  /* RSHIFT  */
+    URSHIFT = 319,                 /* URSHIFT  */
+    PLUS_ASSIGN = 320,             /* PLUS_ASSIGN  */
+    MINUS_ASSIGN = 321,            /* MINUS_ASSIGN  */
+    STAR_ASSIGN = 322,             /* STAR_ASSIGN  */
+    SLASH_ASSIGN = 323,            /* SLASH_ASSIGN  */
+    PERCENT_ASSIGN = 324,          /* PERCENT_ASSIGN  */
+    AND_ASSIGN = 325,              /* AND_ASSIGN  */
+    OR_ASSIGN = 326,               /* OR_ASSIGN  */
+    XOR_ASSIGN = 327,              /* XOR_ASSIGN  */
+    LSHIFT_ASSIGN = 328,           /* LSHIFT_ASSIGN  */
+    RSHIFT_ASSIGN = 329,           /* RSHIFT_ASSIGN  */
+    URSHIFT_ASSIGN = 330,          /* URSHIFT_ASSIGN  */
+    ARROW = 331,                   /* ARROW  */
+    ELLIPSIS = 332,                /* ELLIPSIS  */
+    ARROW_HEAD = 333,              /* ARROW_HEAD  */
+    UMINUS = 335,                  /* UMINUS  */
+    IF_NO_ELSE = 336               /* IF_NO_ELSE  */
+  };
+  typedef enum jsfast_tokentype jsfast_token_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined JSFAST_STYPE && ! defined JSFAST_STYPE_IS_DECLARED
+union JSFAST_STYPE
+{
+#line 612 "build/generated/parser_fast.y"
+
+    ASTNode *node;
+    ASTList *list;
+    char *str;          // 自有字符串（字符串/数字字面量等），丢弃时 free
+    const char *atom;   // 名字（标识符、属性名），驻留表持有
+    int boolean;
+    PostfixSuffix *suffix;
+    BinaryChain *chain;
+    const BinaryOperator *binop;
+    MethodInfo *method;
+    size_t count;       // 只验证语法时参数表只记个数
+
+#line 824 "build/generated/parser_fast.c"
+
+};
+typedef union JSFAST_STYPE JSFAST_STYPE;
+# define JSFAST_STYPE_IS_TRIVIAL 1
+# define JSFAST_STYPE_IS_DECLARED 1
+#endif
+
+
+
+
+#ifndef YYPUSH_MORE_DEFINED
+# define YYPUSH_MORE_DEFINED
+enum { YYPUSH_MORE = 4 };
+#endif
+
+typedef struct jsfast_pstate jsfast_pstate;
+
+
+int jsfast_push_parse (jsfast_pstate *ps,
+                  int pushed_char, JSFAST_STYPE const *pushed_val, JSParser *ctx);
+
+jsfast_pstate *jsfast_pstate_new (void);
+void jsfast_pstate_delete (jsfast_pstate *ps);
+
+/* "%code provides" blocks.  */
+#line 593 "build/generated/parser_fast.y"
+
+    int yylex(YYSTYPE *lvalp, JSParser *ctx);
+    void yyerror(JSParser *ctx, const char *s);
+
+#line 855 "build/generated/parser_fast.c"
+
+
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_VAR = 3,                        /* VAR  */
+  YYSYMBOL_LET = 4,                        /* LET  */
+  YYSYMBOL_CONST = 5,                      /* CONST  */
+  YYSYMBOL_FUNCTION = 6,                   /* FUNCTION  */
+  YYSYMBOL_FUNCTION_DECL = 7,              /* FUNCTION_DECL  */
+  YYSYMBOL_IF = 8,                         /* IF  */
+  YYSYMBOL_ELSE = 9,                       /* ELSE  */
+  YYSYMBOL_FOR = 10,                       /* FOR  */
+  YYSYMBOL_RETURN = 11,                    /* RETURN  */
+  YYSYMBOL_ASYNC = 12,                     /* ASYNC  */
+  YYSYMBOL_AWAIT = 13,                     /* AWAIT  */
+  YYSYMBOL_IMPORT = 14,                    /* IMPORT  */
+  YYSYMBOL_EXPORT = 15,                    /* EXPORT  */
+  YYSYMBOL_WHILE = 16,                     /* WHILE  */
+  YYSYMBOL_DO = 17,                        /* DO  */
+  YYSYMBOL_BREAK = 18,                     /* BREAK  */
+  YYSYMBOL_CONTINUE = 19,                  /* CONTINUE  */
+  YYSYMBOL_SWITCH = 20,                    /* SWITCH  */
+  YYSYMBOL_CASE = 21,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 22,                   /* DEFAULT  */
+  YYSYMBOL_TRY = 23,                       /* TRY  */
+  YYSYMBOL_CATCH = 24,                     /* CATCH  */
+  YYSYMBOL_FINALLY = 25,                   /* FINALLY  */
+  YYSYMBOL_THROW = 26,                     /* THROW  */
+  YYSYMBOL_NEW = 27,                       /* NEW  */
+  YYSYMBOL_THIS = 28,                      /* THIS  */
+  YYSYMBOL_TYPEOF = 29,                    /* TYPEOF  */
+  YYSYMBOL_DELETE = 30,                    /* DELETE  */
+  YYSYMBOL_IN = 31,                        /* IN  */
+  YYSYMBOL_INSTANCEOF = 32,                /* INSTANCEOF  */
+  YYSYMBOL_VOID = 33,                      /* VOID  */
+  YYSYMBOL_WITH = 34,                      /* WITH  */
+  YYSYMBOL_DEBUGGER = 35,                  /* DEBUGGER  */
+  YYSYMBOL_CLASS = 36,                     /* CLASS  */
+  YYSYMBOL_EXTENDS = 37,                   /* EXTENDS  */
+  YYSYMBOL_SUPER = 38,                     /* SUPER  */
+  YYSYMBOL_YIELD = 39,                     /* YIELD  */
+  YYSYMBOL_TRUE = 40,                      /* TRUE  */
+  YYSYMBOL_FALSE = 41,                     /* FALSE  */
+  YYSYMBOL_NULL_T = 42,                    /* NULL_T  */
+  YYSYMBOL_UNDEFINED = 43,                 /* UNDEFINED  */
+  YYSYMBOL_IDENTIFIER = 44,                /* IDENTIFIER  */
+  YYSYMBOL_NUMBER = 45,                    /* NUMBER  */
+  YYSYMBOL_STRING = 46,                    /* STRING  */
+  YYSYMBOL_REGEX = 47,                     /* REGEX  */
+  YYSYMBOL_TEMPLATE_NO_SUB = 48,           /* TEMPLATE_NO_SUB  */
+  YYSYMBOL_TEMPLATE_HEAD = 49,             /* TEMPLATE_HEAD  */
+  YYSYMBOL_TEMPLATE_MIDDLE = 50,           /* TEMPLATE_MIDDLE  */
+  YYSYMBOL_TEMPLATE_TAIL = 51,             /* TEMPLATE_TAIL  */
+  YYSYMBOL_PLUS_PLUS = 52,                 /* PLUS_PLUS  */
+  YYSYMBOL_MINUS_MINUS = 53,               /* MINUS_MINUS  */
+  YYSYMBOL_EQ = 54,                        /* EQ  */
+  YYSYMBOL_NE = 55,                        /* NE  */
+  YYSYMBOL_EQ_STRICT = 56,                 /* EQ_STRICT  */
+  YYSYMBOL_NE_STRICT = 57,                 /* NE_STRICT  */
+  YYSYMBOL_LE = 58,                        /* LE  */
+  YYSYMBOL_GE = 59,                        /* GE  */
+  YYSYMBOL_AND = 60,                       /* AND  */
+  YYSYMBOL_OR = 61,                        /* OR  */
+  YYSYMBOL_LSHIFT = 62,                    /* LSHIFT  */
+  YYSYMBOL_RSHIFT = 63,                    /* RSHIFT  */
+  YYSYMBOL_URSHIFT = 64,                   /* URSHIFT  */
+  YYSYMBOL_PLUS_ASSIGN = 65,               /* PLUS_ASSIGN  */
+  YYSYMBOL_MINUS_ASSIGN = 66,              /* MINUS_ASSIGN  */
+  YYSYMBOL_STAR_ASSIGN = 67,               /* STAR_ASSIGN  */
+  YYSYMBOL_SLASH_ASSIGN = 68,              /* SLASH_ASSIGN  */
+  YYSYMBOL_PERCENT_ASSIGN = 69,            /* PERCENT_ASSIGN  */
+  YYSYMBOL_AND_ASSIGN = 70,                /* AND_ASSIGN  */
+  YYSYMBOL_OR_ASSIGN = 71,                 /* OR_ASSIGN  */
+  YYSYMBOL_XOR_ASSIGN = 72,                /* XOR_ASSIGN  */
+  YYSYMBOL_LSHIFT_ASSIGN = 73,             /* LSHIFT_ASSIGN  */
+  YYSYMBOL_RSHIFT_ASSIGN = 74,             /* RSHIFT_ASSIGN  */
+  YYSYMBOL_URSHIFT_ASSIGN = 75,            /* URSHIFT_ASSIGN  */
+  YYSYMBOL_ARROW = 76,                     /* ARROW  */
+  YYSYMBOL_ELLIPSIS = 77,                  /* ELLIPSIS  */
+  YYSYMBOL_ARROW_HEAD = 78,                /* ARROW_HEAD  */
+  YYSYMBOL_79_ = 79,                       /* '='  */
+  YYSYMBOL_80_ = 80,                       /* '?'  */
+  YYSYMBOL_81_ = 81,                       /* ':'  */
+  YYSYMBOL_82_ = 82,                       /* '|'  */
+  YYSYMBOL_83_ = 83,                       /* '^'  */
+  YYSYMBOL_84_ = 84,                       /* '&'  */
+  YYSYMBOL_85_ = 85,                       /* '<'  */
+  YYSYMBOL_86_ = 86,                       /* '>'  */
+  YYSYMBOL_87_ = 87,                       /* '+'  */
+  YYSYMBOL_88_ = 88,                       /* '-'  */
+  YYSYMBOL_89_ = 89,                       /* '*'  */
+  YYSYMBOL_90_ = 90,                       /* '/'  */
+  YYSYMBOL_91_ = 91,                       /* '%'  */
+  YYSYMBOL_UMINUS = 92,                    /* UMINUS  */
+  YYSYMBOL_93_ = 93,                       /* '!'  */
+  YYSYMBOL_94_ = 94,                       /* '~'  */
+  YYSYMBOL_IF_NO_ELSE = 95,                /* IF_NO_ELSE  */
+  YYSYMBOL_96_ = 96,                       /* ';'  */
+  YYSYMBOL_97_ = 97,                       /* ','  */
+  YYSYMBOL_98_ = 98,                       /* '{'  */
+  YYSYMBOL_99_ = 99,                       /* '}'  */
+  YYSYMBOL_100_ = 100,                     /* '('  */
+  YYSYMBOL_101_ = 101,                     /* ')'  */
+  YYSYMBOL_102_ = 102,                     /* '.'  */
+  YYSYMBOL_103_ = 103,                     /* '['  */
+  YYSYMBOL_104_ = 104,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 105,                 /* $accept  */
+  YYSYMBOL_program = 106,                  /* program  */
+  YYSYMBOL_module_item_list = 107,         /* module_item_list  */
+  YYSYMBOL_module_item = 108,              /* module_item  */
+  YYSYMBOL_stmt_list = 109,                /* stmt_list  */
+  YYSYMBOL_stmt = 110,                     /* stmt  */
+  YYSYMBOL_import_stmt = 111,              /* import_stmt  */
+  YYSYMBOL_import_clause = 112,            /* import_clause  */
+  YYSYMBOL_named_imports = 113,            /* named_imports  */
+  YYSYMBOL_import_specifier_list = 114,    /* import_specifier_list  */
+  YYSYMBOL_import_specifier = 115,         /* import_specifier  */
+  YYSYMBOL_import_default_binding = 116,   /* import_default_binding  */
+  YYSYMBOL_namespace_import = 117,         /* namespace_import  */
+  YYSYMBOL_module_specifier = 118,         /* module_specifier  */
+  YYSYMBOL_export_stmt = 119,              /* export_stmt  */
+  YYSYMBOL_export_clause = 120,            /* export_clause  */
+  YYSYMBOL_export_specifier_list = 121,    /* export_specifier_list  */
+  YYSYMBOL_export_specifier = 122,         /* export_specifier  */
+  YYSYMBOL_from_keyword = 123,             /* from_keyword  */
+  YYSYMBOL_as_keyword = 124,               /* as_keyword  */
+  YYSYMBOL_block = 125,                    /* block  */
+  YYSYMBOL_var_stmt = 126,                 /* var_stmt  */
+  YYSYMBOL_var_stmt_no_in = 127,           /* var_stmt_no_in  */
+  YYSYMBOL_var_decl_list = 128,            /* var_decl_list  */
+  YYSYMBOL_var_decl_list_no_in = 129,      /* var_decl_list_no_in  */
+  YYSYMBOL_var_decl = 130,                 /* var_decl  */
+  YYSYMBOL_var_decl_no_in = 131,           /* var_decl_no_in  */
+  YYSYMBOL_return_stmt = 132,              /* return_stmt  */
+  YYSYMBOL_if_stmt = 133,                  /* if_stmt  */
+  YYSYMBOL_for_stmt = 134,                 /* for_stmt  */
+  YYSYMBOL_while_stmt = 135,               /* while_stmt  */
+  YYSYMBOL_do_stmt = 136,                  /* do_stmt  */
+  YYSYMBOL_for_init = 137,                 /* for_init  */
+  YYSYMBOL_for_in_left = 138,              /* for_in_left  */
+  YYSYMBOL_for_of_keyword = 139,           /* for_of_keyword  */
+  YYSYMBOL_opt_expr = 140,                 /* opt_expr  */
+  YYSYMBOL_switch_stmt = 141,              /* switch_stmt  */
+  YYSYMBOL_switch_case_list = 142,         /* switch_case_list  */
+  YYSYMBOL_switch_case = 143,              /* switch_case  */
+  YYSYMBOL_case_stmt_seq = 144,            /* case_stmt_seq  */
+  YYSYMBOL_generator_marker_opt = 145,     /* generator_marker_opt  */
+  YYSYMBOL_async_modifier_opt = 146,       /* async_modifier_opt  */
+  YYSYMBOL_func_decl = 147,                /* func_decl  */
+  YYSYMBOL_opt_param_list = 148,           /* opt_param_list  */
+  YYSYMBOL_param_list = 149,               /* param_list  */
+  YYSYMBOL_param_list_items = 150,         /* param_list_items  */
+  YYSYMBOL_rest_param = 151,               /* rest_param  */
+  YYSYMBOL_catch_clause = 152,             /* catch_clause  */
+  YYSYMBOL_catch_parameter = 153,          /* catch_parameter  */
+  YYSYMBOL_finally_clause = 154,           /* finally_clause  */
+  YYSYMBOL_finally_clause_opt = 155,       /* finally_clause_opt  */
+  YYSYMBOL_try_stmt = 156,                 /* try_stmt  */
+  YYSYMBOL_with_stmt = 157,                /* with_stmt  */
+  YYSYMBOL_labeled_stmt = 158,             /* labeled_stmt  */
+  YYSYMBOL_break_stmt = 159,               /* break_stmt  */
+  YYSYMBOL_continue_stmt = 160,            /* continue_stmt  */
+  YYSYMBOL_throw_stmt = 161,               /* throw_stmt  */
+  YYSYMBOL_expr = 162,                     /* expr  */
+  YYSYMBOL_expr_no_obj = 163,              /* expr_no_obj  */
+  YYSYMBOL_expr_no_in_no_obj = 164,        /* expr_no_in_no_obj  */
+  YYSYMBOL_assignment_expr = 165,          /* assignment_expr  */
+  YYSYMBOL_assignment_expr_no_in = 166,    /* assignment_expr_no_in  */
+  YYSYMBOL_assignment_expr_no_obj = 167,   /* assignment_expr_no_obj  */
+  YYSYMBOL_assignment_expr_no_in_no_obj = 168, /* assignment_expr_no_in_no_obj  */
+  YYSYMBOL_conditional_expr = 169,         /* conditional_expr  */
+  YYSYMBOL_conditional_expr_no_in = 170,   /* conditional_expr_no_in  */
+  YYSYMBOL_conditional_expr_no_obj = 171,  /* conditional_expr_no_obj  */
+  YYSYMBOL_conditional_expr_no_in_no_obj = 172, /* conditional_expr_no_in_no_obj  */
+  YYSYMBOL_binary_expr = 173,              /* binary_expr  */
+  YYSYMBOL_binary_expr_no_in = 174,        /* binary_expr_no_in  */
+  YYSYMBOL_binary_expr_no_obj = 175,       /* binary_expr_no_obj  */
+  YYSYMBOL_binary_expr_no_in_no_obj = 176, /* binary_expr_no_in_no_obj  */
+  YYSYMBOL_binary_chain = 177,             /* binary_chain  */
+  YYSYMBOL_binary_chain_no_in = 178,       /* binary_chain_no_in  */
+  YYSYMBOL_binary_chain_no_obj = 179,      /* binary_chain_no_obj  */
+  YYSYMBOL_binary_chain_no_in_no_obj = 180, /* binary_chain_no_in_no_obj  */
+  YYSYMBOL_binary_operator = 181,          /* binary_operator  */
+  YYSYMBOL_binary_operator_no_in = 182,    /* binary_operator_no_in  */
+  YYSYMBOL_unary_expr = 183,               /* unary_expr  */
+  YYSYMBOL_unary_expr_no_obj = 184,        /* unary_expr_no_obj  */
+  YYSYMBOL_postfix_expr = 185,             /* postfix_expr  */
+  YYSYMBOL_postfix_expr_no_obj = 186,      /* postfix_expr_no_obj  */
+  YYSYMBOL_left_hand_side_expr = 187,      /* left_hand_side_expr  */
+  YYSYMBOL_left_hand_side_expr_no_obj = 188, /* left_hand_side_expr_no_obj  */
+  YYSYMBOL_member_expr = 189,              /* member_expr  */
+  YYSYMBOL_member_expr_no_obj = 190,       /* member_expr_no_obj  */
+  YYSYMBOL_new_expr = 191,                 /* new_expr  */
+  YYSYMBOL_new_expr_no_obj = 192,          /* new_expr_no_obj  */
+  YYSYMBOL_call_expr = 193,                /* call_expr  */
+  YYSYMBOL_call_expr_no_obj = 194,         /* call_expr_no_obj  */
+  YYSYMBOL_member_suffix_seq = 195,        /* member_suffix_seq  */
+  YYSYMBOL_member_noncall_suffix = 196,    /* member_noncall_suffix  */
+  YYSYMBOL_call_suffix_seq = 197,          /* call_suffix_seq  */
+  YYSYMBOL_call_any_suffix = 198,          /* call_any_suffix  */
+  YYSYMBOL_call_suffix_initial = 199,      /* call_suffix_initial  */
+  YYSYMBOL_opt_arg_list = 200,             /* opt_arg_list  */
+  YYSYMBOL_arg_list = 201,                 /* arg_list  */
+  YYSYMBOL_arg_item = 202,                 /* arg_item  */
+  YYSYMBOL_primary_expr = 203,             /* primary_expr  */
+  YYSYMBOL_primary_expr_no_obj = 204,      /* primary_expr_no_obj  */
+  YYSYMBOL_function_expr = 205,            /* function_expr  */
+  YYSYMBOL_class_decl = 206,               /* class_decl  */
+  YYSYMBOL_class_expr = 207,               /* class_expr  */
+  YYSYMBOL_class_heritage_opt = 208,       /* class_heritage_opt  */
+  YYSYMBOL_class_body = 209,               /* class_body  */
+  YYSYMBOL_class_element_list_opt = 210,   /* class_element_list_opt  */
+  YYSYMBOL_class_element_list = 211,       /* class_element_list  */
+  YYSYMBOL_class_element = 212,            /* class_element  */
+  YYSYMBOL_method_definition = 213,        /* method_definition  */
+  YYSYMBOL_method_head = 214,              /* method_head  */
+  YYSYMBOL_getter_definition = 215,        /* getter_definition  */
+  YYSYMBOL_setter_definition = 216,        /* setter_definition  */
+  YYSYMBOL_method_name = 217,              /* method_name  */
+  YYSYMBOL_arrow_function = 218,           /* arrow_function  */
+  YYSYMBOL_arrow_body = 219,               /* arrow_body  */
+  YYSYMBOL_yield_expr = 220,               /* yield_expr  */
+  YYSYMBOL_array_literal = 221,            /* array_literal  */
+  YYSYMBOL_elision = 222,                  /* elision  */
+  YYSYMBOL_elision_opt = 223,              /* elision_opt  */
+  YYSYMBOL_element_list = 224,             /* element_list  */
+  YYSYMBOL_el_item = 225,                  /* el_item  */
+  YYSYMBOL_spread_element = 226,           /* spread_element  */
+  YYSYMBOL_opt_trailing_comma = 227,       /* opt_trailing_comma  */
+  YYSYMBOL_object_literal = 228,           /* object_literal  */
+  YYSYMBOL_template_literal = 229,         /* template_literal  */
+  YYSYMBOL_template_part_list = 230,       /* template_part_list  */
+  YYSYMBOL_prop_list = 231,                /* prop_list  */
+  YYSYMBOL_prop = 232,                     /* prop  */
+  YYSYMBOL_computed_property = 233,        /* computed_property  */
+  YYSYMBOL_property_name = 234,            /* property_name  */
+  YYSYMBOL_property_name_keyword = 235,    /* property_name_keyword  */
+  YYSYMBOL_binding_initializer_opt = 236,  /* binding_initializer_opt  */
+  YYSYMBOL_binding_initializer_opt_no_in = 237, /* binding_initializer_opt_no_in  */
+  YYSYMBOL_binding_element = 238,          /* binding_element  */
+  YYSYMBOL_object_binding = 239,           /* object_binding  */
+  YYSYMBOL_binding_property_sequence = 240, /* binding_property_sequence  */
+  YYSYMBOL_binding_property_list = 241,    /* binding_property_list  */
+  YYSYMBOL_binding_property = 242,         /* binding_property  */
+  YYSYMBOL_binding_rest_property = 243,    /* binding_rest_property  */
+  YYSYMBOL_array_binding = 244,            /* array_binding  */
+  YYSYMBOL_binding_element_list = 245,     /* binding_element_list  */
+  YYSYMBOL_binding_elision_opt = 246,      /* binding_elision_opt  */
+  YYSYMBOL_binding_elision = 247,          /* binding_elision  */
+  YYSYMBOL_binding_rest_element = 248,     /* binding_rest_element  */
+  YYSYMBOL_assignment_pattern = 249,       /* assignment_pattern  */
+  YYSYMBOL_object_assignment_pattern = 250, /* object_assignment_pattern  */
+  YYSYMBOL_assignment_property_sequence = 251, /* assignment_property_sequence  */
+  YYSYMBOL_assignment_property_list = 252, /* assignment_property_list  */
+  YYSYMBOL_assignment_property = 253,      /* assignment_property  */
+  YYSYMBOL_assignment_rest_element = 254,  /* assignment_rest_element  */
+  YYSYMBOL_array_assignment_pattern = 255, /* array_assignment_pattern  */
+  YYSYMBOL_assignment_element_list = 256,  /* assignment_element_list  */
+  YYSYMBOL_assignment_element = 257,       /* assignment_element  */
+  YYSYMBOL_assignment_target = 258,        /* assignment_target  */
+  YYSYMBOL_for_binding = 259,              /* for_binding  */
+  YYSYMBOL_for_binding_declarator = 260    /* for_binding_declarator  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined JSFAST_STYPE_IS_TRIVIAL && JSFAST_STYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   6703
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  105
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  156
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  529
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  895
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   336
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    93,     2,     2,     2,    91,    84,     2,
+     100,   101,    89,    87,    97,    88,   102,    90,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    81,    96,
+      85,    79,    86,    80,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   103,     2,   104,    83,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    98,    82,    99,    94,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,     2,    92,    95
+};
+
+#if JSFAST_DEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   762,   762,   778,   779,   787,   789,   791,   797,   798,
+     803,   805,   807,   809,   811,   813,   815,   817,   819,   821,
+     823,   825,   827,   829,   831,   833,   835,   837,   842,   844,
+     849,   851,   853,   855,   857,   862,   864,   869,   871,   876,
+     878,   880,   885,   890,   895,   900,   902,   904,   906,   908,
+     910,   912,   914,   916,   918,   923,   925,   930,   932,   937,
+     939,   941,   943,   945,   947,   952,   963,   974,   979,   981,
+     983,   988,   990,   992,   997,   999,  1004,  1006,  1011,  1013,
+    1015,  1020,  1022,  1024,  1029,  1031,  1036,  1038,  1043,  1045,
+    1047,  1049,  1054,  1059,  1065,  1066,  1068,  1073,  1075,  1077,
+    1082,  1094,  1095,  1100,  1106,  1107,  1112,  1114,  1120,  1121,
+    1126,  1129,  1133,  1136,  1140,  1150,  1165,  1166,  1171,  1173,
+    1175,  1180,  1182,  1187,  1192,  1197,  1199,  1201,  1206,  1212,
+    1213,  1218,  1220,  1225,  1230,  1235,  1237,  1242,  1244,  1249,
+    1258,  1260,  1265,  1267,  1272,  1274,  1279,  1287,  1289,  1291,
+    1293,  1295,  1297,  1299,  1301,  1303,  1305,  1307,  1309,  1311,
+    1313,  1318,  1326,  1328,  1330,  1332,  1334,  1336,  1338,  1340,
+    1342,  1344,  1346,  1348,  1350,  1352,  1357,  1365,  1367,  1369,
+    1371,  1373,  1375,  1377,  1379,  1381,  1383,  1385,  1387,  1389,
+    1391,  1396,  1404,  1406,  1408,  1410,  1412,  1414,  1416,  1418,
+    1420,  1422,  1424,  1426,  1428,  1430,  1435,  1437,  1442,  1444,
+    1449,  1451,  1456,  1458,  1466,  1468,  1473,  1475,  1480,  1482,
+    1487,  1489,  1494,  1496,  1501,  1503,  1508,  1510,  1515,  1517,
+    1522,  1524,  1526,  1528,  1530,  1532,  1534,  1536,  1538,  1540,
+    1542,  1544,  1546,  1548,  1550,  1552,  1554,  1556,  1558,  1560,
+    1562,  1564,  1566,  1568,  1573,  1575,  1577,  1579,  1581,  1583,
+    1585,  1587,  1589,  1591,  1593,  1595,  1597,  1599,  1601,  1603,
+    1605,  1607,  1609,  1611,  1613,  1615,  1617,  1623,  1625,  1627,
+    1629,  1631,  1633,  1635,  1637,  1639,  1641,  1643,  1648,  1650,
+    1652,  1654,  1656,  1658,  1660,  1662,  1664,  1666,  1668,  1673,
+    1675,  1677,  1682,  1684,  1686,  1691,  1693,  1698,  1700,  1705,
+    1707,  1712,  1714,  1719,  1721,  1726,  1728,  1733,  1738,  1744,
+    1745,  1750,  1752,  1754,  1759,  1761,  1766,  1768,  1773,  1779,
+    1780,  1785,  1787,  1792,  1794,  1800,  1802,  1804,  1806,  1808,
+    1810,  1812,  1814,  1816,  1818,  1820,  1822,  1824,  1826,  1828,
+    1830,  1835,  1837,  1839,  1841,  1843,  1845,  1847,  1849,  1851,
+    1853,  1855,  1857,  1859,  1861,  1866,  1876,  1889,  1894,  1896,
+    1901,  1904,  1908,  1914,  1915,  1920,  1922,  1928,  1930,  1938,
+    1946,  1953,  1958,  1960,  1965,  1970,  1979,  1992,  2005,  2007,
+    2013,  2019,  2024,  2031,  2040,  2046,  2051,  2053,  2055,  2060,
+    2062,  2064,  2066,  2071,  2073,  2079,  2080,  2085,  2087,  2092,
+    2097,  2099,  2104,  2109,  2110,  2114,  2116,  2121,  2127,  2138,
+    2146,  2159,  2161,  2166,  2168,  2173,  2175,  2177,  2179,  2181,
+    2186,  2192,  2193,  2197,  2198,  2199,  2200,  2201,  2202,  2203,
+    2204,  2205,  2206,  2207,  2208,  2209,  2210,  2211,  2212,  2213,
+    2214,  2215,  2216,  2217,  2218,  2219,  2220,  2221,  2222,  2223,
+    2224,  2225,  2226,  2227,  2228,  2229,  2230,  2231,  2232,  2233,
+    2234,  2235,  2240,  2241,  2247,  2248,  2253,  2255,  2257,  2262,
+    2264,  2269,  2271,  2273,  2278,  2280,  2285,  2287,  2289,  2298,
+    2303,  2305,  2307,  2309,  2314,  2316,  2322,  2323,  2328,  2330,
+    2335,  2340,  2342,  2347,  2349,  2354,  2356,  2358,  2363,  2365,
+    2370,  2372,  2374,  2383,  2388,  2390,  2392,  2394,  2399,  2401,
+    2406,  2411,  2413,  2415,  2420,  2422,  2424,  2429,  2431,  2433
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "VAR", "LET", "CONST",
+  "FUNCTION", "FUNCTION_DECL", "IF", "ELSE", "FOR", "RETURN", "ASYNC",
+  "AWAIT", "IMPORT", "EXPORT", "WHILE", "DO", "BREAK", "CONTINUE",
+  "SWITCH", "CASE", "DEFAULT", "TRY", "CATCH", "FINALLY", "THROW", "NEW",
+  "THIS", "TYPEOF", "DELETE", "IN", "INSTANCEOF", "VOID", "WITH",
+  "DEBUGGER", "CLASS", "EXTENDS", "SUPER", "YIELD", "TRUE", "FALSE",
+  "NULL_T", "UNDEFINED", "IDENTIFIER", "NUMBER", "STRING", "REGEX",
+  "TEMPLATE_NO_SUB", "TEMPLATE_HEAD", "TEMPLATE_MIDDLE", "TEMPLATE_TAIL",
+  "PLUS_PLUS", "MINUS_MINUS", "EQ", "NE", "EQ_STRICT", "NE_STRICT", "LE",
+  "GE", "AND", "OR", "LSHIFT", "RSHIFT", "URSHIFT", "PLUS_ASSIGN",
+  "MINUS_ASSIGN", "STAR_ASSIGN", "SLASH_ASSIGN", "PERCENT_ASSIGN",
+  "AND_ASSIGN", "OR_ASSIGN", "XOR_ASSIGN", "LSHIFT_ASSIGN",
+  "RSHIFT_ASSIGN", "URSHIFT_ASSIGN", "ARROW", "ELLIPSIS", "ARROW_HEAD",
+  "'='", "'?'", "':'", "'|'", "'^'", "'&'", "'<'", "'>'", "'+'", "'-'",
+  "'*'", "'/'", "'%'", "UMINUS", "'!'", "'~'", "IF_NO_ELSE", "';'", "','",
+  "'{'", "'}'", "'('", "')'", "'.'", "'['", "']'", "$accept", "program",
+  "module_item_list", "module_item", "stmt_list", "stmt", "import_stmt",
+  "import_clause", "named_imports", "import_specifier_list",
+  "import_specifier", "import_default_binding", "namespace_import",
+  "module_specifier", "export_stmt", "export_clause",
+  "export_specifier_list", "export_specifier", "from_keyword",
+  "as_keyword", "block", "var_stmt", "var_stmt_no_in", "var_decl_list",
+  "var_decl_list_no_in", "var_decl", "var_decl_no_in", "return_stmt",
+  "if_stmt", "for_stmt", "while_stmt", "do_stmt", "for_init",
+  "for_in_left", "for_of_keyword", "opt_expr", "switch_stmt",
+  "switch_case_list", "switch_case", "case_stmt_seq",
+  "generator_marker_opt", "async_modifier_opt", "func_decl",
+  "opt_param_list", "param_list", "param_list_items", "rest_param",
+  "catch_clause", "catch_parameter", "finally_clause",
+  "finally_clause_opt", "try_stmt", "with_stmt", "labeled_stmt",
+  "break_stmt", "continue_stmt", "throw_stmt", "expr", "expr_no_obj",
+  "expr_no_in_no_obj", "assignment_expr", "assignment_expr_no_in",
+  "assignment_expr_no_obj", "assignment_expr_no_in_no_obj",
+  "conditional_expr", "conditional_expr_no_in", "conditional_expr_no_obj",
+  "conditional_expr_no_in_no_obj", "binary_expr", "binary_expr_no_in",
+  "binary_expr_no_obj", "binary_expr_no_in_no_obj", "binary_chain",
+  "binary_chain_no_in", "binary_chain_no_obj", "binary_chain_no_in_no_obj",
+  "binary_operator", "binary_operator_no_in", "unary_expr",
+  "unary_expr_no_obj", "postfix_expr", "postfix_expr_no_obj",
+  "left_hand_side_expr", "left_hand_side_expr_no_obj", "member_expr",
+  "member_expr_no_obj", "new_expr", "new_expr_no_obj", "call_expr",
+  "call_expr_no_obj", "member_suffix_seq", "member_noncall_suffix",
+  "call_suffix_seq", "call_any_suffix", "call_suffix_initial",
+  "opt_arg_list", "arg_list", "arg_item", "primary_expr",
+  "primary_expr_no_obj", "function_expr", "class_decl", "class_expr",
+  "class_heritage_opt", "class_body", "class_element_list_opt",
+  "class_element_list", "class_element", "method_definition",
+  "method_head", "getter_definition", "setter_definition", "method_name",
+  "arrow_function", "arrow_body", "yield_expr", "array_literal", "elision",
+  "elision_opt", "element_list", "el_item", "spread_element",
+  "opt_trailing_comma", "object_literal", "template_literal",
+  "template_part_list", "prop_list", "prop", "computed_property",
+  "property_name", "property_name_keyword", "binding_initializer_opt",
+  "binding_initializer_opt_no_in", "binding_element", "object_binding",
+  "binding_property_sequence", "binding_property_list", "binding_property",
+  "binding_rest_property", "array_binding", "binding_element_list",
+  "binding_elision_opt", "binding_elision", "binding_rest_element",
+  "assignment_pattern", "object_assignment_pattern",
+  "assignment_property_sequence", "assignment_property_list",
+  "assignment_property", "assignment_rest_element",
+  "array_assignment_pattern", "assignment_element_list",
+  "assignment_element", "assignment_target", "for_binding",
+  "for_binding_declarator", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-619)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-530)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -619,    99,  1892,  -619,   105,   105,   105,    90,    52,  3917,
+      66,  4603,   279,    59,    96,  2296,    85,   102,   113,   166,
+    4225,  2750,  -619,  4603,  4603,  4603,   162,   226,  -619,  3220,
+    -619,  -619,  -619,  -619,  6260,  -619,  -619,  -619,  -619,  4225,
+    4603,  4603,   173,  4603,  4603,  4603,  4603,  -619,  -619,  4225,
+    3298,  -619,  -619,  -619,  -619,  -619,   231,   280,  -619,  -619,
+    -619,  -619,  -619,   119,  -619,  -619,  -619,  -619,   297,   317,
+     325,    73,  -619,  -619,   446,  6016,  6077,  5833,  -619,  5589,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,   218,
+    4797,    74,   236,  -619,   200,   206,   340,   383,  4225,   303,
+    1261,  4603,  2750,  -619,  4603,  4603,  4603,    45,  -619,  -619,
+    -619,  -619,  -619,  5162,  -619,  -619,  -619,  4603,  4603,  4603,
+    4603,  4603,  4603,  2599,  4225,   424,   388,  -619,  -619,   610,
+    6138,  6199,  5894,  -619,  5772,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,   322,   343,  -619,  -619,  -619,
+    5955,  -619,  -619,   417,    48,   427,  -619,    53,  -619,   379,
+    4302,   433,    56,   145,   386,   486,  -619,  -619,  4225,   488,
+    -619,  -619,  4225,   462,   392,  5650,  -619,  -619,  -619,  -619,
+    4225,    67,  4225,  -619,  4370,  2296,   441,  -619,  -619,  -619,
+     183,  -619,  -619,  -619,  -619,  2195,   133,  -619,  -619,  3376,
+    3994,    31,  -619,  -619,    33,    33,  -619,  -619,  -619,  -619,
+    4225,  4225,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  4447,  -619,  -619,  4603,  4603,  -619,  -619,  4225,
+    4225,  4225,  4225,  4225,  4225,  4225,  4225,  4225,  4225,  4225,
+    4225,  3840,  5223,  -619,  5284,  4225,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,   223,  -619,  -619,   473,  -619,   440,
+     425,   347,  -619,  -619,   307,   122,  -619,   105,  4225,  4225,
+     208,   675,   165,   165,   165,  5101,  4881,  3454,  -619,   432,
+     245,   403,  -619,  -619,   241,   970,  4695,  6428,  6382,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  5711,  -619,  -619,  -619,
+    -619,  4225,    67,   434,  -619,  -619,  -619,  -619,  -619,  -619,
+    2700,  2498,  4225,  1820,  -619,  4225,  -619,   430,  -619,  -619,
+    -619,  -619,   358,  -619,  -619,     5,  -619,   266,  4225,  4225,
+    4603,  4603,  -619,  -619,  4225,  4225,  4225,  4225,  4225,  4225,
+    4225,  4225,  4225,  4225,  4225,  4225,  5528,  5345,  4370,   183,
+    -619,   487,   417,    39,  -619,   365,  -619,  -619,   490,   148,
+    -619,  -619,   437,  -619,   423,   490,   494,   172,   175,  -619,
+     371,  -619,  -619,   490,  -619,   274,   439,   282,   448,   166,
+    1370,  -619,  3840,   284,   434,  -619,  -619,  -619,  -619,  -619,
+    4225,  -619,   260,   496,   445,  -619,   321,  -619,  -619,   260,
+     260,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    3532,  -619,  -619,    32,    68,  -619,   453,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,   450,   323,  -619,  -619,  6657,  4225,  -619,
+    -619,  -619,  -619,  -619,  -619,   179,  -619,  -619,   179,  -619,
+    4965,  -619,  -619,  -619,  -619,   302,   311,  -619,  -619,  -619,
+    2296,   185,   185,   185,  -619,   505,  -619,    44,   405,  -619,
+      83,   249,  -619,   412,  -619,   414,  -619,   261,  2750,  -619,
+     471,   454,   377,  -619,  -619,  3610,  3762,  4071,  4225,  -619,
+    4225,  4225,  4225,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  4525,  -619,  -619,  4603,  4603,  4225,  4225,  4225,
+    4225,  4225,  4225,  4225,  4225,  4225,  4225,  4225,  4225,  3840,
+    -619,   434,  1133,  -619,  -619,  1820,  4225,  -619,  -619,   467,
+    -619,  -619,   465,   183,  2801,   472,  4225,  -619,  -619,   491,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,   474,  -619,   530,   532,    57,
+     478,   482,  -619,  -619,  -619,   483,   427,    63,    80,    62,
+     481,   485,  2296,  4225,   484,   189,  -619,  -619,  -619,   489,
+    2296,  -619,  -619,  -619,  -619,   508,    36,  -619,  -619,  -619,
+    3688,  3994,   492,   183,   493,   183,  4225,  -619,  3994,  -619,
+     312,  -619,  -619,  -619,  -619,    76,   479,  -619,   503,  1668,
+    -619,  -619,  -619,  4225,  4225,  -619,   209,  4225,  4225,  4696,
+    -619,   199,  4696,  -619,  5049,  -619,  2902,  -619,   335,  -619,
+     311,  -619,   315,  -619,    12,   495,   332,   334,   352,  -619,
+    -619,   298,  6518,  6562,  6474,  -619,  -619,   504,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,   509,  -619,  3104,  -619,   510,  3003,  -619,
+    -619,  -619,   513,   147,    15,   511,  -619,  -619,  -619,  4225,
+     535,  -619,  -619,  -619,  -619,  -619,  -619,   490,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,   357,  -619,  -619,   512,
+    -619,  -619,  -619,  -619,  4370,  -619,  -619,  -619,   183,   518,
+     183,   520,  -619,  -619,  -619,    36,  -619,  -619,  2296,   359,
+    -619,   293,  -619,   543,   544,  -619,  -619,  -619,  -619,  -619,
+    -619,  2397,  4225,   348,   131,   521,  1494,   522,  -619,  4148,
+    2296,  2296,  4225,  4603,  4603,  4225,  4225,  4225,  4225,  4225,
+    4225,  4225,  4225,  4225,  4225,  4225,  4225,  4225,  -619,  3154,
+    -619,  -619,  -619,  -619,   166,   523,  4225,   166,  -619,  4370,
+     531,   534,    46,   166,  5406,  -619,   533,   166,   536,   166,
+    -619,   311,  -619,  2296,  6321,  -619,  4671,  -619,   538,  -619,
+    -619,   506,  -619,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,  5467,  -619,  -619,
+     166,  -619,  -619,  -619,  -619,  -619,  4225,   550,  -619,  -619,
+    -619,   166,  -619,   166,  -619,   528,  -619,   311,  -619,  2296,
+    4225,  -619,     6,  -619,  -619,  -619,  -619,   529,  -619,  -619,
+    -619,  1993,  -619,  2094,  -619
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       3,     0,     0,     1,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   352,     0,     0,     0,     0,     0,   363,     0,
+     356,   357,   358,   359,     0,   353,   354,   355,   417,     0,
+       0,     0,     0,     0,     0,     0,     0,    10,     8,     0,
+       0,     4,     5,     6,     7,    13,     0,     0,    14,    15,
+      16,    17,    18,     0,    21,    19,    20,    27,     0,     0,
+       0,     0,   142,   189,     0,     0,     0,     0,   302,     0,
+     308,   307,   319,   364,    22,   188,   190,   361,   362,     0,
+       0,     0,     0,    74,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   336,     0,     0,     0,     0,   349,   340,
+     341,   342,   343,     0,   337,   338,   339,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   140,   159,     0,
+       0,     0,     0,   299,     0,   306,   305,   319,   350,   348,
+     158,   160,   345,   346,   347,     0,     0,   112,   335,   296,
+       0,    42,    44,     0,     0,     0,    32,     0,    31,     0,
+       0,     0,     0,     0,     0,     0,    50,    51,     0,     0,
+     136,   138,     0,     0,     0,     0,   316,   293,   294,   295,
+       0,     0,     0,   397,     0,     0,     0,   418,   297,   298,
+       0,   289,   290,   291,   292,     0,     0,   403,   399,     0,
+       0,     0,    11,    23,     0,     0,    24,    25,    26,    12,
+       0,     0,   253,   243,   235,   236,   237,   238,   241,   242,
+     231,   230,   244,   245,   246,   232,   233,   234,   239,   240,
+     247,   248,     0,   251,   252,     0,     0,   303,   304,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   325,     0,     0,    78,   442,   443,   444,
+     441,   436,   437,   438,   445,   470,   471,   439,   440,   446,
+     447,   448,   449,   435,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   467,   468,   469,
+     463,   464,   465,   466,     0,   434,   433,     0,   479,     0,
+       0,     0,   484,   483,     0,     0,   497,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    95,     0,
+       0,     0,   144,   204,     0,     0,     0,     0,     0,   203,
+     205,    98,   501,   502,    97,   285,     0,   314,   282,   283,
+     284,     0,     0,     0,   286,   287,   278,   279,   280,   281,
+       0,     0,     0,     0,   415,     0,   425,     0,   426,   427,
+     382,   429,     0,   421,   428,     0,   432,     0,     0,     0,
+       0,     0,   300,   301,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      66,     0,     0,     0,    35,     0,    37,    65,     0,     0,
+      29,    52,     0,    53,     0,     0,     0,     0,     0,    55,
+       0,    57,    46,     0,    49,     0,     0,     0,     0,     0,
+       0,   132,     0,     0,     0,   398,   395,   394,   390,   134,
+       0,   419,     0,     0,     0,   117,     0,   120,   121,     0,
+       0,   123,    67,     9,   360,   404,   400,   410,   407,   411,
+       0,   401,   110,     0,     0,   143,     0,   250,   227,   226,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   176,   333,     0,     0,   331,   334,     0,     0,   327,
+     324,   326,   323,   320,   473,     0,   488,   489,     0,   480,
+       0,   481,   499,   490,   494,     0,     0,    75,    79,    80,
+       0,     0,     0,     0,   351,     0,    99,     0,     0,    76,
+       0,     0,   524,     0,   525,     0,   526,     0,     0,   503,
+       0,     0,     0,   508,   507,     0,     0,     0,     0,   100,
+       0,     0,     0,   267,   259,   260,   261,   262,   265,   266,
+     255,   254,   268,   269,   270,   256,   257,   258,   263,   264,
+     271,   272,     0,   275,   276,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     370,     0,     0,   369,   431,     0,     0,   383,   388,     0,
+     412,   384,     0,     0,     0,     0,     0,   344,   141,     0,
+     223,   222,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   146,   392,     0,    43,     0,     0,     0,
+       0,     0,    34,    33,    54,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   128,   130,   131,     0,
+       0,   367,   420,   476,   500,     0,     0,   477,   478,   402,
+       0,     0,     0,     0,     0,     0,     0,   328,     0,   321,
+       0,   486,   487,   485,   482,     0,     0,   414,     0,     0,
+     527,   528,   529,     0,     0,    81,     0,     0,     0,     0,
+     512,     0,     0,   504,     0,   505,     0,   514,     0,   522,
+       0,   523,     0,   518,     0,     0,     0,     0,     0,   145,
+     174,     0,     0,     0,     0,   173,   175,     0,   274,   229,
+     228,   192,   193,   194,   195,   196,   197,   198,   199,   200,
+     201,   202,   191,     0,   368,     0,   380,     0,     0,   376,
+     377,   385,     0,     0,     0,     0,   422,   416,   423,     0,
+       0,    41,    40,    38,    36,    28,    47,     0,    63,    62,
+      61,    60,    58,    56,    45,    92,     0,   104,   125,     0,
+     126,   127,   319,   133,     0,   119,   122,   408,     0,     0,
+       0,     0,   211,   332,   322,     0,   491,   493,     0,     0,
+     475,     0,    77,     0,     0,    82,    83,   510,   511,   509,
+     506,     0,     0,     0,     0,     0,     0,     0,   520,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   319,     0,
+     378,   372,   375,   389,     0,     0,     0,     0,   207,     0,
+       0,     0,     0,     0,     0,   391,     0,     0,     0,     0,
+     495,     0,    87,     0,     0,   517,     0,   515,     0,    89,
+      90,     0,   225,   224,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   161,   213,     0,   379,   386,
+       0,   430,   381,   393,    48,    93,     0,     0,   103,   105,
+     124,     0,   366,     0,   115,     0,    91,     0,   519,     0,
+       0,   387,     0,   108,   365,   114,   492,     0,    88,   209,
+     108,     0,   516,     0,   109
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -619,  -619,  -619,  -619,  -619,    22,  -619,  -619,   190,  -619,
+      26,  -619,   237,  -371,  -619,  -619,  -619,    21,  -133,  -149,
+      71,   628,  -619,   507,   201,   336,   -21,  -619,  -619,  -619,
+    -619,  -619,  -619,   337,   142,  -140,  -619,  -619,  -619,  -240,
+     449,    16,    35,  -378,  -619,  -619,    19,  -619,  -619,   233,
+    -619,  -619,  -619,  -619,  -619,  -619,  -619,    -5,  -619,  -619,
+     710,   413,  -146,  -619,  -619,  -619,  -619,  -619,  -619,  -619,
+    -619,  -619,  -619,  -619,  -619,  -619,   164,  -301,  1085,   551,
+     998,   556,  -619,   -64,    29,  -619,    40,  -619,  -619,  -619,
+    -136,  -194,   537,  -619,  -192,  -369,  -619,     9,  -619,  -619,
+     106,    42,  -619,  -132,  -367,  -619,  -619,   -54,  -531,  -619,
+    -619,  -619,  -318,    -2,  -381,    37,   115,   213,   219,  -619,
+      27,  -106,  -336,  -619,    54,   244,  -619,    91,  -619,  -103,
+     -88,   -70,  -619,  -300,     4,  -619,  -619,   187,   192,    17,
+    -619,  -314,  -264,  -299,  -619,   -57,  -619,  -619,    11,  -510,
+     -55,  -619,  -618,  -619,  -619,  -267
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     2,    51,   195,   894,    53,   155,   156,   395,
+     396,   157,   158,   159,    54,   163,   410,   411,   398,   391,
+      55,    56,   318,    92,   508,    93,   509,    57,    58,    59,
+      60,    61,   319,   320,   530,   685,    62,   822,   869,   891,
+     453,   125,    64,   434,   435,   436,   437,   420,   749,   421,
+     628,    65,    66,    67,    68,    69,    70,   686,    71,   321,
+     127,   689,    72,   322,   128,   690,    73,   323,   129,   691,
+      74,   324,   130,   692,    75,   325,   235,   555,   131,    76,
+     132,    77,   133,    78,   134,    79,   135,    80,   136,    81,
+     254,   483,   252,   480,   253,   473,   474,   475,   137,    82,
+     138,    84,   139,   343,   573,   717,   718,   719,   356,   357,
+     358,   359,   360,   140,   428,   141,   142,   199,   200,   201,
+     448,   476,   491,   143,   144,   187,   362,   363,   364,   578,
+     366,   670,   665,   438,   439,   300,   301,   302,   303,   440,
+     495,   305,   306,   441,   331,   679,   521,   522,   523,   524,
+     681,   682,   683,   684,   334,   512
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      85,   387,   299,   526,   126,   494,   496,   604,    94,    94,
+      94,   605,   406,    85,   402,   174,   680,   361,    63,   256,
+     365,    95,    95,    95,    52,   556,   585,   611,   405,   165,
+     413,    63,   577,   579,   615,   581,   328,   169,   427,    86,
+     492,   720,   621,   332,   196,   333,   514,   516,   166,   424,
+     175,   777,    86,   629,   778,   167,    88,   631,   479,   610,
+     481,   176,     4,     5,     6,    99,  -113,   866,   867,    88,
+     392,   147,  -112,  -112,   620,  -527,   642,  -111,   407,   392,
+     432,   160,   341,   390,   407,   738,   586,   890,  -527,   342,
+     173,   255,   393,   310,   449,    27,   816,   -30,   329,     3,
+     408,   393,   740,   368,   341,  -388,   408,   739,    83,  -472,
+     145,  -472,   644,   433,  -528,  -389,  -472,    87,  -496,   367,
+    -496,    83,   452,   664,   741,   204,   205,  -528,   450,   170,
+      87,   336,   643,  -111,    90,   451,   -39,   330,   -39,    91,
+    -474,  -474,   337,  -371,   146,   868,   171,   394,   161,    89,
+     399,  -496,   100,  -496,    88,   409,  -414,   162,    85,   656,
+     658,  -414,   667,   415,   780,  -371,   432,   417,   645,   209,
+     210,   304,  -496,   304,  -496,   423,    63,  -496,  -496,  -496,
+    -414,  -135,    85,    85,   810,   651,   675,   720,   652,   397,
+      98,   432,   479,    85,   481,   401,   168,    86,  -137,   433,
+     713,    63,   403,    90,   714,   725,    83,   429,    91,   507,
+     571,    63,   672,   172,    88,    87,   390,   443,   878,   390,
+      90,    86,    86,   432,   486,    91,   493,   432,   520,   660,
+     368,  -432,    86,   748,   444,   514,   516,   153,    88,    88,
+     236,   412,   427,   607,   608,    90,   154,   506,   814,    88,
+      91,   372,   373,   771,   332,   426,   333,   721,   617,   618,
+     433,   492,   180,    90,    48,   759,    83,   761,    91,   -64,
+     181,   -64,   -59,   190,   -59,    87,   528,    90,   858,   308,
+    -529,    90,    91,    90,  -116,   309,    91,    90,    91,   529,
+      83,    83,    91,  -529,   370,   371,  -513,   255,  -513,    87,
+      87,    83,   255,  -513,   485,   368,   482,    90,   482,   500,
+      87,    94,    91,  -498,  -472,  -472,   510,   510,   510,  -498,
+    -472,   532,  -472,   151,    95,   152,   877,   202,   668,   511,
+     511,   511,   -68,   307,  -498,  -498,   756,  -212,  -212,   255,
+     255,   765,   669,  -498,   785,  -498,   787,  -498,  -498,  -498,
+    -498,  -498,  -498,  -498,  -498,  -498,  -498,  -472,  -472,  -472,
+    -472,  -472,   633,   368,  -472,    88,   820,   587,   153,   637,
+     638,   368,   664,   825,   649,   622,   203,   154,   792,   368,
+     826,   368,   828,   624,  -498,   630,    85,   372,   373,  -474,
+    -474,   793,   794,   206,  -208,  -208,  -415,  -415,   388,   655,
+    -415,  -415,   299,   311,   304,  -498,  -413,  -498,   657,   368,
+    -498,  -498,   786,   207,  -521,  -413,   764,    83,   636,  -413,
+     648,   208,  -118,   815,  -330,    86,    87,  -415,  -102,   368,
+     204,   368,  -521,  -102,  -521,   790,   -69,   307,   863,  -521,
+     482,   482,    88,   389,   490,  -415,  -413,  -415,  -415,   368,
+    -415,  -415,  -415,   791,   368,   584,   368,  -413,   821,   426,
+     833,   390,   609,   579,  -413,   830,   831,   -66,   619,   -65,
+    -413,   397,   836,   650,   674,   400,  -413,   404,   361,   -70,
+     307,   365,   414,   737,   -85,   368,   418,   419,  -139,   368,
+     626,   430,   431,   205,    83,   875,  -210,  -210,    85,   -96,
+     531,   -71,   666,    87,   416,   661,   661,   661,   -72,   666,
+     -73,   666,    96,    97,   513,   515,    63,   487,   662,   662,
+     662,   488,   659,   687,   489,   688,   211,  -210,   527,   695,
+     583,   606,   572,   614,   646,   449,   152,    86,   616,   623,
+     634,   887,  -210,  -210,  -210,  -210,   635,  -210,   625,   529,
+    -210,   647,   672,   673,    88,   695,   695,   695,   695,   695,
+     695,   695,   695,   695,   695,   695,   695,   723,   696,   724,
+     361,   727,   729,   365,   731,   730,   732,   734,   735,   736,
+     743,   744,   747,   766,   754,   807,   520,   880,   784,   612,
+     752,   789,   758,   760,   696,   696,   696,   696,   696,   696,
+     696,   696,   696,   696,   696,   696,    83,   767,   427,   811,
+     808,   819,   817,   823,   788,    87,   824,   813,   746,   827,
+      85,   829,   667,   668,   860,   835,   837,   864,    85,   750,
+     865,   883,   886,   892,   871,   733,   613,   873,    63,   879,
+     742,   164,   751,   497,   745,   772,    63,   663,   505,   838,
+     893,   326,   753,   627,   454,   755,   327,   763,   769,    86,
+    -206,  -206,   695,   640,   812,   695,   695,    86,   757,   641,
+     773,   386,   857,   427,   632,   726,    88,   653,   501,   502,
+     503,  -113,   654,   774,    88,   779,     0,   147,     0,     0,
+     369,  -206,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   696,    21,    22,   696,   696,  -206,  -206,  -206,  -206,
+       0,  -206,     0,    28,  -206,    30,    31,    32,    33,   504,
+      35,    36,    37,    38,    39,     0,     0,     0,    83,     0,
+       0,     0,     0,     0,     0,     0,    83,    87,     0,   183,
+       0,     0,     0,     0,     0,    87,     0,     0,     0,   186,
+       0,     0,    85,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    85,     0,     0,     0,
+       0,     0,     0,   316,     0,    49,     0,     0,   317,     0,
+       0,     0,     0,     0,    63,     0,     0,     0,    85,    85,
+     832,    86,     0,   695,   695,   695,   695,   695,   695,   695,
+     695,   695,   695,   695,   695,    86,    63,    63,    88,     0,
+       0,     0,   839,   840,     0,     0,     0,    85,     0,     0,
+       0,     0,    88,     0,     0,   426,     0,    86,    86,     0,
+       0,    85,   696,   696,   696,   696,   696,   696,   696,   696,
+     696,   696,   696,   696,    88,    88,     0,     0,     0,    63,
+       0,     0,     0,     0,     0,   876,    86,     0,     0,     0,
+      83,   882,     0,     0,     0,     0,     0,     0,     0,    87,
+      86,     0,     0,    88,    83,     0,     0,    85,   482,     0,
+       0,     0,     0,    87,     0,   859,     0,    88,   862,    85,
+     426,    85,   425,     0,   870,    63,    83,    83,   872,     0,
+     874,   888,     0,     0,     0,    87,    87,    63,     0,    63,
+     447,   482,     0,     0,     0,     0,    86,     0,     0,     0,
+     455,   456,     0,     0,     0,    83,     0,     0,    86,     0,
+      86,   881,     0,    88,    87,     0,     0,     0,     0,    83,
+       0,     0,   884,     0,   885,    88,     0,    88,    87,   460,
+     461,   462,   463,   464,   465,   466,   467,   468,   469,   470,
+     471,   472,     0,     0,     0,   484,     0,     0,     0,     0,
+     701,   702,   703,   704,   705,   706,   707,   708,   709,   710,
+     711,   712,     0,     0,     0,    83,     0,     0,     0,     0,
+       0,     0,     0,     0,    87,     0,     0,    83,     0,    83,
+       0,     0,   533,     0,     0,     0,    87,     0,    87,   150,
+       0,     0,     0,     0,     0,     0,     0,     0,   498,   499,
+       0,   150,   150,   150,   534,   535,   536,   537,   538,   539,
+     540,   541,   542,   543,   544,     0,     0,     0,   150,   150,
+       0,   150,   150,   150,   150,     0,     0,     0,     0,     0,
+    -221,   570,   545,   546,   547,   548,   549,   550,   551,   552,
+     553,   554,   580,     0,     0,   582,  -221,  -221,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   770,   588,   589,
+     775,   776,     0,     0,   592,   593,   594,   595,   596,   597,
+     598,   599,   600,   601,   602,   603,   149,     0,     0,   150,
+       0,     0,   150,   150,   150,     0,     0,     0,   177,   178,
+     179,     0,     0,     0,     0,   150,   150,   150,   150,   150,
+     150,     0,     0,     0,     0,   188,   189,     0,   191,   192,
+     193,   194,   472,     0,     0,     0,   257,   258,   259,   260,
+     186,   261,   262,   263,   264,   350,   266,     0,     0,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,     0,   290,   291,   292,   293,   715,   295,   296,
+       0,     0,     0,     0,     0,     0,   335,     0,     0,   338,
+     339,   340,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   344,   345,   346,   347,   348,   349,   844,   845,
+     846,   847,   848,   849,   850,   851,   852,   853,   854,   855,
+       0,     0,   353,     0,     0,     0,     0,     0,     0,   716,
+       0,     0,  -373,   150,   150,     0,   576,     0,     0,     0,
+       0,     0,   697,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   312,   313,   314,  -113,     0,     0,
+       0,     0,     0,    10,    11,     0,     0,     0,     0,   472,
+       0,     0,     0,     0,     0,     0,   722,     0,    21,    22,
+      23,    24,     0,     0,    25,     0,   728,     0,     0,    28,
+      29,    30,    31,    32,    33,   315,    35,    36,    37,    38,
+      39,     0,     0,    40,    41,     0,     0,     0,     0,     0,
+     458,   459,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    42,
+       0,     0,     0,     0,     0,     0,     0,     0,    43,    44,
+       0,   447,     0,     0,    45,    46,   762,   -94,   472,   316,
+       0,    49,     0,     0,   317,     0,     0,     0,   150,   150,
+    -129,     0,     0,  -129,  -129,  -129,  -129,  -129,  -129,  -129,
+    -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,
+    -129,  -129,  -129,  -129,     0,   419,  -129,  -129,  -129,  -129,
+    -129,     0,     0,  -129,  -129,     0,  -129,     0,  -129,  -129,
+    -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,
+       0,     0,  -129,  -129,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   818,
+       0,     0,     0,     0,     0,     0,     0,     0,  -129,     0,
+       0,     0,     0,     0,     0,   590,   591,  -129,  -129,     0,
+       0,     0,     0,  -129,  -129,     0,  -129,     0,  -129,  -129,
+    -129,     0,     0,  -129,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   580,     0,     0,     0,     0,     0,     0,     0,
+    -496,     0,   841,     0,     0,     0,  -496,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   671,   856,     0,     0,
+       0,  -496,  -496,     0,   678,     0,   861,     0,     0,   694,
+    -496,     0,  -496,     0,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   150,   150,   694,   694,   694,   694,   694,
+     694,   694,   694,   694,   694,   694,   694,     0,     0,     0,
+       0,  -496,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     889,   304,  -496,     0,  -496,     0,     0,  -496,  -414,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   693,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     699,   700,   693,   693,   693,   693,   693,   693,   693,   693,
+     693,   693,   693,   693,     0,     0,     0,     0,     0,     0,
+       0,     0,   694,     0,     0,   694,   694,   678,   -86,     0,
+     678,   -86,   -86,   -86,   -86,   -86,   -86,   768,   -86,   -86,
+     -86,   -86,   -86,   -86,   -86,   -86,   -86,   -86,   -86,   -86,
+     -86,   -86,     0,     0,   -86,   -86,   -86,   -86,   -86,     0,
+       0,   -86,   -86,     0,   -86,     0,   -86,   -86,   -86,   -86,
+     -86,   -86,   -86,   -86,   -86,   -86,   -86,   -86,     0,     0,
+     -86,   -86,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   -86,     0,     0,   693,
+       0,     0,   693,   693,     0,   -86,   -86,     0,     0,     0,
+       0,   -86,   -86,     0,   -86,     0,   -86,   -86,   -86,     0,
+       0,   -86,     0,     0,     0,     0,     0,     0,     0,     0,
+     834,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   150,   150,   694,   694,   694,   694,   694,   694,   694,
+     694,   694,   694,   694,   694,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   257,   258,   259,   260,     0,   261,   262,
+     263,   264,   265,   266,   678,     0,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,     0,
+     290,   291,   292,   293,   574,   295,   296,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   842,   843,
+     693,   693,   693,   693,   693,   693,   693,   693,   693,   693,
+     693,   693,    -2,     0,     0,     4,     5,     6,  -113,  -113,
+       7,     0,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,     0,     0,    19,     0,     0,    20,    21,
+      22,    23,    24,   576,     0,    25,    26,     0,    27,     0,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,     0,     0,    40,    41,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      42,     0,     0,     0,     0,     0,     0,     0,     0,    43,
+      44,     0,     0,     0,     0,    45,    46,     0,    47,     0,
+      48,     0,    49,     0,     0,    50,     4,     5,     6,  -113,
+    -113,     7,     0,     8,     9,    10,    11,     0,     0,    14,
+      15,    16,    17,    18,  -107,  -107,    19,     0,     0,    20,
+      21,    22,    23,    24,     0,     0,    25,    26,     0,    27,
+       0,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,     0,     0,    40,    41,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    42,     0,     0,     0,     0,     0,     0,     0,     0,
+      43,    44,     0,     0,     0,     0,    45,    46,     0,    47,
+       0,    48,  -107,    49,     0,     0,    50,     4,     5,     6,
+    -113,  -113,     7,     0,     8,     9,    10,    11,     0,     0,
+      14,    15,    16,    17,    18,  -106,  -106,    19,     0,     0,
+      20,    21,    22,    23,    24,     0,     0,    25,    26,     0,
+      27,     0,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,     0,     0,    40,    41,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,    43,    44,     0,     0,     0,     0,    45,    46,     0,
+      47,     0,    48,  -106,    49,     0,     0,    50,     4,     5,
+       6,  -113,  -113,     7,     0,     8,     9,    10,    11,     0,
+       0,    14,    15,    16,    17,    18,     0,     0,    19,     0,
+       0,    20,    21,    22,    23,    24,     0,     0,    25,    26,
+       0,    27,     0,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,     0,     0,    40,    41,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    42,     0,     0,     0,     0,     0,     0,
+       0,     0,    43,    44,     0,     0,     0,     0,    45,    46,
+       0,    47,     0,    48,   442,    49,     0,     0,    50,     4,
+       5,     6,  -113,  -113,     7,     0,     8,     9,    10,    11,
+       0,     0,    14,    15,    16,    17,    18,     0,     0,    19,
+       0,     0,    20,    21,    22,    23,    24,     0,     0,    25,
+      26,     0,    27,     0,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,     0,     0,    40,    41,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    42,     0,     0,     0,     0,     0,
+       0,     0,     0,    43,    44,     0,     0,     0,     0,    45,
+      46,     0,    47,     0,    48,     0,    49,     0,     0,    50,
+     257,   258,   259,   260,     0,   261,   262,   263,   264,   265,
+     266,     0,     0,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,     0,   290,   291,   292,
+     293,   574,   295,   296,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   255,     0,   669,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  -424,     0,  -424,  -431,     0,     0,
+     576,   257,   258,   259,   260,     0,   261,   262,   263,   264,
+     265,   266,     0,     0,   267,   268,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,     0,   290,   291,
+     292,   293,   574,   295,   296,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -431,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -424,     0,  -424,  -431,     0,
+       0,   576,   257,   258,   259,   260,     0,   261,   262,   263,
+     264,   350,   266,     0,     0,   267,   268,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   289,     0,   290,
+     291,   292,   293,   351,   295,   296,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   352,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   353,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   354,     0,
+       0,     0,   355,   257,   258,   259,   260,     0,   261,   262,
+     263,   264,   265,   266,     0,     0,   267,   268,   269,   270,
+     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,     0,
+     290,   291,   292,   293,   574,   295,   296,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -113,     0,     0,     0,
+       0,     0,   147,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   102,   103,     0,
+       0,  -470,     0,     0,     0,     0,   107,     0,   108,   575,
+     109,   110,   111,   112,   148,   114,   115,   116,    38,    39,
+    -470,     0,     0,   576,   257,   258,   259,   260,     0,   261,
+     262,   263,   264,   350,   266,     0,     0,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+       0,   290,   291,   292,   293,   351,   295,   296,   123,     0,
+     124,     0,     0,    50,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   352,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     353,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    -414,     0,     0,     0,   355,   257,   258,   259,   260,     0,
+     261,   262,   263,   264,   350,   266,     0,     0,   267,   268,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,     0,   290,   291,   292,   293,   781,   295,   296,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   782,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   353,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   783,     0,     0,     0,   355,   257,   258,   259,   260,
+       0,   261,   262,   263,   264,   350,   266,     0,     0,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,     0,   290,   291,   292,   293,   715,   295,   296,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   353,     0,     0,     0,     0,     0,     0,   716,
+       0,     0,  -374,     0,     0,     0,   576,   257,   258,   259,
+     260,     0,   261,   262,   263,   264,   350,   266,     0,     0,
+     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   288,   289,     0,   290,   291,   292,   293,   809,   295,
+     296,     0,     0,     0,     0,     0,     0,   257,   258,   259,
+     260,     0,   261,   262,   263,   264,   350,   266,     0,     0,
+     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   288,   289,   353,   290,   291,   292,   293,   574,   295,
+     296,     0,     0,     0,  -431,     0,     0,   576,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -113,     0,     0,     0,
+       0,     0,    10,   101,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   353,     0,     0,     0,   102,   103,   104,
+     105,     0,     0,   106,  -431,     0,   107,   576,   108,    29,
+     109,   110,   111,   112,   113,   114,   115,   116,    38,    39,
+    -396,  -396,   117,   118,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    42,     0,
+       0,  -396,     0,     0,  -405,     0,     0,   119,   120,   182,
+    -405,  -405,     0,   121,   122,     0,  -396,  -396,   123,  -396,
+     124,  -396,     0,    50,  -396,  -405,  -405,  -405,  -405,     0,
+       0,  -405,     0,     0,  -405,     0,  -405,  -405,  -405,  -405,
+    -405,  -405,  -405,  -405,  -405,  -405,  -405,  -405,     0,     0,
+    -405,  -405,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -405,  -405,     0,     0,     0,
+       0,     0,  -406,     0,     0,  -405,  -405,     0,  -406,  -406,
+       0,  -405,  -405,     0,     0,   197,  -405,     0,  -405,     0,
+       0,  -405,   198,  -406,  -406,  -406,  -406,     0,     0,  -406,
+       0,     0,  -406,     0,  -406,  -406,  -406,  -406,  -406,  -406,
+    -406,  -406,  -406,  -406,  -406,  -406,     0,     0,  -406,  -406,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -406,  -406,     0,     0,     0,     0,     0,
+    -405,     0,     0,  -406,  -406,     0,  -405,  -405,     0,  -406,
+    -406,     0,     0,   445,  -406,     0,  -406,     0,     0,  -406,
+     446,  -405,  -405,  -405,  -405,     0,     0,  -405,     0,     0,
+    -405,     0,  -405,  -405,  -405,  -405,  -405,  -405,  -405,  -405,
+    -405,  -405,  -405,  -405,     0,     0,  -405,  -405,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  -405,  -405,     0,     0,     0,     0,     0,  -405,     0,
+       0,  -405,  -405,     0,  -405,  -405,     0,  -405,  -405,     0,
+       0,   525,  -405,     0,  -405,     0,     0,  -405,   198,  -405,
+    -405,  -405,  -405,     0,     0,  -405,     0,     0,  -405,     0,
+    -405,  -405,  -405,  -405,  -405,  -405,  -405,  -405,  -405,  -405,
+    -405,  -405,     0,     0,  -405,  -405,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -405,
+    -405,     0,     0,     0,     0,     0,  -403,     0,     0,  -405,
+    -405,     0,  -403,  -403,     0,  -405,  -405,     0,     0,   197,
+    -405,     0,  -405,     0,     0,  -405,   639,  -403,  -403,  -403,
+    -403,     0,     0,  -403,     0,     0,  -403,     0,  -403,  -403,
+    -403,  -403,  -403,  -403,  -403,  -403,  -403,  -403,  -403,  -403,
+       0,     0,  -403,  -403,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  -403,  -403,     0,
+       0,     0,     0,     0,  -406,     0,     0,  -403,  -403,     0,
+    -406,  -406,     0,  -403,  -403,     0,     0,   304,  -403,     0,
+    -403,     0,     0,  -403,  -403,  -406,  -406,  -406,  -406,     0,
+       0,  -406,     0,     0,  -406,     0,  -406,  -406,  -406,  -406,
+    -406,  -406,  -406,  -406,  -406,  -406,  -406,  -406,     0,     0,
+    -406,  -406,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -406,  -406,     0,  -113,     0,
+       0,     0,     0,     0,   147,  -406,  -406,     0,     0,     0,
+       0,  -406,  -406,     0,     0,   445,  -406,     0,  -406,   102,
+     103,  -406,  -409,     0,     0,     0,     0,     0,   107,     0,
+     108,     0,   109,   110,   111,   112,   148,   114,   115,   116,
+      38,    39,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   518,
+       0,     0,     0,     0,     0,     0,  -113,     0,     0,     0,
+       0,     0,    10,   101,     0,     0,     0,     0,     0,     0,
+     676,     0,   124,     0,     0,   317,   677,   102,   103,   104,
+     105,     0,     0,   106,     0,     0,   107,     0,   108,    29,
+     109,   110,   111,   112,   113,   114,   115,   116,    38,    39,
+       0,     0,   117,   118,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   352,    42,     0,
+       0,     0,     0,  -113,     0,     0,     0,   119,   120,    10,
+     101,     0,     0,   121,   122,     0,     0,     0,   123,     0,
+     124,  -329,     0,    50,   102,   103,   104,   105,     0,     0,
+     106,     0,     0,   107,     0,   108,    29,   109,   110,   111,
+     112,   113,   114,   115,   116,    38,    39,     0,     0,   117,
+     118,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    42,     0,     0,     0,     0,
+    -113,     0,     0,     0,   119,   120,    10,   101,     0,     0,
+     121,   122,     0,   -84,     0,   123,     0,   124,     0,     0,
+      50,   102,   103,   104,   105,     0,     0,   106,     0,     0,
+     107,     0,   108,    29,   109,   110,   111,   112,   113,   114,
+     115,   116,    38,    39,     0,     0,   117,   118,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   352,    42,     0,     0,     0,     0,  -113,     0,     0,
+       0,   119,   120,    10,   101,     0,     0,   121,   122,     0,
+       0,     0,   123,     0,   124,     0,     0,    50,   102,   103,
+     104,   105,     0,     0,   106,     0,     0,   107,     0,   108,
+      29,   109,   110,   111,   112,   113,   114,   115,   116,    38,
+      39,     0,     0,   117,   118,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    42,
+       0,     0,     0,     0,  -113,     0,     0,     0,   119,   120,
+      10,   101,     0,     0,   121,   122,     0,  -101,     0,   123,
+       0,   124,     0,     0,    50,   102,   103,   104,   105,     0,
+       0,   106,     0,     0,   107,     0,   108,    29,   109,   110,
+     111,   112,   113,   114,   115,   116,    38,    39,     0,     0,
+     117,   118,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    42,     0,     0,     0,
+       0,  -113,     0,     0,     0,   119,   120,    10,   101,     0,
+       0,   121,   122,     0,     0,     0,   123,     0,   124,  -101,
+       0,    50,   102,   103,   104,   105,     0,     0,   106,     0,
+       0,   107,     0,   108,    29,   109,   110,   111,   112,   113,
+     114,   115,   116,    38,    39,     0,     0,   117,   118,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    42,     0,     0,     0,     0,  -113,  -113,
+       0,     0,   119,   120,    10,    11,     0,     0,   121,   122,
+       0,     0,     0,   123,     0,   124,     0,     0,    50,    21,
+      22,    23,    24,     0,     0,    25,     0,     0,    27,     0,
+      28,    29,    30,    31,    32,    33,   315,    35,    36,    37,
+      38,    39,     0,     0,    40,    41,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -113,     0,     0,     0,
+      42,     0,    10,    11,     0,     0,     0,     0,     0,    43,
+      44,     0,     0,     0,     0,    45,    46,    21,    22,    23,
+      24,     0,    49,    25,     0,    50,     0,     0,    28,    29,
+      30,    31,    32,    33,   315,    35,    36,    37,    38,    39,
+       0,     0,    40,    41,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    42,     0,
+       0,     0,     0,  -249,     0,     0,     0,    43,    44,  -249,
+    -249,     0,     0,    45,    46,     0,     0,     0,    48,     0,
+      49,     0,     0,    50,  -249,  -249,  -249,  -249,     0,     0,
+    -249,     0,     0,  -249,     0,  -249,     0,  -249,  -249,  -249,
+    -249,  -249,  -249,  -249,  -249,  -249,  -249,     0,     0,  -249,
+    -249,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  -273,     0,     0,  -249,  -249,   457,  -273,  -273,     0,
+    -249,  -249,     0,     0,     0,  -249,     0,  -249,     0,     0,
+    -249,     0,  -273,  -273,  -273,  -273,     0,     0,  -273,     0,
+       0,  -273,     0,  -273,     0,  -273,  -273,  -273,  -273,  -273,
+    -273,  -273,  -273,  -273,  -273,     0,     0,  -273,  -273,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -113,
+       0,     0,  -273,  -273,   698,   147,   101,     0,  -273,  -273,
+       0,     0,     0,  -273,     0,  -273,     0,     0,  -273,     0,
+     102,   103,   104,   105,     0,     0,   106,     0,     0,   107,
+       0,   108,     0,   109,   110,   111,   112,   148,   114,   115,
+     116,    38,    39,     0,     0,   117,   118,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  -113,     0,     0,
+       0,     0,     0,   147,     0,     0,     0,     0,     0,     0,
+     119,   120,     0,     0,     0,     0,   121,   122,   102,   103,
+       0,   123,  -113,   124,     0,     0,    50,   107,   147,   108,
+       0,   109,   110,   111,   112,   148,   114,   115,   116,    38,
+      39,     0,     0,   102,   103,     0,     0,   533,     0,     0,
+       0,     0,   107,     0,   108,     0,   109,   110,   111,   112,
+     148,   114,   115,   116,    38,    39,     0,     0,   518,   534,
+     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   676,
+       0,   124,     0,     0,   317,  -220,     0,   545,   546,   547,
+     548,   549,   550,   551,   552,   553,   554,     0,     0,     0,
+       0,  -220,  -220,     0,   676,     0,   124,     0,     0,   317,
+     257,   258,   259,   260,     0,   261,   262,   263,   264,   265,
+     266,     0,     0,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,     0,   290,   291,   292,
+     293,   294,   295,   296,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   297,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   257,   258,   259,   260,     0,   261,
+     262,   263,   264,   265,   266,     0,   298,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+       0,   290,   291,   292,   293,   517,   295,   296,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   518,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   257,   258,
+     259,   260,     0,   261,   262,   263,   264,   265,   266,     0,
+     519,   267,   268,   269,   270,   271,   272,   273,   274,   275,
+     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,     0,   290,   291,   292,   293,   294,
+     295,   296,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   297,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   257,   258,   259,   260,     0,   261,   262,   263,
+     264,   265,   266,     0,  -414,   267,   268,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   289,     0,   290,
+     291,   292,   293,   517,   295,   296,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   518,     0,     0,     0,
+       0,     0,  -351,  -351,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -351,     0,     0,  -414,  -351,
+    -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,
+    -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,
+    -351,  -351,  -351,  -351,  -351,  -351,  -351,   184,     0,     0,
+    -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,
+    -351,  -351,  -351,  -335,  -335,     0,     0,  -351,  -351,  -351,
+    -351,  -351,  -351,  -351,  -351,  -351,     0,     0,     0,     0,
+    -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,
+    -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,
+    -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,   184,     0,
+       0,  -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,  -335,
+    -335,  -335,  -335,  -335,  -318,  -318,     0,     0,  -335,  -335,
+    -335,  -335,  -335,  -335,  -335,  -335,  -335,  -318,     0,     0,
+       0,    38,    39,  -318,  -318,  -318,  -318,  -318,  -318,  -318,
+    -318,  -318,  -318,  -318,  -318,  -318,  -318,  -318,  -318,  -318,
+    -318,  -318,  -318,  -318,  -318,  -318,  -318,  -318,  -318,     0,
+       0,     0,  -318,  -318,  -318,  -318,  -318,  -318,  -318,  -318,
+    -318,  -318,  -318,  -318,  -318,  -311,  -311,     0,     0,  -318,
+    -318,  -318,  -318,   251,  -318,   477,   478,  -318,  -311,     0,
+       0,     0,    38,    39,  -311,  -311,  -311,  -311,  -311,  -311,
+    -311,  -311,  -311,  -311,  -311,  -311,  -311,  -311,  -311,  -311,
+    -311,  -311,  -311,  -311,  -311,  -311,  -311,  -311,  -311,  -311,
+       0,     0,     0,  -311,  -311,  -311,  -311,  -311,  -311,  -311,
+    -311,  -311,  -311,  -311,  -311,  -311,  -309,  -309,     0,     0,
+    -311,  -311,  -311,  -311,  -311,  -311,   477,   478,  -311,  -309,
+       0,     0,     0,    38,    39,  -309,  -309,  -309,  -309,  -309,
+    -309,  -309,  -309,  -309,  -309,  -309,  -309,  -309,  -309,  -309,
+    -309,  -309,  -309,  -309,  -309,  -309,  -309,  -309,  -309,  -309,
+    -309,     0,     0,     0,  -309,  -309,  -309,  -309,  -309,  -309,
+    -309,  -309,  -309,  -309,  -309,  -309,  -309,  -312,  -312,     0,
+       0,  -309,  -309,  -309,  -309,  -309,  -309,   477,   478,  -309,
+    -312,     0,     0,     0,    38,    39,  -312,  -312,  -312,  -312,
+    -312,  -312,  -312,  -312,  -312,  -312,  -312,  -312,  -312,  -312,
+    -312,  -312,  -312,  -312,  -312,  -312,  -312,  -312,  -312,  -312,
+    -312,  -312,     0,     0,     0,  -312,  -312,  -312,  -312,  -312,
+    -312,  -312,  -312,  -312,  -312,  -312,  -312,  -312,  -310,  -310,
+       0,     0,  -312,  -312,  -312,  -312,  -312,  -312,   477,   478,
+    -312,  -310,     0,     0,     0,    38,    39,  -310,  -310,  -310,
+    -310,  -310,  -310,  -310,  -310,  -310,  -310,  -310,  -310,  -310,
+    -310,  -310,  -310,  -310,  -310,  -310,  -310,  -310,  -310,  -310,
+    -310,  -310,  -310,     0,     0,     0,  -310,  -310,  -310,  -310,
+    -310,  -310,  -310,  -310,  -310,  -310,  -310,  -310,  -310,  -317,
+    -317,     0,     0,  -310,  -310,  -310,  -310,  -310,  -310,   477,
+     478,  -310,     0,     0,     0,     0,    38,    39,  -317,  -317,
+    -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,
+    -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,
+    -317,  -317,  -317,  -317,     0,     0,     0,  -317,  -317,  -317,
+    -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,  -317,
+    -315,  -315,     0,     0,  -317,  -317,  -317,  -317,   251,  -317,
+     477,   478,  -317,  -315,     0,     0,     0,     0,     0,  -315,
+    -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,
+    -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,
+    -315,  -315,  -315,  -315,  -315,     0,     0,     0,  -315,  -315,
+    -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,  -315,
+    -315,  -313,  -313,     0,     0,  -315,  -315,  -315,  -315,   251,
+    -315,     0,     0,  -315,  -313,     0,     0,     0,     0,     0,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,     0,     0,     0,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,     0,     0,  -313,  -313,  -313,  -313,
+     422,  -313,     0,     0,  -313,  -313,     0,     0,     0,     0,
+       0,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,     0,     0,     0,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,     0,     0,  -313,  -313,  -313,
+    -313,   569,  -313,     0,     0,  -313,     0,     0,     0,     0,
+       0,     0,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,     0,     0,
+       0,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,  -313,
+    -313,  -313,  -313,  -313,  -288,  -288,     0,     0,  -313,  -313,
+    -313,  -313,   251,  -313,     0,     0,  -313,     0,     0,     0,
+       0,     0,     0,  -288,  -288,   237,   238,  -288,  -288,  -288,
+    -288,  -288,  -288,  -288,  -288,  -288,  -288,  -288,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,     0,
+       0,     0,   250,  -288,  -288,  -288,  -288,  -288,  -288,  -288,
+    -288,  -288,  -288,  -288,  -288,  -277,  -277,     0,     0,  -288,
+    -288,  -288,  -288,     0,  -288,     0,     0,  -288,     0,     0,
+       0,     0,     0,     0,  -277,  -277,   372,   373,  -277,  -277,
+    -277,  -277,  -277,  -277,  -277,  -277,  -277,  -277,  -277,   374,
+     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
+       0,     0,     0,   385,  -277,  -277,  -277,  -277,  -277,  -277,
+    -277,  -277,  -277,  -277,  -277,  -277,  -277,  -277,     0,     0,
+    -277,  -277,  -277,  -277,     0,  -277,     0,     0,  -277,     0,
+       0,     0,     0,     0,     0,  -277,  -277,   372,   373,  -277,
+    -277,  -277,  -277,  -277,  -277,  -277,  -277,  -277,  -277,  -277,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -277,  -277,  -277,  -277,  -277,
+    -277,  -277,  -277,  -277,  -277,  -277,  -277,   212,   213,     0,
+       0,  -277,  -277,  -277,  -277,     0,  -277,     0,     0,  -277,
+       0,     0,     0,     0,     0,     0,  -219,  -219,     0,     0,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     224,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -219,  -219,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   212,   213,
+       0,     0,  -219,  -219,  -219,  -219,     0,  -219,     0,     0,
+    -219,     0,     0,     0,     0,     0,     0,  -218,  -218,     0,
+       0,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,   224,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  -218,  -218,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   234,   212,
+     213,     0,     0,  -218,  -218,  -218,  -218,     0,  -218,     0,
+       0,  -218,     0,     0,     0,     0,     0,     0,  -215,  -215,
+       0,     0,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  -215,  -215,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     212,   213,     0,     0,  -215,  -215,  -215,  -215,     0,  -215,
+       0,     0,  -215,     0,     0,     0,     0,     0,     0,  -214,
+    -214,     0,     0,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,   223,   224,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -214,
+    -214,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+     234,  -351,  -351,     0,     0,  -214,  -214,  -214,  -214,     0,
+    -214,     0,     0,  -214,     0,     0,     0,     0,  -351,  -351,
+       0,     0,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,
+    -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,
+    -351,  -351,  -351,  -351,  -351,  -351,   184,     0,     0,  -351,
+    -351,   185,  -351,  -351,  -351,  -351,  -351,  -351,  -351,  -351,
+    -351,  -351,  -277,  -277,     0,     0,  -351,  -351,     0,     0,
+    -351,     0,  -351,  -351,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   372,   373,  -277,  -277,  -277,  -277,  -277,
+    -277,  -277,  -277,  -277,  -277,  -277,   374,   375,   376,   377,
+     378,   379,   380,   381,   382,   383,   384,     0,     0,     0,
+     385,  -277,     0,  -277,  -277,  -277,  -277,  -277,  -277,  -277,
+    -277,  -277,  -277,   -99,  -302,     0,     0,     0,  -277,     0,
+    -277,     0,     0,     0,     0,     0,   -99,     0,     0,     0,
+       0,     0,     0,     0,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,     0,     0,
+    -288,  -302,  -302,     0,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,     0,     0,     0,     0,  -302,  -302,
+     237,   238,  -288,  -288,  -288,  -288,  -288,  -288,  -288,  -288,
+    -288,  -288,  -288,   557,   558,   559,   560,   561,   562,   563,
+     564,   565,   566,   567,     0,     0,  -277,   568,  -288,     0,
+    -288,  -288,  -288,  -288,  -288,  -288,  -288,  -288,  -288,  -288,
+       0,     0,     0,     0,  -288,  -288,   372,   373,  -277,  -277,
+    -277,  -277,  -277,  -277,  -277,  -277,  -277,  -277,  -277,   795,
+     796,   797,   798,   799,   800,   801,   802,   803,   804,   805,
+     533,     0,     0,   806,  -277,     0,  -277,  -277,  -277,  -277,
+    -277,  -277,  -277,  -277,  -277,  -277,     0,     0,     0,     0,
+    -277,  -277,   534,   535,   536,   537,   538,   539,   540,   541,
+     542,   543,   544,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   533,     0,     0,     0,  -217,     0,
+     545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
+       0,     0,     0,     0,  -217,  -217,   534,   535,   536,   537,
+     538,   539,   540,   541,   542,   543,   544,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -216,     0,   545,   546,   547,   548,   549,   550,
+     551,   552,   553,   554,     0,     0,     0,     0,  -216,  -216,
+     257,   258,   259,   260,     0,   261,   262,   263,   264,   265,
+     266,     0,     0,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,     0,   290,   291,   292,
+     293,   574,   295,   296
+};
+
+static const yytype_int16 yycheck[] =
+{
+       2,   137,    90,   317,     9,   305,   305,   388,     4,     5,
+       6,   389,   161,    15,   160,    20,   526,   123,     2,    89,
+     123,     4,     5,     6,     2,   326,   362,   398,   161,    13,
+     163,    15,   350,   351,   405,   353,   100,    15,   184,     2,
+     304,   572,   413,   100,    49,   100,   313,   314,    13,   181,
+      21,   669,    15,   422,   672,    13,     2,   424,   252,   395,
+     252,    21,     3,     4,     5,    13,     7,    21,    22,    15,
+      22,    12,     6,     7,   410,    31,    44,    44,    22,    22,
+      44,    22,    37,    44,    22,    22,    81,    81,    44,    44,
+      19,    79,    44,    98,   200,    36,    81,    44,   100,     0,
+      44,    44,    22,    97,    37,   100,    44,    44,     2,    97,
+      44,    99,    44,    77,    31,   100,   104,     2,    44,   124,
+      44,    15,    89,    79,    44,     6,     7,    44,    97,    44,
+      15,   102,   100,   100,    98,   104,    97,   100,    99,   103,
+      96,    97,   102,    98,    78,    99,    44,    99,    89,    44,
+      97,    77,   100,    77,   100,    99,    99,    98,   160,   495,
+     496,    99,    79,   168,   674,    98,    44,   172,   100,    96,
+      97,    97,    98,    97,    98,   180,   160,   103,   104,   103,
+     104,    96,   184,   185,   715,   485,   522,   718,   488,    44,
+     100,    44,   386,   195,   386,   160,   100,   160,    96,    77,
+     569,   185,   160,    98,   571,   583,   100,   185,   103,    44,
+     342,   195,    81,   100,   160,   100,    44,   195,   836,    44,
+      98,   184,   185,    44,   294,   103,   104,    44,   316,    44,
+      97,   100,   195,    44,   101,   502,   503,    89,   184,   185,
+      76,    96,   388,   392,   393,    98,    98,   311,   101,   195,
+     103,    52,    53,    44,   311,   184,   311,   575,   407,   408,
+      77,   525,   100,    98,    98,   643,   160,   645,   103,    97,
+      44,    99,    97,   100,    99,   160,    31,    98,   809,    79,
+      31,    98,   103,    98,   101,    79,   103,    98,   103,    44,
+     184,   185,   103,    44,   130,   131,    97,    79,    99,   184,
+     185,   195,    79,   104,    81,    97,   252,    98,   254,   101,
+     195,   307,   103,     6,    96,    97,   312,   313,   314,    12,
+      97,    80,    99,    44,   307,    46,   836,    96,    79,   312,
+     313,   314,    96,    97,    27,    28,   636,    96,    97,    79,
+      79,   655,    81,    36,   680,    38,   682,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    97,    97,    99,
+      99,   101,   432,    97,   104,   311,   737,   101,    89,   439,
+     440,    97,    79,   754,   477,   101,    96,    98,    80,    97,
+     758,    97,   760,   101,    77,   101,   388,    52,    53,    96,
+      97,   692,   693,    96,    96,    97,    48,    49,    76,    97,
+      52,    53,   490,   100,    97,    98,   104,   100,    97,    97,
+     103,   104,    97,    96,    79,   104,   104,   311,    97,   104,
+      97,    96,   101,   723,   101,   388,   311,    79,    96,    97,
+       6,    97,    97,   101,    99,   101,    96,    97,   819,   104,
+     386,   387,   388,   100,    97,    97,    99,    99,   100,    97,
+     102,   103,   104,   101,    97,    97,    97,    99,   101,   388,
+     101,    44,    97,   781,    99,   765,   765,    44,    97,    46,
+      99,    44,   786,   478,    97,    96,    99,    44,   584,    96,
+      97,   584,    96,   616,    96,    97,    24,    25,    96,    97,
+     419,    50,    51,     7,   388,   831,    50,    51,   500,    96,
+      97,    96,    97,   388,    16,   501,   502,   503,    96,    97,
+      96,    97,     5,     6,   313,   314,   500,    44,   501,   502,
+     503,    81,   500,   528,    99,   530,    80,    81,    96,   531,
+     100,    44,    98,    96,    81,   641,    46,   500,    44,   100,
+      44,   877,    96,    97,    98,    99,   101,   101,   100,    44,
+     104,   101,    81,    99,   500,   557,   558,   559,   560,   561,
+     562,   563,   564,   565,   566,   567,   568,   100,   531,   104,
+     676,    99,    81,   676,    44,   101,    44,    99,    96,    96,
+      99,    96,    98,   104,    76,    81,   674,    81,   676,   399,
+     101,    96,   100,   100,   557,   558,   559,   560,   561,   562,
+     563,   564,   565,   566,   567,   568,   500,   104,   754,    99,
+     101,    76,   101,   101,   684,   500,   752,   104,   623,   101,
+     622,   101,    79,    79,   101,   104,   104,    96,   630,   625,
+      96,    81,   104,   104,   101,   609,   399,   101,   622,   101,
+     619,    13,   625,   307,   622,   666,   630,   505,   311,   789,
+     890,   100,   630,   420,   205,   636,   100,   648,   663,   622,
+      50,    51,   664,   450,   718,   667,   668,   630,   641,   450,
+     666,   134,   808,   819,   430,   584,   622,   490,     3,     4,
+       5,     6,   490,   666,   630,   674,    -1,    12,    -1,    -1,
+      80,    81,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   664,    27,    28,   667,   668,    96,    97,    98,    99,
+      -1,   101,    -1,    38,   104,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    -1,    -1,    -1,   622,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   630,   622,    -1,    29,
+      -1,    -1,    -1,    -1,    -1,   630,    -1,    -1,    -1,    39,
+      -1,    -1,   754,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   768,    -1,    -1,    -1,
+      -1,    -1,    -1,    98,    -1,   100,    -1,    -1,   103,    -1,
+      -1,    -1,    -1,    -1,   768,    -1,    -1,    -1,   790,   791,
+     768,   754,    -1,   795,   796,   797,   798,   799,   800,   801,
+     802,   803,   804,   805,   806,   768,   790,   791,   754,    -1,
+      -1,    -1,   790,   791,    -1,    -1,    -1,   819,    -1,    -1,
+      -1,    -1,   768,    -1,    -1,   754,    -1,   790,   791,    -1,
+      -1,   833,   795,   796,   797,   798,   799,   800,   801,   802,
+     803,   804,   805,   806,   790,   791,    -1,    -1,    -1,   833,
+      -1,    -1,    -1,    -1,    -1,   833,   819,    -1,    -1,    -1,
+     754,   866,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   754,
+     833,    -1,    -1,   819,   768,    -1,    -1,   879,   824,    -1,
+      -1,    -1,    -1,   768,    -1,   814,    -1,   833,   817,   891,
+     819,   893,   182,    -1,   823,   879,   790,   791,   827,    -1,
+     829,   879,    -1,    -1,    -1,   790,   791,   891,    -1,   893,
+     200,   857,    -1,    -1,    -1,    -1,   879,    -1,    -1,    -1,
+     210,   211,    -1,    -1,    -1,   819,    -1,    -1,   891,    -1,
+     893,   860,    -1,   879,   819,    -1,    -1,    -1,    -1,   833,
+      -1,    -1,   871,    -1,   873,   891,    -1,   893,   833,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,    -1,    -1,    -1,   255,    -1,    -1,    -1,    -1,
+     557,   558,   559,   560,   561,   562,   563,   564,   565,   566,
+     567,   568,    -1,    -1,    -1,   879,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   879,    -1,    -1,   891,    -1,   893,
+      -1,    -1,    32,    -1,    -1,    -1,   891,    -1,   893,    11,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   308,   309,
+      -1,    23,    24,    25,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    40,    41,
+      -1,    43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,
+      80,   341,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,   352,    -1,    -1,   355,    96,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   664,   368,   369,
+     667,   668,    -1,    -1,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   383,   384,   385,    11,    -1,    -1,   101,
+      -1,    -1,   104,   105,   106,    -1,    -1,    -1,    23,    24,
+      25,    -1,    -1,    -1,    -1,   117,   118,   119,   120,   121,
+     122,    -1,    -1,    -1,    -1,    40,    41,    -1,    43,    44,
+      45,    46,   422,    -1,    -1,    -1,     3,     4,     5,     6,
+     430,     8,     9,    10,    11,    12,    13,    -1,    -1,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    -1,    40,    41,    42,    43,    44,    45,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,   101,    -1,    -1,   104,
+     105,   106,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   117,   118,   119,   120,   121,   122,   795,   796,
+     797,   798,   799,   800,   801,   802,   803,   804,   805,   806,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    -1,    99,   235,   236,    -1,   103,    -1,    -1,    -1,
+      -1,    -1,   532,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,
+      -1,    -1,    -1,    12,    13,    -1,    -1,    -1,    -1,   569,
+      -1,    -1,    -1,    -1,    -1,    -1,   576,    -1,    27,    28,
+      29,    30,    -1,    -1,    33,    -1,   586,    -1,    -1,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,
+     235,   236,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,    88,
+      -1,   641,    -1,    -1,    93,    94,   646,    96,   648,    98,
+      -1,   100,    -1,    -1,   103,    -1,    -1,    -1,   370,   371,
+       0,    -1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    -1,    25,    26,    27,    28,    29,
+      30,    -1,    -1,    33,    34,    -1,    36,    -1,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   729,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    -1,    -1,    -1,    -1,   370,   371,    87,    88,    -1,
+      -1,    -1,    -1,    93,    94,    -1,    96,    -1,    98,    99,
+     100,    -1,    -1,   103,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   782,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       6,    -1,   792,    -1,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   518,   807,    -1,    -1,
+      -1,    27,    28,    -1,   526,    -1,   816,    -1,    -1,   531,
+      36,    -1,    38,    -1,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   555,   556,   557,   558,   559,   560,   561,
+     562,   563,   564,   565,   566,   567,   568,    -1,    -1,    -1,
+      -1,    77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     880,    97,    98,    -1,   100,    -1,    -1,   103,   104,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   531,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     555,   556,   557,   558,   559,   560,   561,   562,   563,   564,
+     565,   566,   567,   568,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   664,    -1,    -1,   667,   668,   669,     0,    -1,
+     672,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    -1,    -1,    26,    27,    28,    29,    30,    -1,
+      -1,    33,    34,    -1,    36,    -1,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    -1,    -1,
+      52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,   664,
+      -1,    -1,   667,   668,    -1,    87,    88,    -1,    -1,    -1,
+      -1,    93,    94,    -1,    96,    -1,    98,    99,   100,    -1,
+      -1,   103,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     782,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   793,   794,   795,   796,   797,   798,   799,   800,   801,
+     802,   803,   804,   805,   806,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,    -1,     8,     9,
+      10,    11,    12,    13,   836,    -1,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    -1,
+      40,    41,    42,    43,    44,    45,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   793,   794,
+     795,   796,   797,   798,   799,   800,   801,   802,   803,   804,
+     805,   806,     0,    -1,    -1,     3,     4,     5,     6,     7,
+       8,    -1,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    -1,    -1,    23,    -1,    -1,    26,    27,
+      28,    29,    30,   103,    -1,    33,    34,    -1,    36,    -1,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,
+      88,    -1,    -1,    -1,    -1,    93,    94,    -1,    96,    -1,
+      98,    -1,   100,    -1,    -1,   103,     3,     4,     5,     6,
+       7,     8,    -1,    10,    11,    12,    13,    -1,    -1,    16,
+      17,    18,    19,    20,    21,    22,    23,    -1,    -1,    26,
+      27,    28,    29,    30,    -1,    -1,    33,    34,    -1,    36,
+      -1,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    88,    -1,    -1,    -1,    -1,    93,    94,    -1,    96,
+      -1,    98,    99,   100,    -1,    -1,   103,     3,     4,     5,
+       6,     7,     8,    -1,    10,    11,    12,    13,    -1,    -1,
+      16,    17,    18,    19,    20,    21,    22,    23,    -1,    -1,
+      26,    27,    28,    29,    30,    -1,    -1,    33,    34,    -1,
+      36,    -1,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    -1,    -1,    52,    53,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    87,    88,    -1,    -1,    -1,    -1,    93,    94,    -1,
+      96,    -1,    98,    99,   100,    -1,    -1,   103,     3,     4,
+       5,     6,     7,     8,    -1,    10,    11,    12,    13,    -1,
+      -1,    16,    17,    18,    19,    20,    -1,    -1,    23,    -1,
+      -1,    26,    27,    28,    29,    30,    -1,    -1,    33,    34,
+      -1,    36,    -1,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    -1,    -1,    52,    53,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    87,    88,    -1,    -1,    -1,    -1,    93,    94,
+      -1,    96,    -1,    98,    99,   100,    -1,    -1,   103,     3,
+       4,     5,     6,     7,     8,    -1,    10,    11,    12,    13,
+      -1,    -1,    16,    17,    18,    19,    20,    -1,    -1,    23,
+      -1,    -1,    26,    27,    28,    29,    30,    -1,    -1,    33,
+      34,    -1,    36,    -1,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    -1,    -1,    52,    53,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    87,    88,    -1,    -1,    -1,    -1,    93,
+      94,    -1,    96,    -1,    98,    -1,   100,    -1,    -1,   103,
+       3,     4,     5,     6,    -1,     8,     9,    10,    11,    12,
+      13,    -1,    -1,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    -1,    40,    41,    42,
+      43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    79,    -1,    81,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    97,    -1,    99,   100,    -1,    -1,
+     103,     3,     4,     5,     6,    -1,     8,     9,    10,    11,
+      12,    13,    -1,    -1,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    -1,    40,    41,
+      42,    43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    81,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    97,    -1,    99,   100,    -1,
+      -1,   103,     3,     4,     5,     6,    -1,     8,     9,    10,
+      11,    12,    13,    -1,    -1,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    -1,    40,
+      41,    42,    43,    44,    45,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    99,    -1,
+      -1,    -1,   103,     3,     4,     5,     6,    -1,     8,     9,
+      10,    11,    12,    13,    -1,    -1,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    -1,
+      40,    41,    42,    43,    44,    45,    46,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     6,    -1,    -1,    -1,
+      -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    27,    28,    -1,
+      -1,    81,    -1,    -1,    -1,    -1,    36,    -1,    38,    89,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+     100,    -1,    -1,   103,     3,     4,     5,     6,    -1,     8,
+       9,    10,    11,    12,    13,    -1,    -1,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      -1,    40,    41,    42,    43,    44,    45,    46,    98,    -1,
+     100,    -1,    -1,   103,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      99,    -1,    -1,    -1,   103,     3,     4,     5,     6,    -1,
+       8,     9,    10,    11,    12,    13,    -1,    -1,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    -1,    40,    41,    42,    43,    44,    45,    46,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    99,    -1,    -1,    -1,   103,     3,     4,     5,     6,
+      -1,     8,     9,    10,    11,    12,    13,    -1,    -1,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    -1,    40,    41,    42,    43,    44,    45,    46,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    96,
+      -1,    -1,    99,    -1,    -1,    -1,   103,     3,     4,     5,
+       6,    -1,     8,     9,    10,    11,    12,    13,    -1,    -1,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    -1,    40,    41,    42,    43,    44,    45,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+       6,    -1,     8,     9,    10,    11,    12,    13,    -1,    -1,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    89,    40,    41,    42,    43,    44,    45,
+      46,    -1,    -1,    -1,   100,    -1,    -1,   103,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     6,    -1,    -1,    -1,
+      -1,    -1,    12,    13,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    27,    28,    29,
+      30,    -1,    -1,    33,   100,    -1,    36,   103,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    81,    -1,    -1,     6,    -1,    -1,    87,    88,    89,
+      12,    13,    -1,    93,    94,    -1,    96,    97,    98,    99,
+     100,   101,    -1,   103,   104,    27,    28,    29,    30,    -1,
+      -1,    33,    -1,    -1,    36,    -1,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    -1,    -1,
+      52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    77,    78,    -1,    -1,    -1,
+      -1,    -1,     6,    -1,    -1,    87,    88,    -1,    12,    13,
+      -1,    93,    94,    -1,    -1,    97,    98,    -1,   100,    -1,
+      -1,   103,   104,    27,    28,    29,    30,    -1,    -1,    33,
+      -1,    -1,    36,    -1,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    -1,    -1,    52,    53,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    77,    78,    -1,    -1,    -1,    -1,    -1,
+       6,    -1,    -1,    87,    88,    -1,    12,    13,    -1,    93,
+      94,    -1,    -1,    97,    98,    -1,   100,    -1,    -1,   103,
+     104,    27,    28,    29,    30,    -1,    -1,    33,    -1,    -1,
+      36,    -1,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    -1,    -1,    52,    53,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    77,    78,    -1,    -1,    -1,    -1,    -1,     6,    -1,
+      -1,    87,    88,    -1,    12,    13,    -1,    93,    94,    -1,
+      -1,    97,    98,    -1,   100,    -1,    -1,   103,   104,    27,
+      28,    29,    30,    -1,    -1,    33,    -1,    -1,    36,    -1,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,
+      78,    -1,    -1,    -1,    -1,    -1,     6,    -1,    -1,    87,
+      88,    -1,    12,    13,    -1,    93,    94,    -1,    -1,    97,
+      98,    -1,   100,    -1,    -1,   103,   104,    27,    28,    29,
+      30,    -1,    -1,    33,    -1,    -1,    36,    -1,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,    78,    -1,
+      -1,    -1,    -1,    -1,     6,    -1,    -1,    87,    88,    -1,
+      12,    13,    -1,    93,    94,    -1,    -1,    97,    98,    -1,
+     100,    -1,    -1,   103,   104,    27,    28,    29,    30,    -1,
+      -1,    33,    -1,    -1,    36,    -1,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    -1,    -1,
+      52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    77,    78,    -1,     6,    -1,
+      -1,    -1,    -1,    -1,    12,    87,    88,    -1,    -1,    -1,
+      -1,    93,    94,    -1,    -1,    97,    98,    -1,   100,    27,
+      28,   103,   104,    -1,    -1,    -1,    -1,    -1,    36,    -1,
+      38,    -1,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,
+      -1,    -1,    -1,    -1,    -1,    -1,     6,    -1,    -1,    -1,
+      -1,    -1,    12,    13,    -1,    -1,    -1,    -1,    -1,    -1,
+      98,    -1,   100,    -1,    -1,   103,   104,    27,    28,    29,
+      30,    -1,    -1,    33,    -1,    -1,    36,    -1,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,    78,    -1,
+      -1,    -1,    -1,     6,    -1,    -1,    -1,    87,    88,    12,
+      13,    -1,    -1,    93,    94,    -1,    -1,    -1,    98,    -1,
+     100,   101,    -1,   103,    27,    28,    29,    30,    -1,    -1,
+      33,    -1,    -1,    36,    -1,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    -1,    -1,    52,
+      53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,
+       6,    -1,    -1,    -1,    87,    88,    12,    13,    -1,    -1,
+      93,    94,    -1,    96,    -1,    98,    -1,   100,    -1,    -1,
+     103,    27,    28,    29,    30,    -1,    -1,    33,    -1,    -1,
+      36,    -1,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    -1,    -1,    52,    53,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    77,    78,    -1,    -1,    -1,    -1,     6,    -1,    -1,
+      -1,    87,    88,    12,    13,    -1,    -1,    93,    94,    -1,
+      -1,    -1,    98,    -1,   100,    -1,    -1,   103,    27,    28,
+      29,    30,    -1,    -1,    33,    -1,    -1,    36,    -1,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,
+      -1,    -1,    -1,    -1,     6,    -1,    -1,    -1,    87,    88,
+      12,    13,    -1,    -1,    93,    94,    -1,    96,    -1,    98,
+      -1,   100,    -1,    -1,   103,    27,    28,    29,    30,    -1,
+      -1,    33,    -1,    -1,    36,    -1,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    -1,    -1,
+      52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,
+      -1,     6,    -1,    -1,    -1,    87,    88,    12,    13,    -1,
+      -1,    93,    94,    -1,    -1,    -1,    98,    -1,   100,   101,
+      -1,   103,    27,    28,    29,    30,    -1,    -1,    33,    -1,
+      -1,    36,    -1,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    -1,    -1,    52,    53,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    78,    -1,    -1,    -1,    -1,     6,     7,
+      -1,    -1,    87,    88,    12,    13,    -1,    -1,    93,    94,
+      -1,    -1,    -1,    98,    -1,   100,    -1,    -1,   103,    27,
+      28,    29,    30,    -1,    -1,    33,    -1,    -1,    36,    -1,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     6,    -1,    -1,    -1,
+      78,    -1,    12,    13,    -1,    -1,    -1,    -1,    -1,    87,
+      88,    -1,    -1,    -1,    -1,    93,    94,    27,    28,    29,
+      30,    -1,   100,    33,    -1,   103,    -1,    -1,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    -1,    -1,     6,    -1,    -1,    -1,    87,    88,    12,
+      13,    -1,    -1,    93,    94,    -1,    -1,    -1,    98,    -1,
+     100,    -1,    -1,   103,    27,    28,    29,    30,    -1,    -1,
+      33,    -1,    -1,    36,    -1,    38,    -1,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    -1,    -1,    52,
+      53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     6,    -1,    -1,    87,    88,    89,    12,    13,    -1,
+      93,    94,    -1,    -1,    -1,    98,    -1,   100,    -1,    -1,
+     103,    -1,    27,    28,    29,    30,    -1,    -1,    33,    -1,
+      -1,    36,    -1,    38,    -1,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    -1,    -1,    52,    53,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     6,
+      -1,    -1,    87,    88,    89,    12,    13,    -1,    93,    94,
+      -1,    -1,    -1,    98,    -1,   100,    -1,    -1,   103,    -1,
+      27,    28,    29,    30,    -1,    -1,    33,    -1,    -1,    36,
+      -1,    38,    -1,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    -1,    52,    53,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     6,    -1,    -1,
+      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      87,    88,    -1,    -1,    -1,    -1,    93,    94,    27,    28,
+      -1,    98,     6,   100,    -1,    -1,   103,    36,    12,    38,
+      -1,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    -1,    -1,    27,    28,    -1,    -1,    32,    -1,    -1,
+      -1,    -1,    36,    -1,    38,    -1,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    -1,    -1,    77,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    98,
+      -1,   100,    -1,    -1,   103,    80,    -1,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    -1,    -1,    -1,
+      -1,    96,    97,    -1,    98,    -1,   100,    -1,    -1,   103,
+       3,     4,     5,     6,    -1,     8,     9,    10,    11,    12,
+      13,    -1,    -1,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    -1,    40,    41,    42,
+      43,    44,    45,    46,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,     8,
+       9,    10,    11,    12,    13,    -1,    99,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      -1,    40,    41,    42,    43,    44,    45,    46,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,    -1,     8,     9,    10,    11,    12,    13,    -1,
+      99,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    -1,    40,    41,    42,    43,    44,
+      45,    46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,    -1,     8,     9,    10,
+      11,    12,    13,    -1,    99,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    -1,    40,
+      41,    42,    43,    44,    45,    46,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,
+      -1,    -1,    31,    32,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    44,    -1,    -1,    99,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    -1,    -1,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    31,    32,    -1,    -1,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,    -1,    -1,    -1,    -1,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    -1,
+      -1,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    31,    32,    -1,    -1,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,    44,    -1,    -1,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    -1,
+      -1,    -1,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    31,    32,    -1,    -1,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,    44,    -1,
+      -1,    -1,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      -1,    -1,    -1,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    31,    32,    -1,    -1,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,    44,
+      -1,    -1,    -1,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    -1,    -1,    -1,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    31,    32,    -1,
+      -1,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+      44,    -1,    -1,    -1,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    -1,    -1,    -1,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    31,    32,
+      -1,    -1,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,    44,    -1,    -1,    -1,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    -1,    -1,    -1,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    31,
+      32,    -1,    -1,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,    -1,    -1,    -1,    -1,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    -1,    -1,    -1,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      31,    32,    -1,    -1,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,    44,    -1,    -1,    -1,    -1,    -1,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    -1,    -1,    -1,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    31,    32,    -1,    -1,    96,    97,    98,    99,   100,
+     101,    -1,    -1,   104,    44,    -1,    -1,    -1,    -1,    -1,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    -1,    -1,    -1,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    31,    32,    -1,    -1,    96,    97,    98,    99,
+     100,   101,    -1,    -1,   104,    44,    -1,    -1,    -1,    -1,
+      -1,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    -1,    -1,    -1,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    31,    32,    -1,    -1,    96,    97,    98,
+      99,   100,   101,    -1,    -1,   104,    -1,    -1,    -1,    -1,
+      -1,    -1,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    -1,    -1,
+      -1,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    31,    32,    -1,    -1,    96,    97,
+      98,    99,   100,   101,    -1,    -1,   104,    -1,    -1,    -1,
+      -1,    -1,    -1,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    -1,
+      -1,    -1,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    31,    32,    -1,    -1,    96,
+      97,    98,    99,    -1,   101,    -1,    -1,   104,    -1,    -1,
+      -1,    -1,    -1,    -1,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      -1,    -1,    -1,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    31,    32,    -1,    -1,
+      96,    97,    98,    99,    -1,   101,    -1,    -1,   104,    -1,
+      -1,    -1,    -1,    -1,    -1,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    31,    32,    -1,
+      -1,    96,    97,    98,    99,    -1,   101,    -1,    -1,   104,
+      -1,    -1,    -1,    -1,    -1,    -1,    50,    51,    -1,    -1,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    31,    32,
+      -1,    -1,    96,    97,    98,    99,    -1,   101,    -1,    -1,
+     104,    -1,    -1,    -1,    -1,    -1,    -1,    50,    51,    -1,
+      -1,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    31,
+      32,    -1,    -1,    96,    97,    98,    99,    -1,   101,    -1,
+      -1,   104,    -1,    -1,    -1,    -1,    -1,    -1,    50,    51,
+      -1,    -1,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      31,    32,    -1,    -1,    96,    97,    98,    99,    -1,   101,
+      -1,    -1,   104,    -1,    -1,    -1,    -1,    -1,    -1,    50,
+      51,    -1,    -1,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    31,    32,    -1,    -1,    96,    97,    98,    99,    -1,
+     101,    -1,    -1,   104,    -1,    -1,    -1,    -1,    48,    49,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    -1,    -1,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    31,    32,    -1,    -1,    96,    97,    -1,    -1,
+     100,    -1,   102,   103,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    -1,    -1,    -1,
+      79,    80,    -1,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    31,    32,    -1,    -1,    -1,    97,    -1,
+      99,    -1,    -1,    -1,    -1,    -1,    44,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    -1,    -1,
+      32,    79,    80,    -1,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    -1,    -1,    -1,    -1,    96,    97,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    -1,    -1,    32,    79,    80,    -1,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      -1,    -1,    -1,    -1,    96,    97,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      32,    -1,    -1,    79,    80,    -1,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    -1,    -1,    -1,    -1,
+      96,    97,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    32,    -1,    -1,    -1,    80,    -1,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      -1,    -1,    -1,    -1,    96,    97,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    80,    -1,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    -1,    -1,    -1,    -1,    96,    97,
+       3,     4,     5,     6,    -1,     8,     9,    10,    11,    12,
+      13,    -1,    -1,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    -1,    40,    41,    42,
+      43,    44,    45,    46
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,   106,   107,     0,     3,     4,     5,     8,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    23,
+      26,    27,    28,    29,    30,    33,    34,    36,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      52,    53,    78,    87,    88,    93,    94,    96,    98,   100,
+     103,   108,   110,   111,   119,   125,   126,   132,   133,   134,
+     135,   136,   141,   146,   147,   156,   157,   158,   159,   160,
+     161,   163,   167,   171,   175,   179,   184,   186,   188,   190,
+     192,   194,   204,   205,   206,   218,   220,   221,   229,    44,
+      98,   103,   128,   130,   239,   244,   128,   128,   100,    13,
+     100,    13,    27,    28,    29,    30,    33,    36,    38,    40,
+      41,    42,    43,    44,    45,    46,    47,    52,    53,    87,
+      88,    93,    94,    98,   100,   146,   162,   165,   169,   173,
+     177,   183,   185,   187,   189,   191,   193,   203,   205,   207,
+     218,   220,   221,   228,   229,    44,    78,    12,    44,   183,
+     185,    44,    46,    89,    98,   112,   113,   116,   117,   118,
+      22,    89,    98,   120,   126,   146,   147,   206,   100,   110,
+      44,    44,   100,   125,   162,   189,   191,   183,   183,   183,
+     100,    44,    89,   165,    76,    81,   165,   230,   183,   183,
+     100,   183,   183,   183,   183,   109,   162,    97,   104,   222,
+     223,   224,    96,    96,     6,     7,    96,    96,    96,    96,
+      97,    80,    31,    32,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,   181,   181,    52,    53,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      79,   100,   197,   199,   195,    79,   236,     3,     4,     5,
+       6,     8,     9,    10,    11,    12,    13,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      40,    41,    42,    43,    44,    45,    46,    77,    99,   235,
+     240,   241,   242,   243,    97,   246,   247,    97,    79,    79,
+     162,   100,     3,     4,     5,    44,    98,   103,   127,   137,
+     138,   164,   168,   172,   176,   180,   184,   186,   188,   218,
+     220,   249,   250,   255,   259,   183,   189,   191,   183,   183,
+     183,    37,    44,   208,   183,   183,   183,   183,   183,   183,
+      12,    44,    77,    89,    99,   103,   213,   214,   215,   216,
+     217,   226,   231,   232,   233,   234,   235,   162,    97,    80,
+     181,   181,    52,    53,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    79,   197,   195,    76,   100,
+      44,   124,    22,    44,    99,   114,   115,    44,   123,    97,
+      96,   147,   167,   206,    44,   123,   124,    22,    44,    99,
+     121,   122,    96,   123,    96,   162,    16,   162,    24,    25,
+     152,   154,   100,   162,   208,   165,   125,   167,   219,   110,
+      50,    51,    44,    77,   148,   149,   150,   151,   238,   239,
+     244,   248,    99,   110,   101,    97,   104,   165,   225,   226,
+      97,   104,    89,   145,   145,   165,   165,    89,   183,   183,
+     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   165,   165,   200,   201,   202,   226,   102,   103,   196,
+     198,   199,   229,   196,   165,    81,   236,    44,    81,    99,
+      97,   227,   247,   104,   238,   245,   248,   130,   165,   165,
+     101,     3,     4,     5,    44,   138,   188,    44,   129,   131,
+     239,   244,   260,   129,   260,   129,   260,    44,    77,    99,
+     235,   251,   252,   253,   254,    97,   246,    96,    31,    44,
+     139,    97,    80,    32,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,   182,   182,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    79,   100,
+     165,   208,    98,   209,    44,    89,   103,   217,   234,   217,
+     165,   217,   165,   100,    97,   227,    81,   101,   165,   165,
+     183,   183,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   165,   165,   165,   219,   148,    44,   124,   124,    97,
+     227,   118,   113,   117,    96,   118,    44,   124,   124,    97,
+     227,   118,   101,   100,   101,   100,   125,   154,   155,   200,
+     101,   209,   230,   236,    44,   101,    97,   236,   236,   104,
+     222,   223,    44,   100,    44,   100,    81,   101,    97,   234,
+     162,   238,   238,   242,   243,    97,   227,    97,   227,   110,
+      44,   239,   244,   139,    79,   237,    97,    79,    79,    81,
+     236,   185,    81,    99,    97,   227,    98,   104,   185,   250,
+     254,   255,   256,   257,   258,   140,   162,   162,   162,   166,
+     170,   174,   178,   183,   185,   218,   220,   165,    89,   183,
+     183,   166,   166,   166,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   200,   209,    44,    96,   210,   211,   212,
+     213,   217,   165,   100,   104,   148,   232,    99,   165,    81,
+     101,    44,    44,   115,    99,    96,    96,   123,    22,    44,
+      22,    44,   122,    99,    96,   110,   162,    98,    44,   153,
+     239,   244,   101,   110,    76,   151,   238,   225,   100,   148,
+     100,   148,   165,   202,   104,   246,   104,   104,     9,   162,
+     166,    44,   131,   239,   244,   166,   166,   257,   257,   253,
+     254,    44,    77,    99,   235,   227,    97,   227,   236,    96,
+     101,   101,    80,   182,   182,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    79,    81,   101,    44,
+     213,    99,   212,   104,   101,   238,    81,   101,   165,    76,
+     118,   101,   142,   101,   195,   219,   148,   101,   148,   101,
+     238,   248,   110,   101,   185,   104,   246,   104,   140,   110,
+     110,   165,   183,   183,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   166,   166,   166,   165,   195,   213,   125,
+     101,   165,   125,   219,    96,    96,    21,    22,    99,   143,
+     125,   101,   125,   101,   125,   227,   110,   254,   257,   101,
+      81,   125,   162,    81,   125,   125,   104,   227,   110,   165,
+      81,   144,   104,   144,   110
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   105,   106,   107,   107,   108,   108,   108,   109,   109,
+     110,   110,   110,   110,   110,   110,   110,   110,   110,   110,
+     110,   110,   110,   110,   110,   110,   110,   110,   111,   111,
+     112,   112,   112,   112,   112,   113,   113,   114,   114,   115,
+     115,   115,   116,   117,   118,   119,   119,   119,   119,   119,
+     119,   119,   119,   119,   119,   120,   120,   121,   121,   122,
+     122,   122,   122,   122,   122,   123,   124,   125,   126,   126,
+     126,   127,   127,   127,   128,   128,   129,   129,   130,   130,
+     130,   131,   131,   131,   132,   132,   133,   133,   134,   134,
+     134,   134,   135,   136,   137,   137,   137,   138,   138,   138,
+     139,   140,   140,   141,   142,   142,   143,   143,   144,   144,
+     145,   145,   146,   146,   147,   147,   148,   148,   149,   149,
+     149,   150,   150,   151,   152,   153,   153,   153,   154,   155,
+     155,   156,   156,   157,   158,   159,   159,   160,   160,   161,
+     162,   162,   163,   163,   164,   164,   165,   165,   165,   165,
+     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   166,   166,   166,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   166,   166,   166,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   168,   168,   168,   168,   168,   168,   168,   168,   168,
+     168,   168,   168,   168,   168,   168,   169,   169,   170,   170,
+     171,   171,   172,   172,   173,   173,   174,   174,   175,   175,
+     176,   176,   177,   177,   178,   178,   179,   179,   180,   180,
+     181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
+     181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
+     181,   181,   181,   181,   182,   182,   182,   182,   182,   182,
+     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
+     182,   182,   182,   182,   182,   182,   182,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   184,   184,
+     184,   184,   184,   184,   184,   184,   184,   184,   184,   185,
+     185,   185,   186,   186,   186,   187,   187,   188,   188,   189,
+     189,   190,   190,   191,   191,   192,   192,   193,   194,   195,
+     195,   196,   196,   196,   197,   197,   198,   198,   199,   200,
+     200,   201,   201,   202,   202,   203,   203,   203,   203,   203,
+     203,   203,   203,   203,   203,   203,   203,   203,   203,   203,
+     203,   204,   204,   204,   204,   204,   204,   204,   204,   204,
+     204,   204,   204,   204,   204,   205,   205,   206,   207,   207,
+     208,   208,   209,   210,   210,   211,   211,   212,   212,   212,
+     212,   213,   214,   214,   214,   214,   215,   216,   217,   217,
+     218,   218,   218,   218,   219,   219,   220,   220,   220,   221,
+     221,   221,   221,   222,   222,   223,   223,   224,   224,   224,
+     225,   225,   226,   227,   227,   228,   228,   229,   229,   230,
+     230,   231,   231,   232,   232,   232,   232,   232,   232,   232,
+     233,   234,   234,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   236,   236,   237,   237,   238,   238,   238,   239,
+     239,   240,   240,   240,   241,   241,   242,   242,   242,   243,
+     244,   244,   244,   244,   245,   245,   246,   246,   247,   247,
+     248,   249,   249,   250,   250,   251,   251,   251,   252,   252,
+     253,   253,   253,   254,   255,   255,   255,   255,   256,   256,
+     257,   258,   258,   258,   259,   259,   259,   260,   260,   260
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     2,     1,     1,     1,     0,     2,
+       1,     2,     2,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     2,     2,     2,     1,     5,     3,
+       1,     1,     1,     3,     3,     2,     4,     1,     3,     1,
+       3,     3,     1,     3,     1,     5,     3,     5,     7,     3,
+       2,     2,     3,     3,     4,     2,     4,     1,     3,     1,
+       3,     3,     3,     3,     1,     1,     1,     3,     2,     2,
+       2,     2,     2,     2,     1,     3,     1,     3,     2,     3,
+       3,     2,     3,     3,     1,     2,     5,     7,     9,     7,
+       7,     8,     5,     7,     0,     1,     1,     1,     1,     1,
+       1,     0,     1,     7,     0,     2,     4,     3,     0,     2,
+       1,     0,     1,     0,     8,     7,     0,     1,     1,     3,
+       1,     1,     3,     1,     5,     1,     1,     1,     2,     0,
+       1,     4,     3,     5,     3,     1,     2,     1,     2,     2,
+       1,     3,     1,     3,     1,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     1,     1,
+       1,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     1,     1,     1,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     1,     1,
+       1,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     1,     1,     1,     1,     5,     1,     5,
+       1,     5,     1,     5,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     3,     3,     3,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     1,     1,     1,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     1,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     1,
+       2,     2,     1,     2,     2,     1,     1,     1,     1,     2,
+       6,     2,     6,     1,     2,     1,     2,     2,     2,     0,
+       2,     2,     3,     1,     2,     1,     1,     1,     3,     0,
+       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     1,     1,     1,     1,     8,     7,     4,     4,     3,
+       2,     0,     3,     0,     1,     2,     1,     1,     2,     3,
+       1,     5,     1,     2,     2,     3,     5,     6,     1,     3,
+       3,     6,     4,     7,     1,     1,     1,     2,     3,     2,
+       3,     3,     4,     1,     2,     0,     1,     2,     4,     3,
+       1,     1,     2,     0,     1,     2,     4,     1,     2,     2,
+       3,     1,     3,     3,     1,     1,     1,     1,     1,     1,
+       5,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     2,     0,     2,     2,     2,     2,     2,
+       3,     2,     3,     1,     1,     3,     3,     3,     2,     2,
+       3,     5,     8,     5,     1,     4,     0,     1,     1,     2,
+       2,     1,     1,     2,     3,     2,     3,     1,     1,     3,
+       3,     3,     2,     2,     3,     5,     8,     5,     1,     4,
+       2,     1,     1,     1,     2,     2,     2,     1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = JSFAST_EMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == JSFAST_EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (ctx, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use JSFAST_error or JSFAST_UNDEF. */
+#define YYERRCODE JSFAST_UNDEF
+
+
+/* Enable debugging if requested.  */
+#if JSFAST_DEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, ctx); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, JSParser *ctx)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (ctx);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, JSParser *ctx)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep, ctx);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, JSParser *ctx)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], ctx);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, ctx); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !JSFAST_DEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !JSFAST_DEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+/* Parser data structure.  */
+struct yypstate
+  {
+    /* Number of syntax errors so far.  */
+    int yynerrs;
+
+    yy_state_fast_t yystate;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss;
+    yy_state_t *yyssp;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs;
+    YYSTYPE *yyvsp;
+    /* Whether this instance has not started parsing yet.
+     * If 2, it corresponds to a finished parsing.  */
+    int yynew;
+  };
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yypstate* yyps;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypstate_expected_tokens (yypstate *yyps,
+                          yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyps->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+/* Similar to the previous function.  */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  return yypstate_expected_tokens (yyctx->yyps, yyarg, yyargn);
+}
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, JSParser *ctx)
+{
+  YY_USE (yyvaluep);
+  YY_USE (ctx);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  switch (yykind)
+    {
+    case YYSYMBOL_STRING: /* STRING  */
+#line 756 "build/generated/parser_fast.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 3950 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_REGEX: /* REGEX  */
+#line 756 "build/generated/parser_fast.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 3956 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_TEMPLATE_NO_SUB: /* TEMPLATE_NO_SUB  */
+#line 756 "build/generated/parser_fast.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 3962 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_TEMPLATE_HEAD: /* TEMPLATE_HEAD  */
+#line 756 "build/generated/parser_fast.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 3968 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_TEMPLATE_MIDDLE: /* TEMPLATE_MIDDLE  */
+#line 756 "build/generated/parser_fast.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 3974 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_TEMPLATE_TAIL: /* TEMPLATE_TAIL  */
+#line 756 "build/generated/parser_fast.y"
+            { if (((*yyvaluep).str)) free(((*yyvaluep).str)); }
+#line 3980 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_program: /* program  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 3986 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_module_item_list: /* module_item_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 3992 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_module_item: /* module_item  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 3998 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_stmt_list: /* stmt_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4004 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_stmt: /* stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4010 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_import_stmt: /* import_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4016 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_import_clause: /* import_clause  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4022 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_named_imports: /* named_imports  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4028 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_import_specifier_list: /* import_specifier_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4034 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_import_specifier: /* import_specifier  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4040 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_import_default_binding: /* import_default_binding  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4046 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_namespace_import: /* namespace_import  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4052 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_module_specifier: /* module_specifier  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4058 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_export_stmt: /* export_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4064 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_export_clause: /* export_clause  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4070 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_export_specifier_list: /* export_specifier_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4076 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_export_specifier: /* export_specifier  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4082 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_block: /* block  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4088 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_var_stmt: /* var_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4094 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_var_stmt_no_in: /* var_stmt_no_in  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4100 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_var_decl_list: /* var_decl_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4106 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_var_decl_list_no_in: /* var_decl_list_no_in  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4112 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_var_decl: /* var_decl  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4118 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_var_decl_no_in: /* var_decl_no_in  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4124 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_return_stmt: /* return_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4130 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_if_stmt: /* if_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4136 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_for_stmt: /* for_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4142 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_while_stmt: /* while_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4148 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_do_stmt: /* do_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4154 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_for_init: /* for_init  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4160 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_for_in_left: /* for_in_left  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4166 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_opt_expr: /* opt_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4172 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_switch_stmt: /* switch_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4178 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_switch_case_list: /* switch_case_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4184 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_switch_case: /* switch_case  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4190 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_case_stmt_seq: /* case_stmt_seq  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4196 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_func_decl: /* func_decl  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4202 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_opt_param_list: /* opt_param_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4208 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_param_list: /* param_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4214 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_param_list_items: /* param_list_items  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4220 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_rest_param: /* rest_param  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4226 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_catch_clause: /* catch_clause  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4232 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_catch_parameter: /* catch_parameter  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4238 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_finally_clause: /* finally_clause  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4244 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_finally_clause_opt: /* finally_clause_opt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4250 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_try_stmt: /* try_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4256 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_with_stmt: /* with_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4262 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_labeled_stmt: /* labeled_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4268 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_break_stmt: /* break_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4274 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_continue_stmt: /* continue_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4280 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_throw_stmt: /* throw_stmt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4286 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_expr: /* expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4292 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_expr_no_obj: /* expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4298 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_expr_no_in_no_obj: /* expr_no_in_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4304 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_expr: /* assignment_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4310 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_expr_no_in: /* assignment_expr_no_in  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4316 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_expr_no_obj: /* assignment_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4322 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_expr_no_in_no_obj: /* assignment_expr_no_in_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4328 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_conditional_expr: /* conditional_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4334 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_conditional_expr_no_in: /* conditional_expr_no_in  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4340 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_conditional_expr_no_obj: /* conditional_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4346 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_conditional_expr_no_in_no_obj: /* conditional_expr_no_in_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4352 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binary_expr: /* binary_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4358 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binary_expr_no_in: /* binary_expr_no_in  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4364 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binary_expr_no_obj: /* binary_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4370 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binary_expr_no_in_no_obj: /* binary_expr_no_in_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4376 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binary_chain: /* binary_chain  */
+#line 713 "build/generated/parser_fast.y"
+            { discard_binary_chain(((*yyvaluep).chain)); }
+#line 4382 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binary_chain_no_in: /* binary_chain_no_in  */
+#line 713 "build/generated/parser_fast.y"
+            { discard_binary_chain(((*yyvaluep).chain)); }
+#line 4388 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binary_chain_no_obj: /* binary_chain_no_obj  */
+#line 713 "build/generated/parser_fast.y"
+            { discard_binary_chain(((*yyvaluep).chain)); }
+#line 4394 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binary_chain_no_in_no_obj: /* binary_chain_no_in_no_obj  */
+#line 713 "build/generated/parser_fast.y"
+            { discard_binary_chain(((*yyvaluep).chain)); }
+#line 4400 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_unary_expr: /* unary_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4406 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_unary_expr_no_obj: /* unary_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4412 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_postfix_expr: /* postfix_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4418 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_postfix_expr_no_obj: /* postfix_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4424 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_left_hand_side_expr: /* left_hand_side_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4430 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_left_hand_side_expr_no_obj: /* left_hand_side_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4436 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_member_expr: /* member_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4442 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_member_expr_no_obj: /* member_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4448 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_new_expr: /* new_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4454 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_new_expr_no_obj: /* new_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4460 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_call_expr: /* call_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4466 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_call_expr_no_obj: /* call_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4472 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_member_suffix_seq: /* member_suffix_seq  */
+#line 712 "build/generated/parser_fast.y"
+            { discard_suffix_chain(((*yyvaluep).suffix)); }
+#line 4478 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_member_noncall_suffix: /* member_noncall_suffix  */
+#line 712 "build/generated/parser_fast.y"
+            { discard_suffix_chain(((*yyvaluep).suffix)); }
+#line 4484 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_call_suffix_seq: /* call_suffix_seq  */
+#line 712 "build/generated/parser_fast.y"
+            { discard_suffix_chain(((*yyvaluep).suffix)); }
+#line 4490 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_call_any_suffix: /* call_any_suffix  */
+#line 712 "build/generated/parser_fast.y"
+            { discard_suffix_chain(((*yyvaluep).suffix)); }
+#line 4496 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_call_suffix_initial: /* call_suffix_initial  */
+#line 712 "build/generated/parser_fast.y"
+            { discard_suffix_chain(((*yyvaluep).suffix)); }
+#line 4502 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_opt_arg_list: /* opt_arg_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4508 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_arg_list: /* arg_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4514 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_arg_item: /* arg_item  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4520 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_primary_expr: /* primary_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4526 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_primary_expr_no_obj: /* primary_expr_no_obj  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4532 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_function_expr: /* function_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4538 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_class_decl: /* class_decl  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4544 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_class_expr: /* class_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4550 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_class_heritage_opt: /* class_heritage_opt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4556 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_class_body: /* class_body  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4562 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_class_element_list_opt: /* class_element_list_opt  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4568 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_class_element_list: /* class_element_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4574 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_class_element: /* class_element  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4580 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_method_definition: /* method_definition  */
+#line 757 "build/generated/parser_fast.y"
+            { method_info_free(((*yyvaluep).method)); }
+#line 4586 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_method_head: /* method_head  */
+#line 757 "build/generated/parser_fast.y"
+            { method_info_free(((*yyvaluep).method)); }
+#line 4592 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_getter_definition: /* getter_definition  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4598 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_setter_definition: /* setter_definition  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4604 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_method_name: /* method_name  */
+#line 757 "build/generated/parser_fast.y"
+            { method_info_free(((*yyvaluep).method)); }
+#line 4610 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_arrow_function: /* arrow_function  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4616 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_arrow_body: /* arrow_body  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4622 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_yield_expr: /* yield_expr  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4628 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_array_literal: /* array_literal  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4634 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_elision: /* elision  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4640 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_elision_opt: /* elision_opt  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4646 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_element_list: /* element_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4652 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_el_item: /* el_item  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4658 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_spread_element: /* spread_element  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4664 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_object_literal: /* object_literal  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4670 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_template_literal: /* template_literal  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4676 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_template_part_list: /* template_part_list  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4682 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_prop_list: /* prop_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4688 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_prop: /* prop  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4694 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_computed_property: /* computed_property  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4700 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_initializer_opt: /* binding_initializer_opt  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4706 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_initializer_opt_no_in: /* binding_initializer_opt_no_in  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4712 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_element: /* binding_element  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4718 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_object_binding: /* object_binding  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4724 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_property_sequence: /* binding_property_sequence  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4730 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_property_list: /* binding_property_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4736 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_property: /* binding_property  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4742 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_rest_property: /* binding_rest_property  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4748 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_array_binding: /* array_binding  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4754 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_element_list: /* binding_element_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4760 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_elision_opt: /* binding_elision_opt  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4766 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_elision: /* binding_elision  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4772 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_binding_rest_element: /* binding_rest_element  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4778 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_pattern: /* assignment_pattern  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4784 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_object_assignment_pattern: /* object_assignment_pattern  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4790 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_property_sequence: /* assignment_property_sequence  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4796 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_property_list: /* assignment_property_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4802 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_property: /* assignment_property  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4808 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_rest_element: /* assignment_rest_element  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4814 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_array_assignment_pattern: /* array_assignment_pattern  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4820 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_element_list: /* assignment_element_list  */
+#line 711 "build/generated/parser_fast.y"
+            { ast_list_free(((*yyvaluep).list)); }
+#line 4826 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_element: /* assignment_element  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4832 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_assignment_target: /* assignment_target  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4838 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_for_binding: /* for_binding  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4844 "build/generated/parser_fast.c"
+        break;
+
+    case YYSYMBOL_for_binding_declarator: /* for_binding_declarator  */
+#line 710 "build/generated/parser_fast.y"
+            { ast_free(((*yyvaluep).node)); }
+#line 4850 "build/generated/parser_fast.c"
+        break;
+
+      default:
+        break;
+    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+#define jsfast_nerrs yyps->jsfast_nerrs
+#define yystate yyps->yystate
+#define yyerrstatus yyps->yyerrstatus
+#define yyssa yyps->yyssa
+#define yyss yyps->yyss
+#define yyssp yyps->yyssp
+#define yyvsa yyps->yyvsa
+#define yyvs yyps->yyvs
+#define yyvsp yyps->yyvsp
+#define yystacksize yyps->yystacksize
+
+/* Initialize the parser data structure.  */
+static void
+yypstate_clear (yypstate *yyps)
+{
+  yynerrs = 0;
+  yystate = 0;
+  yyerrstatus = 0;
+
+  yyssp = yyss;
+  yyvsp = yyvs;
+
+  /* Initialize the state stack, in case yypcontext_expected_tokens is
+     called before the first call to yyparse. */
+  *yyssp = 0;
+  yyps->yynew = 1;
+}
+
+/* Initialize the parser data structure.  */
+yypstate *
+yypstate_new (void)
+{
+  yypstate *yyps;
+  yyps = YY_CAST (yypstate *, YYMALLOC (sizeof *yyps));
+  if (!yyps)
+    return YY_NULLPTR;
+  yystacksize = YYINITDEPTH;
+  yyss = yyssa;
+  yyvs = yyvsa;
+  yypstate_clear (yyps);
+  return yyps;
+}
+
+void
+yypstate_delete (yypstate *yyps)
+{
+  if (yyps)
+    {
+#ifndef yyoverflow
+      /* If the stack was reallocated but the parse did not complete, then the
+         stack still needs to be freed.  */
+      if (yyss != yyssa)
+        YYSTACK_FREE (yyss);
+#endif
+      YYFREE (yyps);
+    }
+}
+
+
+
+/*---------------.
+| yypush_parse.  |
+`---------------*/
+
+int
+yypush_parse (yypstate *yyps,
+              int yypushed_char, YYSTYPE const *yypushed_val, JSParser *ctx)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  switch (yyps->yynew)
+    {
+    case 0:
+      yyn = yypact[yystate];
+      goto yyread_pushed_token;
+
+    case 2:
+      yypstate_clear (yyps);
+      break;
+
+    default:
+      break;
+    }
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = JSFAST_EMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == JSFAST_EMPTY)
+    {
+      if (!yyps->yynew)
+        {
+          YYDPRINTF ((stderr, "Return for a new token:\n"));
+          yyresult = YYPUSH_MORE;
+          goto yypushreturn;
+        }
+      yyps->yynew = 0;
+yyread_pushed_token:
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yypushed_char;
+      if (yypushed_val)
+        yylval = *yypushed_val;
+    }
+
+  if (yychar <= JSFAST_EOF)
+    {
+      yychar = JSFAST_EOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == JSFAST_error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = JSFAST_UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = JSFAST_EMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: module_item_list  */
+#line 763 "build/generated/parser_fast.y"
+      {
+          if (ctx->statement_mode) {
+              // 分段解析到了输入末尾：交给驱动拼接
+              ctx->statement_items = (yyvsp[0].list);
+              ctx->statement_lookahead = false;
+              (yyval.node) = NULL;
+          } else {
+              (yyval.node) = ast_make_program((yyvsp[0].list));
+              ctx->ast_root = (yyval.node);
+          }
+      }
+#line 5200 "build/generated/parser_fast.c"
+    break;
+
+  case 3: /* module_item_list: %empty  */
+#line 778 "build/generated/parser_fast.y"
+      { (yyval.list) = NULL; }
+#line 5206 "build/generated/parser_fast.c"
+    break;
+
+  case 4: /* module_item_list: module_item_list module_item  */
+#line 780 "build/generated/parser_fast.y"
+      {
+          (yyval.list) = ast_list_append((yyvsp[-1].list), (yyvsp[0].node));
+          END_STATEMENT_SEGMENT((yyval.list));
+      }
+#line 5215 "build/generated/parser_fast.c"
+    break;
+
+  case 5: /* module_item: stmt  */
+#line 788 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5221 "build/generated/parser_fast.c"
+    break;
+
+  case 6: /* module_item: import_stmt  */
+#line 790 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5227 "build/generated/parser_fast.c"
+    break;
+
+  case 7: /* module_item: export_stmt  */
+#line 792 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5233 "build/generated/parser_fast.c"
+    break;
+
+  case 8: /* stmt_list: %empty  */
+#line 797 "build/generated/parser_fast.y"
+      { (yyval.list) = NULL; }
+#line 5239 "build/generated/parser_fast.c"
+    break;
+
+  case 9: /* stmt_list: stmt_list stmt  */
+#line 799 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-1].list), (yyvsp[0].node)); }
+#line 5245 "build/generated/parser_fast.c"
+    break;
+
+  case 10: /* stmt: ';'  */
+#line 804 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_empty_statement(); }
+#line 5251 "build/generated/parser_fast.c"
+    break;
+
+  case 11: /* stmt: var_stmt ';'  */
+#line 806 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[-1].node); }
+#line 5257 "build/generated/parser_fast.c"
+    break;
+
+  case 12: /* stmt: expr_no_obj ';'  */
+#line 808 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_expression_stmt((yyvsp[-1].node)); }
+#line 5263 "build/generated/parser_fast.c"
+    break;
+
+  case 13: /* stmt: block  */
+#line 810 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5269 "build/generated/parser_fast.c"
+    break;
+
+  case 14: /* stmt: if_stmt  */
+#line 812 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5275 "build/generated/parser_fast.c"
+    break;
+
+  case 15: /* stmt: for_stmt  */
+#line 814 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5281 "build/generated/parser_fast.c"
+    break;
+
+  case 16: /* stmt: while_stmt  */
+#line 816 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5287 "build/generated/parser_fast.c"
+    break;
+
+  case 17: /* stmt: do_stmt  */
+#line 818 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5293 "build/generated/parser_fast.c"
+    break;
+
+  case 18: /* stmt: switch_stmt  */
+#line 820 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5299 "build/generated/parser_fast.c"
+    break;
+
+  case 19: /* stmt: try_stmt  */
+#line 822 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5305 "build/generated/parser_fast.c"
+    break;
+
+  case 20: /* stmt: with_stmt  */
+#line 824 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5311 "build/generated/parser_fast.c"
+    break;
+
+  case 21: /* stmt: func_decl  */
+#line 826 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5317 "build/generated/parser_fast.c"
+    break;
+
+  case 22: /* stmt: class_decl  */
+#line 828 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5323 "build/generated/parser_fast.c"
+    break;
+
+  case 23: /* stmt: return_stmt ';'  */
+#line 830 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[-1].node); }
+#line 5329 "build/generated/parser_fast.c"
+    break;
+
+  case 24: /* stmt: break_stmt ';'  */
+#line 832 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[-1].node); }
+#line 5335 "build/generated/parser_fast.c"
+    break;
+
+  case 25: /* stmt: continue_stmt ';'  */
+#line 834 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[-1].node); }
+#line 5341 "build/generated/parser_fast.c"
+    break;
+
+  case 26: /* stmt: throw_stmt ';'  */
+#line 836 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[-1].node); }
+#line 5347 "build/generated/parser_fast.c"
+    break;
+
+  case 27: /* stmt: labeled_stmt  */
+#line 838 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5353 "build/generated/parser_fast.c"
+    break;
+
+  case 28: /* import_stmt: IMPORT import_clause from_keyword module_specifier ';'  */
+#line 843 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_import_decl((yyvsp[-3].list), (yyvsp[-1].node)); }
+#line 5359 "build/generated/parser_fast.c"
+    break;
+
+  case 29: /* import_stmt: IMPORT module_specifier ';'  */
+#line 845 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_import_decl(NULL, (yyvsp[-1].node)); }
+#line 5365 "build/generated/parser_fast.c"
+    break;
+
+  case 30: /* import_clause: import_default_binding  */
+#line 850 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 5371 "build/generated/parser_fast.c"
+    break;
+
+  case 31: /* import_clause: namespace_import  */
+#line 852 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 5377 "build/generated/parser_fast.c"
+    break;
+
+  case 32: /* import_clause: named_imports  */
+#line 854 "build/generated/parser_fast.y"
+      { (yyval.list) = (yyvsp[0].list); }
+#line 5383 "build/generated/parser_fast.c"
+    break;
+
+  case 33: /* import_clause: import_default_binding ',' namespace_import  */
+#line 856 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_append(NULL, (yyvsp[-2].node)); (yyval.list) = ast_list_append(list, (yyvsp[0].node)); }
+#line 5389 "build/generated/parser_fast.c"
+    break;
+
+  case 34: /* import_clause: import_default_binding ',' named_imports  */
+#line 858 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_append(NULL, (yyvsp[-2].node)); (yyval.list) = ast_list_concat(list, (yyvsp[0].list)); }
+#line 5395 "build/generated/parser_fast.c"
+    break;
+
+  case 35: /* named_imports: '{' '}'  */
+#line 863 "build/generated/parser_fast.y"
+            { (yyval.list) = NULL; }
+#line 5401 "build/generated/parser_fast.c"
+    break;
+
+  case 36: /* named_imports: '{' import_specifier_list opt_trailing_comma '}'  */
+#line 865 "build/generated/parser_fast.y"
+            { (yyval.list) = (yyvsp[-2].list); }
+#line 5407 "build/generated/parser_fast.c"
+    break;
+
+  case 37: /* import_specifier_list: import_specifier  */
+#line 870 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 5413 "build/generated/parser_fast.c"
+    break;
+
+  case 38: /* import_specifier_list: import_specifier_list ',' import_specifier  */
+#line 872 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 5419 "build/generated/parser_fast.c"
+    break;
+
+  case 39: /* import_specifier: IDENTIFIER  */
+#line 877 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_import_specifier((yyvsp[0].atom), (yyvsp[0].atom), false, false); }
+#line 5425 "build/generated/parser_fast.c"
+    break;
+
+  case 40: /* import_specifier: IDENTIFIER as_keyword IDENTIFIER  */
+#line 879 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_import_specifier((yyvsp[0].atom), (yyvsp[-2].atom), false, false); }
+#line 5431 "build/generated/parser_fast.c"
+    break;
+
+  case 41: /* import_specifier: DEFAULT as_keyword IDENTIFIER  */
+#line 881 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_import_specifier((yyvsp[0].atom), ATOM(ctx->atoms, DEFAULT), false, false); }
+#line 5437 "build/generated/parser_fast.c"
+    break;
+
+  case 42: /* import_default_binding: IDENTIFIER  */
+#line 886 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_import_specifier((yyvsp[0].atom), ATOM(ctx->atoms, DEFAULT), false, true); }
+#line 5443 "build/generated/parser_fast.c"
+    break;
+
+  case 43: /* namespace_import: '*' as_keyword IDENTIFIER  */
+#line 891 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_import_specifier((yyvsp[0].atom), NULL, true, false); }
+#line 5449 "build/generated/parser_fast.c"
+    break;
+
+  case 44: /* module_specifier: STRING  */
+#line 896 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_string_literal((yyvsp[0].str)); }
+#line 5455 "build/generated/parser_fast.c"
+    break;
+
+  case 45: /* export_stmt: EXPORT export_clause from_keyword module_specifier ';'  */
+#line 901 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(false, false, NULL, NULL, (yyvsp[-3].list), (yyvsp[-1].node)); }
+#line 5461 "build/generated/parser_fast.c"
+    break;
+
+  case 46: /* export_stmt: EXPORT export_clause ';'  */
+#line 903 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(false, false, NULL, NULL, (yyvsp[-1].list), NULL); }
+#line 5467 "build/generated/parser_fast.c"
+    break;
+
+  case 47: /* export_stmt: EXPORT '*' from_keyword module_specifier ';'  */
+#line 905 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(false, true, NULL, NULL, NULL, (yyvsp[-1].node)); }
+#line 5473 "build/generated/parser_fast.c"
+    break;
+
+  case 48: /* export_stmt: EXPORT '*' as_keyword IDENTIFIER from_keyword module_specifier ';'  */
+#line 907 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(false, true, (yyvsp[-3].atom), NULL, NULL, (yyvsp[-1].node)); }
+#line 5479 "build/generated/parser_fast.c"
+    break;
+
+  case 49: /* export_stmt: EXPORT var_stmt ';'  */
+#line 909 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(false, false, NULL, (yyvsp[-1].node), NULL, NULL); }
+#line 5485 "build/generated/parser_fast.c"
+    break;
+
+  case 50: /* export_stmt: EXPORT func_decl  */
+#line 911 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(false, false, NULL, (yyvsp[0].node), NULL, NULL); }
+#line 5491 "build/generated/parser_fast.c"
+    break;
+
+  case 51: /* export_stmt: EXPORT class_decl  */
+#line 913 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(false, false, NULL, (yyvsp[0].node), NULL, NULL); }
+#line 5497 "build/generated/parser_fast.c"
+    break;
+
+  case 52: /* export_stmt: EXPORT DEFAULT func_decl  */
+#line 915 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(true, false, NULL, (yyvsp[0].node), NULL, NULL); }
+#line 5503 "build/generated/parser_fast.c"
+    break;
+
+  case 53: /* export_stmt: EXPORT DEFAULT class_decl  */
+#line 917 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(true, false, NULL, (yyvsp[0].node), NULL, NULL); }
+#line 5509 "build/generated/parser_fast.c"
+    break;
+
+  case 54: /* export_stmt: EXPORT DEFAULT assignment_expr_no_obj ';'  */
+#line 919 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_decl(true, false, NULL, (yyvsp[-1].node), NULL, NULL); }
+#line 5515 "build/generated/parser_fast.c"
+    break;
+
+  case 55: /* export_clause: '{' '}'  */
+#line 924 "build/generated/parser_fast.y"
+            { (yyval.list) = NULL; }
+#line 5521 "build/generated/parser_fast.c"
+    break;
+
+  case 56: /* export_clause: '{' export_specifier_list opt_trailing_comma '}'  */
+#line 926 "build/generated/parser_fast.y"
+            { (yyval.list) = (yyvsp[-2].list); }
+#line 5527 "build/generated/parser_fast.c"
+    break;
+
+  case 57: /* export_specifier_list: export_specifier  */
+#line 931 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 5533 "build/generated/parser_fast.c"
+    break;
+
+  case 58: /* export_specifier_list: export_specifier_list ',' export_specifier  */
+#line 933 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 5539 "build/generated/parser_fast.c"
+    break;
+
+  case 59: /* export_specifier: IDENTIFIER  */
+#line 938 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_specifier((yyvsp[0].atom), NULL, false); }
+#line 5545 "build/generated/parser_fast.c"
+    break;
+
+  case 60: /* export_specifier: IDENTIFIER as_keyword IDENTIFIER  */
+#line 940 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_specifier((yyvsp[-2].atom), (yyvsp[0].atom), false); }
+#line 5551 "build/generated/parser_fast.c"
+    break;
+
+  case 61: /* export_specifier: IDENTIFIER as_keyword DEFAULT  */
+#line 942 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_specifier((yyvsp[-2].atom), ATOM(ctx->atoms, DEFAULT), false); }
+#line 5557 "build/generated/parser_fast.c"
+    break;
+
+  case 62: /* export_specifier: DEFAULT as_keyword IDENTIFIER  */
+#line 944 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), (yyvsp[0].atom), false); }
+#line 5563 "build/generated/parser_fast.c"
+    break;
+
+  case 63: /* export_specifier: DEFAULT as_keyword DEFAULT  */
+#line 946 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), ATOM(ctx->atoms, DEFAULT), false); }
+#line 5569 "build/generated/parser_fast.c"
+    break;
+
+  case 64: /* export_specifier: DEFAULT  */
+#line 948 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), NULL, false); }
+#line 5575 "build/generated/parser_fast.c"
+    break;
+
+  case 65: /* from_keyword: IDENTIFIER  */
+#line 953 "build/generated/parser_fast.y"
+      {
+          if (!identifier_is((yyvsp[0].atom), ATOM(ctx->atoms, FROM))) {
+              yyerror(ctx, "Expected 'from' in module statement");
+              YYERROR;
+          }
+          (yyval.atom) = NULL;
+      }
+#line 5587 "build/generated/parser_fast.c"
+    break;
+
+  case 66: /* as_keyword: IDENTIFIER  */
+#line 964 "build/generated/parser_fast.y"
+      {
+          if (!identifier_is((yyvsp[0].atom), ATOM(ctx->atoms, AS))) {
+              yyerror(ctx, "Expected 'as' in module statement");
+              YYERROR;
+          }
+          (yyval.atom) = NULL;
+      }
+#line 5599 "build/generated/parser_fast.c"
+    break;
+
+  case 67: /* block: '{' stmt_list '}'  */
+#line 975 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_block((yyvsp[-1].list)); }
+#line 5605 "build/generated/parser_fast.c"
+    break;
+
+  case 68: /* var_stmt: VAR var_decl_list  */
+#line 980 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_VAR, (yyvsp[0].list)); }
+#line 5611 "build/generated/parser_fast.c"
+    break;
+
+  case 69: /* var_stmt: LET var_decl_list  */
+#line 982 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_LET, (yyvsp[0].list)); }
+#line 5617 "build/generated/parser_fast.c"
+    break;
+
+  case 70: /* var_stmt: CONST var_decl_list  */
+#line 984 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_CONST, (yyvsp[0].list)); }
+#line 5623 "build/generated/parser_fast.c"
+    break;
+
+  case 71: /* var_stmt_no_in: VAR var_decl_list_no_in  */
+#line 989 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_VAR, (yyvsp[0].list)); }
+#line 5629 "build/generated/parser_fast.c"
+    break;
+
+  case 72: /* var_stmt_no_in: LET var_decl_list_no_in  */
+#line 991 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_LET, (yyvsp[0].list)); }
+#line 5635 "build/generated/parser_fast.c"
+    break;
+
+  case 73: /* var_stmt_no_in: CONST var_decl_list_no_in  */
+#line 993 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_CONST, (yyvsp[0].list)); }
+#line 5641 "build/generated/parser_fast.c"
+    break;
+
+  case 74: /* var_decl_list: var_decl  */
+#line 998 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 5647 "build/generated/parser_fast.c"
+    break;
+
+  case 75: /* var_decl_list: var_decl_list ',' var_decl  */
+#line 1000 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 5653 "build/generated/parser_fast.c"
+    break;
+
+  case 76: /* var_decl_list_no_in: var_decl_no_in  */
+#line 1005 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 5659 "build/generated/parser_fast.c"
+    break;
+
+  case 77: /* var_decl_list_no_in: var_decl_list_no_in ',' var_decl_no_in  */
+#line 1007 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 5665 "build/generated/parser_fast.c"
+    break;
+
+  case 78: /* var_decl: IDENTIFIER binding_initializer_opt  */
+#line 1012 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier((yyvsp[-1].atom)), (yyvsp[0].node))); }
+#line 5671 "build/generated/parser_fast.c"
+    break;
+
+  case 79: /* var_decl: object_binding '=' assignment_expr  */
+#line 1014 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern((yyvsp[-2].node), (yyvsp[0].node))); }
+#line 5677 "build/generated/parser_fast.c"
+    break;
+
+  case 80: /* var_decl: array_binding '=' assignment_expr  */
+#line 1016 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern((yyvsp[-2].node), (yyvsp[0].node))); }
+#line 5683 "build/generated/parser_fast.c"
+    break;
+
+  case 81: /* var_decl_no_in: IDENTIFIER binding_initializer_opt_no_in  */
+#line 1021 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier((yyvsp[-1].atom)), (yyvsp[0].node))); }
+#line 5689 "build/generated/parser_fast.c"
+    break;
+
+  case 82: /* var_decl_no_in: object_binding '=' assignment_expr_no_in  */
+#line 1023 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern((yyvsp[-2].node), (yyvsp[0].node))); }
+#line 5695 "build/generated/parser_fast.c"
+    break;
+
+  case 83: /* var_decl_no_in: array_binding '=' assignment_expr_no_in  */
+#line 1025 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern((yyvsp[-2].node), (yyvsp[0].node))); }
+#line 5701 "build/generated/parser_fast.c"
+    break;
+
+  case 84: /* return_stmt: RETURN  */
+#line 1030 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_return(NULL); }
+#line 5707 "build/generated/parser_fast.c"
+    break;
+
+  case 85: /* return_stmt: RETURN expr  */
+#line 1032 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_return((yyvsp[0].node)); }
+#line 5713 "build/generated/parser_fast.c"
+    break;
+
+  case 86: /* if_stmt: IF '(' expr ')' stmt  */
+#line 1037 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_if((yyvsp[-2].node), (yyvsp[0].node), NULL); }
+#line 5719 "build/generated/parser_fast.c"
+    break;
+
+  case 87: /* if_stmt: IF '(' expr ')' stmt ELSE stmt  */
+#line 1039 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_if((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 5725 "build/generated/parser_fast.c"
+    break;
+
+  case 88: /* for_stmt: FOR '(' for_init ';' opt_expr ';' opt_expr ')' stmt  */
+#line 1044 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_for((yyvsp[-6].node), (yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 5731 "build/generated/parser_fast.c"
+    break;
+
+  case 89: /* for_stmt: FOR '(' for_in_left IN expr ')' stmt  */
+#line 1046 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_for_in((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 5737 "build/generated/parser_fast.c"
+    break;
+
+  case 90: /* for_stmt: FOR '(' for_in_left for_of_keyword expr ')' stmt  */
+#line 1048 "build/generated/parser_fast.y"
+    { (yyval.node) = ast_make_for_of((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node), false); }
+#line 5743 "build/generated/parser_fast.c"
+    break;
+
+  case 91: /* for_stmt: FOR AWAIT '(' for_in_left for_of_keyword expr ')' stmt  */
+#line 1050 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_for_of((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node), true); }
+#line 5749 "build/generated/parser_fast.c"
+    break;
+
+  case 92: /* while_stmt: WHILE '(' expr ')' stmt  */
+#line 1055 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_while((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 5755 "build/generated/parser_fast.c"
+    break;
+
+  case 93: /* do_stmt: DO stmt WHILE '(' expr ')' ';'  */
+#line 1060 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_do_while((yyvsp[-5].node), (yyvsp[-2].node)); }
+#line 5761 "build/generated/parser_fast.c"
+    break;
+
+  case 94: /* for_init: %empty  */
+#line 1065 "build/generated/parser_fast.y"
+      { (yyval.node) = NULL; }
+#line 5767 "build/generated/parser_fast.c"
+    break;
+
+  case 95: /* for_init: var_stmt_no_in  */
+#line 1067 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5773 "build/generated/parser_fast.c"
+    break;
+
+  case 96: /* for_init: expr_no_in_no_obj  */
+#line 1069 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5779 "build/generated/parser_fast.c"
+    break;
+
+  case 97: /* for_in_left: for_binding  */
+#line 1074 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5785 "build/generated/parser_fast.c"
+    break;
+
+  case 98: /* for_in_left: assignment_pattern  */
+#line 1076 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5791 "build/generated/parser_fast.c"
+    break;
+
+  case 99: /* for_in_left: left_hand_side_expr_no_obj  */
+#line 1078 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5797 "build/generated/parser_fast.c"
+    break;
+
+  case 100: /* for_of_keyword: IDENTIFIER  */
+#line 1083 "build/generated/parser_fast.y"
+      {
+          if (!identifier_is((yyvsp[0].atom), ATOM(ctx->atoms, OF))) {
+              yyerror(ctx, "Expected 'of' in for-of statement");
+              YYERROR;
+          }
+          (yyval.atom) = NULL;
+      }
+#line 5809 "build/generated/parser_fast.c"
+    break;
+
+  case 101: /* opt_expr: %empty  */
+#line 1094 "build/generated/parser_fast.y"
+      { (yyval.node) = NULL; }
+#line 5815 "build/generated/parser_fast.c"
+    break;
+
+  case 102: /* opt_expr: expr  */
+#line 1096 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5821 "build/generated/parser_fast.c"
+    break;
+
+  case 103: /* switch_stmt: SWITCH '(' expr ')' '{' switch_case_list '}'  */
+#line 1101 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_switch((yyvsp[-4].node), (yyvsp[-1].list)); }
+#line 5827 "build/generated/parser_fast.c"
+    break;
+
+  case 104: /* switch_case_list: %empty  */
+#line 1106 "build/generated/parser_fast.y"
+            { (yyval.list) = NULL; }
+#line 5833 "build/generated/parser_fast.c"
+    break;
+
+  case 105: /* switch_case_list: switch_case_list switch_case  */
+#line 1108 "build/generated/parser_fast.y"
+            { (yyval.list) = ast_list_append((yyvsp[-1].list), (yyvsp[0].node)); }
+#line 5839 "build/generated/parser_fast.c"
+    break;
+
+  case 106: /* switch_case: CASE expr ':' case_stmt_seq  */
+#line 1113 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_switch_case((yyvsp[-2].node), (yyvsp[0].list)); }
+#line 5845 "build/generated/parser_fast.c"
+    break;
+
+  case 107: /* switch_case: DEFAULT ':' case_stmt_seq  */
+#line 1115 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_switch_default((yyvsp[0].list)); }
+#line 5851 "build/generated/parser_fast.c"
+    break;
+
+  case 108: /* case_stmt_seq: %empty  */
+#line 1120 "build/generated/parser_fast.y"
+            { (yyval.list) = NULL; }
+#line 5857 "build/generated/parser_fast.c"
+    break;
+
+  case 109: /* case_stmt_seq: case_stmt_seq stmt  */
+#line 1122 "build/generated/parser_fast.y"
+            { (yyval.list) = ast_list_append((yyvsp[-1].list), (yyvsp[0].node)); }
+#line 5863 "build/generated/parser_fast.c"
+    break;
+
+  case 110: /* generator_marker_opt: '*'  */
+#line 1127 "build/generated/parser_fast.y"
+      { (yyval.boolean) = 1; }
+#line 5869 "build/generated/parser_fast.c"
+    break;
+
+  case 111: /* generator_marker_opt: %empty  */
+#line 1129 "build/generated/parser_fast.y"
+      { (yyval.boolean) = 0; }
+#line 5875 "build/generated/parser_fast.c"
+    break;
+
+  case 112: /* async_modifier_opt: ASYNC  */
+#line 1134 "build/generated/parser_fast.y"
+      { (yyval.boolean) = 1; }
+#line 5881 "build/generated/parser_fast.c"
+    break;
+
+  case 113: /* async_modifier_opt: %empty  */
+#line 1136 "build/generated/parser_fast.y"
+      { (yyval.boolean) = 0; }
+#line 5887 "build/generated/parser_fast.c"
+    break;
+
+  case 114: /* func_decl: async_modifier_opt FUNCTION_DECL generator_marker_opt IDENTIFIER '(' opt_param_list ')' block  */
+#line 1141 "build/generated/parser_fast.y"
+      {
+          (yyval.node) = ast_make_function_decl((yyvsp[-4].atom), (yyvsp[-2].list), (yyvsp[0].node));
+          if ((yyvsp[-5].boolean) && (yyval.node)) {
+              (yyval.node)->data.function_decl.is_generator = true;
+          }
+          if ((yyvsp[-7].boolean) && (yyval.node)) {
+              (yyval.node)->data.function_decl.is_async = true;
+          }
+      }
+#line 5901 "build/generated/parser_fast.c"
+    break;
+
+  case 115: /* func_decl: async_modifier_opt FUNCTION_DECL generator_marker_opt '(' opt_param_list ')' block  */
+#line 1151 "build/generated/parser_fast.y"
+      {
+          (yyval.node) = ast_make_function_decl(NULL, (yyvsp[-2].list), (yyvsp[0].node));
+          if ((yyvsp[-4].boolean) && (yyval.node)) {
+              (yyval.node)->data.function_decl.is_generator = true;
+          }
+          if ((yyvsp[-6].boolean) && (yyval.node)) {
+              (yyval.node)->data.function_decl.is_async = true;
+          }
+      }
+#line 5915 "build/generated/parser_fast.c"
+    break;
+
+  case 116: /* opt_param_list: %empty  */
+#line 1165 "build/generated/parser_fast.y"
+      { (yyval.list) = NULL; }
+#line 5921 "build/generated/parser_fast.c"
+    break;
+
+  case 117: /* opt_param_list: param_list  */
+#line 1167 "build/generated/parser_fast.y"
+      { (yyval.list) = (yyvsp[0].list); }
+#line 5927 "build/generated/parser_fast.c"
+    break;
+
+  case 118: /* param_list: param_list_items  */
+#line 1172 "build/generated/parser_fast.y"
+      { (yyval.list) = (yyvsp[0].list); }
+#line 5933 "build/generated/parser_fast.c"
+    break;
+
+  case 119: /* param_list: param_list_items ',' rest_param  */
+#line 1174 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 5939 "build/generated/parser_fast.c"
+    break;
+
+  case 120: /* param_list: rest_param  */
+#line 1176 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 5945 "build/generated/parser_fast.c"
+    break;
+
+  case 121: /* param_list_items: binding_element  */
+#line 1181 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 5951 "build/generated/parser_fast.c"
+    break;
+
+  case 122: /* param_list_items: param_list_items ',' binding_element  */
+#line 1183 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 5957 "build/generated/parser_fast.c"
+    break;
+
+  case 123: /* rest_param: binding_rest_element  */
+#line 1188 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 5963 "build/generated/parser_fast.c"
+    break;
+
+  case 124: /* catch_clause: CATCH '(' catch_parameter ')' block  */
+#line 1193 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_catch((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 5969 "build/generated/parser_fast.c"
+    break;
+
+  case 125: /* catch_parameter: IDENTIFIER  */
+#line 1198 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_binding_pattern(ast_make_identifier((yyvsp[0].atom)), NULL); }
+#line 5975 "build/generated/parser_fast.c"
+    break;
+
+  case 126: /* catch_parameter: object_binding  */
+#line 1200 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_binding_pattern((yyvsp[0].node), NULL); }
+#line 5981 "build/generated/parser_fast.c"
+    break;
+
+  case 127: /* catch_parameter: array_binding  */
+#line 1202 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_binding_pattern((yyvsp[0].node), NULL); }
+#line 5987 "build/generated/parser_fast.c"
+    break;
+
+  case 128: /* finally_clause: FINALLY block  */
+#line 1207 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 5993 "build/generated/parser_fast.c"
+    break;
+
+  case 129: /* finally_clause_opt: %empty  */
+#line 1212 "build/generated/parser_fast.y"
+            { (yyval.node) = NULL; }
+#line 5999 "build/generated/parser_fast.c"
+    break;
+
+  case 130: /* finally_clause_opt: finally_clause  */
+#line 1214 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 6005 "build/generated/parser_fast.c"
+    break;
+
+  case 131: /* try_stmt: TRY block catch_clause finally_clause_opt  */
+#line 1219 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_try((yyvsp[-2].node), (yyvsp[-1].node), (yyvsp[0].node)); }
+#line 6011 "build/generated/parser_fast.c"
+    break;
+
+  case 132: /* try_stmt: TRY block finally_clause  */
+#line 1221 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_try((yyvsp[-1].node), NULL, (yyvsp[0].node)); }
+#line 6017 "build/generated/parser_fast.c"
+    break;
+
+  case 133: /* with_stmt: WITH '(' expr ')' stmt  */
+#line 1226 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_with((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6023 "build/generated/parser_fast.c"
+    break;
+
+  case 134: /* labeled_stmt: IDENTIFIER ':' stmt  */
+#line 1231 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_labeled((yyvsp[-2].atom), (yyvsp[0].node)); }
+#line 6029 "build/generated/parser_fast.c"
+    break;
+
+  case 135: /* break_stmt: BREAK  */
+#line 1236 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_break(NULL); }
+#line 6035 "build/generated/parser_fast.c"
+    break;
+
+  case 136: /* break_stmt: BREAK IDENTIFIER  */
+#line 1238 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_break((yyvsp[0].atom)); }
+#line 6041 "build/generated/parser_fast.c"
+    break;
+
+  case 137: /* continue_stmt: CONTINUE  */
+#line 1243 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_continue(NULL); }
+#line 6047 "build/generated/parser_fast.c"
+    break;
+
+  case 138: /* continue_stmt: CONTINUE IDENTIFIER  */
+#line 1245 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_continue((yyvsp[0].atom)); }
+#line 6053 "build/generated/parser_fast.c"
+    break;
+
+  case 139: /* throw_stmt: THROW expr  */
+#line 1250 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_throw((yyvsp[0].node)); }
+#line 6059 "build/generated/parser_fast.c"
+    break;
+
+  case 140: /* expr: assignment_expr  */
+#line 1259 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6065 "build/generated/parser_fast.c"
+    break;
+
+  case 141: /* expr: expr ',' assignment_expr  */
+#line 1261 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_sequence((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6071 "build/generated/parser_fast.c"
+    break;
+
+  case 142: /* expr_no_obj: assignment_expr_no_obj  */
+#line 1266 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6077 "build/generated/parser_fast.c"
+    break;
+
+  case 143: /* expr_no_obj: expr_no_obj ',' assignment_expr  */
+#line 1268 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_sequence((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6083 "build/generated/parser_fast.c"
+    break;
+
+  case 144: /* expr_no_in_no_obj: assignment_expr_no_in_no_obj  */
+#line 1273 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6089 "build/generated/parser_fast.c"
+    break;
+
+  case 145: /* expr_no_in_no_obj: expr_no_in_no_obj ',' assignment_expr_no_in  */
+#line 1275 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_sequence((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6095 "build/generated/parser_fast.c"
+    break;
+
+  case 146: /* assignment_expr: postfix_expr '=' assignment_expr  */
+#line 1280 "build/generated/parser_fast.y"
+            {
+	        ASTNode *lhs = convert_assignment_target((yyvsp[-2].node), true);
+	        if (!lhs) {
+	            lhs = (yyvsp[-2].node);
+	        }
+	        (yyval.node) = ast_make_assignment("=", wrap_destructuring_target(lhs), (yyvsp[0].node));
+	    }
+#line 6107 "build/generated/parser_fast.c"
+    break;
+
+  case 147: /* assignment_expr: postfix_expr PLUS_ASSIGN assignment_expr  */
+#line 1288 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("+=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6113 "build/generated/parser_fast.c"
+    break;
+
+  case 148: /* assignment_expr: postfix_expr MINUS_ASSIGN assignment_expr  */
+#line 1290 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("-=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6119 "build/generated/parser_fast.c"
+    break;
+
+  case 149: /* assignment_expr: postfix_expr STAR_ASSIGN assignment_expr  */
+#line 1292 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("*=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6125 "build/generated/parser_fast.c"
+    break;
+
+  case 150: /* assignment_expr: postfix_expr SLASH_ASSIGN assignment_expr  */
+#line 1294 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("/=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6131 "build/generated/parser_fast.c"
+    break;
+
+  case 151: /* assignment_expr: postfix_expr PERCENT_ASSIGN assignment_expr  */
+#line 1296 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("%=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6137 "build/generated/parser_fast.c"
+    break;
+
+  case 152: /* assignment_expr: postfix_expr AND_ASSIGN assignment_expr  */
+#line 1298 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("&=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6143 "build/generated/parser_fast.c"
+    break;
+
+  case 153: /* assignment_expr: postfix_expr OR_ASSIGN assignment_expr  */
+#line 1300 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("|=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6149 "build/generated/parser_fast.c"
+    break;
+
+  case 154: /* assignment_expr: postfix_expr XOR_ASSIGN assignment_expr  */
+#line 1302 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("^=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6155 "build/generated/parser_fast.c"
+    break;
+
+  case 155: /* assignment_expr: postfix_expr LSHIFT_ASSIGN assignment_expr  */
+#line 1304 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("<<=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6161 "build/generated/parser_fast.c"
+    break;
+
+  case 156: /* assignment_expr: postfix_expr RSHIFT_ASSIGN assignment_expr  */
+#line 1306 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment(">>=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6167 "build/generated/parser_fast.c"
+    break;
+
+  case 157: /* assignment_expr: postfix_expr URSHIFT_ASSIGN assignment_expr  */
+#line 1308 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment(">>>=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6173 "build/generated/parser_fast.c"
+    break;
+
+  case 158: /* assignment_expr: arrow_function  */
+#line 1310 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6179 "build/generated/parser_fast.c"
+    break;
+
+  case 159: /* assignment_expr: conditional_expr  */
+#line 1312 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6185 "build/generated/parser_fast.c"
+    break;
+
+  case 160: /* assignment_expr: yield_expr  */
+#line 1314 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 6191 "build/generated/parser_fast.c"
+    break;
+
+  case 161: /* assignment_expr_no_in: postfix_expr '=' assignment_expr_no_in  */
+#line 1319 "build/generated/parser_fast.y"
+            {
+	        ASTNode *lhs = convert_assignment_target((yyvsp[-2].node), true);
+	        if (!lhs) {
+	            lhs = (yyvsp[-2].node);
+	        }
+	        (yyval.node) = ast_make_assignment("=", wrap_destructuring_target(lhs), (yyvsp[0].node));
+	    }
+#line 6203 "build/generated/parser_fast.c"
+    break;
+
+  case 162: /* assignment_expr_no_in: postfix_expr PLUS_ASSIGN assignment_expr_no_in  */
+#line 1327 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("+=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6209 "build/generated/parser_fast.c"
+    break;
+
+  case 163: /* assignment_expr_no_in: postfix_expr MINUS_ASSIGN assignment_expr_no_in  */
+#line 1329 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("-=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6215 "build/generated/parser_fast.c"
+    break;
+
+  case 164: /* assignment_expr_no_in: postfix_expr STAR_ASSIGN assignment_expr_no_in  */
+#line 1331 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("*=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6221 "build/generated/parser_fast.c"
+    break;
+
+  case 165: /* assignment_expr_no_in: postfix_expr SLASH_ASSIGN assignment_expr_no_in  */
+#line 1333 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("/=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6227 "build/generated/parser_fast.c"
+    break;
+
+  case 166: /* assignment_expr_no_in: postfix_expr PERCENT_ASSIGN assignment_expr_no_in  */
+#line 1335 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("%=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6233 "build/generated/parser_fast.c"
+    break;
+
+  case 167: /* assignment_expr_no_in: postfix_expr AND_ASSIGN assignment_expr_no_in  */
+#line 1337 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("&=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6239 "build/generated/parser_fast.c"
+    break;
+
+  case 168: /* assignment_expr_no_in: postfix_expr OR_ASSIGN assignment_expr_no_in  */
+#line 1339 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("|=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6245 "build/generated/parser_fast.c"
+    break;
+
+  case 169: /* assignment_expr_no_in: postfix_expr XOR_ASSIGN assignment_expr_no_in  */
+#line 1341 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("^=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6251 "build/generated/parser_fast.c"
+    break;
+
+  case 170: /* assignment_expr_no_in: postfix_expr LSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1343 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("<<=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6257 "build/generated/parser_fast.c"
+    break;
+
+  case 171: /* assignment_expr_no_in: postfix_expr RSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1345 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment(">>=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6263 "build/generated/parser_fast.c"
+    break;
+
+  case 172: /* assignment_expr_no_in: postfix_expr URSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1347 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment(">>>=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6269 "build/generated/parser_fast.c"
+    break;
+
+  case 173: /* assignment_expr_no_in: arrow_function  */
+#line 1349 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6275 "build/generated/parser_fast.c"
+    break;
+
+  case 174: /* assignment_expr_no_in: conditional_expr_no_in  */
+#line 1351 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6281 "build/generated/parser_fast.c"
+    break;
+
+  case 175: /* assignment_expr_no_in: yield_expr  */
+#line 1353 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 6287 "build/generated/parser_fast.c"
+    break;
+
+  case 176: /* assignment_expr_no_obj: postfix_expr_no_obj '=' assignment_expr  */
+#line 1358 "build/generated/parser_fast.y"
+            {
+	        ASTNode *lhs = convert_assignment_target((yyvsp[-2].node), true);
+	        if (!lhs) {
+	            lhs = (yyvsp[-2].node);
+	        }
+	        (yyval.node) = ast_make_assignment("=", wrap_destructuring_target(lhs), (yyvsp[0].node));
+	    }
+#line 6299 "build/generated/parser_fast.c"
+    break;
+
+  case 177: /* assignment_expr_no_obj: postfix_expr_no_obj PLUS_ASSIGN assignment_expr  */
+#line 1366 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("+=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6305 "build/generated/parser_fast.c"
+    break;
+
+  case 178: /* assignment_expr_no_obj: postfix_expr_no_obj MINUS_ASSIGN assignment_expr  */
+#line 1368 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("-=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6311 "build/generated/parser_fast.c"
+    break;
+
+  case 179: /* assignment_expr_no_obj: postfix_expr_no_obj STAR_ASSIGN assignment_expr  */
+#line 1370 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("*=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6317 "build/generated/parser_fast.c"
+    break;
+
+  case 180: /* assignment_expr_no_obj: postfix_expr_no_obj SLASH_ASSIGN assignment_expr  */
+#line 1372 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("/=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6323 "build/generated/parser_fast.c"
+    break;
+
+  case 181: /* assignment_expr_no_obj: postfix_expr_no_obj PERCENT_ASSIGN assignment_expr  */
+#line 1374 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("%=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6329 "build/generated/parser_fast.c"
+    break;
+
+  case 182: /* assignment_expr_no_obj: postfix_expr_no_obj AND_ASSIGN assignment_expr  */
+#line 1376 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("&=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6335 "build/generated/parser_fast.c"
+    break;
+
+  case 183: /* assignment_expr_no_obj: postfix_expr_no_obj OR_ASSIGN assignment_expr  */
+#line 1378 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("|=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6341 "build/generated/parser_fast.c"
+    break;
+
+  case 184: /* assignment_expr_no_obj: postfix_expr_no_obj XOR_ASSIGN assignment_expr  */
+#line 1380 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("^=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6347 "build/generated/parser_fast.c"
+    break;
+
+  case 185: /* assignment_expr_no_obj: postfix_expr_no_obj LSHIFT_ASSIGN assignment_expr  */
+#line 1382 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("<<=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6353 "build/generated/parser_fast.c"
+    break;
+
+  case 186: /* assignment_expr_no_obj: postfix_expr_no_obj RSHIFT_ASSIGN assignment_expr  */
+#line 1384 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment(">>=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6359 "build/generated/parser_fast.c"
+    break;
+
+  case 187: /* assignment_expr_no_obj: postfix_expr_no_obj URSHIFT_ASSIGN assignment_expr  */
+#line 1386 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment(">>>=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6365 "build/generated/parser_fast.c"
+    break;
+
+  case 188: /* assignment_expr_no_obj: arrow_function  */
+#line 1388 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6371 "build/generated/parser_fast.c"
+    break;
+
+  case 189: /* assignment_expr_no_obj: conditional_expr_no_obj  */
+#line 1390 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6377 "build/generated/parser_fast.c"
+    break;
+
+  case 190: /* assignment_expr_no_obj: yield_expr  */
+#line 1392 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 6383 "build/generated/parser_fast.c"
+    break;
+
+  case 191: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj '=' assignment_expr_no_in  */
+#line 1397 "build/generated/parser_fast.y"
+            {
+	        ASTNode *lhs = convert_assignment_target((yyvsp[-2].node), true);
+	        if (!lhs) {
+	            lhs = (yyvsp[-2].node);
+	        }
+	        (yyval.node) = ast_make_assignment("=", wrap_destructuring_target(lhs), (yyvsp[0].node));
+	    }
+#line 6395 "build/generated/parser_fast.c"
+    break;
+
+  case 192: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj PLUS_ASSIGN assignment_expr_no_in  */
+#line 1405 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("+=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6401 "build/generated/parser_fast.c"
+    break;
+
+  case 193: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj MINUS_ASSIGN assignment_expr_no_in  */
+#line 1407 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("-=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6407 "build/generated/parser_fast.c"
+    break;
+
+  case 194: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj STAR_ASSIGN assignment_expr_no_in  */
+#line 1409 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("*=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6413 "build/generated/parser_fast.c"
+    break;
+
+  case 195: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj SLASH_ASSIGN assignment_expr_no_in  */
+#line 1411 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("/=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6419 "build/generated/parser_fast.c"
+    break;
+
+  case 196: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj PERCENT_ASSIGN assignment_expr_no_in  */
+#line 1413 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("%=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6425 "build/generated/parser_fast.c"
+    break;
+
+  case 197: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj AND_ASSIGN assignment_expr_no_in  */
+#line 1415 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("&=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6431 "build/generated/parser_fast.c"
+    break;
+
+  case 198: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj OR_ASSIGN assignment_expr_no_in  */
+#line 1417 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("|=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6437 "build/generated/parser_fast.c"
+    break;
+
+  case 199: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj XOR_ASSIGN assignment_expr_no_in  */
+#line 1419 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("^=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6443 "build/generated/parser_fast.c"
+    break;
+
+  case 200: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj LSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1421 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment("<<=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6449 "build/generated/parser_fast.c"
+    break;
+
+  case 201: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj RSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1423 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment(">>=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6455 "build/generated/parser_fast.c"
+    break;
+
+  case 202: /* assignment_expr_no_in_no_obj: postfix_expr_no_obj URSHIFT_ASSIGN assignment_expr_no_in  */
+#line 1425 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_assignment(">>>=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6461 "build/generated/parser_fast.c"
+    break;
+
+  case 203: /* assignment_expr_no_in_no_obj: arrow_function  */
+#line 1427 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6467 "build/generated/parser_fast.c"
+    break;
+
+  case 204: /* assignment_expr_no_in_no_obj: conditional_expr_no_in_no_obj  */
+#line 1429 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 6473 "build/generated/parser_fast.c"
+    break;
+
+  case 205: /* assignment_expr_no_in_no_obj: yield_expr  */
+#line 1431 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 6479 "build/generated/parser_fast.c"
+    break;
+
+  case 206: /* conditional_expr: binary_expr  */
+#line 1436 "build/generated/parser_fast.y"
+        { (yyval.node) = (yyvsp[0].node); }
+#line 6485 "build/generated/parser_fast.c"
+    break;
+
+  case 207: /* conditional_expr: binary_expr '?' assignment_expr ':' assignment_expr  */
+#line 1438 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_conditional((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6491 "build/generated/parser_fast.c"
+    break;
+
+  case 208: /* conditional_expr_no_in: binary_expr_no_in  */
+#line 1443 "build/generated/parser_fast.y"
+        { (yyval.node) = (yyvsp[0].node); }
+#line 6497 "build/generated/parser_fast.c"
+    break;
+
+  case 209: /* conditional_expr_no_in: binary_expr_no_in '?' assignment_expr ':' assignment_expr  */
+#line 1445 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_conditional((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6503 "build/generated/parser_fast.c"
+    break;
+
+  case 210: /* conditional_expr_no_obj: binary_expr_no_obj  */
+#line 1450 "build/generated/parser_fast.y"
+        { (yyval.node) = (yyvsp[0].node); }
+#line 6509 "build/generated/parser_fast.c"
+    break;
+
+  case 211: /* conditional_expr_no_obj: binary_expr_no_obj '?' assignment_expr ':' assignment_expr  */
+#line 1452 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_conditional((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6515 "build/generated/parser_fast.c"
+    break;
+
+  case 212: /* conditional_expr_no_in_no_obj: binary_expr_no_in_no_obj  */
+#line 1457 "build/generated/parser_fast.y"
+        { (yyval.node) = (yyvsp[0].node); }
+#line 6521 "build/generated/parser_fast.c"
+    break;
+
+  case 213: /* conditional_expr_no_in_no_obj: binary_expr_no_in_no_obj '?' assignment_expr ':' assignment_expr  */
+#line 1459 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_conditional((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 6527 "build/generated/parser_fast.c"
+    break;
+
+  case 214: /* binary_expr: unary_expr  */
+#line 1467 "build/generated/parser_fast.y"
+        { (yyval.node) = (yyvsp[0].node); }
+#line 6533 "build/generated/parser_fast.c"
+    break;
+
+  case 215: /* binary_expr: binary_chain  */
+#line 1469 "build/generated/parser_fast.y"
+        { (yyval.node) = fold_binary_chain((yyvsp[0].chain)); }
+#line 6539 "build/generated/parser_fast.c"
+    break;
+
+  case 216: /* binary_expr_no_in: unary_expr  */
+#line 1474 "build/generated/parser_fast.y"
+        { (yyval.node) = (yyvsp[0].node); }
+#line 6545 "build/generated/parser_fast.c"
+    break;
+
+  case 217: /* binary_expr_no_in: binary_chain_no_in  */
+#line 1476 "build/generated/parser_fast.y"
+        { (yyval.node) = fold_binary_chain((yyvsp[0].chain)); }
+#line 6551 "build/generated/parser_fast.c"
+    break;
+
+  case 218: /* binary_expr_no_obj: unary_expr_no_obj  */
+#line 1481 "build/generated/parser_fast.y"
+        { (yyval.node) = (yyvsp[0].node); }
+#line 6557 "build/generated/parser_fast.c"
+    break;
+
+  case 219: /* binary_expr_no_obj: binary_chain_no_obj  */
+#line 1483 "build/generated/parser_fast.y"
+        { (yyval.node) = fold_binary_chain((yyvsp[0].chain)); }
+#line 6563 "build/generated/parser_fast.c"
+    break;
+
+  case 220: /* binary_expr_no_in_no_obj: unary_expr_no_obj  */
+#line 1488 "build/generated/parser_fast.y"
+        { (yyval.node) = (yyvsp[0].node); }
+#line 6569 "build/generated/parser_fast.c"
+    break;
+
+  case 221: /* binary_expr_no_in_no_obj: binary_chain_no_in_no_obj  */
+#line 1490 "build/generated/parser_fast.y"
+        { (yyval.node) = fold_binary_chain((yyvsp[0].chain)); }
+#line 6575 "build/generated/parser_fast.c"
+    break;
+
+  case 222: /* binary_chain: unary_expr binary_operator unary_expr  */
+#line 1495 "build/generated/parser_fast.y"
+        { (yyval.chain) = binary_chain_append(binary_chain_append(NULL, NULL, (yyvsp[-2].node)), (yyvsp[-1].binop), (yyvsp[0].node)); }
+#line 6581 "build/generated/parser_fast.c"
+    break;
+
+  case 223: /* binary_chain: binary_chain binary_operator unary_expr  */
+#line 1497 "build/generated/parser_fast.y"
+        { (yyval.chain) = binary_chain_append((yyvsp[-2].chain), (yyvsp[-1].binop), (yyvsp[0].node)); }
+#line 6587 "build/generated/parser_fast.c"
+    break;
+
+  case 224: /* binary_chain_no_in: unary_expr binary_operator_no_in unary_expr  */
+#line 1502 "build/generated/parser_fast.y"
+        { (yyval.chain) = binary_chain_append(binary_chain_append(NULL, NULL, (yyvsp[-2].node)), (yyvsp[-1].binop), (yyvsp[0].node)); }
+#line 6593 "build/generated/parser_fast.c"
+    break;
+
+  case 225: /* binary_chain_no_in: binary_chain_no_in binary_operator_no_in unary_expr  */
+#line 1504 "build/generated/parser_fast.y"
+        { (yyval.chain) = binary_chain_append((yyvsp[-2].chain), (yyvsp[-1].binop), (yyvsp[0].node)); }
+#line 6599 "build/generated/parser_fast.c"
+    break;
+
+  case 226: /* binary_chain_no_obj: unary_expr_no_obj binary_operator unary_expr  */
+#line 1509 "build/generated/parser_fast.y"
+        { (yyval.chain) = binary_chain_append(binary_chain_append(NULL, NULL, (yyvsp[-2].node)), (yyvsp[-1].binop), (yyvsp[0].node)); }
+#line 6605 "build/generated/parser_fast.c"
+    break;
+
+  case 227: /* binary_chain_no_obj: binary_chain_no_obj binary_operator unary_expr  */
+#line 1511 "build/generated/parser_fast.y"
+        { (yyval.chain) = binary_chain_append((yyvsp[-2].chain), (yyvsp[-1].binop), (yyvsp[0].node)); }
+#line 6611 "build/generated/parser_fast.c"
+    break;
+
+  case 228: /* binary_chain_no_in_no_obj: unary_expr_no_obj binary_operator_no_in unary_expr  */
+#line 1516 "build/generated/parser_fast.y"
+        { (yyval.chain) = binary_chain_append(binary_chain_append(NULL, NULL, (yyvsp[-2].node)), (yyvsp[-1].binop), (yyvsp[0].node)); }
+#line 6617 "build/generated/parser_fast.c"
+    break;
+
+  case 229: /* binary_chain_no_in_no_obj: binary_chain_no_in_no_obj binary_operator_no_in unary_expr  */
+#line 1518 "build/generated/parser_fast.y"
+        { (yyval.chain) = binary_chain_append((yyvsp[-2].chain), (yyvsp[-1].binop), (yyvsp[0].node)); }
+#line 6623 "build/generated/parser_fast.c"
+    break;
+
+  case 230: /* binary_operator: OR  */
+#line 1523 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_OR]; }
+#line 6629 "build/generated/parser_fast.c"
+    break;
+
+  case 231: /* binary_operator: AND  */
+#line 1525 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_AND]; }
+#line 6635 "build/generated/parser_fast.c"
+    break;
+
+  case 232: /* binary_operator: '|'  */
+#line 1527 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_BIT_OR]; }
+#line 6641 "build/generated/parser_fast.c"
+    break;
+
+  case 233: /* binary_operator: '^'  */
+#line 1529 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_BIT_XOR]; }
+#line 6647 "build/generated/parser_fast.c"
+    break;
+
+  case 234: /* binary_operator: '&'  */
+#line 1531 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_BIT_AND]; }
+#line 6653 "build/generated/parser_fast.c"
+    break;
+
+  case 235: /* binary_operator: EQ  */
+#line 1533 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_EQ]; }
+#line 6659 "build/generated/parser_fast.c"
+    break;
+
+  case 236: /* binary_operator: NE  */
+#line 1535 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_NE]; }
+#line 6665 "build/generated/parser_fast.c"
+    break;
+
+  case 237: /* binary_operator: EQ_STRICT  */
+#line 1537 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_EQ_STRICT]; }
+#line 6671 "build/generated/parser_fast.c"
+    break;
+
+  case 238: /* binary_operator: NE_STRICT  */
+#line 1539 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_NE_STRICT]; }
+#line 6677 "build/generated/parser_fast.c"
+    break;
+
+  case 239: /* binary_operator: '<'  */
+#line 1541 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_LT]; }
+#line 6683 "build/generated/parser_fast.c"
+    break;
+
+  case 240: /* binary_operator: '>'  */
+#line 1543 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_GT]; }
+#line 6689 "build/generated/parser_fast.c"
+    break;
+
+  case 241: /* binary_operator: LE  */
+#line 1545 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_LE]; }
+#line 6695 "build/generated/parser_fast.c"
+    break;
+
+  case 242: /* binary_operator: GE  */
+#line 1547 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_GE]; }
+#line 6701 "build/generated/parser_fast.c"
+    break;
+
+  case 243: /* binary_operator: INSTANCEOF  */
+#line 1549 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_INSTANCEOF]; }
+#line 6707 "build/generated/parser_fast.c"
+    break;
+
+  case 244: /* binary_operator: LSHIFT  */
+#line 1551 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_LSHIFT]; }
+#line 6713 "build/generated/parser_fast.c"
+    break;
+
+  case 245: /* binary_operator: RSHIFT  */
+#line 1553 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_RSHIFT]; }
+#line 6719 "build/generated/parser_fast.c"
+    break;
+
+  case 246: /* binary_operator: URSHIFT  */
+#line 1555 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_URSHIFT]; }
+#line 6725 "build/generated/parser_fast.c"
+    break;
+
+  case 247: /* binary_operator: '+'  */
+#line 1557 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_ADD]; }
+#line 6731 "build/generated/parser_fast.c"
+    break;
+
+  case 248: /* binary_operator: '-'  */
+#line 1559 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_SUB]; }
+#line 6737 "build/generated/parser_fast.c"
+    break;
+
+  case 249: /* binary_operator: '*'  */
+#line 1561 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_MUL]; }
+#line 6743 "build/generated/parser_fast.c"
+    break;
+
+  case 250: /* binary_operator: '*' '*'  */
+#line 1563 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_EXP]; }
+#line 6749 "build/generated/parser_fast.c"
+    break;
+
+  case 251: /* binary_operator: '/'  */
+#line 1565 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_DIV]; }
+#line 6755 "build/generated/parser_fast.c"
+    break;
+
+  case 252: /* binary_operator: '%'  */
+#line 1567 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_MOD]; }
+#line 6761 "build/generated/parser_fast.c"
+    break;
+
+  case 253: /* binary_operator: IN  */
+#line 1569 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_IN]; }
+#line 6767 "build/generated/parser_fast.c"
+    break;
+
+  case 254: /* binary_operator_no_in: OR  */
+#line 1574 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_OR]; }
+#line 6773 "build/generated/parser_fast.c"
+    break;
+
+  case 255: /* binary_operator_no_in: AND  */
+#line 1576 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_AND]; }
+#line 6779 "build/generated/parser_fast.c"
+    break;
+
+  case 256: /* binary_operator_no_in: '|'  */
+#line 1578 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_BIT_OR]; }
+#line 6785 "build/generated/parser_fast.c"
+    break;
+
+  case 257: /* binary_operator_no_in: '^'  */
+#line 1580 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_BIT_XOR]; }
+#line 6791 "build/generated/parser_fast.c"
+    break;
+
+  case 258: /* binary_operator_no_in: '&'  */
+#line 1582 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_BIT_AND]; }
+#line 6797 "build/generated/parser_fast.c"
+    break;
+
+  case 259: /* binary_operator_no_in: EQ  */
+#line 1584 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_EQ]; }
+#line 6803 "build/generated/parser_fast.c"
+    break;
+
+  case 260: /* binary_operator_no_in: NE  */
+#line 1586 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_NE]; }
+#line 6809 "build/generated/parser_fast.c"
+    break;
+
+  case 261: /* binary_operator_no_in: EQ_STRICT  */
+#line 1588 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_EQ_STRICT]; }
+#line 6815 "build/generated/parser_fast.c"
+    break;
+
+  case 262: /* binary_operator_no_in: NE_STRICT  */
+#line 1590 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_NE_STRICT]; }
+#line 6821 "build/generated/parser_fast.c"
+    break;
+
+  case 263: /* binary_operator_no_in: '<'  */
+#line 1592 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_LT]; }
+#line 6827 "build/generated/parser_fast.c"
+    break;
+
+  case 264: /* binary_operator_no_in: '>'  */
+#line 1594 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_GT]; }
+#line 6833 "build/generated/parser_fast.c"
+    break;
+
+  case 265: /* binary_operator_no_in: LE  */
+#line 1596 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_LE]; }
+#line 6839 "build/generated/parser_fast.c"
+    break;
+
+  case 266: /* binary_operator_no_in: GE  */
+#line 1598 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_GE]; }
+#line 6845 "build/generated/parser_fast.c"
+    break;
+
+  case 267: /* binary_operator_no_in: INSTANCEOF  */
+#line 1600 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_INSTANCEOF]; }
+#line 6851 "build/generated/parser_fast.c"
+    break;
+
+  case 268: /* binary_operator_no_in: LSHIFT  */
+#line 1602 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_LSHIFT]; }
+#line 6857 "build/generated/parser_fast.c"
+    break;
+
+  case 269: /* binary_operator_no_in: RSHIFT  */
+#line 1604 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_RSHIFT]; }
+#line 6863 "build/generated/parser_fast.c"
+    break;
+
+  case 270: /* binary_operator_no_in: URSHIFT  */
+#line 1606 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_URSHIFT]; }
+#line 6869 "build/generated/parser_fast.c"
+    break;
+
+  case 271: /* binary_operator_no_in: '+'  */
+#line 1608 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_ADD]; }
+#line 6875 "build/generated/parser_fast.c"
+    break;
+
+  case 272: /* binary_operator_no_in: '-'  */
+#line 1610 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_SUB]; }
+#line 6881 "build/generated/parser_fast.c"
+    break;
+
+  case 273: /* binary_operator_no_in: '*'  */
+#line 1612 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_MUL]; }
+#line 6887 "build/generated/parser_fast.c"
+    break;
+
+  case 274: /* binary_operator_no_in: '*' '*'  */
+#line 1614 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_EXP]; }
+#line 6893 "build/generated/parser_fast.c"
+    break;
+
+  case 275: /* binary_operator_no_in: '/'  */
+#line 1616 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_DIV]; }
+#line 6899 "build/generated/parser_fast.c"
+    break;
+
+  case 276: /* binary_operator_no_in: '%'  */
+#line 1618 "build/generated/parser_fast.y"
+        { (yyval.binop) = &binary_operators[BINOP_MOD]; }
+#line 6905 "build/generated/parser_fast.c"
+    break;
+
+  case 277: /* unary_expr: postfix_expr  */
+#line 1624 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 6911 "build/generated/parser_fast.c"
+    break;
+
+  case 278: /* unary_expr: '+' unary_expr  */
+#line 1626 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("+", (yyvsp[0].node)); }
+#line 6917 "build/generated/parser_fast.c"
+    break;
+
+  case 279: /* unary_expr: '-' unary_expr  */
+#line 1628 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("-", (yyvsp[0].node)); }
+#line 6923 "build/generated/parser_fast.c"
+    break;
+
+  case 280: /* unary_expr: '!' unary_expr  */
+#line 1630 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("!", (yyvsp[0].node)); }
+#line 6929 "build/generated/parser_fast.c"
+    break;
+
+  case 281: /* unary_expr: '~' unary_expr  */
+#line 1632 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("~", (yyvsp[0].node)); }
+#line 6935 "build/generated/parser_fast.c"
+    break;
+
+  case 282: /* unary_expr: TYPEOF unary_expr  */
+#line 1634 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("typeof", (yyvsp[0].node)); }
+#line 6941 "build/generated/parser_fast.c"
+    break;
+
+  case 283: /* unary_expr: DELETE unary_expr  */
+#line 1636 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("delete", (yyvsp[0].node)); }
+#line 6947 "build/generated/parser_fast.c"
+    break;
+
+  case 284: /* unary_expr: VOID unary_expr  */
+#line 1638 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("void", (yyvsp[0].node)); }
+#line 6953 "build/generated/parser_fast.c"
+    break;
+
+  case 285: /* unary_expr: AWAIT unary_expr  */
+#line 1640 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_await((yyvsp[0].node)); }
+#line 6959 "build/generated/parser_fast.c"
+    break;
+
+  case 286: /* unary_expr: PLUS_PLUS unary_expr  */
+#line 1642 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_update("++", (yyvsp[0].node), true); }
+#line 6965 "build/generated/parser_fast.c"
+    break;
+
+  case 287: /* unary_expr: MINUS_MINUS unary_expr  */
+#line 1644 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_update("--", (yyvsp[0].node), true); }
+#line 6971 "build/generated/parser_fast.c"
+    break;
+
+  case 288: /* unary_expr_no_obj: postfix_expr_no_obj  */
+#line 1649 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 6977 "build/generated/parser_fast.c"
+    break;
+
+  case 289: /* unary_expr_no_obj: '+' unary_expr  */
+#line 1651 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("+", (yyvsp[0].node)); }
+#line 6983 "build/generated/parser_fast.c"
+    break;
+
+  case 290: /* unary_expr_no_obj: '-' unary_expr  */
+#line 1653 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("-", (yyvsp[0].node)); }
+#line 6989 "build/generated/parser_fast.c"
+    break;
+
+  case 291: /* unary_expr_no_obj: '!' unary_expr  */
+#line 1655 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("!", (yyvsp[0].node)); }
+#line 6995 "build/generated/parser_fast.c"
+    break;
+
+  case 292: /* unary_expr_no_obj: '~' unary_expr  */
+#line 1657 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("~", (yyvsp[0].node)); }
+#line 7001 "build/generated/parser_fast.c"
+    break;
+
+  case 293: /* unary_expr_no_obj: TYPEOF unary_expr  */
+#line 1659 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("typeof", (yyvsp[0].node)); }
+#line 7007 "build/generated/parser_fast.c"
+    break;
+
+  case 294: /* unary_expr_no_obj: DELETE unary_expr  */
+#line 1661 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("delete", (yyvsp[0].node)); }
+#line 7013 "build/generated/parser_fast.c"
+    break;
+
+  case 295: /* unary_expr_no_obj: VOID unary_expr  */
+#line 1663 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_unary("void", (yyvsp[0].node)); }
+#line 7019 "build/generated/parser_fast.c"
+    break;
+
+  case 296: /* unary_expr_no_obj: AWAIT unary_expr  */
+#line 1665 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_await((yyvsp[0].node)); }
+#line 7025 "build/generated/parser_fast.c"
+    break;
+
+  case 297: /* unary_expr_no_obj: PLUS_PLUS unary_expr  */
+#line 1667 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_update("++", (yyvsp[0].node), true); }
+#line 7031 "build/generated/parser_fast.c"
+    break;
+
+  case 298: /* unary_expr_no_obj: MINUS_MINUS unary_expr  */
+#line 1669 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_update("--", (yyvsp[0].node), true); }
+#line 7037 "build/generated/parser_fast.c"
+    break;
+
+  case 299: /* postfix_expr: left_hand_side_expr  */
+#line 1674 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7043 "build/generated/parser_fast.c"
+    break;
+
+  case 300: /* postfix_expr: postfix_expr PLUS_PLUS  */
+#line 1676 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_update("++", (yyvsp[-1].node), false); }
+#line 7049 "build/generated/parser_fast.c"
+    break;
+
+  case 301: /* postfix_expr: postfix_expr MINUS_MINUS  */
+#line 1678 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_update("--", (yyvsp[-1].node), false); }
+#line 7055 "build/generated/parser_fast.c"
+    break;
+
+  case 302: /* postfix_expr_no_obj: left_hand_side_expr_no_obj  */
+#line 1683 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7061 "build/generated/parser_fast.c"
+    break;
+
+  case 303: /* postfix_expr_no_obj: postfix_expr_no_obj PLUS_PLUS  */
+#line 1685 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_update("++", (yyvsp[-1].node), false); }
+#line 7067 "build/generated/parser_fast.c"
+    break;
+
+  case 304: /* postfix_expr_no_obj: postfix_expr_no_obj MINUS_MINUS  */
+#line 1687 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_update("--", (yyvsp[-1].node), false); }
+#line 7073 "build/generated/parser_fast.c"
+    break;
+
+  case 305: /* left_hand_side_expr: call_expr  */
+#line 1692 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7079 "build/generated/parser_fast.c"
+    break;
+
+  case 306: /* left_hand_side_expr: new_expr  */
+#line 1694 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7085 "build/generated/parser_fast.c"
+    break;
+
+  case 307: /* left_hand_side_expr_no_obj: call_expr_no_obj  */
+#line 1699 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7091 "build/generated/parser_fast.c"
+    break;
+
+  case 308: /* left_hand_side_expr_no_obj: new_expr_no_obj  */
+#line 1701 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7097 "build/generated/parser_fast.c"
+    break;
+
+  case 309: /* member_expr: primary_expr member_suffix_seq  */
+#line 1706 "build/generated/parser_fast.y"
+      { (yyval.node) = apply_suffix_chain((yyvsp[-1].node), (yyvsp[0].suffix)); }
+#line 7103 "build/generated/parser_fast.c"
+    break;
+
+  case 310: /* member_expr: NEW member_expr '(' opt_arg_list ')' member_suffix_seq  */
+#line 1708 "build/generated/parser_fast.y"
+      { (yyval.node) = apply_suffix_chain(ast_make_new_expr((yyvsp[-4].node), (yyvsp[-2].list)), (yyvsp[0].suffix)); }
+#line 7109 "build/generated/parser_fast.c"
+    break;
+
+  case 311: /* member_expr_no_obj: primary_expr_no_obj member_suffix_seq  */
+#line 1713 "build/generated/parser_fast.y"
+      { (yyval.node) = apply_suffix_chain((yyvsp[-1].node), (yyvsp[0].suffix)); }
+#line 7115 "build/generated/parser_fast.c"
+    break;
+
+  case 312: /* member_expr_no_obj: NEW member_expr '(' opt_arg_list ')' member_suffix_seq  */
+#line 1715 "build/generated/parser_fast.y"
+      { (yyval.node) = apply_suffix_chain(ast_make_new_expr((yyvsp[-4].node), (yyvsp[-2].list)), (yyvsp[0].suffix)); }
+#line 7121 "build/generated/parser_fast.c"
+    break;
+
+  case 313: /* new_expr: member_expr  */
+#line 1720 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7127 "build/generated/parser_fast.c"
+    break;
+
+  case 314: /* new_expr: NEW new_expr  */
+#line 1722 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_new_expr((yyvsp[0].node), NULL); }
+#line 7133 "build/generated/parser_fast.c"
+    break;
+
+  case 315: /* new_expr_no_obj: member_expr_no_obj  */
+#line 1727 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7139 "build/generated/parser_fast.c"
+    break;
+
+  case 316: /* new_expr_no_obj: NEW new_expr  */
+#line 1729 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_new_expr((yyvsp[0].node), NULL); }
+#line 7145 "build/generated/parser_fast.c"
+    break;
+
+  case 317: /* call_expr: member_expr call_suffix_seq  */
+#line 1734 "build/generated/parser_fast.y"
+      { (yyval.node) = apply_suffix_chain((yyvsp[-1].node), (yyvsp[0].suffix)); }
+#line 7151 "build/generated/parser_fast.c"
+    break;
+
+  case 318: /* call_expr_no_obj: member_expr_no_obj call_suffix_seq  */
+#line 1739 "build/generated/parser_fast.y"
+      { (yyval.node) = apply_suffix_chain((yyvsp[-1].node), (yyvsp[0].suffix)); }
+#line 7157 "build/generated/parser_fast.c"
+    break;
+
+  case 319: /* member_suffix_seq: %empty  */
+#line 1744 "build/generated/parser_fast.y"
+            { (yyval.suffix) = NULL; }
+#line 7163 "build/generated/parser_fast.c"
+    break;
+
+  case 320: /* member_suffix_seq: member_suffix_seq member_noncall_suffix  */
+#line 1746 "build/generated/parser_fast.y"
+            { (yyval.suffix) = append_suffix((yyvsp[-1].suffix), (yyvsp[0].suffix)); }
+#line 7169 "build/generated/parser_fast.c"
+    break;
+
+  case 321: /* member_noncall_suffix: '.' property_name  */
+#line 1751 "build/generated/parser_fast.y"
+            { (yyval.suffix) = make_suffix_prop((yyvsp[0].atom)); }
+#line 7175 "build/generated/parser_fast.c"
+    break;
+
+  case 322: /* member_noncall_suffix: '[' expr ']'  */
+#line 1753 "build/generated/parser_fast.y"
+            { (yyval.suffix) = make_suffix_computed((yyvsp[-1].node)); }
+#line 7181 "build/generated/parser_fast.c"
+    break;
+
+  case 323: /* member_noncall_suffix: template_literal  */
+#line 1755 "build/generated/parser_fast.y"
+            { (yyval.suffix) = make_suffix_template((yyvsp[0].node)); }
+#line 7187 "build/generated/parser_fast.c"
+    break;
+
+  case 324: /* call_suffix_seq: call_suffix_seq call_any_suffix  */
+#line 1760 "build/generated/parser_fast.y"
+            { (yyval.suffix) = append_suffix((yyvsp[-1].suffix), (yyvsp[0].suffix)); }
+#line 7193 "build/generated/parser_fast.c"
+    break;
+
+  case 325: /* call_suffix_seq: call_suffix_initial  */
+#line 1762 "build/generated/parser_fast.y"
+            { (yyval.suffix) = (yyvsp[0].suffix); }
+#line 7199 "build/generated/parser_fast.c"
+    break;
+
+  case 326: /* call_any_suffix: call_suffix_initial  */
+#line 1767 "build/generated/parser_fast.y"
+            { (yyval.suffix) = (yyvsp[0].suffix); }
+#line 7205 "build/generated/parser_fast.c"
+    break;
+
+  case 327: /* call_any_suffix: member_noncall_suffix  */
+#line 1769 "build/generated/parser_fast.y"
+            { (yyval.suffix) = (yyvsp[0].suffix); }
+#line 7211 "build/generated/parser_fast.c"
+    break;
+
+  case 328: /* call_suffix_initial: '(' opt_arg_list ')'  */
+#line 1774 "build/generated/parser_fast.y"
+            { (yyval.suffix) = make_suffix_call((yyvsp[-1].list)); }
+#line 7217 "build/generated/parser_fast.c"
+    break;
+
+  case 329: /* opt_arg_list: %empty  */
+#line 1779 "build/generated/parser_fast.y"
+      { (yyval.list) = NULL; }
+#line 7223 "build/generated/parser_fast.c"
+    break;
+
+  case 330: /* opt_arg_list: arg_list  */
+#line 1781 "build/generated/parser_fast.y"
+      { (yyval.list) = (yyvsp[0].list); }
+#line 7229 "build/generated/parser_fast.c"
+    break;
+
+  case 331: /* arg_list: arg_item  */
+#line 1786 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 7235 "build/generated/parser_fast.c"
+    break;
+
+  case 332: /* arg_list: arg_list ',' arg_item  */
+#line 1788 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 7241 "build/generated/parser_fast.c"
+    break;
+
+  case 333: /* arg_item: assignment_expr  */
+#line 1793 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7247 "build/generated/parser_fast.c"
+    break;
+
+  case 334: /* arg_item: spread_element  */
+#line 1795 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7253 "build/generated/parser_fast.c"
+    break;
+
+  case 335: /* primary_expr: IDENTIFIER  */
+#line 1801 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_identifier((yyvsp[0].atom)); }
+#line 7259 "build/generated/parser_fast.c"
+    break;
+
+  case 336: /* primary_expr: THIS  */
+#line 1803 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_this_expr(); }
+#line 7265 "build/generated/parser_fast.c"
+    break;
+
+  case 337: /* primary_expr: NUMBER  */
+#line 1805 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_number_literal((yyvsp[0].atom)); }
+#line 7271 "build/generated/parser_fast.c"
+    break;
+
+  case 338: /* primary_expr: STRING  */
+#line 1807 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_string_literal((yyvsp[0].str)); }
+#line 7277 "build/generated/parser_fast.c"
+    break;
+
+  case 339: /* primary_expr: REGEX  */
+#line 1809 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_regex_literal((yyvsp[0].str)); }
+#line 7283 "build/generated/parser_fast.c"
+    break;
+
+  case 340: /* primary_expr: TRUE  */
+#line 1811 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_boolean_literal(true); }
+#line 7289 "build/generated/parser_fast.c"
+    break;
+
+  case 341: /* primary_expr: FALSE  */
+#line 1813 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_boolean_literal(false); }
+#line 7295 "build/generated/parser_fast.c"
+    break;
+
+  case 342: /* primary_expr: NULL_T  */
+#line 1815 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_null_literal(); }
+#line 7301 "build/generated/parser_fast.c"
+    break;
+
+  case 343: /* primary_expr: UNDEFINED  */
+#line 1817 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_undefined_literal(); }
+#line 7307 "build/generated/parser_fast.c"
+    break;
+
+  case 344: /* primary_expr: '(' expr ')'  */
+#line 1819 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[-1].node); }
+#line 7313 "build/generated/parser_fast.c"
+    break;
+
+  case 345: /* primary_expr: array_literal  */
+#line 1821 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7319 "build/generated/parser_fast.c"
+    break;
+
+  case 346: /* primary_expr: object_literal  */
+#line 1823 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7325 "build/generated/parser_fast.c"
+    break;
+
+  case 347: /* primary_expr: template_literal  */
+#line 1825 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7331 "build/generated/parser_fast.c"
+    break;
+
+  case 348: /* primary_expr: class_expr  */
+#line 1827 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7337 "build/generated/parser_fast.c"
+    break;
+
+  case 349: /* primary_expr: SUPER  */
+#line 1829 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_super_expr(); }
+#line 7343 "build/generated/parser_fast.c"
+    break;
+
+  case 350: /* primary_expr: function_expr  */
+#line 1831 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7349 "build/generated/parser_fast.c"
+    break;
+
+  case 351: /* primary_expr_no_obj: IDENTIFIER  */
+#line 1836 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_identifier((yyvsp[0].atom)); }
+#line 7355 "build/generated/parser_fast.c"
+    break;
+
+  case 352: /* primary_expr_no_obj: THIS  */
+#line 1838 "build/generated/parser_fast.y"
+        { (yyval.node) = ast_make_this_expr(); }
+#line 7361 "build/generated/parser_fast.c"
+    break;
+
+  case 353: /* primary_expr_no_obj: NUMBER  */
+#line 1840 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_number_literal((yyvsp[0].atom)); }
+#line 7367 "build/generated/parser_fast.c"
+    break;
+
+  case 354: /* primary_expr_no_obj: STRING  */
+#line 1842 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_string_literal((yyvsp[0].str)); }
+#line 7373 "build/generated/parser_fast.c"
+    break;
+
+  case 355: /* primary_expr_no_obj: REGEX  */
+#line 1844 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_regex_literal((yyvsp[0].str)); }
+#line 7379 "build/generated/parser_fast.c"
+    break;
+
+  case 356: /* primary_expr_no_obj: TRUE  */
+#line 1846 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_boolean_literal(true); }
+#line 7385 "build/generated/parser_fast.c"
+    break;
+
+  case 357: /* primary_expr_no_obj: FALSE  */
+#line 1848 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_boolean_literal(false); }
+#line 7391 "build/generated/parser_fast.c"
+    break;
+
+  case 358: /* primary_expr_no_obj: NULL_T  */
+#line 1850 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_null_literal(); }
+#line 7397 "build/generated/parser_fast.c"
+    break;
+
+  case 359: /* primary_expr_no_obj: UNDEFINED  */
+#line 1852 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_undefined_literal(); }
+#line 7403 "build/generated/parser_fast.c"
+    break;
+
+  case 360: /* primary_expr_no_obj: '(' expr ')'  */
+#line 1854 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[-1].node); }
+#line 7409 "build/generated/parser_fast.c"
+    break;
+
+  case 361: /* primary_expr_no_obj: array_literal  */
+#line 1856 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7415 "build/generated/parser_fast.c"
+    break;
+
+  case 362: /* primary_expr_no_obj: template_literal  */
+#line 1858 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7421 "build/generated/parser_fast.c"
+    break;
+
+  case 363: /* primary_expr_no_obj: SUPER  */
+#line 1860 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_super_expr(); }
+#line 7427 "build/generated/parser_fast.c"
+    break;
+
+  case 364: /* primary_expr_no_obj: function_expr  */
+#line 1862 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7433 "build/generated/parser_fast.c"
+    break;
+
+  case 365: /* function_expr: async_modifier_opt FUNCTION generator_marker_opt IDENTIFIER '(' opt_param_list ')' block  */
+#line 1867 "build/generated/parser_fast.y"
+      {
+          (yyval.node) = ast_make_function_expr((yyvsp[-4].atom), (yyvsp[-2].list), (yyvsp[0].node));
+          if ((yyvsp[-5].boolean) && (yyval.node)) {
+              (yyval.node)->data.function_expr.is_generator = true;
+          }
+          if ((yyvsp[-7].boolean) && (yyval.node)) {
+              (yyval.node)->data.function_expr.is_async = true;
+          }
+      }
+#line 7447 "build/generated/parser_fast.c"
+    break;
+
+  case 366: /* function_expr: async_modifier_opt FUNCTION generator_marker_opt '(' opt_param_list ')' block  */
+#line 1877 "build/generated/parser_fast.y"
+      {
+          (yyval.node) = ast_make_function_expr(NULL, (yyvsp[-2].list), (yyvsp[0].node));
+          if ((yyvsp[-4].boolean) && (yyval.node)) {
+              (yyval.node)->data.function_expr.is_generator = true;
+          }
+          if ((yyvsp[-6].boolean) && (yyval.node)) {
+              (yyval.node)->data.function_expr.is_async = true;
+          }
+      }
+#line 7461 "build/generated/parser_fast.c"
+    break;
+
+  case 367: /* class_decl: CLASS IDENTIFIER class_heritage_opt class_body  */
+#line 1890 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_class_decl((yyvsp[-2].atom), (yyvsp[-1].node), (yyvsp[0].list)); }
+#line 7467 "build/generated/parser_fast.c"
+    break;
+
+  case 368: /* class_expr: CLASS IDENTIFIER class_heritage_opt class_body  */
+#line 1895 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_class_expr((yyvsp[-2].atom), (yyvsp[-1].node), (yyvsp[0].list)); }
+#line 7473 "build/generated/parser_fast.c"
+    break;
+
+  case 369: /* class_expr: CLASS class_heritage_opt class_body  */
+#line 1897 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_class_expr(NULL, (yyvsp[-1].node), (yyvsp[0].list)); }
+#line 7479 "build/generated/parser_fast.c"
+    break;
+
+  case 370: /* class_heritage_opt: EXTENDS assignment_expr  */
+#line 1902 "build/generated/parser_fast.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 7485 "build/generated/parser_fast.c"
+    break;
+
+  case 371: /* class_heritage_opt: %empty  */
+#line 1904 "build/generated/parser_fast.y"
+            { (yyval.node) = NULL; }
+#line 7491 "build/generated/parser_fast.c"
+    break;
+
+  case 372: /* class_body: '{' class_element_list_opt '}'  */
+#line 1909 "build/generated/parser_fast.y"
+            { (yyval.list) = (yyvsp[-1].list); }
+#line 7497 "build/generated/parser_fast.c"
+    break;
+
+  case 373: /* class_element_list_opt: %empty  */
+#line 1914 "build/generated/parser_fast.y"
+            { (yyval.list) = NULL; }
+#line 7503 "build/generated/parser_fast.c"
+    break;
+
+  case 374: /* class_element_list_opt: class_element_list  */
+#line 1916 "build/generated/parser_fast.y"
+            { (yyval.list) = (yyvsp[0].list); }
+#line 7509 "build/generated/parser_fast.c"
+    break;
+
+  case 375: /* class_element_list: class_element_list class_element  */
+#line 1921 "build/generated/parser_fast.y"
+            { (yyval.list) = (yyvsp[0].node) ? ast_list_append((yyvsp[-1].list), (yyvsp[0].node)) : (yyvsp[-1].list); }
+#line 7515 "build/generated/parser_fast.c"
+    break;
+
+  case 376: /* class_element_list: class_element  */
+#line 1923 "build/generated/parser_fast.y"
+            { (yyval.list) = (yyvsp[0].node) ? ast_list_append(NULL, (yyvsp[0].node)) : NULL; }
+#line 7521 "build/generated/parser_fast.c"
+    break;
+
+  case 377: /* class_element: method_definition  */
+#line 1929 "build/generated/parser_fast.y"
+        { (yyval.node) = build_method_node(maybe_tag_constructor(ctx, (yyvsp[0].method))); }
+#line 7527 "build/generated/parser_fast.c"
+    break;
+
+  case 378: /* class_element: IDENTIFIER method_definition  */
+#line 1931 "build/generated/parser_fast.y"
+        {
+            MethodInfo *method = handle_single_prefix(ctx, (yyvsp[-1].atom), (yyvsp[0].method));
+            if (!method) {
+                YYERROR;
+            }
+            (yyval.node) = build_method_node(method);
+        }
+#line 7539 "build/generated/parser_fast.c"
+    break;
+
+  case 379: /* class_element: IDENTIFIER IDENTIFIER method_definition  */
+#line 1939 "build/generated/parser_fast.y"
+        {
+            MethodInfo *method = handle_double_prefix(ctx, (yyvsp[-2].atom), (yyvsp[-1].atom), (yyvsp[0].method));
+            if (!method) {
+                YYERROR;
+            }
+            (yyval.node) = build_method_node(method);
+        }
+#line 7551 "build/generated/parser_fast.c"
+    break;
+
+  case 380: /* class_element: ';'  */
+#line 1947 "build/generated/parser_fast.y"
+        { (yyval.node) = NULL; }
+#line 7557 "build/generated/parser_fast.c"
+    break;
+
+  case 381: /* method_definition: method_head '(' opt_param_list ')' block  */
+#line 1954 "build/generated/parser_fast.y"
+            { (yyval.method) = method_info_set_function((yyvsp[-4].method), (yyvsp[-2].list), (yyvsp[0].node)); }
+#line 7563 "build/generated/parser_fast.c"
+    break;
+
+  case 382: /* method_head: method_name  */
+#line 1959 "build/generated/parser_fast.y"
+            { (yyval.method) = (yyvsp[0].method); }
+#line 7569 "build/generated/parser_fast.c"
+    break;
+
+  case 383: /* method_head: ASYNC method_name  */
+#line 1961 "build/generated/parser_fast.y"
+            {
+                (yyval.method) = (yyvsp[0].method);
+                (yyval.method)->is_async = true;
+            }
+#line 7578 "build/generated/parser_fast.c"
+    break;
+
+  case 384: /* method_head: '*' method_name  */
+#line 1966 "build/generated/parser_fast.y"
+            {
+                (yyval.method) = (yyvsp[0].method);
+                (yyval.method)->is_generator = true;
+            }
+#line 7587 "build/generated/parser_fast.c"
+    break;
+
+  case 385: /* method_head: ASYNC '*' method_name  */
+#line 1971 "build/generated/parser_fast.y"
+            {
+                (yyval.method) = (yyvsp[0].method);
+                (yyval.method)->is_async = true;
+                (yyval.method)->is_generator = true;
+            }
+#line 7597 "build/generated/parser_fast.c"
+    break;
+
+  case 386: /* getter_definition: IDENTIFIER method_name '(' ')' block  */
+#line 1980 "build/generated/parser_fast.y"
+            {
+                if (!identifier_is((yyvsp[-4].atom), ATOM(ctx->atoms, GET))) {
+                    yyerror(ctx, "Unexpected identifier before getter definition");
+                    method_info_free((yyvsp[-3].method));
+                    YYERROR;
+                }
+                (yyvsp[-3].method)->kind = AST_METHOD_KIND_GET;
+                (yyval.node) = build_method_node(method_info_set_function((yyvsp[-3].method), NULL, (yyvsp[0].node)));
+            }
+#line 7611 "build/generated/parser_fast.c"
+    break;
+
+  case 387: /* setter_definition: IDENTIFIER method_name '(' binding_element ')' block  */
+#line 1993 "build/generated/parser_fast.y"
+            {
+                if (!identifier_is((yyvsp[-5].atom), ATOM(ctx->atoms, SET))) {
+                    yyerror(ctx, "Unexpected identifier before setter definition");
+                    method_info_free((yyvsp[-4].method));
+                    YYERROR;
+                }
+                (yyvsp[-4].method)->kind = AST_METHOD_KIND_SET;
+                (yyval.node) = build_method_node(method_info_set_function((yyvsp[-4].method), make_single_param_list((yyvsp[-2].node)), (yyvsp[0].node)));
+            }
+#line 7625 "build/generated/parser_fast.c"
+    break;
+
+  case 388: /* method_name: property_name  */
+#line 2006 "build/generated/parser_fast.y"
+            { (yyval.method) = method_info_alloc((yyvsp[0].atom), NULL, false); }
+#line 7631 "build/generated/parser_fast.c"
+    break;
+
+  case 389: /* method_name: '[' assignment_expr ']'  */
+#line 2008 "build/generated/parser_fast.y"
+            { (yyval.method) = method_info_alloc(NULL, (yyvsp[-1].node), true); }
+#line 7637 "build/generated/parser_fast.c"
+    break;
+
+  case 390: /* arrow_function: IDENTIFIER ARROW arrow_body  */
+#line 2014 "build/generated/parser_fast.y"
+      {
+          ASTNode *binding = ast_make_binding_pattern(ast_make_identifier((yyvsp[-2].atom)), NULL);
+          (yyval.node) = (yyvsp[0].node);
+          (yyval.node)->data.arrow_function.params = ast_list_append(NULL, binding);
+      }
+#line 7647 "build/generated/parser_fast.c"
+    break;
+
+  case 391: /* arrow_function: ARROW_HEAD '(' opt_param_list ')' ARROW arrow_body  */
+#line 2020 "build/generated/parser_fast.y"
+      {
+          (yyval.node) = (yyvsp[0].node);
+          (yyval.node)->data.arrow_function.params = (yyvsp[-3].list);
+      }
+#line 7656 "build/generated/parser_fast.c"
+    break;
+
+  case 392: /* arrow_function: ASYNC IDENTIFIER ARROW arrow_body  */
+#line 2025 "build/generated/parser_fast.y"
+      {
+          ASTNode *binding = ast_make_binding_pattern(ast_make_identifier((yyvsp[-2].atom)), NULL);
+          (yyval.node) = (yyvsp[0].node);
+          (yyval.node)->data.arrow_function.params = ast_list_append(NULL, binding);
+          (yyval.node)->data.arrow_function.is_async = true;
+      }
+#line 7667 "build/generated/parser_fast.c"
+    break;
+
+  case 393: /* arrow_function: ASYNC ARROW_HEAD '(' opt_param_list ')' ARROW arrow_body  */
+#line 2032 "build/generated/parser_fast.y"
+      {
+          (yyval.node) = (yyvsp[0].node);
+          (yyval.node)->data.arrow_function.params = (yyvsp[-3].list);
+          (yyval.node)->data.arrow_function.is_async = true;
+      }
+#line 7677 "build/generated/parser_fast.c"
+    break;
+
+  case 394: /* arrow_body: assignment_expr_no_obj  */
+#line 2041 "build/generated/parser_fast.y"
+      {
+          ASTList *stmts = NULL;
+          stmts = ast_list_append(stmts, ast_make_return((yyvsp[0].node)));
+          (yyval.node) = ast_make_arrow_function(NULL, ast_make_block(stmts), true);
+      }
+#line 7687 "build/generated/parser_fast.c"
+    break;
+
+  case 395: /* arrow_body: block  */
+#line 2047 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_arrow_function(NULL, (yyvsp[0].node), false); }
+#line 7693 "build/generated/parser_fast.c"
+    break;
+
+  case 396: /* yield_expr: YIELD  */
+#line 2052 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_yield(NULL, false); }
+#line 7699 "build/generated/parser_fast.c"
+    break;
+
+  case 397: /* yield_expr: YIELD assignment_expr  */
+#line 2054 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_yield((yyvsp[0].node), false); }
+#line 7705 "build/generated/parser_fast.c"
+    break;
+
+  case 398: /* yield_expr: YIELD '*' assignment_expr  */
+#line 2056 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_yield((yyvsp[0].node), true); }
+#line 7711 "build/generated/parser_fast.c"
+    break;
+
+  case 399: /* array_literal: '[' ']'  */
+#line 2061 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_array_literal(NULL); }
+#line 7717 "build/generated/parser_fast.c"
+    break;
+
+  case 400: /* array_literal: '[' elision ']'  */
+#line 2063 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_array_literal((yyvsp[-1].list)); }
+#line 7723 "build/generated/parser_fast.c"
+    break;
+
+  case 401: /* array_literal: '[' element_list ']'  */
+#line 2065 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_array_literal((yyvsp[-1].list)); }
+#line 7729 "build/generated/parser_fast.c"
+    break;
+
+  case 402: /* array_literal: '[' element_list ',' ']'  */
+#line 2067 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_array_literal((yyvsp[-2].list)); }
+#line 7735 "build/generated/parser_fast.c"
+    break;
+
+  case 403: /* elision: ','  */
+#line 2072 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, ast_make_array_hole()); }
+#line 7741 "build/generated/parser_fast.c"
+    break;
+
+  case 404: /* elision: elision ','  */
+#line 2074 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-1].list), ast_make_array_hole()); }
+#line 7747 "build/generated/parser_fast.c"
+    break;
+
+  case 405: /* elision_opt: %empty  */
+#line 2079 "build/generated/parser_fast.y"
+      { (yyval.list) = NULL; }
+#line 7753 "build/generated/parser_fast.c"
+    break;
+
+  case 406: /* elision_opt: elision  */
+#line 2081 "build/generated/parser_fast.y"
+      { (yyval.list) = (yyvsp[0].list); }
+#line 7759 "build/generated/parser_fast.c"
+    break;
+
+  case 407: /* element_list: elision_opt el_item  */
+#line 2086 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_concat((yyvsp[-1].list), ast_list_append(NULL, (yyvsp[0].node))); }
+#line 7765 "build/generated/parser_fast.c"
+    break;
+
+  case 408: /* element_list: element_list ',' elision_opt el_item  */
+#line 2088 "build/generated/parser_fast.y"
+      {
+          ASTList *list = ast_list_concat((yyvsp[-3].list), (yyvsp[-1].list));
+          (yyval.list) = ast_list_append(list, (yyvsp[0].node));
+      }
+#line 7774 "build/generated/parser_fast.c"
+    break;
+
+  case 409: /* element_list: element_list ',' elision  */
+#line 2093 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_concat((yyvsp[-2].list), (yyvsp[0].list)); }
+#line 7780 "build/generated/parser_fast.c"
+    break;
+
+  case 410: /* el_item: assignment_expr  */
+#line 2098 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7786 "build/generated/parser_fast.c"
+    break;
+
+  case 411: /* el_item: spread_element  */
+#line 2100 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7792 "build/generated/parser_fast.c"
+    break;
+
+  case 412: /* spread_element: ELLIPSIS assignment_expr  */
+#line 2105 "build/generated/parser_fast.y"
+            { (yyval.node) = ast_make_spread_element((yyvsp[0].node)); }
+#line 7798 "build/generated/parser_fast.c"
+    break;
+
+  case 415: /* object_literal: '{' '}'  */
+#line 2115 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_object_literal(NULL); }
+#line 7804 "build/generated/parser_fast.c"
+    break;
+
+  case 416: /* object_literal: '{' prop_list opt_trailing_comma '}'  */
+#line 2117 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_object_literal((yyvsp[-2].list)); }
+#line 7810 "build/generated/parser_fast.c"
+    break;
+
+  case 417: /* template_literal: TEMPLATE_NO_SUB  */
+#line 2122 "build/generated/parser_fast.y"
+      {
+          ASTList *quasis = NULL;
+          quasis = ast_list_append(quasis, ast_make_template_element((yyvsp[0].str), true));
+          (yyval.node) = ast_make_template_literal(quasis, NULL);
+      }
+#line 7820 "build/generated/parser_fast.c"
+    break;
+
+  case 418: /* template_literal: TEMPLATE_HEAD template_part_list  */
+#line 2128 "build/generated/parser_fast.y"
+      {
+          ASTList *quasis = NULL;
+          quasis = ast_list_append(quasis, ast_make_template_element((yyvsp[-1].str), false));
+          (yyval.node) = (yyvsp[0].node);
+          (yyval.node)->data.template_literal.quasis = ast_list_concat(quasis, (yyval.node)->data.template_literal.quasis);
+      }
+#line 7831 "build/generated/parser_fast.c"
+    break;
+
+  case 419: /* template_part_list: assignment_expr TEMPLATE_TAIL  */
+#line 2139 "build/generated/parser_fast.y"
+      {
+          ASTList *exprs = NULL;
+          ASTList *quasis = NULL;
+          exprs = ast_list_append(exprs, (yyvsp[-1].node));
+          quasis = ast_list_append(quasis, ast_make_template_element((yyvsp[0].str), true));
+          (yyval.node) = ast_make_template_literal(quasis, exprs);
+      }
+#line 7843 "build/generated/parser_fast.c"
+    break;
+
+  case 420: /* template_part_list: assignment_expr TEMPLATE_MIDDLE template_part_list  */
+#line 2147 "build/generated/parser_fast.y"
+      {
+          ASTList *exprs = NULL;
+          ASTList *quasis = NULL;
+          exprs = ast_list_append(exprs, (yyvsp[-2].node));
+          quasis = ast_list_append(quasis, ast_make_template_element((yyvsp[-1].str), false));
+          (yyval.node) = (yyvsp[0].node);
+          (yyval.node)->data.template_literal.expressions = ast_list_concat(exprs, (yyval.node)->data.template_literal.expressions);
+          (yyval.node)->data.template_literal.quasis = ast_list_concat(quasis, (yyval.node)->data.template_literal.quasis);
+      }
+#line 7857 "build/generated/parser_fast.c"
+    break;
+
+  case 421: /* prop_list: prop  */
+#line 2160 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 7863 "build/generated/parser_fast.c"
+    break;
+
+  case 422: /* prop_list: prop_list ',' prop  */
+#line 2162 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 7869 "build/generated/parser_fast.c"
+    break;
+
+  case 423: /* prop: property_name ':' assignment_expr  */
+#line 2167 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_property((yyvsp[-2].atom), true, (yyvsp[0].node)); }
+#line 7875 "build/generated/parser_fast.c"
+    break;
+
+  case 424: /* prop: IDENTIFIER  */
+#line 2169 "build/generated/parser_fast.y"
+      {
+          ASTNode *id = ast_make_identifier((yyvsp[0].atom));
+          (yyval.node) = ast_make_property(id->data.identifier.name, true, id);
+      }
+#line 7884 "build/generated/parser_fast.c"
+    break;
+
+  case 425: /* prop: method_definition  */
+#line 2174 "build/generated/parser_fast.y"
+      { (yyval.node) = build_method_node((yyvsp[0].method)); }
+#line 7890 "build/generated/parser_fast.c"
+    break;
+
+  case 426: /* prop: getter_definition  */
+#line 2176 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7896 "build/generated/parser_fast.c"
+    break;
+
+  case 427: /* prop: setter_definition  */
+#line 2178 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7902 "build/generated/parser_fast.c"
+    break;
+
+  case 428: /* prop: computed_property  */
+#line 2180 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7908 "build/generated/parser_fast.c"
+    break;
+
+  case 429: /* prop: spread_element  */
+#line 2182 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 7914 "build/generated/parser_fast.c"
+    break;
+
+  case 430: /* computed_property: '[' assignment_expr ']' ':' assignment_expr  */
+#line 2187 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_computed_property((yyvsp[-3].node), (yyvsp[0].node)); }
+#line 7920 "build/generated/parser_fast.c"
+    break;
+
+  case 431: /* property_name: IDENTIFIER  */
+#line 2192 "build/generated/parser_fast.y"
+                 { (yyval.atom) = (yyvsp[0].atom); }
+#line 7926 "build/generated/parser_fast.c"
+    break;
+
+  case 432: /* property_name: property_name_keyword  */
+#line 2193 "build/generated/parser_fast.y"
+                            { (yyval.atom) = (yyvsp[0].atom); }
+#line 7932 "build/generated/parser_fast.c"
+    break;
+
+  case 433: /* property_name_keyword: STRING  */
+#line 2197 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, (yyvsp[0].str)); free((yyvsp[0].str)); }
+#line 7938 "build/generated/parser_fast.c"
+    break;
+
+  case 434: /* property_name_keyword: NUMBER  */
+#line 2198 "build/generated/parser_fast.y"
+                 { (yyval.atom) = (yyvsp[0].atom); }
+#line 7944 "build/generated/parser_fast.c"
+    break;
+
+  case 435: /* property_name_keyword: DEFAULT  */
+#line 2199 "build/generated/parser_fast.y"
+                 { (yyval.atom) = ATOM(ctx->atoms, DEFAULT); }
+#line 7950 "build/generated/parser_fast.c"
+    break;
+
+  case 436: /* property_name_keyword: IF  */
+#line 2200 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "if"); }
+#line 7956 "build/generated/parser_fast.c"
+    break;
+
+  case 437: /* property_name_keyword: ELSE  */
+#line 2201 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "else"); }
+#line 7962 "build/generated/parser_fast.c"
+    break;
+
+  case 438: /* property_name_keyword: FOR  */
+#line 2202 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "for"); }
+#line 7968 "build/generated/parser_fast.c"
+    break;
+
+  case 439: /* property_name_keyword: WHILE  */
+#line 2203 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "while"); }
+#line 7974 "build/generated/parser_fast.c"
+    break;
+
+  case 440: /* property_name_keyword: DO  */
+#line 2204 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "do"); }
+#line 7980 "build/generated/parser_fast.c"
+    break;
+
+  case 441: /* property_name_keyword: FUNCTION  */
+#line 2205 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "function"); }
+#line 7986 "build/generated/parser_fast.c"
+    break;
+
+  case 442: /* property_name_keyword: VAR  */
+#line 2206 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "var"); }
+#line 7992 "build/generated/parser_fast.c"
+    break;
+
+  case 443: /* property_name_keyword: LET  */
+#line 2207 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "let"); }
+#line 7998 "build/generated/parser_fast.c"
+    break;
+
+  case 444: /* property_name_keyword: CONST  */
+#line 2208 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "const"); }
+#line 8004 "build/generated/parser_fast.c"
+    break;
+
+  case 445: /* property_name_keyword: RETURN  */
+#line 2209 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "return"); }
+#line 8010 "build/generated/parser_fast.c"
+    break;
+
+  case 446: /* property_name_keyword: BREAK  */
+#line 2210 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "break"); }
+#line 8016 "build/generated/parser_fast.c"
+    break;
+
+  case 447: /* property_name_keyword: CONTINUE  */
+#line 2211 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "continue"); }
+#line 8022 "build/generated/parser_fast.c"
+    break;
+
+  case 448: /* property_name_keyword: SWITCH  */
+#line 2212 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "switch"); }
+#line 8028 "build/generated/parser_fast.c"
+    break;
+
+  case 449: /* property_name_keyword: CASE  */
+#line 2213 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "case"); }
+#line 8034 "build/generated/parser_fast.c"
+    break;
+
+  case 450: /* property_name_keyword: TRY  */
+#line 2214 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "try"); }
+#line 8040 "build/generated/parser_fast.c"
+    break;
+
+  case 451: /* property_name_keyword: CATCH  */
+#line 2215 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "catch"); }
+#line 8046 "build/generated/parser_fast.c"
+    break;
+
+  case 452: /* property_name_keyword: FINALLY  */
+#line 2216 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "finally"); }
+#line 8052 "build/generated/parser_fast.c"
+    break;
+
+  case 453: /* property_name_keyword: THROW  */
+#line 2217 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "throw"); }
+#line 8058 "build/generated/parser_fast.c"
+    break;
+
+  case 454: /* property_name_keyword: NEW  */
+#line 2218 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "new"); }
+#line 8064 "build/generated/parser_fast.c"
+    break;
+
+  case 455: /* property_name_keyword: THIS  */
+#line 2219 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "this"); }
+#line 8070 "build/generated/parser_fast.c"
+    break;
+
+  case 456: /* property_name_keyword: TYPEOF  */
+#line 2220 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "typeof"); }
+#line 8076 "build/generated/parser_fast.c"
+    break;
+
+  case 457: /* property_name_keyword: DELETE  */
+#line 2221 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "delete"); }
+#line 8082 "build/generated/parser_fast.c"
+    break;
+
+  case 458: /* property_name_keyword: IN  */
+#line 2222 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "in"); }
+#line 8088 "build/generated/parser_fast.c"
+    break;
+
+  case 459: /* property_name_keyword: INSTANCEOF  */
+#line 2223 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "instanceof"); }
+#line 8094 "build/generated/parser_fast.c"
+    break;
+
+  case 460: /* property_name_keyword: VOID  */
+#line 2224 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "void"); }
+#line 8100 "build/generated/parser_fast.c"
+    break;
+
+  case 461: /* property_name_keyword: WITH  */
+#line 2225 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "with"); }
+#line 8106 "build/generated/parser_fast.c"
+    break;
+
+  case 462: /* property_name_keyword: DEBUGGER  */
+#line 2226 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "debugger"); }
+#line 8112 "build/generated/parser_fast.c"
+    break;
+
+  case 463: /* property_name_keyword: TRUE  */
+#line 2227 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "true"); }
+#line 8118 "build/generated/parser_fast.c"
+    break;
+
+  case 464: /* property_name_keyword: FALSE  */
+#line 2228 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "false"); }
+#line 8124 "build/generated/parser_fast.c"
+    break;
+
+  case 465: /* property_name_keyword: NULL_T  */
+#line 2229 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "null"); }
+#line 8130 "build/generated/parser_fast.c"
+    break;
+
+  case 466: /* property_name_keyword: UNDEFINED  */
+#line 2230 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "undefined"); }
+#line 8136 "build/generated/parser_fast.c"
+    break;
+
+  case 467: /* property_name_keyword: CLASS  */
+#line 2231 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "class"); }
+#line 8142 "build/generated/parser_fast.c"
+    break;
+
+  case 468: /* property_name_keyword: EXTENDS  */
+#line 2232 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "extends"); }
+#line 8148 "build/generated/parser_fast.c"
+    break;
+
+  case 469: /* property_name_keyword: SUPER  */
+#line 2233 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "super"); }
+#line 8154 "build/generated/parser_fast.c"
+    break;
+
+  case 470: /* property_name_keyword: ASYNC  */
+#line 2234 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "async"); }
+#line 8160 "build/generated/parser_fast.c"
+    break;
+
+  case 471: /* property_name_keyword: AWAIT  */
+#line 2235 "build/generated/parser_fast.y"
+                 { (yyval.atom) = atom_intern_cstr(ctx->atoms, "await"); }
+#line 8166 "build/generated/parser_fast.c"
+    break;
+
+  case 472: /* binding_initializer_opt: %empty  */
+#line 2240 "build/generated/parser_fast.y"
+      { (yyval.node) = NULL; }
+#line 8172 "build/generated/parser_fast.c"
+    break;
+
+  case 473: /* binding_initializer_opt: '=' assignment_expr  */
+#line 2242 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 8178 "build/generated/parser_fast.c"
+    break;
+
+  case 474: /* binding_initializer_opt_no_in: %empty  */
+#line 2247 "build/generated/parser_fast.y"
+      { (yyval.node) = NULL; }
+#line 8184 "build/generated/parser_fast.c"
+    break;
+
+  case 475: /* binding_initializer_opt_no_in: '=' assignment_expr_no_in  */
+#line 2249 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 8190 "build/generated/parser_fast.c"
+    break;
+
+  case 476: /* binding_element: IDENTIFIER binding_initializer_opt  */
+#line 2254 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_pattern(ast_make_identifier((yyvsp[-1].atom)), (yyvsp[0].node)); }
+#line 8196 "build/generated/parser_fast.c"
+    break;
+
+  case 477: /* binding_element: object_binding binding_initializer_opt  */
+#line 2256 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_pattern((yyvsp[-1].node), (yyvsp[0].node)); }
+#line 8202 "build/generated/parser_fast.c"
+    break;
+
+  case 478: /* binding_element: array_binding binding_initializer_opt  */
+#line 2258 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_pattern((yyvsp[-1].node), (yyvsp[0].node)); }
+#line 8208 "build/generated/parser_fast.c"
+    break;
+
+  case 479: /* object_binding: '{' '}'  */
+#line 2263 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_object_binding(NULL); }
+#line 8214 "build/generated/parser_fast.c"
+    break;
+
+  case 480: /* object_binding: '{' binding_property_sequence '}'  */
+#line 2265 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_object_binding((yyvsp[-1].list)); }
+#line 8220 "build/generated/parser_fast.c"
+    break;
+
+  case 481: /* binding_property_sequence: binding_property_list opt_trailing_comma  */
+#line 2270 "build/generated/parser_fast.y"
+      { (yyval.list) = (yyvsp[-1].list); }
+#line 8226 "build/generated/parser_fast.c"
+    break;
+
+  case 482: /* binding_property_sequence: binding_property_list ',' binding_rest_property  */
+#line 2272 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 8232 "build/generated/parser_fast.c"
+    break;
+
+  case 483: /* binding_property_sequence: binding_rest_property  */
+#line 2274 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 8238 "build/generated/parser_fast.c"
+    break;
+
+  case 484: /* binding_property_list: binding_property  */
+#line 2279 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 8244 "build/generated/parser_fast.c"
+    break;
+
+  case 485: /* binding_property_list: binding_property_list ',' binding_property  */
+#line 2281 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 8250 "build/generated/parser_fast.c"
+    break;
+
+  case 486: /* binding_property: IDENTIFIER ':' binding_element  */
+#line 2286 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_property((yyvsp[-2].atom), true, (yyvsp[0].node), false); }
+#line 8256 "build/generated/parser_fast.c"
+    break;
+
+  case 487: /* binding_property: property_name_keyword ':' binding_element  */
+#line 2288 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_property(unquote_property_key(ctx, (yyvsp[-2].atom)), false, (yyvsp[0].node), false); }
+#line 8262 "build/generated/parser_fast.c"
+    break;
+
+  case 488: /* binding_property: IDENTIFIER binding_initializer_opt  */
+#line 2290 "build/generated/parser_fast.y"
+      {
+          ASTNode *id = ast_make_identifier((yyvsp[-1].atom));
+          ASTNode *pattern = ast_make_binding_pattern(id, (yyvsp[0].node));
+          (yyval.node) = ast_make_binding_property(id->data.identifier.name, true, pattern, true);
+      }
+#line 8272 "build/generated/parser_fast.c"
+    break;
+
+  case 489: /* binding_rest_property: ELLIPSIS IDENTIFIER  */
+#line 2299 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_rest_element(ast_make_identifier((yyvsp[0].atom))); }
+#line 8278 "build/generated/parser_fast.c"
+    break;
+
+  case 490: /* array_binding: '[' binding_elision_opt ']'  */
+#line 2304 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_array_binding((yyvsp[-1].list)); }
+#line 8284 "build/generated/parser_fast.c"
+    break;
+
+  case 491: /* array_binding: '[' binding_elision_opt binding_element_list opt_trailing_comma ']'  */
+#line 2306 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_concat((yyvsp[-3].list), (yyvsp[-2].list)); (yyval.node) = ast_make_array_binding(list); }
+#line 8290 "build/generated/parser_fast.c"
+    break;
+
+  case 492: /* array_binding: '[' binding_elision_opt binding_element_list ',' binding_elision_opt binding_rest_element opt_trailing_comma ']'  */
+#line 2308 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_concat((yyvsp[-6].list), (yyvsp[-5].list)); list = ast_list_concat(list, (yyvsp[-3].list)); (yyval.node) = ast_make_array_binding(ast_list_append(list, (yyvsp[-2].node))); }
+#line 8296 "build/generated/parser_fast.c"
+    break;
+
+  case 493: /* array_binding: '[' binding_elision_opt binding_rest_element opt_trailing_comma ']'  */
+#line 2310 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_concat((yyvsp[-3].list), ast_list_append(NULL, (yyvsp[-2].node))); (yyval.node) = ast_make_array_binding(list); }
+#line 8302 "build/generated/parser_fast.c"
+    break;
+
+  case 494: /* binding_element_list: binding_element  */
+#line 2315 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 8308 "build/generated/parser_fast.c"
+    break;
+
+  case 495: /* binding_element_list: binding_element_list ',' binding_elision_opt binding_element  */
+#line 2317 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_concat((yyvsp[-3].list), (yyvsp[-1].list)); (yyval.list) = ast_list_append(list, (yyvsp[0].node)); }
+#line 8314 "build/generated/parser_fast.c"
+    break;
+
+  case 496: /* binding_elision_opt: %empty  */
+#line 2322 "build/generated/parser_fast.y"
+      { (yyval.list) = NULL; }
+#line 8320 "build/generated/parser_fast.c"
+    break;
+
+  case 497: /* binding_elision_opt: binding_elision  */
+#line 2324 "build/generated/parser_fast.y"
+      { (yyval.list) = (yyvsp[0].list); }
+#line 8326 "build/generated/parser_fast.c"
+    break;
+
+  case 498: /* binding_elision: ','  */
+#line 2329 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, ast_make_array_hole()); }
+#line 8332 "build/generated/parser_fast.c"
+    break;
+
+  case 499: /* binding_elision: ',' binding_elision  */
+#line 2331 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_append(NULL, ast_make_array_hole()); (yyval.list) = ast_list_concat(list, (yyvsp[0].list)); }
+#line 8338 "build/generated/parser_fast.c"
+    break;
+
+  case 500: /* binding_rest_element: ELLIPSIS IDENTIFIER  */
+#line 2336 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_rest_element(ast_make_identifier((yyvsp[0].atom))); }
+#line 8344 "build/generated/parser_fast.c"
+    break;
+
+  case 501: /* assignment_pattern: object_assignment_pattern  */
+#line 2341 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_pattern((yyvsp[0].node), NULL); }
+#line 8350 "build/generated/parser_fast.c"
+    break;
+
+  case 502: /* assignment_pattern: array_assignment_pattern  */
+#line 2343 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_pattern((yyvsp[0].node), NULL); }
+#line 8356 "build/generated/parser_fast.c"
+    break;
+
+  case 503: /* object_assignment_pattern: '{' '}'  */
+#line 2348 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_object_binding(NULL); }
+#line 8362 "build/generated/parser_fast.c"
+    break;
+
+  case 504: /* object_assignment_pattern: '{' assignment_property_sequence '}'  */
+#line 2350 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_object_binding((yyvsp[-1].list)); }
+#line 8368 "build/generated/parser_fast.c"
+    break;
+
+  case 505: /* assignment_property_sequence: assignment_property_list opt_trailing_comma  */
+#line 2355 "build/generated/parser_fast.y"
+      { (yyval.list) = (yyvsp[-1].list); }
+#line 8374 "build/generated/parser_fast.c"
+    break;
+
+  case 506: /* assignment_property_sequence: assignment_property_list ',' assignment_rest_element  */
+#line 2357 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 8380 "build/generated/parser_fast.c"
+    break;
+
+  case 507: /* assignment_property_sequence: assignment_rest_element  */
+#line 2359 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 8386 "build/generated/parser_fast.c"
+    break;
+
+  case 508: /* assignment_property_list: assignment_property  */
+#line 2364 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 8392 "build/generated/parser_fast.c"
+    break;
+
+  case 509: /* assignment_property_list: assignment_property_list ',' assignment_property  */
+#line 2366 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 8398 "build/generated/parser_fast.c"
+    break;
+
+  case 510: /* assignment_property: IDENTIFIER ':' assignment_element  */
+#line 2371 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_property((yyvsp[-2].atom), true, (yyvsp[0].node), false); }
+#line 8404 "build/generated/parser_fast.c"
+    break;
+
+  case 511: /* assignment_property: property_name_keyword ':' assignment_element  */
+#line 2373 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_property(unquote_property_key(ctx, (yyvsp[-2].atom)), false, (yyvsp[0].node), false); }
+#line 8410 "build/generated/parser_fast.c"
+    break;
+
+  case 512: /* assignment_property: IDENTIFIER binding_initializer_opt  */
+#line 2375 "build/generated/parser_fast.y"
+      {
+          ASTNode *id = ast_make_identifier((yyvsp[-1].atom));
+          ASTNode *pattern = ast_make_binding_pattern(id, (yyvsp[0].node));
+          (yyval.node) = ast_make_binding_property(id->data.identifier.name, true, pattern, true);
+      }
+#line 8420 "build/generated/parser_fast.c"
+    break;
+
+  case 513: /* assignment_rest_element: ELLIPSIS postfix_expr  */
+#line 2384 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_rest_element((yyvsp[0].node)); }
+#line 8426 "build/generated/parser_fast.c"
+    break;
+
+  case 514: /* array_assignment_pattern: '[' binding_elision_opt ']'  */
+#line 2389 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_array_binding((yyvsp[-1].list)); }
+#line 8432 "build/generated/parser_fast.c"
+    break;
+
+  case 515: /* array_assignment_pattern: '[' binding_elision_opt assignment_element_list opt_trailing_comma ']'  */
+#line 2391 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_concat((yyvsp[-3].list), (yyvsp[-2].list)); (yyval.node) = ast_make_array_binding(list); }
+#line 8438 "build/generated/parser_fast.c"
+    break;
+
+  case 516: /* array_assignment_pattern: '[' binding_elision_opt assignment_element_list ',' binding_elision_opt assignment_rest_element opt_trailing_comma ']'  */
+#line 2393 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_concat((yyvsp[-6].list), (yyvsp[-5].list)); list = ast_list_concat(list, (yyvsp[-3].list)); (yyval.node) = ast_make_array_binding(ast_list_append(list, (yyvsp[-2].node))); }
+#line 8444 "build/generated/parser_fast.c"
+    break;
+
+  case 517: /* array_assignment_pattern: '[' binding_elision_opt assignment_rest_element opt_trailing_comma ']'  */
+#line 2395 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_concat((yyvsp[-3].list), ast_list_append(NULL, (yyvsp[-2].node))); (yyval.node) = ast_make_array_binding(list); }
+#line 8450 "build/generated/parser_fast.c"
+    break;
+
+  case 518: /* assignment_element_list: assignment_element  */
+#line 2400 "build/generated/parser_fast.y"
+      { (yyval.list) = ast_list_append(NULL, (yyvsp[0].node)); }
+#line 8456 "build/generated/parser_fast.c"
+    break;
+
+  case 519: /* assignment_element_list: assignment_element_list ',' binding_elision_opt assignment_element  */
+#line 2402 "build/generated/parser_fast.y"
+      { ASTList *list = ast_list_concat((yyvsp[-3].list), (yyvsp[-1].list)); (yyval.list) = ast_list_append(list, (yyvsp[0].node)); }
+#line 8462 "build/generated/parser_fast.c"
+    break;
+
+  case 520: /* assignment_element: assignment_target binding_initializer_opt  */
+#line 2407 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_binding_pattern((yyvsp[-1].node), (yyvsp[0].node)); }
+#line 8468 "build/generated/parser_fast.c"
+    break;
+
+  case 521: /* assignment_target: postfix_expr  */
+#line 2412 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 8474 "build/generated/parser_fast.c"
+    break;
+
+  case 522: /* assignment_target: object_assignment_pattern  */
+#line 2414 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 8480 "build/generated/parser_fast.c"
+    break;
+
+  case 523: /* assignment_target: array_assignment_pattern  */
+#line 2416 "build/generated/parser_fast.y"
+      { (yyval.node) = (yyvsp[0].node); }
+#line 8486 "build/generated/parser_fast.c"
+    break;
+
+  case 524: /* for_binding: VAR for_binding_declarator  */
+#line 2421 "build/generated/parser_fast.y"
+      { ASTList *list = NULL; list = ast_list_append(list, (yyvsp[0].node)); (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_VAR, list); }
+#line 8492 "build/generated/parser_fast.c"
+    break;
+
+  case 525: /* for_binding: LET for_binding_declarator  */
+#line 2423 "build/generated/parser_fast.y"
+      { ASTList *list = NULL; list = ast_list_append(list, (yyvsp[0].node)); (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_LET, list); }
+#line 8498 "build/generated/parser_fast.c"
+    break;
+
+  case 526: /* for_binding: CONST for_binding_declarator  */
+#line 2425 "build/generated/parser_fast.y"
+      { ASTList *list = NULL; list = ast_list_append(list, (yyvsp[0].node)); (yyval.node) = ast_make_var_stmt(AST_VAR_KIND_CONST, list); }
+#line 8504 "build/generated/parser_fast.c"
+    break;
+
+  case 527: /* for_binding_declarator: IDENTIFIER  */
+#line 2430 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier((yyvsp[0].atom)), NULL)); }
+#line 8510 "build/generated/parser_fast.c"
+    break;
+
+  case 528: /* for_binding_declarator: object_binding  */
+#line 2432 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern((yyvsp[0].node), NULL)); }
+#line 8516 "build/generated/parser_fast.c"
+    break;
+
+  case 529: /* for_binding_declarator: array_binding  */
+#line 2434 "build/generated/parser_fast.y"
+      { (yyval.node) = ast_make_var_decl(ast_make_binding_pattern((yyvsp[0].node), NULL)); }
+#line 8522 "build/generated/parser_fast.c"
+    break;
+
+
+#line 8526 "build/generated/parser_fast.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == JSFAST_EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyps, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (ctx, yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= JSFAST_EOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == JSFAST_EOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, ctx);
+          yychar = JSFAST_EMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, ctx);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (ctx, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != JSFAST_EMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, ctx);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, ctx);
+      YYPOPSTACK (1);
+    }
+  yyps->yynew = 2;
+  goto yypushreturn;
+
+
+/*-------------------------.
+| yypushreturn -- return.  |
+`-------------------------*/
+yypushreturn:
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+#undef jsfast_nerrs
+#undef yystate
+#undef yyerrstatus
+#undef yyssa
+#undef yyss
+#undef yyssp
+#undef yyvsa
+#undef yyvs
+#undef yyvsp
+#undef yystacksize
+#line 2437 "build/generated/parser_fast.y"
+
+
+#ifdef JS_PARSER_FAST
+
+// 快速路径的错误不报告：该语句会交给 GLR 重新解析，由它给出诊断
+void yyerror(JSParser *ctx, const char *s) {
+    (void)s;
+    ctx->statement_failed = true;
+}
+
+// 两个解析器由同一份文法生成，LALR 状态编号一致；语义值联合体的声明也相同
+bool fast_parser_compatible(size_t value_size) {
+    return value_size == sizeof(YYSTYPE) && parser_lr_state_count() == YYNSTATES;
+}
+
+FastParser *fast_parser_new(void) {
+    return yypstate_new();
+}
+
+void fast_parser_free(FastParser *parser) {
+    yypstate_delete(parser);
+}
+
+FastPushStatus fast_parser_push(FastParser *parser, int token, const void *value, JSParser *ctx) {
+    int status = yypush_parse(parser, token, (const YYSTYPE *)value, ctx);
+    if (status == YYPUSH_MORE) {
+        return FAST_PUSH_MORE;
+    }
+    return status == 0 ? FAST_PUSH_ACCEPTED : FAST_PUSH_FAILED;
+}
+
+// 在不改动解析器的前提下模拟读入 token 之后的归约序列（类似 LAC，只查表不执行动作），
+// 途经的每个状态都到 GLR 的表里检查这一格是否有冲突：没有冲突的路径上确定性解析与 GLR 完全一致
+bool fast_parser_lookahead_ok(const FastParser *parser, int token) {
+    yysymbol_kind_t symbol = token <= 0 ? YYSYMBOL_YYEOF : YYTRANSLATE(token);
+    const yy_state_t *base = parser->yyssp;  // 原栈中尚未被模拟弹出的栈顶
+    yy_state_t pushed[64];                   // 模拟中压入的状态
+    int pushed_count = 0;
+    int state = *base;
+    for (;;) {
+        if (parser_lr_conflict(state, symbol)) {
+            return false;
+        }
+        int rule;
+        int index = yypact[state] + symbol;
+        if (yypact_value_is_default(yypact[state]) || index < 0 || YYLAST < index || yycheck[index] != symbol) {
+            rule = yydefact[state];
+            if (rule == 0) {
+                return true;    // 语法错误，由 push 报告
+            }
+        } else if (yytable[index] > 0 || yytable_value_is_error(yytable[index])) {
+            return true;        // 移进（或错误）：归约序列到此结束
+        } else {
+            rule = -yytable[index];
+        }
+        int length = yyr2[rule];
+        if (length <= pushed_count) {
+            pushed_count -= length;
+        } else {
+            base -= length - pushed_count;
+            pushed_count = 0;
+        }
+        int top = pushed_count > 0 ? pushed[pushed_count - 1] : *base;
+        int lhs = yyr1[rule] - YYNTOKENS;
+        int goto_index = yypgoto[lhs] + top;
+        state = (0 <= goto_index && goto_index <= YYLAST && yycheck[goto_index] == top)
+                    ? yytable[goto_index] : yydefgoto[lhs];
+        if (pushed_count == (int)(sizeof(pushed) / sizeof(pushed[0]))) {
+            return false;
+        }
+        pushed[pushed_count++] = (yy_state_t)state;
+    }
+}
+
+// 放弃解析到一半的语句：按 %destructor 释放栈上的值，解析器回到初始状态
+void fast_parser_reset(FastParser *parser, JSParser *ctx) {
+    if (parser->yynew != 0) {
+        return;
+    }
+    while (parser->yyssp != parser->yyss) {
+        yydestruct("Fast path: discarding", YY_ACCESSING_SYMBOL(*parser->yyssp), parser->yyvsp, ctx);
+        parser->yyssp--;
+        parser->yyvsp--;
+    }
+    parser->yynew = 2;
+}
+
+#else
+
+void yyerror(JSParser *ctx, const char *s) {
+    ctx->error_count++;
+    if (ctx->print_errors) {
+        fprintf(stderr, "Syntax error #%d: %s\n", ctx->error_count, s);
+    }
+    diag_record_error(&ctx->diag, s);
+}
+
+// 只验证语法的解析器表与主解析器相同，表查询只由主解析器提供一份
+#ifndef JS_PARSER_VALIDATE
+int parser_lr_state_count(void) {
+    return YYNSTATES;
+}
+
+// 状态 state 遇到 symbol 时表里是否有多个动作（GLR 会在这里分裂）
+bool parser_lr_conflict(int state, int symbol) {
+    const short *conflicts;
+    yygetLRActions((yy_state_t)state, (yysymbol_kind_t)symbol, &conflicts);
+    return *conflicts != 0;
+}
+
+// 规则 rule（bison -v 的编号，即跟踪输出里的编号）的左部名字；parse.error verbose 时 yytname 总是存在
+const char *parser_rule_lhs(int rule) {
+    return yytname[yyr1[rule + 1]];
+}
+
+// 规则在生成的 parser.y 中的行号；yyrline 只在带跟踪代码的构建里有
+int parser_rule_line(int rule) {
+#if YYDEBUG
+    return yyrline[rule + 1];
+#else
+    (void)rule;
+    return 0;
+#endif
+}
+#endif
+
+#endif
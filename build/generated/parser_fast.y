@@ -0,0 +1,2563 @@
+/*
+ * JavaScript 语法分析器（Bison）
+ * 现支持在语义动作中构建 AST，并可通过 --dump-ast 选项输出树结构。
+ *
+ * 同一份文法生成两个解析器（gen_tokens 展开下面的 @PARSER_MODE@）：
+ *   parser.c      GLR 主解析器
+ *   parser_fast.c 确定性推送式解析器（-DJS_PARSER_FAST），按顶层语句先行尝试，
+ *                 遇到冲突格或错误时该语句交回 GLR 重新解析（见 parser_fast_path.c）
+ * 两者各有一个只验证语法的版本（gen_tokens --validate，-DJS_PARSER_VALIDATE）：parser_validate.c
+ * 与 parser_fast_validate.c。表完全相同，动作只保留标了 %validate 的（早期错误、分段边界、
+ * 方法修饰符检查需要的值），其余动作把值清零，不构造任何 AST
+ */
+
+%{
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "ast.h"
+#include "parser_context.h"
+#include "postfix_suffix.h"
+#include "binary_chain.h"
+
+// 序言先于 %code provides 输出，这里需要单独声明
+void yyerror(JSParser *ctx, const char *s);
+
+#ifndef JS_PARSER_FAST
+// --glr-stats / --glr-trace 的钩子（GLR_STATS_HOOK）由 gen_tokens --glr-hooks 插入生成的 parser.c；
+// glr.c 的跟踪文本经过 YYFPRINTF，只在 JS_PARSER_TRACE 时输出
+#include "glr_stats.h"
+#define YYFPRINTF glr_trace_fprintf
+#endif
+
+#ifndef YYMAXDEPTH
+#define YYMAXDEPTH 10000000 /* Allow deep GLR stacks for 10^5-level nesting; member/call chains are left-recursive and stay shallow */
+#endif
+
+#ifndef YYINITDEPTH
+#ifdef JS_PARSER_FAST
+#define YYINITDEPTH 256     /* 推送式解析器的初始栈嵌在 pstate 里，不够时按倍数扩容 */
+#else
+// GLR 栈的初始容量按本次 yyparse 要解析的 token 数估计（parser_fast_path.c 设置），不够时 glr.c 倍增；
+// 骨架只在 yyparse 里用到 YYINITDEPTH，ctx 在作用域内
+#define YYINITDEPTH (ctx->glr_initial_depth)
+#endif
+#endif
+
+// 语句分段解析时顶层语句的归约需要知道：动作是否立即执行（GLR 分裂期间动作延后，yynormal 为假），
+// 以及当前是否已读入前瞻 token（两个解析器的“无前瞻”常量名字不同）
+#if defined(JS_PARSER_FAST) && defined(JS_PARSER_VALIDATE)
+#define PARSER_NO_LOOKAHEAD JSFASTVALIDATE_EMPTY
+#define PARSER_ACTION_IMMEDIATE 1
+#elif defined(JS_PARSER_FAST)
+#define PARSER_NO_LOOKAHEAD JSFAST_EMPTY
+#define PARSER_ACTION_IMMEDIATE 1
+#elif defined(JS_PARSER_VALIDATE)
+#define PARSER_NO_LOOKAHEAD JSVALIDATE_EMPTY
+#define PARSER_ACTION_IMMEDIATE yynormal
+#else
+#define PARSER_NO_LOOKAHEAD YYEMPTY
+#define PARSER_ACTION_IMMEDIATE yynormal
+#endif
+
+// 分段解析：每归约出一条顶层语句就结束本段，已读入的前瞻 token 留给下一段
+#define END_STATEMENT_SEGMENT(items)                                        \
+    do {                                                                    \
+        if (ctx->statement_mode && PARSER_ACTION_IMMEDIATE) {               \
+            ctx->statement_items = (items);                                 \
+            ctx->statement_lookahead = (yychar != PARSER_NO_LOOKAHEAD);     \
+            yyclearin;                                                      \
+            YYACCEPT;                                                       \
+        }                                                                   \
+    } while (0)
+
+#ifdef JS_PARSER_FAST
+// 快速路径放弃一条语句时，栈上已建好的部分 AST 由 %destructor 释放
+static void discard_suffix_chain(PostfixSuffix *chain) {
+    if (chain) {
+        PostfixSuffix *tail = chain;
+        chain = tail->next;
+        tail->next = NULL;
+    }
+    while (chain) {
+        PostfixSuffix *next = chain->next;
+        switch (chain->kind) {
+            case POSTFIX_SUFFIX_COMPUTED:
+                ast_free(chain->data.computed_expr);
+                break;
+            case POSTFIX_SUFFIX_CALL:
+                ast_list_free(chain->data.arguments);
+                break;
+            case POSTFIX_SUFFIX_TEMPLATE:
+                ast_free(chain->data.template_literal);
+                break;
+            case POSTFIX_SUFFIX_PROP:
+                break;
+        }
+        free(chain);
+        chain = next;
+    }
+}
+
+static void discard_binary_chain(BinaryChain *chain) {
+    for (size_t i = 0; i < chain->count; i++) {
+        ast_free(chain->items[i].operand);
+    }
+    free(chain);
+}
+#endif
+
+// 方法定义在类元素/对象属性的修饰符都检查完之后才构造节点，此前名字、修饰符、参数与函数体都放在这里
+#ifndef JS_METHOD_INFO_DEFINED
+#define JS_METHOD_INFO_DEFINED
+typedef struct MethodInfo MethodInfo;
+#endif
+struct MethodInfo {
+    const char *name;
+    ASTNode *computed_key;
+    bool computed;
+    bool is_generator;
+    bool is_async;
+    bool is_static;
+    ASTMethodKind kind;
+    ASTList *params;
+    ASTNode *body;
+    size_t param_count;         // 只验证语法时没有参数表，只有个数
+};
+
+static ASTNode *wrap_destructuring_target(ASTNode *target) {
+    if (!target) {
+        return NULL;
+    }
+    if (target->type == AST_OBJECT_BINDING || target->type == AST_ARRAY_BINDING) {
+        return ast_make_binding_pattern(target, NULL);
+    }
+    return target;
+}
+
+static ASTNode *make_binding_with_initializer(ASTNode *target, ASTNode *initializer);
+static ASTNode *convert_assignment_target(ASTNode *expr, bool allow_object_literal);
+static ASTNode *convert_array_literal_to_binding(ASTNode *expr, bool allow_object_literal);
+static ASTNode *convert_object_literal_to_binding(ASTNode *expr);
+
+static ASTNode *make_binding_with_initializer(ASTNode *target, ASTNode *initializer) {
+    if (!target) {
+        return NULL;
+    }
+    if (target->type == AST_BINDING_PATTERN) {
+        if (initializer && !target->data.binding_pattern.initializer) {
+            target->data.binding_pattern.initializer = initializer;
+        }
+        return target;
+    }
+    return ast_make_binding_pattern(target, initializer);
+}
+
+static ASTNode *convert_assignment_target(ASTNode *expr, bool allow_object_literal) {
+    if (!expr) {
+        return NULL;
+    }
+    switch (expr->type) {
+        case AST_IDENTIFIER:
+            return expr;
+        case AST_ARRAY_LITERAL:
+            return convert_array_literal_to_binding(expr, allow_object_literal);
+        case AST_OBJECT_LITERAL:
+            return allow_object_literal ? convert_object_literal_to_binding(expr) : NULL;
+        case AST_ASSIGN_EXPR:
+            if (expr->data.assign.op && strcmp(expr->data.assign.op, "=") == 0) {
+                ASTNode *lhs = convert_assignment_target(expr->data.assign.left, allow_object_literal);
+                if (!lhs) {
+                    return NULL;
+                }
+                return make_binding_with_initializer(lhs, expr->data.assign.right);
+            }
+            return NULL;
+        default:
+            return NULL;
+    }
+}
+
+static ASTNode *convert_array_literal_to_binding(ASTNode *expr, bool allow_object_literal) {
+    if (!expr || expr->type != AST_ARRAY_LITERAL) {
+        return NULL;
+    }
+    ASTList *converted = NULL;
+    ASTList *elem = expr->data.array_literal.elements;
+    while (elem) {
+        ASTNode *item = elem->node;
+        if (!item) {
+            elem = elem->next;
+            continue;
+        }
+        ASTNode *converted_item = NULL;
+        if (item->type == AST_ARRAY_HOLE) {
+            converted_item = ast_make_array_hole();
+        } else if (item->type == AST_SPREAD_ELEMENT) {
+            ASTNode *rest_target = convert_assignment_target(item->data.spread_element.argument, allow_object_literal);
+            if (!rest_target) {
+                return NULL;
+            }
+            converted_item = ast_make_rest_element(rest_target);
+        } else {
+            ASTNode *init = NULL;
+            ASTNode *value = item;
+            if (item->type == AST_ASSIGN_EXPR && item->data.assign.op &&
+                strcmp(item->data.assign.op, "=") == 0) {
+                value = item->data.assign.left;
+                init = item->data.assign.right;
+            }
+            ASTNode *target = convert_assignment_target(value, allow_object_literal);
+            if (!target) {
+                return NULL;
+            }
+            converted_item = make_binding_with_initializer(target, init);
+        }
+        converted = ast_list_append(converted, converted_item);
+        elem = elem->next;
+    }
+    return ast_make_array_binding(converted);
+}
+
+static ASTNode *convert_object_literal_to_binding(ASTNode *expr) {
+    if (!expr || expr->type != AST_OBJECT_LITERAL) {
+        return NULL;
+    }
+    ASTList *converted = NULL;
+    for (ASTList *prop = expr->data.object_literal.properties; prop; prop = prop->next) {
+        ASTNode *item = prop->node;
+        if (!item) {
+            continue;
+        }
+        if (item->type == AST_SPREAD_ELEMENT) {
+            ASTNode *rest_target = convert_assignment_target(item->data.spread_element.argument, true);
+            if (!rest_target) {
+                return NULL;
+            }
+            converted = ast_list_append(converted, ast_make_rest_element(rest_target));
+            continue;
+        }
+        if (item->type != AST_PROPERTY) {
+            return NULL;
+        }
+        bool is_identifier_key = item->data.property.key.is_identifier;
+        const char *key = item->data.property.key.name;
+        ASTNode *value = item->data.property.value;
+        ASTNode *init = NULL;
+        ASTNode *binding_target = NULL;
+        if (value && value->type == AST_ASSIGN_EXPR && value->data.assign.op &&
+            strcmp(value->data.assign.op, "=") == 0) {
+            binding_target = convert_assignment_target(value->data.assign.left, true);
+            init = value->data.assign.right;
+        } else {
+            binding_target = convert_assignment_target(value, true);
+        }
+        if (!binding_target) {
+            return NULL;
+        }
+        ASTNode *binding_value = make_binding_with_initializer(binding_target, init);
+        bool shorthand = false;
+        if (is_identifier_key && value && value->type == AST_IDENTIFIER && item->data.property.key.name) {
+            shorthand = item->data.property.key.name == value->data.identifier.name;
+        }
+        converted = ast_list_append(converted,
+                                    ast_make_binding_property(key, is_identifier_key, binding_value, shorthand));
+    }
+    return ast_make_object_binding(converted);
+}
+
+static PostfixSuffix *alloc_suffix(PostfixSuffixKind kind) {
+    PostfixSuffix *suffix = (PostfixSuffix *)calloc(1, sizeof(PostfixSuffix));
+    if (!suffix) {
+        fprintf(stderr, "Out of memory while building postfix suffix chain\n");
+        exit(EXIT_FAILURE);
+    }
+    suffix->kind = kind;
+    suffix->next = suffix;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_prop(const char *name) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_PROP);
+    suffix->data.property_name = name;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_computed(ASTNode *expr) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_COMPUTED);
+    suffix->data.computed_expr = expr;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_call(ASTList *args) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_CALL);
+    suffix->data.arguments = args;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_template(ASTNode *literal) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_TEMPLATE);
+    suffix->data.template_literal = literal;
+    return suffix;
+}
+
+// 后缀链按环形链表保存、以最后一项代表整条链，追加是 O(1)：
+// 十万级的 a.b(c).d[e]... 链不会因为每次找尾而变成平方时间
+static PostfixSuffix *append_suffix(PostfixSuffix *tail, PostfixSuffix *item) {
+    if (!item) {
+        return tail;
+    }
+    if (tail) {
+        item->next = tail->next;
+        tail->next = item;
+    }
+    return item;
+}
+
+static ASTNode *apply_suffix_chain(ASTNode *base, PostfixSuffix *chain) {
+    PostfixSuffix *current = NULL;
+    if (chain) {
+        current = chain->next;
+        chain->next = NULL;
+    }
+    while (current) {
+        PostfixSuffix *next = current->next;
+        switch (current->kind) {
+            case POSTFIX_SUFFIX_PROP:
+                base = ast_make_member(base, ast_make_identifier(current->data.property_name), false);
+                break;
+            case POSTFIX_SUFFIX_COMPUTED:
+                base = ast_make_member(base, current->data.computed_expr, true);
+                break;
+            case POSTFIX_SUFFIX_CALL:
+                base = ast_make_call(base, current->data.arguments);
+                break;
+            case POSTFIX_SUFFIX_TEMPLATE:
+                base = ast_make_tagged_template(base, current->data.template_literal);
+                break;
+        }
+        free(current);
+        current = next;
+    }
+    return base;
+}
+
+// 二元运算符优先级（与原先逐级展开的文法一致：** 与 * / % 同级且左结合）
+enum
+{
+    BINOP_OR, BINOP_AND, BINOP_BIT_OR, BINOP_BIT_XOR, BINOP_BIT_AND,
+    BINOP_EQ, BINOP_NE, BINOP_EQ_STRICT, BINOP_NE_STRICT,
+    BINOP_LT, BINOP_GT, BINOP_LE, BINOP_GE, BINOP_INSTANCEOF, BINOP_IN,
+    BINOP_LSHIFT, BINOP_RSHIFT, BINOP_URSHIFT,
+    BINOP_ADD, BINOP_SUB, BINOP_MUL, BINOP_EXP, BINOP_DIV, BINOP_MOD
+};
+
+static const BinaryOperator binary_operators[] = {
+    [BINOP_OR] = {"||", 1},
+    [BINOP_AND] = {"&&", 2},
+    [BINOP_BIT_OR] = {"|", 3},
+    [BINOP_BIT_XOR] = {"^", 4},
+    [BINOP_BIT_AND] = {"&", 5},
+    [BINOP_EQ] = {"==", 6},
+    [BINOP_NE] = {"!=", 6},
+    [BINOP_EQ_STRICT] = {"===", 6},
+    [BINOP_NE_STRICT] = {"!==", 6},
+    [BINOP_LT] = {"<", 7},
+    [BINOP_GT] = {">", 7},
+    [BINOP_LE] = {"<=", 7},
+    [BINOP_GE] = {">=", 7},
+    [BINOP_INSTANCEOF] = {"instanceof", 7},
+    [BINOP_IN] = {"in", 7},
+    [BINOP_LSHIFT] = {"<<", 8},
+    [BINOP_RSHIFT] = {">>", 8},
+    [BINOP_URSHIFT] = {">>>", 8},
+    [BINOP_ADD] = {"+", 9},
+    [BINOP_SUB] = {"-", 9},
+    [BINOP_MUL] = {"*", 10},
+    [BINOP_EXP] = {"**", 10},
+    [BINOP_DIV] = {"/", 10},
+    [BINOP_MOD] = {"%", 10},
+};
+
+static BinaryChain *binary_chain_append(BinaryChain *chain, const BinaryOperator *op, ASTNode *operand) {
+    size_t count = chain ? chain->count : 0;
+    if (!chain || count == chain->capacity) {
+        size_t capacity = chain ? chain->capacity * 2 : 4;
+        BinaryChain *grown = (BinaryChain *)realloc(chain, sizeof(BinaryChain) + capacity * sizeof(BinaryChainItem));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while building binary expression\n");
+            exit(EXIT_FAILURE);
+        }
+        grown->count = count;
+        grown->capacity = capacity;
+        chain = grown;
+    }
+    chain->items[count].op = op;
+    chain->items[count].operand = operand;
+    chain->count = count + 1;
+    return chain;
+}
+
+// 优先级爬升：从 *next 开始吸收优先级不低于 min_precedence 的运算符，
+// 右操作数后面跟着更紧的运算符时先递归把它们结合进右操作数（递归深度不超过优先级层数）
+static ASTNode *climb_binary_chain(const BinaryChain *chain, size_t *next, ASTNode *left, int min_precedence) {
+    while (*next < chain->count && chain->items[*next].op->precedence >= min_precedence) {
+        const BinaryOperator *op = chain->items[*next].op;
+        ASTNode *right = chain->items[(*next)++].operand;
+        while (*next < chain->count && chain->items[*next].op->precedence > op->precedence) {
+            right = climb_binary_chain(chain, next, right, op->precedence + 1);
+        }
+        left = ast_make_binary(op->op, left, right);
+    }
+    return left;
+}
+
+static ASTNode *fold_binary_chain(BinaryChain *chain) {
+    size_t next = 1;
+    ASTNode *result = climb_binary_chain(chain, &next, chain->items[0].operand, 0);
+    free(chain);
+    return result;
+}
+
+// 方法名与修饰符放在堆上，语义值只是一个指针（YYSTYPE 保持指针大小）；build_method_node 接管并释放
+static MethodInfo *method_info_alloc(const char *name, ASTNode *computed_key, bool computed) {
+    MethodInfo *info = (MethodInfo *)malloc(sizeof(MethodInfo));
+    if (!info) {
+        fprintf(stderr, "Out of memory while constructing method\n");
+        exit(EXIT_FAILURE);
+    }
+    info->name = name;
+    info->computed_key = computed_key;
+    info->computed = computed;
+    info->is_generator = false;
+    info->is_async = false;
+    info->is_static = false;
+    info->kind = AST_METHOD_KIND_NORMAL;
+    info->params = NULL;
+    info->body = NULL;
+    info->param_count = 0;
+    return info;
+}
+
+static void method_info_free(MethodInfo *info) {
+    if (info) {
+        ast_free(info->computed_key);
+        ast_list_free(info->params);
+        ast_free(info->body);
+        free(info);
+    }
+}
+
+static MethodInfo *method_info_set_function(MethodInfo *info, ASTList *params, ASTNode *body) {
+    info->params = params;
+    info->body = body;
+    info->param_count = 0;
+    for (ASTList *param = params; param; param = param->next) {
+        info->param_count++;
+    }
+    return info;
+}
+
+#ifdef JS_PARSER_VALIDATE
+// 只验证语法：修饰符与参数个数检查完就丢掉，不构造节点
+static ASTList *make_single_param_list(ASTNode *param) {
+    (void)param;
+    return NULL;
+}
+
+static ASTNode *build_method_node(MethodInfo *info) {
+    method_info_free(info);
+    return NULL;
+}
+#else
+static ASTList *make_single_param_list(ASTNode *param) {
+    ASTList *list = NULL;
+    return ast_list_append(list, param);
+}
+
+static ASTNode *build_method_node(MethodInfo *info) {
+    ASTNode *func = ast_make_function_expr(info->name, info->params, info->body);
+    if (info->is_generator && func) {
+        func->data.function_expr.is_generator = true;
+    }
+    if (info->is_async && func) {
+        func->data.function_expr.is_async = true;
+    }
+    ASTNode *method = ast_make_method_def(info->name,
+                                          info->computed_key,
+                                          info->computed,
+                                          info->is_static,
+                                          info->is_generator,
+                                          info->is_async,
+                                          info->kind,
+                                          func);
+    free(info);
+    return method;
+}
+#endif
+
+// 字符串属性键去掉引号；键是 atom，不能原地修改，去引号后的文本另行驻留
+static const char *unquote_property_key(JSParser *ctx, const char *key) {
+    size_t len = key ? strlen(key) : 0;
+    if (len >= 2 && (key[0] == '\'' || key[0] == '"')) {
+        return atom_intern(ctx->atoms, key + 1, len - 2);
+    }
+    return key;
+}
+
+// 名字都是 atom，与预置 atom 比较指针即可
+static bool identifier_is(const char *name, const char *atom) {
+    return name && name == atom;
+}
+
+static MethodInfo *mark_method_static(JSParser *ctx, MethodInfo *method) {
+    if (method->kind == AST_METHOD_KIND_CONSTRUCTOR) {
+        yyerror(ctx, "Class constructor cannot be static");
+        method_info_free(method);
+        return NULL;
+    }
+    method->is_static = true;
+    return method;
+}
+
+static MethodInfo *maybe_tag_constructor(JSParser *ctx, MethodInfo *method) {
+    if (!method->computed &&
+        method->name &&
+        identifier_is(method->name, ATOM(ctx->atoms, CONSTRUCTOR)) &&
+        !method->is_static) {
+        method->kind = AST_METHOD_KIND_CONSTRUCTOR;
+    }
+    return method;
+}
+
+static MethodInfo *apply_accessor_keyword(JSParser *ctx, MethodInfo *method, const char *keyword) {
+    ASTMethodKind kind;
+    if (identifier_is(keyword, ATOM(ctx->atoms, GET))) {
+        kind = AST_METHOD_KIND_GET;
+    } else if (identifier_is(keyword, ATOM(ctx->atoms, SET))) {
+        kind = AST_METHOD_KIND_SET;
+    } else {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(method);
+        return NULL;
+    }
+    if (kind == AST_METHOD_KIND_GET && method->param_count != 0) {
+        yyerror(ctx, "Getter must not have parameters");
+        method_info_free(method);
+        return NULL;
+    }
+    if (kind == AST_METHOD_KIND_SET && method->param_count != 1) {
+        yyerror(ctx, "Setter must have exactly one parameter");
+        method_info_free(method);
+        return NULL;
+    }
+    method->kind = kind;
+    return method;
+}
+
+static MethodInfo *handle_single_prefix(JSParser *ctx, const char *prefix, MethodInfo *method) {
+    MethodInfo *result = maybe_tag_constructor(ctx, method);
+    if (identifier_is(prefix, ATOM(ctx->atoms, STATIC))) {
+        result = mark_method_static(ctx, result);
+    } else if (identifier_is(prefix, ATOM(ctx->atoms, GET)) || identifier_is(prefix, ATOM(ctx->atoms, SET))) {
+        result = apply_accessor_keyword(ctx, result, prefix);
+    } else {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        result = NULL;
+    }
+    return result;
+}
+
+static MethodInfo *handle_double_prefix(JSParser *ctx, const char *first, const char *second, MethodInfo *method) {
+    MethodInfo *result = maybe_tag_constructor(ctx, method);
+    if (!identifier_is(first, ATOM(ctx->atoms, STATIC))) {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        return NULL;
+    }
+    result = mark_method_static(ctx, result);
+    if (!result) {
+        return NULL;
+    }
+    if (!(identifier_is(second, ATOM(ctx->atoms, GET)) || identifier_is(second, ATOM(ctx->atoms, SET)))) {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        return NULL;
+    }
+    return apply_accessor_keyword(ctx, result, second);
+}
+%}
+
+%code provides {
+    int yylex(YYSTYPE *lvalp, JSParser *ctx);
+    void yyerror(JSParser *ctx, const char *s);
+}
+
+%code requires {
+    #include "ast.h"
+    #include "postfix_suffix.h"
+    #include "binary_chain.h"
+    #ifndef JS_PARSER_DEFINED
+    #define JS_PARSER_DEFINED
+    typedef struct JSParser JSParser;
+    #endif
+    #ifndef JS_METHOD_INFO_DEFINED
+    #define JS_METHOD_INFO_DEFINED
+    typedef struct MethodInfo MethodInfo;
+    #endif
+}
+
+%union {
+    ASTNode *node;
+    ASTList *list;
+    char *str;          // 自有字符串（字符串/数字字面量等），丢弃时 free
+    const char *atom;   // 名字（标识符、属性名），驻留表持有
+    int boolean;
+    PostfixSuffix *suffix;
+    BinaryChain *chain;
+    const BinaryOperator *binop;
+    MethodInfo *method;
+    size_t count;       // 只验证语法时参数表只记个数
+}
+
+
+// 终结符及其编码由 src/tokens.def 生成（构建时 gen_tokens 替换下一行），
+// 单字符运算符不单独声明，文法中直接写字符字面量
+// 以下 %token 由 gen_tokens 按 src/tokens.def 生成，请勿手改
+%token VAR 258
+%token LET 259
+%token CONST 260
+%token FUNCTION 261
+%token FUNCTION_DECL 262
+%token IF 263
+%token ELSE 264
+%token FOR 265
+%token RETURN 266
+%token ASYNC 267
+%token AWAIT 268
+%token IMPORT 269
+%token EXPORT 270
+%token WHILE 271
+%token DO 272
+%token BREAK 273
+%token CONTINUE 274
+%token SWITCH 275
+%token CASE 276
+%token DEFAULT 277
+%token TRY 278
+%token CATCH 279
+%token FINALLY 280
+%token THROW 281
+%token NEW 282
+%token THIS 283
+%token TYPEOF 284
+%token DELETE 285
+%token IN 286
+%token INSTANCEOF 287
+%token VOID 288
+%token WITH 289
+%token DEBUGGER 290
+%token CLASS 291
+%token EXTENDS 292
+%token SUPER 293
+%token YIELD 294
+%token TRUE 295
+%token FALSE 296
+%token NULL_T 297
+%token UNDEFINED 298
+%token <atom> IDENTIFIER 299
+%token <atom> NUMBER 300
+%token <str> STRING 301
+%token <str> REGEX 302
+%token <str> TEMPLATE_NO_SUB 303
+%token <str> TEMPLATE_HEAD 304
+%token <str> TEMPLATE_MIDDLE 305
+%token <str> TEMPLATE_TAIL 306
+%token PLUS_PLUS 307
+%token MINUS_MINUS 308
+%token EQ 309
+%token NE 310
+%token EQ_STRICT 311
+%token NE_STRICT 312
+%token LE 313
+%token GE 314
+%token AND 315
+%token OR 316
+%token LSHIFT 317
+%token RSHIFT 318
+%token URSHIFT 319
+%token PLUS_ASSIGN 320
+%token MINUS_ASSIGN 321
+%token STAR_ASSIGN 322
+%token SLASH_ASSIGN 323
+%token PERCENT_ASSIGN 324
+%token AND_ASSIGN 325
+%token OR_ASSIGN 326
+%token XOR_ASSIGN 327
+%token LSHIFT_ASSIGN 328
+%token RSHIFT_ASSIGN 329
+%token URSHIFT_ASSIGN 330
+%token ARROW 331
+%token ELLIPSIS 332
+%token ARROW_HEAD 333
+
+%define api.push-pull push
+%define api.prefix {jsfast_}
+%define lr.default-reduction consistent
+%parse-param {JSParser *ctx}
+%destructor { ast_free($$); } <node>
+%destructor { ast_list_free($$); } <list>
+%destructor { discard_suffix_chain($$); } <suffix>
+%destructor { discard_binary_chain($$); } <chain>
+%define api.pure
+%define parse.error verbose
+%define parse.trace true
+%debug
+%right '=' PLUS_ASSIGN MINUS_ASSIGN STAR_ASSIGN SLASH_ASSIGN PERCENT_ASSIGN AND_ASSIGN OR_ASSIGN XOR_ASSIGN LSHIFT_ASSIGN RSHIFT_ASSIGN URSHIFT_ASSIGN
+%right '?' ':'
+%left OR
+%left AND
+%left '|'
+%left '^'
+%left '&'
+%left EQ NE EQ_STRICT NE_STRICT
+%left '<' '>' LE GE INSTANCEOF IN
+%left LSHIFT RSHIFT URSHIFT
+%left '+' '-'
+%left '*' '/' '%'
+%right NEW
+%right UMINUS '!' '~' TYPEOF DELETE VOID PLUS_PLUS MINUS_MINUS
+%nonassoc IF_NO_ELSE
+%nonassoc ELSE
+
+%type <node> program module_item stmt block var_stmt var_stmt_no_in return_stmt if_stmt for_stmt while_stmt do_stmt switch_stmt try_stmt with_stmt labeled_stmt break_stmt continue_stmt throw_stmt func_decl for_init for_in_left opt_expr catch_clause finally_clause finally_clause_opt switch_case var_decl var_decl_no_in class_decl class_expr class_element getter_definition setter_definition computed_property class_heritage_opt import_stmt export_stmt import_default_binding namespace_import import_specifier module_specifier export_specifier
+%type <node> expr expr_no_obj expr_no_in_no_obj assignment_expr assignment_expr_no_in assignment_expr_no_obj assignment_expr_no_in_no_obj conditional_expr conditional_expr_no_in conditional_expr_no_obj conditional_expr_no_in_no_obj binary_expr binary_expr_no_in binary_expr_no_obj binary_expr_no_in_no_obj unary_expr unary_expr_no_obj postfix_expr postfix_expr_no_obj left_hand_side_expr left_hand_side_expr_no_obj call_expr call_expr_no_obj member_expr member_expr_no_obj new_expr new_expr_no_obj primary_expr primary_expr_no_obj function_expr template_literal
+%type <node> yield_expr spread_element el_item arg_item
+%type <node> binding_element binding_initializer_opt binding_initializer_opt_no_in object_binding array_binding binding_property binding_rest_property binding_rest_element assignment_pattern object_assignment_pattern array_assignment_pattern assignment_property assignment_element assignment_rest_element assignment_target for_binding for_binding_declarator catch_parameter rest_param
+%type <node> arrow_function arrow_body
+%type <node> array_literal object_literal prop
+%type <method> method_name method_head method_definition
+
+%type <atom> property_name property_name_keyword
+%type <atom> for_of_keyword from_keyword as_keyword
+
+%type <chain> binary_chain binary_chain_no_in binary_chain_no_obj binary_chain_no_in_no_obj
+%type <binop> binary_operator binary_operator_no_in
+%type <suffix> member_suffix_seq member_noncall_suffix call_suffix_seq call_any_suffix call_suffix_initial
+
+
+%type <list> stmt_list module_item_list opt_param_list param_list param_list_items opt_arg_list arg_list prop_list switch_case_list case_stmt_seq var_decl_list var_decl_list_no_in binding_property_list binding_property_sequence binding_element_list binding_elision binding_elision_opt assignment_property_list assignment_property_sequence assignment_element_list class_body class_element_list class_element_list_opt import_clause named_imports import_specifier_list export_clause export_specifier_list
+%type <list> elision elision_opt element_list
+%type <node> template_part_list
+%type <boolean> generator_marker_opt async_modifier_opt
+
+%destructor { if ($$) free($$); } <str>
+%destructor { method_info_free($$); } <method>
+
+%%
+
+program
+  : module_item_list
+      {
+          if (ctx->statement_mode) {
+              // 分段解析到了输入末尾：交给驱动拼接
+              ctx->statement_items = $1;
+              ctx->statement_lookahead = false;
+              $$ = NULL;
+          } else {
+              $$ = ast_make_program($1);
+              ctx->ast_root = $$;
+          }
+      }
+  ;
+
+module_item_list
+  : /* empty */
+      { $$ = NULL; }
+  | module_item_list module_item
+      {
+          $$ = ast_list_append($1, $2);
+          END_STATEMENT_SEGMENT($$);
+      }
+  ;
+
+module_item
+  : stmt
+      { $$ = $1; }
+  | import_stmt
+      { $$ = $1; }
+  | export_stmt
+      { $$ = $1; }
+  ;
+
+stmt_list
+  : /* empty */
+      { $$ = NULL; }
+  | stmt_list stmt
+      { $$ = ast_list_append($1, $2); }
+  ;
+
+stmt
+  : ';'
+      { $$ = ast_make_empty_statement(); }
+  | var_stmt ';'
+      { $$ = $1; }
+  | expr_no_obj ';'
+      { $$ = ast_make_expression_stmt($1); }
+  | block
+      { $$ = $1; }
+  | if_stmt
+      { $$ = $1; }
+  | for_stmt
+      { $$ = $1; }
+  | while_stmt
+      { $$ = $1; }
+  | do_stmt
+      { $$ = $1; }
+  | switch_stmt
+      { $$ = $1; }
+  | try_stmt
+      { $$ = $1; }
+  | with_stmt
+      { $$ = $1; }
+  | func_decl
+      { $$ = $1; }
+  | class_decl
+      { $$ = $1; }
+  | return_stmt ';'
+      { $$ = $1; }
+  | break_stmt ';'
+      { $$ = $1; }
+  | continue_stmt ';'
+      { $$ = $1; }
+  | throw_stmt ';'
+      { $$ = $1; }
+  | labeled_stmt
+      { $$ = $1; }
+  ;
+
+import_stmt
+    : IMPORT import_clause from_keyword module_specifier ';'
+      { $$ = ast_make_import_decl($2, $4); }
+    | IMPORT module_specifier ';'
+      { $$ = ast_make_import_decl(NULL, $2); }
+  ;
+
+import_clause
+  : import_default_binding
+      { $$ = ast_list_append(NULL, $1); }
+  | namespace_import
+      { $$ = ast_list_append(NULL, $1); }
+  | named_imports
+      { $$ = $1; }
+  | import_default_binding ',' namespace_import
+      { ASTList *list = ast_list_append(NULL, $1); $$ = ast_list_append(list, $3); }
+  | import_default_binding ',' named_imports
+      { ASTList *list = ast_list_append(NULL, $1); $$ = ast_list_concat(list, $3); }
+  ;
+
+named_imports
+    : '{' '}'
+            { $$ = NULL; }
+    | '{' import_specifier_list opt_trailing_comma '}'
+            { $$ = $2; }
+    ;
+
+import_specifier_list
+  : import_specifier
+      { $$ = ast_list_append(NULL, $1); }
+  | import_specifier_list ',' import_specifier
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+import_specifier
+  : IDENTIFIER
+      { $$ = ast_make_import_specifier($1, $1, false, false); }
+  | IDENTIFIER as_keyword IDENTIFIER
+      { $$ = ast_make_import_specifier($3, $1, false, false); }
+  | DEFAULT as_keyword IDENTIFIER
+      { $$ = ast_make_import_specifier($3, ATOM(ctx->atoms, DEFAULT), false, false); }
+  ;
+
+import_default_binding
+  : IDENTIFIER
+      { $$ = ast_make_import_specifier($1, ATOM(ctx->atoms, DEFAULT), false, true); }
+  ;
+
+namespace_import
+  : '*' as_keyword IDENTIFIER
+      { $$ = ast_make_import_specifier($3, NULL, true, false); }
+  ;
+
+module_specifier
+  : STRING
+      { $$ = ast_make_string_literal($1); }
+  ;
+
+export_stmt
+  : EXPORT export_clause from_keyword module_specifier ';'
+      { $$ = ast_make_export_decl(false, false, NULL, NULL, $2, $4); }
+  | EXPORT export_clause ';'
+      { $$ = ast_make_export_decl(false, false, NULL, NULL, $2, NULL); }
+  | EXPORT '*' from_keyword module_specifier ';'
+      { $$ = ast_make_export_decl(false, true, NULL, NULL, NULL, $4); }
+  | EXPORT '*' as_keyword IDENTIFIER from_keyword module_specifier ';'
+      { $$ = ast_make_export_decl(false, true, $4, NULL, NULL, $6); }
+  | EXPORT var_stmt ';'
+      { $$ = ast_make_export_decl(false, false, NULL, $2, NULL, NULL); }
+  | EXPORT func_decl
+      { $$ = ast_make_export_decl(false, false, NULL, $2, NULL, NULL); }
+  | EXPORT class_decl
+      { $$ = ast_make_export_decl(false, false, NULL, $2, NULL, NULL); }
+  | EXPORT DEFAULT func_decl
+      { $$ = ast_make_export_decl(true, false, NULL, $3, NULL, NULL); }
+  | EXPORT DEFAULT class_decl
+      { $$ = ast_make_export_decl(true, false, NULL, $3, NULL, NULL); }
+    | EXPORT DEFAULT assignment_expr_no_obj ';'
+      { $$ = ast_make_export_decl(true, false, NULL, $3, NULL, NULL); }
+  ;
+
+export_clause
+    : '{' '}'
+            { $$ = NULL; }
+    | '{' export_specifier_list opt_trailing_comma '}'
+            { $$ = $2; }
+    ;
+
+export_specifier_list
+  : export_specifier
+      { $$ = ast_list_append(NULL, $1); }
+  | export_specifier_list ',' export_specifier
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+export_specifier
+  : IDENTIFIER
+      { $$ = ast_make_export_specifier($1, NULL, false); }
+  | IDENTIFIER as_keyword IDENTIFIER
+      { $$ = ast_make_export_specifier($1, $3, false); }
+  | IDENTIFIER as_keyword DEFAULT
+      { $$ = ast_make_export_specifier($1, ATOM(ctx->atoms, DEFAULT), false); }
+  | DEFAULT as_keyword IDENTIFIER
+      { $$ = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), $3, false); }
+  | DEFAULT as_keyword DEFAULT
+      { $$ = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), ATOM(ctx->atoms, DEFAULT), false); }
+  | DEFAULT
+      { $$ = ast_make_export_specifier(ATOM(ctx->atoms, DEFAULT), NULL, false); }
+  ;
+
+from_keyword
+  : IDENTIFIER
+      {
+          if (!identifier_is($1, ATOM(ctx->atoms, FROM))) {
+              yyerror(ctx, "Expected 'from' in module statement");
+              YYERROR;
+          }
+          $$ = NULL;
+      }
+  ;
+
+as_keyword
+  : IDENTIFIER
+      {
+          if (!identifier_is($1, ATOM(ctx->atoms, AS))) {
+              yyerror(ctx, "Expected 'as' in module statement");
+              YYERROR;
+          }
+          $$ = NULL;
+      }
+  ;
+
+block
+    : '{' stmt_list '}'
+            { $$ = ast_make_block($2); }
+    ;
+
+var_stmt
+  : VAR var_decl_list
+      { $$ = ast_make_var_stmt(AST_VAR_KIND_VAR, $2); }
+  | LET var_decl_list
+      { $$ = ast_make_var_stmt(AST_VAR_KIND_LET, $2); }
+  | CONST var_decl_list
+      { $$ = ast_make_var_stmt(AST_VAR_KIND_CONST, $2); }
+  ;
+
+var_stmt_no_in
+  : VAR var_decl_list_no_in
+      { $$ = ast_make_var_stmt(AST_VAR_KIND_VAR, $2); }
+  | LET var_decl_list_no_in
+      { $$ = ast_make_var_stmt(AST_VAR_KIND_LET, $2); }
+  | CONST var_decl_list_no_in
+      { $$ = ast_make_var_stmt(AST_VAR_KIND_CONST, $2); }
+  ;
+
+var_decl_list
+  : var_decl
+      { $$ = ast_list_append(NULL, $1); }
+  | var_decl_list ',' var_decl
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+var_decl_list_no_in
+  : var_decl_no_in
+      { $$ = ast_list_append(NULL, $1); }
+  | var_decl_list_no_in ',' var_decl_no_in
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+var_decl
+  : IDENTIFIER binding_initializer_opt
+      { $$ = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier($1), $2)); }
+  | object_binding '=' assignment_expr
+      { $$ = ast_make_var_decl(ast_make_binding_pattern($1, $3)); }
+  | array_binding '=' assignment_expr
+      { $$ = ast_make_var_decl(ast_make_binding_pattern($1, $3)); }
+  ;
+
+var_decl_no_in
+  : IDENTIFIER binding_initializer_opt_no_in
+      { $$ = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier($1), $2)); }
+  | object_binding '=' assignment_expr_no_in
+      { $$ = ast_make_var_decl(ast_make_binding_pattern($1, $3)); }
+  | array_binding '=' assignment_expr_no_in
+      { $$ = ast_make_var_decl(ast_make_binding_pattern($1, $3)); }
+  ;
+
+return_stmt
+  : RETURN
+      { $$ = ast_make_return(NULL); }
+  | RETURN expr
+      { $$ = ast_make_return($2); }
+  ;
+
+if_stmt
+    : IF '(' expr ')' stmt %prec IF_NO_ELSE
+            { $$ = ast_make_if($3, $5, NULL); }
+  | IF '(' expr ')' stmt ELSE stmt
+      { $$ = ast_make_if($3, $5, $7); }
+  ;
+
+for_stmt
+  : FOR '(' for_init ';' opt_expr ';' opt_expr ')' stmt
+      { $$ = ast_make_for($3, $5, $7, $9); }
+  | FOR '(' for_in_left IN expr ')' stmt
+      { $$ = ast_make_for_in($3, $5, $7); }
+  | FOR '(' for_in_left for_of_keyword expr ')' stmt
+    { $$ = ast_make_for_of($3, $5, $7, false); }
+    | FOR AWAIT '(' for_in_left for_of_keyword expr ')' stmt
+        { $$ = ast_make_for_of($4, $6, $8, true); }
+  ;
+
+while_stmt
+    : WHILE '(' expr ')' stmt
+            { $$ = ast_make_while($3, $5); }
+    ;
+
+do_stmt
+    : DO stmt WHILE '(' expr ')' ';'
+        { $$ = ast_make_do_while($2, $5); }
+    ;
+
+for_init
+  : /* empty */
+      { $$ = NULL; }
+    | var_stmt_no_in
+      { $$ = $1; }
+    | expr_no_in_no_obj
+      { $$ = $1; }
+  ;
+
+for_in_left
+  : for_binding
+      { $$ = $1; }
+  | assignment_pattern
+      { $$ = $1; }
+  | left_hand_side_expr_no_obj
+      { $$ = $1; }
+  ;
+
+for_of_keyword
+  : IDENTIFIER
+      {
+          if (!identifier_is($1, ATOM(ctx->atoms, OF))) {
+              yyerror(ctx, "Expected 'of' in for-of statement");
+              YYERROR;
+          }
+          $$ = NULL;
+      }
+  ;
+
+opt_expr
+  : /* empty */
+      { $$ = NULL; }
+  | expr
+      { $$ = $1; }
+  ;
+
+switch_stmt
+    : SWITCH '(' expr ')' '{' switch_case_list '}'
+            { $$ = ast_make_switch($3, $6); }
+    ;
+
+switch_case_list
+    : /* empty */
+            { $$ = NULL; }
+    | switch_case_list switch_case
+            { $$ = ast_list_append($1, $2); }
+    ;
+
+switch_case
+    : CASE expr ':' case_stmt_seq
+            { $$ = ast_make_switch_case($2, $4); }
+    | DEFAULT ':' case_stmt_seq
+            { $$ = ast_make_switch_default($3); }
+    ;
+
+case_stmt_seq
+    : /* empty */
+            { $$ = NULL; }
+    | case_stmt_seq stmt
+            { $$ = ast_list_append($1, $2); }
+    ;
+
+generator_marker_opt
+  : '*'
+      { $$ = 1; }
+  | /* empty */
+      { $$ = 0; }
+  ;
+
+async_modifier_opt
+  : ASYNC
+      { $$ = 1; }
+  | /* empty */
+      { $$ = 0; }
+  ;
+
+func_decl
+    : async_modifier_opt FUNCTION_DECL generator_marker_opt IDENTIFIER '(' opt_param_list ')' block
+      {
+          $$ = ast_make_function_decl($4, $6, $8);
+          if ($3 && $$) {
+              $$->data.function_decl.is_generator = true;
+          }
+          if ($1 && $$) {
+              $$->data.function_decl.is_async = true;
+          }
+      }
+    | async_modifier_opt FUNCTION_DECL generator_marker_opt '(' opt_param_list ')' block
+      {
+          $$ = ast_make_function_decl(NULL, $5, $7);
+          if ($3 && $$) {
+              $$->data.function_decl.is_generator = true;
+          }
+          if ($1 && $$) {
+              $$->data.function_decl.is_async = true;
+          }
+      }
+  ;
+
+// 只验证语法时参数表只数个数，类中 get/set 方法的参数个数检查要用
+opt_param_list
+  : /* empty */
+      { $$ = NULL; }
+  | param_list
+      { $$ = $1; }
+  ;
+
+param_list
+  : param_list_items
+      { $$ = $1; }
+  | param_list_items ',' rest_param
+      { $$ = ast_list_append($1, $3); }
+  | rest_param
+      { $$ = ast_list_append(NULL, $1); }
+  ;
+
+param_list_items
+  : binding_element
+      { $$ = ast_list_append(NULL, $1); }
+  | param_list_items ',' binding_element
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+rest_param
+  : binding_rest_element
+      { $$ = $1; }
+  ;
+
+catch_clause
+    : CATCH '(' catch_parameter ')' block
+        { $$ = ast_make_catch($3, $5); }
+    ;
+
+catch_parameter
+    : IDENTIFIER
+        { $$ = ast_make_binding_pattern(ast_make_identifier($1), NULL); }
+    | object_binding
+        { $$ = ast_make_binding_pattern($1, NULL); }
+    | array_binding
+        { $$ = ast_make_binding_pattern($1, NULL); }
+    ;
+
+finally_clause
+    : FINALLY block
+            { $$ = $2; }
+    ;
+
+finally_clause_opt
+    : /* empty */
+            { $$ = NULL; }
+    | finally_clause
+            { $$ = $1; }
+    ;
+
+try_stmt
+    : TRY block catch_clause finally_clause_opt
+            { $$ = ast_make_try($2, $3, $4); }
+    | TRY block finally_clause
+            { $$ = ast_make_try($2, NULL, $3); }
+    ;
+
+with_stmt
+    : WITH '(' expr ')' stmt
+            { $$ = ast_make_with($3, $5); }
+    ;
+
+labeled_stmt
+    : IDENTIFIER ':' stmt
+            { $$ = ast_make_labeled($1, $3); }
+    ;
+
+break_stmt
+    : BREAK
+            { $$ = ast_make_break(NULL); }
+    | BREAK IDENTIFIER
+            { $$ = ast_make_break($2); }
+    ;
+
+continue_stmt
+    : CONTINUE
+            { $$ = ast_make_continue(NULL); }
+    | CONTINUE IDENTIFIER
+            { $$ = ast_make_continue($2); }
+    ;
+
+throw_stmt
+    : THROW expr
+            { $$ = ast_make_throw($2); }
+    ;
+
+// 表达式的限制变体由 gen_grammar 按参数生成：
+//   NoIn  —— for (init; ...) 的初始化部分，顶层不能出现 in 运算符
+//   NoObj —— 表达式语句、箭头函数体等位置，不能以 { 开头（否则与语句块冲突）
+// 赋值左侧与右值共用同一个 postfix_expr，读到 '=' 之前不必决定走哪条路
+expr
+  : assignment_expr
+      { $$ = $1; }
+  | expr ',' assignment_expr
+            { $$ = ast_make_sequence($1, $3); }
+  ;
+
+expr_no_obj
+  : assignment_expr_no_obj
+      { $$ = $1; }
+  | expr_no_obj ',' assignment_expr
+            { $$ = ast_make_sequence($1, $3); }
+  ;
+
+expr_no_in_no_obj
+  : assignment_expr_no_in_no_obj
+      { $$ = $1; }
+  | expr_no_in_no_obj ',' assignment_expr_no_in
+            { $$ = ast_make_sequence($1, $3); }
+  ;
+
+assignment_expr
+	: postfix_expr '=' assignment_expr
+	    {
+	        ASTNode *lhs = convert_assignment_target($1, true);
+	        if (!lhs) {
+	            lhs = $1;
+	        }
+	        $$ = ast_make_assignment("=", wrap_destructuring_target(lhs), $3);
+	    }
+  | postfix_expr PLUS_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("+=", $1, $3); }
+  | postfix_expr MINUS_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("-=", $1, $3); }
+  | postfix_expr STAR_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("*=", $1, $3); }
+  | postfix_expr SLASH_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("/=", $1, $3); }
+  | postfix_expr PERCENT_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("%=", $1, $3); }
+  | postfix_expr AND_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("&=", $1, $3); }
+  | postfix_expr OR_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("|=", $1, $3); }
+  | postfix_expr XOR_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("^=", $1, $3); }
+  | postfix_expr LSHIFT_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("<<=", $1, $3); }
+  | postfix_expr RSHIFT_ASSIGN assignment_expr
+      { $$ = ast_make_assignment(">>=", $1, $3); }
+  | postfix_expr URSHIFT_ASSIGN assignment_expr
+      { $$ = ast_make_assignment(">>>=", $1, $3); }
+  | arrow_function
+      { $$ = $1; }
+    | conditional_expr
+      { $$ = $1; }
+    | yield_expr
+            { $$ = $1; }
+  ;
+
+assignment_expr_no_in
+	: postfix_expr '=' assignment_expr_no_in
+	    {
+	        ASTNode *lhs = convert_assignment_target($1, true);
+	        if (!lhs) {
+	            lhs = $1;
+	        }
+	        $$ = ast_make_assignment("=", wrap_destructuring_target(lhs), $3);
+	    }
+  | postfix_expr PLUS_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("+=", $1, $3); }
+  | postfix_expr MINUS_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("-=", $1, $3); }
+  | postfix_expr STAR_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("*=", $1, $3); }
+  | postfix_expr SLASH_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("/=", $1, $3); }
+  | postfix_expr PERCENT_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("%=", $1, $3); }
+  | postfix_expr AND_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("&=", $1, $3); }
+  | postfix_expr OR_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("|=", $1, $3); }
+  | postfix_expr XOR_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("^=", $1, $3); }
+  | postfix_expr LSHIFT_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("<<=", $1, $3); }
+  | postfix_expr RSHIFT_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment(">>=", $1, $3); }
+  | postfix_expr URSHIFT_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment(">>>=", $1, $3); }
+  | arrow_function
+      { $$ = $1; }
+    | conditional_expr_no_in
+      { $$ = $1; }
+    | yield_expr
+            { $$ = $1; }
+  ;
+
+assignment_expr_no_obj
+	: postfix_expr_no_obj '=' assignment_expr
+	    {
+	        ASTNode *lhs = convert_assignment_target($1, true);
+	        if (!lhs) {
+	            lhs = $1;
+	        }
+	        $$ = ast_make_assignment("=", wrap_destructuring_target(lhs), $3);
+	    }
+  | postfix_expr_no_obj PLUS_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("+=", $1, $3); }
+  | postfix_expr_no_obj MINUS_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("-=", $1, $3); }
+  | postfix_expr_no_obj STAR_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("*=", $1, $3); }
+  | postfix_expr_no_obj SLASH_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("/=", $1, $3); }
+  | postfix_expr_no_obj PERCENT_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("%=", $1, $3); }
+  | postfix_expr_no_obj AND_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("&=", $1, $3); }
+  | postfix_expr_no_obj OR_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("|=", $1, $3); }
+  | postfix_expr_no_obj XOR_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("^=", $1, $3); }
+  | postfix_expr_no_obj LSHIFT_ASSIGN assignment_expr
+      { $$ = ast_make_assignment("<<=", $1, $3); }
+  | postfix_expr_no_obj RSHIFT_ASSIGN assignment_expr
+      { $$ = ast_make_assignment(">>=", $1, $3); }
+  | postfix_expr_no_obj URSHIFT_ASSIGN assignment_expr
+      { $$ = ast_make_assignment(">>>=", $1, $3); }
+  | arrow_function
+      { $$ = $1; }
+    | conditional_expr_no_obj
+      { $$ = $1; }
+    | yield_expr
+            { $$ = $1; }
+  ;
+
+assignment_expr_no_in_no_obj
+	: postfix_expr_no_obj '=' assignment_expr_no_in
+	    {
+	        ASTNode *lhs = convert_assignment_target($1, true);
+	        if (!lhs) {
+	            lhs = $1;
+	        }
+	        $$ = ast_make_assignment("=", wrap_destructuring_target(lhs), $3);
+	    }
+  | postfix_expr_no_obj PLUS_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("+=", $1, $3); }
+  | postfix_expr_no_obj MINUS_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("-=", $1, $3); }
+  | postfix_expr_no_obj STAR_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("*=", $1, $3); }
+  | postfix_expr_no_obj SLASH_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("/=", $1, $3); }
+  | postfix_expr_no_obj PERCENT_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("%=", $1, $3); }
+  | postfix_expr_no_obj AND_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("&=", $1, $3); }
+  | postfix_expr_no_obj OR_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("|=", $1, $3); }
+  | postfix_expr_no_obj XOR_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("^=", $1, $3); }
+  | postfix_expr_no_obj LSHIFT_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment("<<=", $1, $3); }
+  | postfix_expr_no_obj RSHIFT_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment(">>=", $1, $3); }
+  | postfix_expr_no_obj URSHIFT_ASSIGN assignment_expr_no_in
+      { $$ = ast_make_assignment(">>>=", $1, $3); }
+  | arrow_function
+      { $$ = $1; }
+    | conditional_expr_no_in_no_obj
+      { $$ = $1; }
+    | yield_expr
+            { $$ = $1; }
+  ;
+
+conditional_expr
+    : binary_expr
+        { $$ = $1; }
+    | binary_expr '?' assignment_expr ':' assignment_expr
+        { $$ = ast_make_conditional($1, $3, $5); }
+    ;
+
+conditional_expr_no_in
+    : binary_expr_no_in
+        { $$ = $1; }
+    | binary_expr_no_in '?' assignment_expr ':' assignment_expr
+        { $$ = ast_make_conditional($1, $3, $5); }
+    ;
+
+conditional_expr_no_obj
+    : binary_expr_no_obj
+        { $$ = $1; }
+    | binary_expr_no_obj '?' assignment_expr ':' assignment_expr
+        { $$ = ast_make_conditional($1, $3, $5); }
+    ;
+
+conditional_expr_no_in_no_obj
+    : binary_expr_no_in_no_obj
+        { $$ = $1; }
+    | binary_expr_no_in_no_obj '?' assignment_expr ':' assignment_expr
+        { $$ = ast_make_conditional($1, $3, $5); }
+    ;
+
+// 二元表达式不按优先级逐级展开：文法只收集“操作数 运算符 操作数 ...”，
+// 由 fold_binary_chain 按优先级结合（单个操作数直接归约，不经过任何中间层）。
+// NoIn 只是运算符集合去掉 in；NoObj 只限制第一个操作数不能以 { 开头
+binary_expr
+    : unary_expr
+        { $$ = $1; }
+    | binary_chain
+        { $$ = fold_binary_chain($1); }
+    ;
+
+binary_expr_no_in
+    : unary_expr
+        { $$ = $1; }
+    | binary_chain_no_in
+        { $$ = fold_binary_chain($1); }
+    ;
+
+binary_expr_no_obj
+    : unary_expr_no_obj
+        { $$ = $1; }
+    | binary_chain_no_obj
+        { $$ = fold_binary_chain($1); }
+    ;
+
+binary_expr_no_in_no_obj
+    : unary_expr_no_obj
+        { $$ = $1; }
+    | binary_chain_no_in_no_obj
+        { $$ = fold_binary_chain($1); }
+    ;
+
+binary_chain
+    : unary_expr binary_operator unary_expr
+        { $$ = binary_chain_append(binary_chain_append(NULL, NULL, $1), $2, $3); }
+    | binary_chain binary_operator unary_expr
+        { $$ = binary_chain_append($1, $2, $3); }
+    ;
+
+binary_chain_no_in
+    : unary_expr binary_operator_no_in unary_expr
+        { $$ = binary_chain_append(binary_chain_append(NULL, NULL, $1), $2, $3); }
+    | binary_chain_no_in binary_operator_no_in unary_expr
+        { $$ = binary_chain_append($1, $2, $3); }
+    ;
+
+binary_chain_no_obj
+    : unary_expr_no_obj binary_operator unary_expr
+        { $$ = binary_chain_append(binary_chain_append(NULL, NULL, $1), $2, $3); }
+    | binary_chain_no_obj binary_operator unary_expr
+        { $$ = binary_chain_append($1, $2, $3); }
+    ;
+
+binary_chain_no_in_no_obj
+    : unary_expr_no_obj binary_operator_no_in unary_expr
+        { $$ = binary_chain_append(binary_chain_append(NULL, NULL, $1), $2, $3); }
+    | binary_chain_no_in_no_obj binary_operator_no_in unary_expr
+        { $$ = binary_chain_append($1, $2, $3); }
+    ;
+
+binary_operator
+    : OR
+        { $$ = &binary_operators[BINOP_OR]; }
+    | AND
+        { $$ = &binary_operators[BINOP_AND]; }
+    | '|'
+        { $$ = &binary_operators[BINOP_BIT_OR]; }
+    | '^'
+        { $$ = &binary_operators[BINOP_BIT_XOR]; }
+    | '&'
+        { $$ = &binary_operators[BINOP_BIT_AND]; }
+    | EQ
+        { $$ = &binary_operators[BINOP_EQ]; }
+    | NE
+        { $$ = &binary_operators[BINOP_NE]; }
+    | EQ_STRICT
+        { $$ = &binary_operators[BINOP_EQ_STRICT]; }
+    | NE_STRICT
+        { $$ = &binary_operators[BINOP_NE_STRICT]; }
+    | '<'
+        { $$ = &binary_operators[BINOP_LT]; }
+    | '>'
+        { $$ = &binary_operators[BINOP_GT]; }
+    | LE
+        { $$ = &binary_operators[BINOP_LE]; }
+    | GE
+        { $$ = &binary_operators[BINOP_GE]; }
+    | INSTANCEOF
+        { $$ = &binary_operators[BINOP_INSTANCEOF]; }
+    | LSHIFT
+        { $$ = &binary_operators[BINOP_LSHIFT]; }
+    | RSHIFT
+        { $$ = &binary_operators[BINOP_RSHIFT]; }
+    | URSHIFT
+        { $$ = &binary_operators[BINOP_URSHIFT]; }
+    | '+'
+        { $$ = &binary_operators[BINOP_ADD]; }
+    | '-'
+        { $$ = &binary_operators[BINOP_SUB]; }
+    | '*'
+        { $$ = &binary_operators[BINOP_MUL]; }
+    | '*' '*'
+        { $$ = &binary_operators[BINOP_EXP]; }
+    | '/'
+        { $$ = &binary_operators[BINOP_DIV]; }
+    | '%'
+        { $$ = &binary_operators[BINOP_MOD]; }
+    | IN
+        { $$ = &binary_operators[BINOP_IN]; }
+    ;
+
+binary_operator_no_in
+    : OR
+        { $$ = &binary_operators[BINOP_OR]; }
+    | AND
+        { $$ = &binary_operators[BINOP_AND]; }
+    | '|'
+        { $$ = &binary_operators[BINOP_BIT_OR]; }
+    | '^'
+        { $$ = &binary_operators[BINOP_BIT_XOR]; }
+    | '&'
+        { $$ = &binary_operators[BINOP_BIT_AND]; }
+    | EQ
+        { $$ = &binary_operators[BINOP_EQ]; }
+    | NE
+        { $$ = &binary_operators[BINOP_NE]; }
+    | EQ_STRICT
+        { $$ = &binary_operators[BINOP_EQ_STRICT]; }
+    | NE_STRICT
+        { $$ = &binary_operators[BINOP_NE_STRICT]; }
+    | '<'
+        { $$ = &binary_operators[BINOP_LT]; }
+    | '>'
+        { $$ = &binary_operators[BINOP_GT]; }
+    | LE
+        { $$ = &binary_operators[BINOP_LE]; }
+    | GE
+        { $$ = &binary_operators[BINOP_GE]; }
+    | INSTANCEOF
+        { $$ = &binary_operators[BINOP_INSTANCEOF]; }
+    | LSHIFT
+        { $$ = &binary_operators[BINOP_LSHIFT]; }
+    | RSHIFT
+        { $$ = &binary_operators[BINOP_RSHIFT]; }
+    | URSHIFT
+        { $$ = &binary_operators[BINOP_URSHIFT]; }
+    | '+'
+        { $$ = &binary_operators[BINOP_ADD]; }
+    | '-'
+        { $$ = &binary_operators[BINOP_SUB]; }
+    | '*'
+        { $$ = &binary_operators[BINOP_MUL]; }
+    | '*' '*'
+        { $$ = &binary_operators[BINOP_EXP]; }
+    | '/'
+        { $$ = &binary_operators[BINOP_DIV]; }
+    | '%'
+        { $$ = &binary_operators[BINOP_MOD]; }
+    ;
+
+// 前缀运算符之后的操作数不再受 NoObj 限制：+{} 中的 { 不可能是语句块
+unary_expr
+    : postfix_expr
+            { $$ = $1; }
+  | '+' unary_expr
+      { $$ = ast_make_unary("+", $2); }
+  | '-' unary_expr %prec UMINUS
+      { $$ = ast_make_unary("-", $2); }
+  | '!' unary_expr
+      { $$ = ast_make_unary("!", $2); }
+  | '~' unary_expr
+      { $$ = ast_make_unary("~", $2); }
+  | TYPEOF unary_expr
+      { $$ = ast_make_unary("typeof", $2); }
+  | DELETE unary_expr
+      { $$ = ast_make_unary("delete", $2); }
+  | VOID unary_expr
+      { $$ = ast_make_unary("void", $2); }
+  | AWAIT unary_expr
+      { $$ = ast_make_await($2); }
+  | PLUS_PLUS unary_expr
+      { $$ = ast_make_update("++", $2, true); }
+  | MINUS_MINUS unary_expr
+      { $$ = ast_make_update("--", $2, true); }
+  ;
+
+unary_expr_no_obj
+    : postfix_expr_no_obj
+            { $$ = $1; }
+  | '+' unary_expr
+      { $$ = ast_make_unary("+", $2); }
+  | '-' unary_expr %prec UMINUS
+      { $$ = ast_make_unary("-", $2); }
+  | '!' unary_expr
+      { $$ = ast_make_unary("!", $2); }
+  | '~' unary_expr
+      { $$ = ast_make_unary("~", $2); }
+  | TYPEOF unary_expr
+      { $$ = ast_make_unary("typeof", $2); }
+  | DELETE unary_expr
+      { $$ = ast_make_unary("delete", $2); }
+  | VOID unary_expr
+      { $$ = ast_make_unary("void", $2); }
+  | AWAIT unary_expr
+      { $$ = ast_make_await($2); }
+  | PLUS_PLUS unary_expr
+      { $$ = ast_make_update("++", $2, true); }
+  | MINUS_MINUS unary_expr
+      { $$ = ast_make_update("--", $2, true); }
+  ;
+
+postfix_expr
+  : left_hand_side_expr
+      { $$ = $1; }
+  | postfix_expr PLUS_PLUS
+      { $$ = ast_make_update("++", $1, false); }
+  | postfix_expr MINUS_MINUS
+      { $$ = ast_make_update("--", $1, false); }
+  ;
+
+postfix_expr_no_obj
+  : left_hand_side_expr_no_obj
+      { $$ = $1; }
+  | postfix_expr_no_obj PLUS_PLUS
+      { $$ = ast_make_update("++", $1, false); }
+  | postfix_expr_no_obj MINUS_MINUS
+      { $$ = ast_make_update("--", $1, false); }
+  ;
+
+left_hand_side_expr
+  : call_expr
+      { $$ = $1; }
+  | new_expr
+      { $$ = $1; }
+  ;
+
+left_hand_side_expr_no_obj
+  : call_expr_no_obj
+      { $$ = $1; }
+  | new_expr_no_obj
+      { $$ = $1; }
+  ;
+
+member_expr
+  : primary_expr member_suffix_seq
+      { $$ = apply_suffix_chain($1, $2); }
+  | NEW member_expr '(' opt_arg_list ')' member_suffix_seq
+      { $$ = apply_suffix_chain(ast_make_new_expr($2, $4), $6); }
+  ;
+
+member_expr_no_obj
+  : primary_expr_no_obj member_suffix_seq
+      { $$ = apply_suffix_chain($1, $2); }
+  | NEW member_expr '(' opt_arg_list ')' member_suffix_seq
+      { $$ = apply_suffix_chain(ast_make_new_expr($2, $4), $6); }
+  ;
+
+new_expr
+  : member_expr
+      { $$ = $1; }
+  | NEW new_expr
+      { $$ = ast_make_new_expr($2, NULL); }
+  ;
+
+new_expr_no_obj
+  : member_expr_no_obj
+      { $$ = $1; }
+  | NEW new_expr
+      { $$ = ast_make_new_expr($2, NULL); }
+  ;
+
+call_expr
+  : member_expr call_suffix_seq
+      { $$ = apply_suffix_chain($1, $2); }
+  ;
+
+call_expr_no_obj
+  : member_expr_no_obj call_suffix_seq
+      { $$ = apply_suffix_chain($1, $2); }
+  ;
+
+member_suffix_seq
+    : /* empty */
+            { $$ = NULL; }
+    | member_suffix_seq member_noncall_suffix
+            { $$ = append_suffix($1, $2); }
+    ;
+
+member_noncall_suffix
+    : '.' property_name
+            { $$ = make_suffix_prop($2); }
+    | '[' expr ']'
+            { $$ = make_suffix_computed($2); }
+    | template_literal
+            { $$ = make_suffix_template($1); }
+    ;
+
+call_suffix_seq
+    : call_suffix_seq call_any_suffix
+            { $$ = append_suffix($1, $2); }
+    | call_suffix_initial
+            { $$ = $1; }
+    ;
+
+call_any_suffix
+    : call_suffix_initial
+            { $$ = $1; }
+    | member_noncall_suffix
+            { $$ = $1; }
+    ;
+
+call_suffix_initial
+    : '(' opt_arg_list ')'
+            { $$ = make_suffix_call($2); }
+    ;
+
+opt_arg_list
+  : /* empty */
+      { $$ = NULL; }
+  | arg_list
+      { $$ = $1; }
+  ;
+
+arg_list
+  : arg_item
+      { $$ = ast_list_append(NULL, $1); }
+  | arg_list ',' arg_item
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+arg_item
+  : assignment_expr
+      { $$ = $1; }
+  | spread_element
+      { $$ = $1; }
+  ;
+
+// NoObj 去掉以 { 或 class 开头的候选：它们在语句开头分别是语句块和类声明
+primary_expr
+  : IDENTIFIER
+      { $$ = ast_make_identifier($1); }
+  | THIS
+        { $$ = ast_make_this_expr(); }
+  | NUMBER
+      { $$ = ast_make_number_literal($1); }
+  | STRING
+      { $$ = ast_make_string_literal($1); }
+  | REGEX
+      { $$ = ast_make_regex_literal($1); }
+  | TRUE
+      { $$ = ast_make_boolean_literal(true); }
+  | FALSE
+      { $$ = ast_make_boolean_literal(false); }
+  | NULL_T
+      { $$ = ast_make_null_literal(); }
+  | UNDEFINED
+      { $$ = ast_make_undefined_literal(); }
+  | '(' expr ')'
+      { $$ = $2; }
+  | array_literal
+      { $$ = $1; }
+  | object_literal
+      { $$ = $1; }
+  | template_literal
+      { $$ = $1; }
+  | class_expr
+      { $$ = $1; }
+  | SUPER
+      { $$ = ast_make_super_expr(); }
+  | function_expr
+      { $$ = $1; }
+  ;
+
+primary_expr_no_obj
+  : IDENTIFIER
+      { $$ = ast_make_identifier($1); }
+  | THIS
+        { $$ = ast_make_this_expr(); }
+  | NUMBER
+      { $$ = ast_make_number_literal($1); }
+  | STRING
+      { $$ = ast_make_string_literal($1); }
+  | REGEX
+      { $$ = ast_make_regex_literal($1); }
+  | TRUE
+      { $$ = ast_make_boolean_literal(true); }
+  | FALSE
+      { $$ = ast_make_boolean_literal(false); }
+  | NULL_T
+      { $$ = ast_make_null_literal(); }
+  | UNDEFINED
+      { $$ = ast_make_undefined_literal(); }
+  | '(' expr ')'
+      { $$ = $2; }
+  | array_literal
+      { $$ = $1; }
+  | template_literal
+      { $$ = $1; }
+  | SUPER
+      { $$ = ast_make_super_expr(); }
+  | function_expr
+      { $$ = $1; }
+  ;
+
+function_expr
+    : async_modifier_opt FUNCTION generator_marker_opt IDENTIFIER '(' opt_param_list ')' block
+      {
+          $$ = ast_make_function_expr($4, $6, $8);
+          if ($3 && $$) {
+              $$->data.function_expr.is_generator = true;
+          }
+          if ($1 && $$) {
+              $$->data.function_expr.is_async = true;
+          }
+      }
+  | async_modifier_opt FUNCTION generator_marker_opt '(' opt_param_list ')' block
+      {
+          $$ = ast_make_function_expr(NULL, $5, $7);
+          if ($3 && $$) {
+              $$->data.function_expr.is_generator = true;
+          }
+          if ($1 && $$) {
+              $$->data.function_expr.is_async = true;
+          }
+      }
+  ;
+
+class_decl
+    : CLASS IDENTIFIER class_heritage_opt class_body
+            { $$ = ast_make_class_decl($2, $3, $4); }
+    ;
+
+class_expr
+    : CLASS IDENTIFIER class_heritage_opt class_body
+            { $$ = ast_make_class_expr($2, $3, $4); }
+    | CLASS class_heritage_opt class_body
+            { $$ = ast_make_class_expr(NULL, $2, $3); }
+    ;
+
+class_heritage_opt
+    : EXTENDS assignment_expr
+            { $$ = $2; }
+    | /* empty */
+            { $$ = NULL; }
+    ;
+
+class_body
+    : '{' class_element_list_opt '}'
+            { $$ = $2; }
+    ;
+
+class_element_list_opt
+    : /* empty */
+            { $$ = NULL; }
+    | class_element_list
+            { $$ = $1; }
+    ;
+
+class_element_list
+    : class_element_list class_element
+            { $$ = $2 ? ast_list_append($1, $2) : $1; }
+    | class_element
+            { $$ = $1 ? ast_list_append(NULL, $1) : NULL; }
+    ;
+
+// 修饰符检查（static、get/set 及其参数个数）决定是否报错，只验证语法时也要执行
+class_element
+    : method_definition
+        { $$ = build_method_node(maybe_tag_constructor(ctx, $1)); }
+    | IDENTIFIER method_definition
+        {
+            MethodInfo *method = handle_single_prefix(ctx, $1, $2);
+            if (!method) {
+                YYERROR;
+            }
+            $$ = build_method_node(method);
+        }
+    | IDENTIFIER IDENTIFIER method_definition
+        {
+            MethodInfo *method = handle_double_prefix(ctx, $1, $2, $3);
+            if (!method) {
+                YYERROR;
+            }
+            $$ = build_method_node(method);
+        }
+    | ';'
+        { $$ = NULL; }
+    ;
+
+// 修饰符不写成可空的 async_modifier_opt：对象字面量里读到 { 后的标识符时，
+// 不必先决定是否归约一个空的修饰符（那会在每个属性名上分裂 GLR 栈）
+method_definition
+    : method_head '(' opt_param_list ')' block
+            { $$ = method_info_set_function($1, $3, $5); }
+    ;
+
+method_head
+    : method_name
+            { $$ = $1; }
+    | ASYNC method_name
+            {
+                $$ = $2;
+                $$->is_async = true;
+            }
+    | '*' method_name
+            {
+                $$ = $2;
+                $$->is_generator = true;
+            }
+    | ASYNC '*' method_name
+            {
+                $$ = $3;
+                $$->is_async = true;
+                $$->is_generator = true;
+            }
+    ;
+
+getter_definition
+    : IDENTIFIER method_name '(' ')' block
+            {
+                if (!identifier_is($1, ATOM(ctx->atoms, GET))) {
+                    yyerror(ctx, "Unexpected identifier before getter definition");
+                    method_info_free($2);
+                    YYERROR;
+                }
+                $2->kind = AST_METHOD_KIND_GET;
+                $$ = build_method_node(method_info_set_function($2, NULL, $5));
+            }
+    ;
+
+setter_definition
+    : IDENTIFIER method_name '(' binding_element ')' block
+            {
+                if (!identifier_is($1, ATOM(ctx->atoms, SET))) {
+                    yyerror(ctx, "Unexpected identifier before setter definition");
+                    method_info_free($2);
+                    YYERROR;
+                }
+                $2->kind = AST_METHOD_KIND_SET;
+                $$ = build_method_node(method_info_set_function($2, make_single_param_list($4), $6));
+            }
+    ;
+
+method_name
+    : property_name
+            { $$ = method_info_alloc($1, NULL, false); }
+    | '[' assignment_expr ']'
+            { $$ = method_info_alloc(NULL, $2, true); }
+    ;
+
+// arrow_body 归约出还没有参数的箭头函数节点，这里补上参数（与 async）
+arrow_function
+  : IDENTIFIER ARROW arrow_body %dprec 2
+      {
+          ASTNode *binding = ast_make_binding_pattern(ast_make_identifier($1), NULL);
+          $$ = $3;
+          $$->data.arrow_function.params = ast_list_append(NULL, binding);
+      }
+  | ARROW_HEAD '(' opt_param_list ')' ARROW arrow_body %dprec 2
+      {
+          $$ = $6;
+          $$->data.arrow_function.params = $3;
+      }
+  | ASYNC IDENTIFIER ARROW arrow_body %dprec 2
+      {
+          ASTNode *binding = ast_make_binding_pattern(ast_make_identifier($2), NULL);
+          $$ = $4;
+          $$->data.arrow_function.params = ast_list_append(NULL, binding);
+          $$->data.arrow_function.is_async = true;
+      }
+  | ASYNC ARROW_HEAD '(' opt_param_list ')' ARROW arrow_body %dprec 2
+      {
+          $$ = $7;
+          $$->data.arrow_function.params = $4;
+          $$->data.arrow_function.is_async = true;
+      }
+  ;
+
+arrow_body
+    : assignment_expr_no_obj
+      {
+          ASTList *stmts = NULL;
+          stmts = ast_list_append(stmts, ast_make_return($1));
+          $$ = ast_make_arrow_function(NULL, ast_make_block(stmts), true);
+      }
+  | block
+      { $$ = ast_make_arrow_function(NULL, $1, false); }
+  ;
+
+yield_expr
+  : YIELD
+      { $$ = ast_make_yield(NULL, false); }
+  | YIELD assignment_expr
+      { $$ = ast_make_yield($2, false); }
+  | YIELD '*' assignment_expr
+      { $$ = ast_make_yield($3, true); }
+  ;
+
+array_literal
+  : '[' ']'
+      { $$ = ast_make_array_literal(NULL); }
+  | '[' elision ']'
+      { $$ = ast_make_array_literal($2); }
+  | '[' element_list ']'
+      { $$ = ast_make_array_literal($2); }
+  | '[' element_list ',' ']'
+      { $$ = ast_make_array_literal($2); }
+  ;
+
+elision
+  : ','
+      { $$ = ast_list_append(NULL, ast_make_array_hole()); }
+  | elision ','
+      { $$ = ast_list_append($1, ast_make_array_hole()); }
+  ;
+
+elision_opt
+  : /* empty */
+      { $$ = NULL; }
+  | elision
+      { $$ = $1; }
+  ;
+
+element_list
+  : elision_opt el_item
+      { $$ = ast_list_concat($1, ast_list_append(NULL, $2)); }
+  | element_list ',' elision_opt el_item
+      {
+          ASTList *list = ast_list_concat($1, $3);
+          $$ = ast_list_append(list, $4);
+      }
+  | element_list ',' elision
+      { $$ = ast_list_concat($1, $3); }
+  ;
+
+el_item
+  : assignment_expr
+      { $$ = $1; }
+  | spread_element
+      { $$ = $1; }
+  ;
+
+spread_element
+    : ELLIPSIS assignment_expr
+            { $$ = ast_make_spread_element($2); }
+    ;
+
+opt_trailing_comma
+  : /* empty */
+  | ','
+  ;
+
+object_literal
+  : '{' '}'
+      { $$ = ast_make_object_literal(NULL); }
+  | '{' prop_list opt_trailing_comma '}'
+      { $$ = ast_make_object_literal($2); }
+  ;
+
+template_literal
+  : TEMPLATE_NO_SUB
+      {
+          ASTList *quasis = NULL;
+          quasis = ast_list_append(quasis, ast_make_template_element($1, true));
+          $$ = ast_make_template_literal(quasis, NULL);
+      }
+  | TEMPLATE_HEAD template_part_list
+      {
+          ASTList *quasis = NULL;
+          quasis = ast_list_append(quasis, ast_make_template_element($1, false));
+          $$ = $2;
+          $$->data.template_literal.quasis = ast_list_concat(quasis, $$->data.template_literal.quasis);
+      }
+  ;
+
+// 右递归从尾部向前构造模板字面量节点，每一层把本层的表达式与片段接到两个列表前面
+template_part_list
+  : assignment_expr TEMPLATE_TAIL
+      {
+          ASTList *exprs = NULL;
+          ASTList *quasis = NULL;
+          exprs = ast_list_append(exprs, $1);
+          quasis = ast_list_append(quasis, ast_make_template_element($2, true));
+          $$ = ast_make_template_literal(quasis, exprs);
+      }
+  | assignment_expr TEMPLATE_MIDDLE template_part_list
+      {
+          ASTList *exprs = NULL;
+          ASTList *quasis = NULL;
+          exprs = ast_list_append(exprs, $1);
+          quasis = ast_list_append(quasis, ast_make_template_element($2, false));
+          $$ = $3;
+          $$->data.template_literal.expressions = ast_list_concat(exprs, $$->data.template_literal.expressions);
+          $$->data.template_literal.quasis = ast_list_concat(quasis, $$->data.template_literal.quasis);
+      }
+  ;
+
+prop_list
+  : prop
+      { $$ = ast_list_append(NULL, $1); }
+  | prop_list ',' prop
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+prop
+  : property_name ':' assignment_expr
+      { $$ = ast_make_property($1, true, $3); }
+  | IDENTIFIER
+      {
+          ASTNode *id = ast_make_identifier($1);
+          $$ = ast_make_property(id->data.identifier.name, true, id);
+      }
+  | method_definition
+      { $$ = build_method_node($1); }
+  | getter_definition
+      { $$ = $1; }
+  | setter_definition
+      { $$ = $1; }
+  | computed_property
+      { $$ = $1; }
+  | spread_element
+      { $$ = $1; }
+  ;
+
+computed_property
+  : '[' assignment_expr ']' ':' assignment_expr
+      { $$ = ast_make_computed_property($2, $5); }
+  ;
+
+// 只验证语法时只需要标识符（类里的 constructor 要靠它识别），关键字与字符串键都不会是 constructor
+property_name
+    : IDENTIFIER { $$ = $1; }
+    | property_name_keyword { $$ = $1; }
+    ;
+
+property_name_keyword
+    : STRING     { $$ = atom_intern_cstr(ctx->atoms, $1); free($1); }
+    | NUMBER     { $$ = $1; }
+    | DEFAULT    { $$ = ATOM(ctx->atoms, DEFAULT); }
+    | IF         { $$ = atom_intern_cstr(ctx->atoms, "if"); }
+    | ELSE       { $$ = atom_intern_cstr(ctx->atoms, "else"); }
+    | FOR        { $$ = atom_intern_cstr(ctx->atoms, "for"); }
+    | WHILE      { $$ = atom_intern_cstr(ctx->atoms, "while"); }
+    | DO         { $$ = atom_intern_cstr(ctx->atoms, "do"); }
+    | FUNCTION   { $$ = atom_intern_cstr(ctx->atoms, "function"); }
+    | VAR        { $$ = atom_intern_cstr(ctx->atoms, "var"); }
+    | LET        { $$ = atom_intern_cstr(ctx->atoms, "let"); }
+    | CONST      { $$ = atom_intern_cstr(ctx->atoms, "const"); }
+    | RETURN     { $$ = atom_intern_cstr(ctx->atoms, "return"); }
+    | BREAK      { $$ = atom_intern_cstr(ctx->atoms, "break"); }
+    | CONTINUE   { $$ = atom_intern_cstr(ctx->atoms, "continue"); }
+    | SWITCH     { $$ = atom_intern_cstr(ctx->atoms, "switch"); }
+    | CASE       { $$ = atom_intern_cstr(ctx->atoms, "case"); }
+    | TRY        { $$ = atom_intern_cstr(ctx->atoms, "try"); }
+    | CATCH      { $$ = atom_intern_cstr(ctx->atoms, "catch"); }
+    | FINALLY    { $$ = atom_intern_cstr(ctx->atoms, "finally"); }
+    | THROW      { $$ = atom_intern_cstr(ctx->atoms, "throw"); }
+    | NEW        { $$ = atom_intern_cstr(ctx->atoms, "new"); }
+    | THIS       { $$ = atom_intern_cstr(ctx->atoms, "this"); }
+    | TYPEOF     { $$ = atom_intern_cstr(ctx->atoms, "typeof"); }
+    | DELETE     { $$ = atom_intern_cstr(ctx->atoms, "delete"); }
+    | IN         { $$ = atom_intern_cstr(ctx->atoms, "in"); }
+    | INSTANCEOF { $$ = atom_intern_cstr(ctx->atoms, "instanceof"); }
+    | VOID       { $$ = atom_intern_cstr(ctx->atoms, "void"); }
+    | WITH       { $$ = atom_intern_cstr(ctx->atoms, "with"); }
+    | DEBUGGER   { $$ = atom_intern_cstr(ctx->atoms, "debugger"); }
+    | TRUE       { $$ = atom_intern_cstr(ctx->atoms, "true"); }
+    | FALSE      { $$ = atom_intern_cstr(ctx->atoms, "false"); }
+    | NULL_T     { $$ = atom_intern_cstr(ctx->atoms, "null"); }
+    | UNDEFINED  { $$ = atom_intern_cstr(ctx->atoms, "undefined"); }
+    | CLASS      { $$ = atom_intern_cstr(ctx->atoms, "class"); }
+    | EXTENDS    { $$ = atom_intern_cstr(ctx->atoms, "extends"); }
+    | SUPER      { $$ = atom_intern_cstr(ctx->atoms, "super"); }
+    | ASYNC      { $$ = atom_intern_cstr(ctx->atoms, "async"); }
+    | AWAIT      { $$ = atom_intern_cstr(ctx->atoms, "await"); }
+    ;
+
+binding_initializer_opt
+  : /* empty */
+      { $$ = NULL; }
+    | '=' assignment_expr
+      { $$ = $2; }
+  ;
+
+binding_initializer_opt_no_in
+  : /* empty */
+      { $$ = NULL; }
+    | '=' assignment_expr_no_in
+      { $$ = $2; }
+  ;
+
+binding_element
+  : IDENTIFIER binding_initializer_opt
+      { $$ = ast_make_binding_pattern(ast_make_identifier($1), $2); }
+  | object_binding binding_initializer_opt
+      { $$ = ast_make_binding_pattern($1, $2); }
+  | array_binding binding_initializer_opt
+      { $$ = ast_make_binding_pattern($1, $2); }
+  ;
+
+object_binding
+  : '{' '}'
+      { $$ = ast_make_object_binding(NULL); }
+  | '{' binding_property_sequence '}'
+      { $$ = ast_make_object_binding($2); }
+  ;
+
+binding_property_sequence
+  : binding_property_list opt_trailing_comma
+      { $$ = $1; }
+  | binding_property_list ',' binding_rest_property
+      { $$ = ast_list_append($1, $3); }
+  | binding_rest_property
+      { $$ = ast_list_append(NULL, $1); }
+  ;
+
+binding_property_list
+  : binding_property
+      { $$ = ast_list_append(NULL, $1); }
+  | binding_property_list ',' binding_property
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+binding_property
+  : IDENTIFIER ':' binding_element
+      { $$ = ast_make_binding_property($1, true, $3, false); }
+  | property_name_keyword ':' binding_element
+      { $$ = ast_make_binding_property(unquote_property_key(ctx, $1), false, $3, false); }
+  | IDENTIFIER binding_initializer_opt
+      {
+          ASTNode *id = ast_make_identifier($1);
+          ASTNode *pattern = ast_make_binding_pattern(id, $2);
+          $$ = ast_make_binding_property(id->data.identifier.name, true, pattern, true);
+      }
+  ;
+
+binding_rest_property
+  : ELLIPSIS IDENTIFIER
+      { $$ = ast_make_rest_element(ast_make_identifier($2)); }
+  ;
+
+array_binding
+  : '[' binding_elision_opt ']'
+      { $$ = ast_make_array_binding($2); }
+  | '[' binding_elision_opt binding_element_list opt_trailing_comma ']'
+      { ASTList *list = ast_list_concat($2, $3); $$ = ast_make_array_binding(list); }
+  | '[' binding_elision_opt binding_element_list ',' binding_elision_opt binding_rest_element opt_trailing_comma ']'
+      { ASTList *list = ast_list_concat($2, $3); list = ast_list_concat(list, $5); $$ = ast_make_array_binding(ast_list_append(list, $6)); }
+  | '[' binding_elision_opt binding_rest_element opt_trailing_comma ']'
+      { ASTList *list = ast_list_concat($2, ast_list_append(NULL, $3)); $$ = ast_make_array_binding(list); }
+  ;
+
+binding_element_list
+  : binding_element
+      { $$ = ast_list_append(NULL, $1); }
+  | binding_element_list ',' binding_elision_opt binding_element
+      { ASTList *list = ast_list_concat($1, $3); $$ = ast_list_append(list, $4); }
+  ;
+
+binding_elision_opt
+  : /* empty */
+      { $$ = NULL; }
+  | binding_elision
+      { $$ = $1; }
+  ;
+
+binding_elision
+  : ','
+      { $$ = ast_list_append(NULL, ast_make_array_hole()); }
+  | ',' binding_elision
+      { ASTList *list = ast_list_append(NULL, ast_make_array_hole()); $$ = ast_list_concat(list, $2); }
+  ;
+
+binding_rest_element
+  : ELLIPSIS IDENTIFIER
+      { $$ = ast_make_rest_element(ast_make_identifier($2)); }
+  ;
+
+assignment_pattern
+  : object_assignment_pattern
+      { $$ = ast_make_binding_pattern($1, NULL); }
+  | array_assignment_pattern
+      { $$ = ast_make_binding_pattern($1, NULL); }
+  ;
+
+object_assignment_pattern
+  : '{' '}'
+      { $$ = ast_make_object_binding(NULL); }
+  | '{' assignment_property_sequence '}'
+      { $$ = ast_make_object_binding($2); }
+  ;
+
+assignment_property_sequence
+  : assignment_property_list opt_trailing_comma
+      { $$ = $1; }
+  | assignment_property_list ',' assignment_rest_element
+      { $$ = ast_list_append($1, $3); }
+  | assignment_rest_element
+      { $$ = ast_list_append(NULL, $1); }
+  ;
+
+assignment_property_list
+  : assignment_property
+      { $$ = ast_list_append(NULL, $1); }
+  | assignment_property_list ',' assignment_property
+      { $$ = ast_list_append($1, $3); }
+  ;
+
+assignment_property
+  : IDENTIFIER ':' assignment_element
+      { $$ = ast_make_binding_property($1, true, $3, false); }
+  | property_name_keyword ':' assignment_element
+      { $$ = ast_make_binding_property(unquote_property_key(ctx, $1), false, $3, false); }
+  | IDENTIFIER binding_initializer_opt
+      {
+          ASTNode *id = ast_make_identifier($1);
+          ASTNode *pattern = ast_make_binding_pattern(id, $2);
+          $$ = ast_make_binding_property(id->data.identifier.name, true, pattern, true);
+      }
+  ;
+
+assignment_rest_element
+  : ELLIPSIS postfix_expr
+      { $$ = ast_make_rest_element($2); }
+  ;
+
+array_assignment_pattern
+  : '[' binding_elision_opt ']'
+      { $$ = ast_make_array_binding($2); }
+  | '[' binding_elision_opt assignment_element_list opt_trailing_comma ']'
+      { ASTList *list = ast_list_concat($2, $3); $$ = ast_make_array_binding(list); }
+  | '[' binding_elision_opt assignment_element_list ',' binding_elision_opt assignment_rest_element opt_trailing_comma ']'
+      { ASTList *list = ast_list_concat($2, $3); list = ast_list_concat(list, $5); $$ = ast_make_array_binding(ast_list_append(list, $6)); }
+  | '[' binding_elision_opt assignment_rest_element opt_trailing_comma ']'
+      { ASTList *list = ast_list_concat($2, ast_list_append(NULL, $3)); $$ = ast_make_array_binding(list); }
+  ;
+
+assignment_element_list
+  : assignment_element
+      { $$ = ast_list_append(NULL, $1); }
+  | assignment_element_list ',' binding_elision_opt assignment_element
+      { ASTList *list = ast_list_concat($1, $3); $$ = ast_list_append(list, $4); }
+  ;
+
+assignment_element
+  : assignment_target binding_initializer_opt
+      { $$ = ast_make_binding_pattern($1, $2); }
+  ;
+
+assignment_target
+  : postfix_expr %dprec 1
+      { $$ = $1; }
+  | object_assignment_pattern %dprec 2
+      { $$ = $1; }
+  | array_assignment_pattern %dprec 2
+      { $$ = $1; }
+  ;
+
+for_binding
+  : VAR for_binding_declarator
+      { ASTList *list = NULL; list = ast_list_append(list, $2); $$ = ast_make_var_stmt(AST_VAR_KIND_VAR, list); }
+  | LET for_binding_declarator
+      { ASTList *list = NULL; list = ast_list_append(list, $2); $$ = ast_make_var_stmt(AST_VAR_KIND_LET, list); }
+  | CONST for_binding_declarator
+      { ASTList *list = NULL; list = ast_list_append(list, $2); $$ = ast_make_var_stmt(AST_VAR_KIND_CONST, list); }
+  ;
+
+for_binding_declarator
+  : IDENTIFIER
+      { $$ = ast_make_var_decl(ast_make_binding_pattern(ast_make_identifier($1), NULL)); }
+  | object_binding
+      { $$ = ast_make_var_decl(ast_make_binding_pattern($1, NULL)); }
+  | array_binding
+      { $$ = ast_make_var_decl(ast_make_binding_pattern($1, NULL)); }
+  ;
+
+%%
+
+#ifdef JS_PARSER_FAST
+
+// 快速路径的错误不报告：该语句会交给 GLR 重新解析，由它给出诊断
+void yyerror(JSParser *ctx, const char *s) {
+    (void)s;
+    ctx->statement_failed = true;
+}
+
+// 两个解析器由同一份文法生成，LALR 状态编号一致；语义值联合体的声明也相同
+bool fast_parser_compatible(size_t value_size) {
+    return value_size == sizeof(YYSTYPE) && parser_lr_state_count() == YYNSTATES;
+}
+
+FastParser *fast_parser_new(void) {
+    return yypstate_new();
+}
+
+void fast_parser_free(FastParser *parser) {
+    yypstate_delete(parser);
+}
+
+FastPushStatus fast_parser_push(FastParser *parser, int token, const void *value, JSParser *ctx) {
+    int status = yypush_parse(parser, token, (const YYSTYPE *)value, ctx);
+    if (status == YYPUSH_MORE) {
+        return FAST_PUSH_MORE;
+    }
+    return status == 0 ? FAST_PUSH_ACCEPTED : FAST_PUSH_FAILED;
+}
+
+// 在不改动解析器的前提下模拟读入 token 之后的归约序列（类似 LAC，只查表不执行动作），
+// 途经的每个状态都到 GLR 的表里检查这一格是否有冲突：没有冲突的路径上确定性解析与 GLR 完全一致
+bool fast_parser_lookahead_ok(const FastParser *parser, int token) {
+    yysymbol_kind_t symbol = token <= 0 ? YYSYMBOL_YYEOF : YYTRANSLATE(token);
+    const yy_state_t *base = parser->yyssp;  // 原栈中尚未被模拟弹出的栈顶
+    yy_state_t pushed[64];                   // 模拟中压入的状态
+    int pushed_count = 0;
+    int state = *base;
+    for (;;) {
+        if (parser_lr_conflict(state, symbol)) {
+            return false;
+        }
+        int rule;
+        int index = yypact[state] + symbol;
+        if (yypact_value_is_default(yypact[state]) || index < 0 || YYLAST < index || yycheck[index] != symbol) {
+            rule = yydefact[state];
+            if (rule == 0) {
+                return true;    // 语法错误，由 push 报告
+            }
+        } else if (yytable[index] > 0 || yytable_value_is_error(yytable[index])) {
+            return true;        // 移进（或错误）：归约序列到此结束
+        } else {
+            rule = -yytable[index];
+        }
+        int length = yyr2[rule];
+        if (length <= pushed_count) {
+            pushed_count -= length;
+        } else {
+            base -= length - pushed_count;
+            pushed_count = 0;
+        }
+        int top = pushed_count > 0 ? pushed[pushed_count - 1] : *base;
+        int lhs = yyr1[rule] - YYNTOKENS;
+        int goto_index = yypgoto[lhs] + top;
+        state = (0 <= goto_index && goto_index <= YYLAST && yycheck[goto_index] == top)
+                    ? yytable[goto_index] : yydefgoto[lhs];
+        if (pushed_count == (int)(sizeof(pushed) / sizeof(pushed[0]))) {
+            return false;
+        }
+        pushed[pushed_count++] = (yy_state_t)state;
+    }
+}
+
+// 放弃解析到一半的语句：按 %destructor 释放栈上的值，解析器回到初始状态
+void fast_parser_reset(FastParser *parser, JSParser *ctx) {
+    if (parser->yynew != 0) {
+        return;
+    }
+    while (parser->yyssp != parser->yyss) {
+        yydestruct("Fast path: discarding", YY_ACCESSING_SYMBOL(*parser->yyssp), parser->yyvsp, ctx);
+        parser->yyssp--;
+        parser->yyvsp--;
+    }
+    parser->yynew = 2;
+}
+
+#else
+
+void yyerror(JSParser *ctx, const char *s) {
+    ctx->error_count++;
+    if (ctx->print_errors) {
+        fprintf(stderr, "Syntax error #%d: %s\n", ctx->error_count, s);
+    }
+    diag_record_error(&ctx->diag, s);
+}
+
+// 只验证语法的解析器表与主解析器相同，表查询只由主解析器提供一份
+#ifndef JS_PARSER_VALIDATE
+int parser_lr_state_count(void) {
+    return YYNSTATES;
+}
+
+// 状态 state 遇到 symbol 时表里是否有多个动作（GLR 会在这里分裂）
+bool parser_lr_conflict(int state, int symbol) {
+    const short *conflicts;
+    yygetLRActions((yy_state_t)state, (yysymbol_kind_t)symbol, &conflicts);
+    return *conflicts != 0;
+}
+
+// 规则 rule（bison -v 的编号，即跟踪输出里的编号）的左部名字；parse.error verbose 时 yytname 总是存在
+const char *parser_rule_lhs(int rule) {
+    return yytname[yyr1[rule + 1]];
+}
+
+// 规则在生成的 parser.y 中的行号；yyrline 只在带跟踪代码的构建里有
+int parser_rule_line(int rule) {
+#if YYDEBUG
+    return yyrline[rule + 1];
+#else
+    (void)rule;
+    return 0;
+#endif
+}
+#endif
+
+#endif
@@ -0,0 +1,2439 @@
+/*
+ * JavaScript 语法分析器（Bison）
+ * 现支持在语义动作中构建 AST，并可通过 --dump-ast 选项输出树结构。
+ *
+ * 同一份文法生成两个解析器（gen_tokens 展开下面的 @PARSER_MODE@）：
+ *   parser.c      GLR 主解析器
+ *   parser_fast.c 确定性推送式解析器（-DJS_PARSER_FAST），按顶层语句先行尝试，
+ *                 遇到冲突格或错误时该语句交回 GLR 重新解析（见 parser_fast_path.c）
+ * 两者各有一个只验证语法的版本（gen_tokens --validate，-DJS_PARSER_VALIDATE）：parser_validate.c
+ * 与 parser_fast_validate.c。表完全相同，动作只保留标了 %validate 的（早期错误、分段边界、
+ * 方法修饰符检查需要的值），其余动作把值清零，不构造任何 AST
+ */
+
+%{
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "ast.h"
+#include "parser_context.h"
+#include "postfix_suffix.h"
+#include "binary_chain.h"
+
+// 序言先于 %code provides 输出，这里需要单独声明
+void yyerror(JSParser *ctx, const char *s);
+
+#ifndef JS_PARSER_FAST
+// --glr-stats / --glr-trace 的钩子（GLR_STATS_HOOK）由 gen_tokens --glr-hooks 插入生成的 parser.c；
+// glr.c 的跟踪文本经过 YYFPRINTF，只在 JS_PARSER_TRACE 时输出
+#include "glr_stats.h"
+#define YYFPRINTF glr_trace_fprintf
+#endif
+
+#ifndef YYMAXDEPTH
+#define YYMAXDEPTH 10000000 /* Allow deep GLR stacks for 10^5-level nesting; member/call chains are left-recursive and stay shallow */
+#endif
+
+#ifndef YYINITDEPTH
+#ifdef JS_PARSER_FAST
+#define YYINITDEPTH 256     /* 推送式解析器的初始栈嵌在 pstate 里，不够时按倍数扩容 */
+#else
+// GLR 栈的初始容量按本次 yyparse 要解析的 token 数估计（parser_fast_path.c 设置），不够时 glr.c 倍增；
+// 骨架只在 yyparse 里用到 YYINITDEPTH，ctx 在作用域内
+#define YYINITDEPTH (ctx->glr_initial_depth)
+#endif
+#endif
+
+// 语句分段解析时顶层语句的归约需要知道：动作是否立即执行（GLR 分裂期间动作延后，yynormal 为假），
+// 以及当前是否已读入前瞻 token（两个解析器的“无前瞻”常量名字不同）
+#if defined(JS_PARSER_FAST) && defined(JS_PARSER_VALIDATE)
+#define PARSER_NO_LOOKAHEAD JSFASTVALIDATE_EMPTY
+#define PARSER_ACTION_IMMEDIATE 1
+#elif defined(JS_PARSER_FAST)
+#define PARSER_NO_LOOKAHEAD JSFAST_EMPTY
+#define PARSER_ACTION_IMMEDIATE 1
+#elif defined(JS_PARSER_VALIDATE)
+#define PARSER_NO_LOOKAHEAD JSVALIDATE_EMPTY
+#define PARSER_ACTION_IMMEDIATE yynormal
+#else
+#define PARSER_NO_LOOKAHEAD YYEMPTY
+#define PARSER_ACTION_IMMEDIATE yynormal
+#endif
+
+// 分段解析：每归约出一条顶层语句就结束本段，已读入的前瞻 token 留给下一段
+#define END_STATEMENT_SEGMENT(items)                                        \
+    do {                                                                    \
+        if (ctx->statement_mode && PARSER_ACTION_IMMEDIATE) {               \
+            ctx->statement_items = (items);                                 \
+            ctx->statement_lookahead = (yychar != PARSER_NO_LOOKAHEAD);     \
+            yyclearin;                                                      \
+            YYACCEPT;                                                       \
+        }                                                                   \
+    } while (0)
+
+#ifdef JS_PARSER_FAST
+// 快速路径放弃一条语句时，栈上已建好的部分 AST 由 %destructor 释放
+static void discard_suffix_chain(PostfixSuffix *chain) {
+    if (chain) {
+        PostfixSuffix *tail = chain;
+        chain = tail->next;
+        tail->next = NULL;
+    }
+    while (chain) {
+        PostfixSuffix *next = chain->next;
+        switch (chain->kind) {
+            case POSTFIX_SUFFIX_COMPUTED:
+                ast_free(chain->data.computed_expr);
+                break;
+            case POSTFIX_SUFFIX_CALL:
+                ast_list_free(chain->data.arguments);
+                break;
+            case POSTFIX_SUFFIX_TEMPLATE:
+                ast_free(chain->data.template_literal);
+                break;
+            case POSTFIX_SUFFIX_PROP:
+                break;
+        }
+        free(chain);
+        chain = next;
+    }
+}
+
+static void discard_binary_chain(BinaryChain *chain) {
+    for (size_t i = 0; i < chain->count; i++) {
+        ast_free(chain->items[i].operand);
+    }
+    free(chain);
+}
+#endif
+
+// 方法定义在类元素/对象属性的修饰符都检查完之后才构造节点，此前名字、修饰符、参数与函数体都放在这里
+#ifndef JS_METHOD_INFO_DEFINED
+#define JS_METHOD_INFO_DEFINED
+typedef struct MethodInfo MethodInfo;
+#endif
+struct MethodInfo {
+    const char *name;
+    ASTNode *computed_key;
+    bool computed;
+    bool is_generator;
+    bool is_async;
+    bool is_static;
+    ASTMethodKind kind;
+    ASTList *params;
+    ASTNode *body;
+    size_t param_count;         // 只验证语法时没有参数表，只有个数
+};
+
+static ASTNode *wrap_destructuring_target(ASTNode *target) {
+    if (!target) {
+        return NULL;
+    }
+    if (target->type == AST_OBJECT_BINDING || target->type == AST_ARRAY_BINDING) {
+        return ast_make_binding_pattern(target, NULL);
+    }
+    return target;
+}
+
+static ASTNode *make_binding_with_initializer(ASTNode *target, ASTNode *initializer);
+static ASTNode *convert_assignment_target(ASTNode *expr, bool allow_object_literal);
+static ASTNode *convert_array_literal_to_binding(ASTNode *expr, bool allow_object_literal);
+static ASTNode *convert_object_literal_to_binding(ASTNode *expr);
+
+static ASTNode *make_binding_with_initializer(ASTNode *target, ASTNode *initializer) {
+    if (!target) {
+        return NULL;
+    }
+    if (target->type == AST_BINDING_PATTERN) {
+        if (initializer && !target->data.binding_pattern.initializer) {
+            target->data.binding_pattern.initializer = initializer;
+        }
+        return target;
+    }
+    return ast_make_binding_pattern(target, initializer);
+}
+
+static ASTNode *convert_assignment_target(ASTNode *expr, bool allow_object_literal) {
+    if (!expr) {
+        return NULL;
+    }
+    switch (expr->type) {
+        case AST_IDENTIFIER:
+            return expr;
+        case AST_ARRAY_LITERAL:
+            return convert_array_literal_to_binding(expr, allow_object_literal);
+        case AST_OBJECT_LITERAL:
+            return allow_object_literal ? convert_object_literal_to_binding(expr) : NULL;
+        case AST_ASSIGN_EXPR:
+            if (expr->data.assign.op && strcmp(expr->data.assign.op, "=") == 0) {
+                ASTNode *lhs = convert_assignment_target(expr->data.assign.left, allow_object_literal);
+                if (!lhs) {
+                    return NULL;
+                }
+                return make_binding_with_initializer(lhs, expr->data.assign.right);
+            }
+            return NULL;
+        default:
+            return NULL;
+    }
+}
+
+static ASTNode *convert_array_literal_to_binding(ASTNode *expr, bool allow_object_literal) {
+    if (!expr || expr->type != AST_ARRAY_LITERAL) {
+        return NULL;
+    }
+    ASTList *converted = NULL;
+    ASTList *elem = expr->data.array_literal.elements;
+    while (elem) {
+        ASTNode *item = elem->node;
+        if (!item) {
+            elem = elem->next;
+            continue;
+        }
+        ASTNode *converted_item = NULL;
+        if (item->type == AST_ARRAY_HOLE) {
+            converted_item = ast_make_array_hole();
+        } else if (item->type == AST_SPREAD_ELEMENT) {
+            ASTNode *rest_target = convert_assignment_target(item->data.spread_element.argument, allow_object_literal);
+            if (!rest_target) {
+                return NULL;
+            }
+            converted_item = ast_make_rest_element(rest_target);
+        } else {
+            ASTNode *init = NULL;
+            ASTNode *value = item;
+            if (item->type == AST_ASSIGN_EXPR && item->data.assign.op &&
+                strcmp(item->data.assign.op, "=") == 0) {
+                value = item->data.assign.left;
+                init = item->data.assign.right;
+            }
+            ASTNode *target = convert_assignment_target(value, allow_object_literal);
+            if (!target) {
+                return NULL;
+            }
+            converted_item = make_binding_with_initializer(target, init);
+        }
+        converted = ast_list_append(converted, converted_item);
+        elem = elem->next;
+    }
+    return ast_make_array_binding(converted);
+}
+
+static ASTNode *convert_object_literal_to_binding(ASTNode *expr) {
+    if (!expr || expr->type != AST_OBJECT_LITERAL) {
+        return NULL;
+    }
+    ASTList *converted = NULL;
+    for (ASTList *prop = expr->data.object_literal.properties; prop; prop = prop->next) {
+        ASTNode *item = prop->node;
+        if (!item) {
+            continue;
+        }
+        if (item->type == AST_SPREAD_ELEMENT) {
+            ASTNode *rest_target = convert_assignment_target(item->data.spread_element.argument, true);
+            if (!rest_target) {
+                return NULL;
+            }
+            converted = ast_list_append(converted, ast_make_rest_element(rest_target));
+            continue;
+        }
+        if (item->type != AST_PROPERTY) {
+            return NULL;
+        }
+        bool is_identifier_key = item->data.property.key.is_identifier;
+        const char *key = item->data.property.key.name;
+        ASTNode *value = item->data.property.value;
+        ASTNode *init = NULL;
+        ASTNode *binding_target = NULL;
+        if (value && value->type == AST_ASSIGN_EXPR && value->data.assign.op &&
+            strcmp(value->data.assign.op, "=") == 0) {
+            binding_target = convert_assignment_target(value->data.assign.left, true);
+            init = value->data.assign.right;
+        } else {
+            binding_target = convert_assignment_target(value, true);
+        }
+        if (!binding_target) {
+            return NULL;
+        }
+        ASTNode *binding_value = make_binding_with_initializer(binding_target, init);
+        bool shorthand = false;
+        if (is_identifier_key && value && value->type == AST_IDENTIFIER && item->data.property.key.name) {
+            shorthand = item->data.property.key.name == value->data.identifier.name;
+        }
+        converted = ast_list_append(converted,
+                                    ast_make_binding_property(key, is_identifier_key, binding_value, shorthand));
+    }
+    return ast_make_object_binding(converted);
+}
+
+static PostfixSuffix *alloc_suffix(PostfixSuffixKind kind) {
+    PostfixSuffix *suffix = (PostfixSuffix *)calloc(1, sizeof(PostfixSuffix));
+    if (!suffix) {
+        fprintf(stderr, "Out of memory while building postfix suffix chain\n");
+        exit(EXIT_FAILURE);
+    }
+    suffix->kind = kind;
+    suffix->next = suffix;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_prop(const char *name) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_PROP);
+    suffix->data.property_name = name;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_computed(ASTNode *expr) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_COMPUTED);
+    suffix->data.computed_expr = expr;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_call(ASTList *args) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_CALL);
+    suffix->data.arguments = args;
+    return suffix;
+}
+
+static PostfixSuffix *make_suffix_template(ASTNode *literal) {
+    PostfixSuffix *suffix = alloc_suffix(POSTFIX_SUFFIX_TEMPLATE);
+    suffix->data.template_literal = literal;
+    return suffix;
+}
+
+// 后缀链按环形链表保存、以最后一项代表整条链，追加是 O(1)：
+// 十万级的 a.b(c).d[e]... 链不会因为每次找尾而变成平方时间
+static PostfixSuffix *append_suffix(PostfixSuffix *tail, PostfixSuffix *item) {
+    if (!item) {
+        return tail;
+    }
+    if (tail) {
+        item->next = tail->next;
+        tail->next = item;
+    }
+    return item;
+}
+
+static ASTNode *apply_suffix_chain(ASTNode *base, PostfixSuffix *chain) {
+    PostfixSuffix *current = NULL;
+    if (chain) {
+        current = chain->next;
+        chain->next = NULL;
+    }
+    while (current) {
+        PostfixSuffix *next = current->next;
+        switch (current->kind) {
+            case POSTFIX_SUFFIX_PROP:
+                base = ast_make_member(base, ast_make_identifier(current->data.property_name), false);
+                break;
+            case POSTFIX_SUFFIX_COMPUTED:
+                base = ast_make_member(base, current->data.computed_expr, true);
+                break;
+            case POSTFIX_SUFFIX_CALL:
+                base = ast_make_call(base, current->data.arguments);
+                break;
+            case POSTFIX_SUFFIX_TEMPLATE:
+                base = ast_make_tagged_template(base, current->data.template_literal);
+                break;
+        }
+        free(current);
+        current = next;
+    }
+    return base;
+}
+
+// 二元运算符优先级（与原先逐级展开的文法一致：** 与 * / % 同级且左结合）
+enum
+{
+    BINOP_OR, BINOP_AND, BINOP_BIT_OR, BINOP_BIT_XOR, BINOP_BIT_AND,
+    BINOP_EQ, BINOP_NE, BINOP_EQ_STRICT, BINOP_NE_STRICT,
+    BINOP_LT, BINOP_GT, BINOP_LE, BINOP_GE, BINOP_INSTANCEOF, BINOP_IN,
+    BINOP_LSHIFT, BINOP_RSHIFT, BINOP_URSHIFT,
+    BINOP_ADD, BINOP_SUB, BINOP_MUL, BINOP_EXP, BINOP_DIV, BINOP_MOD
+};
+
+static const BinaryOperator binary_operators[] = {
+    [BINOP_OR] = {"||", 1},
+    [BINOP_AND] = {"&&", 2},
+    [BINOP_BIT_OR] = {"|", 3},
+    [BINOP_BIT_XOR] = {"^", 4},
+    [BINOP_BIT_AND] = {"&", 5},
+    [BINOP_EQ] = {"==", 6},
+    [BINOP_NE] = {"!=", 6},
+    [BINOP_EQ_STRICT] = {"===", 6},
+    [BINOP_NE_STRICT] = {"!==", 6},
+    [BINOP_LT] = {"<", 7},
+    [BINOP_GT] = {">", 7},
+    [BINOP_LE] = {"<=", 7},
+    [BINOP_GE] = {">=", 7},
+    [BINOP_INSTANCEOF] = {"instanceof", 7},
+    [BINOP_IN] = {"in", 7},
+    [BINOP_LSHIFT] = {"<<", 8},
+    [BINOP_RSHIFT] = {">>", 8},
+    [BINOP_URSHIFT] = {">>>", 8},
+    [BINOP_ADD] = {"+", 9},
+    [BINOP_SUB] = {"-", 9},
+    [BINOP_MUL] = {"*", 10},
+    [BINOP_EXP] = {"**", 10},
+    [BINOP_DIV] = {"/", 10},
+    [BINOP_MOD] = {"%", 10},
+};
+
+static BinaryChain *binary_chain_append(BinaryChain *chain, const BinaryOperator *op, ASTNode *operand) {
+    size_t count = chain ? chain->count : 0;
+    if (!chain || count == chain->capacity) {
+        size_t capacity = chain ? chain->capacity * 2 : 4;
+        BinaryChain *grown = (BinaryChain *)realloc(chain, sizeof(BinaryChain) + capacity * sizeof(BinaryChainItem));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while building binary expression\n");
+            exit(EXIT_FAILURE);
+        }
+        grown->count = count;
+        grown->capacity = capacity;
+        chain = grown;
+    }
+    chain->items[count].op = op;
+    chain->items[count].operand = operand;
+    chain->count = count + 1;
+    return chain;
+}
+
+// 优先级爬升：从 *next 开始吸收优先级不低于 min_precedence 的运算符，
+// 右操作数后面跟着更紧的运算符时先递归把它们结合进右操作数（递归深度不超过优先级层数）
+static ASTNode *climb_binary_chain(const BinaryChain *chain, size_t *next, ASTNode *left, int min_precedence) {
+    while (*next < chain->count && chain->items[*next].op->precedence >= min_precedence) {
+        const BinaryOperator *op = chain->items[*next].op;
+        ASTNode *right = chain->items[(*next)++].operand;
+        while (*next < chain->count && chain->items[*next].op->precedence > op->precedence) {
+            right = climb_binary_chain(chain, next, right, op->precedence + 1);
+        }
+        left = ast_make_binary(op->op, left, right);
+    }
+    return left;
+}
+
+static ASTNode *fold_binary_chain(BinaryChain *chain) {
+    size_t next = 1;
+    ASTNode *result = climb_binary_chain(chain, &next, chain->items[0].operand, 0);
+    free(chain);
+    return result;
+}
+
+// 方法名与修饰符放在堆上，语义值只是一个指针（YYSTYPE 保持指针大小）；build_method_node 接管并释放
+static MethodInfo *method_info_alloc(const char *name, ASTNode *computed_key, bool computed) {
+    MethodInfo *info = (MethodInfo *)malloc(sizeof(MethodInfo));
+    if (!info) {
+        fprintf(stderr, "Out of memory while constructing method\n");
+        exit(EXIT_FAILURE);
+    }
+    info->name = name;
+    info->computed_key = computed_key;
+    info->computed = computed;
+    info->is_generator = false;
+    info->is_async = false;
+    info->is_static = false;
+    info->kind = AST_METHOD_KIND_NORMAL;
+    info->params = NULL;
+    info->body = NULL;
+    info->param_count = 0;
+    return info;
+}
+
+static void method_info_free(MethodInfo *info) {
+    if (info) {
+        ast_free(info->computed_key);
+        ast_list_free(info->params);
+        ast_free(info->body);
+        free(info);
+    }
+}
+
+static MethodInfo *method_info_set_function(MethodInfo *info, ASTList *params, ASTNode *body) {
+    info->params = params;
+    info->body = body;
+    info->param_count = 0;
+    for (ASTList *param = params; param; param = param->next) {
+        info->param_count++;
+    }
+    return info;
+}
+
+#ifdef JS_PARSER_VALIDATE
+// 只验证语法：修饰符与参数个数检查完就丢掉，不构造节点
+static ASTList *make_single_param_list(ASTNode *param) {
+    (void)param;
+    return NULL;
+}
+
+static ASTNode *build_method_node(MethodInfo *info) {
+    method_info_free(info);
+    return NULL;
+}
+#else
+static ASTList *make_single_param_list(ASTNode *param) {
+    ASTList *list = NULL;
+    return ast_list_append(list, param);
+}
+
+static ASTNode *build_method_node(MethodInfo *info) {
+    ASTNode *func = ast_make_function_expr(info->name, info->params, info->body);
+    if (info->is_generator && func) {
+        func->data.function_expr.is_generator = true;
+    }
+    if (info->is_async && func) {
+        func->data.function_expr.is_async = true;
+    }
+    ASTNode *method = ast_make_method_def(info->name,
+                                          info->computed_key,
+                                          info->computed,
+                                          info->is_static,
+                                          info->is_generator,
+                                          info->is_async,
+                                          info->kind,
+                                          func);
+    free(info);
+    return method;
+}
+#endif
+
+// 字符串属性键去掉引号；键是 atom，不能原地修改，去引号后的文本另行驻留
+static const char *unquote_property_key(JSParser *ctx, const char *key) {
+    size_t len = key ? strlen(key) : 0;
+    if (len >= 2 && (key[0] == '\'' || key[0] == '"')) {
+        return atom_intern(ctx->atoms, key + 1, len - 2);
+    }
+    return key;
+}
+
+// 名字都是 atom，与预置 atom 比较指针即可
+static bool identifier_is(const char *name, const char *atom) {
+    return name && name == atom;
+}
+
+static MethodInfo *mark_method_static(JSParser *ctx, MethodInfo *method) {
+    if (method->kind == AST_METHOD_KIND_CONSTRUCTOR) {
+        yyerror(ctx, "Class constructor cannot be static");
+        method_info_free(method);
+        return NULL;
+    }
+    method->is_static = true;
+    return method;
+}
+
+static MethodInfo *maybe_tag_constructor(JSParser *ctx, MethodInfo *method) {
+    if (!method->computed &&
+        method->name &&
+        identifier_is(method->name, ATOM(ctx->atoms, CONSTRUCTOR)) &&
+        !method->is_static) {
+        method->kind = AST_METHOD_KIND_CONSTRUCTOR;
+    }
+    return method;
+}
+
+static MethodInfo *apply_accessor_keyword(JSParser *ctx, MethodInfo *method, const char *keyword) {
+    ASTMethodKind kind;
+    if (identifier_is(keyword, ATOM(ctx->atoms, GET))) {
+        kind = AST_METHOD_KIND_GET;
+    } else if (identifier_is(keyword, ATOM(ctx->atoms, SET))) {
+        kind = AST_METHOD_KIND_SET;
+    } else {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(method);
+        return NULL;
+    }
+    if (kind == AST_METHOD_KIND_GET && method->param_count != 0) {
+        yyerror(ctx, "Getter must not have parameters");
+        method_info_free(method);
+        return NULL;
+    }
+    if (kind == AST_METHOD_KIND_SET && method->param_count != 1) {
+        yyerror(ctx, "Setter must have exactly one parameter");
+        method_info_free(method);
+        return NULL;
+    }
+    method->kind = kind;
+    return method;
+}
+
+static MethodInfo *handle_single_prefix(JSParser *ctx, const char *prefix, MethodInfo *method) {
+    MethodInfo *result = maybe_tag_constructor(ctx, method);
+    if (identifier_is(prefix, ATOM(ctx->atoms, STATIC))) {
+        result = mark_method_static(ctx, result);
+    } else if (identifier_is(prefix, ATOM(ctx->atoms, GET)) || identifier_is(prefix, ATOM(ctx->atoms, SET))) {
+        result = apply_accessor_keyword(ctx, result, prefix);
+    } else {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        result = NULL;
+    }
+    return result;
+}
+
+static MethodInfo *handle_double_prefix(JSParser *ctx, const char *first, const char *second, MethodInfo *method) {
+    MethodInfo *result = maybe_tag_constructor(ctx, method);
+    if (!identifier_is(first, ATOM(ctx->atoms, STATIC))) {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        return NULL;
+    }
+    result = mark_method_static(ctx, result);
+    if (!result) {
+        return NULL;
+    }
+    if (!(identifier_is(second, ATOM(ctx->atoms, GET)) || identifier_is(second, ATOM(ctx->atoms, SET)))) {
+        yyerror(ctx, "Unexpected identifier before class element");
+        method_info_free(result);
+        return NULL;
+    }
+    return apply_accessor_keyword(ctx, result, second);
+}
+%}
+
+%code provides {
+    int yylex(YYSTYPE *lvalp, JSParser *ctx);
+    void yyerror(JSParser *ctx, const char *s);
+}
+
+%code requires {
+    #include "ast.h"
+    #include "postfix_suffix.h"
+    #include "binary_chain.h"
+    #ifndef JS_PARSER_DEFINED
+    #define JS_PARSER_DEFINED
+    typedef struct JSParser JSParser;
+    #endif
+    #ifndef JS_METHOD_INFO_DEFINED
+    #define JS_METHOD_INFO_DEFINED
+    typedef struct MethodInfo MethodInfo;
+    #endif
+}
+
+%union {
+    ASTNode *node;
+    ASTList *list;
+    char *str;          // 自有字符串（字符串/数字字面量等），丢弃时 free
+    const char *atom;   // 名字（标识符、属性名），驻留表持有
+    int boolean;
+    PostfixSuffix *suffix;
+    BinaryChain *chain;
+    const BinaryOperator *binop;
+    MethodInfo *method;
+    size_t count;       // 只验证语法时参数表只记个数
+}
+
+
+// 终结符及其编码由 src/tokens.def 生成（构建时 gen_tokens 替换下一行），
+// 单字符运算符不单独声明，文法中直接写字符字面量
+// 以下 %token 由 gen_tokens 按 src/tokens.def 生成，请勿手改
+%token VAR 258
+%token LET 259
+%token CONST 260
+%token FUNCTION 261
+%token FUNCTION_DECL 262
+%token IF 263
+%token ELSE 264
+%token FOR 265
+%token RETURN 266
+%token ASYNC 267
+%token AWAIT 268
+%token IMPORT 269
+%token EXPORT 270
+%token WHILE 271
+%token DO 272
+%token BREAK 273
+%token CONTINUE 274
+%token SWITCH 275
+%token CASE 276
+%token DEFAULT 277
+%token TRY 278
+%token CATCH 279
+%token FINALLY 280
+%token THROW 281
+%token NEW 282
+%token THIS 283
+%token TYPEOF 284
+%token DELETE 285
+%token IN 286
+%token INSTANCEOF 287
+%token VOID 288
+%token WITH 289
+%token DEBUGGER 290
+%token CLASS 291
+%token EXTENDS 292
+%token SUPER 293
+%token YIELD 294
+%token TRUE 295
+%token FALSE 296
+%token NULL_T 297
+%token UNDEFINED 298
+%token <atom> IDENTIFIER 299
+%token <atom> NUMBER 300
+%token <str> STRING 301
+%token <str> REGEX 302
+%token <str> TEMPLATE_NO_SUB 303
+%token <str> TEMPLATE_HEAD 304
+%token <str> TEMPLATE_MIDDLE 305
+%token <str> TEMPLATE_TAIL 306
+%token PLUS_PLUS 307
+%token MINUS_MINUS 308
+%token EQ 309
+%token NE 310
+%token EQ_STRICT 311
+%token NE_STRICT 312
+%token LE 313
+%token GE 314
+%token AND 315
+%token OR 316
+%token LSHIFT 317
+%token RSHIFT 318
+%token URSHIFT 319
+%token PLUS_ASSIGN 320
+%token MINUS_ASSIGN 321
+%token STAR_ASSIGN 322
+%token SLASH_ASSIGN 323
+%token PERCENT_ASSIGN 324
+%token AND_ASSIGN 325
+%token OR_ASSIGN 326
+%token XOR_ASSIGN 327
+%token LSHIFT_ASSIGN 328
+%token RSHIFT_ASSIGN 329
+%token URSHIFT_ASSIGN 330
+%token ARROW 331
+%token ELLIPSIS 332
+%token ARROW_HEAD 333
+
+%define api.push-pull push
+%define api.prefix {jsfastvalidate_}
+%define lr.default-reduction consistent
+%parse-param {JSParser *ctx}
+%define api.pure
+%define parse.error verbose
+%define parse.trace true
+%debug
+%right '=' PLUS_ASSIGN MINUS_ASSIGN STAR_ASSIGN SLASH_ASSIGN PERCENT_ASSIGN AND_ASSIGN OR_ASSIGN XOR_ASSIGN LSHIFT_ASSIGN RSHIFT_ASSIGN URSHIFT_ASSIGN
+%right '?' ':'
+%left OR
+%left AND
+%left '|'
+%left '^'
+%left '&'
+%left EQ NE EQ_STRICT NE_STRICT
+%left '<' '>' LE GE INSTANCEOF IN
+%left LSHIFT RSHIFT URSHIFT
+%left '+' '-'
+%left '*' '/' '%'
+%right NEW
+%right UMINUS '!' '~' TYPEOF DELETE VOID PLUS_PLUS MINUS_MINUS
+%nonassoc IF_NO_ELSE
+%nonassoc ELSE
+
+%type <node> program module_item stmt block var_stmt var_stmt_no_in return_stmt if_stmt for_stmt while_stmt do_stmt switch_stmt try_stmt with_stmt labeled_stmt break_stmt continue_stmt throw_stmt func_decl for_init for_in_left opt_expr catch_clause finally_clause finally_clause_opt switch_case var_decl var_decl_no_in class_decl class_expr class_element getter_definition setter_definition computed_property class_heritage_opt import_stmt export_stmt import_default_binding namespace_import import_specifier module_specifier export_specifier
+%type <node> expr expr_no_obj expr_no_in_no_obj assignment_expr assignment_expr_no_in assignment_expr_no_obj assignment_expr_no_in_no_obj conditional_expr conditional_expr_no_in conditional_expr_no_obj conditional_expr_no_in_no_obj binary_expr binary_expr_no_in binary_expr_no_obj binary_expr_no_in_no_obj unary_expr unary_expr_no_obj postfix_expr postfix_expr_no_obj left_hand_side_expr left_hand_side_expr_no_obj call_expr call_expr_no_obj member_expr member_expr_no_obj new_expr new_expr_no_obj primary_expr primary_expr_no_obj function_expr template_literal
+%type <node> yield_expr spread_element el_item arg_item
+%type <node> binding_element binding_initializer_opt binding_initializer_opt_no_in object_binding array_binding binding_property binding_rest_property binding_rest_element assignment_pattern object_assignment_pattern array_assignment_pattern assignment_property assignment_element assignment_rest_element assignment_target for_binding for_binding_declarator catch_parameter rest_param
+%type <node> arrow_function arrow_body
+%type <node> array_literal object_literal prop
+%type <method> method_name method_head method_definition
+
+%type <atom> property_name property_name_keyword
+%type <atom> for_of_keyword from_keyword as_keyword
+
+%type <chain> binary_chain binary_chain_no_in binary_chain_no_obj binary_chain_no_in_no_obj
+%type <binop> binary_operator binary_operator_no_in
+%type <suffix> member_suffix_seq member_noncall_suffix call_suffix_seq call_any_suffix call_suffix_initial
+
+
+%type <list> stmt_list module_item_list opt_param_list param_list param_list_items opt_arg_list arg_list prop_list switch_case_list case_stmt_seq var_decl_list var_decl_list_no_in binding_property_list binding_property_sequence binding_element_list binding_elision binding_elision_opt assignment_property_list assignment_property_sequence assignment_element_list class_body class_element_list class_element_list_opt import_clause named_imports import_specifier_list export_clause export_specifier_list
+%type <list> elision elision_opt element_list
+%type <node> template_part_list
+%type <boolean> generator_marker_opt async_modifier_opt
+
+%destructor { if ($$) free($$); } <str>
+%destructor { method_info_free($$); } <method>
+
+%%
+
+program
+  : module_item_list
+      { $<node>$ = NULL; }
+  ;
+
+module_item_list
+  : /* empty */
+      { $<node>$ = NULL; }
+  | module_item_list module_item
+      {
+          $$ = NULL;
+          END_STATEMENT_SEGMENT(NULL);
+      }
+  ;
+
+module_item
+  : stmt
+      { $<node>$ = NULL; }
+  | import_stmt
+      { $<node>$ = NULL; }
+  | export_stmt
+      { $<node>$ = NULL; }
+  ;
+
+stmt_list
+  : /* empty */
+      { $<node>$ = NULL; }
+  | stmt_list stmt
+      { $<node>$ = NULL; }
+  ;
+
+stmt
+  : ';'
+      { $<node>$ = NULL; }
+  | var_stmt ';'
+      { $<node>$ = NULL; }
+  | expr_no_obj ';'
+      { $<node>$ = NULL; }
+  | block
+      { $<node>$ = NULL; }
+  | if_stmt
+      { $<node>$ = NULL; }
+  | for_stmt
+      { $<node>$ = NULL; }
+  | while_stmt
+      { $<node>$ = NULL; }
+  | do_stmt
+      { $<node>$ = NULL; }
+  | switch_stmt
+      { $<node>$ = NULL; }
+  | try_stmt
+      { $<node>$ = NULL; }
+  | with_stmt
+      { $<node>$ = NULL; }
+  | func_decl
+      { $<node>$ = NULL; }
+  | class_decl
+      { $<node>$ = NULL; }
+  | return_stmt ';'
+      { $<node>$ = NULL; }
+  | break_stmt ';'
+      { $<node>$ = NULL; }
+  | continue_stmt ';'
+      { $<node>$ = NULL; }
+  | throw_stmt ';'
+      { $<node>$ = NULL; }
+  | labeled_stmt
+      { $<node>$ = NULL; }
+  ;
+
+import_stmt
+    : IMPORT import_clause from_keyword module_specifier ';'
+      { $<node>$ = NULL; }
+    | IMPORT module_specifier ';'
+      { $<node>$ = NULL; }
+  ;
+
+import_clause
+  : import_default_binding
+      { $<node>$ = NULL; }
+  | namespace_import
+      { $<node>$ = NULL; }
+  | named_imports
+      { $<node>$ = NULL; }
+  | import_default_binding ',' namespace_import
+      { $<node>$ = NULL; }
+  | import_default_binding ',' named_imports
+      { $<node>$ = NULL; }
+  ;
+
+named_imports
+    : '{' '}'
+            { $<node>$ = NULL; }
+    | '{' import_specifier_list opt_trailing_comma '}'
+            { $<node>$ = NULL; }
+    ;
+
+import_specifier_list
+  : import_specifier
+      { $<node>$ = NULL; }
+  | import_specifier_list ',' import_specifier
+      { $<node>$ = NULL; }
+  ;
+
+import_specifier
+  : IDENTIFIER
+      { $<node>$ = NULL; }
+  | IDENTIFIER as_keyword IDENTIFIER
+      { $<node>$ = NULL; }
+  | DEFAULT as_keyword IDENTIFIER
+      { $<node>$ = NULL; }
+  ;
+
+import_default_binding
+  : IDENTIFIER
+      { $<node>$ = NULL; }
+  ;
+
+namespace_import
+  : '*' as_keyword IDENTIFIER
+      { $<node>$ = NULL; }
+  ;
+
+module_specifier
+  : STRING
+      { $<node>$ = NULL; }
+  ;
+
+export_stmt
+  : EXPORT export_clause from_keyword module_specifier ';'
+      { $<node>$ = NULL; }
+  | EXPORT export_clause ';'
+      { $<node>$ = NULL; }
+  | EXPORT '*' from_keyword module_specifier ';'
+      { $<node>$ = NULL; }
+  | EXPORT '*' as_keyword IDENTIFIER from_keyword module_specifier ';'
+      { $<node>$ = NULL; }
+  | EXPORT var_stmt ';'
+      { $<node>$ = NULL; }
+  | EXPORT func_decl
+      { $<node>$ = NULL; }
+  | EXPORT class_decl
+      { $<node>$ = NULL; }
+  | EXPORT DEFAULT func_decl
+      { $<node>$ = NULL; }
+  | EXPORT DEFAULT class_decl
+      { $<node>$ = NULL; }
+    | EXPORT DEFAULT assignment_expr_no_obj ';'
+      { $<node>$ = NULL; }
+  ;
+
+export_clause
+    : '{' '}'
+            { $<node>$ = NULL; }
+    | '{' export_specifier_list opt_trailing_comma '}'
+            { $<node>$ = NULL; }
+    ;
+
+export_specifier_list
+  : export_specifier
+      { $<node>$ = NULL; }
+  | export_specifier_list ',' export_specifier
+      { $<node>$ = NULL; }
+  ;
+
+export_specifier
+  : IDENTIFIER
+      { $<node>$ = NULL; }
+  | IDENTIFIER as_keyword IDENTIFIER
+      { $<node>$ = NULL; }
+  | IDENTIFIER as_keyword DEFAULT
+      { $<node>$ = NULL; }
+  | DEFAULT as_keyword IDENTIFIER
+      { $<node>$ = NULL; }
+  | DEFAULT as_keyword DEFAULT
+      { $<node>$ = NULL; }
+  | DEFAULT
+      { $<node>$ = NULL; }
+  ;
+
+from_keyword
+  : IDENTIFIER
+      {
+          if (!identifier_is($1, ATOM(ctx->atoms, FROM))) {
+              yyerror(ctx, "Expected 'from' in module statement");
+              YYERROR;
+          }
+          $$ = NULL;
+      }
+  ;
+
+as_keyword
+  : IDENTIFIER
+      {
+          if (!identifier_is($1, ATOM(ctx->atoms, AS))) {
+              yyerror(ctx, "Expected 'as' in module statement");
+              YYERROR;
+          }
+          $$ = NULL;
+      }
+  ;
+
+block
+    : '{' stmt_list '}'
+            { $<node>$ = NULL; }
+    ;
+
+var_stmt
+  : VAR var_decl_list
+      { $<node>$ = NULL; }
+  | LET var_decl_list
+      { $<node>$ = NULL; }
+  | CONST var_decl_list
+      { $<node>$ = NULL; }
+  ;
+
+var_stmt_no_in
+  : VAR var_decl_list_no_in
+      { $<node>$ = NULL; }
+  | LET var_decl_list_no_in
+      { $<node>$ = NULL; }
+  | CONST var_decl_list_no_in
+      { $<node>$ = NULL; }
+  ;
+
+var_decl_list
+  : var_decl
+      { $<node>$ = NULL; }
+  | var_decl_list ',' var_decl
+      { $<node>$ = NULL; }
+  ;
+
+var_decl_list_no_in
+  : var_decl_no_in
+      { $<node>$ = NULL; }
+  | var_decl_list_no_in ',' var_decl_no_in
+      { $<node>$ = NULL; }
+  ;
+
+var_decl
+  : IDENTIFIER binding_initializer_opt
+      { $<node>$ = NULL; }
+  | object_binding '=' assignment_expr
+      { $<node>$ = NULL; }
+  | array_binding '=' assignment_expr
+      { $<node>$ = NULL; }
+  ;
+
+var_decl_no_in
+  : IDENTIFIER binding_initializer_opt_no_in
+      { $<node>$ = NULL; }
+  | object_binding '=' assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | array_binding '=' assignment_expr_no_in
+      { $<node>$ = NULL; }
+  ;
+
+return_stmt
+  : RETURN
+      { $<node>$ = NULL; }
+  | RETURN expr
+      { $<node>$ = NULL; }
+  ;
+
+if_stmt
+    : IF '(' expr ')' stmt %prec IF_NO_ELSE
+            { $<node>$ = NULL; }
+  | IF '(' expr ')' stmt ELSE stmt
+      { $<node>$ = NULL; }
+  ;
+
+for_stmt
+  : FOR '(' for_init ';' opt_expr ';' opt_expr ')' stmt
+      { $<node>$ = NULL; }
+  | FOR '(' for_in_left IN expr ')' stmt
+      { $<node>$ = NULL; }
+  | FOR '(' for_in_left for_of_keyword expr ')' stmt
+    { $<node>$ = NULL; }
+    | FOR AWAIT '(' for_in_left for_of_keyword expr ')' stmt
+        { $<node>$ = NULL; }
+  ;
+
+while_stmt
+    : WHILE '(' expr ')' stmt
+            { $<node>$ = NULL; }
+    ;
+
+do_stmt
+    : DO stmt WHILE '(' expr ')' ';'
+        { $<node>$ = NULL; }
+    ;
+
+for_init
+  : /* empty */
+      { $<node>$ = NULL; }
+    | var_stmt_no_in
+      { $<node>$ = NULL; }
+    | expr_no_in_no_obj
+      { $<node>$ = NULL; }
+  ;
+
+for_in_left
+  : for_binding
+      { $<node>$ = NULL; }
+  | assignment_pattern
+      { $<node>$ = NULL; }
+  | left_hand_side_expr_no_obj
+      { $<node>$ = NULL; }
+  ;
+
+for_of_keyword
+  : IDENTIFIER
+      {
+          if (!identifier_is($1, ATOM(ctx->atoms, OF))) {
+              yyerror(ctx, "Expected 'of' in for-of statement");
+              YYERROR;
+          }
+          $$ = NULL;
+      }
+  ;
+
+opt_expr
+  : /* empty */
+      { $<node>$ = NULL; }
+  | expr
+      { $<node>$ = NULL; }
+  ;
+
+switch_stmt
+    : SWITCH '(' expr ')' '{' switch_case_list '}'
+            { $<node>$ = NULL; }
+    ;
+
+switch_case_list
+    : /* empty */
+            { $<node>$ = NULL; }
+    | switch_case_list switch_case
+            { $<node>$ = NULL; }
+    ;
+
+switch_case
+    : CASE expr ':' case_stmt_seq
+            { $<node>$ = NULL; }
+    | DEFAULT ':' case_stmt_seq
+            { $<node>$ = NULL; }
+    ;
+
+case_stmt_seq
+    : /* empty */
+            { $<node>$ = NULL; }
+    | case_stmt_seq stmt
+            { $<node>$ = NULL; }
+    ;
+
+generator_marker_opt
+  : '*'
+      { $<node>$ = NULL; }
+  | /* empty */
+      { $<node>$ = NULL; }
+  ;
+
+async_modifier_opt
+  : ASYNC
+      { $<node>$ = NULL; }
+  | /* empty */
+      { $<node>$ = NULL; }
+  ;
+
+func_decl
+    : async_modifier_opt FUNCTION_DECL generator_marker_opt IDENTIFIER '(' opt_param_list ')' block
+      { $<node>$ = NULL; }
+    | async_modifier_opt FUNCTION_DECL generator_marker_opt '(' opt_param_list ')' block
+      { $<node>$ = NULL; }
+  ;
+
+// 只验证语法时参数表只数个数，类中 get/set 方法的参数个数检查要用
+opt_param_list
+  : /* empty */
+      { $<node>$ = NULL; }
+  | param_list
+      { $<count>$ = $<count>1; }
+  ;
+
+param_list
+  : param_list_items
+      { $<count>$ = $<count>1; }
+  | param_list_items ',' rest_param
+      { $<count>$ = $<count>1 + 1; }
+  | rest_param
+      { $<count>$ = 1; }
+  ;
+
+param_list_items
+  : binding_element
+      { $<count>$ = 1; }
+  | param_list_items ',' binding_element
+      { $<count>$ = $<count>1 + 1; }
+  ;
+
+rest_param
+  : binding_rest_element
+      { $<node>$ = NULL; }
+  ;
+
+catch_clause
+    : CATCH '(' catch_parameter ')' block
+        { $<node>$ = NULL; }
+    ;
+
+catch_parameter
+    : IDENTIFIER
+        { $<node>$ = NULL; }
+    | object_binding
+        { $<node>$ = NULL; }
+    | array_binding
+        { $<node>$ = NULL; }
+    ;
+
+finally_clause
+    : FINALLY block
+            { $<node>$ = NULL; }
+    ;
+
+finally_clause_opt
+    : /* empty */
+            { $<node>$ = NULL; }
+    | finally_clause
+            { $<node>$ = NULL; }
+    ;
+
+try_stmt
+    : TRY block catch_clause finally_clause_opt
+            { $<node>$ = NULL; }
+    | TRY block finally_clause
+            { $<node>$ = NULL; }
+    ;
+
+with_stmt
+    : WITH '(' expr ')' stmt
+            { $<node>$ = NULL; }
+    ;
+
+labeled_stmt
+    : IDENTIFIER ':' stmt
+            { $<node>$ = NULL; }
+    ;
+
+break_stmt
+    : BREAK
+            { $<node>$ = NULL; }
+    | BREAK IDENTIFIER
+            { $<node>$ = NULL; }
+    ;
+
+continue_stmt
+    : CONTINUE
+            { $<node>$ = NULL; }
+    | CONTINUE IDENTIFIER
+            { $<node>$ = NULL; }
+    ;
+
+throw_stmt
+    : THROW expr
+            { $<node>$ = NULL; }
+    ;
+
+// 表达式的限制变体由 gen_grammar 按参数生成：
+//   NoIn  —— for (init; ...) 的初始化部分，顶层不能出现 in 运算符
+//   NoObj —— 表达式语句、箭头函数体等位置，不能以 { 开头（否则与语句块冲突）
+// 赋值左侧与右值共用同一个 postfix_expr，读到 '=' 之前不必决定走哪条路
+expr
+  : assignment_expr
+      { $<node>$ = NULL; }
+  | expr ',' assignment_expr
+            { $<node>$ = NULL; }
+  ;
+
+expr_no_obj
+  : assignment_expr_no_obj
+      { $<node>$ = NULL; }
+  | expr_no_obj ',' assignment_expr
+            { $<node>$ = NULL; }
+  ;
+
+expr_no_in_no_obj
+  : assignment_expr_no_in_no_obj
+      { $<node>$ = NULL; }
+  | expr_no_in_no_obj ',' assignment_expr_no_in
+            { $<node>$ = NULL; }
+  ;
+
+assignment_expr
+	: postfix_expr '=' assignment_expr
+	    { $<node>$ = NULL; }
+  | postfix_expr PLUS_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr MINUS_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr STAR_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr SLASH_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr PERCENT_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr AND_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr OR_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr XOR_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr LSHIFT_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr RSHIFT_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr URSHIFT_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | arrow_function
+      { $<node>$ = NULL; }
+    | conditional_expr
+      { $<node>$ = NULL; }
+    | yield_expr
+            { $<node>$ = NULL; }
+  ;
+
+assignment_expr_no_in
+	: postfix_expr '=' assignment_expr_no_in
+	    { $<node>$ = NULL; }
+  | postfix_expr PLUS_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr MINUS_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr STAR_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr SLASH_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr PERCENT_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr AND_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr OR_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr XOR_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr LSHIFT_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr RSHIFT_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr URSHIFT_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | arrow_function
+      { $<node>$ = NULL; }
+    | conditional_expr_no_in
+      { $<node>$ = NULL; }
+    | yield_expr
+            { $<node>$ = NULL; }
+  ;
+
+assignment_expr_no_obj
+	: postfix_expr_no_obj '=' assignment_expr
+	    { $<node>$ = NULL; }
+  | postfix_expr_no_obj PLUS_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj MINUS_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj STAR_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj SLASH_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj PERCENT_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj AND_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj OR_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj XOR_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj LSHIFT_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj RSHIFT_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj URSHIFT_ASSIGN assignment_expr
+      { $<node>$ = NULL; }
+  | arrow_function
+      { $<node>$ = NULL; }
+    | conditional_expr_no_obj
+      { $<node>$ = NULL; }
+    | yield_expr
+            { $<node>$ = NULL; }
+  ;
+
+assignment_expr_no_in_no_obj
+	: postfix_expr_no_obj '=' assignment_expr_no_in
+	    { $<node>$ = NULL; }
+  | postfix_expr_no_obj PLUS_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj MINUS_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj STAR_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj SLASH_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj PERCENT_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj AND_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj OR_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj XOR_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj LSHIFT_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj RSHIFT_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj URSHIFT_ASSIGN assignment_expr_no_in
+      { $<node>$ = NULL; }
+  | arrow_function
+      { $<node>$ = NULL; }
+    | conditional_expr_no_in_no_obj
+      { $<node>$ = NULL; }
+    | yield_expr
+            { $<node>$ = NULL; }
+  ;
+
+conditional_expr
+    : binary_expr
+        { $<node>$ = NULL; }
+    | binary_expr '?' assignment_expr ':' assignment_expr
+        { $<node>$ = NULL; }
+    ;
+
+conditional_expr_no_in
+    : binary_expr_no_in
+        { $<node>$ = NULL; }
+    | binary_expr_no_in '?' assignment_expr ':' assignment_expr
+        { $<node>$ = NULL; }
+    ;
+
+conditional_expr_no_obj
+    : binary_expr_no_obj
+        { $<node>$ = NULL; }
+    | binary_expr_no_obj '?' assignment_expr ':' assignment_expr
+        { $<node>$ = NULL; }
+    ;
+
+conditional_expr_no_in_no_obj
+    : binary_expr_no_in_no_obj
+        { $<node>$ = NULL; }
+    | binary_expr_no_in_no_obj '?' assignment_expr ':' assignment_expr
+        { $<node>$ = NULL; }
+    ;
+
+// 二元表达式不按优先级逐级展开：文法只收集“操作数 运算符 操作数 ...”，
+// 由 fold_binary_chain 按优先级结合（单个操作数直接归约，不经过任何中间层）。
+// NoIn 只是运算符集合去掉 in；NoObj 只限制第一个操作数不能以 { 开头
+binary_expr
+    : unary_expr
+        { $<node>$ = NULL; }
+    | binary_chain
+        { $<node>$ = NULL; }
+    ;
+
+binary_expr_no_in
+    : unary_expr
+        { $<node>$ = NULL; }
+    | binary_chain_no_in
+        { $<node>$ = NULL; }
+    ;
+
+binary_expr_no_obj
+    : unary_expr_no_obj
+        { $<node>$ = NULL; }
+    | binary_chain_no_obj
+        { $<node>$ = NULL; }
+    ;
+
+binary_expr_no_in_no_obj
+    : unary_expr_no_obj
+        { $<node>$ = NULL; }
+    | binary_chain_no_in_no_obj
+        { $<node>$ = NULL; }
+    ;
+
+binary_chain
+    : unary_expr binary_operator unary_expr
+        { $<node>$ = NULL; }
+    | binary_chain binary_operator unary_expr
+        { $<node>$ = NULL; }
+    ;
+
+binary_chain_no_in
+    : unary_expr binary_operator_no_in unary_expr
+        { $<node>$ = NULL; }
+    | binary_chain_no_in binary_operator_no_in unary_expr
+        { $<node>$ = NULL; }
+    ;
+
+binary_chain_no_obj
+    : unary_expr_no_obj binary_operator unary_expr
+        { $<node>$ = NULL; }
+    | binary_chain_no_obj binary_operator unary_expr
+        { $<node>$ = NULL; }
+    ;
+
+binary_chain_no_in_no_obj
+    : unary_expr_no_obj binary_operator_no_in unary_expr
+        { $<node>$ = NULL; }
+    | binary_chain_no_in_no_obj binary_operator_no_in unary_expr
+        { $<node>$ = NULL; }
+    ;
+
+binary_operator
+    : OR
+        { $<node>$ = NULL; }
+    | AND
+        { $<node>$ = NULL; }
+    | '|'
+        { $<node>$ = NULL; }
+    | '^'
+        { $<node>$ = NULL; }
+    | '&'
+        { $<node>$ = NULL; }
+    | EQ
+        { $<node>$ = NULL; }
+    | NE
+        { $<node>$ = NULL; }
+    | EQ_STRICT
+        { $<node>$ = NULL; }
+    | NE_STRICT
+        { $<node>$ = NULL; }
+    | '<'
+        { $<node>$ = NULL; }
+    | '>'
+        { $<node>$ = NULL; }
+    | LE
+        { $<node>$ = NULL; }
+    | GE
+        { $<node>$ = NULL; }
+    | INSTANCEOF
+        { $<node>$ = NULL; }
+    | LSHIFT
+        { $<node>$ = NULL; }
+    | RSHIFT
+        { $<node>$ = NULL; }
+    | URSHIFT
+        { $<node>$ = NULL; }
+    | '+'
+        { $<node>$ = NULL; }
+    | '-'
+        { $<node>$ = NULL; }
+    | '*'
+        { $<node>$ = NULL; }
+    | '*' '*'
+        { $<node>$ = NULL; }
+    | '/'
+        { $<node>$ = NULL; }
+    | '%'
+        { $<node>$ = NULL; }
+    | IN
+        { $<node>$ = NULL; }
+    ;
+
+binary_operator_no_in
+    : OR
+        { $<node>$ = NULL; }
+    | AND
+        { $<node>$ = NULL; }
+    | '|'
+        { $<node>$ = NULL; }
+    | '^'
+        { $<node>$ = NULL; }
+    | '&'
+        { $<node>$ = NULL; }
+    | EQ
+        { $<node>$ = NULL; }
+    | NE
+        { $<node>$ = NULL; }
+    | EQ_STRICT
+        { $<node>$ = NULL; }
+    | NE_STRICT
+        { $<node>$ = NULL; }
+    | '<'
+        { $<node>$ = NULL; }
+    | '>'
+        { $<node>$ = NULL; }
+    | LE
+        { $<node>$ = NULL; }
+    | GE
+        { $<node>$ = NULL; }
+    | INSTANCEOF
+        { $<node>$ = NULL; }
+    | LSHIFT
+        { $<node>$ = NULL; }
+    | RSHIFT
+        { $<node>$ = NULL; }
+    | URSHIFT
+        { $<node>$ = NULL; }
+    | '+'
+        { $<node>$ = NULL; }
+    | '-'
+        { $<node>$ = NULL; }
+    | '*'
+        { $<node>$ = NULL; }
+    | '*' '*'
+        { $<node>$ = NULL; }
+    | '/'
+        { $<node>$ = NULL; }
+    | '%'
+        { $<node>$ = NULL; }
+    ;
+
+// 前缀运算符之后的操作数不再受 NoObj 限制：+{} 中的 { 不可能是语句块
+unary_expr
+    : postfix_expr
+            { $<node>$ = NULL; }
+  | '+' unary_expr
+      { $<node>$ = NULL; }
+  | '-' unary_expr %prec UMINUS
+      { $<node>$ = NULL; }
+  | '!' unary_expr
+      { $<node>$ = NULL; }
+  | '~' unary_expr
+      { $<node>$ = NULL; }
+  | TYPEOF unary_expr
+      { $<node>$ = NULL; }
+  | DELETE unary_expr
+      { $<node>$ = NULL; }
+  | VOID unary_expr
+      { $<node>$ = NULL; }
+  | AWAIT unary_expr
+      { $<node>$ = NULL; }
+  | PLUS_PLUS unary_expr
+      { $<node>$ = NULL; }
+  | MINUS_MINUS unary_expr
+      { $<node>$ = NULL; }
+  ;
+
+unary_expr_no_obj
+    : postfix_expr_no_obj
+            { $<node>$ = NULL; }
+  | '+' unary_expr
+      { $<node>$ = NULL; }
+  | '-' unary_expr %prec UMINUS
+      { $<node>$ = NULL; }
+  | '!' unary_expr
+      { $<node>$ = NULL; }
+  | '~' unary_expr
+      { $<node>$ = NULL; }
+  | TYPEOF unary_expr
+      { $<node>$ = NULL; }
+  | DELETE unary_expr
+      { $<node>$ = NULL; }
+  | VOID unary_expr
+      { $<node>$ = NULL; }
+  | AWAIT unary_expr
+      { $<node>$ = NULL; }
+  | PLUS_PLUS unary_expr
+      { $<node>$ = NULL; }
+  | MINUS_MINUS unary_expr
+      { $<node>$ = NULL; }
+  ;
+
+postfix_expr
+  : left_hand_side_expr
+      { $<node>$ = NULL; }
+  | postfix_expr PLUS_PLUS
+      { $<node>$ = NULL; }
+  | postfix_expr MINUS_MINUS
+      { $<node>$ = NULL; }
+  ;
+
+postfix_expr_no_obj
+  : left_hand_side_expr_no_obj
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj PLUS_PLUS
+      { $<node>$ = NULL; }
+  | postfix_expr_no_obj MINUS_MINUS
+      { $<node>$ = NULL; }
+  ;
+
+left_hand_side_expr
+  : call_expr
+      { $<node>$ = NULL; }
+  | new_expr
+      { $<node>$ = NULL; }
+  ;
+
+left_hand_side_expr_no_obj
+  : call_expr_no_obj
+      { $<node>$ = NULL; }
+  | new_expr_no_obj
+      { $<node>$ = NULL; }
+  ;
+
+member_expr
+  : primary_expr member_suffix_seq
+      { $<node>$ = NULL; }
+  | NEW member_expr '(' opt_arg_list ')' member_suffix_seq
+      { $<node>$ = NULL; }
+  ;
+
+member_expr_no_obj
+  : primary_expr_no_obj member_suffix_seq
+      { $<node>$ = NULL; }
+  | NEW member_expr '(' opt_arg_list ')' member_suffix_seq
+      { $<node>$ = NULL; }
+  ;
+
+new_expr
+  : member_expr
+      { $<node>$ = NULL; }
+  | NEW new_expr
+      { $<node>$ = NULL; }
+  ;
+
+new_expr_no_obj
+  : member_expr_no_obj
+      { $<node>$ = NULL; }
+  | NEW new_expr
+      { $<node>$ = NULL; }
+  ;
+
+call_expr
+  : member_expr call_suffix_seq
+      { $<node>$ = NULL; }
+  ;
+
+call_expr_no_obj
+  : member_expr_no_obj call_suffix_seq
+      { $<node>$ = NULL; }
+  ;
+
+member_suffix_seq
+    : /* empty */
+            { $<node>$ = NULL; }
+    | member_suffix_seq member_noncall_suffix
+            { $<node>$ = NULL; }
+    ;
+
+member_noncall_suffix
+    : '.' property_name
+            { $<node>$ = NULL; }
+    | '[' expr ']'
+            { $<node>$ = NULL; }
+    | template_literal
+            { $<node>$ = NULL; }
+    ;
+
+call_suffix_seq
+    : call_suffix_seq call_any_suffix
+            { $<node>$ = NULL; }
+    | call_suffix_initial
+            { $<node>$ = NULL; }
+    ;
+
+call_any_suffix
+    : call_suffix_initial
+            { $<node>$ = NULL; }
+    | member_noncall_suffix
+            { $<node>$ = NULL; }
+    ;
+
+call_suffix_initial
+    : '(' opt_arg_list ')'
+            { $<node>$ = NULL; }
+    ;
+
+opt_arg_list
+  : /* empty */
+      { $<node>$ = NULL; }
+  | arg_list
+      { $<node>$ = NULL; }
+  ;
+
+arg_list
+  : arg_item
+      { $<node>$ = NULL; }
+  | arg_list ',' arg_item
+      { $<node>$ = NULL; }
+  ;
+
+arg_item
+  : assignment_expr
+      { $<node>$ = NULL; }
+  | spread_element
+      { $<node>$ = NULL; }
+  ;
+
+// NoObj 去掉以 { 或 class 开头的候选：它们在语句开头分别是语句块和类声明
+primary_expr
+  : IDENTIFIER
+      { $<node>$ = NULL; }
+  | THIS
+        { $<node>$ = NULL; }
+  | NUMBER
+      { $<node>$ = NULL; }
+  | STRING
+      { $<node>$ = NULL; }
+  | REGEX
+      { $<node>$ = NULL; }
+  | TRUE
+      { $<node>$ = NULL; }
+  | FALSE
+      { $<node>$ = NULL; }
+  | NULL_T
+      { $<node>$ = NULL; }
+  | UNDEFINED
+      { $<node>$ = NULL; }
+  | '(' expr ')'
+      { $<node>$ = NULL; }
+  | array_literal
+      { $<node>$ = NULL; }
+  | object_literal
+      { $<node>$ = NULL; }
+  | template_literal
+      { $<node>$ = NULL; }
+  | class_expr
+      { $<node>$ = NULL; }
+  | SUPER
+      { $<node>$ = NULL; }
+  | function_expr
+      { $<node>$ = NULL; }
+  ;
+
+primary_expr_no_obj
+  : IDENTIFIER
+      { $<node>$ = NULL; }
+  | THIS
+        { $<node>$ = NULL; }
+  | NUMBER
+      { $<node>$ = NULL; }
+  | STRING
+      { $<node>$ = NULL; }
+  | REGEX
+      { $<node>$ = NULL; }
+  | TRUE
+      { $<node>$ = NULL; }
+  | FALSE
+      { $<node>$ = NULL; }
+  | NULL_T
+      { $<node>$ = NULL; }
+  | UNDEFINED
+      { $<node>$ = NULL; }
+  | '(' expr ')'
+      { $<node>$ = NULL; }
+  | array_literal
+      { $<node>$ = NULL; }
+  | template_literal
+      { $<node>$ = NULL; }
+  | SUPER
+      { $<node>$ = NULL; }
+  | function_expr
+      { $<node>$ = NULL; }
+  ;
+
+function_expr
+    : async_modifier_opt FUNCTION generator_marker_opt IDENTIFIER '(' opt_param_list ')' block
+      { $<node>$ = NULL; }
+  | async_modifier_opt FUNCTION generator_marker_opt '(' opt_param_list ')' block
+      { $<node>$ = NULL; }
+  ;
+
+class_decl
+    : CLASS IDENTIFIER class_heritage_opt class_body
+            { $<node>$ = NULL; }
+    ;
+
+class_expr
+    : CLASS IDENTIFIER class_heritage_opt class_body
+            { $<node>$ = NULL; }
+    | CLASS class_heritage_opt class_body
+            { $<node>$ = NULL; }
+    ;
+
+class_heritage_opt
+    : EXTENDS assignment_expr
+            { $<node>$ = NULL; }
+    | /* empty */
+            { $<node>$ = NULL; }
+    ;
+
+class_body
+    : '{' class_element_list_opt '}'
+            { $<node>$ = NULL; }
+    ;
+
+class_element_list_opt
+    : /* empty */
+            { $<node>$ = NULL; }
+    | class_element_list
+            { $<node>$ = NULL; }
+    ;
+
+class_element_list
+    : class_element_list class_element
+            { $<node>$ = NULL; }
+    | class_element
+            { $<node>$ = NULL; }
+    ;
+
+// 修饰符检查（static、get/set 及其参数个数）决定是否报错，只验证语法时也要执行
+class_element
+    : method_definition
+        { $$ = build_method_node(maybe_tag_constructor(ctx, $1)); }
+    | IDENTIFIER method_definition
+        {
+            MethodInfo *method = handle_single_prefix(ctx, $1, $2);
+            if (!method) {
+                YYERROR;
+            }
+            $$ = build_method_node(method);
+        }
+    | IDENTIFIER IDENTIFIER method_definition
+        {
+            MethodInfo *method = handle_double_prefix(ctx, $1, $2, $3);
+            if (!method) {
+                YYERROR;
+            }
+            $$ = build_method_node(method);
+        }
+    | ';'
+        { $<node>$ = NULL; }
+    ;
+
+// 修饰符不写成可空的 async_modifier_opt：对象字面量里读到 { 后的标识符时，
+// 不必先决定是否归约一个空的修饰符（那会在每个属性名上分裂 GLR 栈）
+method_definition
+    : method_head '(' opt_param_list ')' block
+            {
+                $$ = $1;
+                $$->param_count = $<count>3;
+            }
+    ;
+
+method_head
+    : method_name
+            { $$ = $1; }
+    | ASYNC method_name
+            {
+                $$ = $2;
+                $$->is_async = true;
+            }
+    | '*' method_name
+            {
+                $$ = $2;
+                $$->is_generator = true;
+            }
+    | ASYNC '*' method_name
+            {
+                $$ = $3;
+                $$->is_async = true;
+                $$->is_generator = true;
+            }
+    ;
+
+getter_definition
+    : IDENTIFIER method_name '(' ')' block
+            {
+                if (!identifier_is($1, ATOM(ctx->atoms, GET))) {
+                    yyerror(ctx, "Unexpected identifier before getter definition");
+                    method_info_free($2);
+                    YYERROR;
+                }
+                $2->kind = AST_METHOD_KIND_GET;
+                $$ = build_method_node(method_info_set_function($2, NULL, $5));
+            }
+    ;
+
+setter_definition
+    : IDENTIFIER method_name '(' binding_element ')' block
+            {
+                if (!identifier_is($1, ATOM(ctx->atoms, SET))) {
+                    yyerror(ctx, "Unexpected identifier before setter definition");
+                    method_info_free($2);
+                    YYERROR;
+                }
+                $2->kind = AST_METHOD_KIND_SET;
+                $$ = build_method_node(method_info_set_function($2, make_single_param_list($4), $6));
+            }
+    ;
+
+method_name
+    : property_name
+            { $$ = method_info_alloc($1, NULL, false); }
+    | '[' assignment_expr ']'
+            { $$ = method_info_alloc(NULL, $2, true); }
+    ;
+
+// arrow_body 归约出还没有参数的箭头函数节点，这里补上参数（与 async）
+arrow_function
+  : IDENTIFIER ARROW arrow_body %dprec 2
+      { $<node>$ = NULL; }
+  | ARROW_HEAD '(' opt_param_list ')' ARROW arrow_body %dprec 2
+      { $<node>$ = NULL; }
+  | ASYNC IDENTIFIER ARROW arrow_body %dprec 2
+      { $<node>$ = NULL; }
+  | ASYNC ARROW_HEAD '(' opt_param_list ')' ARROW arrow_body %dprec 2
+      { $<node>$ = NULL; }
+  ;
+
+arrow_body
+    : assignment_expr_no_obj
+      { $<node>$ = NULL; }
+  | block
+      { $<node>$ = NULL; }
+  ;
+
+yield_expr
+  : YIELD
+      { $<node>$ = NULL; }
+  | YIELD assignment_expr
+      { $<node>$ = NULL; }
+  | YIELD '*' assignment_expr
+      { $<node>$ = NULL; }
+  ;
+
+array_literal
+  : '[' ']'
+      { $<node>$ = NULL; }
+  | '[' elision ']'
+      { $<node>$ = NULL; }
+  | '[' element_list ']'
+      { $<node>$ = NULL; }
+  | '[' element_list ',' ']'
+      { $<node>$ = NULL; }
+  ;
+
+elision
+  : ','
+      { $<node>$ = NULL; }
+  | elision ','
+      { $<node>$ = NULL; }
+  ;
+
+elision_opt
+  : /* empty */
+      { $<node>$ = NULL; }
+  | elision
+      { $<node>$ = NULL; }
+  ;
+
+element_list
+  : elision_opt el_item
+      { $<node>$ = NULL; }
+  | element_list ',' elision_opt el_item
+      { $<node>$ = NULL; }
+  | element_list ',' elision
+      { $<node>$ = NULL; }
+  ;
+
+el_item
+  : assignment_expr
+      { $<node>$ = NULL; }
+  | spread_element
+      { $<node>$ = NULL; }
+  ;
+
+spread_element
+    : ELLIPSIS assignment_expr
+            { $<node>$ = NULL; }
+    ;
+
+opt_trailing_comma
+  : /* empty */
+  | ','
+  ;
+
+object_literal
+  : '{' '}'
+      { $<node>$ = NULL; }
+  | '{' prop_list opt_trailing_comma '}'
+      { $<node>$ = NULL; }
+  ;
+
+template_literal
+  : TEMPLATE_NO_SUB
+      { $<node>$ = NULL; }
+  | TEMPLATE_HEAD template_part_list
+      { $<node>$ = NULL; }
+  ;
+
+// 右递归从尾部向前构造模板字面量节点，每一层把本层的表达式与片段接到两个列表前面
+template_part_list
+  : assignment_expr TEMPLATE_TAIL
+      { $<node>$ = NULL; }
+  | assignment_expr TEMPLATE_MIDDLE template_part_list
+      { $<node>$ = NULL; }
+  ;
+
+prop_list
+  : prop
+      { $<node>$ = NULL; }
+  | prop_list ',' prop
+      { $<node>$ = NULL; }
+  ;
+
+prop
+  : property_name ':' assignment_expr
+      { $<node>$ = NULL; }
+  | IDENTIFIER
+      { $<node>$ = NULL; }
+  | method_definition
+      { $$ = build_method_node($1); }
+  | getter_definition
+      { $<node>$ = NULL; }
+  | setter_definition
+      { $<node>$ = NULL; }
+  | computed_property
+      { $<node>$ = NULL; }
+  | spread_element
+      { $<node>$ = NULL; }
+  ;
+
+computed_property
+  : '[' assignment_expr ']' ':' assignment_expr
+      { $<node>$ = NULL; }
+  ;
+
+// 只验证语法时只需要标识符（类里的 constructor 要靠它识别），关键字与字符串键都不会是 constructor
+property_name
+    : IDENTIFIER { $$ = $1; }
+    | property_name_keyword { $<node>$ = NULL; }
+    ;
+
+property_name_keyword
+    : STRING     { $<node>$ = NULL; }
+    | NUMBER     { $<node>$ = NULL; }
+    | DEFAULT    { $<node>$ = NULL; }
+    | IF         { $<node>$ = NULL; }
+    | ELSE       { $<node>$ = NULL; }
+    | FOR        { $<node>$ = NULL; }
+    | WHILE      { $<node>$ = NULL; }
+    | DO         { $<node>$ = NULL; }
+    | FUNCTION   { $<node>$ = NULL; }
+    | VAR        { $<node>$ = NULL; }
+    | LET        { $<node>$ = NULL; }
+    | CONST      { $<node>$ = NULL; }
+    | RETURN     { $<node>$ = NULL; }
+    | BREAK      { $<node>$ = NULL; }
+    | CONTINUE   { $<node>$ = NULL; }
+    | SWITCH     { $<node>$ = NULL; }
+    | CASE       { $<node>$ = NULL; }
+    | TRY        { $<node>$ = NULL; }
+    | CATCH      { $<node>$ = NULL; }
+    | FINALLY    { $<node>$ = NULL; }
+    | THROW      { $<node>$ = NULL; }
+    | NEW        { $<node>$ = NULL; }
+    | THIS       { $<node>$ = NULL; }
+    | TYPEOF     { $<node>$ = NULL; }
+    | DELETE     { $<node>$ = NULL; }
+    | IN         { $<node>$ = NULL; }
+    | INSTANCEOF { $<node>$ = NULL; }
+    | VOID       { $<node>$ = NULL; }
+    | WITH       { $<node>$ = NULL; }
+    | DEBUGGER   { $<node>$ = NULL; }
+    | TRUE       { $<node>$ = NULL; }
+    | FALSE      { $<node>$ = NULL; }
+    | NULL_T     { $<node>$ = NULL; }
+    | UNDEFINED  { $<node>$ = NULL; }
+    | CLASS      { $<node>$ = NULL; }
+    | EXTENDS    { $<node>$ = NULL; }
+    | SUPER      { $<node>$ = NULL; }
+    | ASYNC      { $<node>$ = NULL; }
+    | AWAIT      { $<node>$ = NULL; }
+    ;
+
+binding_initializer_opt
+  : /* empty */
+      { $<node>$ = NULL; }
+    | '=' assignment_expr
+      { $<node>$ = NULL; }
+  ;
+
+binding_initializer_opt_no_in
+  : /* empty */
+      { $<node>$ = NULL; }
+    | '=' assignment_expr_no_in
+      { $<node>$ = NULL; }
+  ;
+
+binding_element
+  : IDENTIFIER binding_initializer_opt
+      { $<node>$ = NULL; }
+  | object_binding binding_initializer_opt
+      { $<node>$ = NULL; }
+  | array_binding binding_initializer_opt
+      { $<node>$ = NULL; }
+  ;
+
+object_binding
+  : '{' '}'
+      { $<node>$ = NULL; }
+  | '{' binding_property_sequence '}'
+      { $<node>$ = NULL; }
+  ;
+
+binding_property_sequence
+  : binding_property_list opt_trailing_comma
+      { $<node>$ = NULL; }
+  | binding_property_list ',' binding_rest_property
+      { $<node>$ = NULL; }
+  | binding_rest_property
+      { $<node>$ = NULL; }
+  ;
+
+binding_property_list
+  : binding_property
+      { $<node>$ = NULL; }
+  | binding_property_list ',' binding_property
+      { $<node>$ = NULL; }
+  ;
+
+binding_property
+  : IDENTIFIER ':' binding_element
+      { $<node>$ = NULL; }
+  | property_name_keyword ':' binding_element
+      { $<node>$ = NULL; }
+  | IDENTIFIER binding_initializer_opt
+      { $<node>$ = NULL; }
+  ;
+
+binding_rest_property
+  : ELLIPSIS IDENTIFIER
+      { $<node>$ = NULL; }
+  ;
+
+array_binding
+  : '[' binding_elision_opt ']'
+      { $<node>$ = NULL; }
+  | '[' binding_elision_opt binding_element_list opt_trailing_comma ']'
+      { $<node>$ = NULL; }
+  | '[' binding_elision_opt binding_element_list ',' binding_elision_opt binding_rest_element opt_trailing_comma ']'
+      { $<node>$ = NULL; }
+  | '[' binding_elision_opt binding_rest_element opt_trailing_comma ']'
+      { $<node>$ = NULL; }
+  ;
+
+binding_element_list
+  : binding_element
+      { $<node>$ = NULL; }
+  | binding_element_list ',' binding_elision_opt binding_element
+      { $<node>$ = NULL; }
+  ;
+
+binding_elision_opt
+  : /* empty */
+      { $<node>$ = NULL; }
+  | binding_elision
+      { $<node>$ = NULL; }
+  ;
+
+binding_elision
+  : ','
+      { $<node>$ = NULL; }
+  | ',' binding_elision
+      { $<node>$ = NULL; }
+  ;
+
+binding_rest_element
+  : ELLIPSIS IDENTIFIER
+      { $<node>$ = NULL; }
+  ;
+
+assignment_pattern
+  : object_assignment_pattern
+      { $<node>$ = NULL; }
+  | array_assignment_pattern
+      { $<node>$ = NULL; }
+  ;
+
+object_assignment_pattern
+  : '{' '}'
+      { $<node>$ = NULL; }
+  | '{' assignment_property_sequence '}'
+      { $<node>$ = NULL; }
+  ;
+
+assignment_property_sequence
+  : assignment_property_list opt_trailing_comma
+      { $<node>$ = NULL; }
+  | assignment_property_list ',' assignment_rest_element
+      { $<node>$ = NULL; }
+  | assignment_rest_element
+      { $<node>$ = NULL; }
+  ;
+
+assignment_property_list
+  : assignment_property
+      { $<node>$ = NULL; }
+  | assignment_property_list ',' assignment_property
+      { $<node>$ = NULL; }
+  ;
+
+assignment_property
+  : IDENTIFIER ':' assignment_element
+      { $<node>$ = NULL; }
+  | property_name_keyword ':' assignment_element
+      { $<node>$ = NULL; }
+  | IDENTIFIER binding_initializer_opt
+      { $<node>$ = NULL; }
+  ;
+
+assignment_rest_element
+  : ELLIPSIS postfix_expr
+      { $<node>$ = NULL; }
+  ;
+
+array_assignment_pattern
+  : '[' binding_elision_opt ']'
+      { $<node>$ = NULL; }
+  | '[' binding_elision_opt assignment_element_list opt_trailing_comma ']'
+      { $<node>$ = NULL; }
+  | '[' binding_elision_opt assignment_element_list ',' binding_elision_opt assignment_rest_element opt_trailing_comma ']'
+      { $<node>$ = NULL; }
+  | '[' binding_elision_opt assignment_rest_element opt_trailing_comma ']'
+      { $<node>$ = NULL; }
+  ;
+
+assignment_element_list
+  : assignment_element
+      { $<node>$ = NULL; }
+  | assignment_element_list ',' binding_elision_opt assignment_element
+      { $<node>$ = NULL; }
+  ;
+
+assignment_element
+  : assignment_target binding_initializer_opt
+      { $<node>$ = NULL; }
+  ;
+
+assignment_target
+  : postfix_expr %dprec 1
+      { $<node>$ = NULL; }
+  | object_assignment_pattern %dprec 2
+      { $<node>$ = NULL; }
+  | array_assignment_pattern %dprec 2
+      { $<node>$ = NULL; }
+  ;
+
+for_binding
+  : VAR for_binding_declarator
+      { $<node>$ = NULL; }
+  | LET for_binding_declarator
+      { $<node>$ = NULL; }
+  | CONST for_binding_declarator
+      { $<node>$ = NULL; }
+  ;
+
+for_binding_declarator
+  : IDENTIFIER
+      { $<node>$ = NULL; }
+  | object_binding
+      { $<node>$ = NULL; }
+  | array_binding
+      { $<node>$ = NULL; }
+  ;
+
+%%
+
+#ifdef JS_PARSER_FAST
+
+// 快速路径的错误不报告：该语句会交给 GLR 重新解析，由它给出诊断
+void yyerror(JSParser *ctx, const char *s) {
+    (void)s;
+    ctx->statement_failed = true;
+}
+
+// 两个解析器由同一份文法生成，LALR 状态编号一致；语义值联合体的声明也相同
+bool fast_parser_compatible(size_t value_size) {
+    return value_size == sizeof(YYSTYPE) && parser_lr_state_count() == YYNSTATES;
+}
+
+FastParser *fast_parser_new(void) {
+    return yypstate_new();
+}
+
+void fast_parser_free(FastParser *parser) {
+    yypstate_delete(parser);
+}
+
+FastPushStatus fast_parser_push(FastParser *parser, int token, const void *value, JSParser *ctx) {
+    int status = yypush_parse(parser, token, (const YYSTYPE *)value, ctx);
+    if (status == YYPUSH_MORE) {
+        return FAST_PUSH_MORE;
+    }
+    return status == 0 ? FAST_PUSH_ACCEPTED : FAST_PUSH_FAILED;
+}
+
+// 在不改动解析器的前提下模拟读入 token 之后的归约序列（类似 LAC，只查表不执行动作），
+// 途经的每个状态都到 GLR 的表里检查这一格是否有冲突：没有冲突的路径上确定性解析与 GLR 完全一致
+bool fast_parser_lookahead_ok(const FastParser *parser, int token) {
+    yysymbol_kind_t symbol = token <= 0 ? YYSYMBOL_YYEOF : YYTRANSLATE(token);
+    const yy_state_t *base = parser->yyssp;  // 原栈中尚未被模拟弹出的栈顶
+    yy_state_t pushed[64];                   // 模拟中压入的状态
+    int pushed_count = 0;
+    int state = *base;
+    for (;;) {
+        if (parser_lr_conflict(state, symbol)) {
+            return false;
+        }
+        int rule;
+        int index = yypact[state] + symbol;
+        if (yypact_value_is_default(yypact[state]) || index < 0 || YYLAST < index || yycheck[index] != symbol) {
+            rule = yydefact[state];
+            if (rule == 0) {
+                return true;    // 语法错误，由 push 报告
+            }
+        } else if (yytable[index] > 0 || yytable_value_is_error(yytable[index])) {
+            return true;        // 移进（或错误）：归约序列到此结束
+        } else {
+            rule = -yytable[index];
+        }
+        int length = yyr2[rule];
+        if (length <= pushed_count) {
+            pushed_count -= length;
+        } else {
+            base -= length - pushed_count;
+            pushed_count = 0;
+        }
+        int top = pushed_count > 0 ? pushed[pushed_count - 1] : *base;
+        int lhs = yyr1[rule] - YYNTOKENS;
+        int goto_index = yypgoto[lhs] + top;
+        state = (0 <= goto_index && goto_index <= YYLAST && yycheck[goto_index] == top)
+                    ? yytable[goto_index] : yydefgoto[lhs];
+        if (pushed_count == (int)(sizeof(pushed) / sizeof(pushed[0]))) {
+            return false;
+        }
+        pushed[pushed_count++] = (yy_state_t)state;
+    }
+}
+
+// 放弃解析到一半的语句：按 %destructor 释放栈上的值，解析器回到初始状态
+void fast_parser_reset(FastParser *parser, JSParser *ctx) {
+    if (parser->yynew != 0) {
+        return;
+    }
+    while (parser->yyssp != parser->yyss) {
+        yydestruct("Fast path: discarding", YY_ACCESSING_SYMBOL(*parser->yyssp), parser->yyvsp, ctx);
+        parser->yyssp--;
+        parser->yyvsp--;
+    }
+    parser->yynew = 2;
+}
+
+#else
+
+void yyerror(JSParser *ctx, const char *s) {
+    ctx->error_count++;
+    if (ctx->print_errors) {
+        fprintf(stderr, "Syntax error #%d: %s\n", ctx->error_count, s);
+    }
+    diag_record_error(&ctx->diag, s);
+}
+
+// 只验证语法的解析器表与主解析器相同，表查询只由主解析器提供一份
+#ifndef JS_PARSER_VALIDATE
+int parser_lr_state_count(void) {
+    return YYNSTATES;
+}
+
+// 状态 state 遇到 symbol 时表里是否有多个动作（GLR 会在这里分裂）
+bool parser_lr_conflict(int state, int symbol) {
+    const short *conflicts;
+    yygetLRActions((yy_state_t)state, (yysymbol_kind_t)symbol, &conflicts);
+    return *conflicts != 0;
+}
+
+// 规则 rule（bison -v 的编号，即跟踪输出里的编号）的左部名字；parse.error verbose 时 yytname 总是存在
+const char *parser_rule_lhs(int rule) {
+    return yytname[yyr1[rule + 1]];
+}
+
+// 规则在生成的 parser.y 中的行号；yyrline 只在带跟踪代码的构建里有
+int parser_rule_line(int rule) {
+#if YYDEBUG
+    return yyrline[rule + 1];
+#else
+    (void)rule;
+    return 0;
+#endif
+}
+#endif
+
+#endif
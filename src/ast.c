@@ -1,4 +1,6 @@
 #include "ast.h"
+#include "escape.h"
+#include "numeric.h"
 
 #include <assert.h>
 #include <stdio.h>
@@ -15,18 +17,6 @@ static ASTNode *ast_alloc(ASTNodeType type) {
     return node;
 }
 
-static char *strip_quotes(char *text) {
-    if (!text) {
-        return NULL;
-    }
-    size_t len = strlen(text);
-    if (len >= 2 && (text[0] == '"' || text[0] == '\'')) {
-        memmove(text, text + 1, len - 2);
-        text[len - 2] = '\0';
-    }
-    return text;
-}
-
 ASTList *ast_list_append(ASTList *list, ASTNode *node) {
     if (!node) {
         return list;
@@ -115,19 +105,10 @@ ASTNode *ast_make_array_binding(ASTList *elements) {
     return node;
 }
 
-ASTNode *ast_make_binding_property(char *key, bool is_identifier, ASTNode *value, bool is_shorthand) {
+ASTNode *ast_make_binding_property(const char *key, bool is_identifier, ASTNode *value, bool is_shorthand) {
     ASTNode *node = ast_alloc(AST_BINDING_PROPERTY);
-    if (is_identifier) {
-        node->data.binding_property.key.name = key;
-        node->data.binding_property.key.is_identifier = true;
-    } else {
-        if (key && (key[0] == '\'' || key[0] == '"')) {
-            node->data.binding_property.key.name = strip_quotes(key);
-        } else {
-            node->data.binding_property.key.name = key;
-        }
-        node->data.binding_property.key.is_identifier = false;
-    }
+    node->data.binding_property.key.name = key;
+    node->data.binding_property.key.is_identifier = is_identifier;
     node->data.binding_property.value = value;
     node->data.binding_property.is_shorthand = is_shorthand;
     return node;
@@ -149,7 +130,7 @@ ASTNode *ast_make_array_hole(void) {
     return ast_alloc(AST_ARRAY_HOLE);
 }
 
-ASTNode *ast_make_class_decl(char *name, ASTNode *super_class, ASTList *body) {
+ASTNode *ast_make_class_decl(const char *name, ASTNode *super_class, ASTList *body) {
     ASTNode *node = ast_alloc(AST_CLASS_DECL);
     node->data.class_decl.name = name;
     node->data.class_decl.super_class = super_class;
@@ -157,7 +138,7 @@ ASTNode *ast_make_class_decl(char *name, ASTNode *super_class, ASTList *body) {
     return node;
 }
 
-ASTNode *ast_make_class_expr(char *name, ASTNode *super_class, ASTList *body) {
+ASTNode *ast_make_class_expr(const char *name, ASTNode *super_class, ASTList *body) {
     ASTNode *node = ast_alloc(AST_CLASS_EXPR);
     node->data.class_expr.name = name;
     node->data.class_expr.super_class = super_class;
@@ -165,7 +146,7 @@ ASTNode *ast_make_class_expr(char *name, ASTNode *super_class, ASTList *body) {
     return node;
 }
 
-ASTNode *ast_make_method_def(char *name, ASTNode *computed_key, bool computed, bool is_static, bool is_generator, bool is_async, ASTMethodKind kind, ASTNode *function) {
+ASTNode *ast_make_method_def(const char *name, ASTNode *computed_key, bool computed, bool is_static, bool is_generator, bool is_async, ASTMethodKind kind, ASTNode *function) {
     ASTNode *node = ast_alloc(AST_METHOD_DEF);
     node->data.method_def.name = name;
     node->data.method_def.computed_key = computed_key;
@@ -189,7 +170,7 @@ ASTNode *ast_make_import_decl(ASTList *specifiers, ASTNode *source) {
     return node;
 }
 
-ASTNode *ast_make_import_specifier(char *local_name, char *imported_name, bool is_namespace, bool is_default) {
+ASTNode *ast_make_import_specifier(const char *local_name, const char *imported_name, bool is_namespace, bool is_default) {
     ASTNode *node = ast_alloc(AST_IMPORT_SPECIFIER);
     node->data.import_specifier.local_name = local_name;
     node->data.import_specifier.imported_name = imported_name;
@@ -198,7 +179,7 @@ ASTNode *ast_make_import_specifier(char *local_name, char *imported_name, bool i
     return node;
 }
 
-ASTNode *ast_make_export_decl(bool is_default, bool export_all, char *export_all_alias, ASTNode *declaration, ASTList *specifiers, ASTNode *source) {
+ASTNode *ast_make_export_decl(bool is_default, bool export_all, const char *export_all_alias, ASTNode *declaration, ASTList *specifiers, ASTNode *source) {
     ASTNode *node = ast_alloc(AST_EXPORT_DECL);
     node->data.export_decl.is_default = is_default;
     node->data.export_decl.export_all = export_all;
@@ -209,7 +190,7 @@ ASTNode *ast_make_export_decl(bool is_default, bool export_all, char *export_all
     return node;
 }
 
-ASTNode *ast_make_export_specifier(char *local_name, char *exported_name, bool is_namespace) {
+ASTNode *ast_make_export_specifier(const char *local_name, const char *exported_name, bool is_namespace) {
     ASTNode *node = ast_alloc(AST_EXPORT_SPECIFIER);
     node->data.export_specifier.local_name = local_name;
     node->data.export_specifier.exported_name = exported_name;
@@ -224,7 +205,7 @@ ASTNode *ast_make_computed_property(ASTNode *key, ASTNode *value) {
     return node;
 }
 
-ASTNode *ast_make_function_decl(char *name, ASTList *params, ASTNode *body) {
+ASTNode *ast_make_function_decl(const char *name, ASTList *params, ASTNode *body) {
     ASTNode *node = ast_alloc(AST_FUNCTION_DECL);
     node->data.function_decl.name = name;
     node->data.function_decl.params = params;
@@ -234,7 +215,7 @@ ASTNode *ast_make_function_decl(char *name, ASTList *params, ASTNode *body) {
     return node;
 }
 
-ASTNode *ast_make_function_expr(char *name, ASTList *params, ASTNode *body){
+ASTNode *ast_make_function_expr(const char *name, ASTList *params, ASTNode *body){
     ASTNode *node = ast_alloc(AST_FUNCTION_EXPR);
     node->data.function_expr.name = name;
     node->data.function_expr.params = params;
@@ -352,20 +333,20 @@ ASTNode *ast_make_with(ASTNode *object, ASTNode *body) {
     return node;
 }
 
-ASTNode *ast_make_labeled(char *label, ASTNode *body) {
+ASTNode *ast_make_labeled(const char *label, ASTNode *body) {
     ASTNode *node = ast_alloc(AST_LABELED_STMT);
     node->data.labeled_stmt.label = label;
     node->data.labeled_stmt.body = body;
     return node;
 }
 
-ASTNode *ast_make_break(char *label) {
+ASTNode *ast_make_break(const char *label) {
     ASTNode *node = ast_alloc(AST_BREAK_STMT);
     node->data.break_stmt.label = label;
     return node;
 }
 
-ASTNode *ast_make_continue(char *label) {
+ASTNode *ast_make_continue(const char *label) {
     ASTNode *node = ast_alloc(AST_CONTINUE_STMT);
     node->data.continue_stmt.label = label;
     return node;
@@ -387,7 +368,7 @@ ASTNode *ast_make_empty_statement(void) {
     return ast_alloc(AST_EMPTY_STMT);
 }
 
-ASTNode *ast_make_identifier(char *name) {
+ASTNode *ast_make_identifier(const char *name) {
     ASTNode *node = ast_alloc(AST_IDENTIFIER);
     node->data.identifier.name = name;
     return node;
@@ -399,22 +380,35 @@ ASTNode *ast_make_this_expr(void)
     return node;
 }
 
-ASTNode *ast_make_number_literal(char *raw) {
+// raw 为 NUMBER token 的 atom 文本，由表持有
+ASTNode *ast_make_number_literal(const char *raw) {
     ASTNode *node = ast_alloc(AST_LITERAL);
-    node->data.literal.literal_type = AST_LITERAL_NUMBER;
-    if (raw) {
-        node->data.literal.value.number = strtod(raw, NULL);
-        free(raw);
+    size_t length = raw ? strlen(raw) : 0;
+    if (numeric_literal_is_bigint(raw, length)) {
+        node->data.literal.literal_type = AST_LITERAL_BIGINT;
+        node->data.literal.value.bigint = raw;
     } else {
-        node->data.literal.value.number = 0.0;
+        node->data.literal.literal_type = AST_LITERAL_NUMBER;
+        node->data.literal.value.number = numeric_literal_value(raw, length);
     }
     return node;
 }
 
+// raw 为含引号的 token 文本；引号不再原地 memmove 去掉，只记录中间部分的视图
 ASTNode *ast_make_string_literal(char *raw) {
     ASTNode *node = ast_alloc(AST_LITERAL);
     node->data.literal.literal_type = AST_LITERAL_STRING;
-    node->data.literal.value.string = strip_quotes(raw);
+    node->data.literal.value.string = raw;
+    if (raw) {
+        size_t len = strlen(raw);
+        if (len >= 2 && (raw[0] == '"' || raw[0] == '\'')) {
+            node->data.literal.raw = raw + 1;
+            node->data.literal.raw_length = len - 2;
+        } else {
+            node->data.literal.raw = raw;
+            node->data.literal.raw_length = len;
+        }
+    }
     return node;
 }
 
@@ -426,6 +420,8 @@ ASTNode *ast_make_string_literal_raw(char *raw) {
     } else {
         node->data.literal.value.string = (char *)calloc(1, sizeof(char));
     }
+    node->data.literal.raw = node->data.literal.value.string;
+    node->data.literal.raw_length = strlen(node->data.literal.raw);
     return node;
 }
 
@@ -466,6 +462,62 @@ ASTNode *ast_make_template_element(char *raw, bool is_tail) {
     return node;
 }
 
+const char *ast_literal_raw(const ASTNode *node, size_t *length) {
+    if (node && node->type == AST_LITERAL && node->data.literal.literal_type == AST_LITERAL_STRING) {
+        *length = node->data.literal.raw_length;
+        return node->data.literal.raw ? node->data.literal.raw : "";
+    }
+    if (node && node->type == AST_TEMPLATE_ELEMENT) {
+        *length = strlen(node->data.template_element.raw);
+        return node->data.template_element.raw;
+    }
+    *length = 0;
+    return NULL;
+}
+
+// 解码一次并缓存；没有反斜杠（模板还要求没有 CR）时 cooked 与 raw 相同，直接复用视图
+static const char *cook_literal(const char *raw, size_t raw_length, bool is_template, size_t *cooked_length) {
+    if (!memchr(raw, '\\', raw_length) && !(is_template && memchr(raw, '\r', raw_length))) {
+        *cooked_length = raw_length;
+        return raw;
+    }
+    char *buffer = (char *)malloc(raw_length + 1);
+    if (!buffer) {
+        fprintf(stderr, "Out of memory while decoding string literal\n");
+        exit(EXIT_FAILURE);
+    }
+    if (!escape_decode(raw, raw_length, is_template, buffer, cooked_length)) {
+        free(buffer);
+        *cooked_length = 0;
+        return NULL;
+    }
+    return buffer;
+}
+
+const char *ast_literal_cooked(ASTNode *node, size_t *length) {
+    size_t raw_length;
+    const char *raw = ast_literal_raw(node, &raw_length);
+    if (!raw) {
+        *length = 0;
+        return NULL;
+    }
+    if (node->type == AST_TEMPLATE_ELEMENT) {
+        if (!node->data.template_element.cooked_ready) {
+            node->data.template_element.cooked = cook_literal(raw, raw_length, true,
+                                                              &node->data.template_element.cooked_length);
+            node->data.template_element.cooked_ready = true;
+        }
+        *length = node->data.template_element.cooked_length;
+        return node->data.template_element.cooked;
+    }
+    if (!node->data.literal.cooked_ready) {
+        node->data.literal.cooked = cook_literal(raw, raw_length, false, &node->data.literal.cooked_length);
+        node->data.literal.cooked_ready = true;
+    }
+    *length = node->data.literal.cooked_length;
+    return node->data.literal.cooked;
+}
+
 ASTNode *ast_make_template_literal(ASTList *quasis, ASTList *expressions) {
     ASTNode *node = ast_alloc(AST_TEMPLATE_LITERAL);
     node->data.template_literal.quasis = quasis;
@@ -584,22 +636,10 @@ ASTNode *ast_make_object_literal(ASTList *properties) {
     return node;
 }
 
-ASTNode *ast_make_property(char *key, bool is_identifier, ASTNode *value) {
+ASTNode *ast_make_property(const char *key, bool is_identifier, ASTNode *value) {
     ASTNode *node = ast_alloc(AST_PROPERTY);
-    if (is_identifier) {
-        node->data.property.key.name = key;
-        node->data.property.key.is_identifier = true;
-    } else {
-        // 非标识符属性名（STRING 或 NUMBER）：
-        // - STRING 类型：剥离引号（保持原有逻辑）
-        // - NUMBER 类型：直接使用原 key
-        if (key != NULL && (key[0] == '\'' || key[0] == '"')) {
-            node->data.property.key.name = strip_quotes(key);
-        } else {
-            node->data.property.key.name = key;
-        }
-        node->data.property.key.is_identifier = false;
-    }
+    node->data.property.key.name = key;
+    node->data.property.key.is_identifier = is_identifier;
 
     node->data.property.value = value;
     return node;
@@ -1093,8 +1133,12 @@ static void ast_print_internal(const ASTNode *node, int indent) {
                 case AST_LITERAL_NUMBER:
                     printf("NumericLiteral value=%g\n", node->data.literal.value.number);
                     break;
+                case AST_LITERAL_BIGINT:
+                    printf("BigIntLiteral value=%s\n", node->data.literal.value.bigint);
+                    break;
                 case AST_LITERAL_STRING:
-                    printf("StringLiteral value=\"%s\"\n", node->data.literal.value.string ? node->data.literal.value.string : "");
+                    printf("StringLiteral value=\"%.*s\"\n", (int)node->data.literal.raw_length,
+                           node->data.literal.raw ? node->data.literal.raw : "");
                     break;
                 case AST_LITERAL_REGEX:
                     printf("RegexLiteral value=\"%s\"\n", node->data.literal.value.string ? node->data.literal.value.string : "");
@@ -1472,241 +1516,269 @@ void ast_print(const ASTNode *node) {
     ast_print_internal(node, 0);
 }
 
-void ast_free(ASTNode *node) {
+// 释放用显式栈代替递归，任意深度的嵌套都不会耗尽调用栈
+typedef struct {
+    ASTNode **items;
+    size_t count;
+    size_t capacity;
+} FreeStack;
+
+static void free_push(FreeStack *stack, ASTNode *node) {
     if (!node) {
         return;
     }
-    switch (node->type) {
-        case AST_PROGRAM:
-            ast_list_free(node->data.program.body);
-            break;
-        case AST_BLOCK:
-            ast_list_free(node->data.block.body);
-            break;
-        case AST_VAR_DECL:
-            ast_free(node->data.var_decl.binding);
-            break;
-        case AST_VAR_STMT:
-            ast_list_free(node->data.var_stmt.decls);
-            break;
-        case AST_FUNCTION_DECL:
-            free(node->data.function_decl.name);
-            ast_list_free(node->data.function_decl.params);
-            ast_free(node->data.function_decl.body);
-            break;
-        case AST_FUNCTION_EXPR:
-            free(node->data.function_expr.name);
-            ast_list_free(node->data.function_expr.params);
-            ast_free(node->data.function_expr.body);
-            break;
-        case AST_ARROW_FUNCTION:
-            ast_list_free(node->data.arrow_function.params);
-            ast_free(node->data.arrow_function.body);
-            break;
-        case AST_RETURN_STMT:
-            ast_free(node->data.return_stmt.argument);
-            break;
-        case AST_IF_STMT:
-            ast_free(node->data.if_stmt.test);
-            ast_free(node->data.if_stmt.consequent);
-            ast_free(node->data.if_stmt.alternate);
-            break;
-        case AST_FOR_STMT:
-            ast_free(node->data.for_stmt.init);
-            ast_free(node->data.for_stmt.test);
-            ast_free(node->data.for_stmt.update);
-            ast_free(node->data.for_stmt.body);
-            break;
-        case AST_FOR_IN_STMT:
-            ast_free(node->data.for_in_stmt.init);
-            ast_free(node->data.for_in_stmt.obj);
-            ast_free(node->data.for_in_stmt.body);
-            break;
-        case AST_FOR_OF_STMT:
-            ast_free(node->data.for_of_stmt.init);
-            ast_free(node->data.for_of_stmt.iterable);
-            ast_free(node->data.for_of_stmt.body);
-            break;
-        case AST_WHILE_STMT:
-            ast_free(node->data.while_stmt.test);
-            ast_free(node->data.while_stmt.body);
-            break;
-        case AST_DO_WHILE_STMT:
-            ast_free(node->data.do_while_stmt.body);
-            ast_free(node->data.do_while_stmt.test);
-            break;
-        case AST_SWITCH_STMT:
-            ast_free(node->data.switch_stmt.discriminant);
-            ast_list_free(node->data.switch_stmt.cases);
-            break;
-        case AST_TRY_STMT:
-            ast_free(node->data.try_stmt.block);
-            ast_free(node->data.try_stmt.handler);
-            ast_free(node->data.try_stmt.finalizer);
-            break;
-        case AST_WITH_STMT:
-            ast_free(node->data.with_stmt.object);
-            ast_free(node->data.with_stmt.body);
-            break;
-        case AST_LABELED_STMT:
-            free(node->data.labeled_stmt.label);
-            ast_free(node->data.labeled_stmt.body);
-            break;
-        case AST_BREAK_STMT:
-            free(node->data.break_stmt.label);
-            break;
-        case AST_CONTINUE_STMT:
-            free(node->data.continue_stmt.label);
-            break;
-        case AST_THROW_STMT:
-            ast_free(node->data.throw_stmt.argument);
-            break;
-        case AST_EXPR_STMT:
-            ast_free(node->data.expr_stmt.expression);
-            break;
-        case AST_EMPTY_STMT:
-            break;
-        case AST_IDENTIFIER:
-            free(node->data.identifier.name);
-            break;
-        case AST_THIS:
-            break;
-        case AST_LITERAL:
-            if (node->data.literal.literal_type == AST_LITERAL_STRING
-                || node->data.literal.literal_type == AST_LITERAL_REGEX) {
-                free(node->data.literal.value.string);
-            }
-            break;
-        case AST_TEMPLATE_LITERAL:
-            ast_list_free(node->data.template_literal.quasis);
-            ast_list_free(node->data.template_literal.expressions);
-            break;
-        case AST_TEMPLATE_ELEMENT:
-            free(node->data.template_element.raw);
-            break;
-        case AST_TAGGED_TEMPLATE:
-            ast_free(node->data.tagged_template.tag);
-            ast_free(node->data.tagged_template.template_literal);
-            break;
-        case AST_ASSIGN_EXPR:
-            ast_free(node->data.assign.left);
-            ast_free(node->data.assign.right);
-            break;
-        case AST_BINARY_EXPR:
-            ast_free(node->data.binary.left);
-            ast_free(node->data.binary.right);
-            break;
-        case AST_CONDITIONAL_EXPR:
-            ast_free(node->data.conditional.test);
-            ast_free(node->data.conditional.consequent);
-            ast_free(node->data.conditional.alternate);
-            break;
-        case AST_SEQUENCE_EXPR:
-            ast_list_free(node->data.sequence.elements);
-            break;
-        case AST_UNARY_EXPR:
-            ast_free(node->data.unary.argument);
-            break;
-        case AST_NEW_EXPR:
-            ast_free(node->data.new_expr.callee);
-            ast_list_free(node->data.new_expr.arguments);
-            break;
-        case AST_UPDATE_EXPR:
-            ast_free(node->data.update.argument);
-            break;
-        case AST_CALL_EXPR:
-            ast_free(node->data.call_expr.callee);
-            ast_list_free(node->data.call_expr.arguments);
-            break;
-        case AST_MEMBER_EXPR:
-            ast_free(node->data.member_expr.object);
-            ast_free(node->data.member_expr.property);
-            break;
-        case AST_YIELD_EXPR:
-            ast_free(node->data.yield_expr.argument);
-            break;
-        case AST_AWAIT_EXPR:
-            ast_free(node->data.await_expr.argument);
-            break;
-        case AST_ARRAY_LITERAL:
-            ast_list_free(node->data.array_literal.elements);
-            break;
-        case AST_OBJECT_LITERAL:
-            ast_list_free(node->data.object_literal.properties);
-            break;
-        case AST_PROPERTY:
-            free(node->data.property.key.name);
-            ast_free(node->data.property.value);
-            break;
-        case AST_COMPUTED_PROP:
-            ast_free(node->data.computed_prop.key);
-            ast_free(node->data.computed_prop.value);
-            break;
-        case AST_SWITCH_CASE:
-            ast_free(node->data.switch_case.test);
-            ast_list_free(node->data.switch_case.consequent);
-            break;
-        case AST_CATCH_CLAUSE:
-            ast_free(node->data.catch_clause.param);
-            ast_free(node->data.catch_clause.body);
-            break;
-        case AST_BINDING_PATTERN:
-            ast_free(node->data.binding_pattern.target);
-            ast_free(node->data.binding_pattern.initializer);
-            break;
-        case AST_OBJECT_BINDING:
-            ast_list_free(node->data.object_binding.properties);
-            break;
-        case AST_ARRAY_BINDING:
-            ast_list_free(node->data.array_binding.elements);
-            break;
-        case AST_BINDING_PROPERTY:
-            free(node->data.binding_property.key.name);
-            ast_free(node->data.binding_property.value);
-            break;
-        case AST_REST_ELEMENT:
-            ast_free(node->data.rest_element.argument);
-            break;
-        case AST_SPREAD_ELEMENT:
-            ast_free(node->data.spread_element.argument);
-            break;
-        case AST_ARRAY_HOLE:
-            break;
-        case AST_CLASS_DECL:
-            free(node->data.class_decl.name);
-            ast_free(node->data.class_decl.super_class);
-            ast_list_free(node->data.class_decl.body);
-            break;
-        case AST_CLASS_EXPR:
-            free(node->data.class_expr.name);
-            ast_free(node->data.class_expr.super_class);
-            ast_list_free(node->data.class_expr.body);
-            break;
-        case AST_METHOD_DEF:
-            free(node->data.method_def.name);
-            ast_free(node->data.method_def.computed_key);
-            ast_free(node->data.method_def.function);
-            break;
-        case AST_IMPORT_DECL:
-            ast_list_free(node->data.import_decl.specifiers);
-            ast_free(node->data.import_decl.source);
-            break;
-        case AST_IMPORT_SPECIFIER:
-            free(node->data.import_specifier.local_name);
-            free(node->data.import_specifier.imported_name);
-            break;
-        case AST_EXPORT_DECL:
-            free(node->data.export_decl.export_all_alias);
-            ast_free(node->data.export_decl.declaration);
-            ast_list_free(node->data.export_decl.specifiers);
-            ast_free(node->data.export_decl.source);
-            break;
-        case AST_EXPORT_SPECIFIER:
-            free(node->data.export_specifier.local_name);
-            free(node->data.export_specifier.exported_name);
-            break;
-        case AST_SUPER:
-            break;
+    if (stack->count == stack->capacity) {
+        size_t capacity = stack->capacity ? stack->capacity * 2 : 64;
+        ASTNode **grown = (ASTNode **)realloc(stack->items, capacity * sizeof(ASTNode *));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while freeing AST\n");
+            exit(EXIT_FAILURE);
+        }
+        stack->items = grown;
+        stack->capacity = capacity;
+    }
+    stack->items[stack->count++] = node;
+}
+
+static void free_push_list(FreeStack *stack, ASTList *list) {
+    while (list) {
+        ASTList *next = list->next;
+        free_push(stack, list->node);
+        free(list);
+        list = next;
+    }
+}
+
+// 名字字段（标识符、标签、属性键、导入导出名）是 atom，由驻留表统一释放，这里不逐个 free
+void ast_free(ASTNode *root) {
+    FreeStack stack = {NULL, 0, 0};
+    free_push(&stack, root);
+    while (stack.count > 0) {
+        ASTNode *node = stack.items[--stack.count];
+        switch (node->type) {
+            case AST_PROGRAM:
+                free_push_list(&stack, node->data.program.body);
+                break;
+            case AST_BLOCK:
+                free_push_list(&stack, node->data.block.body);
+                break;
+            case AST_VAR_DECL:
+                free_push(&stack, node->data.var_decl.binding);
+                break;
+            case AST_VAR_STMT:
+                free_push_list(&stack, node->data.var_stmt.decls);
+                break;
+            case AST_FUNCTION_DECL:
+                free_push_list(&stack, node->data.function_decl.params);
+                free_push(&stack, node->data.function_decl.body);
+                break;
+            case AST_FUNCTION_EXPR:
+                free_push_list(&stack, node->data.function_expr.params);
+                free_push(&stack, node->data.function_expr.body);
+                break;
+            case AST_ARROW_FUNCTION:
+                free_push_list(&stack, node->data.arrow_function.params);
+                free_push(&stack, node->data.arrow_function.body);
+                break;
+            case AST_RETURN_STMT:
+                free_push(&stack, node->data.return_stmt.argument);
+                break;
+            case AST_IF_STMT:
+                free_push(&stack, node->data.if_stmt.test);
+                free_push(&stack, node->data.if_stmt.consequent);
+                free_push(&stack, node->data.if_stmt.alternate);
+                break;
+            case AST_FOR_STMT:
+                free_push(&stack, node->data.for_stmt.init);
+                free_push(&stack, node->data.for_stmt.test);
+                free_push(&stack, node->data.for_stmt.update);
+                free_push(&stack, node->data.for_stmt.body);
+                break;
+            case AST_FOR_IN_STMT:
+                free_push(&stack, node->data.for_in_stmt.init);
+                free_push(&stack, node->data.for_in_stmt.obj);
+                free_push(&stack, node->data.for_in_stmt.body);
+                break;
+            case AST_FOR_OF_STMT:
+                free_push(&stack, node->data.for_of_stmt.init);
+                free_push(&stack, node->data.for_of_stmt.iterable);
+                free_push(&stack, node->data.for_of_stmt.body);
+                break;
+            case AST_WHILE_STMT:
+                free_push(&stack, node->data.while_stmt.test);
+                free_push(&stack, node->data.while_stmt.body);
+                break;
+            case AST_DO_WHILE_STMT:
+                free_push(&stack, node->data.do_while_stmt.body);
+                free_push(&stack, node->data.do_while_stmt.test);
+                break;
+            case AST_SWITCH_STMT:
+                free_push(&stack, node->data.switch_stmt.discriminant);
+                free_push_list(&stack, node->data.switch_stmt.cases);
+                break;
+            case AST_TRY_STMT:
+                free_push(&stack, node->data.try_stmt.block);
+                free_push(&stack, node->data.try_stmt.handler);
+                free_push(&stack, node->data.try_stmt.finalizer);
+                break;
+            case AST_WITH_STMT:
+                free_push(&stack, node->data.with_stmt.object);
+                free_push(&stack, node->data.with_stmt.body);
+                break;
+            case AST_LABELED_STMT:
+                free_push(&stack, node->data.labeled_stmt.body);
+                break;
+            case AST_BREAK_STMT:
+                break;
+            case AST_CONTINUE_STMT:
+                break;
+            case AST_THROW_STMT:
+                free_push(&stack, node->data.throw_stmt.argument);
+                break;
+            case AST_EXPR_STMT:
+                free_push(&stack, node->data.expr_stmt.expression);
+                break;
+            case AST_EMPTY_STMT:
+                break;
+            case AST_IDENTIFIER:
+                break;
+            case AST_THIS:
+                break;
+            case AST_LITERAL:
+                if (node->data.literal.literal_type == AST_LITERAL_STRING
+                    && node->data.literal.cooked != node->data.literal.raw) {
+                    free((char *)node->data.literal.cooked);
+                }
+                if (node->data.literal.literal_type == AST_LITERAL_STRING
+                    || node->data.literal.literal_type == AST_LITERAL_REGEX) {
+                    free(node->data.literal.value.string);
+                }
+                break;
+            case AST_TEMPLATE_LITERAL:
+                free_push_list(&stack, node->data.template_literal.quasis);
+                free_push_list(&stack, node->data.template_literal.expressions);
+                break;
+            case AST_TEMPLATE_ELEMENT:
+                if (node->data.template_element.cooked != node->data.template_element.raw) {
+                    free((char *)node->data.template_element.cooked);
+                }
+                free(node->data.template_element.raw);
+                break;
+            case AST_TAGGED_TEMPLATE:
+                free_push(&stack, node->data.tagged_template.tag);
+                free_push(&stack, node->data.tagged_template.template_literal);
+                break;
+            case AST_ASSIGN_EXPR:
+                free_push(&stack, node->data.assign.left);
+                free_push(&stack, node->data.assign.right);
+                break;
+            case AST_BINARY_EXPR:
+                free_push(&stack, node->data.binary.left);
+                free_push(&stack, node->data.binary.right);
+                break;
+            case AST_CONDITIONAL_EXPR:
+                free_push(&stack, node->data.conditional.test);
+                free_push(&stack, node->data.conditional.consequent);
+                free_push(&stack, node->data.conditional.alternate);
+                break;
+            case AST_SEQUENCE_EXPR:
+                free_push_list(&stack, node->data.sequence.elements);
+                break;
+            case AST_UNARY_EXPR:
+                free_push(&stack, node->data.unary.argument);
+                break;
+            case AST_NEW_EXPR:
+                free_push(&stack, node->data.new_expr.callee);
+                free_push_list(&stack, node->data.new_expr.arguments);
+                break;
+            case AST_UPDATE_EXPR:
+                free_push(&stack, node->data.update.argument);
+                break;
+            case AST_CALL_EXPR:
+                free_push(&stack, node->data.call_expr.callee);
+                free_push_list(&stack, node->data.call_expr.arguments);
+                break;
+            case AST_MEMBER_EXPR:
+                free_push(&stack, node->data.member_expr.object);
+                free_push(&stack, node->data.member_expr.property);
+                break;
+            case AST_YIELD_EXPR:
+                free_push(&stack, node->data.yield_expr.argument);
+                break;
+            case AST_AWAIT_EXPR:
+                free_push(&stack, node->data.await_expr.argument);
+                break;
+            case AST_ARRAY_LITERAL:
+                free_push_list(&stack, node->data.array_literal.elements);
+                break;
+            case AST_OBJECT_LITERAL:
+                free_push_list(&stack, node->data.object_literal.properties);
+                break;
+            case AST_PROPERTY:
+                free_push(&stack, node->data.property.value);
+                break;
+            case AST_COMPUTED_PROP:
+                free_push(&stack, node->data.computed_prop.key);
+                free_push(&stack, node->data.computed_prop.value);
+                break;
+            case AST_SWITCH_CASE:
+                free_push(&stack, node->data.switch_case.test);
+                free_push_list(&stack, node->data.switch_case.consequent);
+                break;
+            case AST_CATCH_CLAUSE:
+                free_push(&stack, node->data.catch_clause.param);
+                free_push(&stack, node->data.catch_clause.body);
+                break;
+            case AST_BINDING_PATTERN:
+                free_push(&stack, node->data.binding_pattern.target);
+                free_push(&stack, node->data.binding_pattern.initializer);
+                break;
+            case AST_OBJECT_BINDING:
+                free_push_list(&stack, node->data.object_binding.properties);
+                break;
+            case AST_ARRAY_BINDING:
+                free_push_list(&stack, node->data.array_binding.elements);
+                break;
+            case AST_BINDING_PROPERTY:
+                free_push(&stack, node->data.binding_property.value);
+                break;
+            case AST_REST_ELEMENT:
+                free_push(&stack, node->data.rest_element.argument);
+                break;
+            case AST_SPREAD_ELEMENT:
+                free_push(&stack, node->data.spread_element.argument);
+                break;
+            case AST_ARRAY_HOLE:
+                break;
+            case AST_CLASS_DECL:
+                free_push(&stack, node->data.class_decl.super_class);
+                free_push_list(&stack, node->data.class_decl.body);
+                break;
+            case AST_CLASS_EXPR:
+                free_push(&stack, node->data.class_expr.super_class);
+                free_push_list(&stack, node->data.class_expr.body);
+                break;
+            case AST_METHOD_DEF:
+                free_push(&stack, node->data.method_def.computed_key);
+                free_push(&stack, node->data.method_def.function);
+                break;
+            case AST_IMPORT_DECL:
+                free_push_list(&stack, node->data.import_decl.specifiers);
+                free_push(&stack, node->data.import_decl.source);
+                break;
+            case AST_IMPORT_SPECIFIER:
+                break;
+            case AST_EXPORT_DECL:
+                free_push(&stack, node->data.export_decl.declaration);
+                free_push_list(&stack, node->data.export_decl.specifiers);
+                free_push(&stack, node->data.export_decl.source);
+                break;
+            case AST_EXPORT_SPECIFIER:
+                break;
+            case AST_SUPER:
+                break;
+        }
+        free(node);
     }
-    free(node);
+    free(stack.items);
 }
@@ -87,6 +87,7 @@ typedef enum
 typedef enum
 {
     AST_LITERAL_NUMBER,
+    AST_LITERAL_BIGINT,
     AST_LITERAL_STRING,
     AST_LITERAL_REGEX,
     AST_LITERAL_BOOLEAN,
@@ -104,7 +105,7 @@ typedef struct ASTList
 
 typedef struct
 {
-    char *name;
+    const char *name;
     bool is_identifier;
 } ASTPropertyKey;
 
@@ -130,6 +131,9 @@ struct ASTNode
         {
             char *raw;
             bool is_tail;
+            bool cooked_ready;      // cooked 已解码（解码结果可能为 NULL：非法转义）
+            const char *cooked;     // 惰性解码的值，无转义时直接指向 raw
+            size_t cooked_length;
         } template_element;
         struct
         {
@@ -147,7 +151,7 @@ struct ASTNode
         } var_stmt;
         struct
         {
-            char *name;
+            const char *name;
             ASTList *params;
             ASTNode *body;
             bool is_generator;
@@ -155,7 +159,7 @@ struct ASTNode
         } function_decl;
         struct
         {
-            char *name;
+            const char *name;
             ASTList *params;
             ASTNode *body;
             bool is_generator;
@@ -229,16 +233,16 @@ struct ASTNode
         } with_stmt;
         struct
         {
-            char *label;
+            const char *label;
             ASTNode *body;
         } labeled_stmt;
         struct
         {
-            char *label;
+            const char *label;
         } break_stmt;
         struct
         {
-            char *label;
+            const char *label;
         } continue_stmt;
         struct
         {
@@ -250,7 +254,7 @@ struct ASTNode
         } expr_stmt;
         struct
         {
-            char *name;
+            const char *name;
         } identifier;
         struct
         {
@@ -263,7 +267,14 @@ struct ASTNode
                 double number;
                 bool boolean;
                 char *string;
+                const char *bigint; // BigInt 源文本（atom，含 `n` 后缀）
             } value;
+            // 字符串：raw 为去掉引号的源文本视图（指向 value.string 内部），cooked 同 template_element
+            const char *raw;
+            size_t raw_length;
+            bool cooked_ready;
+            const char *cooked;
+            size_t cooked_length;
         } literal;
         struct
         {
@@ -379,19 +390,19 @@ struct ASTNode
         } array_hole;
         struct
         {
-            char *name;
+            const char *name;
             ASTNode *super_class;
             ASTList *body;
         } class_decl;
         struct
         {
-            char *name;
+            const char *name;
             ASTNode *super_class;
             ASTList *body;
         } class_expr;
         struct
         {
-            char *name;
+            const char *name;
             ASTNode *computed_key;
             bool computed;
             bool is_static;
@@ -415,8 +426,8 @@ struct ASTNode
         } import_decl;
         struct
         {
-            char *local_name;
-            char *imported_name;
+            const char *local_name;
+            const char *imported_name;
             bool is_namespace;
             bool is_default;
         } import_specifier;
@@ -424,15 +435,15 @@ struct ASTNode
         {
             bool is_default;
             bool export_all;
-            char *export_all_alias;
+            const char *export_all_alias;
             ASTNode *declaration;
             ASTList *specifiers;
             ASTNode *source;
         } export_decl;
         struct
         {
-            char *local_name;
-            char *exported_name;
+            const char *local_name;
+            const char *exported_name;
             bool is_namespace;
         } export_specifier;
     } data;
@@ -448,8 +459,8 @@ ASTNode *ast_make_program(ASTList *body);
 ASTNode *ast_make_block(ASTList *body);
 ASTNode *ast_make_var_decl(ASTNode *binding);
 ASTNode *ast_make_var_stmt(ASTVarKind kind, ASTList *decls);
-ASTNode *ast_make_function_decl(char *name, ASTList *params, ASTNode *body);
-ASTNode *ast_make_function_expr(char *name, ASTList *params, ASTNode *body);
+ASTNode *ast_make_function_decl(const char *name, ASTList *params, ASTNode *body);
+ASTNode *ast_make_function_expr(const char *name, ASTList *params, ASTNode *body);
 ASTNode *ast_make_arrow_function(ASTList *params, ASTNode *body, bool is_expression_body);
 ASTNode *ast_make_return(ASTNode *argument);
 ASTNode *ast_make_if(ASTNode *test, ASTNode *consequent, ASTNode *alternate);
@@ -464,15 +475,15 @@ ASTNode *ast_make_switch_default(ASTList *consequent);
 ASTNode *ast_make_try(ASTNode *block, ASTNode *handler, ASTNode *finalizer);
 ASTNode *ast_make_catch(ASTNode *param, ASTNode *body);
 ASTNode *ast_make_with(ASTNode *object, ASTNode *body);
-ASTNode *ast_make_labeled(char *label, ASTNode *body);
-ASTNode *ast_make_break(char *label);
-ASTNode *ast_make_continue(char *label);
+ASTNode *ast_make_labeled(const char *label, ASTNode *body);
+ASTNode *ast_make_break(const char *label);
+ASTNode *ast_make_continue(const char *label);
 ASTNode *ast_make_throw(ASTNode *argument);
 ASTNode *ast_make_expression_stmt(ASTNode *expression);
 ASTNode *ast_make_empty_statement(void);
-ASTNode *ast_make_identifier(char *name);
+ASTNode *ast_make_identifier(const char *name);
 ASTNode *ast_make_this_expr(void);
-ASTNode *ast_make_number_literal(char *raw);
+ASTNode *ast_make_number_literal(const char *raw);
 ASTNode *ast_make_string_literal(char *raw);
 ASTNode *ast_make_string_literal_raw(char *raw);
 ASTNode *ast_make_regex_literal(char *raw);
@@ -495,23 +506,30 @@ ASTNode *ast_make_yield(ASTNode *argument, bool is_delegate);
 ASTNode *ast_make_await(ASTNode *argument);
 ASTNode *ast_make_array_literal(ASTList *elements);
 ASTNode *ast_make_object_literal(ASTList *properties);
-ASTNode *ast_make_property(char *key, bool is_identifier, ASTNode *value);
+// 属性键按原样保存（atom）；字符串键由调用方去掉引号后再驻留
+ASTNode *ast_make_property(const char *key, bool is_identifier, ASTNode *value);
 ASTNode *ast_make_computed_property(ASTNode *key, ASTNode *value);
 ASTNode *ast_make_binding_pattern(ASTNode *target, ASTNode *initializer);
 ASTNode *ast_make_object_binding(ASTList *properties);
 ASTNode *ast_make_array_binding(ASTList *elements);
-ASTNode *ast_make_binding_property(char *key, bool is_identifier, ASTNode *value, bool is_shorthand);
+ASTNode *ast_make_binding_property(const char *key, bool is_identifier, ASTNode *value, bool is_shorthand);
 ASTNode *ast_make_rest_element(ASTNode *argument);
 ASTNode *ast_make_spread_element(ASTNode *argument);
 ASTNode *ast_make_array_hole(void);
-ASTNode *ast_make_class_decl(char *name, ASTNode *super_class, ASTList *body);
-ASTNode *ast_make_class_expr(char *name, ASTNode *super_class, ASTList *body);
-ASTNode *ast_make_method_def(char *name, ASTNode *computed_key, bool computed, bool is_static, bool is_generator, bool is_async, ASTMethodKind kind, ASTNode *function);
+ASTNode *ast_make_class_decl(const char *name, ASTNode *super_class, ASTList *body);
+ASTNode *ast_make_class_expr(const char *name, ASTNode *super_class, ASTList *body);
+ASTNode *ast_make_method_def(const char *name, ASTNode *computed_key, bool computed, bool is_static, bool is_generator, bool is_async, ASTMethodKind kind, ASTNode *function);
 ASTNode *ast_make_super_expr(void);
 ASTNode *ast_make_import_decl(ASTList *specifiers, ASTNode *source);
-ASTNode *ast_make_import_specifier(char *local_name, char *imported_name, bool is_namespace, bool is_default);
-ASTNode *ast_make_export_decl(bool is_default, bool export_all, char *export_all_alias, ASTNode *declaration, ASTList *specifiers, ASTNode *source);
-ASTNode *ast_make_export_specifier(char *local_name, char *exported_name, bool is_namespace);
+ASTNode *ast_make_import_specifier(const char *local_name, const char *imported_name, bool is_namespace, bool is_default);
+ASTNode *ast_make_export_decl(bool is_default, bool export_all, const char *export_all_alias, ASTNode *declaration, ASTList *specifiers, ASTNode *source);
+ASTNode *ast_make_export_specifier(const char *local_name, const char *exported_name, bool is_namespace);
+
+// 字符串字面量/模板片段的源文本（不含引号与定界符），零拷贝视图
+const char *ast_literal_raw(const ASTNode *node, size_t *length);
+// 转义解码后的值（UTF-8，可能含 NUL，不保证以 NUL 结尾，以 *length 为准）：首次调用时解码并缓存在节点上，
+// 没有转义时直接返回 raw 视图而不分配；模板片段含非法转义时返回 NULL（带标签模板中 cooked 为 undefined）
+const char *ast_literal_cooked(ASTNode *node, size_t *length);
 
 void ast_traverse(ASTNode *node, ASTVisitFn visitor, void *userdata);
 void ast_print(const ASTNode *node);
@@ -0,0 +1,128 @@
+#include "atom.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 开放寻址哈希表（线性探测），字符串连续存放在按块分配的区域里，重复的名字不再逐个 malloc
+
+#define ATOM_CHUNK_SIZE 16384
+#define ATOM_INITIAL_SLOTS 1024
+
+typedef struct AtomSlot
+{
+    const char *text;
+    size_t length;
+    uint32_t hash;
+} AtomSlot;
+
+typedef struct AtomChunk
+{
+    struct AtomChunk *next;
+    size_t used;
+    size_t capacity;
+    char data[];
+} AtomChunk;
+
+static const char *const g_predefined_text[ATOM_PREDEFINED_COUNT] = {
+    "from", "as", "of", "get", "set", "static", "constructor", "default"
+};
+
+static void *atom_xalloc(size_t size) {
+    void *ptr = calloc(1, size);
+    if (!ptr) {
+        fprintf(stderr, "Out of memory while interning names\n");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+// FNV-1a
+static uint32_t atom_hash(const char *text, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)text[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static char *atom_store(AtomTable *table, const char *text, size_t length) {
+    size_t need = length + 1;
+    if (!table->chunks || table->chunks->capacity - table->chunks->used < need) {
+        size_t capacity = need > ATOM_CHUNK_SIZE ? need : ATOM_CHUNK_SIZE;
+        AtomChunk *chunk = (AtomChunk *)atom_xalloc(sizeof(AtomChunk) + capacity);
+        chunk->capacity = capacity;
+        chunk->next = table->chunks;
+        table->chunks = chunk;
+    }
+    char *copy = table->chunks->data + table->chunks->used;
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    table->chunks->used += need;
+    return copy;
+}
+
+static void atom_grow(AtomTable *table) {
+    size_t new_count = table->slot_count ? table->slot_count * 2 : ATOM_INITIAL_SLOTS;
+    AtomSlot *slots = (AtomSlot *)atom_xalloc(new_count * sizeof(AtomSlot));
+    for (size_t i = 0; i < table->slot_count; i++) {
+        if (!table->slots[i].text) {
+            continue;
+        }
+        size_t j = table->slots[i].hash & (new_count - 1);
+        while (slots[j].text) {
+            j = (j + 1) & (new_count - 1);
+        }
+        slots[j] = table->slots[i];
+    }
+    free(table->slots);
+    table->slots = slots;
+    table->slot_count = new_count;
+}
+
+const char *atom_intern(AtomTable *table, const char *text, size_t length) {
+    if ((table->atom_count + 1) * 2 > table->slot_count) {
+        atom_grow(table); // 负载不超过 1/2
+    }
+    uint32_t hash = atom_hash(text, length);
+    size_t i = hash & (table->slot_count - 1);
+    while (table->slots[i].text) {
+        AtomSlot *slot = &table->slots[i];
+        if (slot->hash == hash && slot->length == length && memcmp(slot->text, text, length) == 0) {
+            return slot->text;
+        }
+        i = (i + 1) & (table->slot_count - 1);
+    }
+    table->slots[i].text = atom_store(table, text, length);
+    table->slots[i].length = length;
+    table->slots[i].hash = hash;
+    table->atom_count++;
+    return table->slots[i].text;
+}
+
+// 先放入预置 atom，保证 ATOM(table, ...) 与同名标识符是同一指针
+void atom_table_init(AtomTable *table) {
+    memset(table, 0, sizeof(*table));
+    for (int i = 0; i < ATOM_PREDEFINED_COUNT; i++) {
+        table->predefined[i] = atom_intern(table, g_predefined_text[i], strlen(g_predefined_text[i]));
+    }
+}
+
+const char *atom_intern_cstr(AtomTable *table, const char *text) {
+    if (!text) {
+        return NULL;
+    }
+    return atom_intern(table, text, strlen(text));
+}
+
+void atom_table_dispose(AtomTable *table) {
+    while (table->chunks) {
+        AtomChunk *next = table->chunks->next;
+        free(table->chunks);
+        table->chunks = next;
+    }
+    free(table->slots);
+    memset(table, 0, sizeof(*table));
+}
@@ -0,0 +1,40 @@
+#ifndef ATOM_H
+#define ATOM_H
+
+#include <stddef.h>
+
+// 名字驻留表（atom）：标识符、属性名等相同文本只保存一份只读字符串，
+// 两个 atom 相等当且仅当指针相等。atom 由表统一持有，不能单独 free，
+// 在 AST 释放之后用 atom_table_dispose 一次性回收。每次解析使用自己的表，互不共享
+
+typedef enum
+{
+    ATOM_FROM,
+    ATOM_AS,
+    ATOM_OF,
+    ATOM_GET,
+    ATOM_SET,
+    ATOM_STATIC,
+    ATOM_CONSTRUCTOR,
+    ATOM_DEFAULT,
+    ATOM_PREDEFINED_COUNT
+} AtomId;
+
+typedef struct AtomTable
+{
+    struct AtomSlot *slots;
+    size_t slot_count;  // 2 的幂
+    size_t atom_count;
+    struct AtomChunk *chunks;
+    const char *predefined[ATOM_PREDEFINED_COUNT];
+} AtomTable;
+
+// 预置的上下文关键字，比较时直接比指针：name == ATOM(table, FROM)
+#define ATOM(table, id) ((table)->predefined[ATOM_##id])
+
+void atom_table_init(AtomTable *table);
+void atom_table_dispose(AtomTable *table);
+const char *atom_intern(AtomTable *table, const char *text, size_t length);
+const char *atom_intern_cstr(AtomTable *table, const char *text);
+
+#endif // ATOM_H
@@ -0,0 +1,30 @@
+#ifndef BINARY_CHAIN_H
+#define BINARY_CHAIN_H
+
+#include <stddef.h>
+#include "ast.h"
+
+// 二元运算符：文法只按出现顺序收集“操作数 运算符 操作数 ...”，
+// 结合方式由语义动作里的优先级爬升决定（见 parser.y 的 fold_binary_chain）
+typedef struct
+{
+    const char *op;
+    int precedence;     // 越大结合越紧，同级左结合
+} BinaryOperator;
+
+typedef struct
+{
+    const BinaryOperator *op;   // 左侧的运算符，第一项为 NULL
+    ASTNode *operand;
+} BinaryChainItem;
+
+typedef struct BinaryChain BinaryChain;
+
+struct BinaryChain
+{
+    size_t count;
+    size_t capacity;
+    BinaryChainItem items[];
+};
+
+#endif /* BINARY_CHAIN_H */
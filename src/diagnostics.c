@@ -4,11 +4,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-static char *g_current_file = NULL;
-static char *g_log_path = NULL;
-static int g_last_line = 1;
-static int g_last_column = 1;
-
 static char *dup_string(const char *src) {
     if (!src) {
         return NULL;
@@ -32,47 +27,114 @@ static void assign_string(char **target, const char *value) {
     }
 }
 
-void diag_reset(void) {
-    g_last_line = 1;
-    g_last_column = 1;
+static void free_messages(DiagMessage *messages, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        free(messages[i].message);
+    }
+    free(messages);
 }
 
-void diag_set_current_file(const char *filename) {
-    assign_string(&g_current_file, filename);
+void diag_init(Diagnostics *diag) {
+    memset(diag, 0, sizeof(*diag));
 }
 
-void diag_set_error_log_path(const char *path) {
-    assign_string(&g_log_path, path);
+void diag_dispose(Diagnostics *diag) {
+    free(diag->current_file);
+    free(diag->log_path);
+    free_messages(diag->messages, diag->count);
+    memset(diag, 0, sizeof(*diag));
 }
 
-void diag_set_last_token_location(int line, int column) {
-    if (line > 0) {
-        g_last_line = line;
-    }
-    if (column > 0) {
-        g_last_column = column;
+void diag_reset(Diagnostics *diag) {
+    diag->last_offset = 0;
+    free_messages(diag->messages, diag->count);
+    diag->messages = NULL;
+    diag->count = 0;
+    diag->capacity = 0;
+}
+
+void diag_set_current_file(Diagnostics *diag, const char *filename) {
+    assign_string(&diag->current_file, filename);
+}
+
+void diag_set_error_log_path(Diagnostics *diag, const char *path) {
+    assign_string(&diag->log_path, path);
+}
+
+void diag_set_position_resolver(Diagnostics *diag, DiagPositionResolver resolver, void *userdata) {
+    diag->resolver = resolver;
+    diag->resolver_data = userdata;
+}
+
+// 每个 token 只记录偏移，行列号在读取时才计算
+void diag_set_last_token_offset(Diagnostics *diag, size_t offset) {
+    diag->last_offset = offset;
+}
+
+static void resolve_position(const Diagnostics *diag, size_t offset, int *line, int *column) {
+    *line = 1;
+    *column = 1;
+    if (diag->resolver) {
+        diag->resolver(diag->resolver_data, offset, line, column);
     }
 }
 
-int diag_last_line(void) {
-    return g_last_line;
+int diag_last_line(Diagnostics *diag) {
+    int line, column;
+    resolve_position(diag, diag->last_offset, &line, &column);
+    return line;
+}
+
+int diag_last_column(Diagnostics *diag) {
+    int line, column;
+    resolve_position(diag, diag->last_offset, &line, &column);
+    return column;
+}
+
+void diag_add(Diagnostics *diag, size_t offset, const char *message) {
+    if (diag->count == diag->capacity) {
+        size_t capacity = diag->capacity ? diag->capacity * 2 : 8;
+        DiagMessage *grown = (DiagMessage *)realloc(diag->messages, capacity * sizeof(DiagMessage));
+        if (!grown) {
+            return;
+        }
+        diag->messages = grown;
+        diag->capacity = capacity;
+    }
+    DiagMessage *entry = &diag->messages[diag->count];
+    resolve_position(diag, offset, &entry->line, &entry->column);
+    entry->message = dup_string(message ? message : "");
+    if (entry->message) {
+        diag->count++;
+    }
 }
 
-int diag_last_column(void) {
-    return g_last_column;
+DiagMessage *diag_take_messages(Diagnostics *diag, size_t *count) {
+    DiagMessage *messages = diag->messages;
+    *count = diag->count;
+    diag->messages = NULL;
+    diag->count = 0;
+    diag->capacity = 0;
+    return messages;
 }
 
-void diag_record_error(const char *message) {
-    if (!g_log_path || !message) {
+void diag_record_error(Diagnostics *diag, const char *message) {
+    if (!message) {
+        return;
+    }
+    diag_add(diag, diag->last_offset, message);
+    if (!diag->log_path) {
         return;
     }
 
-    FILE *fp = fopen(g_log_path, "a");
+    FILE *fp = fopen(diag->log_path, "a");
     if (!fp) {
         return;
     }
 
-    const char *file_label = g_current_file ? g_current_file : "<unknown>";
-    fprintf(fp, "%s:%d:%d: %s\n", file_label, g_last_line, g_last_column, message);
+    const char *file_label = diag->current_file ? diag->current_file : "<unknown>";
+    int line, column;
+    resolve_position(diag, diag->last_offset, &line, &column);
+    fprintf(fp, "%s:%d:%d: %s\n", file_label, line, column, message);
     fclose(fp);
 }
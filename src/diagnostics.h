@@ -1,12 +1,47 @@
 #ifndef DIAGNOSTICS_H
 #define DIAGNOSTICS_H
 
-void diag_reset(void);
-void diag_set_current_file(const char *filename);
-void diag_set_error_log_path(const char *path);
-void diag_set_last_token_location(int line, int column);
-void diag_record_error(const char *message);
-int diag_last_line(void);
-int diag_last_column(void);
+#include <stddef.h>
+
+// 把字节偏移换算为行列号的回调（由词法适配层提供，只在真正需要位置时调用）
+typedef void (*DiagPositionResolver)(void *userdata, size_t offset, int *line, int *column);
+
+// 一条诊断：位置在记录时计算
+typedef struct
+{
+    int line;
+    int column;
+    char *message;
+} DiagMessage;
+
+// 每个解析上下文一份，互不共享
+typedef struct
+{
+    char *current_file;
+    char *log_path;
+    size_t last_offset;
+    DiagPositionResolver resolver;
+    void *resolver_data;
+    DiagMessage *messages;
+    size_t count;
+    size_t capacity;
+} Diagnostics;
+
+void diag_init(Diagnostics *diag);
+void diag_dispose(Diagnostics *diag);
+// 开始新的一次解析：清空位置与已记录的诊断（文件名、日志路径保留）
+void diag_reset(Diagnostics *diag);
+void diag_set_current_file(Diagnostics *diag, const char *filename);
+void diag_set_error_log_path(Diagnostics *diag, const char *path);
+void diag_set_position_resolver(Diagnostics *diag, DiagPositionResolver resolver, void *userdata);
+void diag_set_last_token_offset(Diagnostics *diag, size_t offset);
+// 在 offset 处记录一条诊断
+void diag_add(Diagnostics *diag, size_t offset, const char *message);
+// 在最近一个 token 处记录语法错误，并追加到错误日志（如已设置）
+void diag_record_error(Diagnostics *diag, const char *message);
+// 取走已记录的诊断，调用方负责 free 每条 message 与数组本身
+DiagMessage *diag_take_messages(Diagnostics *diag, size_t *count);
+int diag_last_line(Diagnostics *diag);
+int diag_last_column(Diagnostics *diag);
 
 #endif // DIAGNOSTICS_H
@@ -0,0 +1,187 @@
+#include "escape.h"
+
+#include <stdint.h>
+
+static int hex_value(unsigned char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+// 读取恰好 count 位十六进制数，不足时返回 -1
+static long read_hex(const unsigned char *p, const unsigned char *end, int count) {
+    long value = 0;
+    for (int i = 0; i < count; i++) {
+        int digit = p + i < end ? hex_value(p[i]) : -1;
+        if (digit < 0) {
+            return -1;
+        }
+        value = value * 16 + digit;
+    }
+    return value;
+}
+
+// \uXXXX 或 \u{X...}，p 指向 'u' 之后；成功时返回码点并前移 *pp
+static long read_unicode_escape(const unsigned char **pp, const unsigned char *end) {
+    const unsigned char *p = *pp;
+    if (p < end && *p == '{') {
+        long value = 0;
+        const unsigned char *q = p + 1;
+        while (q < end && hex_value(*q) >= 0) {
+            value = value * 16 + hex_value(*q);
+            if (value > 0x10FFFF) {
+                return -1;
+            }
+            q++;
+        }
+        if (q == p + 1 || q >= end || *q != '}') {
+            return -1;
+        }
+        *pp = q + 1;
+        return value;
+    }
+    long value = read_hex(p, end, 4);
+    if (value >= 0) {
+        *pp = p + 4;
+    }
+    return value;
+}
+
+static char *put_utf8(char *out, uint32_t cp) {
+    if (cp < 0x80) {
+        *out++ = (char)cp;
+    } else if (cp < 0x800) {
+        *out++ = (char)(0xC0 | (cp >> 6));
+        *out++ = (char)(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        *out++ = (char)(0xE0 | (cp >> 12));
+        *out++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = (char)(0x80 | (cp & 0x3F));
+    } else {
+        *out++ = (char)(0xF0 | (cp >> 18));
+        *out++ = (char)(0x80 | ((cp >> 12) & 0x3F));
+        *out++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = (char)(0x80 | (cp & 0x3F));
+    }
+    return out;
+}
+
+// U+2028 / U+2029（UTF-8 为 E2 80 A8 / E2 80 A9）
+static bool is_unicode_line_terminator(const unsigned char *p, const unsigned char *end) {
+    return end - p >= 3 && p[0] == 0xE2 && p[1] == 0x80 && (p[2] == 0xA8 || p[2] == 0xA9);
+}
+
+bool escape_decode(const char *text, size_t length, bool is_template, char *out, size_t *out_length) {
+    const unsigned char *p = (const unsigned char *)text;
+    const unsigned char *end = p + length;
+    char *start = out;
+    uint32_t pending_high = 0; // 刚输出的高代理项，遇到紧随的低代理项时合并成一个码点
+    char *pending_at = NULL;
+
+    while (p < end) {
+        unsigned char c = *p;
+        if (c != '\\') {
+            if (c == '\r' && is_template) {
+                // 模板中的 CR 与 CRLF 一律规范化为 LF
+                p += (p + 1 < end && p[1] == '\n') ? 2 : 1;
+                *out++ = '\n';
+            } else {
+                *out++ = (char)*p++;
+            }
+            pending_high = 0;
+            continue;
+        }
+
+        p++;
+        if (p >= end) {
+            break;
+        }
+        c = *p++;
+        long cp = -1;
+        switch (c) {
+            case 'b': cp = '\b'; break;
+            case 'f': cp = '\f'; break;
+            case 'n': cp = '\n'; break;
+            case 'r': cp = '\r'; break;
+            case 't': cp = '\t'; break;
+            case 'v': cp = '\v'; break;
+            case '\r':
+                // 续行：反斜杠加行终止符不产生字符
+                if (p < end && *p == '\n') {
+                    p++;
+                }
+                pending_high = 0;
+                continue;
+            case '\n':
+                pending_high = 0;
+                continue;
+            case 'x':
+                cp = read_hex(p, end, 2);
+                if (cp >= 0) {
+                    p += 2;
+                }
+                break;
+            case 'u':
+                cp = read_unicode_escape(&p, end);
+                break;
+            default:
+                if (c >= '0' && c <= '7') {
+                    if (c == '0' && (p >= end || *p < '0' || *p > '9')) {
+                        cp = 0;
+                        break;
+                    }
+                    if (is_template) {
+                        return false;
+                    }
+                    // 旧式八进制：最多三位且不超过 0377
+                    cp = c - '0';
+                    int max_digits = c <= '3' ? 2 : 1;
+                    while (max_digits-- > 0 && p < end && *p >= '0' && *p <= '7') {
+                        cp = cp * 8 + (*p++ - '0');
+                    }
+                    break;
+                }
+                if ((c == '8' || c == '9') && is_template) {
+                    return false;
+                }
+                if (c == 0xE2 && is_unicode_line_terminator(p - 1, end)) {
+                    p += 2;
+                    pending_high = 0;
+                    continue;
+                }
+                // 其余字符（含多字节 UTF-8 的首字节）按原样输出，后续字节照常复制
+                *out++ = (char)c;
+                pending_high = 0;
+                continue;
+        }
+        if (cp < 0) {
+            if (is_template) {
+                return false;
+            }
+            // 字符串里的非法 \x / \u（词法层未拒绝时）保留转义字母本身
+            *out++ = (char)c;
+            pending_high = 0;
+            continue;
+        }
+        if (cp >= 0xDC00 && cp <= 0xDFFF && pending_high) {
+            // \uD83D\uDE00 这样的代理对：把已输出的高代理项改写为合并后的码点（4 字节，不超过两段转义的长度）
+            uint32_t combined = 0x10000 + ((pending_high - 0xD800) << 10) + ((uint32_t)cp - 0xDC00);
+            out = put_utf8(pending_at, combined);
+            pending_high = 0;
+            continue;
+        }
+        pending_at = out;
+        out = put_utf8(out, (uint32_t)cp);
+        pending_high = (cp >= 0xD800 && cp <= 0xDBFF) ? (uint32_t)cp : 0;
+    }
+    *out = '\0';
+    *out_length = (size_t)(out - start);
+    return true;
+}
@@ -0,0 +1,13 @@
+#ifndef ESCAPE_H
+#define ESCAPE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// 字符串字面量/模板片段的转义解码（cooked 值）：text 为去掉引号或定界符的源文本（无需 NUL 结尾），
+// 结果按 UTF-8 写入 out（孤立代理项按 WTF-8 编码，可能含 NUL），out 至少 length + 1 字节——
+// 解码结果不会比源文本长。is_template 时 CR/CRLF 规范化为 LF，旧式八进制、非法 \x/\u 使 cooked
+// 无定义（返回 false，仅带标签模板允许）；字符串中的非法转义按字符本身处理
+bool escape_decode(const char *text, size_t length, bool is_template, char *out, size_t *out_length);
+
+#endif // ESCAPE_H
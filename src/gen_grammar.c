@@ -0,0 +1,617 @@
+// 构建期工具：展开 parser.y 中的带参非终结符（仿 ECMAScript 规范的 [In, Yield, Await] 参数）
+//   声明    name[NoIn, NoObj]          规则头带参数表，每个参数是一个布尔开关
+//   守卫    | [+NoObj] alt / [~NoObj]  只在参数为开 / 关时保留这个候选式
+//   引用    other[?NoIn, +NoObj]       ?P 透传当前值，+P（或直接写 P）置开，~P 或省略为关
+// 只生成从普通规则出发可达的实例；某参数既不出现在守卫里、也不被透传到真正用到它的规则，
+// 就与该非终结符无关，不同取值共用同一个实例（不会多出只有名字不同的副本）。
+// 实例名为基名依次加上开着的相关参数，NoObj -> _no_obj；%type 行中的基名展开为全部可达实例名
+// 用法：gen_grammar <parser.y> <输出.y>
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PARAMS 4
+#define MAX_NAME 64
+
+// 参数表中的一项：[+P] / [~P] / [?P]，不写前缀视为 '+'
+typedef struct {
+    char names[MAX_PARAMS][MAX_NAME];
+    char prefix[MAX_PARAMS];
+    int count;
+} ParamList;
+
+typedef struct {
+    size_t start;       // 引用在源文本中的范围（含参数表）
+    size_t end;
+    char name[MAX_NAME];
+    ParamList args;
+    int rule;           // 被引用的带参规则，-1 表示终结符或普通规则
+    unsigned set;       // 被引用规则中置开的参数
+    int pass[MAX_PARAMS];   // 被引用规则的第 i 个参数透传自当前规则的哪个参数，-1 表示不透传
+} Ref;
+
+typedef struct {
+    size_t start;       // 分隔符 ':' / '|' 之后
+    size_t end;         // 下一个 '|' / ';' 处
+    size_t guard_start;
+    size_t guard_end;   // 无守卫时与 guard_start 相同
+    unsigned guard_on;
+    unsigned guard_off;
+    Ref *refs;
+    size_t ref_count;
+} Alternative;
+
+typedef struct {
+    size_t pre_start;   // 规则前的注释与空白
+    size_t head_start;
+    size_t head_end;    // 名字（及参数表）之后
+    size_t colon;
+    char name[MAX_NAME];
+    char params[MAX_PARAMS][MAX_NAME];
+    int param_count;
+    Alternative *alts;
+    size_t alt_count;
+    unsigned relevant;  // 真正影响产生式的参数
+    unsigned char reached[1 << MAX_PARAMS];
+} Rule;
+
+static const char *g_src;
+static size_t g_len;
+static Rule *g_rules;
+static size_t g_rule_count;
+
+static void fail(size_t pos, const char *msg) {
+    size_t line = 1;
+    for (size_t i = 0; i < pos && i < g_len; i++) {
+        if (g_src[i] == '\n') {
+            line++;
+        }
+    }
+    fprintf(stderr, "gen_grammar: line %zu: %s\n", line, msg);
+    exit(1);
+}
+
+static void *grow(void *ptr, size_t count, size_t size) {
+    // 按 2 的幂扩容：count 恰好是 2 的幂（或 0）时需要更多空间
+    if (count & (count - 1)) {
+        return ptr;
+    }
+    void *next = realloc(ptr, (count ? count * 2 : 4) * size);
+    if (!next) {
+        fprintf(stderr, "gen_grammar: out of memory\n");
+        exit(1);
+    }
+    return next;
+}
+
+static int is_ident_start(char c) {
+    return isalpha((unsigned char)c) || c == '_';
+}
+
+static int is_ident_char(char c) {
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+// 跳过注释、字符/字符串字面量；pos 不在这些结构上时原样返回
+static size_t skip_literal(size_t pos) {
+    if (g_src[pos] == '/' && pos + 1 < g_len && g_src[pos + 1] == '/') {
+        while (pos < g_len && g_src[pos] != '\n') {
+            pos++;
+        }
+        return pos;
+    }
+    if (g_src[pos] == '/' && pos + 1 < g_len && g_src[pos + 1] == '*') {
+        const char *end = strstr(g_src + pos + 2, "*/");
+        if (!end) {
+            fail(pos, "unterminated comment");
+        }
+        return (size_t)(end - g_src) + 2;
+    }
+    if (g_src[pos] == '\'' || g_src[pos] == '"') {
+        char quote = g_src[pos++];
+        while (pos < g_len && g_src[pos] != quote && g_src[pos] != '\n') {
+            pos += g_src[pos] == '\\' ? 2 : 1;
+        }
+        if (pos >= g_len || g_src[pos] != quote) {
+            fail(pos, "unterminated literal");
+        }
+        return pos + 1;
+    }
+    return pos;
+}
+
+static size_t skip_space(size_t pos, size_t end) {
+    while (pos < end) {
+        if (isspace((unsigned char)g_src[pos])) {
+            pos++;
+            continue;
+        }
+        size_t next = skip_literal(pos);
+        if (next == pos || g_src[pos] == '\'' || g_src[pos] == '"') {
+            break;
+        }
+        pos = next;
+    }
+    return pos;
+}
+
+static size_t skip_action(size_t pos) {
+    int depth = 0;
+    while (pos < g_len) {
+        size_t next = skip_literal(pos);
+        if (next != pos) {
+            pos = next;
+            continue;
+        }
+        if (g_src[pos] == '{') {
+            depth++;
+        } else if (g_src[pos] == '}' && --depth == 0) {
+            return pos + 1;
+        }
+        pos++;
+    }
+    fail(pos, "unterminated action");
+    return pos;
+}
+
+static size_t read_ident(size_t pos, char *out) {
+    size_t start = pos;
+    while (pos < g_len && is_ident_char(g_src[pos])) {
+        pos++;
+    }
+    if (pos - start >= MAX_NAME) {
+        fail(start, "name too long");
+    }
+    memcpy(out, g_src + start, pos - start);
+    out[pos - start] = '\0';
+    return pos;
+}
+
+// 解析 "[a, b, ...]"；返回 ']' 之后的位置
+static size_t read_param_list(size_t pos, ParamList *list) {
+    pos++;  // '['
+    for (;;) {
+        pos = skip_space(pos, g_len);
+        char prefix = '+';
+        if (g_src[pos] == '+' || g_src[pos] == '~' || g_src[pos] == '?') {
+            prefix = g_src[pos++];
+        }
+        if (!is_ident_start(g_src[pos]) || list->count == MAX_PARAMS) {
+            fail(pos, "bad parameter list");
+        }
+        list->prefix[list->count] = prefix;
+        pos = skip_space(read_ident(pos, list->names[list->count++]), g_len);
+        if (g_src[pos] == ']') {
+            return pos + 1;
+        }
+        if (g_src[pos] != ',') {
+            fail(pos, "expected ',' or ']'");
+        }
+        pos++;
+    }
+}
+
+static int param_index(const Rule *rule, const char *name) {
+    for (int i = 0; i < rule->param_count; i++) {
+        if (strcmp(rule->params[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static size_t parse_alternative(size_t pos, const Rule *rule, Alternative *alt) {
+    memset(alt, 0, sizeof(*alt));
+    alt->start = pos;
+    pos = skip_space(pos, g_len);
+    alt->guard_start = alt->guard_end = pos;
+    if (g_src[pos] == '[') {
+        ParamList guard;
+        memset(&guard, 0, sizeof(guard));
+        pos = alt->guard_end = read_param_list(pos, &guard);
+        for (int i = 0; i < guard.count; i++) {
+            int index = param_index(rule, guard.names[i]);
+            if (index < 0 || guard.prefix[i] == '?') {
+                fail(alt->guard_start, "guard must be [+Param] or [~Param] of this rule");
+            }
+            if (guard.prefix[i] == '~') {
+                alt->guard_off |= 1u << index;
+            } else {
+                alt->guard_on |= 1u << index;
+            }
+        }
+    }
+    while (pos < g_len) {
+        char c = g_src[pos];
+        if (c == '|' || c == ';') {
+            alt->end = pos;
+            return pos;
+        }
+        if (c == '{') {
+            pos = skip_action(pos);
+            continue;
+        }
+        if (c == '%') {
+            pos++;
+            while (pos < g_len && is_ident_char(g_src[pos])) {
+                pos++;  // %prec / %dprec / %merge 等指令名
+            }
+            continue;
+        }
+        if (is_ident_start(c)) {
+            alt->refs = (Ref *)grow(alt->refs, alt->ref_count, sizeof(Ref));
+            Ref *ref = &alt->refs[alt->ref_count++];
+            memset(ref, 0, sizeof(*ref));
+            ref->start = pos;
+            pos = read_ident(pos, ref->name);
+            if (g_src[pos] == '[') {
+                pos = read_param_list(pos, &ref->args);
+            }
+            ref->end = pos;
+            continue;
+        }
+        size_t next = skip_literal(pos);
+        pos = next != pos ? next : pos + 1;
+    }
+    fail(pos, "unterminated rule");
+    return pos;
+}
+
+static int find_rule(const char *name) {
+    for (size_t i = 0; i < g_rule_count; i++) {
+        if (g_rules[i].param_count > 0 && strcmp(g_rules[i].name, name) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+// 把引用的实参按被引用规则的参数表解析成 set / pass
+static void resolve_ref(const Rule *caller, Ref *ref) {
+    ref->rule = find_rule(ref->name);
+    ref->set = 0;
+    for (int i = 0; i < MAX_PARAMS; i++) {
+        ref->pass[i] = -1;
+    }
+    if (ref->args.count == 0) {
+        return;
+    }
+    if (ref->rule < 0) {
+        fail(ref->start, "arguments given to a symbol without parameters");
+    }
+    for (int i = 0; i < ref->args.count; i++) {
+        int index = param_index(&g_rules[ref->rule], ref->args.names[i]);
+        if (index < 0) {
+            fail(ref->start, "argument names a parameter the referenced rule does not declare");
+        }
+        if (ref->args.prefix[i] == '+') {
+            ref->set |= 1u << index;
+        } else if (ref->args.prefix[i] == '?') {
+            ref->pass[index] = param_index(caller, ref->args.names[i]);
+            if (ref->pass[index] < 0) {
+                fail(ref->start, "'?' passes a parameter the rule does not declare");
+            }
+        }
+    }
+}
+
+static void parse_rules(size_t pos, size_t end) {
+    for (;;) {
+        size_t pre_start = pos;
+        pos = skip_space(pos, end);
+        if (pos >= end) {
+            return;
+        }
+        g_rules = (Rule *)grow(g_rules, g_rule_count, sizeof(Rule));
+        Rule *rule = &g_rules[g_rule_count];
+        memset(rule, 0, sizeof(*rule));
+        rule->pre_start = pre_start;
+        rule->head_start = pos;
+        if (!is_ident_start(g_src[pos])) {
+            fail(pos, "expected rule name");
+        }
+        pos = read_ident(pos, rule->name);
+        if (g_src[pos] == '[') {
+            ParamList decl;
+            memset(&decl, 0, sizeof(decl));
+            pos = read_param_list(pos, &decl);
+            for (int i = 0; i < decl.count; i++) {
+                if (decl.prefix[i] != '+') {
+                    fail(pos, "bad parameter declaration");
+                }
+                strcpy(rule->params[i], decl.names[i]);
+            }
+            rule->param_count = decl.count;
+        }
+        rule->head_end = pos;
+        pos = skip_space(pos, end);
+        if (g_src[pos] != ':') {
+            fail(pos, "expected ':' after rule name");
+        }
+        rule->colon = pos;
+        while (g_src[pos] != ';') {
+            rule->alts = (Alternative *)grow(rule->alts, rule->alt_count, sizeof(Alternative));
+            Alternative *alt = &rule->alts[rule->alt_count++];
+            pos = parse_alternative(pos + 1, rule, alt);
+        }
+        pos++;
+        g_rule_count++;
+    }
+}
+
+// 参数 P 与规则 N 相关：N 的某个候选式以 P 为守卫，或把 P 透传给了与之相关的参数
+static void compute_relevance(void) {
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (size_t r = 0; r < g_rule_count; r++) {
+            Rule *rule = &g_rules[r];
+            unsigned relevant = rule->relevant;
+            for (size_t a = 0; a < rule->alt_count; a++) {
+                const Alternative *alt = &rule->alts[a];
+                relevant |= alt->guard_on | alt->guard_off;
+                for (size_t i = 0; i < alt->ref_count; i++) {
+                    const Ref *ref = &alt->refs[i];
+                    for (int p = 0; ref->rule >= 0 && p < MAX_PARAMS; p++) {
+                        if (ref->pass[p] >= 0 && (g_rules[ref->rule].relevant & (1u << p))) {
+                            relevant |= 1u << ref->pass[p];
+                        }
+                    }
+                }
+            }
+            if (relevant != rule->relevant) {
+                rule->relevant = relevant;
+                changed = 1;
+            }
+        }
+    }
+}
+
+static unsigned ref_instance(const Ref *ref, unsigned caller) {
+    unsigned mask = ref->set;
+    for (int p = 0; p < MAX_PARAMS; p++) {
+        if (ref->pass[p] >= 0 && (caller & (1u << ref->pass[p]))) {
+            mask |= 1u << p;
+        }
+    }
+    return mask & g_rules[ref->rule].relevant;
+}
+
+static int alt_enabled(const Alternative *alt, unsigned mask) {
+    return (alt->guard_on & ~mask) == 0 && (alt->guard_off & mask) == 0;
+}
+
+static void mark_reachable(void) {
+    // 普通规则都会输出，它们引用到的实例是起点；之后反复扩展直到不动点
+    for (size_t r = 0; r < g_rule_count; r++) {
+        if (g_rules[r].param_count == 0) {
+            g_rules[r].reached[0] = 1;
+        }
+    }
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (size_t r = 0; r < g_rule_count; r++) {
+            Rule *rule = &g_rules[r];
+            for (unsigned mask = 0; mask < (1u << rule->param_count); mask++) {
+                if (!rule->reached[mask]) {
+                    continue;
+                }
+                for (size_t a = 0; a < rule->alt_count; a++) {
+                    const Alternative *alt = &rule->alts[a];
+                    if (!alt_enabled(alt, mask)) {
+                        continue;
+                    }
+                    for (size_t i = 0; i < alt->ref_count; i++) {
+                        const Ref *ref = &alt->refs[i];
+                        if (ref->rule >= 0 && !g_rules[ref->rule].reached[ref_instance(ref, mask)]) {
+                            g_rules[ref->rule].reached[ref_instance(ref, mask)] = 1;
+                            changed = 1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void write_instance_name(FILE *out, const Rule *rule, unsigned mask) {
+    fputs(rule->name, out);
+    for (int p = 0; p < rule->param_count; p++) {
+        if (!(mask & (1u << p))) {
+            continue;
+        }
+        for (const char *c = rule->params[p]; *c; c++) {
+            if (isupper((unsigned char)*c)) {
+                fputc('_', out);
+            }
+            fputc(tolower((unsigned char)*c), out);
+        }
+    }
+}
+
+static void write_text(FILE *out, size_t start, size_t end) {
+    fwrite(g_src + start, 1, end - start, out);
+}
+
+static void write_rule(FILE *out, const Rule *rule, unsigned mask, int first) {
+    if (first) {
+        write_text(out, rule->pre_start, rule->head_start);
+    } else {
+        fputs("\n\n", out);
+    }
+    write_instance_name(out, rule, mask);
+    write_text(out, rule->head_end, rule->colon);
+    int kept = 0;
+    for (size_t a = 0; a < rule->alt_count; a++) {
+        const Alternative *alt = &rule->alts[a];
+        if (!alt_enabled(alt, mask)) {
+            continue;
+        }
+        fputc(kept++ ? '|' : ':', out);
+        size_t pos = alt->start;
+        if (alt->guard_end != alt->guard_start) {
+            write_text(out, pos, alt->guard_start);
+            pos = alt->guard_end;
+            while (g_src[pos] == ' ' || g_src[pos] == '\t') {
+                pos++;
+            }
+        }
+        for (size_t i = 0; i < alt->ref_count; i++) {
+            const Ref *ref = &alt->refs[i];
+            write_text(out, pos, ref->start);
+            if (ref->rule >= 0) {
+                write_instance_name(out, &g_rules[ref->rule], ref_instance(ref, mask));
+            } else {
+                write_text(out, ref->start, ref->end);
+            }
+            pos = ref->end;
+        }
+        write_text(out, pos, alt->end);
+    }
+    if (!kept) {
+        fail(rule->head_start, "every alternative is guarded out for a reachable instance");
+    }
+    fputc(';', out);
+}
+
+// %type 行：带参规则的基名换成它的全部可达实例
+static void write_declarations(FILE *out, size_t start, size_t end) {
+    size_t pos = start;
+    while (pos < end) {
+        size_t line_end = pos;
+        while (line_end < end && g_src[line_end] != '\n') {
+            line_end++;
+        }
+        if (line_end < end) {
+            line_end++;
+        }
+        if (strncmp(g_src + pos, "%type", 5) != 0) {
+            write_text(out, pos, line_end);
+            pos = line_end;
+            continue;
+        }
+        while (pos < line_end) {
+            if (!is_ident_start(g_src[pos]) || (pos > start && (is_ident_char(g_src[pos - 1]) || g_src[pos - 1] == '%' || g_src[pos - 1] == '<'))) {
+                fputc(g_src[pos++], out);
+                continue;
+            }
+            char name[MAX_NAME];
+            size_t next = read_ident(pos, name);
+            int r = find_rule(name);
+            if (r < 0) {
+                write_text(out, pos, next);
+            } else {
+                int written = 0;
+                for (unsigned mask = 0; mask < (1u << g_rules[r].param_count); mask++) {
+                    if (g_rules[r].reached[mask]) {
+                        if (written++) {
+                            fputc(' ', out);
+                        }
+                        write_instance_name(out, &g_rules[r], mask);
+                    }
+                }
+            }
+            pos = next;
+        }
+    }
+}
+
+static size_t find_separator(size_t from) {
+    for (size_t pos = from; pos + 1 < g_len; pos++) {
+        if ((pos == 0 || g_src[pos - 1] == '\n') && g_src[pos] == '%' && g_src[pos + 1] == '%' &&
+            (pos + 2 == g_len || g_src[pos + 2] == '\n' || g_src[pos + 2] == '\r')) {
+            return pos;
+        }
+    }
+    return g_len;
+}
+
+static char *read_file(const char *path, size_t *len) {
+    FILE *in = fopen(path, "rb");
+    if (!in) {
+        perror(path);
+        return NULL;
+    }
+    size_t capacity = 1 << 16;
+    char *buf = (char *)malloc(capacity + 1);
+    size_t n = 0;
+    while (buf) {
+        n += fread(buf + n, 1, capacity - n, in);
+        if (n < capacity) {
+            break;
+        }
+        capacity *= 2;
+        char *next = (char *)realloc(buf, capacity + 1);
+        if (!next) {
+            free(buf);
+        }
+        buf = next;
+    }
+    fclose(in);
+    if (!buf) {
+        fprintf(stderr, "gen_grammar: out of memory\n");
+        return NULL;
+    }
+    buf[n] = '\0';
+    *len = n;
+    return buf;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <parser.y> <output.y>\n", argv[0]);
+        return 1;
+    }
+    char *src = read_file(argv[1], &g_len);
+    if (!src) {
+        return 1;
+    }
+    g_src = src;
+
+    size_t rules_start = find_separator(0);
+    if (rules_start == g_len) {
+        fprintf(stderr, "gen_grammar: no %%%% separator\n");
+        return 1;
+    }
+    rules_start += 2;
+    size_t rules_end = find_separator(rules_start);
+    parse_rules(rules_start, rules_end);
+    for (size_t r = 0; r < g_rule_count; r++) {
+        for (size_t a = 0; a < g_rules[r].alt_count; a++) {
+            for (size_t i = 0; i < g_rules[r].alts[a].ref_count; i++) {
+                resolve_ref(&g_rules[r], &g_rules[r].alts[a].refs[i]);
+            }
+        }
+    }
+    compute_relevance();
+    mark_reachable();
+
+    FILE *out = fopen(argv[2], "w");
+    if (!out) {
+        perror(argv[2]);
+        return 1;
+    }
+    write_declarations(out, 0, rules_start);
+    size_t pos = rules_start;
+    for (size_t r = 0; r < g_rule_count; r++) {
+        const Rule *rule = &g_rules[r];
+        int first = 1;
+        for (unsigned mask = 0; mask < (1u << rule->param_count); mask++) {
+            if (rule->reached[mask]) {
+                write_rule(out, rule, mask, first);
+                first = 0;
+            }
+        }
+        pos = rule->alts[rule->alt_count - 1].end + 1;
+    }
+    write_text(out, pos, g_len);
+    if (fclose(out) != 0) {
+        fprintf(stderr, "gen_grammar: write failed\n");
+        remove(argv[2]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,450 @@
+// 构建期工具：把 parser.y 中的 "// @TOKENS@" 一行替换为按 tokens.def 生成的 %token 声明，
+// "// @PARSER_MODE@" 一行替换为解析器类型声明（默认 GLR；--fast 为快速路径用的确定性推送式解析器）。
+// --validate 生成只验证语法、不构建 AST 的同一解析器（--validate-only）：文法与 LR 表不变，
+// 只换掉语义动作。规则中的动作后面可以跟
+//   %validate { ... }   只验证语法时改用这个动作
+//   %validate           只验证语法时照样执行前面的动作
+// 其余动作在 --validate 下都换成把值清零（语义值只有一个指针大），不带 --validate 时去掉 %validate 部分。
+// 用法：gen_tokens [--fast] [--validate] <parser.y> <输出.y>
+//
+// --glr-hooks 处理的是 Bison 生成的 GLR 解析器（glr.c 骨架）：在分裂、合并、归约等位置插入
+// GLR_STATS_HOOK 调用（--glr-stats / --glr-trace 的计数器，见 glr_stats.h）。骨架没有事件回调，
+// 插入点按骨架代码定位，每处的出现次数都要与预期一致，Bison 升级后骨架变了就让构建失败，
+// 而不是悄悄统计出全零。钩子与插入点写在同一行，#line 行号不受影响
+// 用法：gen_tokens --glr-hooks <bison 输出.c> <输出.c>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "token.h"
+
+typedef struct {
+    const char *bison;
+    const char *type;
+    int code;
+} TokenSpec;
+
+static const TokenSpec g_specs[] = {
+#define TOKEN(name, bison, type, display, attrs) { #bison, #type, TOK_##name },
+#include "tokens.def"
+};
+
+#define TOKENS_MARKER "// @TOKENS@"
+#define MODE_MARKER "// @PARSER_MODE@"
+#define VALIDATE_DIRECTIVE "%validate"
+#define VALIDATE_NULL_ACTION "{ $<node>$ = NULL; }"
+
+static const char *const g_glr_mode =
+    "%glr-parser\n"
+    "%param {JSParser *ctx}\n";
+
+// 只验证语法的 GLR 解析器与上面的链接在一起，符号加 jsvalidate_ 前缀
+static const char *const g_glr_validate_mode =
+    "%glr-parser\n"
+    "%define api.prefix {jsvalidate_}\n"
+    "%param {JSParser *ctx}\n";
+
+// 快速路径：LALR 推送式解析器，符号加 jsfast_ 前缀以便与 GLR 解析器链接在一起；
+// 只在“一致”状态使用默认归约，每次需要前瞻时都停在真实状态上，供冲突检查模拟；
+// 放弃一条语句时栈上的部分 AST 由析构器释放（GLR 解析器保持原样）
+static const char *const g_fast_mode =
+    "%define api.push-pull push\n"
+    "%define api.prefix {jsfast_}\n"
+    "%define lr.default-reduction consistent\n"
+    "%parse-param {JSParser *ctx}\n"
+    "%destructor { ast_free($$); } <node>\n"
+    "%destructor { ast_list_free($$); } <list>\n"
+    "%destructor { discard_suffix_chain($$); } <suffix>\n"
+    "%destructor { discard_binary_chain($$); } <chain>\n";
+
+// 只验证语法时栈上没有 AST（值为 NULL 或参数个数），只保留 parser.y 自己声明的析构器
+static const char *const g_fast_validate_mode =
+    "%define api.push-pull push\n"
+    "%define api.prefix {jsfastvalidate_}\n"
+    "%define lr.default-reduction consistent\n"
+    "%parse-param {JSParser *ctx}\n";
+
+// 插入点（按 Bison 3.8 glr.c 的代码；比较时忽略空白）与其后追加的钩子
+typedef struct {
+    const char *anchor;
+    const char *hook;
+    int count;
+} GLRHook;
+
+static const GLRHook g_glr_hooks[] = {
+    { "YY_DPRINTF ((stderr, \"Starting parse\\n\"));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_parse (ctx->glr_stats));", 1 },
+    { "*yycharp = yylex (&yylval, ctx);",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_token (ctx->glr_stats));", 1 },
+    { "YY_DPRINTF ((stderr, \"Now at end of input.\\n\"));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_lookahead (ctx->glr_stats, yysymbol_name (yytoken)));", 1 },
+    { "YY_SYMBOL_PRINT (\"Next token is\", yytoken, &yylval, &yylloc);",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_lookahead (ctx->glr_stats, yysymbol_name (yytoken)));", 1 },
+    // yyk 为 -1 是分裂结束后执行延后的动作，延后时已经计过
+    { "YY_REDUCE_PRINT ((yynormal || yyk == -1, yyvsp, yyk, yyrule, ctx));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_reduce (ctx->glr_stats, yyk, yyrule - 1, false));", 1 },
+    { "YY_DPRINTF ((stderr, \"Reduced stack %ld by rule %d (line %d); action deferred.  \" "
+      "\"Now in state %d.\\n\", YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule], yynewLRState));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_reduce (ctx->glr_stats, yyk, yyrule - 1, true));", 1 },
+    { "YY_DPRINTF ((stderr, \"Merging stack %ld into stack %ld.\\n\", YY_CAST (long, yyk), YY_CAST (long, yyi)));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_merge (ctx->glr_stats, yyk, yyi));", 1 },
+    { "YY_DPRINTF ((stderr, \"Splitting off stack %ld from %ld.\\n\", "
+      "YY_CAST (long, yynewStack), YY_CAST (long, yyk)));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_split (ctx->glr_stats, yynewStack, yyk));", 1 },
+    { "YY_DPRINTF ((stderr, \"Stack %ld dies.\\n\", YY_CAST (long, yyk)));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_die (ctx->glr_stats, yyk));", 2 },
+    { "YY_DPRINTF ((stderr, \"Stack %ld dies.\\n\", YY_CAST (long, yynewStack)));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_die (ctx->glr_stats, yynewStack));", 1 },
+    { "YY_DPRINTF ((stderr, \"Stack %ld dies \" \"(predicate failure or explicit user error).\\n\", "
+      "YY_CAST (long, yyk)));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_die (ctx->glr_stats, yyk));", 2 },
+    // yyreportAmbiguity 开头，报错之前
+    { "YY_USE (yyx1);",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_ambiguity (ctx->glr_stats));", 1 },
+    { "YY_DPRINTF ((stderr, \"Returning to deterministic operation.\\n\"));",
+      "GLR_STATS_HOOK (ctx, glr_stats_on_resume (ctx->glr_stats));", 2 },
+};
+
+#define GLR_HOOK_COUNT (sizeof(g_glr_hooks) / sizeof(g_glr_hooks[0]))
+
+static const char *g_src;
+static size_t g_len;
+
+static int line_is(const char *line, size_t len, const char *marker) {
+    return len == strlen(marker) && strncmp(line, marker, len) == 0;
+}
+
+static void write_tokens(FILE *out) {
+    fprintf(out, "// 以下 %%token 由 gen_tokens 按 src/tokens.def 生成，请勿手改\n");
+    for (size_t i = 0; i < sizeof(g_specs) / sizeof(g_specs[0]); i++) {
+        const TokenSpec *spec = &g_specs[i];
+        if (spec->type[0]) {
+            fprintf(out, "%%token %s %s %d\n", spec->type, spec->bison, spec->code);
+        } else {
+            fprintf(out, "%%token %s %d\n", spec->bison, spec->code);
+        }
+    }
+}
+
+static void fail(size_t pos, const char *msg) {
+    size_t line = 1;
+    for (size_t i = 0; i < pos && i < g_len; i++) {
+        if (g_src[i] == '\n') {
+            line++;
+        }
+    }
+    fprintf(stderr, "gen_tokens: line %zu: %s\n", line, msg);
+    exit(1);
+}
+
+// 跳过注释、字符/字符串字面量；pos 不在这些结构上时原样返回
+static size_t skip_literal(size_t pos) {
+    if (g_src[pos] == '/' && pos + 1 < g_len && g_src[pos + 1] == '/') {
+        while (pos < g_len && g_src[pos] != '\n') {
+            pos++;
+        }
+        return pos;
+    }
+    if (g_src[pos] == '/' && pos + 1 < g_len && g_src[pos + 1] == '*') {
+        const char *end = strstr(g_src + pos + 2, "*/");
+        if (!end) {
+            fail(pos, "unterminated comment");
+        }
+        return (size_t)(end - g_src) + 2;
+    }
+    if (g_src[pos] == '\'' || g_src[pos] == '"') {
+        char quote = g_src[pos++];
+        while (pos < g_len && g_src[pos] != quote && g_src[pos] != '\n') {
+            pos += g_src[pos] == '\\' ? 2 : 1;
+        }
+        if (pos >= g_len || g_src[pos] != quote) {
+            fail(pos, "unterminated literal");
+        }
+        return pos + 1;
+    }
+    return pos;
+}
+
+static int is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// 跳过空白与注释（不跳过字面量）
+static size_t skip_space(size_t pos) {
+    while (pos < g_len) {
+        if (is_space(g_src[pos])) {
+            pos++;
+            continue;
+        }
+        if (g_src[pos] != '/') {
+            break;
+        }
+        size_t next = skip_literal(pos);
+        if (next == pos) {
+            break;
+        }
+        pos = next;
+    }
+    return pos;
+}
+
+static size_t skip_action(size_t pos) {
+    int depth = 0;
+    while (pos < g_len) {
+        size_t next = skip_literal(pos);
+        if (next != pos) {
+            pos = next;
+            continue;
+        }
+        if (g_src[pos] == '{') {
+            depth++;
+        } else if (g_src[pos] == '}' && --depth == 0) {
+            return pos + 1;
+        }
+        pos++;
+    }
+    fail(pos, "unterminated action");
+    return pos;
+}
+
+static int at_validate_directive(size_t pos) {
+    size_t n = strlen(VALIDATE_DIRECTIVE);
+    if (pos + n > g_len || strncmp(g_src + pos, VALIDATE_DIRECTIVE, n) != 0) {
+        return 0;
+    }
+    char c = pos + n < g_len ? g_src[pos + n] : '\0';
+    return !(c == '_' || c == '-' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'));
+}
+
+static size_t find_separator(size_t from) {
+    for (size_t pos = from; pos + 1 < g_len; pos++) {
+        if ((pos == 0 || g_src[pos - 1] == '\n') && g_src[pos] == '%' && g_src[pos + 1] == '%' &&
+            (pos + 2 == g_len || g_src[pos + 2] == '\n' || g_src[pos + 2] == '\r')) {
+            return pos;
+        }
+    }
+    return g_len;
+}
+
+// 声明部分：按行替换两个标记；返回替换了哪些标记（位 0：TOKENS，位 1：PARSER_MODE）
+static int write_declarations(FILE *out, size_t end, const char *mode) {
+    int found = 0;
+    size_t pos = 0;
+    while (pos < end) {
+        size_t line_end = pos;
+        while (line_end < end && g_src[line_end] != '\n') {
+            line_end++;
+        }
+        size_t len = line_end - pos;
+        if (len > 0 && g_src[line_end - 1] == '\r') {
+            len--;
+        }
+        if (line_end < end) {
+            line_end++;
+        }
+        if (!(found & 1) && line_is(g_src + pos, len, TOKENS_MARKER)) {
+            write_tokens(out);
+            found |= 1;
+        } else if (!(found & 2) && line_is(g_src + pos, len, MODE_MARKER)) {
+            fputs(mode, out);
+            found |= 2;
+        } else {
+            fwrite(g_src + pos, 1, line_end - pos, out);
+        }
+        pos = line_end;
+    }
+    return found;
+}
+
+// 规则部分：按模式选用每个动作（或它的 %validate 版本）
+static void write_rules(FILE *out, size_t start, size_t end, int validate) {
+    size_t pos = start;
+    while (pos < end) {
+        size_t next = skip_literal(pos);
+        if (next != pos) {
+            fwrite(g_src + pos, 1, next - pos, out);
+            pos = next;
+            continue;
+        }
+        if (at_validate_directive(pos)) {
+            fail(pos, VALIDATE_DIRECTIVE " must follow an action");
+        }
+        if (g_src[pos] != '{') {
+            fputc(g_src[pos++], out);
+            continue;
+        }
+        size_t action_end = skip_action(pos);
+        size_t directive = skip_space(action_end);
+        if (!at_validate_directive(directive)) {
+            if (validate) {
+                fputs(VALIDATE_NULL_ACTION, out);
+            } else {
+                fwrite(g_src + pos, 1, action_end - pos, out);
+            }
+            pos = action_end;
+            continue;
+        }
+        size_t alt = skip_space(directive + strlen(VALIDATE_DIRECTIVE));
+        size_t alt_end = alt < end && g_src[alt] == '{' ? skip_action(alt) : alt;
+        if (validate && alt_end != alt) {
+            fwrite(g_src + alt, 1, alt_end - alt, out);
+        } else {
+            fwrite(g_src + pos, 1, action_end - pos, out);
+        }
+        // 去掉 %validate 部分；保留其后的空白，下一个候选式仍从行首开始
+        pos = alt_end != alt ? alt_end : directive + strlen(VALIDATE_DIRECTIVE);
+    }
+}
+
+// 从 pos 开始匹配 anchor，anchor 中的空白匹配任意多个（含零个）空白；返回匹配的结尾，不匹配返回 0
+static size_t match_anchor(size_t pos, const char *anchor) {
+    while (*anchor) {
+        if (is_space(*anchor)) {
+            while (is_space(*anchor)) {
+                anchor++;
+            }
+            while (pos < g_len && is_space(g_src[pos])) {
+                pos++;
+            }
+            continue;
+        }
+        if (pos >= g_len || g_src[pos] != *anchor) {
+            return 0;
+        }
+        pos++;
+        anchor++;
+    }
+    return pos;
+}
+
+static int write_glr_hooks(FILE *out) {
+    int found[GLR_HOOK_COUNT] = {0};
+    size_t pos = 0;
+    while (pos < g_len) {
+        size_t end = 0;
+        size_t i = 0;
+        for (; i < GLR_HOOK_COUNT; i++) {
+            if (g_src[pos] == g_glr_hooks[i].anchor[0] && (end = match_anchor(pos, g_glr_hooks[i].anchor)) != 0) {
+                break;
+            }
+        }
+        if (i == GLR_HOOK_COUNT) {
+            fputc(g_src[pos++], out);
+            continue;
+        }
+        fwrite(g_src + pos, 1, end - pos, out);
+        fprintf(out, " %s", g_glr_hooks[i].hook);
+        found[i]++;
+        pos = end;
+    }
+    int ok = 1;
+    for (size_t i = 0; i < GLR_HOOK_COUNT; i++) {
+        if (found[i] != g_glr_hooks[i].count) {
+            fprintf(stderr, "gen_tokens: GLR skeleton mismatch (expected %d, found %d): %s\n",
+                    g_glr_hooks[i].count, found[i], g_glr_hooks[i].anchor);
+            ok = 0;
+        }
+    }
+    return ok;
+}
+
+static char *read_file(const char *path, size_t *len) {
+    FILE *in = fopen(path, "rb");
+    if (!in) {
+        perror(path);
+        return NULL;
+    }
+    size_t capacity = 1 << 16;
+    char *buf = (char *)malloc(capacity + 1);
+    size_t n = 0;
+    while (buf) {
+        n += fread(buf + n, 1, capacity - n, in);
+        if (n < capacity) {
+            break;
+        }
+        capacity *= 2;
+        char *next = (char *)realloc(buf, capacity + 1);
+        if (!next) {
+            free(buf);
+        }
+        buf = next;
+    }
+    fclose(in);
+    if (!buf) {
+        fprintf(stderr, "gen_tokens: out of memory\n");
+        return NULL;
+    }
+    buf[n] = '\0';
+    *len = n;
+    return buf;
+}
+
+int main(int argc, char **argv) {
+    int fast = 0;
+    int validate = 0;
+    int glr_hooks = 0;
+    int arg = 1;
+    for (; arg < argc && strncmp(argv[arg], "--", 2) == 0; arg++) {
+        if (strcmp(argv[arg], "--fast") == 0) {
+            fast = 1;
+        } else if (strcmp(argv[arg], "--validate") == 0) {
+            validate = 1;
+        } else if (strcmp(argv[arg], "--glr-hooks") == 0) {
+            glr_hooks = 1;
+        } else {
+            break;
+        }
+    }
+    if (argc - arg != 2 || (glr_hooks && (fast || validate))) {
+        fprintf(stderr, "Usage: %s [--fast] [--validate] <parser.y> <output.y>\n"
+                        "       %s --glr-hooks <parser.c> <output.c>\n", argv[0], argv[0]);
+        return 1;
+    }
+    const char *in_path = argv[arg];
+    const char *out_path = argv[arg + 1];
+    const char *mode = fast ? (validate ? g_fast_validate_mode : g_fast_mode)
+                            : (validate ? g_glr_validate_mode : g_glr_mode);
+
+    char *src = read_file(in_path, &g_len);
+    if (!src) {
+        return 1;
+    }
+    g_src = src;
+    FILE *out = fopen(out_path, "w");
+    if (!out) {
+        perror(out_path);
+        free(src);
+        return 1;
+    }
+
+    if (glr_hooks) {
+        int ok = write_glr_hooks(out);
+        free(src);
+        if (fclose(out) != 0 || !ok) {
+            if (ok) {
+                fprintf(stderr, "gen_tokens: write failed\n");
+            }
+            remove(out_path);
+            return 1;
+        }
+        return 0;
+    }
+
+    size_t rules_start = find_separator(0);
+    size_t rules_end = rules_start < g_len ? find_separator(rules_start + 2) : g_len;
+    int found = write_declarations(out, rules_start, mode);
+    if (rules_start < g_len) {
+        write_rules(out, rules_start, rules_end, validate);
+        fwrite(g_src + rules_end, 1, g_len - rules_end, out);
+    }
+    free(src);
+
+    if (fclose(out) != 0 || found != 3) {
+        fprintf(stderr, "gen_tokens: %s\n", !(found & 1) ? "marker " TOKENS_MARKER " not found"
+                                          : !(found & 2) ? "marker " MODE_MARKER " not found"
+                                          : "write failed");
+        remove(out_path);
+        return 1;
+    }
+    return 0;
+}
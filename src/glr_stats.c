@@ -0,0 +1,373 @@
+// GLR 运行时统计与二进制事件轨迹：gen_tokens --glr-hooks 插入 parser.c 的钩子直接调用这里（见 glr_stats.h）
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "glr_stats.h"
+#include "parser_context.h"
+#include "parser.h"
+
+#if JS_GLR_STATS
+
+// 读入 token 之前的前瞻，用 Bison 对 YYEOF 的命名
+static const char EOF_NAME[] = "\"end of file\"";
+
+bool glr_stats_available(void) {
+    return true;
+}
+
+GLRStats *glr_stats_new(FILE *trace) {
+    GLRStats *stats = (GLRStats *)calloc(1, sizeof(GLRStats));
+    if (!stats) {
+        return NULL;
+    }
+    stats->split_stack = -1;
+    stats->trace = trace;
+    if (trace) {
+        fwrite(GLR_TRACE_MAGIC, 1, sizeof(GLR_TRACE_MAGIC) - 1, trace);
+    }
+    return stats;
+}
+
+void glr_stats_free(GLRStats *stats) {
+    if (!stats) {
+        return;
+    }
+    free(stats->by_token);
+    free(stats->by_rule);
+    free(stats->trace_names);
+    free(stats->trace_rules);
+    free(stats);
+}
+
+static void trace_uint(FILE *trace, unsigned long value) {
+    while (value >= 0x80) {
+        fputc((int)(value & 0x7f) | 0x80, trace);
+        value >>= 7;
+    }
+    fputc((int)value, trace);
+}
+
+static void trace_event(GLRStats *stats, GLREventKind kind, int argc, unsigned long a, unsigned long b) {
+    fputc(kind, stats->trace);
+    if (argc > 0) {
+        trace_uint(stats->trace, a);
+    }
+    if (argc > 1) {
+        trace_uint(stats->trace, b);
+    }
+}
+
+// 名字的编号：名字都来自 yytname，按指针识别；第一次出现时写 NAME 记录
+static unsigned long trace_name(GLRStats *stats, const char *name) {
+    for (size_t i = 0; i < stats->trace_name_count; i++) {
+        if (stats->trace_names[i] == name) {
+            return (unsigned long)i;
+        }
+    }
+    if (stats->trace_name_count == stats->trace_name_capacity) {
+        size_t capacity = stats->trace_name_capacity ? stats->trace_name_capacity * 2 : 64;
+        const char **names = (const char **)realloc(stats->trace_names, capacity * sizeof(*names));
+        if (!names) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            exit(1);
+        }
+        stats->trace_names = names;
+        stats->trace_name_capacity = capacity;
+    }
+    unsigned long id = (unsigned long)stats->trace_name_count;
+    stats->trace_names[stats->trace_name_count++] = name;
+    size_t len = strlen(name);
+    trace_event(stats, GLR_EVENT_NAME, 2, id, (unsigned long)len);
+    fwrite(name, 1, len, stats->trace);
+    return id;
+}
+
+static void trace_rule(GLRStats *stats, int rule) {
+    if ((size_t)rule >= stats->trace_rule_capacity) {
+        size_t capacity = stats->trace_rule_capacity ? stats->trace_rule_capacity : 512;
+        while (capacity <= (size_t)rule) {
+            capacity *= 2;
+        }
+        bool *rules = (bool *)realloc(stats->trace_rules, capacity * sizeof(bool));
+        if (!rules) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            exit(1);
+        }
+        memset(rules + stats->trace_rule_capacity, 0, (capacity - stats->trace_rule_capacity) * sizeof(bool));
+        stats->trace_rules = rules;
+        stats->trace_rule_capacity = capacity;
+    }
+    if (!stats->trace_rules[rule]) {
+        stats->trace_rules[rule] = true;
+        unsigned long lhs = trace_name(stats, parser_rule_lhs(rule));
+        trace_event(stats, GLR_EVENT_RULE, 2, (unsigned long)rule, (unsigned long)parser_rule_line(rule));
+        trace_uint(stats->trace, lhs);
+    }
+}
+
+static void count_token_split(GLRStats *stats) {
+    const char *name = stats->lookahead ? stats->lookahead : EOF_NAME;
+    for (size_t i = 0; i < stats->by_token_count; i++) {
+        if (stats->by_token[i].name == name) {
+            stats->by_token[i].splits++;
+            return;
+        }
+    }
+    if (stats->by_token_count == stats->by_token_capacity) {
+        size_t capacity = stats->by_token_capacity ? stats->by_token_capacity * 2 : 16;
+        GLRTokenSplits *items = (GLRTokenSplits *)realloc(stats->by_token, capacity * sizeof(*items));
+        if (!items) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            exit(1);
+        }
+        stats->by_token = items;
+        stats->by_token_capacity = capacity;
+    }
+    stats->by_token[stats->by_token_count].name = name;
+    stats->by_token[stats->by_token_count].splits = 1;
+    stats->by_token_count++;
+}
+
+static void count_rule_split(GLRStats *stats, int rule) {
+    for (size_t i = 0; i < stats->by_rule_count; i++) {
+        if (stats->by_rule[i].rule == rule) {
+            stats->by_rule[i].splits++;
+            return;
+        }
+    }
+    if (stats->by_rule_count == stats->by_rule_capacity) {
+        size_t capacity = stats->by_rule_capacity ? stats->by_rule_capacity * 2 : 16;
+        GLRRuleSplits *items = (GLRRuleSplits *)realloc(stats->by_rule, capacity * sizeof(*items));
+        if (!items) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            exit(1);
+        }
+        stats->by_rule = items;
+        stats->by_rule_capacity = capacity;
+    }
+    GLRRuleSplits *item = &stats->by_rule[stats->by_rule_count++];
+    item->rule = rule;
+    item->line = parser_rule_line(rule);
+    item->lhs = parser_rule_lhs(rule);
+    item->splits = 1;
+}
+
+static void set_live_stacks(GLRStats *stats, size_t live) {
+    stats->live_stacks = live;
+    if (live > stats->peak_stacks) {
+        stats->peak_stacks = live;
+    }
+}
+
+void glr_stats_on_parse(GLRStats *stats) {
+    stats->parses++;
+    stats->split_stack = -1;
+    set_live_stacks(stats, 1);
+    if (stats->trace) {
+        trace_event(stats, GLR_EVENT_PARSE, 0, 0, 0);
+    }
+}
+
+void glr_stats_on_token(GLRStats *stats) {
+    stats->tokens++;
+    stats->token_read = true;
+}
+
+void glr_stats_on_lookahead(GLRStats *stats, const char *name) {
+    stats->lookahead = name;
+    if (stats->token_read) {
+        stats->token_read = false;
+        if (stats->trace) {
+            trace_event(stats, GLR_EVENT_TOKEN, 1, trace_name(stats, name), 0);
+        }
+    }
+}
+
+// stack 为 -1 是分裂结束后执行延后的动作，已在延后时计过
+void glr_stats_on_reduce(GLRStats *stats, long stack, int rule, bool deferred) {
+    if (stack < 0) {
+        return;
+    }
+    stats->reductions++;
+    if (deferred) {
+        stats->deferred_actions++;
+    }
+    if (stack == stats->split_stack) {
+        stats->split_stack = -1;
+        count_rule_split(stats, rule);
+    }
+    if (stats->trace) {
+        trace_rule(stats, rule);
+        trace_event(stats, deferred ? GLR_EVENT_DEFER : GLR_EVENT_REDUCE, 2, (unsigned long)stack, (unsigned long)rule);
+    }
+}
+
+void glr_stats_on_split(GLRStats *stats, long stack, long from) {
+    stats->splits++;
+    stats->split_stack = stack;
+    count_token_split(stats);
+    set_live_stacks(stats, stats->live_stacks + 1);
+    if (stats->trace) {
+        trace_event(stats, GLR_EVENT_SPLIT, 2, (unsigned long)stack, (unsigned long)from);
+    }
+}
+
+void glr_stats_on_merge(GLRStats *stats, long stack, long into) {
+    stats->merges++;
+    set_live_stacks(stats, stats->live_stacks - 1);
+    if (stats->trace) {
+        trace_event(stats, GLR_EVENT_MERGE, 2, (unsigned long)stack, (unsigned long)into);
+    }
+}
+
+void glr_stats_on_die(GLRStats *stats, long stack) {
+    if (stats->live_stacks > 0) {
+        stats->live_stacks--;
+    }
+    if (stats->trace) {
+        trace_event(stats, GLR_EVENT_DIE, 1, (unsigned long)stack, 0);
+    }
+}
+
+void glr_stats_on_ambiguity(GLRStats *stats) {
+    stats->ambiguities++;
+    if (stats->trace) {
+        trace_event(stats, GLR_EVENT_AMBIGUITY, 0, 0, 0);
+    }
+}
+
+void glr_stats_on_resume(GLRStats *stats) {
+    set_live_stacks(stats, 1);
+    if (stats->trace) {
+        trace_event(stats, GLR_EVENT_RESUME, 0, 0, 0);
+    }
+}
+
+static void write_json_string(FILE *out, const char *s) {
+    fputc('"', out);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            fprintf(out, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(out, "\\u%04x", c);
+        } else {
+            fputc(c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+static int compare_token_splits(const void *a, const void *b) {
+    const GLRTokenSplits *x = (const GLRTokenSplits *)a;
+    const GLRTokenSplits *y = (const GLRTokenSplits *)b;
+    return x->splits != y->splits ? (x->splits < y->splits ? 1 : -1) : strcmp(x->name, y->name);
+}
+
+static int compare_rule_splits(const void *a, const void *b) {
+    const GLRRuleSplits *x = (const GLRRuleSplits *)a;
+    const GLRRuleSplits *y = (const GLRRuleSplits *)b;
+    return x->splits != y->splits ? (x->splits < y->splits ? 1 : -1) : x->rule - y->rule;
+}
+
+void glr_stats_write_json(const GLRStats *stats, FILE *out) {
+    // 按分裂次数从多到少输出；排序在副本上做，stats 保持不变
+    GLRTokenSplits *tokens = (GLRTokenSplits *)malloc((stats->by_token_count + 1) * sizeof(*tokens));
+    GLRRuleSplits *rules = (GLRRuleSplits *)malloc((stats->by_rule_count + 1) * sizeof(*rules));
+    if (!tokens || !rules) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        exit(1);
+    }
+    // 没有分裂时两张表都还没分配（NULL），不能交给 memcpy/qsort
+    if (stats->by_token_count) {
+        memcpy(tokens, stats->by_token, stats->by_token_count * sizeof(*tokens));
+        qsort(tokens, stats->by_token_count, sizeof(*tokens), compare_token_splits);
+    }
+    if (stats->by_rule_count) {
+        memcpy(rules, stats->by_rule, stats->by_rule_count * sizeof(*rules));
+        qsort(rules, stats->by_rule_count, sizeof(*rules), compare_rule_splits);
+    }
+
+    fprintf(out, "{\"parses\": %zu, \"tokens\": %zu, \"reductions\": %zu, \"splits\": %zu, "
+                 "\"merges\": %zu, \"deferred_actions\": %zu, \"ambiguities\": %zu, \"peak_stacks\": %zu, "
+                 "\"splits_by_token\": {",
+            stats->parses, stats->tokens, stats->reductions, stats->splits,
+            stats->merges, stats->deferred_actions, stats->ambiguities, stats->peak_stacks);
+    for (size_t i = 0; i < stats->by_token_count; i++) {
+        fputs(i ? ", " : "", out);
+        write_json_string(out, tokens[i].name);
+        fprintf(out, ": %zu", tokens[i].splits);
+    }
+    fputs("}, \"splits_by_rule\": [", out);
+    for (size_t i = 0; i < stats->by_rule_count; i++) {
+        fprintf(out, "%s{\"rule\": %d, \"line\": %d, \"lhs\": ", i ? ", " : "", rules[i].rule, rules[i].line);
+        write_json_string(out, rules[i].lhs);
+        fprintf(out, ", \"splits\": %zu}", rules[i].splits);
+    }
+    fputs("]}\n", out);
+    free(tokens);
+    free(rules);
+}
+
+#else
+
+// GLR_STATS=0：parser.c 中的钩子编译为空，统计不可用
+bool glr_stats_available(void) {
+    return false;
+}
+
+GLRStats *glr_stats_new(FILE *trace) {
+    (void)trace;
+    return NULL;
+}
+
+void glr_stats_free(GLRStats *stats) {
+    (void)stats;
+}
+
+void glr_stats_write_json(const GLRStats *stats, FILE *out) {
+    (void)stats;
+    (void)out;
+}
+
+#endif
+
+#if YYDEBUG
+
+// 只验证语法的 GLR 解析器（parser_validate.c，前缀 jsvalidate_）有自己的一份 yydebug
+extern int jsvalidate_debug;
+
+// yydebug 是进程级全局量，只在这里写一次；解析线程只读它
+bool glr_trace_enable_text(void) {
+    yydebug = 1;
+    jsvalidate_debug = 1;
+    return true;
+}
+
+// glr.c 报告歧义时不看 yydebug 直接调用 YYFPRINTF，没有打开文本跟踪时丢弃
+int glr_trace_fprintf(FILE *stream, const char *format, ...) {
+    if (!yydebug) {
+        return 0;
+    }
+    va_list args;
+    va_start(args, format);
+    int written = vfprintf(stream, format, args);
+    va_end(args);
+    return written;
+}
+
+#else
+
+// RELEASE=1（YYDEBUG=0）：没有文本跟踪，glr.c 也不再调用 YYFPRINTF
+bool glr_trace_enable_text(void) {
+    return false;
+}
+
+int glr_trace_fprintf(FILE *stream, const char *format, ...) {
+    (void)stream;
+    (void)format;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef GLR_STATS_H
+#define GLR_STATS_H
+
+// GLR 运行时统计（--glr-stats）与二进制事件轨迹（--glr-trace）。
+// glr.c 骨架没有事件回调：构建时 gen_tokens --glr-hooks 在生成的 parser.c（及 parser_validate.c）
+// 的分裂、合并、归约等位置插入 GLR_STATS_HOOK，直接调用下面的 glr_stats_on_*，
+// 统计对象挂在本次解析的 JSParser 上，各线程的解析互不影响。
+// 计数器有自己的编译开关 JS_GLR_STATS（make GLR_STATS=0 关闭），与 YYDEBUG 无关：
+// RELEASE=1 构建没有文本跟踪，但照样可以统计；只是规则行号（yyrline）不可用，记为 0
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifndef JS_GLR_STATS
+#define JS_GLR_STATS 1
+#endif
+
+#if JS_GLR_STATS
+#define GLR_STATS_HOOK(ctx, call) do { if ((ctx)->glr_stats) { call; } } while (0)
+#else
+#define GLR_STATS_HOOK(ctx, call) ((void)0)
+#endif
+
+// 二进制轨迹：文件头 GLR_TRACE_MAGIC（8 字节），之后每条记录是 1 字节事件类型加若干
+// 无符号 LEB128 整数。名字（token、规则左部）第一次出现时先写一条 NAME 记录定义编号，
+// 规则第一次出现时先写一条 RULE 记录，之后只引用编号
+#define GLR_TRACE_MAGIC "JSGLRT1\n"
+
+typedef enum
+{
+    GLR_EVENT_NAME = 'N',       // 名字编号、字节数、字节
+    GLR_EVENT_RULE = 'L',       // 规则号、parser.y 中的行号、左部名字编号
+    GLR_EVENT_PARSE = 'P',      // 一次 yyparse 开始（快速路径回退时每段一次）
+    GLR_EVENT_TOKEN = 'T',      // 读入 token：名字编号
+    GLR_EVENT_REDUCE = 'R',     // 立即归约：栈号、规则号
+    GLR_EVENT_DEFER = 'D',      // 延后归约（分裂期间）：栈号、规则号
+    GLR_EVENT_SPLIT = 'S',      // 分裂：新栈号、原栈号
+    GLR_EVENT_MERGE = 'M',      // 合并：被合并的栈号、目标栈号
+    GLR_EVENT_DIE = 'X',        // 栈消亡：栈号
+    GLR_EVENT_AMBIGUITY = 'A',  // 无法按 %dprec 消解的歧义
+    GLR_EVENT_RESUME = 'Z'      // 回到单栈确定性运行
+} GLREventKind;
+
+typedef struct
+{
+    const char *name;           // Bison 的符号名，如 IDENTIFIER、'('
+    size_t splits;
+} GLRTokenSplits;
+
+typedef struct
+{
+    int rule;                   // 与 bison -v 输出中的规则号一致
+    int line;                   // 在生成的 build/generated/parser.y 中的行号（RELEASE=1 构建中为 0）
+    const char *lhs;
+    size_t splits;
+} GLRRuleSplits;
+
+typedef struct GLRStats
+{
+    size_t parses;              // yyparse 调用次数
+    size_t tokens;              // GLR 解析器读入的 token 数（含输入结束）
+    size_t reductions;          // 全部归约，含延后的
+    size_t splits;
+    size_t merges;              // 到达同一状态而并回已有栈的次数
+    size_t deferred_actions;    // 分裂期间延后执行的语义动作数
+    size_t ambiguities;
+    size_t peak_stacks;         // 同时存活的栈数峰值
+    GLRTokenSplits *by_token;   // 分裂时的前瞻 token，按出现顺序
+    size_t by_token_count;
+    size_t by_token_capacity;
+    GLRRuleSplits *by_rule;     // 分裂出的栈首先归约的规则（即冲突中的那条归约）
+    size_t by_rule_count;
+    size_t by_rule_capacity;
+
+    // 以下为钩子之间传递的内部状态
+    size_t live_stacks;
+    long split_stack;           // 刚分裂出、尚未归约的栈，-1 表示没有
+    const char *lookahead;
+    bool token_read;            // 读入了新 token，等待 glr_stats_on_lookahead 给出它的名字
+    FILE *trace;                // 二进制轨迹，NULL 表示不写
+    const char **trace_names;   // 已写过 NAME 记录的名字，下标即编号
+    size_t trace_name_count;
+    size_t trace_name_capacity;
+    bool *trace_rules;          // 已写过 RULE 记录的规则
+    size_t trace_rule_capacity;
+} GLRStats;
+
+// 当前构建是否带有统计钩子（JS_GLR_STATS）
+bool glr_stats_available(void);
+// 打开文本跟踪（JS_PARSER_TRACE）：yydebug 是整个进程共用的全局量，须在任何解析开始之前调用；
+// 没有跟踪代码的构建（YYDEBUG=0）返回 false
+bool glr_trace_enable_text(void);
+// trace 非 NULL 时同时写二进制轨迹（调用方负责打开与关闭）；不支持或内存不足时返回 NULL
+GLRStats *glr_stats_new(FILE *trace);
+void glr_stats_free(GLRStats *stats);
+// 单行 JSON
+void glr_stats_write_json(const GLRStats *stats, FILE *out);
+
+// 由 parser.c 中插入的钩子调用；stack 为 GLR 栈号，rule 与 bison -v 的规则号一致
+void glr_stats_on_parse(GLRStats *stats);
+void glr_stats_on_token(GLRStats *stats);
+void glr_stats_on_lookahead(GLRStats *stats, const char *name);
+void glr_stats_on_reduce(GLRStats *stats, long stack, int rule, bool deferred);
+void glr_stats_on_split(GLRStats *stats, long stack, long from);
+void glr_stats_on_merge(GLRStats *stats, long stack, long into);
+void glr_stats_on_die(GLRStats *stats, long stack);
+void glr_stats_on_ambiguity(GLRStats *stats);
+void glr_stats_on_resume(GLRStats *stats);
+
+// parser.c 的 YYFPRINTF：只输出 JS_PARSER_TRACE 的文本跟踪
+int glr_trace_fprintf(FILE *stream, const char *format, ...);
+
+#endif // GLR_STATS_H
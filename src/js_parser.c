@@ -0,0 +1,314 @@
+// 解析库入口：把一次解析的输入、选项和结果串起来，状态全部在 JSParser 上
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "js_parser.h"
+#include "parser_context.h"
+#include "parser.h"
+
+JSParser *js_parser_new(void) {
+    JSParser *parser = (JSParser *)calloc(1, sizeof(JSParser));
+    if (!parser) {
+        return NULL;
+    }
+    diag_init(&parser->diag);
+    parser->module_mode = true;
+    return parser;
+}
+
+void js_parser_free(JSParser *parser) {
+    if (!parser) {
+        return;
+    }
+    if (parser->push) {
+        // 推送式解析未 finish：结束输入并丢弃结果
+        JSParseResult result;
+        js_parser_finish(parser, &result);
+        js_parse_result_free(&result);
+    }
+    parser_adapter_free(parser);
+    parser_fast_path_free(parser);
+    parser_validate_free(parser);
+    diag_dispose(&parser->diag);
+    free(parser);
+}
+
+void js_parse_options_init(JSParseOptions *options) {
+    memset(options, 0, sizeof(*options));
+    options->module_mode = true;
+}
+
+void js_parse_result_free(JSParseResult *result) {
+    if (!result) {
+        return;
+    }
+    // AST 中的名字属于 atom 表，先释放 AST
+    ast_free(result->ast);
+    if (result->atoms) {
+        atom_table_dispose(result->atoms);
+        free(result->atoms);
+    }
+    for (size_t i = 0; i < result->diagnostic_count; i++) {
+        free(result->diagnostics[i].message);
+    }
+    free(result->diagnostics);
+    glr_stats_free(result->glr_stats);
+    memset(result, 0, sizeof(*result));
+}
+
+// 每次解析使用新的 atom 表，解析结束后连同 AST 一起交给调用方
+static bool begin_parse(JSParser *parser, const JSParseOptions *options, JSParseResult *result) {
+    memset(result, 0, sizeof(*result));
+    parser->atoms = (AtomTable *)malloc(sizeof(AtomTable));
+    if (!parser->atoms) {
+        return false;
+    }
+    atom_table_init(parser->atoms);
+    parser->ast_root = NULL;
+    parser->error_count = 0;
+    parser->module_mode = options->module_mode;
+    parser->print_errors = options->print_errors;
+    parser->glr_only = options->glr_only;
+    parser->validate_only = options->validate_only;
+    diag_reset(&parser->diag);
+    diag_set_current_file(&parser->diag, options->filename);
+    diag_set_error_log_path(&parser->diag, options->error_log_path);
+    // 统计对象随结果交给调用方；GLR_STATS=0 构建不支持时为 NULL，解析照常进行
+    parser->glr_stats = NULL;
+    if (options->glr_stats || options->glr_trace) {
+        parser->glr_stats = glr_stats_new(options->glr_trace);
+    }
+    return true;
+}
+
+// 输入设置失败：丢弃本次的 atom 表，result 保持全空
+static bool abort_parse(JSParser *parser) {
+    glr_stats_free(parser->glr_stats);
+    parser->glr_stats = NULL;
+    atom_table_dispose(parser->atoms);
+    free(parser->atoms);
+    parser->atoms = NULL;
+    return false;
+}
+
+static bool finish_parse(JSParser *parser, JSParseResult *result) {
+    int rc = parser->validate_only ? parser_validate(parser) : parser_parse(parser);
+    bool lex_error = parser_had_lex_error(parser);
+    parser_release_input(parser);
+
+    result->ast = parser->ast_root;
+    result->atoms = parser->atoms;
+    result->error_count = parser->error_count + (lex_error ? 1 : 0);
+    result->diagnostics = diag_take_messages(&parser->diag, &result->diagnostic_count);
+    result->fast_statements = parser->fast_statements;
+    result->glr_statements = parser->glr_statements;
+    result->glr_stats = parser->glr_stats;
+    parser->glr_stats = NULL;
+    parser->ast_root = NULL;
+    parser->atoms = NULL;
+    return rc == 0 && result->error_count == 0;
+}
+
+bool js_parse_buffer(JSParser *parser, const char *input, size_t length,
+                     const JSParseOptions *options, JSParseResult *result) {
+    JSParseOptions defaults;
+    if (!options) {
+        js_parse_options_init(&defaults);
+        options = &defaults;
+    }
+    if (!begin_parse(parser, options, result)) {
+        return false;
+    }
+
+    // 词法分析器以 NUL 作为结束哨兵；未保证时复制一份并追加换行与 NUL
+    char *copy = NULL;
+    if (!options->input_terminated) {
+        copy = (char *)malloc(length + 2);
+        if (!copy) {
+            return abort_parse(parser);
+        }
+        memcpy(copy, input, length);
+        copy[length++] = '\n';
+        copy[length] = '\0';
+        input = copy;
+    }
+
+    bool ok;
+    if (parser_set_input(parser, input, length)) {
+        if (options->pretokenize || options->lex_threads > 1) {
+            parser_pretokenize(parser, options->lex_threads, options->lex_chunk_size);
+        } else if (options->lex_pipeline) {
+            parser_lex_pipeline(parser);
+        }
+        ok = finish_parse(parser, result);
+    } else {
+        ok = abort_parse(parser);
+    }
+    free(copy);
+    return ok;
+}
+
+bool js_parse_stream(JSParser *parser, FILE *file,
+                     const JSParseOptions *options, JSParseResult *result) {
+    JSParseOptions defaults;
+    if (!options) {
+        js_parse_options_init(&defaults);
+        options = &defaults;
+    }
+    if (!begin_parse(parser, options, result)) {
+        return false;
+    }
+    if (!parser_set_input_stream(parser, file, options->stream_window)) {
+        return abort_parse(parser);
+    }
+    return finish_parse(parser, result);
+}
+
+// 推送式解析：glr.c 骨架没有 push 模式（api.push-pull 只支持 LALR 骨架），GLR 的分裂栈也无法在
+// 任意 token 处挂起，所以改为在后台线程运行拉取式的 yyparse，词法器的 YYFILL 从有界的接收队列取数据，
+// 队列空时阻塞等待 js_parser_feed——YYFILL 本身就是词法器可以恢复的位置
+#define PUSH_QUEUE_CAPACITY (64 * 1024)
+
+typedef struct PushSession
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t readable;    // 有数据或输入结束
+    pthread_cond_t writable;    // 有空位或解析结束
+    char *data;                 // 环形接收队列
+    size_t capacity;
+    size_t head;
+    size_t count;
+    bool closed;                // 已 finish，不会再有数据
+    bool finished;              // 解析线程已退出（可能因错误提前结束）
+    bool ok;
+    JSParser *parser;
+    JSParseResult result;
+} PushSession;
+
+// 解析线程中的 YYFILL 数据源
+static size_t push_read(void *source, char *buffer, size_t size) {
+    PushSession *session = (PushSession *)source;
+    pthread_mutex_lock(&session->lock);
+    while (session->count == 0 && !session->closed) {
+        pthread_cond_wait(&session->readable, &session->lock);
+    }
+    size_t n = session->count < size ? session->count : size;
+    size_t first = session->capacity - session->head;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(buffer, session->data + session->head, first);
+    memcpy(buffer + first, session->data, n - first);
+    session->head = (session->head + n) % session->capacity;
+    session->count -= n;
+    pthread_cond_signal(&session->writable);
+    pthread_mutex_unlock(&session->lock);
+    return n;
+}
+
+static void *push_main(void *arg) {
+    PushSession *session = (PushSession *)arg;
+    session->ok = finish_parse(session->parser, &session->result);
+    pthread_mutex_lock(&session->lock);
+    session->finished = true;
+    pthread_cond_signal(&session->writable);
+    pthread_mutex_unlock(&session->lock);
+    return NULL;
+}
+
+static void push_session_free(PushSession *session) {
+    pthread_mutex_destroy(&session->lock);
+    pthread_cond_destroy(&session->readable);
+    pthread_cond_destroy(&session->writable);
+    free(session->data);
+    free(session);
+}
+
+bool js_parser_begin(JSParser *parser, const JSParseOptions *options) {
+    JSParseOptions defaults;
+    if (!options) {
+        js_parse_options_init(&defaults);
+        options = &defaults;
+    }
+    if (parser->push) {
+        return false;
+    }
+    PushSession *session = (PushSession *)calloc(1, sizeof(PushSession));
+    if (!session) {
+        return false;
+    }
+    session->capacity = options->stream_window ? options->stream_window : PUSH_QUEUE_CAPACITY;
+    session->data = (char *)malloc(session->capacity);
+    session->parser = parser;
+    pthread_mutex_init(&session->lock, NULL);
+    pthread_cond_init(&session->readable, NULL);
+    pthread_cond_init(&session->writable, NULL);
+    if (!session->data || !begin_parse(parser, options, &session->result)) {
+        push_session_free(session);
+        return false;
+    }
+    if (!parser_set_input_reader(parser, push_read, session, options->stream_window)) {
+        abort_parse(parser);
+        push_session_free(session);
+        return false;
+    }
+    if (pthread_create(&session->thread, NULL, push_main, session) != 0) {
+        parser_release_input(parser);
+        abort_parse(parser);
+        push_session_free(session);
+        return false;
+    }
+    parser->push = session;
+    return true;
+}
+
+bool js_parser_feed(JSParser *parser, const char *bytes, size_t length) {
+    PushSession *session = parser->push;
+    if (!session) {
+        return false;
+    }
+    pthread_mutex_lock(&session->lock);
+    while (length > 0 && !session->finished) {
+        if (session->count == session->capacity) {
+            pthread_cond_wait(&session->writable, &session->lock);
+            continue;
+        }
+        size_t tail = (session->head + session->count) % session->capacity;
+        size_t n = session->capacity - session->count;
+        if (n > session->capacity - tail) {
+            n = session->capacity - tail;
+        }
+        if (n > length) {
+            n = length;
+        }
+        memcpy(session->data + tail, bytes, n);
+        session->count += n;
+        bytes += n;
+        length -= n;
+        pthread_cond_signal(&session->readable);
+    }
+    bool accepting = !session->finished;
+    pthread_mutex_unlock(&session->lock);
+    return accepting;
+}
+
+bool js_parser_finish(JSParser *parser, JSParseResult *result) {
+    PushSession *session = parser->push;
+    if (!session) {
+        memset(result, 0, sizeof(*result));
+        return false;
+    }
+    pthread_mutex_lock(&session->lock);
+    session->closed = true;
+    pthread_cond_signal(&session->readable);
+    pthread_mutex_unlock(&session->lock);
+    pthread_join(session->thread, NULL);
+
+    *result = session->result;
+    bool ok = session->ok;
+    parser->push = NULL;
+    push_session_free(session);
+    return ok;
+}
@@ -0,0 +1,76 @@
+#ifndef JS_PARSER_H
+#define JS_PARSER_H
+
+// 可嵌入的解析库接口（libjsparser.a）：每个 JSParser 持有一次解析所需的全部状态，
+// 不同线程各用各的 JSParser 即可在同一进程内并发解析；同一个 JSParser 可以反复使用，
+// 但不能同时被两个线程使用
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "ast.h"
+#include "atom.h"
+#include "diagnostics.h"
+#include "glr_stats.h"
+
+#ifndef JS_PARSER_DEFINED
+#define JS_PARSER_DEFINED
+typedef struct JSParser JSParser;
+#endif
+
+typedef DiagMessage JSDiagnostic;
+
+typedef struct
+{
+    bool module_mode;           // 默认 true；false 时按脚本解析（import/export 等视为标识符）
+    bool pretokenize;           // 先整块切分 token 再解析（仅整块输入）
+    int lex_threads;            // > 1 时并行预分词，隐含 pretokenize
+    size_t lex_chunk_size;      // 并行预分词的段大小，0 表示按线程数均分
+    bool lex_pipeline;          // 词法分析放到后台线程与解析并行（仅整块输入，预分词时忽略）
+    size_t stream_window;       // js_parse_stream / 推送式解析的读取窗口，0 表示默认值
+    bool input_terminated;      // input[length] 已是 NUL 且末尾已有换行，可以原地解析不复制
+    bool print_errors;          // 错误同时输出到 stderr（命令行工具的行为）
+    bool glr_only;              // 不走确定性快速路径，整个输入交给 GLR（得到的 AST 相同）
+    bool validate_only;         // 只检查语法，不构建 AST（result->ast 为 NULL），成败与错误信息同完整解析
+    bool glr_stats;             // 统计 GLR 的分裂、合并等（result->glr_stats）；只计交给 GLR 的部分，覆盖整个输入需同时设 glr_only
+    FILE *glr_trace;            // 非 NULL 时把 GLR 事件以二进制轨迹写入（隐含 glr_stats，调用方负责关闭）
+    const char *filename;       // 诊断与错误日志中的文件名，可为 NULL
+    const char *error_log_path; // 非 NULL 时语法错误追加写入该文件
+} JSParseOptions;
+
+typedef struct
+{
+    ASTNode *ast;               // 解析失败时可能为 NULL
+    AtomTable *atoms;           // AST 中的名字都由它持有，须在 AST 之后释放
+    JSDiagnostic *diagnostics;  // 语法与词法错误，按出现顺序
+    size_t diagnostic_count;
+    int error_count;            // 语法错误数 + 词法错误（最多 1 个，词法错误会终止解析）
+    size_t fast_statements;     // 由确定性快速路径解析的顶层语句数
+    size_t glr_statements;      // 回退到 GLR 的分段数（每段通常是一条顶层语句）
+    GLRStats *glr_stats;        // 请求了统计时非 NULL（GLR_STATS=0 构建中始终为 NULL）
+} JSParseResult;
+
+JSParser *js_parser_new(void);
+void js_parser_free(JSParser *parser);
+void js_parse_options_init(JSParseOptions *options);
+
+// 解析 [input, input + length)；options 为 NULL 时使用默认值。
+// 返回 true 表示没有任何错误；无论成败 result 都需要 js_parse_result_free，
+// result->atoms 为 NULL 表示内存不足、解析没有开始
+bool js_parse_buffer(JSParser *parser, const char *input, size_t length,
+                     const JSParseOptions *options, JSParseResult *result);
+// 从 file 按窗口流式读取并解析（不支持预分词）
+bool js_parse_stream(JSParser *parser, FILE *file,
+                     const JSParseOptions *options, JSParseResult *result);
+void js_parse_result_free(JSParseResult *result);
+
+// 推送式解析：输入分块到达（网络回放、上传流）时边收边解析，不必等最后一个字节。
+// js_parser_begin 之后反复 js_parser_feed，最后 js_parser_finish 取得结果（与 js_parse_buffer 相同）。
+// 解析在后台线程进行，常驻内存只有固定大小的接收队列、词法窗口和语法本身需要的栈；
+// 队列满时 feed 阻塞，返回 false 表示解析已经结束（出错），其余数据不必再送。
+// begin 与 finish 之间只能对该 JSParser 调用 feed，且须来自同一个线程
+bool js_parser_begin(JSParser *parser, const JSParseOptions *options);
+bool js_parser_feed(JSParser *parser, const char *bytes, size_t length);
+bool js_parser_finish(JSParser *parser, JSParseResult *result);
+
+#endif // JS_PARSER_H
@@ -0,0 +1,297 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "token.h"
+
+// 并行预分词：把整块输入按换行切成若干段，各段在工作线程里按猜测的入口状态推测切分，
+// 再由主线程从前往后拼接。拼接时用真实状态从上一段末尾继续串行切分，直到某个 token
+// 与推测结果的位置、类型和切分后状态完全一致——之后的 token 由确定性保证相同，直接照搬；
+// 猜错（段首落在注释、字符串、模板里，或正则/除号判断不同）时就一直串行重切到重新对齐为止。
+
+// 参与对齐比较的词法状态：换行标记在每次取 token 时重置，不影响之后的切分。
+// 模板片段的 token 不含 '`'、'${' 等定界符，所以切分后的位置要单独记录
+typedef struct
+{
+    uint32_t cursor;
+    uint8_t prev_tok_state;
+    uint8_t in_template_expression;
+    int template_expr_depth;
+    int template_nesting_depth;
+} LexSnapshot;
+
+typedef struct
+{
+    size_t start;           // 段起点（行首）
+    size_t end;             // 段终点，只记录起点在 [start, end) 内的 token
+    PrevTokenState guess;   // 猜测的入口状态
+    TokenBuffer tokens;
+    LexSnapshot *states;    // states[i] 为切出 tokens[i] 之后的状态
+    size_t state_capacity;
+    size_t usable;          // 可照搬的 token 数（不含末尾的错误 token，错误交给串行切分报告）
+    size_t search;          // 拼接时的查找位置（真实 token 的偏移单调递增）
+    bool failed;            // 内存不足
+} LexChunk;
+
+typedef struct
+{
+    const char *input;
+    size_t length;
+    LexChunk *chunks;
+    size_t count;
+    size_t first;           // 本线程处理 first, first + stride, ...
+    size_t stride;
+} LexWorker;
+
+static LexSnapshot lex_snapshot(const Lexer *lexer) {
+    LexSnapshot snapshot;
+    snapshot.cursor = (uint32_t)(lexer->cursor - lexer->input);
+    snapshot.prev_tok_state = (uint8_t)lexer->prev_tok_state;
+    snapshot.in_template_expression = (uint8_t)lexer->in_template_expression;
+    snapshot.template_expr_depth = lexer->template_expr_depth;
+    snapshot.template_nesting_depth = lexer->template_nesting_depth;
+    return snapshot;
+}
+
+static bool lex_snapshot_equal(const LexSnapshot *a, const LexSnapshot *b) {
+    return a->cursor == b->cursor
+        && a->prev_tok_state == b->prev_tok_state
+        && a->in_template_expression == b->in_template_expression
+        && a->template_expr_depth == b->template_expr_depth
+        && a->template_nesting_depth == b->template_nesting_depth;
+}
+
+static void lex_snapshot_apply(Lexer *lexer, const LexSnapshot *snapshot) {
+    lexer->cursor = lexer->input + snapshot->cursor;
+    lexer->prev_tok_state = (PrevTokenState)snapshot->prev_tok_state;
+    lexer->in_template_expression = snapshot->in_template_expression != 0;
+    lexer->template_expr_depth = snapshot->template_expr_depth;
+    lexer->template_nesting_depth = snapshot->template_nesting_depth;
+}
+
+// 段首之前最后一个非空白字符是值的结尾（标识符、数字、右括号、引号）时，'/' 多半是除号
+static PrevTokenState guess_entry_state(const char *input, size_t start) {
+    size_t i = start;
+    size_t budget = 256;
+    while (i > 0 && budget-- > 0) {
+        unsigned char c = (unsigned char)input[--i];
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            continue;
+        }
+        if (c == ')' || c == ']' || c == '}' || c == '"' || c == '\'' || c == '`'
+            || c == '_' || c == '$' || (c >= '0' && c <= '9')
+            || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c >= 0x80) {
+            return PREV_TOK_NO_REGEX;
+        }
+        return PREV_TOK_CAN_REGEX;
+    }
+    return PREV_TOK_CAN_REGEX;
+}
+
+static bool chunk_push(LexChunk *chunk, const Token *token, const Lexer *lexer) {
+    if (chunk->tokens.count == chunk->state_capacity) {
+        size_t capacity = chunk->state_capacity ? chunk->state_capacity * 2 : 1024;
+        LexSnapshot *states = (LexSnapshot *)realloc(chunk->states, capacity * sizeof(LexSnapshot));
+        if (!states) {
+            return false;
+        }
+        chunk->states = states;
+        chunk->state_capacity = capacity;
+    }
+    chunk->states[chunk->tokens.count] = lex_snapshot(lexer);
+    return token_buffer_push(&chunk->tokens, token, lexer->has_newline);
+}
+
+static void lex_chunk(const char *input, size_t length, LexChunk *chunk) {
+    Lexer lexer;
+    lexer_init_at(&lexer, input, length, chunk->start);
+    lexer.prev_tok_state = chunk->guess;
+    lexer.quiet = true;
+
+    Token token;
+    for (;;) {
+        token = lexer_next_token(&lexer);
+        if (token.type != TOK_EOF && token.offset >= chunk->end) {
+            break;
+        }
+        if (!chunk_push(chunk, &token, &lexer)) {
+            chunk->failed = true;
+            break;
+        }
+        if (token.type == TOK_EOF || token.type == TOK_ERROR) {
+            break;
+        }
+    }
+    chunk->usable = chunk->tokens.count;
+    if (chunk->usable > 0 && chunk->tokens.types[chunk->usable - 1] == TOK_ERROR) {
+        chunk->usable--;
+    }
+    lexer_dispose(&lexer);
+}
+
+static void *lex_worker_main(void *arg) {
+    LexWorker *worker = (LexWorker *)arg;
+    for (size_t i = worker->first; i < worker->count; i += worker->stride) {
+        lex_chunk(worker->input, worker->length, &worker->chunks[i]);
+    }
+    return NULL;
+}
+
+// 在 chunk 里找与真实 token 完全一致（含切分后状态）的推测 token，返回其下标，找不到返回 SIZE_MAX
+static size_t chunk_match(LexChunk *chunk, const Token *token, const LexSnapshot *state) {
+    const TokenBuffer *tokens = &chunk->tokens;
+    while (chunk->search < chunk->usable && tokens->offsets[chunk->search] < token->offset) {
+        chunk->search++;
+    }
+    size_t i = chunk->search;
+    if (i < chunk->usable
+        && tokens->offsets[i] == token->offset
+        && tokens->lengths[i] == token->length
+        && tokens->types[i] == (uint16_t)token->type
+        && lex_snapshot_equal(&chunk->states[i], state)) {
+        return i;
+    }
+    return SIZE_MAX;
+}
+
+// 按段顺序拼接：照搬已对齐段的剩余 token，其余部分由 lexer 以真实状态串行切分
+static bool stitch_chunks(TokenBuffer *buffer, Lexer *lexer, LexChunk *chunks, size_t count) {
+    size_t c = 0;
+    size_t from = 0; // chunks[c] 中从 from 开始照搬（第 0 段的入口状态就是真实状态）
+    for (;;) {
+        LexChunk *chunk = &chunks[c];
+        if (from < chunk->usable) {
+            for (size_t i = from; i < chunk->usable; i++) {
+                Token token = token_buffer_get(&chunk->tokens, i);
+                if (!token_buffer_push(buffer, &token, (chunk->tokens.flags[i] & TOKBUF_NEWLINE_BEFORE) != 0)) {
+                    return false;
+                }
+            }
+            size_t last = chunk->usable - 1;
+            if (chunk->tokens.types[last] == TOK_EOF) {
+                return true;
+            }
+            lex_snapshot_apply(lexer, &chunk->states[last]);
+        }
+
+        // 串行切分，直到与某一段的推测结果对齐
+        from = SIZE_MAX;
+        while (from == SIZE_MAX) {
+            Token token = lexer_next_token(lexer);
+            if (!token_buffer_push(buffer, &token, lexer->has_newline)) {
+                return false;
+            }
+            if (token.type == TOK_EOF || token.type == TOK_ERROR) {
+                return true;
+            }
+            while (c + 1 < count && token.offset >= chunks[c + 1].start) {
+                c++;
+            }
+            LexSnapshot state = lex_snapshot(lexer);
+            size_t match = chunk_match(&chunks[c], &token, &state);
+            if (match != SIZE_MAX) {
+                from = match + 1;
+            }
+        }
+    }
+}
+
+// 按 chunk_size（0 表示按线程数均分）切段，段界放在换行之后；
+// 输入太小或只有一段时退回 token_buffer_fill
+bool token_buffer_fill_parallel(TokenBuffer *buffer, Lexer *lexer, int threads, size_t chunk_size) {
+    if (lexer->stream || threads <= 1) {
+        return token_buffer_fill(buffer, lexer);
+    }
+    const char *input = lexer->cursor;
+    size_t length = (size_t)(lexer->limit - lexer->input);
+    if (input != lexer->input || length >= UINT32_MAX) {
+        return token_buffer_fill(buffer, lexer);
+    }
+    if (chunk_size == 0) {
+        chunk_size = length / (size_t)threads + 1;
+    }
+
+    size_t capacity = length / chunk_size + 1;
+    LexChunk *chunks = (LexChunk *)calloc(capacity, sizeof(LexChunk));
+    if (!chunks) {
+        return token_buffer_fill(buffer, lexer);
+    }
+    size_t count = 0;
+    size_t start = 0;
+    while (start < length && count < capacity) {
+        size_t end = start + chunk_size;
+        if (end >= length || count + 1 == capacity) {
+            end = length;
+        } else {
+            const char *newline = memchr(input + end, '\n', length - end);
+            end = newline ? (size_t)(newline - input) + 1 : length;
+        }
+        chunks[count].start = start;
+        chunks[count].end = end;
+        chunks[count].guess = count == 0 ? lexer->prev_tok_state : guess_entry_state(input, start);
+        count++;
+        start = end;
+    }
+    if (count <= 1) {
+        free(chunks);
+        return token_buffer_fill(buffer, lexer);
+    }
+
+    size_t worker_count = (size_t)threads < count ? (size_t)threads : count;
+    pthread_t *tids = (pthread_t *)calloc(worker_count, sizeof(pthread_t));
+    LexWorker *workers = (LexWorker *)calloc(worker_count, sizeof(LexWorker));
+    bool *started = (bool *)calloc(worker_count, sizeof(bool));
+    if (!tids || !workers || !started) {
+        free(tids);
+        free(workers);
+        free(started);
+        free(chunks);
+        return token_buffer_fill(buffer, lexer);
+    }
+    for (size_t i = 0; i < worker_count; i++) {
+        workers[i].input = input;
+        workers[i].length = length;
+        workers[i].chunks = chunks;
+        workers[i].count = count;
+        workers[i].first = i;
+        workers[i].stride = worker_count;
+        // 第 0 个 worker 在当前线程执行；线程创建失败时同样就地执行
+        if (i > 0 && pthread_create(&tids[i], NULL, lex_worker_main, &workers[i]) == 0) {
+            started[i] = true;
+        }
+    }
+    for (size_t i = 0; i < worker_count; i++) {
+        if (!started[i]) {
+            lex_worker_main(&workers[i]);
+        }
+    }
+    for (size_t i = 0; i < worker_count; i++) {
+        if (started[i]) {
+            pthread_join(tids[i], NULL);
+        }
+    }
+
+    bool failed = false;
+    for (size_t i = 0; i < count; i++) {
+        failed |= chunks[i].failed;
+    }
+    memset(buffer, 0, sizeof(*buffer));
+    bool ok = !failed && stitch_chunks(buffer, lexer, chunks, count);
+
+    for (size_t i = 0; i < count; i++) {
+        token_buffer_free(&chunks[i].tokens);
+        free(chunks[i].states);
+    }
+    free(chunks);
+    free(tids);
+    free(workers);
+    free(started);
+
+    if (!ok) {
+        token_buffer_free(buffer);
+        lexer_dispose(lexer);
+        lexer_init_at(lexer, input, length, 0);
+        return token_buffer_fill(buffer, lexer);
+    }
+    return true;
+}
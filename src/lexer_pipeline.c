@@ -0,0 +1,371 @@
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // sched_yield
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "token.h"
+
+// 流水线切分：生产者线程对整块输入调用 lexer_next_token，顺带求出每个 '(' 的括号匹配结果
+// （是否为箭头函数参数头、是否紧跟 function），经单生产者/单消费者队列交给解析线程。
+// 队列是按块链接的 token 数组：生产者写满一块就挂上下一块，消费者走过一块就释放它；
+// 两端只通过 produced / consumed 计数与 '(' 的标志字节同步（GCC __atomic，获取/释放语义），没有锁
+
+#define PIPE_BLOCK_TOKENS 4096
+#define PIPE_MAX_AHEAD (64 * PIPE_BLOCK_TOKENS) // 生产者最多领先的 token 数（约 26 万个）
+#define PIPE_SPIN_LIMIT 64                       // 忙等若干次后改为让出 CPU
+#define PIPE_CACHE_LINE 64
+
+// flags 中 TOKBUF_NEWLINE_BEFORE 之外的位：'(' 的结果由生产者在得出后一次写入
+#define PIPE_PAREN_RESOLVED      0x02
+#define PIPE_ARROW_HEAD          0x04
+#define PIPE_FUNCTION_LITERAL    0x08
+
+typedef struct PipeBlock
+{
+    struct PipeBlock *next;
+    Token tokens[PIPE_BLOCK_TOKENS];
+    uint8_t flags[PIPE_BLOCK_TOKENS];
+} PipeBlock;
+
+// 尚未得出结果的 '('：消费者读到它的结果之前会一直等在这里，所以标志字节所在的块不会被释放
+typedef struct
+{
+    uint8_t *flags;
+    bool function_literal;
+    bool resolved;          // 已被箭头参数过滤提前判定为 false
+    ArrowParamFilter filter;
+} PipeParen;
+
+struct TokenPipe
+{
+    // 生产者写、消费者读
+    size_t produced;        // 已发布的 token 数
+    bool done;              // EOF/错误 token 已发布，生产者已退出
+    char pad_producer[PIPE_CACHE_LINE];
+    // 消费者写、生产者读
+    size_t consumed;        // 消费者已释放的块之前的 token 数（背压用）
+    bool waiting_paren;     // 消费者在等某个 '(' 的结果，此时生产者不受背压限制
+    bool stop;
+    char pad_consumer[PIPE_CACHE_LINE];
+
+    // 生产者私有
+    Lexer lexer;
+    PipeBlock *tail;
+    size_t tail_count;
+    size_t total;
+    PipeParen *open;
+    size_t open_count;
+    size_t open_capacity;
+
+    // 消费者私有
+    PipeBlock *head;
+    size_t head_index;
+    size_t read;
+    size_t available;
+    Token last;
+    uint8_t *last_flags;
+
+    pthread_t thread;
+};
+
+// ---- 箭头参数过滤 ----
+// 只看 param_list 的形状：绑定元素以标识符、'{'、'[' 或 '...' 开头，其后只能是 ','、'=' 或 ')'；
+// 初始值与嵌套解构模式的内容不检查。不可能构成参数列表的括号（调用参数 f(a.b, ...)、
+// IIFE 外层的 (function、((...)) 等）不必等到匹配的 ')' 就能判定不是箭头函数
+
+enum
+{
+    ARROW_PARAM_START,        // 期待一个绑定元素
+    ARROW_PARAM_AFTER,        // 绑定元素之后
+    ARROW_PARAM_PATTERN,      // 嵌套的 {} / [] 解构模式内
+    ARROW_PARAM_INITIALIZER,  // '=' 之后的初始值
+    ARROW_PARAM_IMPOSSIBLE
+};
+
+void arrow_params_init(ArrowParamFilter *filter) {
+    filter->state = ARROW_PARAM_START;
+    filter->depth = 0;
+}
+
+// 与 grammar_token 一致：按 IDENTIFIER 处理的关键字也可作参数名（模块专用关键字按脚本模式放宽）
+static bool binding_name_token(TokenType type) {
+    return type == TOK_IDENTIFIER || token_has_attr(type, TOKATTR_AS_IDENTIFIER)
+        || token_has_attr(type, TOKATTR_MODULE_ONLY);
+}
+
+bool arrow_params_step(ArrowParamFilter *filter, TokenType type) {
+    if (filter->depth > 0) {
+        if (type == TOK_LBRACE || type == TOK_LBRACKET) {
+            filter->depth++;
+        } else if ((type == TOK_RBRACE || type == TOK_RBRACKET) && --filter->depth == 0
+                   && filter->state == ARROW_PARAM_PATTERN) {
+            filter->state = ARROW_PARAM_AFTER;
+        }
+        return true;
+    }
+    switch (filter->state) {
+        case ARROW_PARAM_START:
+            if (binding_name_token(type)) {
+                filter->state = ARROW_PARAM_AFTER;
+            } else if (type == TOK_LBRACE || type == TOK_LBRACKET) {
+                filter->state = ARROW_PARAM_PATTERN;
+                filter->depth = 1;
+            } else if (type != TOK_ELLIPSIS) {
+                filter->state = ARROW_PARAM_IMPOSSIBLE;
+            }
+            break;
+        case ARROW_PARAM_AFTER:
+            if (type == TOK_COMMA) {
+                filter->state = ARROW_PARAM_START;
+            } else if (type == TOK_ASSIGN) {
+                filter->state = ARROW_PARAM_INITIALIZER;
+            } else {
+                filter->state = ARROW_PARAM_IMPOSSIBLE;
+            }
+            break;
+        case ARROW_PARAM_INITIALIZER:
+            if (type == TOK_COMMA) {
+                filter->state = ARROW_PARAM_START;
+            } else if (type == TOK_LBRACE || type == TOK_LBRACKET) {
+                filter->depth = 1;
+            }
+            break;
+        default:
+            break;
+    }
+    return filter->state != ARROW_PARAM_IMPOSSIBLE;
+}
+
+bool arrow_params_possible(const ArrowParamFilter *filter) {
+    return filter->state != ARROW_PARAM_IMPOSSIBLE;
+}
+
+// ---- 队列 ----
+
+static void pipe_backoff(unsigned *spins) {
+    if (*spins < PIPE_SPIN_LIMIT) {
+        (*spins)++;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_ia32_pause();
+#endif
+    } else {
+        sched_yield();
+    }
+}
+
+static PipeBlock *pipe_block_new(void) {
+    PipeBlock *block = (PipeBlock *)malloc(sizeof(PipeBlock));
+    if (!block) {
+        fprintf(stderr, "Out of memory while pipelining tokens\n");
+        exit(EXIT_FAILURE);
+    }
+    block->next = NULL;
+    return block;
+}
+
+// 追加并发布一个 token，返回它的标志字节；消费者要求停止时返回 NULL
+static uint8_t *pipe_append(TokenPipe *pipe, const Token *token, uint8_t flags) {
+    if (pipe->tail_count == PIPE_BLOCK_TOKENS) {
+        if (__atomic_load_n(&pipe->stop, __ATOMIC_ACQUIRE)) {
+            return NULL;
+        }
+        // 背压：领先太多时等消费者追上；消费者正等某个 '(' 的结果时必须继续切分，否则互相等待
+        unsigned spins = 0;
+        while (pipe->total - __atomic_load_n(&pipe->consumed, __ATOMIC_ACQUIRE) >= PIPE_MAX_AHEAD
+               && !__atomic_load_n(&pipe->waiting_paren, __ATOMIC_ACQUIRE)) {
+            if (__atomic_load_n(&pipe->stop, __ATOMIC_ACQUIRE)) {
+                return NULL;
+            }
+            pipe_backoff(&spins);
+        }
+        PipeBlock *block = pipe_block_new();
+        pipe->tail->next = block; // 随下面 produced 的发布对消费者可见
+        pipe->tail = block;
+        pipe->tail_count = 0;
+    }
+    size_t index = pipe->tail_count++;
+    pipe->tail->tokens[index] = *token;
+    pipe->tail->flags[index] = flags;
+    __atomic_store_n(&pipe->produced, ++pipe->total, __ATOMIC_RELEASE);
+    return &pipe->tail->flags[index];
+}
+
+static void paren_publish(PipeParen *paren, bool arrow_head) {
+    uint8_t flags = (uint8_t)(*paren->flags | PIPE_PAREN_RESOLVED);
+    if (arrow_head) {
+        flags |= PIPE_ARROW_HEAD;
+    }
+    if (paren->function_literal) {
+        flags |= PIPE_FUNCTION_LITERAL;
+    }
+    __atomic_store_n(paren->flags, flags, __ATOMIC_RELEASE);
+    paren->resolved = true;
+}
+
+static void paren_push(TokenPipe *pipe, uint8_t *flags) {
+    if (pipe->open_count == pipe->open_capacity) {
+        size_t capacity = pipe->open_capacity ? pipe->open_capacity * 2 : 64;
+        PipeParen *grown = (PipeParen *)realloc(pipe->open, capacity * sizeof(PipeParen));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while matching parentheses\n");
+            exit(EXIT_FAILURE);
+        }
+        pipe->open = grown;
+        pipe->open_capacity = capacity;
+    }
+    PipeParen *paren = &pipe->open[pipe->open_count++];
+    paren->flags = flags;
+    paren->function_literal = false;
+    paren->resolved = false;
+    arrow_params_init(&paren->filter);
+}
+
+// 与 parser_lex_adapter.c 的 paren_scan 结果相同：'(' 之后的 token 决定 function_literal，
+// 匹配的 ')' 之后的 token 决定 arrow_head；到 EOF/错误仍未闭合的括号两项都为 false
+static void *pipe_producer(void *arg) {
+    TokenPipe *pipe = (TokenPipe *)arg;
+    bool opened = false;
+    PipeParen closed;
+    bool has_closed = false;
+
+    for (;;) {
+        Token tk = lexer_next_token(&pipe->lexer);
+        uint8_t flags = pipe->lexer.has_newline ? TOKBUF_NEWLINE_BEFORE : 0;
+        bool end = (tk.type == TOK_EOF || tk.type == TOK_ERROR);
+
+        if (opened) {
+            pipe->open[pipe->open_count - 1].function_literal = (tk.type == TOK_FUNCTION);
+            opened = false;
+        }
+        if (has_closed) {
+            paren_publish(&closed, arrow_params_possible(&closed.filter) && tk.type == TOK_ARROW);
+            has_closed = false;
+        }
+        if (!end && tk.type != TOK_RPAREN && pipe->open_count > 0) {
+            PipeParen *top = &pipe->open[pipe->open_count - 1];
+            if (!top->resolved && !arrow_params_step(&top->filter, tk.type)) {
+                paren_publish(top, false);
+            }
+        }
+
+        uint8_t *slot = pipe_append(pipe, &tk, flags);
+        if (!slot || end) {
+            break;
+        }
+        if (tk.type == TOK_LPAREN) {
+            paren_push(pipe, slot);
+            opened = true;
+        } else if (tk.type == TOK_RPAREN && pipe->open_count > 0) {
+            closed = pipe->open[--pipe->open_count];
+            has_closed = !closed.resolved;
+        }
+    }
+
+    // 停止时消费者已不再读取，但已释放的块里不会有未决的 '('（见 PipeParen），照常写入无妨
+    if (has_closed) {
+        paren_publish(&closed, false);
+    }
+    for (size_t i = 0; i < pipe->open_count; i++) {
+        if (!pipe->open[i].resolved) {
+            paren_publish(&pipe->open[i], false);
+        }
+    }
+    __atomic_store_n(&pipe->done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+TokenPipe *token_pipe_start(const Lexer *lexer) {
+    if (lexer->stream) {
+        return NULL; // 流式输入的窗口会被滑走，生产者无法独立读取
+    }
+    TokenPipe *pipe = (TokenPipe *)calloc(1, sizeof(TokenPipe));
+    if (!pipe) {
+        return NULL;
+    }
+    pipe->head = pipe->tail = (PipeBlock *)malloc(sizeof(PipeBlock));
+    if (!pipe->head) {
+        free(pipe);
+        return NULL;
+    }
+    pipe->head->next = NULL;
+    lexer_init_at(&pipe->lexer, lexer->input, (size_t)(lexer->limit - lexer->input),
+                  (size_t)(lexer->cursor - lexer->input));
+    pipe->lexer.quiet = lexer->quiet;
+    if (pthread_create(&pipe->thread, NULL, pipe_producer, pipe) != 0) {
+        lexer_dispose(&pipe->lexer);
+        free(pipe->head);
+        free(pipe);
+        return NULL;
+    }
+    return pipe;
+}
+
+Token token_pipe_next(TokenPipe *pipe, bool *newline_before) {
+    if (pipe->read == pipe->available) {
+        unsigned spins = 0;
+        for (;;) {
+            pipe->available = __atomic_load_n(&pipe->produced, __ATOMIC_ACQUIRE);
+            if (pipe->read < pipe->available) {
+                break;
+            }
+            if (__atomic_load_n(&pipe->done, __ATOMIC_ACQUIRE)) {
+                pipe->available = __atomic_load_n(&pipe->produced, __ATOMIC_ACQUIRE);
+                if (pipe->read < pipe->available) {
+                    break;
+                }
+                // 读到末尾后停在最后一个 token（EOF），与拉取模式反复返回 EOF 一致
+                *newline_before = (__atomic_load_n(pipe->last_flags, __ATOMIC_RELAXED) & TOKBUF_NEWLINE_BEFORE) != 0;
+                return pipe->last;
+            }
+            pipe_backoff(&spins);
+        }
+    }
+    if (pipe->head_index == PIPE_BLOCK_TOKENS) {
+        PipeBlock *next = pipe->head->next;
+        free(pipe->head);
+        pipe->head = next;
+        pipe->head_index = 0;
+        __atomic_store_n(&pipe->consumed, pipe->read, __ATOMIC_RELEASE);
+    }
+    size_t index = pipe->head_index++;
+    pipe->read++;
+    pipe->last = pipe->head->tokens[index];
+    pipe->last_flags = &pipe->head->flags[index];
+    // '(' 的标志字节可能正被生产者写入结果，换行位不会变，但读取也须是原子的
+    *newline_before = (__atomic_load_n(pipe->last_flags, __ATOMIC_RELAXED) & TOKBUF_NEWLINE_BEFORE) != 0;
+    return pipe->last;
+}
+
+void token_pipe_paren(TokenPipe *pipe, bool *arrow_head, bool *function_literal) {
+    uint8_t flags = __atomic_load_n(pipe->last_flags, __ATOMIC_ACQUIRE);
+    if (!(flags & PIPE_PAREN_RESOLVED)) {
+        __atomic_store_n(&pipe->waiting_paren, true, __ATOMIC_RELEASE);
+        unsigned spins = 0;
+        while (!((flags = __atomic_load_n(pipe->last_flags, __ATOMIC_ACQUIRE)) & PIPE_PAREN_RESOLVED)) {
+            pipe_backoff(&spins);
+        }
+        __atomic_store_n(&pipe->waiting_paren, false, __ATOMIC_RELEASE);
+    }
+    *arrow_head = (flags & PIPE_ARROW_HEAD) != 0;
+    *function_literal = (flags & PIPE_FUNCTION_LITERAL) != 0;
+}
+
+void token_pipe_stop(TokenPipe *pipe) {
+    if (!pipe) {
+        return;
+    }
+    __atomic_store_n(&pipe->stop, true, __ATOMIC_RELEASE);
+    pthread_join(pipe->thread, NULL);
+    PipeBlock *block = pipe->head;
+    while (block) {
+        PipeBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(pipe->open);
+    lexer_dispose(&pipe->lexer);
+    free(pipe);
+}
@@ -1,95 +1,249 @@
+#define _POSIX_C_SOURCE 200809L // clock_gettime
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "token.h"
+#include "scan.h"
+#include "source_file.h"
 
-// 读取文件内容
-char *read_file(const char *filename) {
-    FILE *file = fopen(filename, "rb");
-    if (!file) {
-        fprintf(stderr, "Error: Cannot open file '%s'\n", filename);
-        return NULL;
+// 是否携带文本（关键字/字面量/标识符/错误），运算符只输出类型
+static int token_has_text(const Token *token) {
+    if (token->type == TOK_TEMPLATE_NO_SUB || token->type == TOK_TEMPLATE_HEAD ||
+        token->type == TOK_TEMPLATE_MIDDLE || token->type == TOK_TEMPLATE_TAIL) {
+        return 1; // 模板片段可以是空串
     }
-    
-    // 获取文件大小
-    fseek(file, 0, SEEK_END);
-    long size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    
-    // 分配内存并读取
-    char *content = (char *)malloc(size + 1);
-    if (!content) {
-        fprintf(stderr, "Error: Memory allocation failed\n");
-        fclose(file);
-        return NULL;
+    return token_has_attr(token->type, TOKATTR_TEXT) && token->length > 0;
+}
+
+static double now_seconds(void) {
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+// 单轮词法扫描；eager=1 时模拟旧实现（每个带文本的 token 都复制一份字符串），
+// eager=0 时只物化语法层真正需要的 IDENTIFIER/STRING/NUMBER
+static int bench_pass(const char *input, int eager, size_t *tokens, size_t *allocs) {
+    Lexer lexer;
+    lexer_init(&lexer, input);
+    Token token;
+    do {
+        token = lexer_next_token(&lexer);
+        (*tokens)++;
+        int materialize = eager ? token_has_text(&token)
+                                : (token.type == TOK_IDENTIFIER || token.type == TOK_STRING ||
+                                   token.type == TOK_NUMBER);
+        if (materialize) {
+            free(token_dup_value(&lexer, &token));
+            (*allocs)++;
+        }
+    } while (token.type != TOK_EOF && token.type != TOK_ERROR);
+    return token.type == TOK_ERROR ? 1 : 0;
+}
+
+// 并行切分的段大小，可通过环境变量 JS_LEXER_CHUNK 调小以让小文件也跨越多个段；0 表示按线程数均分
+static size_t parallel_chunk_size(void) {
+    const char *env = getenv("JS_LEXER_CHUNK");
+    return env ? (size_t)strtoul(env, NULL, 10) : 0;
+}
+
+// 单轮并行预分词（--threads 时与串行视图对比）
+static int bench_parallel_pass(const char *input, int threads, size_t *tokens) {
+    Lexer lexer;
+    TokenBuffer buffer;
+    lexer_init(&lexer, input);
+    if (!token_buffer_fill_parallel(&buffer, &lexer, threads, parallel_chunk_size())) {
+        lexer_dispose(&lexer);
+        return 1;
     }
-    
-    size_t read_size = fread(content, 1, size, file);
-    content[read_size] = '\0';
-    
-    fclose(file);
-    return content;
+    *tokens += buffer.count;
+    int rc = (TokenType)buffer.types[buffer.count - 1] == TOK_ERROR ? 1 : 0;
+    token_buffer_free(&buffer);
+    lexer_dispose(&lexer);
+    return rc;
+}
+
+// --bench：对比复制 token 与零拷贝视图的吞吐量和每 KB 分配次数；--threads N 时再测并行预分词
+static int run_bench(const char *filename, const char *input, int iterations, int threads) {
+    size_t input_len = strlen(input);
+    double kb = (double)input_len / 1024.0;
+    const char *labels[2] = {"copy", "view"};
+
+    scan_init();
+    printf("=== Lexer Benchmark '%s' (%zu bytes, %d iterations, scan=%s) ===\n",
+           filename, input_len, iterations, scan_kernel_name());
+    for (int mode = 0; mode < 2; mode++) {
+        size_t tokens = 0;
+        size_t allocs = 0;
+        double start = now_seconds();
+        for (int i = 0; i < iterations; i++) {
+            if (bench_pass(input, mode == 0, &tokens, &allocs)) {
+                fprintf(stderr, "Lexical error during benchmark\n");
+                return 1;
+            }
+        }
+        double elapsed = now_seconds() - start;
+        double total_mb = (double)input_len * iterations / (1024.0 * 1024.0);
+        printf("%-5s tokens=%zu time=%.3fs throughput=%.2f MB/s allocs/KB=%.2f\n",
+               labels[mode], tokens / (size_t)iterations, elapsed,
+               elapsed > 0 ? total_mb / elapsed : 0.0,
+               kb > 0 ? (double)allocs / iterations / kb : 0.0);
+    }
+    if (threads > 1) {
+        size_t tokens = 0;
+        struct timespec start, end;
+        // clock() 统计的是所有线程的 CPU 时间，这里要看墙钟时间
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int i = 0; i < iterations; i++) {
+            if (bench_parallel_pass(input, threads, &tokens)) {
+                fprintf(stderr, "Lexical error during benchmark\n");
+                return 1;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double elapsed = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+        double total_mb = (double)input_len * iterations / (1024.0 * 1024.0);
+        printf("par%-2d tokens=%zu time=%.3fs throughput=%.2f MB/s (wall)\n",
+               threads, tokens / (size_t)iterations, elapsed,
+               elapsed > 0 ? total_mb / elapsed : 0.0);
+    }
+    return 0;
+}
+
+// 流式窗口大小，可通过环境变量 JS_LEXER_WINDOW 调小以测试跨窗口 token
+static size_t stream_window_size(void) {
+    const char *env = getenv("JS_LEXER_WINDOW");
+    return env ? (size_t)strtoul(env, NULL, 10) : 0;
 }
 
 int main(int argc, char *argv[]) {
     // 检查命令行参数
     if (argc < 2) {
         printf("JavaScript Lexer - Test Program\n");
-        printf("Usage: %s <javascript_file>\n", argv[0]);
+        printf("Usage: %s [--stream] <javascript_file|->\n", argv[0]);
         printf("\nExample:\n");
         printf("  %s test.js\n", argv[0]);
+        printf("  %s --stream bundle.js\n", argv[0]);
+        printf("  %s --bench test.js [iterations]\n", argv[0]);
+        printf("  %s --threads 4 bundle.js\n", argv[0]);
         return 1;
     }
     
-    const char *filename = argv[1];
-    
-    // 读取输入文件
-    char *input = read_file(filename);
-    if (!input) {
+    int bench = 0;
+    int stream_mode = 0;
+    int iterations = 100;
+    int threads = 0;
+    const char *filename = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bench") == 0) {
+            bench = 1;
+        } else if (strcmp(argv[i], "--stream") == 0) {
+            stream_mode = 1;
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (!filename) {
+            filename = argv[i];
+        } else if (bench) {
+            iterations = atoi(argv[i]);
+            if (iterations <= 0) {
+                iterations = 1;
+            }
+        }
+    }
+    if (!filename) {
+        fprintf(stderr, "Usage: %s [--stream|--bench] [--threads N] <javascript_file> [iterations]\n", argv[0]);
         return 1;
     }
-    
-    printf("=== Lexical Analysis of '%s' ===\n\n", filename);
-    
-    // 初始化词法分析器
+    // 标准输入只能流式读取
+    if (strcmp(filename, "-") == 0) {
+        stream_mode = 1;
+    }
+
+    SourceFile source = {0};
+    const char *input = NULL;
+    FILE *stream_file = NULL;
+    LexerStream stream;
     Lexer lexer;
-    lexer_init(&lexer, input);
+
+    if (stream_mode && !bench) {
+        stream_file = strcmp(filename, "-") == 0 ? stdin : fopen(filename, "rb");
+        if (!stream_file) {
+            fprintf(stderr, "Error: Cannot open file '%s'\n", filename);
+            return 1;
+        }
+        if (!lexer_init_stream(&lexer, &stream, stream_file, stream_window_size(), false)) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            return 1;
+        }
+    } else {
+        // 读取输入文件
+        if (!source_file_load(&source, filename, false)) {
+            return 1;
+        }
+        input = source.data;
+
+        if (bench) {
+            int rc = run_bench(filename, input, iterations, threads);
+            source_file_release(&source);
+            return rc;
+        }
+
+        // 初始化词法分析器
+        lexer_init(&lexer, input);
+    }
     
+    printf("=== Lexical Analysis of '%s' ===\n\n", filename);
+
+    // --threads：先并行切分到缓冲区，再按相同格式输出（输出应与串行逐字节相同）
+    TokenBuffer parallel;
+    int use_parallel = 0;
+    if (threads > 1 && !stream_file) {
+        use_parallel = token_buffer_fill_parallel(&parallel, &lexer, threads, parallel_chunk_size());
+    }
+
     // 词法分析
     int token_count = 0;
     Token token;
     
     do {
-        token = lexer_next_token(&lexer);
+        token = use_parallel ? token_buffer_get(&parallel, (size_t)token_count) : lexer_next_token(&lexer);
         token_count++;
         
-        // 输出 token 信息
+        // 输出 token 信息（行列号按偏移从行索引计算）
+        int line, column;
+        lexer_position(&lexer, token.offset, &line, &column);
         printf("[%3d] Line %3d, Col %3d: %-15s", 
-               token_count, token.line, token.column, 
+               token_count, line, column, 
                token_type_to_string(token.type));
         
-        if (token.value) {
-            printf(" = '%s'", token.value);
+        if (token_has_text(&token)) {
+            printf(" = '%.*s'", (int)token.length, token_text(&lexer, &token));
         }
         printf("\n");
         
         // 如果是错误 token，显示详细信息
         if (token.type == TOK_ERROR) {
-            fprintf(stderr, "\nLexical Error at line %d, column %d: Unexpected character '%s'\n", 
-                    token.line, token.column, token.value ? token.value : "");
-            token_free(&token);
+            fprintf(stderr, "\nLexical Error at line %d, column %d: Unexpected character '%.*s'\n", 
+                    line, column, (int)token.length, token_text(&lexer, &token));
             break;
         }
         
-        token_free(&token);
-        
     } while (token.type != TOK_EOF && token.type != TOK_ERROR);
     
     printf("\n=== Analysis Complete ===\n");
     printf("Total tokens: %d\n", token_count);
     
     // 清理
-    free(input);
+    if (use_parallel) {
+        token_buffer_free(&parallel);
+    }
+    lexer_dispose(&lexer);
+    source_file_release(&source);
+    if (stream_file) {
+        lexer_stream_free(&stream);
+        if (stream_file != stdin) {
+            fclose(stream_file);
+        }
+    }
     
     return (token.type == TOK_ERROR) ? 1 : 0;
 }
@@ -0,0 +1,182 @@
+#include "numeric.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 十进制快速路径最多累计的有效数字（10^19 < 2^64）
+#define NUMERIC_MAX_DIGITS 19
+#define NUMERIC_EXACT_INT (UINT64_C(1) << 53)
+// 慢速路径栈上缓冲区，更长的字面量才 malloc
+#define NUMERIC_STACK_BUFFER 128
+
+// 10^0 .. 10^22 都能被 double 精确表示，乘除一次只舍入一次（Clinger 快速路径）
+static const double g_pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static unsigned hex_digit_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return (unsigned)(c - '0');
+    }
+    if (c >= 'a' && c <= 'f') {
+        return (unsigned)(c - 'a' + 10);
+    }
+    return (unsigned)(c - 'A' + 10);
+}
+
+// 2 的幂进制（shift 为每位的比特数）：尾数装满后只记录舍去的位数和是否有非零位，
+// 最后把 sticky 并入最低位再整体转换，保证只舍入一次
+static double parse_power_of_two(const char *p, const char *end, unsigned shift) {
+    uint64_t mantissa = 0;
+    int dropped_bits = 0;
+    unsigned sticky = 0;
+    for (; p < end; p++) {
+        if (*p == '_') {
+            continue;
+        }
+        unsigned digit = hex_digit_value(*p);
+        if (dropped_bits == 0 && (mantissa >> (64 - shift)) == 0) {
+            mantissa = (mantissa << shift) | digit;
+        } else {
+            dropped_bits += (int)shift;
+            sticky |= (digit != 0);
+        }
+    }
+    return ldexp((double)(mantissa | sticky), dropped_bits);
+}
+
+// 去掉分隔符后交给 strtod（精确但慢，只在快速路径不适用时使用）
+static double parse_decimal_slow(const char *text, size_t length) {
+    char stack_buffer[NUMERIC_STACK_BUFFER];
+    char *buffer = stack_buffer;
+    if (length >= sizeof(stack_buffer)) {
+        buffer = (char *)malloc(length + 1);
+        if (!buffer) {
+            return 0.0;
+        }
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] != '_') {
+            buffer[n++] = text[i];
+        }
+    }
+    buffer[n] = '\0';
+    double value = strtod(buffer, NULL);
+    if (buffer != stack_buffer) {
+        free(buffer);
+    }
+    return value;
+}
+
+static double parse_decimal(const char *text, size_t length) {
+    const char *p = text;
+    const char *end = text + length;
+    uint64_t mantissa = 0;
+    int digits = 0;   // 已计入尾数的有效数字（不含前导零）
+    int exp10 = 0;
+    bool truncated = false;
+
+    for (; p < end && ((*p >= '0' && *p <= '9') || *p == '_'); p++) {
+        if (*p == '_' || (digits == 0 && *p == '0')) {
+            continue;
+        }
+        if (digits < NUMERIC_MAX_DIGITS) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            digits++;
+        } else {
+            exp10++;
+            truncated |= (*p != '0');
+        }
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && ((*p >= '0' && *p <= '9') || *p == '_'); p++) {
+            if (*p == '_') {
+                continue;
+            }
+            if (digits == 0 && *p == '0') {
+                exp10--;
+            } else if (digits < NUMERIC_MAX_DIGITS) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                digits++;
+                exp10--;
+            } else {
+                truncated |= (*p != '0');
+            }
+        }
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        bool negative = false;
+        int exponent = 0;
+        p++;
+        if (p < end && (*p == '+' || *p == '-')) {
+            negative = (*p == '-');
+            p++;
+        }
+        for (; p < end; p++) {
+            if (*p != '_' && exponent < 100000) {
+                exponent = exponent * 10 + (*p - '0');
+            }
+        }
+        exp10 += negative ? -exponent : exponent;
+    }
+
+    if (mantissa == 0) {
+        return 0.0;
+    }
+    if (!truncated && mantissa <= NUMERIC_EXACT_INT) {
+        // 小整数：最常见的情况，直接转换
+        if (exp10 == 0) {
+            return (double)mantissa;
+        }
+        if (exp10 > 0 && exp10 <= 22) {
+            return (double)mantissa * g_pow10[exp10];
+        }
+        if (exp10 < 0 && exp10 >= -22) {
+            return (double)mantissa / g_pow10[-exp10];
+        }
+    }
+    return parse_decimal_slow(text, length);
+}
+
+bool numeric_literal_is_bigint(const char *text, size_t length) {
+    return length > 0 && text[length - 1] == 'n';
+}
+
+double numeric_literal_value(const char *text, size_t length) {
+    if (!text || length == 0) {
+        return 0.0;
+    }
+    if (numeric_literal_is_bigint(text, length)) {
+        length--;
+    }
+    if (length > 2 && text[0] == '0') {
+        switch (text[1]) {
+            case 'x':
+            case 'X':
+                return parse_power_of_two(text + 2, text + length, 4);
+            case 'o':
+            case 'O':
+                return parse_power_of_two(text + 2, text + length, 3);
+            case 'b':
+            case 'B':
+                return parse_power_of_two(text + 2, text + length, 1);
+            default:
+                break;
+        }
+    }
+    // 旧式八进制：0 开头且全部为 0-7（含 8/9 的如 089 按十进制）
+    if (length > 1 && text[0] == '0' && text[1] >= '0' && text[1] <= '9') {
+        size_t i = 1;
+        while (i < length && text[i] >= '0' && text[i] <= '7') {
+            i++;
+        }
+        if (i == length) {
+            return parse_power_of_two(text + 1, text + length, 3);
+        }
+    }
+    return parse_decimal(text, length);
+}
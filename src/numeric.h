@@ -0,0 +1,14 @@
+#ifndef NUMERIC_H
+#define NUMERIC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// 数字字面量求值：text 为词法规则已校验过的 NUMBER token 文本（无需 NUL 结尾），
+// 支持十进制小数/指数、0x/0o/0b、旧式八进制、数字分隔符 `_` 与 BigInt 后缀 `n`
+double numeric_literal_value(const char *text, size_t length);
+
+// 以 `n` 结尾的 BigInt 字面量（numeric_literal_value 对其返回最接近的 double）
+bool numeric_literal_is_bigint(const char *text, size_t length);
+
+#endif // NUMERIC_H
@@ -0,0 +1,109 @@
+#ifndef PARSER_CONTEXT_H
+#define PARSER_CONTEXT_H
+
+// 解析上下文（库内部使用）：一次解析的全部可变状态都挂在 JSParser 上，
+// 不同的 JSParser 可以在不同线程里同时解析，互不影响
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "ast.h"
+#include "atom.h"
+#include "diagnostics.h"
+#include "token.h"
+
+struct LexAdapter;
+struct PushSession;
+struct FastPath;
+struct GLRStats;
+
+struct JSParser
+{
+    AtomTable *atoms;           // 本次解析的名字驻留表，解析结束后随 AST 交给调用方
+    ASTNode *ast_root;
+    int error_count;
+    bool module_mode;
+    bool print_errors;          // 语法/词法错误同时输出到 stderr（命令行工具使用）
+    Diagnostics diag;
+    struct LexAdapter *lex;
+    struct PushSession *push;   // js_parser_begin 到 js_parser_finish 之间的推送式解析
+    bool glr_only;              // 关闭确定性快速路径，整个输入直接交给 GLR
+    bool validate_only;         // 只验证语法：用 --validate 生成的解析器，不构建 AST
+    // 分段解析（parser_fast_path.c）：两个解析器每次只解析一条顶层语句
+    bool statement_mode;
+    bool statement_lookahead;   // 本段结束时解析器已读入下一段的第一个 token
+    bool statement_failed;      // 快速路径遇到语法错误
+    ASTList *statement_items;   // 本段归约出的顶层语句
+    size_t fast_statements;     // 由快速路径完成的顶层语句数
+    size_t glr_statements;      // 回退到 GLR 的分段数
+    struct FastPath *fast;
+    struct FastPath *validate_fast; // 只验证语法时的快速路径（parser_fast_validate.c）
+    struct GLRStats *glr_stats; // --glr-stats / --glr-trace，NULL 表示不统计
+    size_t input_length;        // 整块输入的字节数，流式输入为 0（长度未知）
+    size_t glr_initial_depth;   // 下一次 yyparse 的 GLR 栈初始容量
+};
+
+#ifndef JS_PARSER_DEFINED
+#define JS_PARSER_DEFINED
+typedef struct JSParser JSParser;
+#endif
+
+// 适配层（parser_lex_adapter.c）：设置输入并为 yylex 提供 token
+bool parser_set_input(JSParser *ctx, const char *input, size_t length);
+bool parser_set_input_stream(JSParser *ctx, FILE *file, size_t window_size);
+bool parser_set_input_reader(JSParser *ctx, LexerReadFn read, void *source, size_t window_size);
+bool parser_pretokenize(JSParser *ctx, int threads, size_t chunk_size);
+bool parser_lex_pipeline(JSParser *ctx);
+void parser_release_input(JSParser *ctx);
+bool parser_had_lex_error(const JSParser *ctx);
+void parser_adapter_free(JSParser *ctx);
+int parser_next_token(void *lvalp, JSParser *ctx);  // lvalp 指向 YYSTYPE
+
+// GLR 解析器的 LR 表（parser.c）
+int parser_lr_state_count(void);
+bool parser_lr_conflict(int state, int symbol);
+// 规则左部的名字与行号（供 glr_stats.c 使用；行号只在 YYDEBUG 构建中有，否则为 0）
+const char *parser_rule_lhs(int rule);
+int parser_rule_line(int rule);
+
+// 只验证语法的两个解析器与下面的接口相同，编译时（-DJS_PARSER_VALIDATE）换成另一组名字，
+// parser_fast_path.c 也因此编译两遍
+#ifdef JS_PARSER_VALIDATE
+#define fast_parser_compatible validate_fast_parser_compatible
+#define fast_parser_new validate_fast_parser_new
+#define fast_parser_free validate_fast_parser_free
+#define fast_parser_push validate_fast_parser_push
+#define fast_parser_lookahead_ok validate_fast_parser_lookahead_ok
+#define fast_parser_reset validate_fast_parser_reset
+#define parser_parse parser_validate
+#define parser_fast_path_free parser_validate_free
+#endif
+
+// 确定性推送式解析器（parser_fast.c，由同一份文法以 LALR 模式生成）
+#ifdef JS_PARSER_VALIDATE
+typedef struct jsfastvalidate_pstate FastParser;
+#else
+typedef struct jsfast_pstate FastParser;
+#endif
+
+typedef enum
+{
+    FAST_PUSH_MORE,
+    FAST_PUSH_ACCEPTED,
+    FAST_PUSH_FAILED
+} FastPushStatus;
+
+bool fast_parser_compatible(size_t value_size);
+FastParser *fast_parser_new(void);
+void fast_parser_free(FastParser *parser);
+FastPushStatus fast_parser_push(FastParser *parser, int token, const void *value, JSParser *ctx);
+bool fast_parser_lookahead_ok(const FastParser *parser, int token);
+void fast_parser_reset(FastParser *parser, JSParser *ctx);
+
+// 驱动（parser_fast_path.c）：先走快速路径，逐条语句按需回退到 GLR；返回值同 yyparse
+int parser_parse(JSParser *ctx);
+void parser_fast_path_free(JSParser *ctx);
+// 同上，用只验证语法的两个解析器（parser_validate.c / parser_fast_validate.c），不产生 ast_root
+int parser_validate(JSParser *ctx);
+void parser_validate_free(JSParser *ctx);
+
+#endif // PARSER_CONTEXT_H
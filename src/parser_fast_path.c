@@ -0,0 +1,300 @@
+// 确定性快速路径：按顶层语句先用 LALR 推送式解析器（parser_fast.c）解析，
+// 只有某条语句走到 GLR 表中的冲突格或出错时，才把这条语句的 token 重放给 GLR 解析器。
+// 快速路径每读入一个 token 之前先模拟它引起的归约序列，途经状态在 GLR 表里都没有冲突，
+// 说明 GLR 在这里也只有一个栈、执行同样的动作序列，因此两条路径得到的 AST 完全相同。
+// 快速路径不报告错误：出错的语句由 GLR 重新解析并给出原来的诊断
+// 本文件编译两遍：-DJS_PARSER_VALIDATE 时驱动只验证语法的两个解析器（入口 parser_validate），
+// 两者的语义值联合体与 token 编号相同，沿用 parser.h
+
+#ifdef JS_PARSER_VALIDATE
+#define yyparse jsvalidate_parse
+#define yylex jsvalidate_lex
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include "parser_context.h"
+#include "parser.h"
+
+typedef struct
+{
+    int token;
+    YYSTYPE value;
+} LoggedToken;
+
+// 本段已从词法适配层取出的 token；快速路径放弃时按原样重放给 GLR
+typedef struct FastPath
+{
+    FastParser *parser;
+    LoggedToken *log;
+    size_t count;
+    size_t capacity;
+    size_t next;        // GLR 重放时下一个要交出的 token
+    bool replaying;
+} FastPath;
+
+#ifdef JS_PARSER_VALIDATE
+#define FAST_PATH_SLOT(ctx) ((ctx)->validate_fast)
+#else
+#define FAST_PATH_SLOT(ctx) ((ctx)->fast)
+#endif
+
+// 这些 token 的语义值是自有字符串，解析动作会接管（或释放）它
+static bool token_owns_string(int token) {
+    switch (token) {
+        case STRING:
+        case REGEX:
+        case TEMPLATE_NO_SUB:
+        case TEMPLATE_HEAD:
+        case TEMPLATE_MIDDLE:
+        case TEMPLATE_TAIL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static char *copy_string(const char *s) {
+    if (!s) {
+        return NULL;
+    }
+    size_t len = strlen(s) + 1;
+    char *copy = (char *)malloc(len);
+    if (copy) {
+        memcpy(copy, s, len);
+    }
+    return copy;
+}
+
+static bool log_fetch(JSParser *ctx, FastPath *fp) {
+    if (fp->count == fp->capacity) {
+        size_t capacity = fp->capacity ? fp->capacity * 2 : 256;
+        LoggedToken *log = (LoggedToken *)realloc(fp->log, capacity * sizeof(LoggedToken));
+        if (!log) {
+            return false;
+        }
+        fp->log = log;
+        fp->capacity = capacity;
+    }
+    LoggedToken *entry = &fp->log[fp->count];
+    entry->token = parser_next_token(&entry->value, ctx);
+    fp->count++;
+    return true;
+}
+
+// 去掉本段已消费的前 consumed 个 token；release 为真时释放它们的字符串（快速路径只用了副本）
+static void log_drop(FastPath *fp, size_t consumed, bool release) {
+    if (release) {
+        for (size_t i = 0; i < consumed; i++) {
+            if (token_owns_string(fp->log[i].token)) {
+                free(fp->log[i].value.str);
+            }
+        }
+    }
+    memmove(fp->log, fp->log + consumed, (fp->count - consumed) * sizeof(LoggedToken));
+    fp->count -= consumed;
+}
+
+static ASTList *append_items(ASTList **head, ASTList *tail, ASTList *items) {
+    if (!items) {
+        return tail;
+    }
+    if (tail) {
+        tail->next = items;
+    } else {
+        *head = items;
+    }
+    while (items->next) {
+        items = items->next;
+    }
+    return items;
+}
+
+// GLR 解析器的词法入口：重放期间先交出日志里的 token，用完后继续向适配层取并记入日志
+int yylex(YYSTYPE *lvalp, JSParser *ctx) {
+    FastPath *fp = FAST_PATH_SLOT(ctx);
+    if (!fp || !fp->replaying) {
+        return parser_next_token(lvalp, ctx);
+    }
+    if (fp->next == fp->count && !log_fetch(ctx, fp)) {
+        return 0;
+    }
+    *lvalp = fp->log[fp->next].value;
+    return fp->log[fp->next++].token;
+}
+
+typedef enum
+{
+    SEGMENT_DONE,       // 本段得到了一条（或几条）顶层语句
+    SEGMENT_FALLBACK,   // 需要交给 GLR
+    SEGMENT_ERROR       // 内存不足
+} SegmentResult;
+
+static SegmentResult fast_segment(JSParser *ctx, FastPath *fp, size_t *consumed) {
+    ctx->statement_failed = false;
+    size_t i = 0;
+    char *lookahead_copy = NULL;
+    for (;;) {
+        if (i == fp->count && !log_fetch(ctx, fp)) {
+            fast_parser_reset(fp->parser, ctx);
+            return SEGMENT_ERROR;
+        }
+        LoggedToken *entry = &fp->log[i];
+        if (!fast_parser_lookahead_ok(fp->parser, entry->token)) {
+            fast_parser_reset(fp->parser, ctx);
+            return SEGMENT_FALLBACK;
+        }
+        YYSTYPE value = entry->value;
+        lookahead_copy = NULL;
+        if (token_owns_string(entry->token) && value.str) {
+            value.str = lookahead_copy = copy_string(value.str);
+            if (!value.str) {
+                fast_parser_reset(fp->parser, ctx);
+                return SEGMENT_ERROR;
+            }
+        }
+        FastPushStatus status = fast_parser_push(fp->parser, entry->token, &value, ctx);
+        i++;
+        if (status == FAST_PUSH_FAILED) {
+            return SEGMENT_FALLBACK;    // 解析器已按 %destructor 清理
+        }
+        if (status == FAST_PUSH_ACCEPTED) {
+            break;
+        }
+    }
+    // 接受时被清掉的前瞻 token 不会再被解析器释放，它的副本由这里释放，原值留给下一段
+    if (ctx->statement_lookahead) {
+        free(lookahead_copy);
+        i--;
+    }
+    *consumed = i;
+    return SEGMENT_DONE;
+}
+
+static void free_log_strings(FastPath *fp, size_t from) {
+    for (size_t i = from; i < fp->count; i++) {
+        if (token_owns_string(fp->log[i].token)) {
+            free(fp->log[i].value.str);
+        }
+    }
+    fp->count = 0;
+}
+
+static bool fast_path_init(JSParser *ctx) {
+    if (FAST_PATH_SLOT(ctx)) {
+        return true;
+    }
+    FastPath *fp = (FastPath *)calloc(1, sizeof(FastPath));
+    if (!fp) {
+        return false;
+    }
+    fp->parser = fast_parser_new();
+    if (!fp->parser) {
+        free(fp);
+        return false;
+    }
+    FAST_PATH_SLOT(ctx) = fp;
+    return true;
+}
+
+// GLR 栈的初始容量：确定性运行时栈深不超过已移进的 token 数，按要解析的 token 数估计，
+// 避免每个回退段都分配、清零一整块 16000 项的栈；估计小了 glr.c 会倍增
+#define GLR_MIN_INITIAL_DEPTH 256
+#define GLR_MAX_INITIAL_DEPTH 16000
+#define BYTES_PER_TOKEN_ESTIMATE 3
+
+static size_t glr_depth_for_tokens(size_t tokens) {
+    if (tokens < GLR_MIN_INITIAL_DEPTH) {
+        return GLR_MIN_INITIAL_DEPTH;
+    }
+    return tokens > GLR_MAX_INITIAL_DEPTH ? GLR_MAX_INITIAL_DEPTH : tokens;
+}
+
+// 整个输入交给 GLR：整块输入按字节数估计 token 数，流式输入长度未知，取上限
+static int parse_whole_input(JSParser *ctx) {
+    ctx->glr_initial_depth = ctx->input_length > 0
+        ? glr_depth_for_tokens(ctx->input_length / BYTES_PER_TOKEN_ESTIMATE)
+        : GLR_MAX_INITIAL_DEPTH;
+    return yyparse(ctx);
+}
+
+int parser_parse(JSParser *ctx) {
+    ctx->fast_statements = 0;
+    ctx->glr_statements = 0;
+    ctx->statement_mode = false;
+    if (ctx->glr_only || !fast_parser_compatible(sizeof(YYSTYPE)) || !fast_path_init(ctx)) {
+        return parse_whole_input(ctx);
+    }
+
+    FastPath *fp = FAST_PATH_SLOT(ctx);
+    fp->count = 0;
+    ASTList *items = NULL;
+    ASTList *tail = NULL;
+    int rc = 0;
+    ctx->statement_mode = true;
+    for (;;) {
+        if (fp->count == 0 && !log_fetch(ctx, fp)) {
+            rc = 2;
+            break;
+        }
+        if (fp->log[0].token <= 0) {
+            fp->count = 0;
+            break;  // 输入结束
+        }
+
+        ctx->statement_items = NULL;
+        ctx->statement_lookahead = false;
+        size_t consumed = 0;
+        SegmentResult result = fast_segment(ctx, fp, &consumed);
+        if (result == SEGMENT_ERROR) {
+            rc = 2;
+            break;
+        }
+        bool glr = result == SEGMENT_FALLBACK;
+        if (glr) {
+            // 回退：这一段从头重放给 GLR，GLR 接管交给它的 token
+            ctx->statement_items = NULL;
+            ctx->statement_lookahead = false;
+            fp->next = 0;
+            fp->replaying = true;
+            ctx->glr_initial_depth = glr_depth_for_tokens(fp->count);
+            rc = yyparse(ctx);
+            fp->replaying = false;
+            ctx->glr_statements++;
+            if (rc != 0) {
+                free_log_strings(fp, fp->next);
+                break;
+            }
+            consumed = fp->next - (ctx->statement_lookahead ? 1 : 0);
+        } else {
+            ctx->fast_statements++;
+        }
+        tail = append_items(&items, tail, ctx->statement_items);
+        bool at_end = consumed > 0 && fp->log[consumed - 1].token <= 0;
+        log_drop(fp, consumed, !glr);
+        if (at_end) {
+            break;  // 本段一直解析到了输入末尾（GLR 的延后动作可能把几条语句并成一段）
+        }
+    }
+    ctx->statement_mode = false;
+    ctx->statement_items = NULL;
+    if (rc != 0) {
+        ast_list_free(items);
+        return rc;
+    }
+#ifndef JS_PARSER_VALIDATE
+    ctx->ast_root = ast_make_program(items);
+#endif
+    return 0;
+}
+
+void parser_fast_path_free(JSParser *ctx) {
+    FastPath *fp = FAST_PATH_SLOT(ctx);
+    if (!fp) {
+        return;
+    }
+    fast_parser_free(fp->parser);
+    free(fp->log);
+    free(fp);
+    FAST_PATH_SLOT(ctx) = NULL;
+}
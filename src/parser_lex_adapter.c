@@ -1,38 +1,23 @@
 // 解析器与现有 re2c 词法器的适配层
-// 职责：将 token.h 中的 TokenType 映射为 Bison 的终结符，并提供 yylex()
+// 职责：提供 parser_next_token()（yylex 经 parser_fast_path.c 转到这里），处理 ASI、箭头函数/函数声明改写等上下文相关的 token 调整
+// TokenType 与 Bison token 编码由同一份 tokens.def 生成，数值相同，不需要逐个转换
+// 全部状态保存在每个 JSParser 自己的 LexAdapter 里，没有文件级可变全局量
 
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include "token.h"
+#include "parser_context.h"
 #include "parser.h"  // 由 bison -d 生成，包含 VAR/LET/... 等 token 定义
-#include "diagnostics.h"
 
-extern int parser_is_module_mode(void);
+// parser.h 与 token.h 须来自同一份 tokens.def（编码不一致时这里编译失败）
+typedef char token_codes_match[((int)TOK_VAR == (int)VAR && (int)TOK_IDENTIFIER == (int)IDENTIFIER && (int)TOK_ARROW_HEAD == (int)ARROW_HEAD) ? 1 : -1];
 
-extern void yyerror(const char *s);
-
-static Lexer g_lexer;
-static int g_initialized = 0;
-static int g_last_token = 0;
-static bool g_last_token_closed_control = false;
-static int g_prev_token = 0;
-static bool g_last_token_closed_function = false;
-static bool g_last_token_closed_paren = false;
-static bool g_skip_arrow_detection_once = false;
-static bool g_async_allows_function_decl = false;
-static bool g_lex_error = false;
-
-// 跟踪括号层级及控制语句的条件括号，用于避免在 if(...) 等后面误插入分号
-#define CONTROL_STACK_MAX 64
-static int g_paren_depth = 0;
-static int g_control_stack[CONTROL_STACK_MAX];
-static int g_control_top = 0;
-
-// 用于标记哪些括号层级是属于 function(...) 的头部（和控制语句的控制栈类似）
-static int g_paren_function_stack[CONTROL_STACK_MAX];
-static int g_paren_function_top = 0;
+// 状态栈与待发队列的前若干项放在 LexAdapter 内，嵌套更深时换到堆上按倍数扩容（均摊 O(1)），
+// 深度不设上限——超出固定容量时丢弃入栈会让之后的出栈错位，ASI 判断随之出错
+#define STACK_INLINE_CAPACITY 64
+#define PENDING_INLINE_CAPACITY 16
 
 typedef enum {
     BRACE_BLOCK,
@@ -40,99 +25,205 @@ typedef enum {
     BRACE_FUNCTION
 } BraceKind;
 
-static BraceKind g_brace_stack[CONTROL_STACK_MAX];
-static int g_brace_top = 0;
-static bool g_pending_function_body = false;
-static int g_conditional_stack[CONTROL_STACK_MAX];
-static int g_conditional_top = 0;
-static bool g_last_token_conditional_colon = false;
+typedef struct {
+    int *items;         // 指向 inline_items 或堆上的数组
+    size_t count;
+    size_t capacity;
+    int inline_items[STACK_INLINE_CAPACITY];
+} AdapterStack;
 
-static bool is_control_keyword(int token) {
-    return token == IF || token == FOR || token == WHILE || token == WITH || token == SWITCH || token == CATCH;
+typedef struct PendingToken {
+    int token;
+    YYSTYPE semantic;
+    bool has_semantic;
+    bool skip_arrow_detection;
+} PendingToken;
+
+// 环形队列，满时按顺序搬到两倍大的数组
+typedef struct {
+    PendingToken *items;
+    size_t head;
+    size_t count;
+    size_t capacity;
+    PendingToken inline_items[PENDING_INLINE_CAPACITY];
+} PendingQueue;
+
+// 括号匹配表：从某个 '(' 向后扫描到与之匹配的 ')' 时，途中每个嵌套的 '(' 都顺带得出结果，
+// 按出现顺序排进队列；yylex 之后读到这些 '(' 时直接出队，不再各自重扫（总扫描量与输入成线性）
+typedef struct {
+    size_t offset;          // '(' 的偏移
+    bool arrow_head;        // 匹配的 ')' 之后紧跟 '=>'
+    bool function_literal;  // '(' 之后紧跟 function
+} ParenInfo;
+
+// 扫描时尚未闭合的 '('：队列下标与它的箭头参数过滤状态
+typedef struct {
+    size_t slot;
+    ArrowParamFilter filter;
+} ParenOpen;
+
+typedef struct LexAdapter {
+    JSParser *ctx;
+    Lexer lexer;
+    LexerStream stream;
+    // --pretokenize：先把整个输入切分进 tokens，yylex 只递增下标
+    TokenBuffer tokens;
+    bool use_tokens;
+    size_t token_index;
+    // --lex-pipeline：生产者线程切分并求出括号匹配结果，yylex 从队列取 token
+    TokenPipe *pipe;
+    ParenInfo pipe_paren;
+    bool initialized;
+    int last_token;
+    bool last_token_closed_control;
+    int prev_token;
+    bool last_token_closed_function;
+    bool last_token_closed_paren;
+    bool skip_arrow_detection_once;
+    bool async_allows_function_decl;
+    bool lex_error;
+
+    // 跟踪括号层级及控制语句的条件括号，用于避免在 if(...) 等后面误插入分号
+    int paren_depth;
+    AdapterStack control_stack;
+    // 用于标记哪些括号层级是属于 function(...) 的头部（和控制语句的控制栈类似）
+    AdapterStack paren_function_stack;
+    AdapterStack brace_stack;           // BraceKind
+    bool pending_function_body;
+    AdapterStack conditional_stack;     // 每个未配对 '?' 所在的花括号深度
+    bool last_token_conditional_colon;
+
+    PendingQueue pending;
+
+    ParenInfo *parens;
+    size_t paren_head;
+    size_t paren_count;
+    size_t paren_capacity;
+    ParenOpen *paren_open;
+    size_t paren_open_capacity;
+} LexAdapter;
+
+static void stack_init(AdapterStack *stack) {
+    stack->items = stack->inline_items;
+    stack->count = 0;
+    stack->capacity = STACK_INLINE_CAPACITY;
+}
+
+static void stack_free(AdapterStack *stack) {
+    if (stack->items != stack->inline_items) {
+        free(stack->items);
+    }
+    stack_init(stack);
 }
 
-static void push_control_paren(void) {
-    if (g_control_top < CONTROL_STACK_MAX) {
-        g_control_stack[g_control_top++] = g_paren_depth;
+static void stack_push(AdapterStack *stack, int value) {
+    if (stack->count == stack->capacity) {
+        size_t capacity = stack->capacity * 2;
+        int *grown = (int *)malloc(capacity * sizeof(int));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while tracking nesting\n");
+            exit(EXIT_FAILURE);
+        }
+        memcpy(grown, stack->items, stack->count * sizeof(int));
+        if (stack->items != stack->inline_items) {
+            free(stack->items);
+        }
+        stack->items = grown;
+        stack->capacity = capacity;
     }
+    stack->items[stack->count++] = value;
 }
 
-static void pop_control_paren_if_needed(void) {
-    if (g_control_top > 0 && g_control_stack[g_control_top - 1] == g_paren_depth) {
-        g_control_top--;
-        g_last_token_closed_control = true;
+static bool stack_top_is(const AdapterStack *stack, int value) {
+    return stack->count > 0 && stack->items[stack->count - 1] == value;
+}
+
+static bool is_control_keyword(int token) {
+    return token_has_attr(token, TOKATTR_CONTROL);
+}
+
+static void push_control_paren(LexAdapter *lx) {
+    stack_push(&lx->control_stack, lx->paren_depth);
+}
+
+static void pop_control_paren_if_needed(LexAdapter *lx) {
+    if (stack_top_is(&lx->control_stack, lx->paren_depth)) {
+        lx->control_stack.count--;
+        lx->last_token_closed_control = true;
     }
 }
 
-static void push_function_paren(void) {
-    if (g_paren_function_top < CONTROL_STACK_MAX) {
-        g_paren_function_stack[g_paren_function_top++] = g_paren_depth;
+static void push_function_paren(LexAdapter *lx) {
+    stack_push(&lx->paren_function_stack, lx->paren_depth);
+}
+
+static void pop_function_paren_if_needed(LexAdapter *lx) {
+    if (stack_top_is(&lx->paren_function_stack, lx->paren_depth)) {
+        lx->paren_function_stack.count--;
+        lx->last_token_closed_function = true;
+        lx->pending_function_body = true;
     }
 }
 
-static void pop_function_paren_if_needed(void) {
-    if (g_paren_function_top > 0 && g_paren_function_stack[g_paren_function_top - 1] == g_paren_depth) {
-        g_paren_function_top--;
-        g_last_token_closed_function = true;
-        g_pending_function_body = true;
+// 丢弃位于已闭合花括号内的未配对 '?'
+static void pop_conditionals_above(LexAdapter *lx) {
+    AdapterStack *conditionals = &lx->conditional_stack;
+    while (conditionals->count > 0 && conditionals->items[conditionals->count - 1] > (int)lx->brace_stack.count) {
+        conditionals->count--;
     }
 }
 
-static void update_token_state(int token) {
-    g_last_token_closed_control = false;
-    g_last_token_closed_function = false;
-    g_last_token_closed_paren = false;
+static void update_token_state(LexAdapter *lx, int token) {
+    lx->last_token_closed_control = false;
+    lx->last_token_closed_function = false;
+    lx->last_token_closed_paren = false;
     bool current_token_is_conditional_colon = false;
 
     if (token == '(') {
         // 先增加深度，确保栈中记录的是“括号内”的层级
-        g_paren_depth++;
+        lx->paren_depth++;
 
         // 检查是否为函数头部的括号
         // 情况A: function foo (...)  -> prev: FUNCTION, last: IDENTIFIER
         // 情况B: function (...)      -> last: FUNCTION (匿名函数)
-        bool last_is_function = (g_last_token == FUNCTION || g_last_token == FUNCTION_DECL);
-        bool prev_is_function = (g_prev_token == FUNCTION || g_prev_token == FUNCTION_DECL);
-        bool is_named_func = (prev_is_function && g_last_token == IDENTIFIER);
+        bool last_is_function = (lx->last_token == FUNCTION || lx->last_token == FUNCTION_DECL);
+        bool prev_is_function = (lx->prev_token == FUNCTION || lx->prev_token == FUNCTION_DECL);
+        bool is_named_func = (prev_is_function && lx->last_token == IDENTIFIER);
         bool is_anon_func  = last_is_function;
 
         if (is_named_func || is_anon_func) {
-            push_function_paren(); // 现在存入的是 increment 后的深度
+            push_function_paren(lx); // 现在存入的是 increment 后的深度
         }
 
         // 3. 检查控制语句
-        if (is_control_keyword(g_last_token)) {
-            bool keyword_used_as_property = (g_prev_token == '.');
+        if (is_control_keyword(lx->last_token)) {
+            bool keyword_used_as_property = (lx->prev_token == '.');
             if (!keyword_used_as_property) {
-                push_control_paren(); // 存入 increment 后的深度
+                push_control_paren(lx); // 存入 increment 后的深度
             }
         }
 
     } else if (token == ')') {
-        if (g_paren_depth > 0) {
+        if (lx->paren_depth > 0) {
             // 先检查函数栈（如果匹配就设置函数关闭标志）
-            pop_function_paren_if_needed();
+            pop_function_paren_if_needed(lx);
             // 再检查控制语句栈
-            pop_control_paren_if_needed();
-            g_paren_depth--;
-            g_last_token_closed_paren = true;
+            pop_control_paren_if_needed(lx);
+            lx->paren_depth--;
+            lx->last_token_closed_paren = true;
         }
     } else if (token == '?') {
-        if (g_conditional_top < CONTROL_STACK_MAX) {
-            g_conditional_stack[g_conditional_top++] = g_brace_top;
-        }
+        stack_push(&lx->conditional_stack, (int)lx->brace_stack.count);
     } else if (token == ':') {
-        while (g_conditional_top > 0 && g_conditional_stack[g_conditional_top - 1] > g_brace_top) {
-            g_conditional_top--;
-        }
-        if (g_conditional_top > 0 && g_conditional_stack[g_conditional_top - 1] == g_brace_top) {
-            g_conditional_top--;
+        pop_conditionals_above(lx);
+        if (stack_top_is(&lx->conditional_stack, (int)lx->brace_stack.count)) {
+            lx->conditional_stack.count--;
             current_token_is_conditional_colon = true;
         }
     } else if (token == '{') {
         bool is_block = true;
-        if (g_last_token > 0) {
-            switch (g_last_token) {
+        if (lx->last_token > 0) {
+            switch (lx->last_token) {
                 case IF:
                 case ELSE:
                 case FOR:
@@ -155,9 +246,9 @@ static void update_token_state(int token) {
                     is_block = true;
                     break;
                 case ':':
-                    if (g_last_token_conditional_colon) {
+                    if (lx->last_token_conditional_colon) {
                         is_block = false;
-                    } else if (g_brace_top > 0 && g_brace_stack[g_brace_top - 1] == BRACE_OBJECT) {
+                    } else if (stack_top_is(&lx->brace_stack, BRACE_OBJECT)) {
                         is_block = false;
                     } else {
                         is_block = true;
@@ -168,33 +259,29 @@ static void update_token_state(int token) {
                     break;
             }
         }
-        if (g_brace_top < CONTROL_STACK_MAX) {
-            BraceKind kind = is_block ? BRACE_BLOCK : BRACE_OBJECT;
-            if (g_pending_function_body) {
-                kind = BRACE_FUNCTION;
-                g_pending_function_body = false;
-            }
-            g_brace_stack[g_brace_top++] = kind;
+        BraceKind kind = is_block ? BRACE_BLOCK : BRACE_OBJECT;
+        if (lx->pending_function_body) {
+            kind = BRACE_FUNCTION;
+            lx->pending_function_body = false;
         }
+        stack_push(&lx->brace_stack, kind);
     } else if (token == '}') {
-        if (g_brace_top > 0) {
-            BraceKind kind = g_brace_stack[--g_brace_top];
+        if (lx->brace_stack.count > 0) {
+            BraceKind kind = (BraceKind)lx->brace_stack.items[--lx->brace_stack.count];
             if (kind == BRACE_FUNCTION) {
-                g_last_token_closed_function = true;
-            }
-            while (g_conditional_top > 0 && g_conditional_stack[g_conditional_top - 1] > g_brace_top) {
-                g_conditional_top--;
+                lx->last_token_closed_function = true;
             }
+            pop_conditionals_above(lx);
         }
     }
 
-    g_prev_token = g_last_token;
-    g_last_token = token;
-    g_last_token_conditional_colon = current_token_is_conditional_colon;
+    lx->prev_token = lx->last_token;
+    lx->last_token = token;
+    lx->last_token_conditional_colon = current_token_is_conditional_colon;
 }
 
 static bool is_restricted_token(int token) {
-    return token == RETURN || token == BREAK || token == CONTINUE || token == THROW || token == YIELD;
+    return token_has_attr(token, TOKATTR_RESTRICTED);
 }
 
 static bool newline_allowed_after_yield(int next_token, bool is_eof) {
@@ -216,33 +303,9 @@ static bool newline_allowed_after_yield(int next_token, bool is_eof) {
 }
 
 static bool can_end_statement(int token) {
-    switch (token) {
-        case IDENTIFIER:
-        case NUMBER:
-        case STRING:
-        case REGEX:
-        case TRUE:
-        case FALSE:
-        case NULL_T:
-        case UNDEFINED:
-        case THIS:
-        case SUPER:
-        case TEMPLATE_NO_SUB:
-        case TEMPLATE_TAIL:
-        case DEFAULT:
-        case ')':
-        case ']':
-        case '}':
-        case PLUS_PLUS:
-        case MINUS_MINUS:
-            return true;
-        default:
-            return false;
-    }
+    return token_has_attr(token, TOKATTR_END_STMT);
 }
 
-static bool paren_starts_function_literal(void);
-
 static bool suppress_newline_insertion(int token, bool paren_is_function_literal) {
     if (token == '(') {
         return !paren_is_function_literal;
@@ -261,16 +324,16 @@ static bool suppress_newline_insertion(int token, bool paren_is_function_literal
     }
 }
 
-static bool in_statement_context(void) {
-    if (g_last_token == 0) {
+static bool in_statement_context(LexAdapter *lx) {
+    if (lx->last_token == 0) {
         return true;
     }
 
-    if (g_last_token_closed_control) {
+    if (lx->last_token_closed_control) {
         return true;
     }
 
-    switch (g_last_token) {
+    switch (lx->last_token) {
         case ';':
         case '{':
         case '}':
@@ -288,7 +351,7 @@ static bool in_statement_context(void) {
     }
 }
 
-static bool should_insert_semicolon(int last_token, bool last_closed_control, bool last_token_closed_function, bool last_token_closed_paren, int next_token, bool newline_before, bool is_eof, bool next_starts_function_literal) {
+static bool should_insert_semicolon(LexAdapter *lx, int last_token, bool last_closed_control, bool last_token_closed_function, bool last_token_closed_paren, int next_token, bool newline_before, bool is_eof, bool next_starts_function_literal) {
     if (last_token <= 0) {
         return false;
     }
@@ -338,11 +401,8 @@ static bool should_insert_semicolon(int last_token, bool last_closed_control, bo
     }
 
     if (next_token == '}') {
-        if (g_brace_top > 0) {
-            BraceKind kind = g_brace_stack[g_brace_top - 1];
-            if (kind == BRACE_OBJECT) {
-                return false; // object literal braces stay within expressions
-            }
+        if (stack_top_is(&lx->brace_stack, BRACE_OBJECT)) {
+            return false; // object literal braces stay within expressions
         }
         return true;
     }
@@ -358,151 +418,52 @@ static bool should_insert_semicolon(int last_token, bool last_closed_control, bo
     return false;
 }
 
-static int convert_token_type(TokenType type) {
-    switch (type) {
-        case TOK_VAR:        return VAR;
-        case TOK_LET:        return LET;
-        case TOK_CONST:      return CONST;
-        case TOK_FUNCTION:   return FUNCTION;
-        case TOK_IF:         return IF;
-        case TOK_ELSE:       return ELSE;
-        case TOK_FOR:        return FOR;
-        case TOK_WHILE:      return WHILE;
-        case TOK_DO:         return DO;
-        case TOK_RETURN:     return RETURN;
-        case TOK_BREAK:      return BREAK;
-        case TOK_CONTINUE:   return CONTINUE;
-        case TOK_SWITCH:     return SWITCH;
-        case TOK_CASE:       return CASE;
-        case TOK_DEFAULT:    return DEFAULT;
-        case TOK_TRY:        return TRY;
-        case TOK_CATCH:      return CATCH;
-        case TOK_FINALLY:    return FINALLY;
-        case TOK_THROW:      return THROW;
-        case TOK_NEW:        return NEW;
-        case TOK_THIS:       return THIS;
-        case TOK_TYPEOF:     return TYPEOF;
-        case TOK_DELETE:     return DELETE;
-        case TOK_IN:         return IN;
-        case TOK_INSTANCEOF: return INSTANCEOF;
-        case TOK_VOID:       return VOID;
-        case TOK_WITH:       return WITH;
-        case TOK_DEBUGGER:   return DEBUGGER;
-        case TOK_CLASS:      return CLASS;
-        case TOK_EXTENDS:    return EXTENDS;
-        case TOK_SUPER:      return SUPER;
-        case TOK_IMPORT:     return parser_is_module_mode() ? IMPORT : IDENTIFIER;
-        case TOK_EXPORT:     return parser_is_module_mode() ? EXPORT : IDENTIFIER;
-        case TOK_YIELD:      return YIELD;
-        case TOK_ASYNC:      return ASYNC;
-        case TOK_AWAIT:      return AWAIT;
-
-        case TOK_TRUE:       return TRUE;
-        case TOK_FALSE:      return FALSE;
-        case TOK_NULL:       return NULL_T;
-        case TOK_UNDEFINED:  return IDENTIFIER; //UNDEFINED 语法层面可以被看作ID TOKEN，但在语义上与ID不一致，
-        case TOK_NUMBER:     return NUMBER;
-        case TOK_STRING:     return STRING;
-        case TOK_REGEX:      return REGEX;
-        case TOK_IDENTIFIER: return IDENTIFIER;
-        case TOK_TEMPLATE_NO_SUB: return TEMPLATE_NO_SUB;
-        case TOK_TEMPLATE_HEAD:   return TEMPLATE_HEAD;
-        case TOK_TEMPLATE_MIDDLE: return TEMPLATE_MIDDLE;
-        case TOK_TEMPLATE_TAIL:   return TEMPLATE_TAIL;
-
-        case TOK_PLUS_PLUS:  return PLUS_PLUS;
-        case TOK_MINUS_MINUS:return MINUS_MINUS;
-        case TOK_EQ:         return EQ;
-        case TOK_NE:         return NE;
-        case TOK_EQ_STRICT:  return EQ_STRICT;
-        case TOK_NE_STRICT:  return NE_STRICT;
-        case TOK_ARROW:      return ARROW;
-        case TOK_LE:         return LE;
-        case TOK_GE:         return GE;
-        case TOK_AND:        return AND;
-        case TOK_OR:         return OR;
-        case TOK_LSHIFT:     return LSHIFT;
-        case TOK_RSHIFT:     return RSHIFT;
-        case TOK_URSHIFT:    return URSHIFT;
-        case TOK_PLUS_ASSIGN:    return PLUS_ASSIGN;
-        case TOK_MINUS_ASSIGN:   return MINUS_ASSIGN;
-        case TOK_STAR_ASSIGN:    return STAR_ASSIGN;
-        case TOK_SLASH_ASSIGN:   return SLASH_ASSIGN;
-        case TOK_PERCENT_ASSIGN: return PERCENT_ASSIGN;
-        case TOK_AND_ASSIGN:     return AND_ASSIGN;
-        case TOK_OR_ASSIGN:      return OR_ASSIGN;
-        case TOK_XOR_ASSIGN:     return XOR_ASSIGN;
-        case TOK_LSHIFT_ASSIGN:  return LSHIFT_ASSIGN;
-        case TOK_RSHIFT_ASSIGN:  return RSHIFT_ASSIGN;
-        case TOK_URSHIFT_ASSIGN: return URSHIFT_ASSIGN;
-        case TOK_ELLIPSIS:  return ELLIPSIS;
-
-        case TOK_PLUS:       return '+';
-        case TOK_MINUS:      return '-';
-        case TOK_STAR:       return '*';
-        case TOK_SLASH:      return '/';
-        case TOK_PERCENT:    return '%';
-        case TOK_ASSIGN:     return '=';
-        case TOK_LT:         return '<';
-        case TOK_GT:         return '>';
-        case TOK_NOT:        return '!';
-        case TOK_BIT_AND:    return '&';
-        case TOK_BIT_OR:     return '|';
-        case TOK_BIT_XOR:    return '^';
-        case TOK_BIT_NOT:    return '~';
-        case TOK_QUESTION:   return '?';
-        case TOK_COLON:      return ':';
-        case TOK_LPAREN:     return '(';
-        case TOK_RPAREN:     return ')';
-        case TOK_LBRACE:     return '{';
-        case TOK_RBRACE:     return '}';
-        case TOK_LBRACKET:   return '[';
-        case TOK_RBRACKET:   return ']';
-        case TOK_SEMICOLON:  return ';';
-        case TOK_COMMA:      return ',';
-        case TOK_DOT:        return '.';
-
-        case TOK_EOF:        return 0;
-
-        case TOK_ERROR:
-        default:
-            return -1;
+// lexer 产出的类型就是 Bison 编码，只需处理语法层按标识符对待的关键字
+static int grammar_token(LexAdapter *lx, TokenType type) {
+    if (token_has_attr(type, TOKATTR_AS_IDENTIFIER)) {
+        return IDENTIFIER; // UNDEFINED 语法层面可以被看作ID TOKEN，但在语义上与ID不一致
     }
+    if (token_has_attr(type, TOKATTR_MODULE_ONLY) && !lx->ctx->module_mode) {
+        return IDENTIFIER;
+    }
+    return (int)type;
 }
 
-#define PENDING_QUEUE_MAX 32
-
-typedef struct PendingToken {
-    int token;
-    YYSTYPE semantic;
-    bool has_semantic;
-    bool skip_arrow_detection;
-} PendingToken;
-
-static PendingToken g_pending_queue[PENDING_QUEUE_MAX];
-static int g_pending_head = 0;
-static int g_pending_tail = 0;
-
-static bool pending_is_empty(void) {
-    return g_pending_head == g_pending_tail;
-}
-
-static bool pending_pop(PendingToken *out) {
-    if (pending_is_empty()) {
+static bool pending_pop(LexAdapter *lx, PendingToken *out) {
+    PendingQueue *queue = &lx->pending;
+    if (queue->count == 0) {
         return false;
     }
-    *out = g_pending_queue[g_pending_head];
-    g_pending_head = (g_pending_head + 1) % PENDING_QUEUE_MAX;
+    *out = queue->items[queue->head];
+    queue->head = (queue->head + 1) % queue->capacity;
+    queue->count--;
     return true;
 }
 
-static void pending_push(int token, const YYSTYPE *semantic, bool has_semantic, bool skip_arrow_detection) {
-    int next_tail = (g_pending_tail + 1) % PENDING_QUEUE_MAX;
-    if (next_tail == g_pending_head) {
-        fprintf(stderr, "[parser_lex_adapter] pending queue overflow\n");
+static void pending_grow(PendingQueue *queue) {
+    size_t capacity = queue->capacity * 2;
+    PendingToken *grown = (PendingToken *)malloc(capacity * sizeof(PendingToken));
+    if (!grown) {
+        fprintf(stderr, "Out of memory while queueing tokens\n");
         exit(EXIT_FAILURE);
     }
-    PendingToken *slot = &g_pending_queue[g_pending_tail];
+    for (size_t i = 0; i < queue->count; i++) {
+        grown[i] = queue->items[(queue->head + i) % queue->capacity];
+    }
+    if (queue->items != queue->inline_items) {
+        free(queue->items);
+    }
+    queue->items = grown;
+    queue->head = 0;
+    queue->capacity = capacity;
+}
+
+static void pending_push(LexAdapter *lx, int token, const YYSTYPE *semantic, bool has_semantic, bool skip_arrow_detection) {
+    PendingQueue *queue = &lx->pending;
+    if (queue->count == queue->capacity) {
+        pending_grow(queue);
+    }
+    PendingToken *slot = &queue->items[(queue->head + queue->count) % queue->capacity];
     slot->token = token;
     if (has_semantic && semantic) {
         slot->semantic = *semantic;
@@ -511,176 +472,412 @@ static void pending_push(int token, const YYSTYPE *semantic, bool has_semantic,
     }
     slot->has_semantic = has_semantic;
     slot->skip_arrow_detection = skip_arrow_detection;
-    g_pending_tail = next_tail;
+    queue->count++;
+}
+
+// 取下一个原始 token：流水线模式下读队列，预分词模式下读数组，否则向 lx->lexer 拉取
+static Token next_source_token(LexAdapter *lx, bool *newline_before) {
+    if (lx->pipe) {
+        return token_pipe_next(lx->pipe, newline_before);
+    }
+    if (lx->use_tokens) {
+        // 读到末尾后停在最后一个 token（EOF），与拉取模式反复返回 EOF 一致
+        size_t index = lx->token_index < lx->tokens.count ? lx->token_index++ : lx->tokens.count - 1;
+        *newline_before = (lx->tokens.flags[index] & TOKBUF_NEWLINE_BEFORE) != 0;
+        return token_buffer_get(&lx->tokens, index);
+    }
+    Token tk = lexer_next_token(&lx->lexer);
+    *newline_before = lx->lexer.has_newline;
+    return tk;
 }
 
-static bool lookahead_is_arrow_head(void) {
-    Lexer snapshot = g_lexer;
-    int depth = 1;
+// 前瞻游标：预分词模式下只是一个下标；拉取模式下在 lx->lexer 上扫描，结束后恢复检查点
+// （流式输入时窗口会被固定，不能直接复制 Lexer）
+typedef struct {
+    LexerCheckpoint checkpoint;
+    size_t index;
+} Lookahead;
 
-    while (depth > 0) {
-        Token tk = lexer_next_token(&snapshot);
-        if (tk.type == TOK_EOF || tk.type == TOK_ERROR) {
-            token_free(&tk);
-            return false;
+static void lookahead_begin(LexAdapter *lx, Lookahead *la) {
+    if (lx->use_tokens) {
+        la->index = lx->token_index;
+    } else {
+        lexer_save(&lx->lexer, &la->checkpoint);
+    }
+}
+
+static Token lookahead_next(LexAdapter *lx, Lookahead *la) {
+    if (lx->use_tokens) {
+        return token_buffer_get(&lx->tokens, la->index++);
+    }
+    return lexer_next_token(&lx->lexer);
+}
+
+static void lookahead_end(LexAdapter *lx, Lookahead *la) {
+    if (!lx->use_tokens) {
+        lexer_restore(&lx->lexer, &la->checkpoint);
+    }
+}
+
+static size_t paren_info_push(LexAdapter *lx, size_t offset) {
+    if (lx->paren_count == lx->paren_capacity) {
+        size_t capacity = lx->paren_capacity ? lx->paren_capacity * 2 : 64;
+        ParenInfo *grown = (ParenInfo *)realloc(lx->parens, capacity * sizeof(ParenInfo));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while matching parentheses\n");
+            exit(EXIT_FAILURE);
         }
+        lx->parens = grown;
+        lx->paren_capacity = capacity;
+    }
+    ParenInfo *info = &lx->parens[lx->paren_count];
+    info->offset = offset;
+    info->arrow_head = false;
+    info->function_literal = false;
+    return lx->paren_count++;
+}
 
-        if (tk.type == TOK_LPAREN) {
-            depth++;
-        } else if (tk.type == TOK_RPAREN) {
+static void paren_open_push(LexAdapter *lx, size_t depth, size_t slot) {
+    if (depth == lx->paren_open_capacity) {
+        size_t capacity = lx->paren_open_capacity ? lx->paren_open_capacity * 2 : 64;
+        ParenOpen *grown = (ParenOpen *)realloc(lx->paren_open, capacity * sizeof(ParenOpen));
+        if (!grown) {
+            fprintf(stderr, "Out of memory while matching parentheses\n");
+            exit(EXIT_FAILURE);
+        }
+        lx->paren_open = grown;
+        lx->paren_open_capacity = capacity;
+    }
+    lx->paren_open[depth].slot = slot;
+    arrow_params_init(&lx->paren_open[depth].filter);
+}
+
+// 当前 token 是 offset 处的 '('：一次扫描到匹配的 ')' 之后一个 token，记录途中所有 '(' 的结果。
+// 未闭合（遇到 EOF/错误）的括号两项都为 false；内容不可能是参数列表的括号即使后面是 '=>' 也记为
+// false（两种情况都是语法错误），与流水线模式提前判定的结果一致
+static void paren_scan(LexAdapter *lx, size_t offset) {
+    const size_t none = (size_t)-1;
+    size_t depth = 0;
+    paren_open_push(lx, depth++, paren_info_push(lx, offset));
+    size_t opened = lx->paren_open[0].slot; // 刚打开的 '('，下一个 token 决定 function_literal
+    size_t closed = none;                   // 刚闭合的 '('，下一个 token 决定 arrow_head
+    bool closed_possible = false;
+
+    Lookahead la;
+    lookahead_begin(lx, &la);
+    for (;;) {
+        Token tk = lookahead_next(lx, &la);
+        if (opened != none) {
+            lx->parens[opened].function_literal = (tk.type == TOK_FUNCTION);
+            opened = none;
+        }
+        if (closed != none) {
+            lx->parens[closed].arrow_head = closed_possible && tk.type == TOK_ARROW;
+            closed = none;
+        }
+        if (depth == 0 || tk.type == TOK_EOF || tk.type == TOK_ERROR) {
+            break;
+        }
+        if (tk.type == TOK_RPAREN) {
             depth--;
-            if (depth == 0) {
-                token_free(&tk);
-                Token next = lexer_next_token(&snapshot);
-                bool result = (next.type == TOK_ARROW);
-                token_free(&next);
-                return result;
-            }
+            closed = lx->paren_open[depth].slot;
+            closed_possible = arrow_params_possible(&lx->paren_open[depth].filter);
+            continue;
+        }
+        arrow_params_step(&lx->paren_open[depth - 1].filter, tk.type);
+        if (tk.type == TOK_LPAREN) {
+            opened = paren_info_push(lx, tk.offset);
+            paren_open_push(lx, depth++, opened);
         }
+    }
+    lookahead_end(lx, &la);
+}
 
-        token_free(&tk);
+static const ParenInfo *paren_lookup(LexAdapter *lx, size_t offset) {
+    if (lx->pipe) {
+        // 流水线模式：查询刚从队列取出的 '('，生产者尚未得出结果时在这里等待
+        lx->pipe_paren.offset = offset;
+        token_pipe_paren(lx->pipe, &lx->pipe_paren.arrow_head, &lx->pipe_paren.function_literal);
+        return &lx->pipe_paren;
+    }
+    // 丢弃已经越过的记录；未命中时队列里已无后续 '('，清空后从头复用
+    while (lx->paren_head < lx->paren_count && lx->parens[lx->paren_head].offset < offset) {
+        lx->paren_head++;
     }
+    if (lx->paren_head == lx->paren_count || lx->parens[lx->paren_head].offset != offset) {
+        lx->paren_head = 0;
+        lx->paren_count = 0;
+        paren_scan(lx, offset);
+    }
+    return &lx->parens[lx->paren_head];
+}
 
-    return false;
+static void resolve_position(void *userdata, size_t offset, int *line, int *column) {
+    LexAdapter *lx = (LexAdapter *)userdata;
+    lexer_position(&lx->lexer, offset, line, column);
+}
+
+static LexAdapter *adapter_of(JSParser *ctx) {
+    if (!ctx->lex) {
+        ctx->lex = (LexAdapter *)calloc(1, sizeof(LexAdapter));
+        if (!ctx->lex) {
+            return NULL;
+        }
+        ctx->lex->ctx = ctx;
+        stack_init(&ctx->lex->control_stack);
+        stack_init(&ctx->lex->paren_function_stack);
+        stack_init(&ctx->lex->brace_stack);
+        stack_init(&ctx->lex->conditional_stack);
+        ctx->lex->pending.items = ctx->lex->pending.inline_items;
+        ctx->lex->pending.capacity = PENDING_INLINE_CAPACITY;
+    }
+    return ctx->lex;
+}
+
+static void reset_adapter_state(LexAdapter *lx) {
+    diag_set_position_resolver(&lx->ctx->diag, resolve_position, lx);
+    lx->initialized = true;
+    lx->use_tokens = false;
+    lx->token_index = 0;
+    lx->last_token = 0;
+    lx->prev_token = 0;
+    lx->last_token_closed_control = false;
+    lx->last_token_closed_function = false;
+    lx->last_token_closed_paren = false;
+    lx->async_allows_function_decl = false;
+    lx->paren_depth = 0;
+    lx->control_stack.count = 0;
+    lx->paren_function_stack.count = 0;
+    lx->pending.head = 0;
+    lx->pending.count = 0;
+    lx->skip_arrow_detection_once = false;
+    lx->brace_stack.count = 0;
+    lx->pending_function_body = false;
+    lx->paren_head = 0;
+    lx->paren_count = 0;
+    lx->conditional_stack.count = 0;
+    lx->last_token_conditional_colon = false;
+    lx->lex_error = false;
 }
 
-static bool paren_starts_function_literal(void) {
-    Lexer snapshot = g_lexer;
-    Token next = lexer_next_token(&snapshot);
-    bool starts_function = (next.type == TOK_FUNCTION);
-    token_free(&next);
-    return starts_function;
-}
-
-// 由 parser_main.c 调用，设置输入缓冲区
-void parser_set_input(const char *input) {
-    lexer_init(&g_lexer, input);
-    g_initialized = 1;
-    g_last_token = 0;
-    g_last_token_closed_control = false;
-    g_paren_depth = 0;
-    g_control_top = 0;
-    g_pending_head = 0;
-    g_pending_tail = 0;
-    g_skip_arrow_detection_once = false;
-    g_brace_top = 0;
-    g_conditional_top = 0;
-    g_last_token_conditional_colon = false;
-    g_lex_error = false;
-}
-
-// bison 调用的词法函数
-int yylex(void) {
-    if (!g_initialized) {
+// 设置整块输入：input[length] 必须是 NUL（词法分析器的结束哨兵）
+bool parser_set_input(JSParser *ctx, const char *input, size_t length) {
+    LexAdapter *lx = adapter_of(ctx);
+    if (!lx) {
+        return false;
+    }
+    lexer_init_at(&lx->lexer, input, length, 0);
+    lx->lexer.quiet = !ctx->print_errors;
+    reset_adapter_state(lx);
+    ctx->input_length = length;
+    return true;
+}
+
+// 流式输入：词法分析器通过 YYFILL 按窗口读取 file，末尾补换行与整文件模式保持一致
+bool parser_set_input_stream(JSParser *ctx, FILE *file, size_t window_size) {
+    LexAdapter *lx = adapter_of(ctx);
+    if (!lx || !lexer_init_stream(&lx->lexer, &lx->stream, file, window_size, true)) {
+        return false;
+    }
+    lx->lexer.quiet = !ctx->print_errors;
+    reset_adapter_state(lx);
+    ctx->input_length = 0;
+    return true;
+}
+
+// 从任意数据源流式读取（推送式解析用），其余同 parser_set_input_stream
+bool parser_set_input_reader(JSParser *ctx, LexerReadFn read, void *source, size_t window_size) {
+    LexAdapter *lx = adapter_of(ctx);
+    if (!lx || !lexer_init_stream_reader(&lx->lexer, &lx->stream, read, source, window_size, true)) {
+        return false;
+    }
+    lx->lexer.quiet = !ctx->print_errors;
+    reset_adapter_state(lx);
+    ctx->input_length = 0;
+    return true;
+}
+
+// 预分词：整块输入一次切分完，之后 yylex 只读数组；失败（如流式输入）时保持逐个取 token。
+// threads > 1 时按段并行切分（chunk_size 为 0 时按线程数均分），结果与串行相同
+bool parser_pretokenize(JSParser *ctx, int threads, size_t chunk_size) {
+    LexAdapter *lx = ctx->lex;
+    lx->use_tokens = token_buffer_fill_parallel(&lx->tokens, &lx->lexer, threads, chunk_size);
+    lx->token_index = 0;
+    return lx->use_tokens;
+}
+
+// 流水线切分：在后台线程切分整块输入，与解析并行；失败（如流式输入）时保持逐个取 token
+bool parser_lex_pipeline(JSParser *ctx) {
+    LexAdapter *lx = ctx->lex;
+    lx->pipe = token_pipe_start(&lx->lexer);
+    return lx->pipe != NULL;
+}
+
+void parser_release_input(JSParser *ctx) {
+    LexAdapter *lx = ctx->lex;
+    if (!lx || !lx->initialized) {
+        return;
+    }
+    if (lx->pipe) {
+        token_pipe_stop(lx->pipe);
+        lx->pipe = NULL;
+    }
+    if (lx->use_tokens) {
+        token_buffer_free(&lx->tokens);
+        lx->use_tokens = false;
+    }
+    lx->paren_head = 0;
+    lx->paren_count = 0;
+    lexer_dispose(&lx->lexer);
+    if (lx->lexer.stream) {
+        lexer_stream_free(lx->lexer.stream);
+        lx->lexer.stream = NULL;
+    }
+    lx->initialized = false;
+}
+
+// 状态栈、待发队列与括号匹配表的堆缓冲区在多次解析之间复用，随上下文一起释放
+void parser_adapter_free(JSParser *ctx) {
+    LexAdapter *lx = ctx->lex;
+    if (!lx) {
+        return;
+    }
+    parser_release_input(ctx);
+    stack_free(&lx->control_stack);
+    stack_free(&lx->paren_function_stack);
+    stack_free(&lx->brace_stack);
+    stack_free(&lx->conditional_stack);
+    if (lx->pending.items != lx->pending.inline_items) {
+        free(lx->pending.items);
+    }
+    free(lx->parens);
+    free(lx->paren_open);
+    free(lx);
+    ctx->lex = NULL;
+}
+
+// 解析器取 token 的入口（value 指向 YYSTYPE）
+int parser_next_token(void *value, JSParser *ctx) {
+    YYSTYPE *lvalp = (YYSTYPE *)value;
+    LexAdapter *lx = ctx->lex;
+    if (!lx || !lx->initialized) {
         fprintf(stderr, "[lexer] not initialized\n");
         return 0; // 视为 EOF
     }
 
     PendingToken queued;
-    if (pending_pop(&queued)) {
+    if (pending_pop(lx, &queued)) {
         if (queued.skip_arrow_detection) {
-            g_skip_arrow_detection_once = true;
+            lx->skip_arrow_detection_once = true;
         }
         if (queued.has_semantic) {
-            yylval = queued.semantic;
+            *lvalp = queued.semantic;
         } else {
-            memset(&yylval, 0, sizeof(yylval));
+            memset(lvalp, 0, sizeof(*lvalp));
         }
         if (queued.token != ARROW_HEAD) {
-            update_token_state(queued.token);
+            update_token_state(lx, queued.token);
         }
         return queued.token;
     }
 
     while (1) {
-        Token tk = lexer_next_token(&g_lexer);
-        bool newline_before = g_lexer.has_newline;
-        int mapped = convert_token_type(tk.type);
+        bool newline_before = false;
+        Token tk = next_source_token(lx, &newline_before);
+        int mapped = grammar_token(lx, tk.type);
         bool is_eof = (tk.type == TOK_EOF);
 
         YYSTYPE semantic;
         memset(&semantic, 0, sizeof(semantic));
         bool has_semantic = false;
 
-        if (tk.type == TOK_IDENTIFIER || tk.type == TOK_STRING || tk.type == TOK_NUMBER) {
-            semantic.str = tk.value;
-            tk.value = NULL;
-            has_semantic = (semantic.str != NULL);
+        if (tk.type == TOK_ERROR) {
+            if (ctx->print_errors) {
+                int line, column;
+                lexer_position(&lx->lexer, tk.offset, &line, &column);
+                fprintf(stderr, "Lexical error at line %d, column %d\n", line, column);
+            }
+            diag_add(&ctx->diag, tk.offset, "Lexical error");
+            lx->lex_error = true;
+            return 0;
         }
 
-        if (mapped < 0) {
-            fprintf(stderr, "Lexical error at line %d, column %d\n", tk.line, tk.column);
-            token_free(&tk);
-            g_lex_error = true;
-            return 0;
+        // 只有语法层需要独立字符串的 token 才物化文本，其余 token 仅保留输入视图；
+        // 标识符与数字直接从输入视图驻留为 atom，同名只保存一份（数值在建 AST 时由 numeric.c 计算）
+        if (tk.type == TOK_IDENTIFIER || tk.type == TOK_NUMBER) {
+            semantic.atom = atom_intern(ctx->atoms, token_text(&lx->lexer, &tk), tk.length);
+            has_semantic = true;
+        } else if (!ctx->validate_only
+                   && (tk.type == TOK_STRING || tk.type == TOK_TEMPLATE_NO_SUB || tk.type == TOK_TEMPLATE_HEAD
+                       || tk.type == TOK_TEMPLATE_MIDDLE || tk.type == TOK_TEMPLATE_TAIL)) {
+            // 字符串与模板片段保留原始文本，cooked 值在 AST 上按需解码（只验证语法时没有 AST，不复制）
+            semantic.str = token_dup_value(&lx->lexer, &tk);
+            has_semantic = (semantic.str != NULL);
         }
 
-        int token_line = tk.line;
-        int token_column = tk.column;
-        diag_set_last_token_location(token_line, token_column);
-        token_free(&tk);
+        diag_set_last_token_offset(&ctx->diag, tk.offset);
 
         if (mapped == ASYNC) {
-            g_async_allows_function_decl = in_statement_context();
+            lx->async_allows_function_decl = in_statement_context(lx);
         }
 
         if (mapped == FUNCTION) {
-            bool should_be_decl = in_statement_context() || g_async_allows_function_decl;
+            bool should_be_decl = in_statement_context(lx) || lx->async_allows_function_decl;
             if (should_be_decl) {
                 mapped = FUNCTION_DECL;
             }
-            g_async_allows_function_decl = false;
+            lx->async_allows_function_decl = false;
         } else if (mapped != ASYNC) {
-            g_async_allows_function_decl = false;
+            lx->async_allows_function_decl = false;
         }
 
-        bool skip_detection = g_skip_arrow_detection_once;
-        g_skip_arrow_detection_once = false;
+        bool skip_detection = lx->skip_arrow_detection_once;
+        lx->skip_arrow_detection_once = false;
         bool arrow_candidate = false;
         if (mapped == '(' && !skip_detection) {
-            arrow_candidate = lookahead_is_arrow_head();
+            arrow_candidate = paren_lookup(lx, tk.offset)->arrow_head;
         }
         if (arrow_candidate) {
-            pending_push('(', &semantic, has_semantic, true);
+            pending_push(lx, '(', &semantic, has_semantic, true);
             mapped = ARROW_HEAD;
             has_semantic = false;
         }
 
         bool next_starts_function_literal = false;
         if (mapped == '(') {
-            next_starts_function_literal = paren_starts_function_literal();
+            next_starts_function_literal = paren_lookup(lx, tk.offset)->function_literal;
         }
 
-        if (g_last_token == YIELD && newline_before && !newline_allowed_after_yield(mapped, is_eof)) {
-            yyerror("LineTerminator not allowed after 'yield'");
+        if (lx->last_token == YIELD && newline_before && !newline_allowed_after_yield(mapped, is_eof)) {
+            yyerror(ctx, "LineTerminator not allowed after 'yield'");
         }
 
-        if (should_insert_semicolon(g_last_token, g_last_token_closed_control, g_last_token_closed_function, g_last_token_closed_paren, mapped, newline_before, is_eof, next_starts_function_literal)) {
-            pending_push(mapped, &semantic, has_semantic, false);
-            update_token_state(';');
-            memset(&yylval, 0, sizeof(yylval));
+        if (should_insert_semicolon(lx, lx->last_token, lx->last_token_closed_control, lx->last_token_closed_function, lx->last_token_closed_paren, mapped, newline_before, is_eof, next_starts_function_literal)) {
+            pending_push(lx, mapped, &semantic, has_semantic, false);
+            update_token_state(lx, ';');
+            memset(lvalp, 0, sizeof(*lvalp));
             return ';';
         }
 
         if (mapped == ARROW && newline_before) {
-            yyerror("LineTerminator not allowed before '=>'");
+            yyerror(ctx, "LineTerminator not allowed before '=>'");
         }
 
         if (has_semantic) {
-            yylval = semantic;
+            *lvalp = semantic;
         } else {
-            memset(&yylval, 0, sizeof(yylval));
+            memset(lvalp, 0, sizeof(*lvalp));
         }
 
         if (mapped != ARROW_HEAD) {
-            update_token_state(mapped);
+            update_token_state(lx, mapped);
         }
         return mapped;
     }
 }
 
-int parser_had_lex_error(void) {
-    return g_lex_error ? 1 : 0;
+bool parser_had_lex_error(const JSParser *ctx) {
+    return ctx->lex && ctx->lex->lex_error;
 }
 
 // bison 的错误回调在 parser.y 中实现，这里不重复实现
@@ -5,48 +5,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
-
-// bison 生成的解析函数
-int yyparse(void);
-extern int yydebug;
-
-// 适配层提供：设置输入缓冲区及词法错误查询
-void parser_set_input(const char *input);
-int parser_had_lex_error(void);
+#include <stdbool.h>
 
 #include "ast.h"
-#include "diagnostics.h"
-
-ASTNode *parser_take_ast(void);
-void parser_reset_error_count(void);
-int parser_error_count(void);
-void parser_set_module_mode(int enabled);
-
-static char *read_file(const char *filename) {
-    FILE *file = fopen(filename, "rb");
-    if (!file) {
-        fprintf(stderr, "Error: Cannot open file '%s'\n", filename);
-        return NULL;
-    }
-    fseek(file, 0, SEEK_END);
-    long size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    // 追加换行符确保词法分析正确退出
-    char *content = (char *)malloc(size + 2);
-    if (!content) {
-        fprintf(stderr, "Error: Memory allocation failed\n");
-        fclose(file);
-        return NULL;
-    }
-
-    size_t n = fread(content, 1, size, file);
-    content[n] = '\n';
-    content[n + 1] = '\0';
-
-    fclose(file);
-    return content;
-}
+#include "js_parser.h"
+#include "source_file.h"
 
 static int equals_ignore_case(const char *a, const char *b) {
     while (*a && *b) {
@@ -72,10 +35,47 @@ static int has_js_extension(const char *filename) {
     return 0;
 }
 
+// 流式窗口（JS_LEXER_WINDOW）与并行预分词段大小（JS_LEXER_CHUNK），未设置时为 0 表示默认值
+static size_t env_size(const char *name) {
+    const char *env = getenv(name);
+    return env ? (size_t)strtoul(env, NULL, 10) : 0;
+}
+
+// --push：按 JS_PUSH_CHUNK 字节（默认 4 KB）分块读取并推送给解析器，解析提前结束时不再读取
+static bool parse_pushed(JSParser *parser, FILE *file, const JSParseOptions *options, JSParseResult *result) {
+    if (!js_parser_begin(parser, options)) {
+        memset(result, 0, sizeof(*result));
+        return false;
+    }
+    size_t chunk = env_size("JS_PUSH_CHUNK");
+    if (chunk == 0) {
+        chunk = 4096;
+    }
+    char *buffer = (char *)malloc(chunk);
+    size_t n;
+    while (buffer && (n = fread(buffer, 1, chunk, file)) > 0) {
+        if (!js_parser_feed(parser, buffer, n)) {
+            break;
+        }
+    }
+    free(buffer);
+    return js_parser_finish(parser, result);
+}
+
 int main(int argc, char **argv) {
     int dump_ast = 0;
     const char *filename = NULL;
     int module_mode = 1;
+    int stream_mode = 0;
+    int push_mode = 0;
+    int pretokenize = 0;
+    int lex_threads = 0;
+    int lex_pipeline = 0;
+    int glr_only = 0;
+    int validate_only = 0;
+    int fast_stats = 0;
+    int glr_stats = 0;
+    const char *glr_trace_path = NULL;
 
     for (int i = 1; i < argc; ++i) {
         if (strcmp(argv[i], "--dump-ast") == 0) {
@@ -84,71 +84,176 @@ int main(int argc, char **argv) {
             module_mode = 1;
         } else if (strcmp(argv[i], "--script") == 0) {
             module_mode = 0;
+        } else if (strcmp(argv[i], "--stream") == 0) {
+            stream_mode = 1;
+        } else if (strcmp(argv[i], "--push") == 0) {
+            // 分块推送（js_parser_feed），与 --stream 一样不需要整个文件
+            stream_mode = 1;
+            push_mode = 1;
+        } else if (strcmp(argv[i], "--pretokenize") == 0) {
+            pretokenize = 1;
+        } else if (strcmp(argv[i], "--lex-threads") == 0 && i + 1 < argc) {
+            // 并行预分词，隐含 --pretokenize
+            lex_threads = atoi(argv[++i]);
+            pretokenize = 1;
+        } else if (strcmp(argv[i], "--lex-pipeline") == 0) {
+            lex_pipeline = 1;
+        } else if (strcmp(argv[i], "--glr-only") == 0) {
+            // 关闭确定性快速路径，用于对照 AST 与耗时
+            glr_only = 1;
+        } else if (strcmp(argv[i], "--validate-only") == 0) {
+            // 只检查语法，不构建 AST：成败与错误信息同完整解析
+            validate_only = 1;
+        } else if (strcmp(argv[i], "--fast-stats") == 0) {
+            fast_stats = 1;
+        } else if (strcmp(argv[i], "--glr-stats") == 0) {
+            // GLR 计数器以单行 JSON 输出到 stderr
+            glr_stats = 1;
+        } else if (strcmp(argv[i], "--glr-trace") == 0 && i + 1 < argc) {
+            // 二进制事件轨迹（格式见 glr_stats.h）
+            glr_trace_path = argv[++i];
         } else if (!filename) {
             filename = argv[i];
         } else {
             fprintf(stderr, "Unknown argument: %s\n", argv[i]);
-            fprintf(stderr, "Usage: %s [--dump-ast] [--module|--script] <javascript_file>\n", argv[0]);
+            fprintf(stderr, "Usage: %s [--dump-ast] [--module|--script] [--stream|--push|--pretokenize|--lex-pipeline] [--lex-threads N] [--glr-only] [--validate-only] [--fast-stats] [--glr-stats] [--glr-trace FILE] <javascript_file|->\n", argv[0]);
             return 1;
         }
     }
 
     if (!filename) {
         printf("JavaScript Parser - Syntax Checker\n");
-        printf("Usage: %s [--dump-ast] [--module|--script] <javascript_file>\n", argv[0]);
+        printf("Usage: %s [--dump-ast] [--module|--script] [--stream|--push|--pretokenize|--lex-pipeline] [--lex-threads N] [--glr-only] [--validate-only] [--fast-stats] [--glr-stats] [--glr-trace FILE] <javascript_file|->\n", argv[0]);
         return 1;
     }
 
-    char *input = read_file(filename);
-    if (!input) return 1;
+    // "-" 表示从标准输入流式读取
+    int from_stdin = (strcmp(filename, "-") == 0);
+    if (from_stdin) {
+        stream_mode = 1;
+    }
 
-    diag_reset();
-    diag_set_current_file(filename);
-    const char *log_path = getenv("JS_PARSER_ERROR_LOG");
-    diag_set_error_log_path(log_path);
+    SourceFile source = {0};
+    FILE *stream_file = NULL;
+    if (stream_mode) {
+        stream_file = from_stdin ? stdin : fopen(filename, "rb");
+        if (!stream_file) {
+            fprintf(stderr, "Error: Cannot open file '%s'\n", filename);
+            return 1;
+        }
+    } else {
+        // 追加换行符确保词法分析正确退出
+        if (!source_file_load(&source, filename, true)) return 1;
+    }
 
-    parser_reset_error_count();
-    parser_set_module_mode(module_mode);
-    parser_set_input(input);
+    JSParseOptions options;
+    js_parse_options_init(&options);
+    options.module_mode = module_mode != 0;
+    // 预分词与流水线切分只支持整块输入，流式模式下忽略
+    options.pretokenize = pretokenize != 0;
+    options.lex_threads = lex_threads;
+    options.lex_pipeline = lex_pipeline != 0;
+    options.glr_only = glr_only != 0;
+    options.validate_only = validate_only != 0;
+    if (validate_only && dump_ast) {
+        fprintf(stderr, "[WARN] --dump-ast ignored: --validate-only builds no AST.\n");
+    }
+    options.lex_chunk_size = env_size("JS_LEXER_CHUNK");
+    options.stream_window = env_size("JS_LEXER_WINDOW");
+    options.input_terminated = true;
+    options.print_errors = true;
+    options.filename = filename;
+    options.error_log_path = getenv("JS_PARSER_ERROR_LOG");
     if (getenv("JS_PARSER_TRACE")) {
-        yydebug = 1;
+        // 跟踪输出来自 GLR 解析器，整个输入都交给它才能得到完整的跟踪
+        if (glr_trace_enable_text()) {
+            options.glr_only = true;
+        } else {
+            fprintf(stderr, "[WARN] JS_PARSER_TRACE ignored: built without YYDEBUG (RELEASE=1).\n");
+        }
     }
+    FILE *glr_trace = NULL;
+    if (glr_stats || glr_trace_path) {
+        if (!glr_stats_available()) {
+            fprintf(stderr, "[WARN] --glr-stats/--glr-trace ignored: built with GLR_STATS=0.\n");
+        } else {
+            // 与 JS_PARSER_TRACE 相同：快速路径不经过 GLR，整个输入交给 GLR 才能统计到每一个 token
+            options.glr_only = true;
+            if (glr_trace_path) {
+                glr_trace = fopen(glr_trace_path, "wb");
+                if (!glr_trace) {
+                    fprintf(stderr, "Error: Cannot open file '%s'\n", glr_trace_path);
+                    return 1;
+                }
+            }
+        }
+    }
+    options.glr_stats = glr_stats != 0;
+    options.glr_trace = glr_trace;
 
+    JSParser *parser = js_parser_new();
+    if (!parser) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    JSParseResult result;
+    bool ok;
+    if (push_mode) {
+        ok = parse_pushed(parser, stream_file, &options, &result);
+    } else if (stream_mode) {
+        ok = js_parse_stream(parser, stream_file, &options, &result);
+    } else {
+        // source.data[source.length] 是追加的换行，其后为 NUL
+        ok = js_parse_buffer(parser, source.data, source.length + 1, &options, &result);
+    }
+    js_parser_free(parser);
+    if (glr_trace) {
+        fclose(glr_trace);
+    }
+    if (!ok && !result.atoms) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    source_file_release(&source);
+    if (stream_file) {
+        if (!from_stdin) {
+            fclose(stream_file);
+        }
+    }
 
-    int rc = yyparse();
-    ASTNode *root = parser_take_ast();
-    int error_count = parser_error_count();
-    int lex_error = parser_had_lex_error();
-
-    if (lex_error)
-    {
-        error_count += lex_error;
+    if (fast_stats) {
+        size_t statements = result.fast_statements + result.glr_statements;
+        fprintf(stderr, "[FAST] %s - %zu top-level segments, %zu fast path, %zu GLR (%.1f%% fast)\n",
+                filename, statements, result.fast_statements, result.glr_statements,
+                statements ? 100.0 * (double)result.fast_statements / (double)statements : 0.0);
     }
 
-    free(input);
+    if (glr_stats && result.glr_stats) {
+        glr_stats_write_json(result.glr_stats, stderr);
+    }
 
-    int has_valid_ext = has_js_extension(filename);
+    int has_valid_ext = from_stdin || has_js_extension(filename);
 
-    if (rc == 0 && error_count == 0) {
-        if (dump_ast && root) {
+    if (ok) {
+        if (dump_ast && result.ast) {
             printf("=== AST Dump ===\n");
-            ast_print(root);
+            ast_print(result.ast);
         }
         if (!has_valid_ext) {
             fprintf(stderr, "[WARN] %s - content parsed but file extension is not JS. Only .js/.mjs/.cjs are supported.\n", filename);
         }
         printf("[PASS] %s - no syntax errors detected.\n", filename);
-        ast_free(root);
+        js_parse_result_free(&result);
         return 0;
     }
 
     fprintf(stderr, "[FAIL] %s - %d syntax error%s detected. See messages above.\n",
             filename,
-            error_count,
-            error_count == 1 ? "" : "s");
+            result.error_count,
+            result.error_count == 1 ? "" : "s");
     if (!has_valid_ext) {
         fprintf(stderr, "[HINT] %s - unsupported file type (expected .js/.mjs/.cjs).\n", filename);
     }
-    ast_free(root);
+    js_parse_result_free(&result);
     return 2;
 }
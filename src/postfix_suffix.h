@@ -18,12 +18,12 @@ struct PostfixSuffix
     PostfixSuffixKind kind;
     union
     {
-        char *property_name;
+        const char *property_name;
         ASTNode *computed_expr;
         ASTList *arguments;
         ASTNode *template_literal;
     } data;
-    PostfixSuffix *next;
+    PostfixSuffix *next;    // 环形链表：语义值指向最后一项，最后一项的 next 指回第一项
 };
 
 #endif /* POSTFIX_SUFFIX_H */
@@ -0,0 +1,210 @@
+// 词法器批量扫描内核：在字符串体、模板片段、注释、空白和行索引扫描中一次跳过 16/32 字节
+// x86 + GCC/Clang 下提供 SSE2/AVX2 版本并在运行时选择，其余情况使用标量实现
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "scan.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SCAN_HAVE_X86 1
+#include <immintrin.h>
+#endif
+
+#define STOP_COUNT 5
+
+// 停止字节集合；不足 STOP_COUNT 个时重复填充，SIMD 版本固定比较 STOP_COUNT 次
+typedef struct {
+    unsigned char b[STOP_COUNT];
+} StopSet;
+
+typedef struct {
+    const char *name;
+    const char *(*find_any)(const char *p, const char *end, const StopSet *set);
+    const char *(*skip_any)(const char *p, const char *end, const StopSet *set);
+} ScanKernels;
+
+static int stop_hit(const StopSet *set, unsigned char c) {
+    for (int i = 0; i < STOP_COUNT; i++) {
+        if (set->b[i] == c) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static const char *find_any_scalar(const char *p, const char *end, const StopSet *set) {
+    while (p < end && !stop_hit(set, (unsigned char)*p)) {
+        p++;
+    }
+    return p;
+}
+
+static const char *skip_any_scalar(const char *p, const char *end, const StopSet *set) {
+    while (p < end && stop_hit(set, (unsigned char)*p)) {
+        p++;
+    }
+    return p;
+}
+
+static const ScanKernels g_scalar_kernels = {
+    "scalar", find_any_scalar, skip_any_scalar
+};
+
+#ifdef SCAN_HAVE_X86
+
+__attribute__((target("sse2")))
+static int stop_mask_sse2(__m128i x, const __m128i *v) {
+    __m128i m = _mm_cmpeq_epi8(x, v[0]);
+    for (int i = 1; i < STOP_COUNT; i++) {
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(x, v[i]));
+    }
+    return _mm_movemask_epi8(m);
+}
+
+__attribute__((target("sse2")))
+static const char *find_any_sse2(const char *p, const char *end, const StopSet *set) {
+    __m128i v[STOP_COUNT];
+    for (int i = 0; i < STOP_COUNT; i++) {
+        v[i] = _mm_set1_epi8((char)set->b[i]);
+    }
+    while (end - p >= 16) {
+        int mask = stop_mask_sse2(_mm_loadu_si128((const __m128i *)p), v);
+        if (mask) {
+            return p + __builtin_ctz((unsigned)mask);
+        }
+        p += 16;
+    }
+    return find_any_scalar(p, end, set);
+}
+
+__attribute__((target("sse2")))
+static const char *skip_any_sse2(const char *p, const char *end, const StopSet *set) {
+    __m128i v[STOP_COUNT];
+    for (int i = 0; i < STOP_COUNT; i++) {
+        v[i] = _mm_set1_epi8((char)set->b[i]);
+    }
+    while (end - p >= 16) {
+        unsigned mask = ~(unsigned)stop_mask_sse2(_mm_loadu_si128((const __m128i *)p), v) & 0xFFFFu;
+        if (mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+    return skip_any_scalar(p, end, set);
+}
+
+static const ScanKernels g_sse2_kernels = {
+    "sse2", find_any_sse2, skip_any_sse2
+};
+
+__attribute__((target("avx2")))
+static unsigned stop_mask_avx2(__m256i x, const __m256i *v) {
+    __m256i m = _mm256_cmpeq_epi8(x, v[0]);
+    for (int i = 1; i < STOP_COUNT; i++) {
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(x, v[i]));
+    }
+    return (unsigned)_mm256_movemask_epi8(m);
+}
+
+__attribute__((target("avx2")))
+static const char *find_any_avx2(const char *p, const char *end, const StopSet *set) {
+    __m256i v[STOP_COUNT];
+    for (int i = 0; i < STOP_COUNT; i++) {
+        v[i] = _mm256_set1_epi8((char)set->b[i]);
+    }
+    while (end - p >= 32) {
+        unsigned mask = stop_mask_avx2(_mm256_loadu_si256((const __m256i *)p), v);
+        if (mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 32;
+    }
+    return find_any_sse2(p, end, set);
+}
+
+__attribute__((target("avx2")))
+static const char *skip_any_avx2(const char *p, const char *end, const StopSet *set) {
+    __m256i v[STOP_COUNT];
+    for (int i = 0; i < STOP_COUNT; i++) {
+        v[i] = _mm256_set1_epi8((char)set->b[i]);
+    }
+    while (end - p >= 32) {
+        unsigned mask = ~stop_mask_avx2(_mm256_loadu_si256((const __m256i *)p), v);
+        if (mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 32;
+    }
+    return skip_any_sse2(p, end, set);
+}
+
+static const ScanKernels g_avx2_kernels = {
+    "avx2", find_any_avx2, skip_any_avx2
+};
+
+#endif // SCAN_HAVE_X86
+
+// 未调用 scan_init 时也能正确工作（标量）
+static const ScanKernels *g_kernels = &g_scalar_kernels;
+
+static void select_kernels(void) {
+    const char *forced = getenv("JS_LEXER_SIMD");
+    if (forced && strcmp(forced, "scalar") == 0) {
+        g_kernels = &g_scalar_kernels;
+        return;
+    }
+#ifdef SCAN_HAVE_X86
+    __builtin_cpu_init();
+    int has_sse2 = __builtin_cpu_supports("sse2");
+    int has_avx2 = __builtin_cpu_supports("avx2");
+    if (forced && strcmp(forced, "sse2") == 0) {
+        has_avx2 = 0;
+    }
+    if (has_avx2) {
+        g_kernels = &g_avx2_kernels;
+    } else if (has_sse2) {
+        g_kernels = &g_sse2_kernels;
+    }
+#endif
+}
+
+// 多个解析上下文可能在不同线程里同时初始化词法器，内核只选择一次
+void scan_init(void) {
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, select_kernels);
+}
+
+const char *scan_kernel_name(void) {
+    return g_kernels->name;
+}
+
+const char *scan_string_body(const char *p, const char *end, char quote) {
+    StopSet set = {{(unsigned char)quote, '\\', '\0', '\0', '\0'}};
+    return g_kernels->find_any(p, end, &set);
+}
+
+const char *scan_template_body(const char *p, const char *end) {
+    static const StopSet set = {{'`', '\\', '$', '\0', '\0'}};
+    return g_kernels->find_any(p, end, &set);
+}
+
+const char *scan_comment_body(const char *p, const char *end) {
+    static const StopSet set = {{'*', '\0', '\0', '\0', '\0'}};
+    return g_kernels->find_any(p, end, &set);
+}
+
+const char *scan_line_body(const char *p, const char *end) {
+    static const StopSet set = {{'\n', '\0', '\0', '\0', '\0'}};
+    return g_kernels->find_any(p, end, &set);
+}
+
+const char *scan_skip_blank(const char *p, const char *end) {
+    static const StopSet set = {{' ', '\t', '\r', ' ', ' '}};
+    return g_kernels->skip_any(p, end, &set);
+}
+
+const char *scan_next_newline(const char *p, const char *end) {
+    static const StopSet set = {{'\n', '\n', '\n', '\n', '\n'}};
+    return g_kernels->find_any(p, end, &set);
+}
@@ -0,0 +1,26 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stddef.h>
+
+// 词法器热点循环使用的批量扫描内核（SSE2/AVX2，运行时选择，其他平台走标量实现）
+// 所有函数只读取 [p, end) 范围，找不到目标时返回 end
+
+// 选择内核；JS_LEXER_SIMD=scalar|sse2|avx2 可强制指定（用于测试与对比）
+void scan_init(void);
+const char *scan_kernel_name(void);
+
+// 字符串体：返回第一个 quote / '\\' / '\0'
+const char *scan_string_body(const char *p, const char *end, char quote);
+// 模板片段：返回第一个 '`' / '\\' / '$' / '\0'
+const char *scan_template_body(const char *p, const char *end);
+// 块注释体：返回第一个 '*' / '\0'
+const char *scan_comment_body(const char *p, const char *end);
+// 单行注释体：返回第一个 '\n' / '\0'
+const char *scan_line_body(const char *p, const char *end);
+// 空白：返回第一个不是 ' ' / '\t' / '\r' 的字节
+const char *scan_skip_blank(const char *p, const char *end);
+// 换行：返回第一个 '\n'（行索引与块注释使用）
+const char *scan_next_newline(const char *p, const char *end);
+
+#endif // SCAN_H
@@ -0,0 +1,135 @@
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // MAP_ANONYMOUS、fileno
+#endif
+#include "source_file.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// 读取路径的初始缓冲区（大小未知的管道等）
+#define SOURCE_READ_CHUNK (64 * 1024)
+
+static bool mmap_enabled(void) {
+    const char *env = getenv("JS_INPUT_MMAP");
+    return !env || strcmp(env, "0") != 0;
+}
+
+#ifndef _WIN32
+// 先保留 size + 2 字节（按页取整）的匿名零页，再把文件 MAP_FIXED 映射到开头：
+// 文件最后一页 EOF 之后的部分由内核补零，整页对齐时后面紧跟的匿名页也是零，
+// 所以 NUL 哨兵不需要写入；只有追加换行时才会写脏（私有复制）最后一页
+static bool map_source(SourceFile *file, int fd, size_t size, bool append_newline) {
+    long page = sysconf(_SC_PAGESIZE);
+    if (page <= 0 || size > SIZE_MAX - 2 - (size_t)page) {
+        return false;
+    }
+    size_t total = (size + 2 + (size_t)page - 1) / (size_t)page * (size_t)page;
+    void *base = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    void *mapped = mmap(base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        munmap(base, total);
+        return false;
+    }
+    posix_madvise(base, size, POSIX_MADV_SEQUENTIAL);
+    file->data = (char *)base;
+    file->length = size;
+    file->map_length = total;
+    if (append_newline) {
+        file->data[size] = '\n';
+    }
+    return true;
+}
+#endif
+
+// 逐块读取到 malloc 的缓冲区；hint 为已知的文件大小（未知时为 0）
+static bool read_source(SourceFile *file, FILE *stream, size_t hint, bool append_newline) {
+    size_t capacity = hint > 0 && hint <= SIZE_MAX - 2 ? hint + 2 : SOURCE_READ_CHUNK;
+    char *buffer = (char *)malloc(capacity);
+    if (!buffer) {
+        return false;
+    }
+    size_t length = 0;
+    for (;;) {
+        if (capacity - length < 2) {
+            if (capacity > SIZE_MAX / 2) {
+                free(buffer);
+                return false;
+            }
+            char *grown = (char *)realloc(buffer, capacity * 2);
+            if (!grown) {
+                free(buffer);
+                return false;
+            }
+            buffer = grown;
+            capacity *= 2;
+        }
+        size_t n = fread(buffer + length, 1, capacity - length - 2, stream);
+        length += n;
+        if (n == 0) {
+            break;
+        }
+    }
+    if (append_newline) {
+        buffer[length++] = '\n';
+    }
+    buffer[length] = '\0';
+    file->data = buffer;
+    file->length = append_newline ? length - 1 : length;
+    file->map_length = 0;
+    return true;
+}
+
+bool source_file_load(SourceFile *file, const char *filename, bool append_newline) {
+    memset(file, 0, sizeof(*file));
+    FILE *stream = fopen(filename, "rb");
+    if (!stream) {
+        fprintf(stderr, "Error: Cannot open file '%s'\n", filename);
+        return false;
+    }
+
+    size_t hint = 0;
+    bool ok = false;
+#ifndef _WIN32
+    struct stat st;
+    // 空文件无法映射，直接走读取路径
+    if (fstat(fileno(stream), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0
+        && (unsigned long long)st.st_size < SIZE_MAX) {
+        hint = (size_t)st.st_size;
+        ok = mmap_enabled() && map_source(file, fileno(stream), hint, append_newline);
+    }
+#endif
+    if (!ok) {
+        ok = read_source(file, stream, hint, append_newline);
+        if (!ok) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+        }
+    }
+    fclose(stream);
+    return ok;
+}
+
+void source_file_release(SourceFile *file) {
+    if (!file->data) {
+        return;
+    }
+#ifndef _WIN32
+    if (file->map_length) {
+        munmap(file->data, file->map_length);
+    } else
+#endif
+    {
+        free(file->data);
+    }
+    memset(file, 0, sizeof(*file));
+}
@@ -0,0 +1,20 @@
+#ifndef SOURCE_FILE_H
+#define SOURCE_FILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// 整文件输入：普通文件优先 mmap，不复制文件内容；管道、设备或 mmap 失败时退回逐块读取。
+// data[length] 起依次是可选的 '\n' 和 '\0'（词法分析器以 NUL 作为结束哨兵）
+typedef struct
+{
+    char *data;
+    size_t length;      // 文件字节数，不含追加的换行与 NUL
+    size_t map_length;  // 非 0 表示 data 来自 mmap，释放时 munmap
+} SourceFile;
+
+// 失败时已向 stderr 输出原因；JS_INPUT_MMAP=0 强制走读取路径（用于对比）
+bool source_file_load(SourceFile *file, const char *filename, bool append_newline);
+void source_file_release(SourceFile *file);
+
+#endif // SOURCE_FILE_H
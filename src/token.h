@@ -2,126 +2,29 @@
 #define TOKEN_H
 
 #include <stdbool.h>
-
-// Token 类型枚举
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// token 属性位（tokens.def 中使用），查表见 token_has_attr
+#define TOKATTR_END_STMT      0x01
+#define TOKATTR_RESTRICTED    0x02
+#define TOKATTR_CONTROL       0x04
+#define TOKATTR_AS_IDENTIFIER 0x08
+#define TOKATTR_MODULE_ONLY   0x10
+#define TOKATTR_TEXT          0x20
+
+// Token 类型枚举：由 tokens.def 展开，值即 Bison 的 token 编码。
+// 先列有名字的 token（从 258 顺序编号，与 gen_tokens 生成的 %token 编码一致），再列编码固定的 token。
 typedef enum
 {
-    // 关键字
-    TOK_VAR,
-    TOK_LET,
-    TOK_CONST,
-    TOK_FUNCTION,
-    TOK_IF,
-    TOK_ELSE,
-    TOK_FOR,
-    TOK_WHILE,
-    TOK_DO,
-    TOK_RETURN,
-    TOK_BREAK,
-    TOK_CONTINUE,
-    TOK_SWITCH,
-    TOK_CASE,
-    TOK_DEFAULT,
-    TOK_TRY,
-    TOK_CATCH,
-    TOK_FINALLY,
-    TOK_THROW,
-    TOK_NEW,
-    TOK_THIS,
-    TOK_TYPEOF,
-    TOK_DELETE,
-    TOK_IN,
-    TOK_INSTANCEOF,
-    TOK_VOID,
-    TOK_WITH,
-    TOK_DEBUGGER,
-    TOK_CLASS,
-    TOK_EXTENDS,
-    TOK_SUPER,
-    TOK_IMPORT,
-    TOK_EXPORT,
-    TOK_YIELD,
-    TOK_ASYNC,
-    TOK_AWAIT,
-
-    // 字面量
-    TOK_TRUE,
-    TOK_FALSE,
-    TOK_NULL,
-    TOK_UNDEFINED,
-    TOK_NUMBER,
-    TOK_STRING,
-    TOK_REGEX,
-    TOK_IDENTIFIER,
-    TOK_TEMPLATE_NO_SUB,
-    TOK_TEMPLATE_HEAD,
-    TOK_TEMPLATE_MIDDLE,
-    TOK_TEMPLATE_TAIL,
-
-    // 运算符
-    TOK_PLUS,        // +
-    TOK_MINUS,       // -
-    TOK_STAR,        // *
-    TOK_SLASH,       // /
-    TOK_PERCENT,     // %
-    TOK_PLUS_PLUS,   // ++
-    TOK_MINUS_MINUS, // --
-
-    TOK_ASSIGN,         // =
-    TOK_PLUS_ASSIGN,    // +=
-    TOK_MINUS_ASSIGN,   // -=
-    TOK_STAR_ASSIGN,    // *=
-    TOK_SLASH_ASSIGN,   // /=
-    TOK_PERCENT_ASSIGN, // %=
-
-    TOK_EQ,        // ==
-    TOK_NE,        // !=
-    TOK_EQ_STRICT, // ===
-    TOK_NE_STRICT, // !==
-    TOK_ARROW,     // =>
-    TOK_ELLIPSIS,  // ...
-    TOK_LT,        // <
-    TOK_LE,        // <=
-    TOK_GT,        // >
-    TOK_GE,        // >=
-
-    TOK_AND, // &&
-    TOK_OR,  // ||
-    TOK_NOT, // !
-
-    TOK_BIT_AND, // &
-    TOK_BIT_OR,  // |
-    TOK_BIT_XOR, // ^
-    TOK_BIT_NOT, // ~
-    TOK_LSHIFT,  // <<
-    TOK_RSHIFT,  // >>
-    TOK_URSHIFT, // >>>
-
-    TOK_AND_ASSIGN,     // &=
-    TOK_OR_ASSIGN,      // |=
-    TOK_XOR_ASSIGN,     // ^=
-    TOK_LSHIFT_ASSIGN,  // <<=
-    TOK_RSHIFT_ASSIGN,  // >>=
-    TOK_URSHIFT_ASSIGN, // >>>=
-
-    TOK_QUESTION, // ?
-    TOK_COLON,    // :
-
-    // 分隔符
-    TOK_LPAREN,    // (
-    TOK_RPAREN,    // )
-    TOK_LBRACE,    // {
-    TOK_RBRACE,    // }
-    TOK_LBRACKET,  // [
-    TOK_RBRACKET,  // ]
-    TOK_SEMICOLON, // ;
-    TOK_COMMA,     // ,
-    TOK_DOT,       // .
-
-    // 特殊 token
-    TOK_EOF,
-    TOK_ERROR,
-    TOK_NEWLINE // 用于 ASI 机制
+    TOK_NAMED_BASE_ = 257, // Bison 保留 256(error)/257(undef)
+#define TOKEN(name, bison, type, display, attrs) TOK_##name,
+#define LEX_TOKEN(name, display, attrs) TOK_##name,
+#include "tokens.def"
+    TOKEN_CODE_LIMIT, // 不是 token：编码上界，用于属性表大小
+#define FIXED_TOKEN(name, code, display, attrs) TOK_##name = (code),
+#include "tokens.def"
 } TokenType;
 
 // 记录前一个Token类型
@@ -131,34 +34,130 @@ typedef enum
     PREV_TOK_NO_REGEX   // 前一个Token不允许后续跟正则（数字/字符串/正则等）
 } PrevTokenState;
 
-// Token 结构体
+// Token 结构体：token 文本是输入缓冲区中的 (offset, length) 视图，不单独分配；
+// 行列号不随 token 记录，需要时用 lexer_position 按偏移计算
 typedef struct
 {
     TokenType type;
-    char *value; // token 的字符串值（对于标识符、数字、字符串）
-    int line;    // 行号
-    int column;  // 列号
+    size_t offset; // token 文本在整个输入中的字节偏移（流式模式下是绝对偏移）
+    size_t length; // token 文本长度（标识符、数字、字符串等）
 } Token;
 
+// 流式输入的数据来源：把至多 size 字节读入 buffer，返回读到的字节数，0 表示输入结束。
+// 可以阻塞等待数据（推送式解析时由 js_parser_feed 供给）
+typedef size_t (*LexerReadFn)(void *source, char *buffer, size_t size);
+
+// 流式输入源：通过 YYFILL 按固定窗口从 read 中补充数据，常驻内存与文件大小无关
+typedef struct
+{
+    LexerReadFn read;
+    void *source;
+    char *buffer;         // 窗口缓冲区（lexer->input 指向这里）
+    size_t capacity;      // 窗口容量，只有单个 token 超过窗口时才扩容
+    bool eof;             // 已读到文件末尾并补齐 YYMAXFILL 个 NUL
+    bool append_newline;  // 到达末尾时补一个 '\n'（与 js_parser 读整文件时的行为一致）
+    bool pinned;          // 前瞻期间固定 pin_offset 之后的数据，不允许被滑出窗口
+    size_t pin_offset;
+} LexerStream;
+
+// 行起点索引：只在查询位置时按需扫描换行，starts[i] 为第 first_line + i 行的起始偏移
+typedef struct
+{
+    size_t *starts;
+    size_t count;
+    size_t capacity;
+    int first_line;
+    size_t scanned; // [0, scanned) 内的换行已记录
+} LineIndex;
+
 // 词法分析器状态
 typedef struct
 {
-    const char *input;             // 输入字符串
+    const char *input;             // 输入字符串（流式模式下为当前窗口起点）
     const char *cursor;            // 当前位置
     const char *marker;            // re2c 使用的标记
-    int line;                      // 当前行号
-    int column;                    // 当前列号
+    const char *limit;             // 有效数据末尾（YYLIMIT）
+    const char *token;             // 当前 token 起点，窗口滑动时保留其后的数据
+    size_t base_offset;            // input[0] 在整个输入中的偏移
+    LexerStream *stream;           // 非 NULL 表示流式输入
+    LineIndex lines;               // 惰性行索引（流式模式下只保留窗口内的行）
     bool has_newline;              // 自上次 token 以来是否有换行（用于 ASI）
     PrevTokenState prev_tok_state; // 前Token状态
     bool in_template_expression;
     int template_expr_depth;
     int template_nesting_depth;
+    bool quiet;                    // 不输出诊断（并行推测切分时使用）
 } Lexer;
 
+// 前瞻检查点：保存词法状态并固定窗口，恢复后从保存位置继续扫描
+typedef struct
+{
+    Lexer state;
+    size_t cursor_offset;
+} LexerCheckpoint;
+
+// 预分词缓冲区（结构体数组拆成按字段的数组），供 js_parser --pretokenize 使用
+#define TOKBUF_NEWLINE_BEFORE 0x01 // token 之前有换行（ASI）
+
+typedef struct
+{
+    uint16_t *types;   // TokenType（Bison 编码，超出 8 位）
+    uint8_t *flags;    // TOKBUF_*
+    uint32_t *offsets; // token 文本在输入中的偏移
+    uint32_t *lengths;
+    size_t count;
+    size_t capacity;
+} TokenBuffer;
+
 // 函数声明
 void lexer_init(Lexer *lexer, const char *input);
+void lexer_init_at(Lexer *lexer, const char *input, size_t length, size_t offset);
+bool lexer_init_stream(Lexer *lexer, LexerStream *stream, FILE *file, size_t window_size, bool append_newline);
+bool lexer_init_stream_reader(Lexer *lexer, LexerStream *stream, LexerReadFn read, void *source,
+                              size_t window_size, bool append_newline);
+void lexer_stream_free(LexerStream *stream);
+void lexer_save(Lexer *lexer, LexerCheckpoint *checkpoint);
+void lexer_restore(Lexer *lexer, const LexerCheckpoint *checkpoint);
+void lexer_dispose(Lexer *lexer);
+void lexer_position(Lexer *lexer, size_t offset, int *line, int *column);
 Token lexer_next_token(Lexer *lexer);
-void token_free(Token *token);
+bool token_buffer_fill(TokenBuffer *buffer, Lexer *lexer);
+bool token_buffer_push(TokenBuffer *buffer, const Token *token, bool newline_before);
+// 并行预分词（lexer_parallel.c）：结果与 token_buffer_fill 逐个 token 相同
+bool token_buffer_fill_parallel(TokenBuffer *buffer, Lexer *lexer, int threads, size_t chunk_size);
+void token_buffer_free(TokenBuffer *buffer);
+
+// 箭头参数过滤（lexer_pipeline.c）：逐个喂入某个 '(' 内同层的 token（不含闭合它的 ')'，
+// 内层括号里的 token 不喂），返回 false 表示括号内容不可能是箭头函数的参数列表
+typedef struct
+{
+    uint8_t state;
+    uint32_t depth; // 嵌套的 {} / [] 层数
+} ArrowParamFilter;
+
+void arrow_params_init(ArrowParamFilter *filter);
+bool arrow_params_step(ArrowParamFilter *filter, TokenType type);
+bool arrow_params_possible(const ArrowParamFilter *filter);
+
+// 流水线切分（lexer_pipeline.c）：生产者线程从 lexer 的当前位置切分整块输入（不支持流式），
+// 并求出每个 '(' 的 arrow_head / function_literal，经无锁单生产者/单消费者队列交给调用线程。
+// token_pipe_paren 查询最近一次 token_pipe_next 返回的 '('，结果未出时等待生产者
+typedef struct TokenPipe TokenPipe;
+
+TokenPipe *token_pipe_start(const Lexer *lexer);
+Token token_pipe_next(TokenPipe *pipe, bool *newline_before);
+void token_pipe_paren(TokenPipe *pipe, bool *arrow_head, bool *function_literal);
+void token_pipe_stop(TokenPipe *pipe);
+Token token_buffer_get(const TokenBuffer *buffer, size_t index);
+const char *token_text(const Lexer *lexer, const Token *token);
+char *token_dup_value(const Lexer *lexer, const Token *token);
 const char *token_type_to_string(TokenType type);
 
+extern const uint8_t token_attr_table[TOKEN_CODE_LIMIT];
+
+// code 为 TokenType 或 Bison token 编码（两者相同）
+static inline bool token_has_attr(int code, unsigned attr) {
+    return code >= 0 && code < TOKEN_CODE_LIMIT && (token_attr_table[code] & attr) != 0;
+}
+
 #endif // TOKEN_H
@@ -0,0 +1,11 @@
+#ifndef UNICODE_ID_H
+#define UNICODE_ID_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// 非 ASCII 标识符字符判断（Unicode ID_Start / ID_Continue），表由 tmp/gen_unicode_id.py 生成
+bool unicode_is_id_start(uint32_t cp);
+bool unicode_is_id_continue(uint32_t cp);
+
+#endif // UNICODE_ID_H
@@ -0,0 +1,13 @@
+// Arrow parameter defaults may hold any expression: calls, functions, objects, arrays, nested arrows, parens.
+const withCall = (a = compute(1, 2), b = [fn(3)]) => a + b;
+const withFunction = (cb = function (x) { return (x); }, next = () => {}) => cb(next);
+const withObject = (options = { retries: (1 + 2), tags: ["a", (b)] }) => options.retries;
+const withPatterns = ({ a = (1), b: [c = f(), ...d] } = {}, [e = { g: (h) }] = []) => a + c + e;
+const withNested = (x = (y) => (z = y) => z, ...rest) => x(rest);
+const withTernary = (flag = a ? (b) : (c, d), last = `t${(1)}`) => flag;
+
+// Call arguments, IIFEs and arrows mixed together.
+register(name, function (value) { return value; }, (err, data = load(err)) => data);
+(function (exports) { exports.ok = ((v) => v)(true); })(module);
+(() => { run((a, b) => a - b); })();
+const grouped = ((a), (b, c)) + ((d) => d)(1);
@@ -0,0 +1,24 @@
+// 嵌套超过 64 层：状态栈原先容量固定，超出部分入栈被丢弃，之后的出栈错位，
+// 对象字面量的 '}' 前会被误插分号
+
+var config = {
+  handler: function () {
+    { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { { {
+    x = 1
+    } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } } }
+  },
+  retries: 3
+};
+
+var pick = c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? c ? 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : 0 : {
+  k: 1
+};
+
+if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (function () { if (x) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {} }) {
+  y = 2
+}
+
+var make = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = function (a = 1) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}) {}
+var after = {
+  ok: true
+}
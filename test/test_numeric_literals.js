@@ -0,0 +1,9 @@
+// 数字字面量：进制前缀、旧式八进制、分隔符、指数与 BigInt
+
+var ints = [0, 7, 42, 1_000_000, 089, 0777];
+var radix = [0x1F, 0xFF_FF, 0o17, 0O7_7, 0b1010, 0B1_0];
+var floats = [1.5, .25, 3., 1e3, 1E-3, 2.5e+10, 1_0.2_5e1_0, 0.000001234];
+var big = [10n, 0x1Fn, 0b11n, 0o7n, 123_456n, 0n];
+var huge = 123456789012345678901234567890 + 0xffffffffffffffffffff;
+var keys = { 1: "a", 0x10: "b", 1.5: "c", 2n: "d" };
+var member = 1..toString() + 0x10.toString();
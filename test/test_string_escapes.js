@@ -0,0 +1,9 @@
+// 字符串与模板中的各类转义（cooked 值由 ast_literal_cooked 惰性解码）
+var simple = "a\nb\tc\\d\"e" + '\x41B\u{43}';
+var astral = "\u{1F600}" + "😀" + "\uD83D";
+var octal = "\0\101\8\377";
+var cont = "line \
+continued";
+var tpl = `x\n${simple}\u{41}\`\${y}`;
+function tag(strings) { return strings.raw; }
+var invalid = tag`\unicode and \xZZ and \01`;
@@ -0,0 +1,23 @@
+// 非 ASCII 标识符与 Unicode 空白、行终止符
+
+var café = 1;
+let 变量 = café + 1;
+const πr = 3.14;
+var ǅemal = { naïve: 变量, ünïcödé: true };
+var abc = ǅemal.naïve;
+var mixed_名前$ = [café, 变量, abc];
+var ab‌c = abc;
+
+function größe(länge, breite) {
+  return länge * breite;
+}
+
+class Ärger {
+  méthode(ключ) {
+    return ключ;
+  }
+}
+
+var x = größe(2, 3);　
+var y = x var z = y;
+﻿var w = z;
@@ -0,0 +1,88 @@
+import json
+import os
+import subprocess
+import sys
+import time
+
+
+# 成员/调用链回归基准：生成 jQuery 风格的长链 $("#root").addClass(...).find(...)[2].css({...})...，
+# 分别计时默认模式与 --glr-only，并用 --glr-stats 取 GLR 栈分裂次数与同时存活的栈数峰值（为 1 即全程只有一个栈）。
+# 词法分析器单独计时作为参照；每个链节的耗时应基本不随链长增长。
+# 任一规模出现栈分裂、或每节耗时比最短的链高出 3 倍以上时返回 1。
+# 用法：python tmp/bench_chains.py [链节数 ...]（默认 1000 10000 100000）
+LINKS = [
+    '.addClass("c%d")',
+    '.find(".x%d")',
+    '[%d]',
+    '.css({width: %d, height: 2})',
+    '.on("click", function (e) { return e.target; })',
+    '.attr("k", v%d)',
+    '.eq(%d).parent()',
+    '.each((i, el) => el.id + %d)',
+    '.data[k%d]',
+    '.then(r => r.v%d)',
+    '.html(`<b>${x%d}</b>`)',
+    '.filter({ get a() { return 1; }, b() {}, c })',
+]
+
+
+def make_chain(path, count):
+    with open(path, "w", encoding="utf-8") as f:
+        f.write('$("#root")')
+        for i in range(count):
+            link = LINKS[i % len(LINKS)]
+            f.write("\n    " + (link % i if "%d" in link else link))
+        f.write(";\n")
+
+
+def timed(args, env=None):
+    start = time.perf_counter()
+    proc = subprocess.run(args, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, env=env)
+    return time.perf_counter() - start, proc.returncode
+
+
+# --glr-stats 在 stderr 上输出的单行 JSON；整个输入交给 GLR 才能统计到每一个 token
+def glr_stats(parser, path):
+    proc = subprocess.run([parser, "--glr-only", "--glr-stats", path], stdout=subprocess.DEVNULL,
+                          stderr=subprocess.PIPE, text=True, errors="replace")
+    for line in proc.stderr.split("\n"):
+        if line.startswith('{"parses"'):
+            return json.loads(line)
+    return {"splits": -1, "peak_stacks": 0}
+
+
+def main():
+    sizes = [int(arg) for arg in sys.argv[1:]] or [1000, 10000, 100000]
+    exe = ".exe" if os.name == "nt" else ""
+    parser = os.path.join(".", "js_parser" + exe)
+    lexer = os.path.join(".", "js_lexer" + exe)
+    os.makedirs(os.path.join("build", "bench"), exist_ok=True)
+
+    failed = False
+    total_splits = 0
+    peak_stacks = 0
+    per_link = []
+    print("%8s %10s %10s %10s %12s %7s %6s" % ("links", "lexer", "default", "glr-only", "us/link", "splits", "peak"))
+    for count in sizes:
+        path = os.path.join("build", "bench", "chain_%d.js" % count)
+        make_chain(path, count)
+        lex_time, _ = timed([lexer, path])
+        fast_time, rc_fast = timed([parser, path])
+        glr_time, rc_glr = timed([parser, "--glr-only", path])
+        stats = glr_stats(parser, path)
+        splits = stats["splits"]
+        peak_stacks = max(peak_stacks, stats["peak_stacks"])
+        per_link.append(glr_time / count)
+        print("%8d %9.3fs %9.3fs %9.3fs %12.2f %7d %6d" % (count, lex_time, fast_time, glr_time,
+                                                            1e6 * glr_time / count, splits, stats["peak_stacks"]))
+        if rc_fast != 0 or rc_glr != 0:
+            print("  parse failed (exit %d / %d)" % (rc_fast, rc_glr))
+            failed = True
+        total_splits += splits
+    growth = max(per_link) / min(per_link)
+    print("peak GLR stacks: %d, per-link time growth %.2fx" % (peak_stacks, growth))
+    return 1 if failed or total_splits or growth > 3.0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,58 @@
+import os
+import random
+import subprocess
+import sys
+import tempfile
+import time
+
+
+# 除法密集的压缩代码基准：生成单行、几乎全是 `/` 运算的 JS，分别用给定的 js_lexer 切分，
+# 观察耗时随文件大小的变化（除号若每次都先试探正则再回退、或对整个输入做 strlen，会随大小成倍变慢）
+# 用法：python tmp/bench_division.py [lexer ...]   默认对比 ./js_lexer
+SIZES_KB = [64, 256, 1024]
+
+
+def make_source(size):
+    rng = random.Random(size)
+    names = ["a", "b", "c", "d", "e", "f", "g", "h"]
+    parts = []
+    total = 0
+    i = 0
+    while total < size:
+        x, y, z, w = (rng.choice(names) for _ in range(4))
+        stmt = "v%d=%s/%s/(%s+1)*%d/%s/2;r%d=(%s/%s)/(%s/%s);" % (
+            i, x, y, z, rng.randint(1, 99), w, i, y, z, w, x)
+        parts.append(stmt)
+        total += len(stmt)
+        i += 1
+    return "".join(parts)
+
+
+def run(lexer, path):
+    start = time.perf_counter()
+    subprocess.run([lexer, "--bench", path, "1"], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return time.perf_counter() - start
+
+
+def main():
+    exe = ".exe" if os.name == "nt" else ""
+    lexers = sys.argv[1:] or [os.path.join(".", "js_lexer" + exe)]
+    with tempfile.TemporaryDirectory() as tmp:
+        files = []
+        for kb in SIZES_KB:
+            path = os.path.join(tmp, "div_%dk.js" % kb)
+            with open(path, "w") as f:
+                f.write(make_source(kb * 1024))
+            files.append((kb, path))
+        print("%-28s" % "lexer" + "".join("%12s" % ("%dKB" % kb) for kb, _ in files))
+        for lexer in lexers:
+            row = "%-28s" % lexer
+            for kb, path in files:
+                elapsed = run(lexer, path)
+                row += "%12s" % ("%.3fs" % elapsed)
+            print(row)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,75 @@
+import os
+import re
+import subprocess
+import sys
+import time
+
+
+# 确定性快速路径的效果：每个语料目录统计走快速路径的顶层语句比例，并对比 --glr-only 的耗时；
+# 同时逐个文件比较两种模式的 --dump-ast 输出（含诊断与退出码），任何差异都会列出。
+# 用法：python tmp/bench_fastpath.py [repeat] [dir ...]
+STATS_RE = re.compile(r"\[FAST\] .* - (\d+) top-level segments, (\d+) fast path, (\d+) GLR")
+
+
+def collect(root_dir):
+    files = []
+    for root, _, names in os.walk(root_dir):
+        for name in names:
+            if name.endswith(".js"):
+                files.append(os.path.join(root, name))
+    return sorted(files)
+
+
+def run_mode(parser, files, extra, repeat):
+    total = 0.0
+    for path in files:
+        for _ in range(repeat):
+            start = time.perf_counter()
+            subprocess.run([parser] + extra + [path], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+            total += time.perf_counter() - start
+    return total
+
+
+def dump(parser, path, extra):
+    proc = subprocess.run([parser, "--dump-ast"] + extra + [path], capture_output=True)
+    return proc.returncode, proc.stdout, proc.stderr
+
+
+def fast_counts(parser, files):
+    segments = fast = 0
+    for path in files:
+        proc = subprocess.run([parser, "--fast-stats", path], capture_output=True, text=True, errors="replace")
+        match = STATS_RE.search(proc.stderr)
+        if match:
+            segments += int(match.group(1))
+            fast += int(match.group(2))
+    return segments, fast
+
+
+def main():
+    repeat = int(sys.argv[1]) if len(sys.argv) > 1 else 5
+    dirs = sys.argv[2:] or ["test", "tmp"]
+    exe = ".exe" if os.name == "nt" else ""
+    parser = os.path.join(".", "js_parser" + exe)
+
+    mismatches = 0
+    for corpus in dirs:
+        files = collect(corpus)
+        if not files:
+            continue
+        for path in files:
+            if dump(parser, path, []) != dump(parser, path, ["--glr-only"]):
+                print("AST mismatch: %s" % path)
+                mismatches += 1
+        segments, fast = fast_counts(parser, files)
+        glr = run_mode(parser, files, ["--glr-only"], repeat)
+        mixed = run_mode(parser, files, [], repeat)
+        print("%-10s %4d files  %5d segments  fast %5.1f%%  glr-only %.3fs  fast path %.3fs  speedup %.2fx"
+              % (corpus, len(files), segments, 100.0 * fast / segments if segments else 0.0,
+                 glr, mixed, glr / mixed if mixed > 0 else 0.0))
+    print("AST mismatches: %d" % mismatches)
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
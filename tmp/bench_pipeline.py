@@ -0,0 +1,135 @@
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+
+# 流水线切分（--lex-pipeline）的校验与计时：
+#   1. test/、tmp/ 下每个文件以及生成的大 bundle，逐个对比拉取模式与流水线模式的退出码和 --dump-ast 输出（应逐字节相同）
+#   2. 在生成的 bundle 上分别计时 pull / --pretokenize / --lex-pipeline，取多次中的最小值
+# bundle 按打包器的常见形状生成：顶层的模块注册表，每个模块一个函数（构造函数、原型方法、箭头函数链、回调、模板字符串）
+# 用法：python tmp/bench_pipeline.py [模块数] [次数]   默认 1000 个模块（约 1.4 MB）、3 次，使用 ./js_parser
+MODULE = r'''  __modules[%(id)d] = function (module, exports, __require) {
+    "use strict";
+    var dep = __require(%(dep)d);
+    var config = { name: "module-%(id)d", retries: 3, tags: ["a", "b", "c"], nested: { on: true, ratio: 0.5 } };
+    function Widget(options) {
+      this.options = options || {};
+      this.items = [];
+      this.count = 0;
+    }
+    Widget.prototype.add = function (item) {
+      if (!item) {
+        return this;
+      }
+      this.items.push(item);
+      this.count += 1;
+      return this;
+    };
+    Widget.prototype.render = function () {
+      var out = "";
+      for (var i = 0; i < this.items.length; i++) {
+        out += "<li>" + this.items[i] + "</li>";
+      }
+      return "<ul>" + out + "</ul>";
+    };
+    const pick = (obj, keys) => keys.reduce((acc, key) => {
+      acc[key] = obj[key];
+      return acc;
+    }, {});
+    const total = (list) => list.filter((x) => x > 0).map((x) => x * 2).reduce((a, b) => a + b, 0);
+    let state = { ready: false, value: null };
+    switch (config.retries) {
+      case 1:
+        state.ready = true;
+        break;
+      default:
+        state.value = total([1, -2, 3, 4]);
+    }
+    try {
+      dep.init(config, function (err, result) {
+        if (err) throw err;
+        state.value = pick(result, ["a", "b"]);
+      });
+    } catch (e) {
+      state.ready = false
+    }
+    module.exports = { Widget: Widget, pick: pick, total: total, state: state, label: `m${%(id)d}` };
+  };'''
+
+PRELUDE = '''function __main(modules) {
+  var cache = {};
+  function __require(id) {
+    if (cache[id]) return cache[id].exports;
+    var module = cache[id] = { exports: {} };
+    modules[id](module, module.exports, __require);
+    return module.exports;
+  }
+  return __require(0);
+}
+var __modules = [];
+'''
+
+
+def bundle(count):
+    parts = [MODULE % {"id": i, "dep": max(i - 1, 0)} for i in range(count)]
+    return PRELUDE + "\n".join(parts) + "\n__main(__modules);\n"
+
+
+def collect(paths):
+    files = []
+    for root_dir in paths:
+        for root, _, names in os.walk(root_dir):
+            for name in names:
+                if name.endswith(".js"):
+                    files.append(os.path.join(root, name))
+    return sorted(files)
+
+
+def run(cmd):
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    return proc.returncode, proc.stdout
+
+
+def best_time(cmd, repeat):
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        subprocess.run(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def main():
+    modules = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+    repeat = int(sys.argv[2]) if len(sys.argv) > 2 else 3
+    exe = ".exe" if os.name == "nt" else ""
+    parser = os.path.join(".", "js_parser" + exe)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "bundle.js")
+        with open(path, "w") as f:
+            f.write(bundle(modules))
+        size = os.path.getsize(path)
+
+        mismatches = 0
+        files = collect(["test", "tmp"]) + [path]
+        for name in files:
+            if run([parser, "--dump-ast", name]) != run([parser, "--lex-pipeline", "--dump-ast", name]):
+                mismatches += 1
+                print("MISMATCH %s" % name)
+        print("%d files, %d mismatches" % (len(files), mismatches))
+
+        status, _ = run([parser, path])
+        print("bundle: %d modules, %d bytes, %s" % (modules, size, "PASS" if status == 0 else "FAIL"))
+        pull = best_time([parser, path], repeat)
+        for label, extra in (("pull", []), ("pretokenize", ["--pretokenize"]), ("lex-pipeline", ["--lex-pipeline"])):
+            elapsed = pull if not extra else best_time([parser] + extra + [path], repeat)
+            print("%-12s %.3fs  %.2f MB/s  %.2fx" % (label, elapsed, size / 1048576.0 / elapsed, pull / elapsed))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,52 @@
+import os
+import subprocess
+import sys
+import time
+
+
+# 对比 js_parser 两种取 token 方式在 test/ 语料上的耗时：
+#   pull        —— yylex 每次向 lexer 拉取一个 token，前瞻时复制状态重新扫描
+#   pretokenize —— 先把整个文件切分进 SoA 数组，yylex / 前瞻只移动下标
+# 用法：python tmp/bench_pretokenize.py [repeat] [dir ...]
+def collect(paths):
+    files = []
+    for root_dir in paths:
+        for root, _, names in os.walk(root_dir):
+            for name in names:
+                if name.endswith(".js"):
+                    files.append(os.path.join(root, name))
+    return sorted(files)
+
+
+def run_mode(parser, files, extra, repeat):
+    total = 0.0
+    for path in files:
+        for _ in range(repeat):
+            start = time.perf_counter()
+            subprocess.run([parser] + extra + [path], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+            total += time.perf_counter() - start
+    return total
+
+
+def main():
+    repeat = int(sys.argv[1]) if len(sys.argv) > 1 else 5
+    paths = sys.argv[2:] or ["test"]
+    exe = ".exe" if os.name == "nt" else ""
+    parser = os.path.join(".", "js_parser" + exe)
+    files = collect(paths)
+    total_bytes = sum(os.path.getsize(f) for f in files)
+
+    pull = run_mode(parser, files, [], repeat)
+    pretok = run_mode(parser, files, ["--pretokenize"], repeat)
+
+    kb = total_bytes * repeat / 1024.0
+    print("%d files, %d bytes, repeat=%d" % (len(files), total_bytes, repeat))
+    print("pull        %.3fs  %.2f KB/s" % (pull, kb / pull if pull > 0 else 0.0))
+    print("pretokenize %.3fs  %.2f KB/s" % (pretok, kb / pretok if pretok > 0 else 0.0))
+    if pretok > 0:
+        print("speedup     %.2fx" % (pull / pretok))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
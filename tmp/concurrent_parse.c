@@ -0,0 +1,121 @@
+// 同一进程内多线程并发解析，检查结果与串行解析一致（节点类型序列、错误数、诊断）
+// 构建：make lib && gcc -std=c99 -D_GNU_SOURCE -Isrc -Ibuild/generated tmp/concurrent_parse.c build/libjsparser.a -lm -pthread -o build/concurrent_parse
+// 用法：build/concurrent_parse <threads> <rounds> file.js...
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "js_parser.h"
+#include "source_file.h"
+
+typedef struct
+{
+    uint64_t ast_hash;
+    size_t node_count;
+    int error_count;
+    uint64_t diag_hash;
+} ParseSummary;
+
+typedef struct
+{
+    SourceFile *sources;
+    ParseSummary *expected;
+    int file_count;
+    int rounds;
+    int first;
+    int mismatches;
+} Worker;
+
+static void hash_node(ASTNode *node, void *userdata) {
+    ParseSummary *summary = (ParseSummary *)userdata;
+    summary->ast_hash = summary->ast_hash * 1099511628211ULL ^ (uint64_t)node->type;
+    summary->node_count++;
+}
+
+static ParseSummary parse_one(JSParser *parser, const SourceFile *source) {
+    JSParseOptions options;
+    js_parse_options_init(&options);
+    options.input_terminated = true;
+    JSParseResult result;
+    js_parse_buffer(parser, source->data, source->length + 1, &options, &result);
+
+    ParseSummary summary = {14695981039346656037ULL, 0, result.error_count, 0};
+    if (result.ast) {
+        ast_traverse(result.ast, hash_node, &summary);
+    }
+    for (size_t i = 0; i < result.diagnostic_count; i++) {
+        const JSDiagnostic *d = &result.diagnostics[i];
+        summary.diag_hash = summary.diag_hash * 31 + (uint64_t)d->line * 1000003u + (uint64_t)d->column;
+        for (const char *p = d->message; *p; p++) {
+            summary.diag_hash = summary.diag_hash * 131 + (unsigned char)*p;
+        }
+    }
+    js_parse_result_free(&result);
+    return summary;
+}
+
+static bool summary_equal(const ParseSummary *a, const ParseSummary *b) {
+    return a->ast_hash == b->ast_hash && a->node_count == b->node_count
+        && a->error_count == b->error_count && a->diag_hash == b->diag_hash;
+}
+
+static void *worker_main(void *arg) {
+    Worker *worker = (Worker *)arg;
+    JSParser *parser = js_parser_new();
+    for (int r = 0; r < worker->rounds; r++) {
+        for (int k = 0; k < worker->file_count; k++) {
+            int i = (k + worker->first) % worker->file_count;
+            ParseSummary got = parse_one(parser, &worker->sources[i]);
+            if (!summary_equal(&got, &worker->expected[i])) {
+                worker->mismatches++;
+            }
+        }
+    }
+    js_parser_free(parser);
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s <threads> <rounds> file.js...\n", argv[0]);
+        return 1;
+    }
+    int threads = atoi(argv[1]);
+    int rounds = atoi(argv[2]);
+    int file_count = argc - 3;
+    SourceFile *sources = (SourceFile *)calloc((size_t)file_count, sizeof(SourceFile));
+    ParseSummary *expected = (ParseSummary *)calloc((size_t)file_count, sizeof(ParseSummary));
+
+    JSParser *parser = js_parser_new();
+    for (int i = 0; i < file_count; i++) {
+        if (!source_file_load(&sources[i], argv[i + 3], true)) {
+            return 1;
+        }
+        expected[i] = parse_one(parser, &sources[i]);
+    }
+    js_parser_free(parser);
+
+    pthread_t *tids = (pthread_t *)calloc((size_t)threads, sizeof(pthread_t));
+    Worker *workers = (Worker *)calloc((size_t)threads, sizeof(Worker));
+    for (int t = 0; t < threads; t++) {
+        workers[t] = (Worker){sources, expected, file_count, rounds, t, 0};
+        pthread_create(&tids[t], NULL, worker_main, &workers[t]);
+    }
+    int mismatches = 0;
+    for (int t = 0; t < threads; t++) {
+        pthread_join(tids[t], NULL);
+        mismatches += workers[t].mismatches;
+    }
+    printf("%d files, threads=%d, rounds=%d, %d mismatches\n", file_count, threads, rounds, mismatches);
+
+    for (int i = 0; i < file_count; i++) {
+        source_file_release(&sources[i]);
+    }
+    free(sources);
+    free(expected);
+    free(tids);
+    free(workers);
+    return mismatches == 0 ? 0 : 2;
+}
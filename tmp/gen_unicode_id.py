@@ -0,0 +1,120 @@
+import sys
+import unicodedata
+
+
+# 生成 src/unicode_id.c：ID_Start / ID_Continue 的两级位图表（按 Python 自带的 unicodedata）
+# 用法：python tmp/gen_unicode_id.py > src/unicode_id.c
+#
+# 按 UAX #31 / DerivedCoreProperties 的定义：
+#   ID_Start    = Lu Ll Lt Lm Lo Nl + Other_ID_Start - Pattern_Syntax - Pattern_White_Space
+#   ID_Continue = ID_Start + Mn Mc Nd Pc + Other_ID_Continue - Pattern_Syntax - Pattern_White_Space
+BLOCK_BITS = 8
+BLOCK_SIZE = 1 << BLOCK_BITS
+
+START_CATEGORIES = {"Lu", "Ll", "Lt", "Lm", "Lo", "Nl"}
+CONTINUE_CATEGORIES = {"Mn", "Mc", "Nd", "Pc"}
+
+OTHER_ID_START = {0x1885, 0x1886, 0x2118, 0x212E, 0x309B, 0x309C}
+OTHER_ID_CONTINUE = {0x00B7, 0x0387, 0x19DA} | set(range(0x1369, 0x1372))
+
+PATTERN_SYNTAX_RANGES = [
+    (0x0021, 0x002F), (0x003A, 0x0040), (0x005B, 0x005E), (0x0060, 0x0060),
+    (0x007B, 0x007E), (0x00A1, 0x00A7), (0x00A9, 0x00A9), (0x00AB, 0x00AC),
+    (0x00AE, 0x00AE), (0x00B0, 0x00B1), (0x00B6, 0x00B6), (0x00BB, 0x00BB),
+    (0x00BF, 0x00BF), (0x00D7, 0x00D7), (0x00F7, 0x00F7), (0x2010, 0x2027),
+    (0x2030, 0x203E), (0x2041, 0x2053), (0x2055, 0x205E), (0x2190, 0x245F),
+    (0x2500, 0x2775), (0x2794, 0x2BFF), (0x2E00, 0x2E7F), (0x3001, 0x3003),
+    (0x3008, 0x3020), (0x3030, 0x3030), (0xFD3E, 0xFD3F), (0xFE45, 0xFE46),
+]
+PATTERN_WHITE_SPACE = {0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x0020, 0x0085,
+                       0x200E, 0x200F, 0x2028, 0x2029}
+
+
+def excluded(cp):
+    if cp in PATTERN_WHITE_SPACE:
+        return True
+    return any(lo <= cp <= hi for lo, hi in PATTERN_SYNTAX_RANGES)
+
+
+def build_sets():
+    start = set()
+    cont = set()
+    for cp in range(0x110000):
+        cat = unicodedata.category(chr(cp))
+        is_start = cat in START_CATEGORIES or cp in OTHER_ID_START
+        is_cont = is_start or cat in CONTINUE_CATEGORIES or cp in OTHER_ID_CONTINUE
+        if excluded(cp):
+            continue
+        if is_start:
+            start.add(cp)
+        if is_cont:
+            cont.add(cp)
+    return start, cont
+
+
+def two_level(members):
+    limit = (max(members) // BLOCK_SIZE + 1) * BLOCK_SIZE
+    blocks = []
+    block_index = {}
+    stage1 = []
+    for base in range(0, limit, BLOCK_SIZE):
+        bits = bytearray(BLOCK_SIZE // 8)
+        for cp in range(base, base + BLOCK_SIZE):
+            if cp in members:
+                bits[(cp - base) >> 3] |= 1 << (cp & 7)
+        key = bytes(bits)
+        if key not in block_index:
+            block_index[key] = len(blocks)
+            blocks.append(key)
+        stage1.append(block_index[key])
+    assert len(blocks) <= 256
+    return limit, stage1, blocks
+
+
+def emit_table(out, name, members):
+    limit, stage1, blocks = two_level(members)
+    out.append("#define %s_LIMIT 0x%X" % (name.upper(), limit))
+    out.append("")
+    out.append("static const uint8_t %s_stage1[%d] = {" % (name, len(stage1)))
+    for i in range(0, len(stage1), 16):
+        out.append("    " + ", ".join("%d" % v for v in stage1[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("static const uint8_t %s_stage2[%d][%d] = {" % (name, len(blocks), BLOCK_SIZE // 8))
+    for block in blocks:
+        out.append("    {" + ", ".join("0x%02X" % b for b in block) + "},")
+    out.append("};")
+    out.append("")
+    return len(stage1) + len(blocks) * (BLOCK_SIZE // 8)
+
+
+def main():
+    start, cont = build_sets()
+    out = []
+    out.append("// 由 tmp/gen_unicode_id.py 生成（Unicode %s），请勿手改" % unicodedata.unidata_version)
+    out.append("// 两级表：stage1 按 %d 个码点一块给出块号，stage2 为去重后的块位图" % BLOCK_SIZE)
+    out.append("")
+    out.append("#include \"unicode_id.h\"")
+    out.append("")
+    size = emit_table(out, "id_start", start)
+    size += emit_table(out, "id_continue", cont)
+    out.append("bool unicode_is_id_start(uint32_t cp) {")
+    out.append("    if (cp >= ID_START_LIMIT) {")
+    out.append("        return false;")
+    out.append("    }")
+    out.append("    return (id_start_stage2[id_start_stage1[cp >> %d]][(cp & 0x%X) >> 3] >> (cp & 7)) & 1;" % (BLOCK_BITS, BLOCK_SIZE - 1))
+    out.append("}")
+    out.append("")
+    out.append("bool unicode_is_id_continue(uint32_t cp) {")
+    out.append("    if (cp >= ID_CONTINUE_LIMIT) {")
+    out.append("        return false;")
+    out.append("    }")
+    out.append("    return (id_continue_stage2[id_continue_stage1[cp >> %d]][(cp & 0x%X) >> 3] >> (cp & 7)) & 1;" % (BLOCK_BITS, BLOCK_SIZE - 1))
+    out.append("}")
+    sys.stdout.write("\n".join(out) + "\n")
+    sys.stderr.write("ID_Start %d, ID_Continue %d code points, tables %d bytes\n" % (len(start), len(cont), size))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,95 @@
+import json
+import os
+import re
+import subprocess
+import sys
+
+
+# 文法规模与 GLR 运行时统计：
+#   表规模 —— 从 build/generated/parser.c 读取状态数、规则数、非终结符数、YYLAST（动作表长度），
+#            从 bison 的警告里读取冲突数，并给出 parser.o 的代码段大小
+#   运行时 —— 用 --glr-only --glr-stats（整段交给 GLR）解析语料，汇总每个 token 的归约次数、
+#            栈分裂与合并次数、延后动作数、栈数峰值，以及分裂时的前瞻 token 分布
+# 用法：python tmp/grammar_stats.py [文件或目录 ...]
+GEN_DIR = os.path.join("build", "generated")
+
+
+def collect(paths):
+    files = []
+    for path in paths:
+        if os.path.isfile(path):
+            files.append(path)
+            continue
+        for root, _, names in os.walk(path):
+            for name in names:
+                if name.endswith(".js"):
+                    files.append(os.path.join(root, name))
+    return sorted(files)
+
+
+def table_stats():
+    stats = {}
+    with open(os.path.join(GEN_DIR, "parser.c"), encoding="utf-8", errors="replace") as f:
+        for line in f:
+            match = re.match(r"#define (YYNSTATES|YYNRULES|YYNNTS|YYLAST)\s+(\d+)", line)
+            if match:
+                stats[match.group(1)] = int(match.group(2))
+    proc = subprocess.run(["bison", "-o", os.devnull, os.path.join(GEN_DIR, "parser.y")],
+                          capture_output=True, text=True)
+    for kind in ("shift/reduce", "reduce/reduce"):
+        match = re.search(r"(\d+) %s conflicts" % kind, proc.stderr)
+        stats[kind] = int(match.group(1)) if match else 0
+    proc = subprocess.run(["size", os.path.join(GEN_DIR, "..", "obj", "parser.o")], capture_output=True, text=True)
+    lines = proc.stdout.split("\n")
+    if len(lines) > 1 and lines[1].split():
+        stats["parser.o text"] = int(lines[1].split()[0])
+    return stats
+
+
+# js_parser --glr-stats 在 stderr 上输出的单行 JSON
+def glr_stats(parser, path, *args):
+    proc = subprocess.run([parser, "--glr-stats"] + list(args) + [path],
+                          capture_output=True, text=True, errors="replace")
+    for line in proc.stderr.split("\n"):
+        if line.startswith('{"parses"'):
+            return json.loads(line)
+    return None
+
+
+def trace_stats(parser, files):
+    totals = {"tokens": 0, "reductions": 0, "splits": 0, "merges": 0, "deferred_actions": 0, "peak_stacks": 0}
+    split_tokens = {}
+    for path in files:
+        stats = glr_stats(parser, path, "--glr-only")
+        if not stats:
+            continue
+        for key in totals:
+            totals[key] = max(totals[key], stats[key]) if key == "peak_stacks" else totals[key] + stats[key]
+        for token, count in stats["splits_by_token"].items():
+            split_tokens[token] = split_tokens.get(token, 0) + count
+    return totals, split_tokens
+
+
+def main():
+    paths = sys.argv[1:] or ["test"]
+    exe = ".exe" if os.name == "nt" else ""
+    parser = os.path.join(".", "js_parser" + exe)
+
+    for key, value in table_stats().items():
+        print("%-16s %d" % (key, value))
+
+    totals, split_tokens = trace_stats(parser, collect(paths))
+    tokens = totals["tokens"]
+    print("tokens           %d" % tokens)
+    print("reductions       %d  (%.2f per token)" % (totals["reductions"], totals["reductions"] / tokens if tokens else 0.0))
+    print("stack splits     %d" % totals["splits"])
+    print("stack merges     %d" % totals["merges"])
+    print("deferred actions %d" % totals["deferred_actions"])
+    print("peak stacks      %d" % totals["peak_stacks"])
+    for token, count in sorted(split_tokens.items(), key=lambda item: -item[1])[:8]:
+        print("  on %-12s %d" % (token, count))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
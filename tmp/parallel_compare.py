@@ -0,0 +1,52 @@
+import os
+import subprocess
+import sys
+
+
+# 并行切分的确定性检查：对比串行输出与 --threads / --lex-threads 的输出（应逐字节相同）。
+# JS_LEXER_CHUNK 调小后小文件也会被切成很多段，段首会落在注释、字符串、模板和正则中间
+# 用法：python tmp/parallel_compare.py [chunk] [threads] [dir ...]
+def run(cmd, env=None):
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+    return proc.returncode, proc.stdout
+
+
+def collect(paths):
+    files = []
+    for root_dir in paths:
+        for root, _, names in os.walk(root_dir):
+            for name in names:
+                if name.endswith(".js"):
+                    files.append(os.path.join(root, name))
+    return sorted(files)
+
+
+def main():
+    chunk = sys.argv[1] if len(sys.argv) > 1 else "16"
+    threads = sys.argv[2] if len(sys.argv) > 2 else "4"
+    paths = sys.argv[3:] or ["test", "tmp"]
+    exe = ".exe" if os.name == "nt" else ""
+    lexer = os.path.join(".", "js_lexer" + exe)
+    parser = os.path.join(".", "js_parser" + exe)
+
+    env = dict(os.environ)
+    env["JS_LEXER_CHUNK"] = chunk
+
+    mismatches = 0
+    files = collect(paths)
+    for path in files:
+        for name, base, parallel in (
+            ("lexer", [lexer, path], [lexer, "--threads", threads, path]),
+            ("parser", [parser, "--pretokenize", "--dump-ast", path],
+             [parser, "--lex-threads", threads, "--dump-ast", path]),
+        ):
+            if run(base) != run(parallel, env):
+                mismatches += 1
+                print("MISMATCH [%s] %s" % (name, path))
+
+    print("%d files, chunk=%s, threads=%s, %d mismatches" % (len(files), chunk, threads, mismatches))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,123 @@
+// 推送式解析的校验与计时：按固定块大小、块间间隔模拟分块到达的输入（网络回放、上传流），
+// 检查 js_parser_feed / js_parser_finish 的结果与 js_parse_buffer 一致（节点类型序列、错误数、诊断），
+// 并对比最后一个字节到达之后还要等多久才能得到结论：推送式只剩收尾，整块解析要从头开始
+// 构建：make lib && gcc -std=c99 -D_GNU_SOURCE -Isrc -Ibuild/generated tmp/push_feed.c build/libjsparser.a -lm -pthread -o build/push_feed
+// 用法：build/push_feed <chunk> <delay_us> file.js...
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "js_parser.h"
+#include "source_file.h"
+
+typedef struct
+{
+    uint64_t ast_hash;
+    size_t node_count;
+    int error_count;
+    uint64_t diag_hash;
+} ParseSummary;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void sleep_us(long us) {
+    struct timespec ts = {us / 1000000, (us % 1000000) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+static void hash_node(ASTNode *node, void *userdata) {
+    ParseSummary *summary = (ParseSummary *)userdata;
+    summary->ast_hash = summary->ast_hash * 1099511628211ULL ^ (uint64_t)node->type;
+    summary->node_count++;
+}
+
+static ParseSummary summarize(JSParseResult *result) {
+    ParseSummary summary = {14695981039346656037ULL, 0, result->error_count, 0};
+    if (result->ast) {
+        ast_traverse(result->ast, hash_node, &summary);
+    }
+    for (size_t i = 0; i < result->diagnostic_count; i++) {
+        const JSDiagnostic *d = &result->diagnostics[i];
+        summary.diag_hash = summary.diag_hash * 31 + (uint64_t)d->line * 1000003u + (uint64_t)d->column;
+        for (const char *p = d->message; *p; p++) {
+            summary.diag_hash = summary.diag_hash * 131 + (unsigned char)*p;
+        }
+    }
+    js_parse_result_free(result);
+    return summary;
+}
+
+static bool summary_equal(const ParseSummary *a, const ParseSummary *b) {
+    return a->ast_hash == b->ast_hash && a->node_count == b->node_count
+        && a->error_count == b->error_count && a->diag_hash == b->diag_hash;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s <chunk> <delay_us> file.js...\n", argv[0]);
+        return 1;
+    }
+    size_t chunk = (size_t)strtoul(argv[1], NULL, 10);
+    long delay = atol(argv[2]);
+    if (chunk == 0) {
+        chunk = 4096;
+    }
+
+    JSParser *parser = js_parser_new();
+    JSParseOptions options;
+    js_parse_options_init(&options);
+    int mismatches = 0;
+    double buffered_total = 0;
+    double pushed_total = 0;
+
+    for (int i = 3; i < argc; i++) {
+        SourceFile source;
+        if (!source_file_load(&source, argv[i], false)) {
+            return 1;
+        }
+
+        // 整块解析：收齐之后才开始，结论的延迟就是整个解析时间
+        JSParseResult result;
+        double start = now_seconds();
+        js_parse_buffer(parser, source.data, source.length, &options, &result);
+        double buffered = now_seconds() - start;
+        ParseSummary expected = summarize(&result);
+
+        // 推送式：块间间隔里解析线程已经在处理之前的数据
+        double last_byte = 0;
+        if (js_parser_begin(parser, &options)) {
+            for (size_t offset = 0; offset < source.length; offset += chunk) {
+                size_t n = source.length - offset < chunk ? source.length - offset : chunk;
+                if (delay > 0) {
+                    sleep_us(delay);
+                }
+                if (!js_parser_feed(parser, source.data + offset, n)) {
+                    break; // 已出错，其余数据不必再送
+                }
+            }
+            last_byte = now_seconds();
+        }
+        js_parser_finish(parser, &result);
+        double pushed = now_seconds() - last_byte;
+        ParseSummary got = summarize(&result);
+
+        bool same = summary_equal(&expected, &got);
+        mismatches += same ? 0 : 1;
+        buffered_total += buffered;
+        pushed_total += pushed;
+        printf("%-48s %8zu bytes  buffer %.4fs  push %.4fs after last byte%s\n", argv[i], source.length,
+               buffered, pushed, same ? "" : "  MISMATCH");
+        source_file_release(&source);
+    }
+    js_parser_free(parser);
+
+    printf("%d files, chunk=%zu, delay=%ldus, verdict latency: buffer %.3fs, push %.3fs, %d mismatches\n",
+           argc - 3, chunk, delay, buffered_total, pushed_total, mismatches);
+    return mismatches == 0 ? 0 : 2;
+}
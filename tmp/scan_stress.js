@@ -0,0 +1,360 @@
+/* license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+ license text line
+**/
+var a = 1;
+var s = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyy\
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz";
+var t = 'ab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cdab\'cd';
+var u = `qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq${ a + `in${s}ner` }line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+line
+$ {x} $$ `;
+// cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+ 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	 	a = a / 2 /* x */ * 3;
+/*****************************************************************************************************/
+var b = 2;
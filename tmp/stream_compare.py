@@ -0,0 +1,53 @@
+import os
+import subprocess
+import sys
+
+
+# 对比整文件读取与 --stream 流式读取、--push 分块推送的输出，JS_LEXER_WINDOW 调小后可覆盖跨窗口的 token，
+# JS_PUSH_CHUNK 调小后 token 会被拆在不同的 js_parser_feed 调用之间
+# 用法：python tmp/stream_compare.py [window] [chunk] [dir ...]
+def run(cmd, env=None):
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+    return proc.returncode, proc.stdout
+
+
+def collect(paths):
+    files = []
+    for root_dir in paths:
+        for root, _, names in os.walk(root_dir):
+            for name in names:
+                if name.endswith(".js"):
+                    files.append(os.path.join(root, name))
+    return sorted(files)
+
+
+def main():
+    window = sys.argv[1] if len(sys.argv) > 1 else "64"
+    chunk = sys.argv[2] if len(sys.argv) > 2 else "7"
+    paths = sys.argv[3:] or ["test"]
+    exe = ".exe" if os.name == "nt" else ""
+    lexer = os.path.join(".", "js_lexer" + exe)
+    parser = os.path.join(".", "js_parser" + exe)
+
+    env = dict(os.environ)
+    env["JS_LEXER_WINDOW"] = window
+    env["JS_PUSH_CHUNK"] = chunk
+
+    mismatches = 0
+    files = collect(paths)
+    for path in files:
+        for name, base, streamed in (
+            ("lexer", [lexer, path], [lexer, "--stream", path]),
+            ("parser", [parser, "--dump-ast", path], [parser, "--stream", "--dump-ast", path]),
+            ("push", [parser, "--dump-ast", path], [parser, "--push", "--dump-ast", path]),
+        ):
+            if run(base) != run(streamed, env):
+                mismatches += 1
+                print("MISMATCH [%s] %s" % (name, path))
+
+    print("%d files, window=%s, chunk=%s, %d mismatches" % (len(files), window, chunk, mismatches))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,71 @@
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+
+# ASI 适配层嵌套压力测试：按给定深度生成几种深层嵌套的脚本（对象字面量里的语句块、三元表达式里的对象字面量、
+# 条件括号里的函数、参数默认值里的函数），检查 js_parser 全部通过，并且耗时随深度大致线性增长。
+# 用法：python tmp/stress_nesting.py [深度 ...]   默认 10000 100000，使用 ./js_parser
+DEPTHS = [10000, 100000]
+MAX_GROWTH = 3.0  # 深度放大 k 倍时，耗时不应超过 k * MAX_GROWTH 倍
+
+
+def braces(n):
+    return "var o = {\n  f: function () {\n" + "{\n" * n + "x = 1\n" + "}\n" * n + "  },\n  b: 1\n};\n"
+
+
+def conditional(n):
+    return "var t = " + "c ? " * n + "0" + " : 0" * (n - 1) + " : {\n  k: 1\n};\n"
+
+
+def control(n):
+    return "if (function () {\n" * n + "x = 1\n" + "}) {}\n" * (n - 1) + "}) {\n  y = 2\n}\n"
+
+
+def params(n):
+    return "var f = " + "function (a =\n" * n + "1" + ") {}\n" * n + "var g = {\n  ok: true\n}\n"
+
+
+SHAPES = [("braces", braces), ("conditional", conditional), ("control", control), ("params", params)]
+
+
+def run(parser, path):
+    start = time.perf_counter()
+    proc = subprocess.run([parser, "--pretokenize", path], stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    elapsed = time.perf_counter() - start
+    return proc.returncode == 0, elapsed
+
+
+def main():
+    exe = ".exe" if os.name == "nt" else ""
+    parser = os.path.join(".", "js_parser" + exe)
+    depths = [int(arg) for arg in sys.argv[1:]] or DEPTHS
+    failures = 0
+    with tempfile.TemporaryDirectory() as tmp:
+        print("%-14s" % "shape" + "".join("%14s" % depth for depth in depths))
+        for name, make in SHAPES:
+            row = "%-14s" % name
+            previous = None
+            for depth in depths:
+                path = os.path.join(tmp, "%s_%d.js" % (name, depth))
+                with open(path, "w") as f:
+                    f.write(make(depth))
+                ok, elapsed = run(parser, path)
+                cell = "%.2fs" % elapsed if ok else "FAIL"
+                if ok and previous and elapsed > previous[1] * (depth / previous[0]) * MAX_GROWTH:
+                    cell += "!"
+                    failures += 1
+                if not ok:
+                    failures += 1
+                row += "%14s" % cell
+                previous = (depth, max(elapsed, 1e-3))
+            print(row)
+    if failures:
+        print("%d failure(s): FAIL = rejected or crashed, ! = superlinear growth" % failures)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
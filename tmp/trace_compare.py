@@ -1,84 +1,133 @@
-import re
+import os
+import subprocess
 import sys
+import tempfile
 from collections import Counter
 
 
-def analyze(path):
-    current_token = None
+# 比较两份 GLR 二进制轨迹（js_parser --glr-trace FILE，格式见 src/glr_stats.h）：
+# 栈号峰值、同时存活的栈数峰值、分裂时的前瞻 token 与分裂出的栈首先归约的规则。
+# 参数也可以是 .js 文件，此时先用 --glr-only --glr-trace 生成轨迹。
+# 用法：python tmp/trace_compare.py <traceA|a.js> <traceB|b.js>
+MAGIC = b"JSGLRT1\n"
+FIELDS = {"N": 2, "L": 3, "P": 0, "T": 1, "R": 2, "D": 2, "S": 2, "M": 2, "X": 1, "A": 0, "Z": 0}
+
+
+def read_uint(f):
+    value = shift = 0
+    while True:
+        byte = f.read(1)
+        if not byte:
+            raise EOFError
+        value |= (byte[0] & 0x7F) << shift
+        shift += 7
+        if byte[0] < 0x80:
+            return value
+
+
+# 逐条产出 (事件类型, 参数...)；NAME 记录在这里解析掉，T 与 L 的名字编号替换为名字
+def read_events(f):
+    if f.read(len(MAGIC)) != MAGIC:
+        raise ValueError("not a GLR trace")
+    names = {}
+    while True:
+        kind = f.read(1)
+        if not kind:
+            return
+        kind = kind.decode("latin-1")
+        if kind not in FIELDS:
+            return      # 轨迹之后的其他输出（如写到 /dev/stdout 时的 [PASS] 行）
+        try:
+            args = [read_uint(f) for _ in range(FIELDS[kind])]
+        except EOFError:
+            return      # 解析中途被中断的轨迹
+        if kind == "N":
+            names[args[0]] = f.read(args[1]).decode("utf-8", "replace")
+            continue
+        if kind == "T":
+            args[0] = names[args[0]]
+        elif kind == "L":
+            args[2] = names[args[2]]
+        yield (kind,) + tuple(args)
+
+
+def analyze(f):
+    lookahead = None
+    rules = {}
     splits = Counter()
     split_rules = Counter()
-    max_stack = 0
-    stack_alive = set([0])
+    pending = None
+    alive = 1
     max_alive = 1
-    last_rule_for_stack = {}
-    for line in open(path, "r", encoding="utf-8", errors="ignore"):
-        line = line.strip()
-        if line.startswith("Next token is token"):
-            parts = line.split()
-            if len(parts) >= 5:
-                current_token = parts[4]
-            else:
-                current_token = None
-        elif "Splitting off stack" in line:
-            m = re.search(r"Splitting off stack (\d+) from (\d+)", line)
-            if m:
-                new_id = int(m.group(1))
-                parent_id = int(m.group(2))
-                max_stack = max(max_stack, new_id)
-                parent_rule = last_rule_for_stack.get(parent_id)
-                if parent_rule:
-                    split_rules[parent_rule] += 1
-            else:
-                new_id = None
-            if current_token:
-                splits[current_token] += 1
-            if new_id is not None:
-                stack_alive.add(new_id)
-                max_alive = max(max_alive, len(stack_alive))
-        elif "Stack " in line and "dies" in line:
-            m = re.search(r"Stack (\d+)", line)
-            if m:
-                sid = int(m.group(1))
-                stack_alive.discard(sid)
-        elif line.startswith("Rename stack"):
-            # treat rename: remove old, add new
-            m = re.search(r"Rename stack (\d+) -> (\d+)", line)
-            if m:
-                old = int(m.group(1))
-                new = int(m.group(2))
-                if old in stack_alive:
-                    stack_alive.discard(old)
-                    stack_alive.add(new)
-        elif line.startswith("Cleanup:"):
-            stack_alive.clear()
-        elif line.startswith("[PASS]") or line.startswith("[FAIL]"):
-            stack_alive.clear()
-        elif line.startswith("Reduced stack"):
-            m = re.search(r"Reduced stack (\d+) by rule (\d+) \(line (\d+)\)", line)
-            if m:
-                stack_id = int(m.group(1))
-                rule_no = int(m.group(2))
-                line_no = int(m.group(3))
-                last_rule_for_stack[stack_id] = (rule_no, line_no)
-    return splits, split_rules, max_stack, max_alive
+    max_stack = 0
+    counts = Counter()
+    for event in read_events(f):
+        kind = event[0]
+        counts[kind] += 1
+        if kind == "T":
+            lookahead = event[1]
+        elif kind == "L":
+            rules[event[1]] = "%s (line %d)" % (event[3], event[2])
+        elif kind == "S":
+            splits[lookahead] += 1
+            pending = event[1]
+            max_stack = max(max_stack, event[1])
+            alive += 1
+            max_alive = max(max_alive, alive)
+        elif kind in ("R", "D"):
+            if event[1] == pending:
+                split_rules["rule %d: %s" % (event[2], rules.get(event[2], "?"))] += 1
+                pending = None
+        elif kind in ("M", "X"):
+            alive = max(alive - 1, 0)
+        elif kind in ("Z", "P"):
+            alive = 1
+            pending = None
+    return counts, splits, split_rules, max_stack, max_alive
+
+
+def open_trace(path):
+    if not path.endswith(".js"):
+        return open(path, "rb")
+    exe = ".exe" if os.name == "nt" else ""
+    trace = tempfile.TemporaryFile()
+    fd, name = tempfile.mkstemp(suffix=".glrtrace")
+    os.close(fd)
+    try:
+        subprocess.run([os.path.join(".", "js_parser" + exe), "--glr-only", "--glr-trace", name, path],
+                       stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        with open(name, "rb") as f:
+            trace.write(f.read())
+    finally:
+        os.remove(name)
+    trace.seek(0)
+    return trace
+
+
+def report(path, result):
+    counts, splits, split_rules, max_stack, max_alive = result
+    print(f"=== {path} ===")
+    print(f"Tokens: {counts['T']}, reductions: {counts['R'] + counts['D']} ({counts['D']} deferred), "
+          f"splits: {counts['S']}, merges: {counts['M']}")
+    print(f"Max stack id: {max_stack}")
+    print(f"Peak concurrent stacks: {max_alive}")
+    for token, count in splits.most_common(10):
+        print(f"{token}: {count}")
+    if split_rules:
+        print("Top split rules:")
+        for rule, count in split_rules.most_common(5):
+            print(f"  {rule}: {count}")
 
 
 def main():
     if len(sys.argv) != 3:
-        print("Usage: trace_compare.py <traceA> <traceB>")
-        return
+        print("Usage: trace_compare.py <traceA|a.js> <traceB|b.js>")
+        return 1
     for path in sys.argv[1:]:
-        splits, split_rules, max_stack, max_alive = analyze(path)
-        print(f"=== {path} ===")
-        print(f"Max stack id: {max_stack}")
-        print(f"Peak concurrent stacks (approx): {max_alive}")
-        for token, count in splits.most_common(10):
-            print(f"{token}: {count}")
-        if split_rules:
-            print("Top split rules (rule#line):")
-            for (rule_no, line_no), count in split_rules.most_common(5):
-                print(f"  rule {rule_no} @ line {line_no}: {count}")
+        with open_trace(path) as f:
+            report(path, analyze(f))
+    return 0
 
 
 if __name__ == "__main__":
-    main()
+    sys.exit(main())
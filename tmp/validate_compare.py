@@ -0,0 +1,66 @@
+import os
+import subprocess
+import sys
+import time
+
+
+# 对比完整解析与 --validate-only 的结论：退出码与全部输出（错误信息、[PASS]/[FAIL] 行）必须一致，
+# 快速路径与 --glr-only 各比一遍；同时给出两种模式的总耗时与子进程内存峰值
+# 用法：python tmp/validate_compare.py [dir|file ...]
+def run(cmd):
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    return proc.returncode, proc.stdout
+
+
+def peak_rss_kb(cmd):
+    # RUSAGE_CHILDREN 的峰值只增不减，单独起一个进程测量
+    code = ("import resource, subprocess, sys; "
+            "subprocess.run(sys.argv[1:], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL); "
+            "print(resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss)")
+    return int(subprocess.run([sys.executable, "-c", code] + cmd, stdout=subprocess.PIPE).stdout)
+
+
+def collect(paths):
+    files = []
+    for root_dir in paths:
+        if os.path.isfile(root_dir):
+            files.append(root_dir)
+            continue
+        for root, _, names in os.walk(root_dir):
+            for name in names:
+                if name.endswith(".js"):
+                    files.append(os.path.join(root, name))
+    return sorted(files)
+
+
+def main():
+    paths = sys.argv[1:] or ["test", "tmp"]
+    exe = ".exe" if os.name == "nt" else ""
+    parser = os.path.join(".", "js_parser" + exe)
+
+    mismatches = 0
+    elapsed = {False: 0.0, True: 0.0}
+    peak = {False: 0, True: 0}
+    files = collect(paths)
+    for path in files:
+        for extra in ([], ["--glr-only"]):
+            results = {}
+            for validate in (False, True):
+                cmd = [parser] + extra + (["--validate-only"] if validate else []) + [path]
+                start = time.perf_counter()
+                results[validate] = run(cmd)
+                elapsed[validate] += time.perf_counter() - start
+                if not extra:
+                    peak[validate] = max(peak[validate], peak_rss_kb(cmd))
+            if results[False] != results[True]:
+                mismatches += 1
+                print("MISMATCH %s %s" % (" ".join(extra) or "[fast path]", path))
+
+    print("%d files, %d mismatches" % (len(files), mismatches))
+    print("full parse: %.2f s, peak %d KB" % (elapsed[False], peak[False]))
+    print("validate:   %.2f s, peak %d KB" % (elapsed[True], peak[True]))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())